@@ -388,6 +388,8 @@ fd_topo_initialize( config_t * config ) {
     fd_topo_tile_t * tile = &topo->tiles[ i ];
     fd_topo_configure_tile( tile, config );
   }
+  for( ulong i=0UL; i<config->layout.idle_tiles_cnt; i++ ) fd_topob_tile_idle( topo, config->layout.idle_tiles[ i ], 1000UL*config->layout.idle_wake_latency_micros );
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) topo->tiles[ i ].link_latency = config->tiles.metric.link_latency_histograms;
 
   if( FD_UNLIKELY( is_auto_affinity ) ) fd_topob_auto_layout( topo, 1 );
 
@@ -120,6 +120,7 @@ extern action_t fd_action_dev;
 extern action_t fd_action_dev1;
 extern action_t fd_action_dump;
 extern action_t fd_action_flame;
+extern action_t fd_action_layout;
 extern action_t fd_action_help;
 extern action_t fd_action_metrics;
 extern action_t fd_action_load;
@@ -150,6 +151,7 @@ action_t * ACTIONS[] = {
   &fd_action_dev1,
   &fd_action_dump,
   &fd_action_flame,
+  &fd_action_layout,
   &fd_action_load,
   &fd_action_pktgen,
   &fd_action_quic_trace,
@@ -0,0 +1,137 @@
+#include "../../shared/fd_config.h"
+#include "../../shared/fd_action.h"
+#include "../../../flamenco/vm/fd_vm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* vm-prof merges the sBPF execution profiles of all exec tiles (see
+   capture.vm_prof) and prints the top entries by ticks.  SYSCALL and PC
+   entries are only recorded for sampled executions and are scaled by
+   the sampling rate such that they are comparable with PROG entries. */
+
+static void
+vm_prof_args( int *    pargc,
+              char *** pargv,
+              args_t * args ) {
+  if( FD_UNLIKELY( fd_env_strip_cmdline_contains( pargc, pargv, "--help" ) ) ) {
+    fputs(
+      "\nUsage: firedancer-dev vm-prof [GLOBAL FLAGS] [FLAGS]\n"
+      "\n"
+      "Flags:\n"
+      "  --top <num>   Number of entries to print per kind (default 32)\n"
+      "\n",
+      stderr );
+    exit( EXIT_SUCCESS );
+  }
+
+  args->vm_prof.top = fd_env_strip_cmdline_ulong( pargc, pargv, "--top", NULL, 32UL );
+}
+
+static char const *
+vm_prof_kind_str( int kind ) {
+  switch( kind ) {
+  case FD_VM_PROF_KIND_PROG:    return "prog";
+  case FD_VM_PROF_KIND_SYSCALL: return "syscall";
+  case FD_VM_PROF_KIND_PC:      return "pc";
+  default:                      return "unknown";
+  }
+}
+
+static void
+vm_prof_print( fd_vm_prof_t *             prof,
+               fd_sbpf_syscalls_t const * syscalls,
+               int                        kind,
+               ulong                      scale,
+               ulong                      top ) {
+  fd_vm_prof_slot_t * slot     = fd_vm_prof_slot( prof );
+  ulong               slot_max = prof->slot_max;
+
+  /* Selection of the top entries by ticks.  Printed entries are freed
+     in the (local) profile. */
+
+  printf( "\n%-8s %-44s %-32s %12s %16s %14s %10s\n", vm_prof_kind_str( kind ), "program", "id", "cnt", "ticks", "cu", "ticks/cu" );
+  for( ulong rank=0UL; rank<top; rank++ ) {
+    fd_vm_prof_slot_t * best = NULL;
+    for( ulong slot_idx=0UL; slot_idx<slot_max; slot_idx++ ) {
+      fd_vm_prof_slot_t * s = slot + slot_idx;
+      if( !s->cnt || fd_vm_prof_tag_kind( s->tag )!=kind ) continue;
+      if( !best || s->ticks>best->ticks ) best = s;
+    }
+    if( !best ) break;
+
+    ulong id = fd_vm_prof_tag_id( best->tag );
+    char  id_cstr[ 64 ];
+    if( kind==FD_VM_PROF_KIND_SYSCALL ) {
+      fd_sbpf_syscalls_t const * syscall = fd_sbpf_syscalls_query_const( syscalls, id, NULL );
+      snprintf( id_cstr, sizeof(id_cstr), "%s", syscall ? syscall->name : "?" );
+    } else if( kind==FD_VM_PROF_KIND_PC ) {
+      snprintf( id_cstr, sizeof(id_cstr), "pc %#lx", id<<FD_VM_PROF_PC_BUCKET_LG );
+    } else {
+      id_cstr[ 0 ] = '\0';
+    }
+
+    FD_BASE58_ENCODE_32_BYTES( best->program_id, program_b58 );
+    printf( "%-8lu %-44s %-32s %12lu %16lu %14lu %10.1f\n",
+            rank, program_b58, id_cstr, best->cnt*scale, best->ticks*scale, best->cu*scale,
+            best->cu ? (double)best->ticks/(double)best->cu : 0. );
+
+    best->cnt = 0UL;
+  }
+}
+
+void
+vm_prof_cmd_fn( args_t *   args,
+                config_t * config ) {
+  fd_topo_t * topo = &config->topo;
+
+  ulong exec_tile_cnt = fd_topo_tile_name_cnt( topo, "exec" );
+  if( FD_UNLIKELY( !exec_tile_cnt ) ) FD_LOG_ERR(( "exec tile not found" ));
+
+  /* Merge the profiles of all exec tiles into a local profile */
+
+  fd_vm_prof_t * prof = NULL;
+  for( ulong i=0UL; i<exec_tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ fd_topo_find_tile( topo, "exec", i ) ];
+    ulong obj_id = tile->exec.vm_prof_obj_id;
+    if( FD_UNLIKELY( obj_id==ULONG_MAX ) ) FD_LOG_ERR(( "vm profiling is not enabled, set capture.vm_prof in the config" ));
+
+    fd_topo_join_workspace( topo, &topo->workspaces[ topo->objs[ obj_id ].wksp_id ], FD_SHMEM_JOIN_MODE_READ_ONLY );
+    fd_vm_prof_t * tile_prof = fd_vm_prof_join( fd_topo_obj_laddr( topo, obj_id ) );
+    if( FD_UNLIKELY( !tile_prof ) ) FD_LOG_ERR(( "fd_vm_prof_join failed for exec:%lu", i ));
+
+    if( !prof ) {
+      ulong slot_max = tile_prof->slot_max*fd_ulong_pow2_up( exec_tile_cnt );
+      void * mem = aligned_alloc( fd_vm_prof_align(), fd_vm_prof_footprint( slot_max ) );
+      if( FD_UNLIKELY( !mem ) ) FD_LOG_ERR(( "aligned_alloc failed" ));
+      prof = fd_vm_prof_join( fd_vm_prof_new( mem, slot_max, tile_prof->sample_lg ) );
+      FD_TEST( prof );
+    }
+    fd_vm_prof_merge( prof, tile_prof );
+  }
+
+  fd_sbpf_syscalls_t * syscalls = fd_sbpf_syscalls_join( fd_sbpf_syscalls_new(
+      aligned_alloc( fd_sbpf_syscalls_align(), fd_sbpf_syscalls_footprint() ) ) );
+  FD_TEST( syscalls );
+  FD_TEST( !fd_vm_syscall_register_all( syscalls, 0 ) );
+
+  ulong scale = 1UL<<prof->sample_lg;
+  printf( "exec tiles: %lu, executions: %lu, sampled: %lu (1 in %lu), entries: %lu, dropped: %lu\n",
+          exec_tile_cnt, prof->exec_cnt, prof->sample_cnt, scale, prof->slot_cnt, prof->drop_cnt );
+
+  vm_prof_print( prof, syscalls, FD_VM_PROF_KIND_PROG,    1UL,   args->vm_prof.top );
+  vm_prof_print( prof, syscalls, FD_VM_PROF_KIND_SYSCALL, scale, args->vm_prof.top );
+  vm_prof_print( prof, syscalls, FD_VM_PROF_KIND_PC,      scale, args->vm_prof.top );
+
+  free( fd_sbpf_syscalls_delete( fd_sbpf_syscalls_leave( syscalls ) ) );
+  free( fd_vm_prof_delete( fd_vm_prof_leave( prof ) ) );
+}
+
+action_t fd_action_vm_prof = {
+  .name           = "vm-prof",
+  .args           = vm_prof_args,
+  .fn             = vm_prof_cmd_fn,
+  .require_config = 1,
+  .perm           = NULL,
+  .description    = "Print the sBPF execution profile of the exec tiles",
+};
@@ -21,9 +21,11 @@ extern fd_topo_obj_callbacks_t fd_obj_cb_tile;
 extern fd_topo_obj_callbacks_t fd_obj_cb_store;
 extern fd_topo_obj_callbacks_t fd_obj_cb_fec_sets;
 extern fd_topo_obj_callbacks_t fd_obj_cb_txncache;
+extern fd_topo_obj_callbacks_t fd_obj_cb_sigstatus;
 extern fd_topo_obj_callbacks_t fd_obj_cb_banks;
 extern fd_topo_obj_callbacks_t fd_obj_cb_funk;
 extern fd_topo_obj_callbacks_t fd_obj_cb_acc_pool;
+extern fd_topo_obj_callbacks_t fd_obj_cb_vm_prof;
 
 extern fd_topo_obj_callbacks_t fd_obj_cb_vinyl_meta;
 extern fd_topo_obj_callbacks_t fd_obj_cb_vinyl_meta_ele;
@@ -43,12 +45,14 @@ fd_topo_obj_callbacks_t * CALLBACKS[] = {
   &fd_obj_cb_store,
   &fd_obj_cb_fec_sets,
   &fd_obj_cb_txncache,
+  &fd_obj_cb_sigstatus,
   &fd_obj_cb_banks,
   &fd_obj_cb_funk,
   &fd_obj_cb_vinyl_meta,
   &fd_obj_cb_vinyl_meta_ele,
   &fd_obj_cb_vinyl_data,
   &fd_obj_cb_acc_pool,
+  &fd_obj_cb_vm_prof,
   NULL,
 };
 
@@ -192,6 +196,7 @@ extern action_t fd_action_bundle_client;
 extern action_t fd_action_dev;
 extern action_t fd_action_dump;
 extern action_t fd_action_flame;
+extern action_t fd_action_layout;
 extern action_t fd_action_help;
 extern action_t fd_action_metrics;
 extern action_t fd_action_metrics_record;
@@ -212,6 +217,7 @@ extern action_t fd_action_ipecho_server;
 extern action_t fd_action_send_test;
 extern action_t fd_action_gossip_dump;
 extern action_t fd_action_watch;
+extern action_t fd_action_vm_prof;
 
 action_t * ACTIONS[] = {
   &fd_action_run,
@@ -232,6 +238,7 @@ action_t * ACTIONS[] = {
   &fd_action_dev,
   &fd_action_dump,
   &fd_action_flame,
+  &fd_action_layout,
   &fd_action_load,
   &fd_action_pktgen,
   &fd_action_quic_trace,
@@ -249,6 +256,7 @@ action_t * ACTIONS[] = {
   &fd_action_send_test,
   &fd_action_gossip_dump,
   &fd_action_watch,
+  &fd_action_vm_prof,
   NULL,
 };
 
@@ -5,6 +5,8 @@
 #include "../../flamenco/runtime/fd_bank.h"
 #include "../../flamenco/runtime/fd_acc_pool.h"
 #include "../../flamenco/runtime/fd_txncache_shmem.h"
+#include "../../flamenco/runtime/fd_sigstatus.h"
+#include "../../flamenco/vm/fd_vm_base.h"
 #include "../../funk/fd_funk.h"
 
 #define VAL(name) (__extension__({                                                             \
@@ -178,6 +180,31 @@ fd_topo_obj_callbacks_t fd_obj_cb_txncache = {
   .new       = txncache_new,
 };
 
+static ulong
+sigstatus_footprint( fd_topo_t const *     topo,
+                     fd_topo_obj_t const * obj ) {
+  return fd_sigstatus_footprint( VAL("ele_max"), VAL("slots_per_gen") );
+}
+
+static ulong
+sigstatus_align( fd_topo_t const *     topo FD_FN_UNUSED,
+                 fd_topo_obj_t const * obj  FD_FN_UNUSED ) {
+  return fd_sigstatus_align();
+}
+
+static void
+sigstatus_new( fd_topo_t const *     topo,
+               fd_topo_obj_t const * obj ) {
+  FD_TEST( fd_sigstatus_new( fd_topo_obj_laddr( topo, obj->id ), VAL("ele_max"), VAL("slots_per_gen"), VAL("seed") ) );
+}
+
+fd_topo_obj_callbacks_t fd_obj_cb_sigstatus = {
+  .name      = "sigstatus",
+  .footprint = sigstatus_footprint,
+  .align     = sigstatus_align,
+  .new       = sigstatus_new,
+};
+
 static ulong
 acc_pool_footprint( fd_topo_t const *     topo,
                     fd_topo_obj_t const * obj ) {
@@ -203,4 +230,29 @@ fd_topo_obj_callbacks_t fd_obj_cb_acc_pool = {
   .new       = acc_pool_new,
 };
 
+static ulong
+vm_prof_footprint( fd_topo_t const *     topo,
+                   fd_topo_obj_t const * obj ) {
+  return fd_vm_prof_footprint( VAL("slot_max") );
+}
+
+static ulong
+vm_prof_align( fd_topo_t const *     topo FD_FN_UNUSED,
+               fd_topo_obj_t const * obj  FD_FN_UNUSED ) {
+  return fd_vm_prof_align();
+}
+
+static void
+vm_prof_new( fd_topo_t const *     topo,
+             fd_topo_obj_t const * obj ) {
+  FD_TEST( fd_vm_prof_new( fd_topo_obj_laddr( topo, obj->id ), VAL("slot_max"), VAL("sample_lg") ) );
+}
+
+fd_topo_obj_callbacks_t fd_obj_cb_vm_prof = {
+  .name      = "vm_prof",
+  .footprint = vm_prof_footprint,
+  .align     = vm_prof_align,
+  .new       = vm_prof_new,
+};
+
 #undef VAL
@@ -36,6 +36,11 @@
 
 extern fd_topo_obj_callbacks_t * CALLBACKS[];
 
+/* Number of (program, kind, id) slots of each exec tile's vm profile
+   (64 bytes each) when capture.vm_prof is enabled */
+
+#define VM_PROF_SLOT_MAX (16384UL)
+
 static void
 parse_ip_port( const char * name, const char * ip_port, fd_topo_ip_port_t *parsed_ip_port) {
   char buf[ sizeof( "255.255.255.255:65536" ) ];
@@ -156,6 +161,22 @@ setup_topo_txncache( fd_topo_t *  topo,
   return obj;
 }
 
+fd_topo_obj_t *
+setup_topo_sigstatus( fd_topo_t *  topo,
+                      char const * wksp_name,
+                      ulong        ele_max,
+                      ulong        slots_per_gen ) {
+  fd_topo_obj_t * obj = fd_topob_obj( topo, "sigstatus", wksp_name );
+
+  FD_TEST( fd_pod_insertf_ulong( topo->props, ele_max,       "obj.%lu.ele_max",       obj->id ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, slots_per_gen, "obj.%lu.slots_per_gen", obj->id ) );
+  ulong seed;
+  FD_TEST( fd_rng_secure( &seed, sizeof( ulong ) ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, seed, "obj.%lu.seed", obj->id ) );
+
+  return obj;
+}
+
 fd_topo_obj_t *
 setup_topo_acc_pool( fd_topo_t * topo,
                      ulong       max_account_cnt ) {
@@ -347,6 +368,7 @@ fd_topo_initialize( config_t * config ) {
   ulong exec_tile_cnt   = config->firedancer.layout.exec_tile_count;
   ulong sign_tile_cnt   = config->firedancer.layout.sign_tile_count;
   ulong lta_tile_cnt    = config->firedancer.layout.snapla_tile_count;
+  ulong rpc_tile_cnt    = config->firedancer.layout.rpc_tile_count;
 
   int snapshots_enabled = !!config->gossip.entrypoints_cnt;
   int vinyl_enabled     = !!config->firedancer.vinyl.enabled;
@@ -908,14 +930,17 @@ fd_topo_initialize( config_t * config ) {
 
   int rpc_enabled = config->tiles.rpc.enabled;
   if( FD_UNLIKELY( rpc_enabled ) ) {
+    /* Each rpc tile runs its own HTTP server on the same port (see
+       SO_REUSEPORT, only set when there is more than one), keeps its own copy of the bank state it serves
+       from, and returns bank references to replay on its own link. */
     fd_topob_wksp( topo, "rpc" );
     fd_topob_wksp( topo, "rpc_replay" );
-    fd_topob_link( topo, "rpc_replay", "rpc_replay", 4UL, 0UL, 1UL );
-    fd_topob_tile( topo, "rpc",  "rpc",  "metric_in", tile_to_cpu[ topo->tile_cnt ], 0, 1 );
-    fd_topob_tile_out( topo, "rpc", 0UL, "rpc_replay", 0UL );
-    fd_topob_tile_in( topo, "rpc",  0UL, "metric_in", "replay_out",  0UL, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
-    fd_topob_tile_in( topo, "rpc",  0UL, "metric_in", "genesi_out", 0UL, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
-    fd_topob_tile_in( topo, "replay", 0UL, "metric_in", "rpc_replay", 0UL, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
+    FOR(rpc_tile_cnt) fd_topob_link( topo, "rpc_replay", "rpc_replay", 4UL, 0UL, 1UL );
+    FOR(rpc_tile_cnt) fd_topob_tile( topo, "rpc",  "rpc",  "metric_in", tile_to_cpu[ topo->tile_cnt ], 0, 1 );
+    FOR(rpc_tile_cnt) fd_topob_tile_out( topo, "rpc", i, "rpc_replay", i );
+    FOR(rpc_tile_cnt) fd_topob_tile_in( topo, "rpc",  i, "metric_in", "replay_out",  0UL, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
+    FOR(rpc_tile_cnt) fd_topob_tile_in( topo, "rpc",  i, "metric_in", "genesi_out", 0UL, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
+    FOR(rpc_tile_cnt) fd_topob_tile_in( topo, "replay", 0UL, "metric_in", "rpc_replay", i, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
   }
 
   if( FD_UNLIKELY( solcap_enabled ) ) {
@@ -998,6 +1023,17 @@ fd_topo_initialize( config_t * config ) {
   FOR(exec_tile_cnt)   fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "exec",   i   ) ], progcache_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
   FOR(bank_tile_cnt)   fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "bank",   i   ) ], progcache_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
 
+  if( FD_UNLIKELY( config->capture.vm_prof ) ) {
+    if( FD_UNLIKELY( config->capture.vm_prof_sample_lg>63UL ) ) FD_LOG_ERR(( "capture.vm_prof_sample_lg must be in [0,63]" ));
+    for( ulong i=0UL; i<exec_tile_cnt; i++ ) {
+      fd_topo_obj_t * vm_prof_obj = fd_topob_obj( topo, "vm_prof", "exec" );
+      FD_TEST( fd_pod_insertf_ulong( topo->props, VM_PROF_SLOT_MAX,                  "obj.%lu.slot_max",  vm_prof_obj->id ) );
+      FD_TEST( fd_pod_insertf_ulong( topo->props, config->capture.vm_prof_sample_lg, "obj.%lu.sample_lg", vm_prof_obj->id ) );
+      fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "exec", i ) ], vm_prof_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+      FD_TEST( fd_pod_insertf_ulong( topo->props, vm_prof_obj->id, "vm_prof.%lu", i ) );
+    }
+  }
+
   if( FD_LIKELY( config->tiles.gui.enabled ) ) {
     fd_topob_wksp( topo, "gui" );
 
@@ -1060,17 +1096,32 @@ fd_topo_initialize( config_t * config ) {
   FOR(exec_tile_cnt) fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "exec", i ) ], txncache_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
   FD_TEST( fd_pod_insertf_ulong( topo->props, txncache_obj->id, "txncache" ) );
 
+  if( FD_UNLIKELY( rpc_enabled ) ) {
+    /* The signature status index retains the last 4*64 slots (about
+       100 seconds), sized for a sustained 8192 transactions per slot at
+       half load.  This is 128 MiB. */
+    fd_topob_wksp( topo, "sigstatus" );
+    fd_topo_obj_t * sigstatus_obj = setup_topo_sigstatus( topo, "sigstatus", 1UL<<20, 64UL );
+    fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "replay", 0UL ) ], sigstatus_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+    FOR(bank_tile_cnt) fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "bank", i ) ], sigstatus_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+    FOR(exec_tile_cnt) fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "exec", i ) ], sigstatus_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+    FOR(rpc_tile_cnt) fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "rpc", i ) ], sigstatus_obj, FD_SHMEM_JOIN_MODE_READ_ONLY );
+    FD_TEST( fd_pod_insertf_ulong( topo->props, sigstatus_obj->id, "sigstatus" ) );
+  }
+
   fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "genesi", 0UL ) ], funk_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
   if( FD_LIKELY( snapshots_enabled ) ) fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "snapin", 0UL ) ], funk_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
 
   if( FD_UNLIKELY( rpc_enabled ) ) {
-    fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "rpcsrv", 0UL ) ], funk_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
-    fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "rpcsrv", 0UL ) ], store_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+    /* Account subscriptions read the accounts database */
+    FOR(rpc_tile_cnt) fd_topob_tile_uses( topo, &topo->tiles[ fd_topo_find_tile( topo, "rpc", i ) ], funk_obj, FD_SHMEM_JOIN_MODE_READ_ONLY );
   }
 
   fd_pod_insert_int( topo->props, "sandbox", config->development.sandbox ? 1 : 0 );
 
   for( ulong i=0UL; i<topo->tile_cnt; i++ ) fd_topo_configure_tile( &topo->tiles[ i ], config );
+  for( ulong i=0UL; i<config->layout.idle_tiles_cnt; i++ ) fd_topob_tile_idle( topo, config->layout.idle_tiles[ i ], 1000UL*config->layout.idle_wake_latency_micros );
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) topo->tiles[ i ].link_latency = config->tiles.metric.link_latency_histograms;
 
   FOR(net_tile_cnt) fd_topos_net_tile_finish( topo, i );
   fd_topob_finish( topo, CALLBACKS );
@@ -1282,6 +1333,7 @@ fd_topo_configure_tile( fd_topo_tile_t * tile,
     tile->replay.txncache_obj_id  = fd_pod_query_ulong( config->topo.props, "txncache",  ULONG_MAX ); FD_TEST( tile->replay.txncache_obj_id !=ULONG_MAX );
     tile->replay.funk_obj_id      = fd_pod_query_ulong( config->topo.props, "funk",      ULONG_MAX ); FD_TEST( tile->replay.funk_obj_id     !=ULONG_MAX );
     tile->replay.progcache_obj_id = fd_pod_query_ulong( config->topo.props, "progcache", ULONG_MAX ); FD_TEST( tile->replay.progcache_obj_id!=ULONG_MAX );
+    tile->replay.sigstatus_obj_id = fd_pod_query_ulong( config->topo.props, "sigstatus", ULONG_MAX );
 
     tile->replay.max_live_slots = config->firedancer.runtime.max_live_slots;
 
@@ -1310,6 +1362,7 @@ fd_topo_configure_tile( fd_topo_tile_t * tile,
     tile->exec.txncache_obj_id  = fd_pod_query_ulong( config->topo.props, "txncache",  ULONG_MAX ); FD_TEST( tile->exec.txncache_obj_id !=ULONG_MAX );
     tile->exec.progcache_obj_id = fd_pod_query_ulong( config->topo.props, "progcache", ULONG_MAX ); FD_TEST( tile->exec.progcache_obj_id!=ULONG_MAX );
     tile->exec.acc_pool_obj_id  = fd_pod_query_ulong( config->topo.props, "acc_pool",  ULONG_MAX ); FD_TEST( tile->exec.acc_pool_obj_id !=ULONG_MAX );
+    tile->exec.sigstatus_obj_id = fd_pod_query_ulong( config->topo.props, "sigstatus", ULONG_MAX );
 
     tile->exec.max_live_slots = config->firedancer.runtime.max_live_slots;
 
@@ -1321,6 +1374,8 @@ fd_topo_configure_tile( fd_topo_tile_t * tile,
     tile->exec.dump_syscall_to_pb = config->capture.dump_syscall_to_pb;
     tile->exec.dump_elf_to_pb = config->capture.dump_elf_to_pb;
 
+    tile->exec.vm_prof_obj_id = fd_pod_queryf_ulong( config->topo.props, ULONG_MAX, "vm_prof.%lu", tile->kind_id );
+
   } else if( FD_UNLIKELY( !strcmp( tile->name, "tower" ) ) ) {
 
     tile->tower.hard_fork_fatal    = config->firedancer.development.hard_fork_fatal;
@@ -1387,6 +1442,7 @@ fd_topo_configure_tile( fd_topo_tile_t * tile,
     tile->bank.funk_obj_id      = fd_pod_query_ulong( config->topo.props, "funk",      ULONG_MAX );
     tile->bank.progcache_obj_id = fd_pod_query_ulong( config->topo.props, "progcache", ULONG_MAX );
     tile->bank.acc_pool_obj_id  = fd_pod_query_ulong( config->topo.props, "acc_pool",  ULONG_MAX );
+    tile->bank.sigstatus_obj_id = fd_pod_query_ulong( config->topo.props, "sigstatus", ULONG_MAX );
 
     tile->bank.max_live_slots = config->firedancer.runtime.max_live_slots;
 
@@ -1460,10 +1516,14 @@ fd_topo_configure_tile( fd_topo_tile_t * tile,
       FD_LOG_ERR(( "failed to parse rpc listen address `%s`", config->tiles.rpc.rpc_listen_address ));
     tile->rpc.listen_port = config->tiles.rpc.rpc_listen_port;
     tile->rpc.max_http_connections      = config->tiles.rpc.max_http_connections;
+    tile->rpc.max_websocket_connections = config->tiles.rpc.max_websocket_connections;
+    tile->rpc.max_subscriptions         = config->tiles.rpc.max_subscriptions;
     tile->rpc.max_http_request_length   = config->tiles.rpc.max_http_request_length;
     tile->rpc.send_buffer_size_mb       = config->tiles.rpc.send_buffer_size_mb;
+    tile->rpc.reuse_port                = fd_topo_tile_name_cnt( &config->topo, "rpc" )>1UL;
 
     tile->rpc.max_live_slots = config->firedancer.runtime.max_live_slots;
+    tile->rpc.sigstatus_obj_id = fd_pod_query_ulong( config->topo.props, "sigstatus", ULONG_MAX ); FD_TEST( tile->rpc.sigstatus_obj_id!=ULONG_MAX );
 
     strncpy( tile->rpc.identity_key_path, config->paths.identity_key, sizeof(tile->rpc.identity_key_path) );
 
@@ -50,6 +50,12 @@ setup_topo_txncache( fd_topo_t *  topo,
                      ulong        max_live_slots,
                      ulong        max_txn_per_slot );
 
+fd_topo_obj_t *
+setup_topo_sigstatus( fd_topo_t *  topo,
+                      char const * wksp_name,
+                      ulong        ele_max,
+                      ulong        slots_per_gen );
+
 void
 setup_topo_vinyl_meta( fd_topo_t *    topo,
                        fd_configf_t * config );
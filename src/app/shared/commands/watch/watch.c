@@ -131,7 +131,7 @@ diff_link( config_t const * config,
       if( FD_UNLIKELY( !tile->in_link_poll[ j ] ) ) continue;
 
       if( FD_LIKELY( !strcmp( link->name, link_name ) ) ) {
-        result += (long)cur_link[ overall_polled_idx*8UL+idx ]-(long)prev_link[ overall_polled_idx*8UL+idx ];
+        result += (long)cur_link[ overall_polled_idx*FD_METRICS_ALL_LINK_IN_COUNTER_CNT+idx ]-(long)prev_link[ overall_polled_idx*FD_METRICS_ALL_LINK_IN_COUNTER_CNT+idx ];
       }
 
       overall_polled_idx++;
@@ -577,7 +577,7 @@ snap_links( fd_topo_t const * topo,
 
       volatile ulong const * metrics = fd_metrics_link_in( tile->metrics, polled_in_idx );
       FD_TEST( metrics );
-      for( ulong k=0UL; k<FD_METRICS_ALL_LINK_IN_TOTAL; k++ ) links[ overall_polled_idx*8UL+k ] = metrics[ k ];
+      for( ulong k=0UL; k<FD_METRICS_ALL_LINK_IN_COUNTER_CNT; k++ ) links[ overall_polled_idx*FD_METRICS_ALL_LINK_IN_COUNTER_CNT+k ] = metrics[ k ]; /* Only the counters, which come first */
       polled_in_idx++;
       overall_polled_idx++;
     }
@@ -585,7 +585,7 @@ snap_links( fd_topo_t const * topo,
 }
 
 static ulong tiles[ 2UL*FD_TILE_MAX*FD_METRICS_TOTAL_SZ ];
-static ulong links[ 2UL*4096UL*8UL*FD_METRICS_ALL_LINK_IN_TOTAL ];
+static ulong links[ 2UL*4096UL*FD_METRICS_ALL_LINK_IN_COUNTER_CNT ];
 
 static void
 run( config_t const * config,
@@ -609,23 +609,23 @@ run( config_t const * config,
   fd_memcpy( tiles+tile_cnt*FD_METRICS_TOTAL_SZ, tiles, tile_cnt*FD_METRICS_TOTAL_SZ );
 
   snap_links( &config->topo, links );
-  fd_memcpy( links+(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL), links, cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL );
+  fd_memcpy( links+(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT), links, cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT*sizeof(ulong) );
 
   ulong last_snap = 1UL;
 
-  write_summary( config, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ, tiles+(1UL-last_snap)*tile_cnt*FD_METRICS_TOTAL_SZ, links+last_snap*(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL), links+(1UL-last_snap)*(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL) );
+  write_summary( config, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ, tiles+(1UL-last_snap)*tile_cnt*FD_METRICS_TOTAL_SZ, links+last_snap*(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT), links+(1UL-last_snap)*(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT) );
 
   long next = fd_log_wallclock()+(long)1e9;
   for(;;) {
     if( FD_UNLIKELY( drain_output_fd>=0 ) ) {
-      if( FD_UNLIKELY( drain( drain_output_fd ) ) ) write_summary( config, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ, tiles+(1UL-last_snap)*tile_cnt*FD_METRICS_TOTAL_SZ, links+last_snap*(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL), links+(1UL-last_snap)*(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL) );
+      if( FD_UNLIKELY( drain( drain_output_fd ) ) ) write_summary( config, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ, tiles+(1UL-last_snap)*tile_cnt*FD_METRICS_TOTAL_SZ, links+last_snap*(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT), links+(1UL-last_snap)*(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT) );
     }
 
     long now = fd_log_wallclock();
     if( FD_UNLIKELY( now>=next ) ) {
       last_snap = 1UL-last_snap;
       snap_tiles( &config->topo, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ );
-      snap_links( &config->topo, links+last_snap*(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL) );
+      snap_links( &config->topo, links+last_snap*(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT) );
 
       tps_sent_samples[ tps_sent_samples_idx%(sizeof(tps_sent_samples)/sizeof(tps_sent_samples[0])) ] = (ulong)diff_tile( config, "benchs", tiles+(1UL-last_snap)*tile_cnt*FD_METRICS_TOTAL_SZ, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ, MIDX( COUNTER, BENCHS, TRANSACTIONS_SENT ) );
       tps_sent_samples_idx++;
@@ -656,7 +656,7 @@ run( config_t const * config,
         erase_written += (ulong)w;
       }
 
-      write_summary( config, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ, tiles+(1UL-last_snap)*tile_cnt*FD_METRICS_TOTAL_SZ, links+last_snap*(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL), links+(1UL-last_snap)*(cons_cnt*8UL*FD_METRICS_ALL_LINK_IN_TOTAL) );
+      write_summary( config, tiles+last_snap*tile_cnt*FD_METRICS_TOTAL_SZ, tiles+(1UL-last_snap)*tile_cnt*FD_METRICS_TOTAL_SZ, links+last_snap*(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT), links+(1UL-last_snap)*(cons_cnt*FD_METRICS_ALL_LINK_IN_COUNTER_CNT) );
       next += (long)1e7;
     }
   }
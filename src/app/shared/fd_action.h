@@ -164,6 +164,10 @@ union fdctl_args {
     char const * pos_arg;
     int          help;
   } tower;
+
+  struct {
+    ulong top;
+  } vm_prof;
 };
 
 typedef union fdctl_args args_t;
@@ -119,6 +119,7 @@ struct fd_configf {
     uint sign_tile_count;
     uint gossvf_tile_count;
     uint snapla_tile_count;
+    uint rpc_tile_count;
   } layout;
 
   struct {
@@ -280,6 +281,10 @@ struct fd_config {
     uint verify_tile_count;
     uint bank_tile_count;
     uint shred_tile_count;
+
+    ulong idle_tiles_cnt;
+    char  idle_tiles[ 32 ][ 16 ];
+    uint  idle_wake_latency_micros;
   } layout;
 
   struct {
@@ -439,6 +444,7 @@ struct fd_config {
     struct {
       char   prometheus_listen_address[ 16 ];
       ushort prometheus_listen_port;
+      int    link_latency_histograms;
     } metric;
 
     struct {
@@ -456,6 +462,8 @@ struct fd_config {
       char   rpc_listen_address[ 16 ];
       ushort rpc_listen_port;
       ulong  max_http_connections;
+      ulong  max_websocket_connections;
+      ulong  max_subscriptions;
       ulong  max_http_request_length;
       ulong  send_buffer_size_mb;
     } rpc;
@@ -508,6 +516,8 @@ struct fd_config {
     int   dump_instr_to_pb;
     int   dump_txn_to_pb;
     int   dump_block_to_pb;
+    int   vm_prof;
+    ulong vm_prof_sample_lg;
   } capture;
 };
 
@@ -83,6 +83,7 @@ fd_config_extract_podf( uchar *        pod,
   CFG_POP      ( uint,   layout.sign_tile_count                              );
   CFG_POP      ( uint,   layout.gossvf_tile_count                            );
   CFG_POP      ( uint,   layout.snapla_tile_count                            );
+  CFG_POP      ( uint,   layout.rpc_tile_count                               );
 
   CFG_POP      ( ulong,  funk.max_account_records                            );
   CFG_POP      ( ulong,  funk.heap_size_gib                                  );
@@ -162,6 +163,8 @@ fd_config_extract_pod( uchar *       pod,
   CFG_POP      ( uint,   layout.verify_tile_count                         );
   CFG_POP      ( uint,   layout.bank_tile_count                           );
   CFG_POP      ( uint,   layout.shred_tile_count                          );
+  CFG_POP_ARRAY( cstr,   layout.idle_tiles                                );
+  CFG_POP      ( uint,   layout.idle_wake_latency_micros                  );
 
   CFG_POP      ( cstr,   hugetlbfs.mount_path                             );
   CFG_POP      ( cstr,   hugetlbfs.max_page_size                          );
@@ -226,6 +229,7 @@ fd_config_extract_pod( uchar *       pod,
 
   CFG_POP      ( cstr,   tiles.metric.prometheus_listen_address           );
   CFG_POP      ( ushort, tiles.metric.prometheus_listen_port              );
+  CFG_POP      ( bool,   tiles.metric.link_latency_histograms             );
 
   CFG_POP      ( bool,   tiles.gui.enabled                                );
   CFG_POP      ( cstr,   tiles.gui.gui_listen_address                     );
@@ -239,6 +243,8 @@ fd_config_extract_pod( uchar *       pod,
   CFG_POP      ( cstr,   tiles.rpc.rpc_listen_address                     );
   CFG_POP      ( ushort, tiles.rpc.rpc_listen_port                        );
   CFG_POP      ( ulong,  tiles.rpc.max_http_connections                   );
+  CFG_POP      ( ulong,  tiles.rpc.max_websocket_connections              );
+  CFG_POP      ( ulong,  tiles.rpc.max_subscriptions                      );
   CFG_POP      ( ulong,  tiles.rpc.max_http_request_length                );
   CFG_POP      ( ulong,  tiles.rpc.send_buffer_size_mb                    );
 
@@ -256,6 +262,8 @@ fd_config_extract_pod( uchar *       pod,
   CFG_POP      ( bool,   capture.dump_instr_to_pb                         );
   CFG_POP      ( bool,   capture.dump_txn_to_pb                           );
   CFG_POP      ( bool,   capture.dump_block_to_pb                         );
+  CFG_POP      ( bool,   capture.vm_prof                                  );
+  CFG_POP      ( ulong,  capture.vm_prof_sample_lg                        );
 
   CFG_POP_ARRAY( cstr,   tiles.replay.enable_features                     );
 
@@ -335,11 +335,14 @@ dump_cmd_fn( args_t      * args,
                fseqs,        /* in_fseq */
                0UL,          /* out_cnt */
                NULL,         /* out_mcache */
+               NULL,         /* out_mp */
                0UL,          /* cons_cnt */
                NULL,         /* _cons_out */
                NULL,         /* _cons_fseq */
                0UL,          /* burst */
                0UL,          /* lazy */
+               0UL,          /* idle_wake_ns */
+               NULL,         /* in_lat */
                rng,          /* rng */
                scratch,      /* scratch */
                &ctx );       /* ctx */
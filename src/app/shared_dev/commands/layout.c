@@ -0,0 +1,73 @@
+#include "../../shared/fd_config.h"
+#include "../../shared/fd_action.h"
+#include "../../../disco/topo/fd_topob.h"
+
+#include <stdio.h>
+
+/* layout prints where the tiles of the configured topology are placed
+   relative to the NUMA nodes and L3 cache domains of this host and the
+   links whose producer and consumer end up in different L3 domains.
+   Link traffic is estimated per frag with fd_topob_link_weight, as the
+   actual rates depend on the load. */
+
+static void
+layout_cmd_fn( args_t *   args FD_PARAM_UNUSED,
+               config_t * config ) {
+  fd_topo_t const * topo = &config->topo;
+
+  fd_topo_cpus_t cpus[1];
+  fd_topo_cpus_init( cpus );
+
+  printf( "layout.affinity %s, cpus %lu, numa nodes %lu, l3 domains %lu\n\n",
+          config->layout.affinity, cpus->cpu_cnt, cpus->numa_node_cnt, cpus->l3_cnt );
+
+  printf( "%-12s %6s %6s %6s %8s\n", "tile", "cpu", "numa", "l3", "sibling" );
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ i ];
+    char name[ 32 ];
+    FD_TEST( fd_cstr_printf_check( name, sizeof(name), NULL, "%s:%lu", tile->name, tile->kind_id ) );
+    if( tile->cpu_idx>=cpus->cpu_cnt ) {
+      printf( "%-12s %6s\n", name, "float" );
+      continue;
+    }
+    fd_topo_cpu_t const * cpu = &cpus->cpu[ tile->cpu_idx ];
+    if( cpu->sibling==ULONG_MAX ) printf( "%-12s %6lu %6lu %6lu %8s\n",  name, tile->cpu_idx, cpu->numa_node, cpu->l3, "-" );
+    else                          printf( "%-12s %6lu %6lu %6lu %8lu\n", name, tile->cpu_idx, cpu->numa_node, cpu->l3, cpu->sibling );
+  }
+
+  printf( "\n%-16s %-12s %-12s %8s\n", "cross l3 link", "producer", "consumer", "bytes" );
+  for( ulong i=0UL; i<topo->link_cnt; i++ ) {
+    fd_topo_link_t const * link = &topo->links[ i ];
+    ulong producer_idx = fd_topo_find_link_producer( topo, link );
+    if( FD_UNLIKELY( producer_idx==ULONG_MAX ) ) continue;
+    fd_topo_tile_t const * producer = &topo->tiles[ producer_idx ];
+    if( producer->cpu_idx>=cpus->cpu_cnt ) continue;
+
+    for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
+      fd_topo_tile_t const * consumer = &topo->tiles[ j ];
+      if( consumer->cpu_idx>=cpus->cpu_cnt ) continue;
+      if( cpus->cpu[ producer->cpu_idx ].l3==cpus->cpu[ consumer->cpu_idx ].l3 ) continue;
+      if( fd_topo_find_tile_in_link( topo, consumer, link->name, link->kind_id )==ULONG_MAX ) continue;
+
+      char link_name[ 32 ]; char producer_name[ 32 ]; char consumer_name[ 32 ];
+      FD_TEST( fd_cstr_printf_check( link_name,     sizeof(link_name),     NULL, "%s:%lu", link->name,     link->kind_id     ) );
+      FD_TEST( fd_cstr_printf_check( producer_name, sizeof(producer_name), NULL, "%s:%lu", producer->name, producer->kind_id ) );
+      FD_TEST( fd_cstr_printf_check( consumer_name, sizeof(consumer_name), NULL, "%s:%lu", consumer->name, consumer->kind_id ) );
+      printf( "%-16s %-12s %-12s %8lu\n", link_name, producer_name, consumer_name, fd_topob_link_weight( link ) );
+    }
+  }
+
+  ulong total;
+  ulong cross = fd_topob_cross_l3_weight( topo, cpus, &total );
+  printf( "\nestimated cross l3 link traffic: %lu of %lu bytes per frag published on every link (%.1f%%)\n",
+          cross, total, total ? 100.*(double)cross/(double)total : 0. );
+}
+
+action_t fd_action_layout = {
+  .name           = "layout",
+  .args           = NULL,
+  .fn             = layout_cmd_fn,
+  .require_config = 1,
+  .perm           = NULL,
+  .description    = "Print the tile placement on NUMA nodes and L3 cache domains and the link traffic crossing them",
+};
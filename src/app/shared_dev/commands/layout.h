@@ -0,0 +1,8 @@
+#ifndef HEADER_fd_src_app_shared_dev_commands_layout_h
+#define HEADER_fd_src_app_shared_dev_commands_layout_h
+
+#include "../../shared/fd_config.h"
+
+extern action_t fd_action_layout;
+
+#endif /* HEADER_fd_src_app_shared_dev_commands_layout_h */
@@ -550,11 +550,14 @@ fd_quic_trace_rx_tile( fd_quic_trace_ctx_t  * trace_ctx,
              /* in_fseq    */ fseq_tbl,
              /* out_cnt    */ 0UL,
              /* out_mcache */ NULL,
+             /* out_mp     */ NULL,
              /* cons_cnt   */ 0UL,
              /* cons_out   */ NULL,
              /* cons_fseq  */ NULL,
              /* stem_burst */ 1UL,
              /* stem_lazy  */ 0L,
+             /* idle_wake  */ 0UL,
+             /* in_lat     */ NULL,
              /* rng        */ rng,
              /* scratch    */ scratch,
              /* ctx        */ trace_ctx );
@@ -67,6 +67,23 @@ FD_PROTOTYPES_BEGIN
 char * fd_base58_encode_32( uchar const * bytes, ulong * opt_len, char * out );
 char * fd_base58_encode_64( uchar const * bytes, ulong * opt_len, char * out );
 
+/* fd_base58_encode_32_batch encodes cnt 32 byte values stored back to
+   back at bytes.  The result for value i is written as a nul-terminated
+   cstr to out+i*FD_BASE58_ENCODED_32_SZ, so out must have room for
+   cnt*FD_BASE58_ENCODED_32_SZ characters.  If opt_len is non-NULL,
+   opt_len[i] is set to the length of string i.  The output is identical
+   to cnt calls to fd_base58_encode_32, but with AVX the conversion to
+   the intermediate form is done for 4 values at a time, which saves
+   ~10-15% per value (the carry propagation and digit extraction are
+   still done per value).  Useful for responses that list many account
+   addresses (e.g. the account keys of a transaction). */
+
+void
+fd_base58_encode_32_batch( uchar const * bytes,
+                           ulong         cnt,
+                           char        * out,
+                           ulong       * opt_len );
+
 /* fd_base58_decode_{32, 64}: Converts the base58 encoded number stored
    in the cstr `encoded` to a 32 or 64 byte number, which is written to
    out in big endian.  out must have room for 32 and 64 bytes respective
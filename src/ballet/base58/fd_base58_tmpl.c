@@ -30,87 +30,20 @@
 #define INTERMEDIATE_SZ_W_PADDING INTERMEDIATE_SZ
 #endif
 
-char *
-SUFFIX(fd_base58_encode)( uchar const * bytes,
-                          ulong       * opt_len,
-                          char        * out    ){
-
-  /* Count leading zeros (needed for final output) */
-#if FD_HAS_AVX
-# if N==32
-  wuc_t _bytes = wuc_ldu( bytes );
-  ulong in_leading_0s = count_leading_zeros_32( _bytes );
-# elif N==64
-  wuc_t bytes_0 = wuc_ldu( bytes      );
-  wuc_t bytes_1 = wuc_ldu( bytes+32UL );
-  ulong in_leading_0s = count_leading_zeros_64( bytes_0, bytes_1 );
-# endif
-#else
-
-  ulong in_leading_0s = 0UL;
-  for( ; in_leading_0s<BYTE_CNT; in_leading_0s++ ) if( bytes[ in_leading_0s ] ) break;
-#endif
-
-  /* X = sum_i bytes[i] * 2^(8*(BYTE_CNT-1-i)) */
-
-  /* Convert N to 32-bit limbs:
-     X = sum_i binary[i] * 2^(32*(BINARY_SZ-1-i)) */
-  uint binary[ BINARY_SZ ];
-  for( ulong i=0UL; i<BINARY_SZ; i++ ) binary[ i ] = fd_uint_bswap( fd_uint_load_4( &bytes[ i*sizeof(uint) ] ) );
+/* SUFFIX(fd_base58_private_encode_tail) finishes an encode given the
+   intermediate form of the input (see below, not yet reduced, with
+   INTERMEDIATE_SZ_W_PADDING entries and the padding zeroed) and the
+   number of leading zero bytes of the input.  Shared by the single and
+   batched encoders.  intermediate is clobbered. */
+
+static inline char *
+SUFFIX(fd_base58_private_encode_tail)( ulong * intermediate,
+                                       ulong   in_leading_0s,
+                                       ulong * opt_len,
+                                       char  * out ) {
 
   ulong R1div = 656356768UL; /* = 58^5 */
 
-  /* Convert to the intermediate format:
-       X = sum_i intermediate[i] * 58^(5*(INTERMEDIATE_SZ-1-i))
-     Initially, we don't require intermediate[i] < 58^5, but we do want
-     to make sure the sums don't overflow. */
-
-#if FD_HAS_AVX
-  ulong W_ATTR intermediate[ INTERMEDIATE_SZ_W_PADDING ];
-#else
-  ulong intermediate[ INTERMEDIATE_SZ_W_PADDING ];
-#endif
-
-  fd_memset( intermediate, 0, INTERMEDIATE_SZ_W_PADDING * sizeof(ulong) );
-
-# if N==32
-
-  /* The worst case is if binary[7] is (2^32)-1. In that case
-     intermediate[8] will be just over 2^63, which is fine. */
-
-  for( ulong i=0UL; i < BINARY_SZ; i++ )
-    for( ulong j=0UL; j < INTERMEDIATE_SZ-1UL; j++ )
-      intermediate[ j+1UL ] += (ulong)binary[ i ] * (ulong)SUFFIX(enc_table)[ i ][ j ];
-
-# elif N==64
-
-  /* If we do it the same way as the 32B conversion, intermediate[16]
-     can overflow when the input is sufficiently large.  We'll do a
-     mini-reduction after the first 8 steps.  After the first 8 terms,
-     the largest intermediate[16] can be is 2^63.87.  Then, after
-     reduction it'll be at most 58^5, and after adding the last terms,
-     it won't exceed 2^63.1.  We do need to be cautious that the
-     mini-reduction doesn't cause overflow in intermediate[15] though.
-     Pre-mini-reduction, it's at most 2^63.05.  The mini-reduction adds
-     at most 2^64/58^5, which is negligible.  With the final terms, it
-     won't exceed 2^63.69, which is fine. Other terms are less than
-     2^63.76, so no problems there. */
-
-  for( ulong i=0UL; i < 8UL; i++ )
-    for( ulong j=0UL; j < INTERMEDIATE_SZ-1UL; j++ )
-      intermediate[ j+1UL ] += (ulong)binary[ i ] * (ulong)SUFFIX(enc_table)[ i ][ j ];
-  /* Mini-reduction */
-  intermediate[ 15 ] += intermediate[ 16 ]/R1div;
-  intermediate[ 16 ] %= R1div;
-  /* Finish iterations */
-  for( ulong i=8UL; i < BINARY_SZ; i++ )
-    for( ulong j=0UL; j < INTERMEDIATE_SZ-1UL; j++ )
-      intermediate[ j+1UL ] += (ulong)binary[ i ] * (ulong)SUFFIX(enc_table)[ i ][ j ];
-
-# else
-# error "Add support for this N"
-# endif
-
   /* Now we make sure each term is less than 58^5. Again, we have to be
      a bit careful of overflow.
 
@@ -296,6 +229,146 @@ SUFFIX(fd_base58_encode)( uchar const * bytes,
   return out;
 }
 
+char *
+SUFFIX(fd_base58_encode)( uchar const * bytes,
+                          ulong       * opt_len,
+                          char        * out    ){
+
+  /* Count leading zeros (needed for final output) */
+#if FD_HAS_AVX
+# if N==32
+  wuc_t _bytes = wuc_ldu( bytes );
+  ulong in_leading_0s = count_leading_zeros_32( _bytes );
+# elif N==64
+  wuc_t bytes_0 = wuc_ldu( bytes      );
+  wuc_t bytes_1 = wuc_ldu( bytes+32UL );
+  ulong in_leading_0s = count_leading_zeros_64( bytes_0, bytes_1 );
+# endif
+#else
+
+  ulong in_leading_0s = 0UL;
+  for( ; in_leading_0s<BYTE_CNT; in_leading_0s++ ) if( bytes[ in_leading_0s ] ) break;
+#endif
+
+  /* X = sum_i bytes[i] * 2^(8*(BYTE_CNT-1-i)) */
+
+  /* Convert N to 32-bit limbs:
+     X = sum_i binary[i] * 2^(32*(BINARY_SZ-1-i)) */
+  uint binary[ BINARY_SZ ];
+  for( ulong i=0UL; i<BINARY_SZ; i++ ) binary[ i ] = fd_uint_bswap( fd_uint_load_4( &bytes[ i*sizeof(uint) ] ) );
+
+  /* Convert to the intermediate format:
+       X = sum_i intermediate[i] * 58^(5*(INTERMEDIATE_SZ-1-i))
+     Initially, we don't require intermediate[i] < 58^5, but we do want
+     to make sure the sums don't overflow. */
+
+#if FD_HAS_AVX
+  ulong W_ATTR intermediate[ INTERMEDIATE_SZ_W_PADDING ];
+#else
+  ulong intermediate[ INTERMEDIATE_SZ_W_PADDING ];
+#endif
+
+  fd_memset( intermediate, 0, INTERMEDIATE_SZ_W_PADDING * sizeof(ulong) );
+
+# if N==32
+
+  /* The worst case is if binary[7] is (2^32)-1. In that case
+     intermediate[8] will be just over 2^63, which is fine. */
+
+  for( ulong i=0UL; i < BINARY_SZ; i++ )
+    for( ulong j=0UL; j < INTERMEDIATE_SZ-1UL; j++ )
+      intermediate[ j+1UL ] += (ulong)binary[ i ] * (ulong)SUFFIX(enc_table)[ i ][ j ];
+
+# elif N==64
+
+  /* If we do it the same way as the 32B conversion, intermediate[16]
+     can overflow when the input is sufficiently large.  We'll do a
+     mini-reduction after the first 8 steps.  After the first 8 terms,
+     the largest intermediate[16] can be is 2^63.87.  Then, after
+     reduction it'll be at most 58^5, and after adding the last terms,
+     it won't exceed 2^63.1.  We do need to be cautious that the
+     mini-reduction doesn't cause overflow in intermediate[15] though.
+     Pre-mini-reduction, it's at most 2^63.05.  The mini-reduction adds
+     at most 2^64/58^5, which is negligible.  With the final terms, it
+     won't exceed 2^63.69, which is fine. Other terms are less than
+     2^63.76, so no problems there. */
+
+  for( ulong i=0UL; i < 8UL; i++ )
+    for( ulong j=0UL; j < INTERMEDIATE_SZ-1UL; j++ )
+      intermediate[ j+1UL ] += (ulong)binary[ i ] * (ulong)SUFFIX(enc_table)[ i ][ j ];
+  /* Mini-reduction */
+  ulong R1div = 656356768UL; /* = 58^5 */
+  intermediate[ 15 ] += intermediate[ 16 ]/R1div;
+  intermediate[ 16 ] %= R1div;
+  /* Finish iterations */
+  for( ulong i=8UL; i < BINARY_SZ; i++ )
+    for( ulong j=0UL; j < INTERMEDIATE_SZ-1UL; j++ )
+      intermediate[ j+1UL ] += (ulong)binary[ i ] * (ulong)SUFFIX(enc_table)[ i ][ j ];
+
+# else
+# error "Add support for this N"
+# endif
+
+  return SUFFIX(fd_base58_private_encode_tail)( intermediate, in_leading_0s, opt_len, out );
+}
+
+#if N==32
+
+void
+fd_base58_encode_32_batch( uchar const * bytes,
+                           ulong         cnt,
+                           char        * out,
+                           ulong       * opt_len ) {
+  ulong i = 0UL;
+
+#if FD_HAS_AVX
+  /* Four inputs at a time, one per 64-bit lane.  binary[ k ] holds limb
+     k of each input in the low 32 bits of its lane, which is exactly
+     the operand layout of wv_mul_ll.  The sums are the same as in the
+     single encode, so the same overflow analysis applies. */
+
+  for( ; i+4UL<=cnt; i+=4UL ) {
+    uchar const * b = bytes + i*BYTE_CNT;
+
+    wv_t binary[ BINARY_SZ ];
+    for( ulong k=0UL; k<BINARY_SZ; k++ ) {
+      binary[ k ] = wv( (ulong)fd_uint_bswap( fd_uint_load_4( b+           k*sizeof(uint) ) ),
+                        (ulong)fd_uint_bswap( fd_uint_load_4( b+  BYTE_CNT+k*sizeof(uint) ) ),
+                        (ulong)fd_uint_bswap( fd_uint_load_4( b+2*BYTE_CNT+k*sizeof(uint) ) ),
+                        (ulong)fd_uint_bswap( fd_uint_load_4( b+3*BYTE_CNT+k*sizeof(uint) ) ) );
+    }
+
+    wv_t acc[ INTERMEDIATE_SZ ];
+    for( ulong j=0UL; j<INTERMEDIATE_SZ; j++ ) acc[ j ] = wv_zero();
+
+    /* enc_table_32[ k ][ j ] is zero for j<k */
+    for( ulong k=0UL; k<BINARY_SZ; k++ )
+      for( ulong j=k; j<INTERMEDIATE_SZ-1UL; j++ )
+        acc[ j+1UL ] = wv_add( acc[ j+1UL ], wv_mul_ll( binary[ k ], wv_bcast( (ulong)enc_table_32[ k ][ j ] ) ) );
+
+    /* Transpose to one intermediate array per input */
+
+    ulong W_ATTR lanes[ INTERMEDIATE_SZ ][ 4 ];
+    for( ulong j=0UL; j<INTERMEDIATE_SZ; j++ ) wv_st( lanes[ j ], acc[ j ] );
+
+    for( ulong l=0UL; l<4UL; l++ ) {
+      ulong W_ATTR intermediate[ INTERMEDIATE_SZ_W_PADDING ];
+      for( ulong j=0UL; j<INTERMEDIATE_SZ;           j++ ) intermediate[ j ] = lanes[ j ][ l ];
+      for( ulong j=INTERMEDIATE_SZ; j<INTERMEDIATE_SZ_W_PADDING; j++ ) intermediate[ j ] = 0UL;
+
+      ulong in_leading_0s = count_leading_zeros_32( wuc_ldu( b+l*BYTE_CNT ) );
+      SUFFIX(fd_base58_private_encode_tail)( intermediate, in_leading_0s,
+                                             opt_len ? opt_len+i+l : NULL,
+                                             out+(i+l)*ENCODED_SZ() );
+    }
+  }
+#endif
+
+  for( ; i<cnt; i++ ) fd_base58_encode_32( bytes+i*BYTE_CNT, opt_len ? opt_len+i : NULL, out+i*ENCODED_SZ() );
+}
+
+#endif /* N==32 */
+
 uchar *
 SUFFIX(fd_base58_decode)( char const * encoded,
                           uchar      * out      ) {
@@ -535,6 +535,71 @@ MAKE_TESTS(64,64    )
 
 #undef MAKE_TESTS
 
+#define BATCH_MAX (67UL)
+
+static void
+test_batch32( fd_rng_t * rng,
+              ulong      cnt ) {
+  static uchar bytes[ BATCH_MAX*32UL ];
+  static char  out  [ BATCH_MAX*FD_BASE58_ENCODED_32_SZ+1UL ];
+  ulong        len  [ BATCH_MAX ];
+  char         exp  [ FD_BASE58_ENCODED_32_SZ ];
+
+  for( ulong iter=0UL; iter<cnt/BATCH_MAX; iter++ ) {
+    ulong batch_cnt = fd_rng_ulong_roll( rng, BATCH_MAX+1UL );
+
+    /* Mix in values with leading zeros and runs of 0xff */
+    for( ulong i=0UL; i<batch_cnt*32UL; i++ ) bytes[ i ] = fd_rng_uchar( rng );
+    for( ulong i=0UL; i<batch_cnt; i++ ) {
+      switch( fd_rng_uint_roll( rng, 4U ) ) {
+      case 0U: fd_memset( bytes+i*32UL, 0,    fd_rng_ulong_roll( rng, 33UL ) ); break;
+      case 1U: fd_memset( bytes+i*32UL, 0xff, fd_rng_ulong_roll( rng, 33UL ) ); break;
+      default: break;
+      }
+    }
+
+    out[ batch_cnt*FD_BASE58_ENCODED_32_SZ ] = 'X';
+    fd_base58_encode_32_batch( bytes, batch_cnt, out, len );
+    FD_TEST( out[ batch_cnt*FD_BASE58_ENCODED_32_SZ ]=='X' );
+
+    for( ulong i=0UL; i<batch_cnt; i++ ) {
+      ulong exp_len;
+      fd_base58_encode_32( bytes+i*32UL, &exp_len, exp );
+      FD_TEST( len[ i ]==exp_len );
+      FD_TEST( !strcmp( out+i*FD_BASE58_ENCODED_32_SZ, exp ) );
+    }
+
+    /* opt_len==NULL */
+    fd_base58_encode_32_batch( bytes, batch_cnt, out, NULL );
+    for( ulong i=0UL; i<batch_cnt; i++ ) FD_TEST( strlen( out+i*FD_BASE58_ENCODED_32_SZ )==len[ i ] );
+  }
+
+  /* Performance against single encodes */
+
+  for( ulong i=0UL; i<BATCH_MAX*32UL; i++ ) bytes[ i ] = fd_rng_uchar( rng );
+  ulong const iter_cnt = 3000UL;
+
+  long single = -fd_log_wallclock();
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    for( ulong i=0UL; i<64UL; i++ ) fd_base58_encode_32( bytes+i*32UL, NULL, out+i*FD_BASE58_ENCODED_32_SZ );
+    FD_COMPILER_MFENCE();
+  }
+  single += fd_log_wallclock();
+
+  long batch = -fd_log_wallclock();
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    fd_base58_encode_32_batch( bytes, 64UL, out, NULL );
+    FD_COMPILER_MFENCE();
+  }
+  batch += fd_log_wallclock();
+
+  FD_LOG_NOTICE(( "average time per 32 byte encode: single %f ns, batch %f ns",
+                  (double)single/(double)(iter_cnt*64UL),
+                  (double)batch /(double)(iter_cnt*64UL) ));
+}
+
+#undef BATCH_MAX
+
 #if FD_HAS_AVX
 
 #include "fd_base58_avx.h"
@@ -735,6 +800,9 @@ main( int     argc,
   test_match32( rng, cnt );
   test_performance32( rng );
 
+  FD_LOG_NOTICE(( "Testing batched 256-bit conversion" ));
+  test_batch32( rng, cnt );
+
   FD_LOG_NOTICE(( "Testing 512-bit conversion" ));
   test_encode_basic64();
   test_encode_bounds64();
@@ -68,12 +68,76 @@ static char const * const test_corrupt[] = {
   NULL
 };
 
+/* Straightforward scalar reference implementations, used to check the
+   vectorized paths on inputs of all sizes and as a performance
+   baseline. */
+
+static char const ref_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static ulong
+encode_ref( char *        out,
+            uchar const * in,
+            ulong         in_sz ) {
+  char * p = out;
+  for( ulong i=0UL; i<in_sz; i+=3UL ) {
+    ulong rem = fd_ulong_min( in_sz-i, 3UL );
+    uint  x   = (uint)in[ i ]<<16;
+    if( rem>1UL ) x |= (uint)in[ i+1UL ]<<8;
+    if( rem>2UL ) x |= (uint)in[ i+2UL ];
+    *p++ =                  ref_alphabet[ (x>>18)&0x3fU ];
+    *p++ =                  ref_alphabet[ (x>>12)&0x3fU ];
+    *p++ = rem>1UL ? ref_alphabet[ (x>> 6)&0x3fU ] : '=';
+    *p++ = rem>2UL ? ref_alphabet[ (x    )&0x3fU ] : '=';
+  }
+  return (ulong)(p-out);
+}
+
+static schar ref_inv[ 256 ];
+
+static void
+ref_init( void ) {
+  memset( ref_inv, -1, sizeof(ref_inv) );
+  for( int i=0; i<64; i++ ) ref_inv[ (uchar)ref_alphabet[ i ] ] = (schar)i;
+}
+
+static inline int
+decode_char_ref( char c ) {
+  return ref_inv[ (uchar)c ];
+}
+
+static long
+decode_ref( uchar *      out,
+            char const * in,
+            ulong        in_sz ) {
+  if( in_sz%4UL ) return -1L;
+  ulong pad = 0UL;
+  if( in_sz && in[ in_sz-1UL ]=='=' ) pad++;
+  if( in_sz && in[ in_sz-2UL ]=='=' ) pad++;
+  if( pad==1UL && in[ in_sz-1UL ]!='=' ) return -1L;
+  ulong n = 0UL;
+  for( ulong i=0UL; i<in_sz; i+=4UL ) {
+    ulong last = i+4UL==in_sz;
+    ulong cc   = last ? 4UL-pad : 4UL;
+    uint  x    = 0U;
+    for( ulong j=0UL; j<4UL; j++ ) {
+      int v = j<cc ? decode_char_ref( in[ i+j ] ) : 0;
+      if( v<0 ) return -1L;
+      x = (x<<6) | (uint)v;
+    }
+    out[ n++ ] = (uchar)(x>>16);
+    if( cc>2UL ) out[ n++ ] = (uchar)(x>>8);
+    if( cc>3UL ) out[ n++ ] = (uchar)x;
+  }
+  return (long)n;
+}
+
 int
 main( int     argc,
       char ** argv ) {
   fd_boot( &argc, &argv );
 
   fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  ref_init();
 
   /* Unit tests */
 
@@ -119,8 +183,63 @@ main( int     argc,
     FD_TEST( fd_memeq( raw, dec, raw_sz ) );
   }
 
+  /* Differential test against the reference.  Sizes cover several
+     vector blocks plus every tail length, and corrupted inputs put a
+     random byte at a random position (in a vector block or the scalar
+     tail). */
+
+  for( ulong iter=0UL; iter<100000UL; iter++ ) {
+    uchar raw    [ 400 ];
+    char  enc    [ FD_BASE64_ENC_SZ( sizeof(raw) ) ];
+    char  enc_ref[ FD_BASE64_ENC_SZ( sizeof(raw) ) ];
+    uchar dec    [ FD_BASE64_DEC_SZ( sizeof(enc) ) ]; /* corrupt padding can decode to more than raw_sz */
+    uchar dec_ref[ FD_BASE64_DEC_SZ( sizeof(enc) ) ];
+    ulong const raw_sz = fd_rng_uint_roll( rng, sizeof(raw)+1UL );
+    for( ulong i=0UL; i<raw_sz; i++ ) raw[ i ] = fd_rng_uchar( rng );
+
+    ulong const enc_sz = fd_base64_encode( enc, raw, raw_sz );
+    FD_TEST( enc_sz==encode_ref( enc_ref, raw, raw_sz ) );
+    FD_TEST( fd_memeq( enc, enc_ref, enc_sz ) );
+
+    if( enc_sz && (iter&1UL) ) enc[ fd_rng_ulong_roll( rng, enc_sz ) ] = (char)fd_rng_uchar( rng );
+    long const dec_sz = fd_base64_decode( dec, enc, enc_sz );
+    FD_TEST( dec_sz==decode_ref( dec_ref, enc, enc_sz ) );
+    if( dec_sz>0L ) FD_TEST( fd_memeq( dec, dec_ref, (ulong)dec_sz ) );
+  }
+
   /* Throughput test */
 
+  do {
+    static uchar raw[ 24576UL ];
+    static char  enc[ 32768UL ];
+    for( ulong i=0UL; i<sizeof(raw); i++ ) raw[ i ] = fd_rng_uchar( rng );
+
+    ulong iter = 10000UL;
+
+    long dt = -fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) { fd_base64_encode( enc, raw, sizeof(raw) ); FD_COMPILER_MFENCE(); }
+    dt += fd_log_wallclock();
+
+    long dt_ref = -fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) { encode_ref( enc, raw, sizeof(raw) ); FD_COMPILER_MFENCE(); }
+    dt_ref += fd_log_wallclock();
+
+    FD_LOG_NOTICE(( "encode: ~%6.3f Gbps / core (reference ~%6.3f Gbps / core)",
+                    (double)(8UL*sizeof(raw)*iter)/(double)dt, (double)(8UL*sizeof(raw)*iter)/(double)dt_ref ));
+
+    uchar dec[ 24576UL ];
+    dt = -fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) { fd_base64_decode( dec, enc, sizeof(enc) ); FD_COMPILER_MFENCE(); }
+    dt += fd_log_wallclock();
+
+    dt_ref = -fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) { decode_ref( dec, enc, sizeof(enc) ); FD_COMPILER_MFENCE(); }
+    dt_ref += fd_log_wallclock();
+
+    FD_LOG_NOTICE(( "decode: ~%6.3f Gbps / core (reference ~%6.3f Gbps / core)",
+                    (double)(8UL*sizeof(raw)*iter)/(double)dt, (double)(8UL*sizeof(raw)*iter)/(double)dt_ref ));
+  } while(0);
+
   static uchar raw[ 32768UL ];
   static ulong enc_sz = 32768UL;
   char         enc[ enc_sz ];
@@ -219,6 +219,43 @@ fd_bn254_g1_scalar_mul_syscall( uchar       out[64],
   return 0;
 }
 
+int
+fd_bn254_g1_multi_scalar_mul( uchar       out[64],
+                              uchar const in[],
+                              ulong       in_sz ) {
+  /* Input is a sequence of 96-byte (point, scalar) pairs, serialized
+     as in fd_bn254_g1_scalar_mul_syscall. */
+  if( FD_UNLIKELY( (in_sz % 96UL)!=0UL ) ) {
+    return -1;
+  }
+  ulong cnt = in_sz / 96UL;
+
+  fd_bn254_g1_t     p[FD_BN254_MSM_BATCH_MAX];
+  fd_bn254_scalar_t s[FD_BN254_MSM_BATCH_MAX];
+
+  fd_bn254_g1_t r[1], t[1];
+  fd_bn254_g1_set_zero( r );
+  for( ulong i=0UL; i<cnt; i+=FD_BN254_MSM_BATCH_MAX ) {
+    ulong sz = fd_ulong_min( cnt-i, FD_BN254_MSM_BATCH_MAX );
+    for( ulong j=0UL; j<sz; j++ ) {
+      uchar const * pair = &in[ (i+j)*96UL ];
+      /* Validate point */
+      if( FD_UNLIKELY( !fd_bn254_g1_frombytes_check_subgroup( &p[j], &pair[0] ) ) ) {
+        return -1;
+      }
+      /* Scalar is big endian and NOT validated, as in scalar_mul */
+      uchar FD_ALIGNED buf[32];
+      fd_memcpy( buf, &pair[64], 32UL );
+      fd_uint256_bswap( &s[j], fd_type_pun_const( buf ) );
+    }
+    fd_bn254_g1_msm( t, p, s, sz );
+    fd_bn254_g1_add( r, r, t );
+  }
+
+  fd_bn254_g1_tobytes( out, r );
+  return 0;
+}
+
 int
 fd_bn254_pairing_is_one_syscall( uchar       out[32],
                                  uchar const in[],
@@ -8,6 +8,7 @@
 #include "./fd_bn254_scalar.h"
 
 #define FD_BN254_PAIRING_BATCH_MAX 16UL
+#define FD_BN254_MSM_BATCH_MAX     128UL
 
 FD_PROTOTYPES_BEGIN
 
@@ -22,6 +23,28 @@ fd_bn254_g1_scalar_mul_syscall( uchar       out[64],
                                 ulong       in_sz,
                                 int         check_correct_sz );
 
+/* fd_bn254_g1_multi_scalar_mul computes the multi-scalar multiplication
+   sum_i s_i * P_i in G1.
+   Input in is a sequence of in_sz/96 (point, scalar) pairs, each
+   serialized as the input of fd_bn254_g1_scalar_mul_syscall, i.e. a
+   64-byte big endian point followed by a 32-byte big endian scalar
+   (scalars are not validated).
+   Output out will contain the result, serialized as a 64-byte big
+   endian point.
+   Returns 0 on success, -1 if in_sz is not a multiple of 96 or if any
+   point is invalid.
+   Internally, this uses Pippenger's bucket method on batches of up to
+   FD_BN254_MSM_BATCH_MAX pairs, which is much faster than adding the
+   results of individual scalar multiplications.
+   This is a standalone primitive, no syscall uses it.  The
+   sol_alt_bn128_group_op ABI only has single point add, sub and mul
+   (FD_VM_SYSCALL_SOL_ALT_BN128_*), so exposing an MSM to programs needs
+   a new op, i.e. a feature gated consensus change. */
+int
+fd_bn254_g1_multi_scalar_mul( uchar       out[64],
+                              uchar const in[],
+                              ulong       in_sz );
+
 int
 fd_bn254_pairing_is_one_syscall( uchar       out[32],
                                  uchar const in[],
@@ -259,6 +259,172 @@ fd_bn254_g1_scalar_mul( fd_bn254_g1_t *           r,
   return r;
 }
 
+/* fd_bn254_g1_add computes r = p + q, with both p, q in Jacobian
+   coordinates (i.e. neither is assumed to be affine).
+   http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#addition-add-2007-bl */
+fd_bn254_g1_t *
+fd_bn254_g1_add( fd_bn254_g1_t *       r,
+                 fd_bn254_g1_t const * p,
+                 fd_bn254_g1_t const * q ) {
+  /* p==0, return q */
+  if( FD_UNLIKELY( fd_bn254_g1_is_zero( p ) ) ) {
+    return fd_bn254_g1_set( r, q );
+  }
+  /* q==0, return p */
+  if( FD_UNLIKELY( fd_bn254_g1_is_zero( q ) ) ) {
+    return fd_bn254_g1_set( r, p );
+  }
+  fd_bn254_fp_t z1z1[1], z2z2[1];
+  fd_bn254_fp_t u1[1], u2[1], s1[1], s2[1];
+  fd_bn254_fp_t h[1], i[1], j[1], rr[1], v[1];
+  fd_bn254_fp_t x3[1], y3[1], z3[1];
+  /* Z1Z1 = Z1^2, Z2Z2 = Z2^2 */
+  fd_bn254_fp_sqr( z1z1, &p->Z );
+  fd_bn254_fp_sqr( z2z2, &q->Z );
+  /* U1 = X1*Z2Z2, U2 = X2*Z1Z1 */
+  fd_bn254_fp_mul( u1, &p->X, z2z2 );
+  fd_bn254_fp_mul( u2, &q->X, z1z1 );
+  /* S1 = Y1*Z2*Z2Z2, S2 = Y2*Z1*Z1Z1 */
+  fd_bn254_fp_mul( s1, &p->Y, &q->Z );
+  fd_bn254_fp_mul( s1, s1, z2z2 );
+  fd_bn254_fp_mul( s2, &q->Y, &p->Z );
+  fd_bn254_fp_mul( s2, s2, z1z1 );
+
+  /* if p==q, call fd_bn254_g1_dbl.
+     if p==-q, H==0 and the result below is Z3==0, i.e. the point at
+     infinity, as expected. */
+  if( FD_UNLIKELY( fd_bn254_fp_eq( u1, u2 ) && fd_bn254_fp_eq( s1, s2 ) ) ) {
+    return fd_bn254_g1_dbl( r, p );
+  }
+
+  /* H = U2-U1 */
+  fd_bn254_fp_sub( h, u2, u1 );
+  /* I = (2*H)^2 */
+  fd_bn254_fp_add( i, h, h );
+  fd_bn254_fp_sqr( i, i );
+  /* J = H*I */
+  fd_bn254_fp_mul( j, h, i );
+  /* r = 2*(S2-S1) */
+  fd_bn254_fp_sub( rr, s2, s1 );
+  fd_bn254_fp_add( rr, rr, rr );
+  /* V = U1*I */
+  fd_bn254_fp_mul( v, u1, i );
+  /* X3 = r^2-J-2*V */
+  fd_bn254_fp_sqr( x3, rr );
+  fd_bn254_fp_sub( x3, x3, j );
+  fd_bn254_fp_sub( x3, x3, v );
+  fd_bn254_fp_sub( x3, x3, v );
+  /* Y3 = r*(V-X3)-2*S1*J
+     note: j no longer used */
+  fd_bn254_fp_mul( j, s1, j );
+  fd_bn254_fp_add( j, j, j );
+  fd_bn254_fp_sub( y3, v, x3 );
+  fd_bn254_fp_mul( y3, y3, rr );
+  fd_bn254_fp_sub( y3, y3, j );
+  /* Z3 = ((Z1+Z2)^2-Z1Z1-Z2Z2)*H */
+  fd_bn254_fp_add( z3, &p->Z, &q->Z );
+  fd_bn254_fp_sqr( z3, z3 );
+  fd_bn254_fp_sub( z3, z3, z1z1 );
+  fd_bn254_fp_sub( z3, z3, z2z2 );
+  fd_bn254_fp_mul( z3, z3, h );
+
+  fd_bn254_fp_set( &r->X, x3 );
+  fd_bn254_fp_set( &r->Y, y3 );
+  fd_bn254_fp_set( &r->Z, z3 );
+  return r;
+}
+
+/* fd_bn254_g1_msm_window returns bits [off,off+c) of the scalar s.
+   Bits past 255 read as 0. */
+static inline ulong
+fd_bn254_g1_msm_window( fd_bn254_scalar_t const * s,
+                        ulong                     off,
+                        ulong                     c ) {
+  ulong limb = off >> 6;
+  ulong sh   = off & 63UL;
+  ulong w    = s->limbs[ limb ] >> sh;
+  if( sh+c>64UL && limb<3UL ) {
+    w |= s->limbs[ limb+1UL ] << (64UL-sh);
+  }
+  return w & ((1UL<<c)-1UL);
+}
+
+/* FD_BN254_G1_MSM_MIN is the smallest cnt for which fd_bn254_g1_msm
+   uses the bucket method.  FD_BN254_G1_MSM_WINDOW_MAX bounds the window
+   size (and thus the 2^WINDOW_MAX-1 buckets, ~12KiB, on the stack). */
+
+#define FD_BN254_G1_MSM_MIN        (4UL)
+#define FD_BN254_G1_MSM_WINDOW_MAX (7UL)
+
+/* fd_bn254_g1_msm computes r = sum_i s[i] * p[i], for i in [0,cnt).
+   This assumes that all non-zero p[i] are affine, i.e. p[i]->Z==1.
+   Scalars are NOT required to be reduced mod r.
+
+   This is Pippenger's bucket method.  Scalars are split in windows
+   of c bits.  For each window, from the most significant, every point
+   is added to the bucket indexed by its scalar window (mixed add),
+   buckets are combined with a running sum into sum_b b*bucket[b],
+   and the result is accumulated into r after c doublings.  The cost
+   is about 256/c * (cnt + 2^(c+1)) additions, vs about 128*cnt
+   additions and 256*cnt doublings for cnt independent scalar muls.
+   For very small cnt, independent scalar muls are faster. */
+fd_bn254_g1_t *
+fd_bn254_g1_msm( fd_bn254_g1_t *           r,
+                 fd_bn254_g1_t const       p[],
+                 fd_bn254_scalar_t const   s[],
+                 ulong                     cnt ) {
+  if( FD_UNLIKELY( cnt<FD_BN254_G1_MSM_MIN ) ) {
+    fd_bn254_g1_t t[1];
+    fd_bn254_g1_set_zero( r );
+    for( ulong k=0UL; k<cnt; k++ ) {
+      if( FD_UNLIKELY( fd_bn254_g1_is_zero( &p[k] ) ) ) continue;
+      fd_bn254_g1_scalar_mul( t, &p[k], &s[k] );
+      fd_bn254_g1_add( r, r, t );
+    }
+    return r;
+  }
+
+  /* Window size ~ ln(cnt)+2, capped so that the buckets fit
+     comfortably on the stack. */
+  ulong c = fd_ulong_min( (ulong)fd_ulong_find_msb( cnt )*69UL/100UL + 2UL, FD_BN254_G1_MSM_WINDOW_MAX );
+  ulong bucket_cnt = (1UL<<c) - 1UL; /* window 0 does not need a bucket */
+  ulong window_cnt = (256UL + c - 1UL) / c;
+
+  fd_bn254_g1_t bucket[ (1UL<<FD_BN254_G1_MSM_WINDOW_MAX) - 1UL ];
+  fd_bn254_g1_t sum[1], win[1];
+
+  fd_bn254_g1_set_zero( r );
+  for( ulong w=window_cnt; w>0UL; w-- ) {
+    ulong off = (w-1UL)*c;
+
+    /* r = 2^c * r */
+    for( ulong k=0UL; k<c; k++ ) {
+      fd_bn254_g1_dbl( r, r );
+    }
+
+    /* Fill the buckets */
+    for( ulong b=0UL; b<bucket_cnt; b++ ) {
+      fd_bn254_g1_set_zero( &bucket[ b ] );
+    }
+    for( ulong k=0UL; k<cnt; k++ ) {
+      ulong idx = fd_bn254_g1_msm_window( &s[k], off, fd_ulong_min( c, 256UL-off ) );
+      if( FD_UNLIKELY( !idx || fd_bn254_g1_is_zero( &p[k] ) ) ) continue;
+      fd_bn254_g1_add_mixed( &bucket[ idx-1UL ], &bucket[ idx-1UL ], &p[k] );
+    }
+
+    /* win = sum_b (b+1)*bucket[b], via running sums */
+    fd_bn254_g1_set_zero( sum );
+    fd_bn254_g1_set_zero( win );
+    for( ulong b=bucket_cnt; b>0UL; b-- ) {
+      fd_bn254_g1_add( sum, sum, &bucket[ b-1UL ] );
+      fd_bn254_g1_add( win, win, sum );
+    }
+
+    fd_bn254_g1_add( r, r, win );
+  }
+  return r;
+}
+
 /* fd_bn254_g1_frombytes_internal extracts (x, y) and performs basic checks.
    This is used by fd_bn254_g1_compress() and fd_bn254_g1_frombytes_check_subgroup().
    https://github.com/arkworks-rs/algebra/blob/v0.4.2/ec/src/models/short_weierstrass/mod.rs#L173-L178 */
@@ -1,5 +1,6 @@
 #include "./fd_poseidon.h"
 #include "fd_poseidon_params.c"
+#include "fd_poseidon_params_opt.c"
 
 /* Poseidon internals */
 
@@ -32,15 +33,15 @@ fd_poseidon_apply_sbox_partial( fd_bn254_scalar_t state[] ) {
 }
 
 static inline void
-fd_poseidon_apply_mds( fd_bn254_scalar_t   state[],
-                       ulong const       width,
-                       fd_poseidon_par_t const * params ) {
+fd_poseidon_apply_mds( fd_bn254_scalar_t         state[],
+                       ulong const               width,
+                       fd_bn254_scalar_t const * mds ) {
   fd_bn254_scalar_t x[FD_POSEIDON_MAX_WIDTH+1] = { 0 };
   /* Vector-matrix multiplication (state vector times mds matrix) */
   for( ulong i=0; i<width; i++ ) {
     for( ulong j=0; j<width; j++ ) {
       fd_bn254_scalar_t t[1];
-      fd_bn254_scalar_mul( t, &state[j], &params->mds[ i * width + j ] );
+      fd_bn254_scalar_mul( t, &state[j], &mds[ i * width + j ] );
       fd_bn254_scalar_add( &x[i], &x[i], t );
     }
   }
@@ -49,12 +50,37 @@ fd_poseidon_apply_mds( fd_bn254_scalar_t   state[],
   }
 }
 
+/* fd_poseidon_apply_sparse multiplies the state by the sparse matrix
+   of a partial round, see fd_poseidon_params_opt.c.  The matrix only
+   has a dense first row and first column (the rest is the identity),
+   so this costs 2*width-1 multiplications instead of width^2. */
+
+static inline void
+fd_poseidon_apply_sparse( fd_bn254_scalar_t         state[],
+                          ulong const               width,
+                          fd_bn254_scalar_t const * sparse ) {
+  fd_bn254_scalar_t s0[1] = { state[0] };
+  fd_bn254_scalar_t t[1];
+  fd_bn254_scalar_mul( &state[0], s0, &sparse[0] );
+  for( ulong j=1; j<width; j++ ) {
+    fd_bn254_scalar_mul( t, &state[j], &sparse[j] );
+    fd_bn254_scalar_add( &state[0], &state[0], t );
+  }
+  for( ulong j=1; j<width; j++ ) {
+    fd_bn254_scalar_mul( t, s0, &sparse[ width-1+j ] );
+    fd_bn254_scalar_add( &state[j], &state[j], t );
+  }
+}
+
 static inline void
 fd_poseidon_get_params( fd_poseidon_par_t * params,
                         ulong const         width ) {
-#define FD_POSEIDON_GET_PARAMS(w) case (w):                \
-  params->ark = (fd_bn254_scalar_t *)fd_poseidon_ark_## w; \
-  params->mds = (fd_bn254_scalar_t *)fd_poseidon_mds_## w; \
+#define FD_POSEIDON_GET_PARAMS(w) case (w):                               \
+  params->ark        = (fd_bn254_scalar_t *)fd_poseidon_ark_## w;        \
+  params->mds        = (fd_bn254_scalar_t *)fd_poseidon_mds_## w;        \
+  params->opt_pre    = (fd_bn254_scalar_t *)fd_poseidon_opt_pre_## w;    \
+  params->opt_ark    = (fd_bn254_scalar_t *)fd_poseidon_opt_ark_## w;    \
+  params->opt_sparse = (fd_bn254_scalar_t *)fd_poseidon_opt_sparse_## w; \
   break
 
   switch( width ) {
@@ -135,7 +161,7 @@ fd_poseidon_fini( fd_poseidon_t * pos,
   const ulong width = pos->cnt+1;
   fd_poseidon_par_t params[1] = { 0 };
   fd_poseidon_get_params( params, width );
-  if( FD_UNLIKELY( !params->ark || !params->mds ) ) {
+  if( FD_UNLIKELY( !params->ark || !params->mds || !params->opt_pre || !params->opt_ark || !params->opt_sparse ) ) {
     return NULL;
   }
 
@@ -145,23 +171,36 @@ fd_poseidon_fini( fd_poseidon_t * pos,
   const ulong half_rounds = full_rounds / 2;
   const ulong all_rounds = full_rounds + partial_rounds;
 
+  /* The partial rounds are computed with the equivalent "optimized"
+     parameters (see gen_poseidon_params_opt.py): the round constants
+     of the partial rounds are moved forward so that only state[0]
+     receives a constant after each S-box, and each MDS multiplication
+     is replaced by a sparse matrix.  The last full round before the
+     partial rounds uses a modified MDS matrix to compensate. */
+
   ulong round=0;
   for (; round<half_rounds; round++ ) {
     fd_poseidon_apply_ark         ( pos->state, width, params, round );
     fd_poseidon_apply_sbox_full   ( pos->state, width );
-    fd_poseidon_apply_mds         ( pos->state, width, params );
+    fd_poseidon_apply_mds         ( pos->state, width, round<half_rounds-1 ? params->mds : params->opt_pre );
   }
 
-  for (; round<half_rounds+partial_rounds; round++ ) {
-    fd_poseidon_apply_ark         ( pos->state, width, params, round );
+  for( ulong i=0; i<width; i++ ) {
+    fd_bn254_scalar_add( &pos->state[i], &pos->state[i], &params->opt_ark[i] );
+  }
+  for( ulong r=0; r<partial_rounds; r++ ) {
     fd_poseidon_apply_sbox_partial( pos->state );
-    fd_poseidon_apply_mds         ( pos->state, width, params );
+    if( FD_LIKELY( r<partial_rounds-1 ) ) {
+      fd_bn254_scalar_add( &pos->state[0], &pos->state[0], &params->opt_ark[ width+r ] );
+    }
+    fd_poseidon_apply_sparse      ( pos->state, width, &params->opt_sparse[ r*(2*width-1) ] );
   }
+  round += partial_rounds;
 
   for (; round<all_rounds; round++ ) {
     fd_poseidon_apply_ark         ( pos->state, width, params, round );
     fd_poseidon_apply_sbox_full   ( pos->state, width );
-    fd_poseidon_apply_mds         ( pos->state, width, params );
+    fd_poseidon_apply_mds         ( pos->state, width, params->mds );
   }
 
   /* Directly convert scalar into return hash buffer - hash MUST be FD_UINT256_ALIGNED */
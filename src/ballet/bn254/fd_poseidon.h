@@ -29,6 +29,9 @@ typedef struct fd_poseidon fd_poseidon_t;
 struct fd_poseidon_par {
   fd_bn254_scalar_t * ark;
   fd_bn254_scalar_t * mds;
+  fd_bn254_scalar_t * opt_pre;    /* Optimized parameters for the partial rounds, */
+  fd_bn254_scalar_t * opt_ark;    /* see fd_poseidon_params_opt.c */
+  fd_bn254_scalar_t * opt_sparse;
 };
 typedef struct fd_poseidon_par fd_poseidon_par_t;
 
@@ -0,0 +1,133 @@
+# Generates fd_poseidon_params_opt.c, the parameters of the optimized
+# Poseidon permutation, from the round constants and MDS matrices in
+# fd_poseidon_params.c.
+#
+# The optimization is the one in Appendix B of the Poseidon paper
+# (https://eprint.iacr.org/2019/458.pdf), as also used by circomlib's
+# poseidon_constants_opt:
+#
+# - The round constants of the partial rounds are moved backwards
+#   through the linear layers, so that the first partial round adds a
+#   full vector and each later partial round adds a single scalar to
+#   state[0] (after its S-box).
+#
+# - The MDS matrix M of each partial round is factored as S*H, with S
+#   sparse (first row, first column and identity elsewhere) and H of
+#   the form [[1,0],[0,H']].  H commutes with the partial S-box and is
+#   moved into the previous round.  The last remaining H is merged into
+#   the MDS matrix of the last full round of the first half.
+#
+# Usage: python3 gen_poseidon_params_opt.py > fd_poseidon_params_opt.c
+
+import re
+import sys
+
+R = 0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001
+MONT   = pow(2, 256, R)
+MONT_I = pow(MONT, -1, R)
+
+FULL_ROUNDS    = 8
+PARTIAL_ROUNDS = [ 56, 57, 56, 60, 60, 63, 64, 63, 60, 66, 60, 65, 70, 60, 64, 68 ]
+
+def parse_params(path):
+    src = open(path).read()
+    tbls = {}
+    for m in re.finditer(r'fd_poseidon_(ark|mds)_(\d+)\[\] = \{(.*?)\n\};', src, re.S):
+        vals = []
+        for e in re.finditer(r'\{\{ (0x[0-9a-f]+), (0x[0-9a-f]+), (0x[0-9a-f]+), (0x[0-9a-f]+), \}\}', m.group(3)):
+            limbs = [ int(x, 16) for x in e.groups() ]
+            v = limbs[0] | (limbs[1]<<64) | (limbs[2]<<128) | (limbs[3]<<192)
+            vals.append( v * MONT_I % R )
+        tbls[(m.group(1), int(m.group(2)))] = vals
+    return tbls
+
+def mat_mul(a, b):
+    n, k, m = len(a), len(b), len(b[0])
+    return [ [ sum(a[i][t]*b[t][j] for t in range(k)) % R for j in range(m) ] for i in range(n) ]
+
+def mat_vec(a, v):
+    return [ sum(a[i][j]*v[j] for j in range(len(v))) % R for i in range(len(a)) ]
+
+def vec_mat(v, a):
+    return [ sum(v[i]*a[i][j] for i in range(len(v))) % R for j in range(len(a[0])) ]
+
+def mat_inv(a):
+    n = len(a)
+    m = [ row[:] + [ int(i==j) for j in range(n) ] for i, row in enumerate(a) ]
+    for c in range(n):
+        p = next(r for r in range(c, n) if m[r][c])
+        m[c], m[p] = m[p], m[c]
+        inv = pow(m[c][c], -1, R)
+        m[c] = [ x*inv % R for x in m[c] ]
+        for r in range(n):
+            if r!=c and m[r][c]:
+                f = m[r][c]
+                m[r] = [ (x - f*y) % R for x, y in zip(m[r], m[c]) ]
+    return [ row[n:] for row in m ]
+
+def optimize(w, ark, mds):
+    P    = PARTIAL_ROUNDS[w-2]
+    half = FULL_ROUNDS//2
+    M    = [ mds[i*w:(i+1)*w] for i in range(w) ]
+    Mi   = mat_inv(M)
+    a    = [ ark[(half+r)*w:(half+r+1)*w] for r in range(P) ]
+
+    # Move the partial round constants backwards
+    c   = [ 0 ]*(P-1)
+    acc = a[P-1][:]
+    for r in range(P-1, 0, -1):
+        u      = mat_vec(Mi, acc)
+        c[r-1] = u[0]
+        acc    = [ a[r-1][0] ] + [ (a[r-1][j] + u[j]) % R for j in range(1, w) ]
+
+    # Factor the partial round matrices
+    sparse = [ None ]*P
+    X = M
+    for r in range(P-1, -1, -1):
+        Hs = [ row[1:] for row in X[1:] ]
+        sr = vec_mat(X[0][1:], mat_inv(Hs))
+        sc = [ X[i][0] for i in range(1, w) ]
+        sparse[r] = [ X[0][0] ] + sr + sc
+        H = [ [ 1 ] + [ 0 ]*(w-1) ] + [ [ 0 ] + Hs[i] for i in range(w-1) ]
+        X = mat_mul(H, M)
+    # X is now H_0*M, the matrix of the last full round of the first half
+    pre = X
+    a0  = mat_vec(H, acc)
+    return P, [ x for row in pre for x in row ], a0 + c, [ x for s in sparse for x in s ]
+
+def emit(name, vals, out):
+    out.write('static const fd_bn254_scalar_t %s[] = {\n' % name)
+    for v in vals:
+        v = v * MONT % R
+        limbs = [ (v >> (64*i)) & 0xffffffffffffffff for i in range(4) ]
+        out.write('  {{ 0x%016x, 0x%016x, 0x%016x, 0x%016x, }},\n' % tuple(limbs))
+    out.write('};\n')
+
+def main():
+    tbls = parse_params(sys.argv[1] if len(sys.argv)>1 else 'fd_poseidon_params.c')
+    out  = sys.stdout
+    out.write('''/* Optimized Poseidon parameters, to compute Poseidon with
+   2 <= width <= 13.  Generated by gen_poseidon_params_opt.py from
+   fd_poseidon_params.c, see there for details.  Do not edit.
+
+   All elements are in Montgomery form.
+   fd_poseidon_opt_pre_w is a w x w matrix that replaces the MDS matrix
+   of the last full round before the partial rounds.
+   fd_poseidon_opt_ark_w is a vector of w + partial_rounds-1 elements:
+   the w round constants of the first partial round, followed by the
+   scalar constant added to state[0] after the S-box of each partial
+   round (except the last).
+   fd_poseidon_opt_sparse_w holds, for each partial round, the 2w-1
+   non-trivial entries of its sparse matrix: the first row, then the
+   first column without its first element. */
+
+''')
+    for w in range(2, 14):
+        P, pre, ark, sparse = optimize(w, tbls[('ark', w)], tbls[('mds', w)])
+        emit('fd_poseidon_opt_pre_%d'    % w, pre,    out); out.write('\n')
+        emit('fd_poseidon_opt_ark_%d'    % w, ark,    out); out.write('\n')
+        emit('fd_poseidon_opt_sparse_%d' % w, sparse, out)
+        if w<13: out.write('\n')
+
+if __name__ == '__main__':
+    main()
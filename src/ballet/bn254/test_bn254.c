@@ -178,6 +178,84 @@ int main( int     argc,
       dt = fd_log_wallclock() - dt;
       log_bench( "fd_bn254_g1_scalar_mul_syscall", iter, dt );
     }
+
+    /* Multi-scalar mul: all the test vectors above in one msm,
+       compared against the sum of individual scalar muls. */
+    uchar msm_in[ 20*96 ];
+    uchar acc[128];
+    fd_memset( acc, 0, 64 );
+    for( ulong i=0; i<len; i++ ) {
+      ulong in_sz = strlen( tests[2*i] ) / 2;
+      fd_memset( &msm_in[i*96], 0, 96 );
+      fd_hex_decode( &msm_in[i*96], tests[2*i], in_sz );
+      FD_TEST( fd_bn254_g1_scalar_mul_syscall( &acc[64], &msm_in[i*96], 96, 1 )==0 );
+      FD_TEST( fd_bn254_g1_add_syscall( acc, acc, 128 )==0 );
+    }
+    for( ulong cnt=0; cnt<=len; cnt++ ) {
+      /* prefixes of the test vectors, covering both the small cnt and
+         the bucket method paths */
+      fd_memset( exp, 0, 64 );
+      for( ulong i=0; i<cnt; i++ ) {
+        uchar pair[128];
+        fd_memcpy( pair, exp, 64 );
+        FD_TEST( fd_bn254_g1_scalar_mul_syscall( &pair[64], &msm_in[i*96], 96, 1 )==0 );
+        FD_TEST( fd_bn254_g1_add_syscall( exp, pair, 128 )==0 );
+      }
+      FD_TEST( fd_bn254_g1_multi_scalar_mul( res, msm_in, cnt*96 )==0 );
+      if( !fd_memeq( res, exp, 64 ) ) {
+        FD_LOG_HEXDUMP_WARNING(( "res", res, 64 ));
+        FD_LOG_HEXDUMP_WARNING(( "exp", exp, 64 ));
+        FD_LOG_ERR(( "FAIL: msm cnt %lu, %s", cnt, "res != exp" ));
+      }
+    }
+    FD_TEST( fd_memeq( res, acc, 64 ) );
+    FD_TEST( fd_bn254_g1_multi_scalar_mul( res, msm_in, 95 )==-1 );
+
+    /* Larger msm with random scalars, spanning multiple internal
+       batches.  Points are k*G, with G=(1,2). */
+#   define MSM_CNT (2UL*FD_BN254_MSM_BATCH_MAX+5UL)
+    static uchar big_in[ MSM_CNT*96 ];
+    fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1U, 0UL ) );
+    uchar gen[96] = { 0 };
+    gen[31] = 1; gen[63] = 2;
+    fd_memset( exp, 0, 64 );
+    for( ulong i=0; i<MSM_CNT; i++ ) {
+      gen[95] = (uchar)(i+1); gen[94] = (uchar)((i+1)>>8);
+      FD_TEST( fd_bn254_g1_scalar_mul_syscall( &big_in[i*96], gen, 96, 1 )==0 );
+      for( ulong b=0; b<32; b++ ) big_in[i*96+64+b] = fd_rng_uchar( rng );
+      uchar pair[128];
+      fd_memcpy( pair, exp, 64 );
+      FD_TEST( fd_bn254_g1_scalar_mul_syscall( &pair[64], &big_in[i*96], 96, 1 )==0 );
+      FD_TEST( fd_bn254_g1_add_syscall( exp, pair, 128 )==0 );
+    }
+    FD_TEST( fd_bn254_g1_multi_scalar_mul( res, big_in, MSM_CNT*96 )==0 );
+    FD_TEST( fd_memeq( res, exp, 64 ) );
+    fd_rng_delete( fd_rng_leave( rng ) );
+
+    {
+      static ulong const bench_cnt[3] = { 8UL, 64UL, FD_BN254_MSM_BATCH_MAX };
+      for( ulong k=0; k<3; k++ ) {
+        ulong cnt  = bench_cnt[k];
+        ulong iter = 10UL;
+        long dt = fd_log_wallclock();
+        for( ulong rem=iter; rem; rem-- ) {
+          for( ulong i=0; i<cnt; i++ ) fd_bn254_g1_scalar_mul_syscall( res, &big_in[i*96], 96, 1 );
+        }
+        dt = fd_log_wallclock() - dt;
+        char descr[64];
+        FD_TEST( fd_cstr_printf_check( descr, 64, NULL, "%lu x g1_scalar_mul_syscall", cnt ) );
+        log_bench( descr, iter, dt );
+
+        dt = fd_log_wallclock();
+        for( ulong rem=iter; rem; rem-- ) {
+          fd_bn254_g1_multi_scalar_mul( res, big_in, cnt*96 );
+        }
+        dt = fd_log_wallclock() - dt;
+        FD_TEST( fd_cstr_printf_check( descr, 64, NULL, "g1_multi_scalar_mul (cnt %lu)", cnt ) );
+        log_bench( descr, iter, dt );
+      }
+    }
+#   undef MSM_CNT
   }
 
   {
@@ -1,6 +1,70 @@
 #include "fd_poseidon.h"
 #include "../../util/fd_util.h"
 
+/* Reference (unoptimized) Poseidon permutation, straight from the
+   round constants and MDS matrices, used to cross check the optimized
+   partial rounds in fd_poseidon_fini. */
+
+#include "fd_poseidon_params.c"
+
+static void
+ref_poseidon_perm( fd_bn254_scalar_t state[],
+                   ulong             cnt ) {
+  static const ulong PARTIAL_ROUNDS[] = { 56, 57, 56, 60, 60, 63, 64, 63, 60, 66, 60, 65 };
+  fd_bn254_scalar_t const * ark_tbl[] = {
+    fd_poseidon_ark_2, fd_poseidon_ark_3,  fd_poseidon_ark_4,  fd_poseidon_ark_5,  fd_poseidon_ark_6,  fd_poseidon_ark_7,
+    fd_poseidon_ark_8, fd_poseidon_ark_9,  fd_poseidon_ark_10, fd_poseidon_ark_11, fd_poseidon_ark_12, fd_poseidon_ark_13 };
+  fd_bn254_scalar_t const * mds_tbl[] = {
+    fd_poseidon_mds_2, fd_poseidon_mds_3,  fd_poseidon_mds_4,  fd_poseidon_mds_5,  fd_poseidon_mds_6,  fd_poseidon_mds_7,
+    fd_poseidon_mds_8, fd_poseidon_mds_9,  fd_poseidon_mds_10, fd_poseidon_mds_11, fd_poseidon_mds_12, fd_poseidon_mds_13 };
+
+  ulong width = cnt+1UL;
+  ulong partial_rounds = PARTIAL_ROUNDS[ cnt-1UL ];
+  fd_bn254_scalar_t const * ark = ark_tbl[ cnt-1UL ];
+  fd_bn254_scalar_t const * mds = mds_tbl[ cnt-1UL ];
+
+  for( ulong round=0UL; round<8UL+partial_rounds; round++ ) {
+    int full = round<4UL || round>=4UL+partial_rounds;
+    for( ulong i=0UL; i<width; i++ ) {
+      fd_bn254_scalar_add( &state[i], &state[i], &ark[ round*width+i ] );
+      if( full || i==0UL ) {
+        fd_bn254_scalar_t t[1];
+        fd_bn254_scalar_sqr( t, &state[i] );
+        fd_bn254_scalar_sqr( t, t );
+        fd_bn254_scalar_mul( &state[i], &state[i], t );
+      }
+    }
+    fd_bn254_scalar_t x[ FD_POSEIDON_MAX_WIDTH+1UL ] = { 0 };
+    for( ulong i=0UL; i<width; i++ ) {
+      for( ulong j=0UL; j<width; j++ ) {
+        fd_bn254_scalar_t t[1];
+        fd_bn254_scalar_mul( t, &state[j], &mds[ i*width+j ] );
+        fd_bn254_scalar_add( &x[i], &x[i], t );
+      }
+    }
+    for( ulong i=0UL; i<width; i++ ) state[i] = x[i];
+  }
+}
+
+/* ref_poseidon_hash computes the hash of cnt little endian field
+   elements (each reduced mod r) with the reference permutation. */
+
+static void
+ref_poseidon_hash( uchar         hash[ 32 ],
+                   uchar const * in,
+                   ulong         cnt ) {
+  fd_bn254_scalar_t state[ FD_POSEIDON_MAX_WIDTH+1UL ] = { 0 };
+  for( ulong i=0UL; i<cnt; i++ ) {
+    fd_bn254_scalar_t cur[1];
+    fd_memcpy( cur->buf, in + i*32UL, 32UL );
+    fd_bn254_scalar_to_mont( &state[i+1UL], cur );
+  }
+  ref_poseidon_perm( state, cnt );
+  fd_bn254_scalar_t r[1];
+  fd_bn254_scalar_from_mont( r, &state[0] );
+  fd_memcpy( hash, r->buf, 32UL );
+}
+
 /* Swap bytes in a 32-byte big int */
 static inline void
 byte_swap_32(uchar * v) {
@@ -269,6 +333,59 @@ int main( int     argc,
     }
   }
 
+  /* Cross check the optimized partial rounds against the reference
+     permutation on random inputs, for all widths and both endianness */
+  {
+    fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1234U, 0UL ) );
+    uchar in[ FD_POSEIDON_MAX_WIDTH*32UL ];
+    uchar be[ FD_POSEIDON_MAX_WIDTH*32UL ];
+    uchar exp[32];
+    fd_poseidon_hash_result_t res;
+
+    for( ulong iter=0UL; iter<64UL; iter++ ) {
+      for( ulong cnt=1UL; cnt<=FD_POSEIDON_MAX_WIDTH; cnt++ ) {
+        for( ulong i=0UL; i<cnt; i++ ) {
+          for( ulong k=0UL; k<32UL; k++ ) in[ i*32UL+k ] = fd_rng_uchar( rng );
+          in[ i*32UL+31UL ] &= (uchar)0x1f; /* < 2^253, some still >= r */
+          if( !fd_bn254_scalar_validate( fd_type_pun_const( in + i*32UL ) ) ) in[ i*32UL+31UL ] &= (uchar)0x0f;
+          for( ulong k=0UL; k<32UL; k++ ) be[ i*32UL+k ] = in[ i*32UL+31UL-k ];
+        }
+        ref_poseidon_hash( exp, in, cnt );
+
+        FD_TEST( !fd_poseidon_hash( &res, in, cnt*32UL, 0 ) );
+        FD_TEST( !memcmp( res.v, exp, 32UL ) );
+
+        byte_swap_32( exp );
+        FD_TEST( !fd_poseidon_hash( &res, be, cnt*32UL, 1 ) );
+        FD_TEST( !memcmp( res.v, exp, 32UL ) );
+      }
+    }
+
+    /* benchmark optimized vs reference, per width */
+    char cstr[128];
+    ulong iter = 1000UL;
+    uchar const * msg = in;
+    for( ulong cnt=1UL; cnt<=FD_POSEIDON_MAX_WIDTH; cnt++ ) {
+      long dt = fd_log_wallclock();
+      for( ulong rem=iter; rem; rem-- ) {
+        FD_COMPILER_FORGET( msg );
+        fd_poseidon_hash( &res, msg, cnt*32UL, 0 );
+      }
+      dt = fd_log_wallclock() - dt;
+      log_bench( fd_cstr_printf( cstr, 128UL, NULL, "fd_poseidon_hash(%lu)", cnt ), iter, dt );
+
+      dt = fd_log_wallclock();
+      for( ulong rem=iter; rem; rem-- ) {
+        FD_COMPILER_FORGET( msg );
+        ref_poseidon_hash( exp, msg, cnt );
+      }
+      dt = fd_log_wallclock() - dt;
+      log_bench( fd_cstr_printf( cstr, 128UL, NULL, "ref_poseidon_hash(%lu)", cnt ), iter, dt );
+    }
+
+    fd_rng_delete( fd_rng_leave( rng ) );
+  }
+
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
   return 0;
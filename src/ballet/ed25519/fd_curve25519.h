@@ -161,7 +161,8 @@ fd_ed25519_double_scalar_mul_base( fd_ed25519_point_t *       r,
                                    uchar const                n2[ 32 ] );
 
 /* fd_ed25519_multi_scalar_mul computes r = n0 * a0 + n1 * a1 + ..., and returns r.
-   n is a vector of sz scalars. a is a vector of sz points. */
+   n is a vector of sz scalars. a is a vector of sz points.
+   Uses Straus for small sz, and Pippenger (bucket method) for large sz. */
 fd_ed25519_point_t *
 fd_ed25519_multi_scalar_mul( fd_ed25519_point_t *     r,
                              uchar const              n[], /* sz * 32 */
@@ -486,6 +486,22 @@ test_multiscalar_mul( fd_rng_t * rng ) {
     else if (i % 15 == 0) { memcpy( &f[i], &f[0], sizeof(fd_ristretto255_point_t)*15 ); }
   }
 
+  /* large MSM (bucket method) vs. the sum of small ones (Straus),
+     with scalars up to 2^255 to exercise the signed digit carry */
+  for( ulong i=0; i<MSM_N; i+=7 ) _a[i][31] = (uchar)( fd_rng_uchar( rng ) | 0x40 ) & 0x7f;
+  for( ulong sz=160; sz<=MSM_N; sz+=sz/2 ) {
+    fd_ristretto255_point_t _e[1]; fd_ristretto255_point_t * e = _e;
+    fd_ristretto255_point_t _t[1]; fd_ristretto255_point_t * t = _t;
+    fd_ristretto255_point_set_zero( e );
+    for( ulong i=0; i<sz; i+=32 ) {
+      fd_ristretto255_multi_scalar_mul( t, a + 32*i, f + i, fd_ulong_min( sz-i, 32 ) );
+      fd_ristretto255_point_add( e, e, t );
+    }
+    FD_TEST( fd_ristretto255_multi_scalar_mul( h, a, f, sz )==h );
+    FD_TEST( fd_ristretto255_point_eq( h, e ) );
+  }
+  for( ulong i=0; i<MSM_N; i+=7 ) _a[i][31] &= 0x01;
+
   for( ulong sz=32; sz<=MSM_N; sz*=2 )
   {
     long dt = fd_log_wallclock();
@@ -0,0 +1,98 @@
+#define FD_KECCAK256_BATCH_IMPL 1
+
+#include "fd_keccak256.h"
+#include "fd_keccak256_private.h"
+#include "../../util/simd/fd_avx.h"
+
+FD_STATIC_ASSERT( FD_KECCAK256_BATCH_MAX==4UL, compat );
+
+void
+fd_keccak256_private_batch_avx( ulong          batch_cnt,
+                                void const *   _batch_data,
+                                ulong const *  batch_sz,
+                                void * const * batch_hash ) {
+
+  /* If the batch is too small, it's faster to run each part of the
+     batch sequentially. */
+
+  uchar const * const * batch_data = (uchar const * const *)_batch_data;
+
+  if( FD_UNLIKELY( batch_cnt<2UL ) ) {
+    for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ )
+      fd_keccak256_hash( batch_data[ batch_idx ], batch_sz[ batch_idx ], batch_hash[ batch_idx ] );
+    return;
+  }
+
+  /* Keccak pads each message with a 0x01 terminator byte, zeros and a
+     final 0x80 byte such that the message is an integer number of
+     FD_KECCAK256_RATE byte blocks long.  As there is at least one byte
+     of padding, every message has exactly one tail block.  We compute
+     the tail block of each message here and absorb the complete blocks
+     of the original messages in place.  Lanes that have finished (or
+     are unused) keep absorbing their tail block; this is harmless as
+     their hash was already extracted. */
+
+  ulong         batch_full[ FD_KECCAK256_BATCH_MAX ];
+  uchar const * batch_tail[ FD_KECCAK256_BATCH_MAX ];
+
+  uchar scratch[ FD_KECCAK256_BATCH_MAX*FD_KECCAK256_RATE ] __attribute__((aligned(128)));
+
+  ulong block_cnt = 0UL;
+  for( ulong batch_idx=0UL; batch_idx<FD_KECCAK256_BATCH_MAX; batch_idx++ ) {
+    uchar * tail = scratch + batch_idx*FD_KECCAK256_RATE;
+    memset( tail, 0, FD_KECCAK256_RATE );
+    batch_tail[ batch_idx ] = tail;
+    batch_full[ batch_idx ] = 0UL;
+    if( FD_UNLIKELY( batch_idx>=batch_cnt ) ) continue;
+
+    ulong sz      = batch_sz[ batch_idx ];
+    ulong full    = sz / FD_KECCAK256_RATE;
+    ulong tail_sz = sz - full*FD_KECCAK256_RATE;
+    fd_memcpy( tail, batch_data[ batch_idx ] + full*FD_KECCAK256_RATE, tail_sz );
+    tail[ tail_sz                 ] ^= (uchar)0x01;
+    tail[ FD_KECCAK256_RATE - 1UL ] ^= (uchar)0x80;
+
+    batch_full[ batch_idx ] = full;
+    block_cnt = fd_ulong_max( block_cnt, full+1UL );
+  }
+
+  wv_t a[25];
+  for( ulong i=0UL; i<25UL; i++ ) a[i] = wv_zero();
+
+  for( ulong block_idx=0UL; block_idx<block_cnt; block_idx++ ) {
+
+    uchar const * p[ FD_KECCAK256_BATCH_MAX ];
+    for( ulong batch_idx=0UL; batch_idx<FD_KECCAK256_BATCH_MAX; batch_idx++ )
+      p[ batch_idx ] = block_idx<batch_full[ batch_idx ] ? batch_data[ batch_idx ] + block_idx*FD_KECCAK256_RATE
+                                                         : batch_tail[ batch_idx ];
+
+    /* Absorb the FD_KECCAK256_RATE/8==17 words of each lane's block.
+       Words 0:15 are loaded and transposed 4 at a time. */
+
+    for( ulong off=0UL; off<128UL; off+=32UL ) {
+      wv_t c0, c1, c2, c3;
+      wv_transpose_4x4( wv_ldu( p[0]+off ), wv_ldu( p[1]+off ), wv_ldu( p[2]+off ), wv_ldu( p[3]+off ), c0, c1, c2, c3 );
+      ulong w = off>>3;
+      a[ w     ] = wv_xor( a[ w     ], c0 );
+      a[ w+1UL ] = wv_xor( a[ w+1UL ], c1 );
+      a[ w+2UL ] = wv_xor( a[ w+2UL ], c2 );
+      a[ w+3UL ] = wv_xor( a[ w+3UL ], c3 );
+    }
+    a[16] = wv_xor( a[16], wv( FD_LOAD( ulong, p[0]+128 ), FD_LOAD( ulong, p[1]+128 ),
+                               FD_LOAD( ulong, p[2]+128 ), FD_LOAD( ulong, p[3]+128 ) ) );
+
+    FD_KECCAK256_PRIVATE_F1600( wv_t, wv_xor, wv_andnot, wv_rol, wv_bcast, a );
+
+    /* Extract the hash of any lanes that just absorbed their tail
+       block.  The hash is the first 4 words of the state. */
+
+    int done = 0;
+    for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) done |= (block_idx==batch_full[ batch_idx ]);
+    if( FD_LIKELY( done ) ) {
+      wv_t h[4];
+      wv_transpose_4x4( a[0], a[1], a[2], a[3], h[0], h[1], h[2], h[3] );
+      for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ )
+        if( block_idx==batch_full[ batch_idx ] ) wv_stu( batch_hash[ batch_idx ], h[ batch_idx ] );
+    }
+  }
+}
@@ -0,0 +1,108 @@
+#define FD_KECCAK256_BATCH_IMPL 2
+
+#include "fd_keccak256.h"
+#include "fd_keccak256_private.h"
+#include "../../util/simd/fd_avx512.h"
+#include "../../util/simd/fd_avx.h"
+
+FD_STATIC_ASSERT( FD_KECCAK256_BATCH_MAX==8UL, compat );
+
+void
+fd_keccak256_private_batch_avx( ulong          batch_cnt,
+                                void const *   batch_data,
+                                ulong const *  batch_sz,
+                                void * const * batch_hash );
+
+void
+fd_keccak256_private_batch_avx512( ulong          batch_cnt,
+                                   void const *   _batch_data,
+                                   ulong const *  batch_sz,
+                                   void * const * batch_hash ) {
+
+  /* If the batch is small enough, it is more efficient to use the
+     narrow batched implementation. */
+
+  if( FD_UNLIKELY( batch_cnt<=4UL ) ) {
+    fd_keccak256_private_batch_avx( batch_cnt, _batch_data, batch_sz, batch_hash );
+    return;
+  }
+
+  /* See fd_keccak256_batch_avx.c for details on the tail block
+     handling. */
+
+  uchar const * const * batch_data = (uchar const * const *)_batch_data;
+
+  ulong         batch_full[ FD_KECCAK256_BATCH_MAX ];
+  uchar const * batch_tail[ FD_KECCAK256_BATCH_MAX ];
+
+  uchar scratch[ FD_KECCAK256_BATCH_MAX*FD_KECCAK256_RATE ] __attribute__((aligned(128)));
+
+  ulong block_cnt = 0UL;
+  for( ulong batch_idx=0UL; batch_idx<FD_KECCAK256_BATCH_MAX; batch_idx++ ) {
+    uchar * tail = scratch + batch_idx*FD_KECCAK256_RATE;
+    memset( tail, 0, FD_KECCAK256_RATE );
+    batch_tail[ batch_idx ] = tail;
+    batch_full[ batch_idx ] = 0UL;
+    if( FD_UNLIKELY( batch_idx>=batch_cnt ) ) continue;
+
+    ulong sz      = batch_sz[ batch_idx ];
+    ulong full    = sz / FD_KECCAK256_RATE;
+    ulong tail_sz = sz - full*FD_KECCAK256_RATE;
+    fd_memcpy( tail, batch_data[ batch_idx ] + full*FD_KECCAK256_RATE, tail_sz );
+    tail[ tail_sz                 ] ^= (uchar)0x01;
+    tail[ FD_KECCAK256_RATE - 1UL ] ^= (uchar)0x80;
+
+    batch_full[ batch_idx ] = full;
+    block_cnt = fd_ulong_max( block_cnt, full+1UL );
+  }
+
+  wwv_t a[25];
+  for( ulong i=0UL; i<25UL; i++ ) a[i] = wwv_zero();
+
+  for( ulong block_idx=0UL; block_idx<block_cnt; block_idx++ ) {
+
+    uchar const * p[ FD_KECCAK256_BATCH_MAX ];
+    for( ulong batch_idx=0UL; batch_idx<FD_KECCAK256_BATCH_MAX; batch_idx++ )
+      p[ batch_idx ] = block_idx<batch_full[ batch_idx ] ? batch_data[ batch_idx ] + block_idx*FD_KECCAK256_RATE
+                                                         : batch_tail[ batch_idx ];
+
+    /* Absorb the FD_KECCAK256_RATE/8==17 words of each lane's block.
+       Words 0:15 are loaded and transposed 8 at a time. */
+
+    for( ulong off=0UL; off<128UL; off+=64UL ) {
+      wwv_t c0, c1, c2, c3, c4, c5, c6, c7;
+      wwv_transpose_8x8( wwv_ldu( p[0]+off ), wwv_ldu( p[1]+off ), wwv_ldu( p[2]+off ), wwv_ldu( p[3]+off ),
+                         wwv_ldu( p[4]+off ), wwv_ldu( p[5]+off ), wwv_ldu( p[6]+off ), wwv_ldu( p[7]+off ),
+                         c0, c1, c2, c3, c4, c5, c6, c7 );
+      ulong w = off>>3;
+      a[ w     ] = wwv_xor( a[ w     ], c0 );
+      a[ w+1UL ] = wwv_xor( a[ w+1UL ], c1 );
+      a[ w+2UL ] = wwv_xor( a[ w+2UL ], c2 );
+      a[ w+3UL ] = wwv_xor( a[ w+3UL ], c3 );
+      a[ w+4UL ] = wwv_xor( a[ w+4UL ], c4 );
+      a[ w+5UL ] = wwv_xor( a[ w+5UL ], c5 );
+      a[ w+6UL ] = wwv_xor( a[ w+6UL ], c6 );
+      a[ w+7UL ] = wwv_xor( a[ w+7UL ], c7 );
+    }
+    a[16] = wwv_xor( a[16], wwv( FD_LOAD( ulong, p[0]+128 ), FD_LOAD( ulong, p[1]+128 ),
+                                 FD_LOAD( ulong, p[2]+128 ), FD_LOAD( ulong, p[3]+128 ),
+                                 FD_LOAD( ulong, p[4]+128 ), FD_LOAD( ulong, p[5]+128 ),
+                                 FD_LOAD( ulong, p[6]+128 ), FD_LOAD( ulong, p[7]+128 ) ) );
+
+    FD_KECCAK256_PRIVATE_F1600( wwv_t, wwv_xor, wwv_andnot, wwv_rol, wwv_bcast, a );
+
+    /* Extract the hash of any lanes that just absorbed their tail
+       block.  The hash is the first 4 words of the state (the other
+       rows of the transpose are don't cares). */
+
+    int done = 0;
+    for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) done |= (block_idx==batch_full[ batch_idx ]);
+    if( FD_LIKELY( done ) ) {
+      wwv_t h[8];
+      wwv_transpose_8x8( a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7],
+                         h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7] );
+      for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ )
+        if( block_idx==batch_full[ batch_idx ] ) wv_stu( batch_hash[ batch_idx ], _mm512_castsi512_si256( h[ batch_idx ] ) );
+    }
+  }
+}
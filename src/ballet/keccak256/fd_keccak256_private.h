@@ -91,6 +91,73 @@ fd_keccak256_core( ulong * state ) {
 # undef ROTATE
 }
 
+/* fd_keccak256_private_round_consts holds the iota step round
+   constants.  Used by the batched implementations below. */
+
+static ulong const fd_keccak256_private_round_consts[24] = {
+  0x0000000000000001UL, 0x0000000000008082UL, 0x800000000000808AUL, 0x8000000080008000UL,
+  0x000000000000808BUL, 0x0000000080000001UL, 0x8000000080008081UL, 0x8000000000008009UL,
+  0x000000000000008AUL, 0x0000000000000088UL, 0x0000000080008009UL, 0x000000008000000AUL,
+  0x000000008000808BUL, 0x800000000000008BUL, 0x8000000000008089UL, 0x8000000000008003UL,
+  0x8000000000008002UL, 0x8000000000000080UL, 0x000000000000800AUL, 0x800000008000000AUL,
+  0x8000000080008081UL, 0x8000000000008080UL, 0x0000000080000001UL, 0x8000000080008008UL
+};
+
+/* FD_KECCAK256_PRIVATE_F1600 applies the keccak-f[1600] permutation to
+   the state held in the array T a[25] (a[x+5*y] is lane (x,y) of the
+   state).  T is a vector type holding one 64-bit state lane of several
+   independent states (e.g. wv_t for 4 states, wwv_t for 8 states) and
+   XOR, ANDNOT, ROL and BCAST are the corresponding vector operations
+   (ANDNOT(x,y) is ~x & y, ROL rotates each 64-bit lane left by a
+   compile time constant and BCAST broadcasts a ulong).  This is the
+   same computation as fd_keccak256_core with the rho and pi steps
+   unrolled such that all rotations are by immediates. */
+
+#define FD_KECCAK256_PRIVATE_F1600( T, XOR, ANDNOT, ROL, BCAST, a ) do {                                        \
+    T _c[5]; T _d[5]; T _b[25];                                                                                 \
+    for( ulong _round=0UL; _round<24UL; _round++ ) {                                                            \
+      /* Theta */                                                                                               \
+      for( ulong _x=0UL; _x<5UL; _x++ )                                                                         \
+        _c[_x] = XOR( XOR( XOR( a[_x], a[_x+5UL] ), XOR( a[_x+10UL], a[_x+15UL] ) ), a[_x+20UL] );              \
+      _d[0] = XOR( _c[4], ROL( _c[1], 1 ) ); _d[1] = XOR( _c[0], ROL( _c[2], 1 ) );                             \
+      _d[2] = XOR( _c[1], ROL( _c[3], 1 ) ); _d[3] = XOR( _c[2], ROL( _c[4], 1 ) );                             \
+      _d[4] = XOR( _c[3], ROL( _c[0], 1 ) );                                                                    \
+      for( ulong _i=0UL; _i<25UL; _i++ ) a[_i] = XOR( a[_i], _d[_i%5UL] );                                      \
+      /* Rho and pi */                                                                                          \
+      _b[ 0] = ROL( a[ 0],  0 );                                                                                \
+      _b[10] = ROL( a[ 1],  1 );                                                                                \
+      _b[20] = ROL( a[ 2], 62 );                                                                                \
+      _b[ 5] = ROL( a[ 3], 28 );                                                                                \
+      _b[15] = ROL( a[ 4], 27 );                                                                                \
+      _b[16] = ROL( a[ 5], 36 );                                                                                \
+      _b[ 1] = ROL( a[ 6], 44 );                                                                                \
+      _b[11] = ROL( a[ 7],  6 );                                                                                \
+      _b[21] = ROL( a[ 8], 55 );                                                                                \
+      _b[ 6] = ROL( a[ 9], 20 );                                                                                \
+      _b[ 7] = ROL( a[10],  3 );                                                                                \
+      _b[17] = ROL( a[11], 10 );                                                                                \
+      _b[ 2] = ROL( a[12], 43 );                                                                                \
+      _b[12] = ROL( a[13], 25 );                                                                                \
+      _b[22] = ROL( a[14], 39 );                                                                                \
+      _b[23] = ROL( a[15], 41 );                                                                                \
+      _b[ 8] = ROL( a[16], 45 );                                                                                \
+      _b[18] = ROL( a[17], 15 );                                                                                \
+      _b[ 3] = ROL( a[18], 21 );                                                                                \
+      _b[13] = ROL( a[19],  8 );                                                                                \
+      _b[14] = ROL( a[20], 18 );                                                                                \
+      _b[24] = ROL( a[21],  2 );                                                                                \
+      _b[ 9] = ROL( a[22], 61 );                                                                                \
+      _b[19] = ROL( a[23], 56 );                                                                                \
+      _b[ 4] = ROL( a[24], 14 );                                                                                \
+      /* Chi */                                                                                                 \
+      for( ulong _y=0UL; _y<25UL; _y+=5UL )                                                                     \
+        for( ulong _x=0UL; _x<5UL; _x++ )                                                                       \
+          a[_y+_x] = XOR( _b[_y+_x], ANDNOT( _b[_y+(_x+1UL)%5UL], _b[_y+(_x+2UL)%5UL] ) );                      \
+      /* Iota */                                                                                                \
+      a[0] = XOR( a[0], BCAST( fd_keccak256_private_round_consts[ _round ] ) );                                 \
+    }                                                                                                           \
+  } while(0)
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_ballet_keccak256_fd_keccak256_private_h */
@@ -81,6 +81,66 @@ main( int     argc,
 
   }
 
+  /* Test batching */
+
+  FD_TEST( fd_ulong_is_pow2( FD_KECCAK256_BATCH_ALIGN )                                                 );
+  FD_TEST( (FD_KECCAK256_BATCH_FOOTPRINT>0UL) & !(FD_KECCAK256_BATCH_FOOTPRINT % FD_KECCAK256_BATCH_ALIGN) );
+
+  FD_TEST( fd_keccak256_batch_align()    ==FD_KECCAK256_BATCH_ALIGN     );
+  FD_TEST( fd_keccak256_batch_footprint()==FD_KECCAK256_BATCH_FOOTPRINT );
+
+# define BATCH_MAX (32UL)
+# define DATA_MAX  (512UL)
+  uchar data_mem[ DATA_MAX       ]; for( ulong idx=0UL; idx<DATA_MAX; idx++ ) data_mem[ idx ] = fd_rng_uchar( rng );
+  uchar hash_mem[ 32UL*BATCH_MAX ];
+
+  uchar batch_mem[ FD_KECCAK256_BATCH_FOOTPRINT ] __attribute__((aligned(FD_KECCAK256_BATCH_ALIGN)));
+  for( ulong trial_rem=65536UL; trial_rem; trial_rem-- ) {
+    uchar const * data[ BATCH_MAX ];
+    ulong         sz  [ BATCH_MAX ];
+    uchar *       hash[ BATCH_MAX ];
+
+    fd_keccak256_batch_t * batch = fd_keccak256_batch_init( batch_mem ); FD_TEST( batch );
+
+    int   batch_abort = !(fd_rng_ulong( rng ) & 31UL);
+    ulong batch_cnt   = fd_rng_ulong( rng ) & (BATCH_MAX-1UL);
+    for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) {
+      ulong off0 = fd_rng_ulong( rng ) & (DATA_MAX-1UL);
+      ulong off1 = fd_rng_ulong( rng ) & (DATA_MAX-1UL);
+      data[ batch_idx ] = data_mem + fd_ulong_min( off0, off1 );
+      sz  [ batch_idx ] = fd_ulong_max( off0, off1 ) - fd_ulong_min( off0, off1 );
+      hash[ batch_idx ] = hash_mem + batch_idx*32UL;
+      FD_TEST( fd_keccak256_batch_add( batch, data[ batch_idx ], sz[ batch_idx ], hash[ batch_idx ] )==batch );
+    }
+
+    if( FD_UNLIKELY( batch_abort ) ) FD_TEST( fd_keccak256_batch_abort( batch )==(void *)batch_mem );
+    else {
+      FD_TEST( fd_keccak256_batch_fini( batch )==(void *)batch_mem );
+      for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) {
+        uchar ref_hash[ 32 ];
+        FD_TEST( !memcmp( fd_keccak256_hash( data[ batch_idx ], sz[ batch_idx ], ref_hash ), hash[ batch_idx ], 32UL ) );
+      }
+    }
+  }
+# undef DATA_MAX
+# undef BATCH_MAX
+
+  /* The test vectors again, all in one batch (covers the block
+     boundary sizes and lanes finishing at different blocks) */
+
+  do {
+    ulong vec_cnt = 0UL;
+    for( fd_keccak256_test_vector_t const * vec = fd_keccak256_test_vector; vec->msg; vec++ ) vec_cnt++;
+    FD_TEST( vec_cnt<=64UL );
+    uchar vec_hash[ 64UL*32UL ];
+    fd_keccak256_batch_t * batch = fd_keccak256_batch_init( batch_mem );
+    for( ulong vec_idx=0UL; vec_idx<vec_cnt; vec_idx++ )
+      fd_keccak256_batch_add( batch, fd_keccak256_test_vector[ vec_idx ].msg, fd_keccak256_test_vector[ vec_idx ].sz, vec_hash+vec_idx*32UL );
+    fd_keccak256_batch_fini( batch );
+    for( ulong vec_idx=0UL; vec_idx<vec_cnt; vec_idx++ )
+      FD_TEST( !memcmp( vec_hash+vec_idx*32UL, fd_keccak256_test_vector[ vec_idx ].hash, 32UL ) );
+  } while(0);
+
   /* do a quick benchmark of keccak-256 on small and large UDP payload
      packets from UDP/IP4/VLAN/Ethernet */
 
@@ -121,6 +181,55 @@ main( int     argc,
     FD_LOG_NOTICE(( "~%.3f Gbps Ethernet equiv throughput / core (sz %4lu)", (double)gbps, sz ));
   }
 
+  FD_LOG_NOTICE(( "Benchmarking batched" ));
+  for( ulong idx=0U; idx<2UL; idx++ ) {
+    ulong sz = bench_sz[ idx ];
+    for( ulong batch_cnt=1UL; batch_cnt<=16UL; batch_cnt++ ) {
+
+      /* warmup */
+      for( ulong rem=10UL; rem; rem-- ) {
+        fd_keccak256_batch_t * batch = fd_keccak256_batch_init( batch_mem );
+        for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) fd_keccak256_batch_add( batch, buf, sz, hash );
+        fd_keccak256_batch_fini( batch );
+      }
+
+      /* for real */
+      ulong iter = 10000UL;
+      long  dt   = -fd_log_wallclock();
+      for( ulong rem=iter; rem; rem-- ) {
+        fd_keccak256_batch_t * batch = fd_keccak256_batch_init( batch_mem );
+        for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) fd_keccak256_batch_add( batch, buf, sz, hash );
+        fd_keccak256_batch_fini( batch );
+      }
+      dt += fd_log_wallclock();
+      float gbps = ((float)(batch_cnt*8UL*(70UL+sz)*iter)) / ((float)dt);
+      FD_LOG_NOTICE(( "~%.3f Gbps Ethernet equiv throughput / core (batch_cnt %2lu sz %4lu)", (double)gbps, batch_cnt, sz ));
+    }
+  }
+
+  /* secp256k1 precompile style hashing of 64 byte public keys, scalar
+     vs batched */
+
+  FD_LOG_NOTICE(( "Benchmarking secp256k1 public key hashing" ));
+  do {
+    ulong iter = 100000UL;
+    long  dt   = -fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) fd_keccak256_hash( buf, 64UL, hash );
+    dt += fd_log_wallclock();
+    FD_LOG_NOTICE(( "~%.3f M hashes / sec / core (scalar)", (double)((float)iter*1e3f / (float)dt) ));
+
+    ulong batch_cnt = 8UL;
+    uchar batch_hash[ 8UL*32UL ];
+    dt = -fd_log_wallclock();
+    for( ulong rem=iter/batch_cnt; rem; rem-- ) {
+      fd_keccak256_batch_t * batch = fd_keccak256_batch_init( batch_mem );
+      for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) fd_keccak256_batch_add( batch, buf+batch_idx, 64UL, batch_hash+batch_idx*32UL );
+      fd_keccak256_batch_fini( batch );
+    }
+    dt += fd_log_wallclock();
+    FD_LOG_NOTICE(( "~%.3f M hashes / sec / core (batch_cnt %lu)", (double)((float)iter*1e3f / (float)dt), batch_cnt ));
+  } while(0);
+
   /* clean up */
 
   FD_TEST( fd_keccak256_leave( NULL )==NULL ); /* null sha */
@@ -18,8 +18,12 @@ fd_lthash_adder_new( fd_lthash_adder_t * adder ) {
     FD_LOG_WARNING(( "misaligned lthash_adder" ));
     return NULL;
   }
-  fd_memset( adder, 0, sizeof(fd_lthash_adder_t) );
+  /* The batch buffer is not cleared such that adders can be cheaply
+     created on the stack for short lived batches (e.g. the accounts
+     written by a single transaction). */
+  adder->batch_cnt = 0U;
 #if FD_LTHASH_ADDER_PARA_CNT>1
+  fd_memset( adder->batch_sz, 0, sizeof(adder->batch_sz) );
   for( ulong i=0UL; i<FD_LTHASH_ADDER_PARA_CNT; i++ ) {
     adder->batch_ptrs[ i ] = (ulong)( adder->batch_data + i*FD_BLAKE3_CHUNK_SZ );
   }
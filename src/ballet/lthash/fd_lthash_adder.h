@@ -97,7 +97,18 @@ static inline void
 fd_lthash_adder_flush( fd_lthash_adder_t * adder,
                        fd_lthash_value_t * sum ) {
   uint batch_cnt = adder->batch_cnt;
-  for( uint i=0U; i<batch_cnt; i++ ) {
+  uint i         = 0U;
+# if FD_HAS_AVX512 && FD_HAS_AVX
+  /* Partial batches of at least 8 inputs use the 8 lane kernel for the
+     first 8 inputs (batch_ptrs and batch_sz are suitably aligned). */
+  if( batch_cnt>=8U ) {
+    fd_lthash_value_t value[1];
+    fd_blake3_lthash_batch8( (void const **)fd_type_pun_const( adder->batch_ptrs ), adder->batch_sz, value->words );
+    fd_lthash_add( sum, value );
+    i = 8U;
+  }
+# endif
+  for( ; i<batch_cnt; i++ ) {
     fd_lthash_value_t value[1];
     fd_blake3_t blake[1];
     fd_blake3_init( blake );
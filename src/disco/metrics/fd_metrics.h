@@ -43,7 +43,9 @@
     [ out_link_0_metrics ... out_link_N_metrics ]
     [ tile_metrics ]
 
-   where every value is a ulong.  Tile metrics come after link metrics,
+   where every value is a ulong.  Each link's metrics area is
+   FD_METRICS_ALL_LINK_{IN,OUT}_STRIDE ulongs (link metrics can include
+   histograms, so this is not the number of link metrics).  Tile metrics come after link metrics,
    so this base pointer points at the very start of the layout.  You
    shouldn't need to use this directly, instead it's used by fd_stem
    when it's computing the metrics for specific links. */
@@ -62,8 +64,8 @@ extern FD_TL volatile ulong * fd_metrics_tl;
 #define FD_METRICS_FOOTPRINT(in_link_cnt, out_link_reliable_consumer_cnt)                                   \
   FD_LAYOUT_FINI( FD_LAYOUT_APPEND( FD_LAYOUT_APPEND( FD_LAYOUT_APPEND ( FD_LAYOUT_APPEND ( FD_LAYOUT_INIT, \
     8UL, 16UL ),                                                                                            \
-    8UL, (in_link_cnt)*FD_METRICS_ALL_LINK_IN_TOTAL*sizeof(ulong) ),                                        \
-    8UL, (out_link_reliable_consumer_cnt)*FD_METRICS_ALL_LINK_OUT_TOTAL*sizeof(ulong) ),                    \
+    8UL, (in_link_cnt)*FD_METRICS_ALL_LINK_IN_STRIDE*sizeof(ulong) ),                                       \
+    8UL, (out_link_reliable_consumer_cnt)*FD_METRICS_ALL_LINK_OUT_STRIDE*sizeof(ulong) ),                   \
     8UL, FD_METRICS_TOTAL_SZ ),                                                                             \
     FD_METRICS_ALIGN )
 
@@ -125,17 +127,17 @@ FD_PROTOTYPES_BEGIN
 /* fd_metrics_tile returns a pointer to the tile-specific metrics area
    for the given metrics object.  */
 static inline volatile ulong *
-fd_metrics_tile( ulong * metrics ) { return metrics + 2UL + FD_METRICS_ALL_LINK_IN_TOTAL*metrics[ 0 ] + FD_METRICS_ALL_LINK_OUT_TOTAL*metrics[ 1 ]; }
+fd_metrics_tile( ulong * metrics ) { return metrics + 2UL + FD_METRICS_ALL_LINK_IN_STRIDE*metrics[ 0 ] + FD_METRICS_ALL_LINK_OUT_STRIDE*metrics[ 1 ]; }
 
 /* fd_metrics_link_in returns a pointer the in-link metrics area for the
    given in link index of this metrics object. */
 static inline volatile ulong *
-fd_metrics_link_in( ulong * metrics, ulong in_idx ) { return metrics + 2UL + FD_METRICS_ALL_LINK_IN_TOTAL*in_idx; }
+fd_metrics_link_in( ulong * metrics, ulong in_idx ) { return metrics + 2UL + FD_METRICS_ALL_LINK_IN_STRIDE*in_idx; }
 
 /* fd_metrics_link_in returns a pointer the in-link metrics area for the
    given out link index of this metrics object. */
 static inline volatile ulong *
-fd_metrics_link_out( ulong * metrics, ulong out_idx ) { return metrics + 2UL + FD_METRICS_ALL_LINK_IN_TOTAL*metrics[0] + FD_METRICS_ALL_LINK_OUT_TOTAL*out_idx; }
+fd_metrics_link_out( ulong * metrics, ulong out_idx ) { return metrics + 2UL + FD_METRICS_ALL_LINK_IN_STRIDE*metrics[0] + FD_METRICS_ALL_LINK_OUT_STRIDE*out_idx; }
 
 /* fd_metrics_new formats an unused memory region for use as a metrics.
    Assumes shmem is a non-NULL pointer to this region in the local
@@ -53,10 +53,16 @@ render_link( fd_prom_render_t *        r,
   fd_http_server_printf( r->http, "%s{kind=\"%s\",kind_id=\"%lu\",link_kind=\"%s\",link_kind_id=\"%lu\"} %lu\n", metric->name, tile->name, tile->kind_id, link->name, link->kind_id, value );
 }
 
+/* render_histogram renders the histogram at hist_values (the bucket
+   counts followed by the sum) for a tile metric, or for an in link
+   metric of the tile if link is non-NULL. */
+
 static void
 render_histogram( fd_prom_render_t *        r,
                   fd_metrics_meta_t const * metric,
-                  fd_topo_tile_t const *    tile ) {
+                  fd_topo_tile_t const *    tile,
+                  fd_topo_link_t const *    link,
+                  ulong const volatile *    hist_values ) {
   render_header( r, metric );
 
   fd_histf_t hist[1];
@@ -66,10 +72,14 @@ render_histogram( fd_prom_render_t *        r,
     FD_TEST( fd_histf_new( hist, metric->histogram.none.min, metric->histogram.none.max ) );
   else FD_LOG_ERR(( "unknown converter %i", metric->converter ));
 
+  char labels[ 128 ];
+  if( FD_LIKELY( !link ) ) FD_TEST( fd_cstr_printf_check( labels, sizeof( labels ), NULL, "kind=\"%s\",kind_id=\"%lu\"", tile->name, tile->kind_id ) );
+  else                     FD_TEST( fd_cstr_printf_check( labels, sizeof( labels ), NULL, "kind=\"%s\",kind_id=\"%lu\",link_kind=\"%s\",link_kind_id=\"%lu\"", tile->name, tile->kind_id, link->name, link->kind_id ) );
+
   ulong value = 0;
   char value_str[ 64 ];
   for( ulong k=0; k<FD_HISTF_BUCKET_CNT; k++ ) {
-    value += *(fd_metrics_tile( tile->metrics ) + metric->offset + k);
+    value += hist_values[ k ];
 
     char * le; /* le here means "less then or equal" not "left edge" */
     char le_str[ 64 ];
@@ -86,19 +96,19 @@ render_histogram( fd_prom_render_t *        r,
     }
 
     FD_TEST( fd_cstr_printf_check( value_str, sizeof( value_str ), NULL, "%lu", value ));
-    fd_http_server_printf( r->http, "%s_bucket{kind=\"%s\",kind_id=\"%lu\",le=\"%s\"} %s\n", metric->name, tile->name, tile->kind_id, le, value_str );
+    fd_http_server_printf( r->http, "%s_bucket{%s,le=\"%s\"} %s\n", metric->name, labels, le, value_str );
   }
 
   char sum_str[ 64 ];
   if( FD_LIKELY( metric->converter==FD_METRICS_CONVERTER_SECONDS ) ) {
-    double sumf = fd_metrics_convert_ticks_to_seconds( *(fd_metrics_tile( tile->metrics ) + metric->offset + FD_HISTF_BUCKET_CNT) );
+    double sumf = fd_metrics_convert_ticks_to_seconds( hist_values[ FD_HISTF_BUCKET_CNT ] );
     FD_TEST( fd_cstr_printf_check( sum_str, sizeof( sum_str ), NULL, "%.17g", sumf ) );
   } else {
-    FD_TEST( fd_cstr_printf_check( sum_str, sizeof( sum_str ), NULL, "%lu", *(fd_metrics_tile( tile->metrics ) + metric->offset + FD_HISTF_BUCKET_CNT) ));
+    FD_TEST( fd_cstr_printf_check( sum_str, sizeof( sum_str ), NULL, "%lu", hist_values[ FD_HISTF_BUCKET_CNT ] ));
   }
 
-  fd_http_server_printf( r->http, "%s_sum{kind=\"%s\",kind_id=\"%lu\"} %s\n", metric->name, tile->name, tile->kind_id, sum_str );
-  fd_http_server_printf( r->http, "%s_count{kind=\"%s\",kind_id=\"%lu\"} %s\n", metric->name, tile->name, tile->kind_id, value_str );
+  fd_http_server_printf( r->http, "%s_sum{%s} %s\n", metric->name, labels, sum_str );
+  fd_http_server_printf( r->http, "%s_count{%s} %s\n", metric->name, labels, value_str );
 }
 
 static void
@@ -137,12 +147,16 @@ render_links_in( fd_prom_render_t *        r,
     fd_metrics_meta_t const * metric = &metrics[ i ];
     for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
       fd_topo_tile_t const * tile = &topo->tiles[ j ];
+      /* Link histograms are only sampled by tiles with link_latency
+         set (see fd_stem.c), skip them elsewhere. */
+      if( FD_UNLIKELY( metric->type==FD_METRICS_TYPE_HISTOGRAM && !tile->link_latency ) ) continue;
       ulong polled_in_idx = 0UL;
       for( ulong k=0UL; k<tile->in_cnt; k++ ) {
         if( FD_UNLIKELY( !tile->in_link_poll[ k ] ) ) continue;
         fd_topo_link_t const * link = &topo->links[ tile->in_link_id[ k ] ];
-        ulong value = *(fd_metrics_link_in( tile->metrics, polled_in_idx ) + metric->offset );
-        render_link( r, metric, tile, link, value );
+        ulong const volatile * values = fd_metrics_link_in( tile->metrics, polled_in_idx ) + metric->offset;
+        if( FD_UNLIKELY( metric->type==FD_METRICS_TYPE_HISTOGRAM ) ) render_histogram( r, metric, tile, link, values );
+        else                                                         render_link( r, metric, tile, link, *values );
         polled_in_idx++;
       }
     }
@@ -183,7 +197,7 @@ render_tile_metric( fd_prom_render_t *        r,
   if( FD_LIKELY( metric->type==FD_METRICS_TYPE_COUNTER || metric->type==FD_METRICS_TYPE_GAUGE ) ) {
     render_counter( r, metric, tile );
   } else if( FD_LIKELY( metric->type==FD_METRICS_TYPE_HISTOGRAM ) ) {
-    render_histogram( r, metric, tile );
+    render_histogram( r, metric, tile, NULL, fd_metrics_tile( tile->metrics ) + metric->offset );
   }
 }
 
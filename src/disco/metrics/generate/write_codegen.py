@@ -84,11 +84,17 @@ def _write_common(metrics: Metrics):
             _write_metric(f, metric, "tile")
 
         offset = sum([int(metric.footprint()/8) for metric in metrics.common])
-        f.write(f'\n#define FD_METRICS_ALL_TOTAL ({offset}UL)\n')
+        total = sum([int(metric.count()) for metric in metrics.common])
+        f.write(f'\n#define FD_METRICS_ALL_TOTAL ({total}UL)\n')
         f.write(f'extern const fd_metrics_meta_t FD_METRICS_ALL[FD_METRICS_ALL_TOTAL];\n')
         f.write(f'\n#define FD_METRICS_ALL_LINK_IN_TOTAL ({len(metrics.link_in)}UL)\n')
+        f.write(f'#define FD_METRICS_ALL_LINK_IN_STRIDE ({sum([int(metric.footprint()/8) for metric in metrics.link_in])}UL)\n')
+        # Counters come before the histograms in a link in metrics slot
+        link_in_counter_cnt = next((i for (i, metric) in enumerate(metrics.link_in) if isinstance(metric, HistogramMetric)), len(metrics.link_in))
+        f.write(f'#define FD_METRICS_ALL_LINK_IN_COUNTER_CNT ({link_in_counter_cnt}UL)\n')
         f.write(f'extern const fd_metrics_meta_t FD_METRICS_ALL_LINK_IN[FD_METRICS_ALL_LINK_IN_TOTAL];\n')
         f.write(f'\n#define FD_METRICS_ALL_LINK_OUT_TOTAL ({len(metrics.link_out)}UL)\n')
+        f.write(f'#define FD_METRICS_ALL_LINK_OUT_STRIDE ({sum([int(metric.footprint()/8) for metric in metrics.link_out])}UL)\n')
         f.write(f'extern const fd_metrics_meta_t FD_METRICS_ALL_LINK_OUT[FD_METRICS_ALL_LINK_OUT_TOTAL];\n')
 
         # Max size of any particular tiles metrics
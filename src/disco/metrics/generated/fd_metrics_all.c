@@ -18,6 +18,9 @@ const fd_metrics_meta_t FD_METRICS_ALL[FD_METRICS_ALL_TOTAL] = {
     DECLARE_METRIC_ENUM( TILE_REGIME_DURATION_NANOS, COUNTER, TILE_REGIME, BACKPRESSURE_PREFRAG ),
     DECLARE_METRIC_ENUM( TILE_REGIME_DURATION_NANOS, COUNTER, TILE_REGIME, CAUGHT_UP_POSTFRAG ),
     DECLARE_METRIC_ENUM( TILE_REGIME_DURATION_NANOS, COUNTER, TILE_REGIME, PROCESSING_POSTFRAG ),
+    DECLARE_METRIC( TILE_IDLE_WAIT_COUNT, COUNTER ),
+    DECLARE_METRIC( TILE_IDLE_WAIT_DURATION_NANOS, COUNTER ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( TILE_IDLE_WAKEUP_LATENCY_SECONDS ),
 };
 
 const fd_metrics_meta_t FD_METRICS_ALL_LINK_IN[FD_METRICS_ALL_LINK_IN_TOTAL] = {
@@ -29,6 +32,8 @@ const fd_metrics_meta_t FD_METRICS_ALL_LINK_IN[FD_METRICS_ALL_LINK_IN_TOTAL] = {
     DECLARE_METRIC( LINK_OVERRUN_POLLING_FRAG_COUNT, COUNTER ),
     DECLARE_METRIC( LINK_OVERRUN_READING_COUNT, COUNTER ),
     DECLARE_METRIC( LINK_OVERRUN_READING_FRAG_COUNT, COUNTER ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( LINK_PUBLISH_LATENCY_SECONDS ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( LINK_ORIGIN_LATENCY_SECONDS ),
 };
 
 const fd_metrics_meta_t FD_METRICS_ALL_LINK_OUT[FD_METRICS_ALL_LINK_OUT_TOTAL] = {
@@ -73,6 +78,7 @@ const char * FD_METRICS_TILE_KIND_NAMES[FD_METRICS_TILE_KIND_CNT] = {
     "snapla",
     "snapls",
     "tower",
+    "rpc",
 };
 
 const ulong FD_METRICS_TILE_KIND_SIZES[FD_METRICS_TILE_KIND_CNT] = {
@@ -113,6 +119,7 @@ const ulong FD_METRICS_TILE_KIND_SIZES[FD_METRICS_TILE_KIND_CNT] = {
     FD_METRICS_SNAPLA_TOTAL,
     FD_METRICS_SNAPLS_TOTAL,
     FD_METRICS_TOWER_TOTAL,
+    FD_METRICS_RPC_TOTAL,
 };
 const fd_metrics_meta_t * FD_METRICS_TILE_KIND_METRICS[FD_METRICS_TILE_KIND_CNT] = {
     FD_METRICS_NET,
@@ -152,4 +159,5 @@ const fd_metrics_meta_t * FD_METRICS_TILE_KIND_METRICS[FD_METRICS_TILE_KIND_CNT]
     FD_METRICS_SNAPLA,
     FD_METRICS_SNAPLS,
     FD_METRICS_TOWER,
+    FD_METRICS_RPC,
 };
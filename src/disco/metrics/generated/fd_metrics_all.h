@@ -42,6 +42,7 @@
 #include "fd_metrics_benchs.h"
 #include "fd_metrics_tower.h"
 #include "fd_metrics_gui.h"
+#include "fd_metrics_rpc.h"
 /* Start of LINK OUT metrics */
 
 #define FD_METRICS_COUNTER_LINK_SLOW_COUNT_OFF  (0UL)
@@ -100,6 +101,22 @@
 #define FD_METRICS_COUNTER_LINK_OVERRUN_READING_FRAG_COUNT_DESC "The number of fragments the link has not processed because it was overrun while reading."
 #define FD_METRICS_COUNTER_LINK_OVERRUN_READING_FRAG_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
+#define FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_OFF  (8UL)
+#define FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_NAME "link_publish_latency_seconds"
+#define FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_DESC "Time from a fragment being published by the producer (tspub) to it being consumed by the link reader. Only sampled if tiles.metric.link_latency_histograms is enabled."
+#define FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_MIN  (1e-08)
+#define FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_MAX  (0.01)
+
+#define FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_OFF  (25UL)
+#define FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_NAME "link_origin_latency_seconds"
+#define FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_DESC "Time from the origin timestamp of a fragment (tsorig) to it being consumed by the link reader. What the origin is depends on the producer, typically it is when the data first entered the validator. Only sampled if tiles.metric.link_latency_histograms is enabled."
+#define FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_MIN  (1e-06)
+#define FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_MAX  (0.5)
+
 /* Start of TILE metrics */
 
 #define FD_METRICS_GAUGE_TILE_PID_OFF  (0UL)
@@ -166,19 +183,42 @@
 #define FD_METRICS_COUNTER_TILE_REGIME_DURATION_NANOS_CAUGHT_UP_POSTFRAG_OFF (14UL)
 #define FD_METRICS_COUNTER_TILE_REGIME_DURATION_NANOS_PROCESSING_POSTFRAG_OFF (15UL)
 
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_COUNT_OFF  (16UL)
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_COUNT_NAME "tile_idle_wait_count"
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_COUNT_DESC "Number of times the tile had no work and backed off into a bounded wait on its inputs. Always zero unless the tile is listed in layout.idle_tiles."
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_DURATION_NANOS_OFF  (17UL)
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_DURATION_NANOS_NAME "tile_idle_wait_duration_nanos"
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_DURATION_NANOS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_DURATION_NANOS_DESC "Duration of time the tile spent in bounded idle waits. This is a subset of the caught up regimes, and is the time the core was released to save power."
+#define FD_METRICS_COUNTER_TILE_IDLE_WAIT_DURATION_NANOS_CVT  (FD_METRICS_CONVERTER_NANOSECONDS)
+
+#define FD_METRICS_HISTOGRAM_TILE_IDLE_WAKEUP_LATENCY_SECONDS_OFF  (18UL)
+#define FD_METRICS_HISTOGRAM_TILE_IDLE_WAKEUP_LATENCY_SECONDS_NAME "tile_idle_wakeup_latency_seconds"
+#define FD_METRICS_HISTOGRAM_TILE_IDLE_WAKEUP_LATENCY_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_TILE_IDLE_WAKEUP_LATENCY_SECONDS_DESC "Time from a fragment being published to the tile picking it up, for the first fragment received after an idle wait."
+#define FD_METRICS_HISTOGRAM_TILE_IDLE_WAKEUP_LATENCY_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_TILE_IDLE_WAKEUP_LATENCY_SECONDS_MIN  (1e-08)
+#define FD_METRICS_HISTOGRAM_TILE_IDLE_WAKEUP_LATENCY_SECONDS_MAX  (0.01)
+
 
-#define FD_METRICS_ALL_TOTAL (16UL)
+#define FD_METRICS_ALL_TOTAL (19UL)
 extern const fd_metrics_meta_t FD_METRICS_ALL[FD_METRICS_ALL_TOTAL];
 
-#define FD_METRICS_ALL_LINK_IN_TOTAL (8UL)
+#define FD_METRICS_ALL_LINK_IN_TOTAL (10UL)
+#define FD_METRICS_ALL_LINK_IN_STRIDE (42UL)
+#define FD_METRICS_ALL_LINK_IN_COUNTER_CNT (8UL)
 extern const fd_metrics_meta_t FD_METRICS_ALL_LINK_IN[FD_METRICS_ALL_LINK_IN_TOTAL];
 
 #define FD_METRICS_ALL_LINK_OUT_TOTAL (1UL)
+#define FD_METRICS_ALL_LINK_OUT_STRIDE (1UL)
 extern const fd_metrics_meta_t FD_METRICS_ALL_LINK_OUT[FD_METRICS_ALL_LINK_OUT_TOTAL];
 
-#define FD_METRICS_TOTAL_SZ (8UL*254UL)
+#define FD_METRICS_TOTAL_SZ (8UL*273UL)
 
-#define FD_METRICS_TILE_KIND_CNT 37
+#define FD_METRICS_TILE_KIND_CNT 38
 extern const char * FD_METRICS_TILE_KIND_NAMES[FD_METRICS_TILE_KIND_CNT];
 extern const ulong FD_METRICS_TILE_KIND_SIZES[FD_METRICS_TILE_KIND_CNT];
 extern const fd_metrics_meta_t * FD_METRICS_TILE_KIND_METRICS[FD_METRICS_TILE_KIND_CNT];
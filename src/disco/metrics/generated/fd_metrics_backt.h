@@ -6,13 +6,13 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_BACKT_FINAL_SLOT_OFF  (16UL)
+#define FD_METRICS_GAUGE_BACKT_FINAL_SLOT_OFF  (35UL)
 #define FD_METRICS_GAUGE_BACKT_FINAL_SLOT_NAME "backt_final_slot"
 #define FD_METRICS_GAUGE_BACKT_FINAL_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_BACKT_FINAL_SLOT_DESC "The slot after which the backtest will complete"
 #define FD_METRICS_GAUGE_BACKT_FINAL_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_BACKT_START_SLOT_OFF  (17UL)
+#define FD_METRICS_GAUGE_BACKT_START_SLOT_OFF  (36UL)
 #define FD_METRICS_GAUGE_BACKT_START_SLOT_NAME "backt_start_slot"
 #define FD_METRICS_GAUGE_BACKT_START_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_BACKT_START_SLOT_DESC "The slot at which the backtest started"
@@ -6,51 +6,51 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_OFF  (16UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_OFF  (35UL)
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_NAME "bankf_transaction_result"
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_DESC "Result of loading and executing a transaction."
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_CNT  (26UL)
 
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_SUCCESS_OFF (16UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INSTRUCTON_ERROR_OFF (17UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ACCOUNT_NOT_FOUND_OFF (18UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_PROGRAM_ACCOUNT_NOT_FOUND_OFF (19UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INSUFFICIENT_FUNDS_FOR_FEE_OFF (20UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ACCOUNT_FOR_FEE_OFF (21UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ALREADY_PROCESSED_OFF (22UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_BLOCKHASH_NOT_FOUND_OFF (23UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_PROGRAM_FOR_EXECUTION_OFF (24UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ADDRESS_LOOKUP_TABLE_NOT_FOUND_OFF (25UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ADDRESS_LOOKUP_TABLE_OWNER_OFF (26UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ADDRESS_LOOKUP_TABLE_DATA_OFF (27UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ADDRESS_LOOKUP_TABLE_INDEX_OFF (28UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_MAX_LOADED_ACCOUNTS_DATA_SIZE_EXCEEDED_OFF (29UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_DUPLICATE_INSTRUCTION_OFF (30UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_LOADED_ACCOUNTS_DATA_SIZE_LIMIT_OFF (31UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_NONCE_ALREADY_ADVANCED_OFF (32UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_NONCE_ADVANCE_FAILED_OFF (33UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_NONCE_WRONG_BLOCKHASH_OFF (34UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ACCOUNT_IN_USE_OFF (35UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ACCOUNT_LOADED_TWICE_OFF (36UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_SIGNATURE_FAILURE_OFF (37UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_TOO_MANY_ACCOUNT_LOCKS_OFF (38UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INSUFFICIENT_FUNDS_FOR_RENT_OFF (39UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_UNBALANCED_TRANSACTION_OFF (40UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_BUNDLE_PEER_OFF (41UL)
-
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_OFF  (42UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_SUCCESS_OFF (35UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INSTRUCTON_ERROR_OFF (36UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ACCOUNT_NOT_FOUND_OFF (37UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_PROGRAM_ACCOUNT_NOT_FOUND_OFF (38UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INSUFFICIENT_FUNDS_FOR_FEE_OFF (39UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ACCOUNT_FOR_FEE_OFF (40UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ALREADY_PROCESSED_OFF (41UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_BLOCKHASH_NOT_FOUND_OFF (42UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_PROGRAM_FOR_EXECUTION_OFF (43UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ADDRESS_LOOKUP_TABLE_NOT_FOUND_OFF (44UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ADDRESS_LOOKUP_TABLE_OWNER_OFF (45UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ADDRESS_LOOKUP_TABLE_DATA_OFF (46UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_ADDRESS_LOOKUP_TABLE_INDEX_OFF (47UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_MAX_LOADED_ACCOUNTS_DATA_SIZE_EXCEEDED_OFF (48UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_DUPLICATE_INSTRUCTION_OFF (49UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INVALID_LOADED_ACCOUNTS_DATA_SIZE_LIMIT_OFF (50UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_NONCE_ALREADY_ADVANCED_OFF (51UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_NONCE_ADVANCE_FAILED_OFF (52UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_NONCE_WRONG_BLOCKHASH_OFF (53UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ACCOUNT_IN_USE_OFF (54UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_ACCOUNT_LOADED_TWICE_OFF (55UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_SIGNATURE_FAILURE_OFF (56UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_TOO_MANY_ACCOUNT_LOCKS_OFF (57UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_INSUFFICIENT_FUNDS_FOR_RENT_OFF (58UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_UNBALANCED_TRANSACTION_OFF (59UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_RESULT_BUNDLE_PEER_OFF (60UL)
+
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_OFF  (61UL)
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_NAME "bankf_transaction_landed"
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_DESC "Whether a transaction landed in the block or not."
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_LANDED_SUCCESS_OFF (42UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_LANDED_FEES_ONLY_OFF (43UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_LANDED_FAILED_OFF (44UL)
-#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_UNLANDED_OFF (45UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_LANDED_SUCCESS_OFF (61UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_LANDED_FEES_ONLY_OFF (62UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_LANDED_FAILED_OFF (63UL)
+#define FD_METRICS_COUNTER_BANKF_TRANSACTION_LANDED_UNLANDED_OFF (64UL)
 
 #define FD_METRICS_BANKF_TOTAL (30UL)
 extern const fd_metrics_meta_t FD_METRICS_BANKF[FD_METRICS_BANKF_TOTAL];
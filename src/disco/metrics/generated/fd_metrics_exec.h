@@ -6,90 +6,90 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_EXEC_PROGCACHE_MISSES_OFF  (16UL)
+#define FD_METRICS_COUNTER_EXEC_PROGCACHE_MISSES_OFF  (35UL)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_MISSES_NAME "exec_progcache_misses"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_MISSES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_MISSES_DESC "Number of program cache misses"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_MISSES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_PROGCACHE_HITS_OFF  (17UL)
+#define FD_METRICS_COUNTER_EXEC_PROGCACHE_HITS_OFF  (36UL)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_HITS_NAME "exec_progcache_hits"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_HITS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_HITS_DESC "Number of program cache hits"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_HITS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILLS_OFF  (18UL)
+#define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILLS_OFF  (37UL)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILLS_NAME "exec_progcache_fills"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILLS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILLS_DESC "Number of program cache insertions"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILLS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_TOT_SZ_OFF  (19UL)
+#define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_TOT_SZ_OFF  (38UL)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_TOT_SZ_NAME "exec_progcache_fill_tot_sz"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_TOT_SZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_TOT_SZ_DESC "Total number of bytes inserted into program cache"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_TOT_SZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_FAILS_OFF  (20UL)
+#define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_FAILS_OFF  (39UL)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_FAILS_NAME "exec_progcache_fill_fails"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_FAILS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_FAILS_DESC "Number of program cache load fails (tombstones inserted)"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_FILL_FAILS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_PROGCACHE_DUP_INSERTS_OFF  (21UL)
+#define FD_METRICS_COUNTER_EXEC_PROGCACHE_DUP_INSERTS_OFF  (40UL)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_DUP_INSERTS_NAME "exec_progcache_dup_inserts"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_DUP_INSERTS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_DUP_INSERTS_DESC "Number of time two tiles raced to insert the same cache entry"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_DUP_INSERTS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_PROGCACHE_INVALIDATIONS_OFF  (22UL)
+#define FD_METRICS_COUNTER_EXEC_PROGCACHE_INVALIDATIONS_OFF  (41UL)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_INVALIDATIONS_NAME "exec_progcache_invalidations"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_INVALIDATIONS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_INVALIDATIONS_DESC "Number of program cache invalidations"
 #define FD_METRICS_COUNTER_EXEC_PROGCACHE_INVALIDATIONS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_ACCDB_CREATED_OFF  (23UL)
+#define FD_METRICS_COUNTER_EXEC_ACCDB_CREATED_OFF  (42UL)
 #define FD_METRICS_COUNTER_EXEC_ACCDB_CREATED_NAME "exec_accdb_created"
 #define FD_METRICS_COUNTER_EXEC_ACCDB_CREATED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_ACCDB_CREATED_DESC "Number of account database records created"
 #define FD_METRICS_COUNTER_EXEC_ACCDB_CREATED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_OFF  (24UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_OFF  (43UL)
 #define FD_METRICS_COUNTER_EXEC_TXN_REGIME_NAME "exec_txn_regime"
 #define FD_METRICS_COUNTER_EXEC_TXN_REGIME_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_TXN_REGIME_DESC "Mutually exclusive and exhaustive duration of time spent in transaction execution regimes."
 #define FD_METRICS_COUNTER_EXEC_TXN_REGIME_CVT  (FD_METRICS_CONVERTER_NANOSECONDS)
 #define FD_METRICS_COUNTER_EXEC_TXN_REGIME_CNT  (3UL)
 
-#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_SETUP_OFF (24UL)
-#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_EXEC_OFF (25UL)
-#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_COMMIT_OFF (26UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_SETUP_OFF (43UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_EXEC_OFF (44UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_REGIME_COMMIT_OFF (45UL)
 
-#define FD_METRICS_COUNTER_EXEC_VM_REGIME_OFF  (27UL)
+#define FD_METRICS_COUNTER_EXEC_VM_REGIME_OFF  (46UL)
 #define FD_METRICS_COUNTER_EXEC_VM_REGIME_NAME "exec_vm_regime"
 #define FD_METRICS_COUNTER_EXEC_VM_REGIME_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_VM_REGIME_DESC "Mutually exclusive and exhaustive duration of time spent in virtual machine execution regimes."
 #define FD_METRICS_COUNTER_EXEC_VM_REGIME_CVT  (FD_METRICS_CONVERTER_NANOSECONDS)
 #define FD_METRICS_COUNTER_EXEC_VM_REGIME_CNT  (5UL)
 
-#define FD_METRICS_COUNTER_EXEC_VM_REGIME_SETUP_OFF (27UL)
-#define FD_METRICS_COUNTER_EXEC_VM_REGIME_COMMIT_OFF (28UL)
-#define FD_METRICS_COUNTER_EXEC_VM_REGIME_SETUP_CPI_OFF (29UL)
-#define FD_METRICS_COUNTER_EXEC_VM_REGIME_COMMIT_CPI_OFF (30UL)
-#define FD_METRICS_COUNTER_EXEC_VM_REGIME_INTERPRETER_OFF (31UL)
+#define FD_METRICS_COUNTER_EXEC_VM_REGIME_SETUP_OFF (46UL)
+#define FD_METRICS_COUNTER_EXEC_VM_REGIME_COMMIT_OFF (47UL)
+#define FD_METRICS_COUNTER_EXEC_VM_REGIME_SETUP_CPI_OFF (48UL)
+#define FD_METRICS_COUNTER_EXEC_VM_REGIME_COMMIT_CPI_OFF (49UL)
+#define FD_METRICS_COUNTER_EXEC_VM_REGIME_INTERPRETER_OFF (50UL)
 
-#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_OFF  (32UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_OFF  (51UL)
 #define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_NAME "exec_txn_account_changes"
 #define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_DESC "Transaction account change event counters"
 #define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_CNT  (5UL)
 
-#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_UNCHANGED_NONEXIST_OFF (32UL)
-#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_CREATED_OFF (33UL)
-#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_DELETE_OFF (34UL)
-#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_MODIFY_OFF (35UL)
-#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_UNCHANGED_OFF (36UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_UNCHANGED_NONEXIST_OFF (51UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_CREATED_OFF (52UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_DELETE_OFF (53UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_MODIFY_OFF (54UL)
+#define FD_METRICS_COUNTER_EXEC_TXN_ACCOUNT_CHANGES_UNCHANGED_OFF (55UL)
 
 #define FD_METRICS_EXEC_TOTAL (21UL)
 extern const fd_metrics_meta_t FD_METRICS_EXEC[FD_METRICS_EXEC_TOTAL];
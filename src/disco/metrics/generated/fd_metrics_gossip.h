@@ -6,298 +6,298 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_CAPACITY_OFF  (16UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_CAPACITY_OFF  (35UL)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_CAPACITY_NAME "gossip_ping_tracker_capacity"
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_CAPACITY_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_CAPACITY_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_CAPACITY_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_OFF  (17UL)
+#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_OFF  (36UL)
 #define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_NAME "gossip_ping_tracker_count"
 #define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_CNT  (4UL)
 
-#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_UNPINGED_OFF (17UL)
-#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_INVALID_OFF (18UL)
-#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_VALID_OFF (19UL)
-#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_VALID_REFRESHING_OFF (20UL)
+#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_UNPINGED_OFF (36UL)
+#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_INVALID_OFF (37UL)
+#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_VALID_OFF (38UL)
+#define FD_METRICS_GAUGE_GOSSIP_PING_TRACKER_COUNT_VALID_REFRESHING_OFF (39UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_OFF  (21UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_OFF  (40UL)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_NAME "gossip_ping_tracker_pong_result"
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_CNT  (6UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_STAKED_OFF (21UL)
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_ENTRYPOINT_OFF (22UL)
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_UNTRACKED_OFF (23UL)
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_ADDRESS_OFF (24UL)
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_TOKEN_OFF (25UL)
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_SUCCESS_OFF (26UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_STAKED_OFF (40UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_ENTRYPOINT_OFF (41UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_UNTRACKED_OFF (42UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_ADDRESS_OFF (43UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_TOKEN_OFF (44UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_PONG_RESULT_SUCCESS_OFF (45UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_EVICTED_COUNT_OFF  (27UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_EVICTED_COUNT_OFF  (46UL)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_EVICTED_COUNT_NAME "gossip_ping_tracker_evicted_count"
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_EVICTED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_EVICTED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_EVICTED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKED_COUNT_OFF  (28UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKED_COUNT_OFF  (47UL)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKED_COUNT_NAME "gossip_ping_tracked_count"
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_STAKE_CHANGED_COUNT_OFF  (29UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_STAKE_CHANGED_COUNT_OFF  (48UL)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_STAKE_CHANGED_COUNT_NAME "gossip_ping_tracker_stake_changed_count"
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_STAKE_CHANGED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_STAKE_CHANGED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_STAKE_CHANGED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_ADDRESS_CHANGED_COUNT_OFF  (30UL)
+#define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_ADDRESS_CHANGED_COUNT_OFF  (49UL)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_ADDRESS_CHANGED_COUNT_NAME "gossip_ping_tracker_address_changed_count"
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_ADDRESS_CHANGED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_ADDRESS_CHANGED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_PING_TRACKER_ADDRESS_CHANGED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_CAPACITY_OFF  (31UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_CAPACITY_OFF  (50UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_CAPACITY_NAME "gossip_crds_capacity"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_CAPACITY_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_CAPACITY_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_CAPACITY_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_OFF  (32UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_OFF  (51UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_NAME "gossip_crds_count"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_CNT  (14UL)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_CONTACT_INFO_V1_OFF (32UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_VOTE_OFF (33UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_LOWEST_SLOT_OFF (34UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_SNAPSHOT_HASHES_OFF (35UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_ACCOUNTS_HASHES_OFF (36UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_EPOCH_SLOTS_OFF (37UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_VERSION_V1_OFF (38UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_VERSION_V2_OFF (39UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_NODE_INSTANCE_OFF (40UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_DUPLICATE_SHRED_OFF (41UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_INCREMENTAL_SNAPSHOT_HASHES_OFF (42UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_CONTACT_INFO_V2_OFF (43UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_RESTART_LAST_VOTED_FORK_SLOTS_OFF (44UL)
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_RESTART_HEAVIEST_FORK_OFF (45UL)
-
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_EXPIRED_COUNT_OFF  (46UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_CONTACT_INFO_V1_OFF (51UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_VOTE_OFF (52UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_LOWEST_SLOT_OFF (53UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_SNAPSHOT_HASHES_OFF (54UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_ACCOUNTS_HASHES_OFF (55UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_EPOCH_SLOTS_OFF (56UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_VERSION_V1_OFF (57UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_VERSION_V2_OFF (58UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_NODE_INSTANCE_OFF (59UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_DUPLICATE_SHRED_OFF (60UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_INCREMENTAL_SNAPSHOT_HASHES_OFF (61UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_CONTACT_INFO_V2_OFF (62UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_RESTART_LAST_VOTED_FORK_SLOTS_OFF (63UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_COUNT_RESTART_HEAVIEST_FORK_OFF (64UL)
+
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_EXPIRED_COUNT_OFF  (65UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EXPIRED_COUNT_NAME "gossip_crds_expired_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EXPIRED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EXPIRED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EXPIRED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_EVICTED_COUNT_OFF  (47UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_EVICTED_COUNT_OFF  (66UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EVICTED_COUNT_NAME "gossip_crds_evicted_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EVICTED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EVICTED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_EVICTED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_CAPACITY_OFF  (48UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_CAPACITY_OFF  (67UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_CAPACITY_NAME "gossip_crds_peer_capacity"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_CAPACITY_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_CAPACITY_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_CAPACITY_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_STAKED_COUNT_OFF  (49UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_STAKED_COUNT_OFF  (68UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_STAKED_COUNT_NAME "gossip_crds_peer_staked_count"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_STAKED_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_STAKED_COUNT_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_STAKED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_UNSTAKED_COUNT_OFF  (50UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_UNSTAKED_COUNT_OFF  (69UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_UNSTAKED_COUNT_NAME "gossip_crds_peer_unstaked_count"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_UNSTAKED_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_UNSTAKED_COUNT_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_UNSTAKED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_TOTAL_STAKE_OFF  (51UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_TOTAL_STAKE_OFF  (70UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_TOTAL_STAKE_NAME "gossip_crds_peer_total_stake"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_TOTAL_STAKE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_TOTAL_STAKE_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PEER_TOTAL_STAKE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_PEER_EVICTED_COUNT_OFF  (52UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_PEER_EVICTED_COUNT_OFF  (71UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PEER_EVICTED_COUNT_NAME "gossip_crds_peer_evicted_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PEER_EVICTED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PEER_EVICTED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PEER_EVICTED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_CAPACITY_OFF  (53UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_CAPACITY_OFF  (72UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_CAPACITY_NAME "gossip_crds_purged_capacity"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_CAPACITY_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_CAPACITY_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_CAPACITY_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_COUNT_OFF  (54UL)
+#define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_COUNT_OFF  (73UL)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_COUNT_NAME "gossip_crds_purged_count"
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_COUNT_DESC ""
 #define FD_METRICS_GAUGE_GOSSIP_CRDS_PURGED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EXPIRED_COUNT_OFF  (55UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EXPIRED_COUNT_OFF  (74UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EXPIRED_COUNT_NAME "gossip_crds_purged_expired_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EXPIRED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EXPIRED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EXPIRED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EVICTED_COUNT_OFF  (56UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EVICTED_COUNT_OFF  (75UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EVICTED_COUNT_NAME "gossip_crds_purged_evicted_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EVICTED_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EVICTED_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_PURGED_EVICTED_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_UNRECOGNIZED_SOCKET_TAGS_OFF  (57UL)
+#define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_UNRECOGNIZED_SOCKET_TAGS_OFF  (76UL)
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_UNRECOGNIZED_SOCKET_TAGS_NAME "gossip_contact_info_unrecognized_socket_tags"
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_UNRECOGNIZED_SOCKET_TAGS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_UNRECOGNIZED_SOCKET_TAGS_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_UNRECOGNIZED_SOCKET_TAGS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_IPV6_OFF  (58UL)
+#define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_IPV6_OFF  (77UL)
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_IPV6_NAME "gossip_contact_info_ipv6"
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_IPV6_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_IPV6_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CONTACT_INFO_IPV6_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_OFF  (59UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_OFF  (78UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_NAME "gossip_crds_rx_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_CNT  (7UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_UPSERTED_PULL_RESPONSE_OFF (59UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_UPSERTED_PUSH_OFF (60UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_STALE_OFF (61UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_WALLCLOCK_OFF (62UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_DUPLICATE_OFF (63UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PUSH_STALE_OFF (64UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PUSH_DUPLICATE_OFF (65UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_UPSERTED_PULL_RESPONSE_OFF (78UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_UPSERTED_PUSH_OFF (79UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_STALE_OFF (80UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_WALLCLOCK_OFF (81UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_DUPLICATE_OFF (82UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PUSH_STALE_OFF (83UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_RX_COUNT_DROPPED_PUSH_DUPLICATE_OFF (84UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_OFF  (66UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_OFF  (85UL)
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_NAME "gossip_message_tx_count"
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_CNT  (6UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PULL_REQUEST_OFF (66UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PULL_RESPONSE_OFF (67UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PUSH_OFF (68UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PRUNE_OFF (69UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PING_OFF (70UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PONG_OFF (71UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PULL_REQUEST_OFF (85UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PULL_RESPONSE_OFF (86UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PUSH_OFF (87UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PRUNE_OFF (88UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PING_OFF (89UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_COUNT_PONG_OFF (90UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_OFF  (72UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_OFF  (91UL)
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_NAME "gossip_message_tx_bytes"
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_CNT  (6UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PULL_REQUEST_OFF (72UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PULL_RESPONSE_OFF (73UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PUSH_OFF (74UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PRUNE_OFF (75UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PING_OFF (76UL)
-#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PONG_OFF (77UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PULL_REQUEST_OFF (91UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PULL_RESPONSE_OFF (92UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PUSH_OFF (93UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PRUNE_OFF (94UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PING_OFF (95UL)
+#define FD_METRICS_COUNTER_GOSSIP_MESSAGE_TX_BYTES_PONG_OFF (96UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_OFF  (78UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_OFF  (97UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_NAME "gossip_crds_tx_push_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_CNT  (14UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_CONTACT_INFO_V1_OFF (78UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_VOTE_OFF (79UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_LOWEST_SLOT_OFF (80UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_SNAPSHOT_HASHES_OFF (81UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_ACCOUNTS_HASHES_OFF (82UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_EPOCH_SLOTS_OFF (83UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_VERSION_V1_OFF (84UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_VERSION_V2_OFF (85UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_NODE_INSTANCE_OFF (86UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_DUPLICATE_SHRED_OFF (87UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_INCREMENTAL_SNAPSHOT_HASHES_OFF (88UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_CONTACT_INFO_V2_OFF (89UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_RESTART_LAST_VOTED_FORK_SLOTS_OFF (90UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_RESTART_HEAVIEST_FORK_OFF (91UL)
-
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_OFF  (92UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_CONTACT_INFO_V1_OFF (97UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_VOTE_OFF (98UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_LOWEST_SLOT_OFF (99UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_SNAPSHOT_HASHES_OFF (100UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_ACCOUNTS_HASHES_OFF (101UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_EPOCH_SLOTS_OFF (102UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_VERSION_V1_OFF (103UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_VERSION_V2_OFF (104UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_NODE_INSTANCE_OFF (105UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_DUPLICATE_SHRED_OFF (106UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_INCREMENTAL_SNAPSHOT_HASHES_OFF (107UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_CONTACT_INFO_V2_OFF (108UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_RESTART_LAST_VOTED_FORK_SLOTS_OFF (109UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_COUNT_RESTART_HEAVIEST_FORK_OFF (110UL)
+
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_OFF  (111UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_NAME "gossip_crds_tx_push_bytes"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_CNT  (14UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_CONTACT_INFO_V1_OFF (92UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_VOTE_OFF (93UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_LOWEST_SLOT_OFF (94UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_SNAPSHOT_HASHES_OFF (95UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_ACCOUNTS_HASHES_OFF (96UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_EPOCH_SLOTS_OFF (97UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_VERSION_V1_OFF (98UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_VERSION_V2_OFF (99UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_NODE_INSTANCE_OFF (100UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_DUPLICATE_SHRED_OFF (101UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_INCREMENTAL_SNAPSHOT_HASHES_OFF (102UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_CONTACT_INFO_V2_OFF (103UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_RESTART_LAST_VOTED_FORK_SLOTS_OFF (104UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_RESTART_HEAVIEST_FORK_OFF (105UL)
-
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_OFF  (106UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_CONTACT_INFO_V1_OFF (111UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_VOTE_OFF (112UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_LOWEST_SLOT_OFF (113UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_SNAPSHOT_HASHES_OFF (114UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_ACCOUNTS_HASHES_OFF (115UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_EPOCH_SLOTS_OFF (116UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_VERSION_V1_OFF (117UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_VERSION_V2_OFF (118UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_NODE_INSTANCE_OFF (119UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_DUPLICATE_SHRED_OFF (120UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_INCREMENTAL_SNAPSHOT_HASHES_OFF (121UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_CONTACT_INFO_V2_OFF (122UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_RESTART_LAST_VOTED_FORK_SLOTS_OFF (123UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PUSH_BYTES_RESTART_HEAVIEST_FORK_OFF (124UL)
+
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_OFF  (125UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_NAME "gossip_crds_tx_pull_response_count"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_CNT  (14UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_CONTACT_INFO_V1_OFF (106UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_VOTE_OFF (107UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_LOWEST_SLOT_OFF (108UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_SNAPSHOT_HASHES_OFF (109UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_ACCOUNTS_HASHES_OFF (110UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_EPOCH_SLOTS_OFF (111UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_VERSION_V1_OFF (112UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_VERSION_V2_OFF (113UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_NODE_INSTANCE_OFF (114UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_DUPLICATE_SHRED_OFF (115UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_INCREMENTAL_SNAPSHOT_HASHES_OFF (116UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_CONTACT_INFO_V2_OFF (117UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_RESTART_LAST_VOTED_FORK_SLOTS_OFF (118UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_RESTART_HEAVIEST_FORK_OFF (119UL)
-
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_OFF  (120UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_CONTACT_INFO_V1_OFF (125UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_VOTE_OFF (126UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_LOWEST_SLOT_OFF (127UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_SNAPSHOT_HASHES_OFF (128UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_ACCOUNTS_HASHES_OFF (129UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_EPOCH_SLOTS_OFF (130UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_VERSION_V1_OFF (131UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_VERSION_V2_OFF (132UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_NODE_INSTANCE_OFF (133UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_DUPLICATE_SHRED_OFF (134UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_INCREMENTAL_SNAPSHOT_HASHES_OFF (135UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_CONTACT_INFO_V2_OFF (136UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_RESTART_LAST_VOTED_FORK_SLOTS_OFF (137UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_COUNT_RESTART_HEAVIEST_FORK_OFF (138UL)
+
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_OFF  (139UL)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_NAME "gossip_crds_tx_pull_response_bytes"
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_DESC ""
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_CNT  (14UL)
 
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_CONTACT_INFO_V1_OFF (120UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_VOTE_OFF (121UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_LOWEST_SLOT_OFF (122UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_SNAPSHOT_HASHES_OFF (123UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_ACCOUNTS_HASHES_OFF (124UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_EPOCH_SLOTS_OFF (125UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_VERSION_V1_OFF (126UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_VERSION_V2_OFF (127UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_NODE_INSTANCE_OFF (128UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_DUPLICATE_SHRED_OFF (129UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_INCREMENTAL_SNAPSHOT_HASHES_OFF (130UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_CONTACT_INFO_V2_OFF (131UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_RESTART_LAST_VOTED_FORK_SLOTS_OFF (132UL)
-#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_RESTART_HEAVIEST_FORK_OFF (133UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_CONTACT_INFO_V1_OFF (139UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_VOTE_OFF (140UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_LOWEST_SLOT_OFF (141UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_SNAPSHOT_HASHES_OFF (142UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_ACCOUNTS_HASHES_OFF (143UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_EPOCH_SLOTS_OFF (144UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_VERSION_V1_OFF (145UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_VERSION_V2_OFF (146UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_NODE_INSTANCE_OFF (147UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_DUPLICATE_SHRED_OFF (148UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_INCREMENTAL_SNAPSHOT_HASHES_OFF (149UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_CONTACT_INFO_V2_OFF (150UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_RESTART_LAST_VOTED_FORK_SLOTS_OFF (151UL)
+#define FD_METRICS_COUNTER_GOSSIP_CRDS_TX_PULL_RESPONSE_BYTES_RESTART_HEAVIEST_FORK_OFF (152UL)
 
 #define FD_METRICS_GOSSIP_TOTAL (118UL)
 extern const fd_metrics_meta_t FD_METRICS_GOSSIP[FD_METRICS_GOSSIP_TOTAL];
@@ -6,101 +6,101 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_OFF  (16UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_OFF  (35UL)
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_NAME "gossvf_message_rx_count"
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_CNT  (20UL)
 
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PULL_REQUEST_OFF (16UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PULL_RESPONSE_OFF (17UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PUSH_OFF (18UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PRUNE_OFF (19UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PING_OFF (20UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PONG_OFF (21UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_UNPARSEABLE_OFF (22UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_NOT_CONTACT_INFO_OFF (23UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_LOOPBACK_OFF (24UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_INACTIVE_OFF (25UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_WALLCLOCK_OFF (26UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_SIGNATURE_OFF (27UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_SHRED_VERSION_OFF (28UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PRUNE_DESTINATION_OFF (29UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PRUNE_WALLCLOCK_OFF (30UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PRUNE_SIGNATURE_OFF (31UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PUSH_NO_VALID_CRDS_OFF (32UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_RESPONSE_NO_VALID_CRDS_OFF (33UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PING_SIGNATURE_OFF (34UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PONG_SIGNATURE_OFF (35UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PULL_REQUEST_OFF (35UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PULL_RESPONSE_OFF (36UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PUSH_OFF (37UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PRUNE_OFF (38UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PING_OFF (39UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_SUCCESS_PONG_OFF (40UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_UNPARSEABLE_OFF (41UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_NOT_CONTACT_INFO_OFF (42UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_LOOPBACK_OFF (43UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_INACTIVE_OFF (44UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_WALLCLOCK_OFF (45UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_SIGNATURE_OFF (46UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_REQUEST_SHRED_VERSION_OFF (47UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PRUNE_DESTINATION_OFF (48UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PRUNE_WALLCLOCK_OFF (49UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PRUNE_SIGNATURE_OFF (50UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PUSH_NO_VALID_CRDS_OFF (51UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PULL_RESPONSE_NO_VALID_CRDS_OFF (52UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PING_SIGNATURE_OFF (53UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_COUNT_DROPPED_PONG_SIGNATURE_OFF (54UL)
 
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_OFF  (36UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_OFF  (55UL)
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_NAME "gossvf_message_rx_bytes"
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DESC ""
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_CNT  (20UL)
 
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PULL_REQUEST_OFF (36UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PULL_RESPONSE_OFF (37UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PUSH_OFF (38UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PRUNE_OFF (39UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PING_OFF (40UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PONG_OFF (41UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_UNPARSEABLE_OFF (42UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_NOT_CONTACT_INFO_OFF (43UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_LOOPBACK_OFF (44UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_INACTIVE_OFF (45UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_WALLCLOCK_OFF (46UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_SIGNATURE_OFF (47UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_SHRED_VERSION_OFF (48UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PRUNE_DESTINATION_OFF (49UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PRUNE_WALLCLOCK_OFF (50UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PRUNE_SIGNATURE_OFF (51UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PUSH_NO_VALID_CRDS_OFF (52UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_RESPONSE_NO_VALID_CRDS_OFF (53UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PING_SIGNATURE_OFF (54UL)
-#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PONG_SIGNATURE_OFF (55UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PULL_REQUEST_OFF (55UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PULL_RESPONSE_OFF (56UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PUSH_OFF (57UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PRUNE_OFF (58UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PING_OFF (59UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_SUCCESS_PONG_OFF (60UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_UNPARSEABLE_OFF (61UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_NOT_CONTACT_INFO_OFF (62UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_LOOPBACK_OFF (63UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_INACTIVE_OFF (64UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_WALLCLOCK_OFF (65UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_SIGNATURE_OFF (66UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_REQUEST_SHRED_VERSION_OFF (67UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PRUNE_DESTINATION_OFF (68UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PRUNE_WALLCLOCK_OFF (69UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PRUNE_SIGNATURE_OFF (70UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PUSH_NO_VALID_CRDS_OFF (71UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PULL_RESPONSE_NO_VALID_CRDS_OFF (72UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PING_SIGNATURE_OFF (73UL)
+#define FD_METRICS_COUNTER_GOSSVF_MESSAGE_RX_BYTES_DROPPED_PONG_SIGNATURE_OFF (74UL)
 
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_OFF  (56UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_OFF  (75UL)
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_NAME "gossvf_crds_rx_count"
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DESC ""
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_CNT  (12UL)
 
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_SUCCESS_PULL_RESPONSE_OFF (56UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_SUCCESS_PUSH_OFF (57UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_DUPLICATE_OFF (58UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_SIGNATURE_OFF (59UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_ORIGIN_NO_CONTACT_INFO_OFF (60UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_ORIGIN_SHRED_VERSION_OFF (61UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_INACTIVE_OFF (62UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_SIGNATURE_OFF (63UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_ORIGIN_NO_CONTACT_INFO_OFF (64UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_ORIGIN_SHRED_VERSION_OFF (65UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_INACTIVE_OFF (66UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_WALLCLOCK_OFF (67UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_SUCCESS_PULL_RESPONSE_OFF (75UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_SUCCESS_PUSH_OFF (76UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_DUPLICATE_OFF (77UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_SIGNATURE_OFF (78UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_ORIGIN_NO_CONTACT_INFO_OFF (79UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_ORIGIN_SHRED_VERSION_OFF (80UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PULL_RESPONSE_INACTIVE_OFF (81UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_SIGNATURE_OFF (82UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_ORIGIN_NO_CONTACT_INFO_OFF (83UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_ORIGIN_SHRED_VERSION_OFF (84UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_INACTIVE_OFF (85UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_COUNT_DROPPED_PUSH_WALLCLOCK_OFF (86UL)
 
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_OFF  (68UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_OFF  (87UL)
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_NAME "gossvf_crds_rx_bytes"
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DESC ""
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_CNT  (12UL)
 
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_SUCCESS_PULL_RESPONSE_OFF (68UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_SUCCESS_PUSH_OFF (69UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_DUPLICATE_OFF (70UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_SIGNATURE_OFF (71UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_ORIGIN_NO_CONTACT_INFO_OFF (72UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_ORIGIN_SHRED_VERSION_OFF (73UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_INACTIVE_OFF (74UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_SIGNATURE_OFF (75UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_ORIGIN_NO_CONTACT_INFO_OFF (76UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_ORIGIN_SHRED_VERSION_OFF (77UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_INACTIVE_OFF (78UL)
-#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_WALLCLOCK_OFF (79UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_SUCCESS_PULL_RESPONSE_OFF (87UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_SUCCESS_PUSH_OFF (88UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_DUPLICATE_OFF (89UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_SIGNATURE_OFF (90UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_ORIGIN_NO_CONTACT_INFO_OFF (91UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_ORIGIN_SHRED_VERSION_OFF (92UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PULL_RESPONSE_INACTIVE_OFF (93UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_SIGNATURE_OFF (94UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_ORIGIN_NO_CONTACT_INFO_OFF (95UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_ORIGIN_SHRED_VERSION_OFF (96UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_INACTIVE_OFF (97UL)
+#define FD_METRICS_COUNTER_GOSSVF_CRDS_RX_BYTES_DROPPED_PUSH_WALLCLOCK_OFF (98UL)
 
 #define FD_METRICS_GOSSVF_TOTAL (64UL)
 extern const fd_metrics_meta_t FD_METRICS_GOSSVF[FD_METRICS_GOSSVF_TOTAL];
@@ -6,37 +6,37 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_GUI_CONNECTION_COUNT_OFF  (16UL)
+#define FD_METRICS_GAUGE_GUI_CONNECTION_COUNT_OFF  (35UL)
 #define FD_METRICS_GAUGE_GUI_CONNECTION_COUNT_NAME "gui_connection_count"
 #define FD_METRICS_GAUGE_GUI_CONNECTION_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GUI_CONNECTION_COUNT_DESC "The number of active http connections to the GUI service, excluding connections that have been upgraded to a WebSocket connection"
 #define FD_METRICS_GAUGE_GUI_CONNECTION_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_GUI_WEBSOCKET_CONNECTION_COUNT_OFF  (17UL)
+#define FD_METRICS_GAUGE_GUI_WEBSOCKET_CONNECTION_COUNT_OFF  (36UL)
 #define FD_METRICS_GAUGE_GUI_WEBSOCKET_CONNECTION_COUNT_NAME "gui_websocket_connection_count"
 #define FD_METRICS_GAUGE_GUI_WEBSOCKET_CONNECTION_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_GUI_WEBSOCKET_CONNECTION_COUNT_DESC "The number of active websocket connections to the GUI service"
 #define FD_METRICS_GAUGE_GUI_WEBSOCKET_CONNECTION_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_SENT_OFF  (18UL)
+#define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_SENT_OFF  (37UL)
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_SENT_NAME "gui_websocket_frames_sent"
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_SENT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_SENT_DESC "The total number of websocket frames sent to all connections to the GUI service"
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_SENT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_RECEIVED_OFF  (19UL)
+#define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_RECEIVED_OFF  (38UL)
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_RECEIVED_NAME "gui_websocket_frames_received"
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_RECEIVED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_RECEIVED_DESC "The total number of websocket frames received from all connections to the GUI service"
 #define FD_METRICS_COUNTER_GUI_WEBSOCKET_FRAMES_RECEIVED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GUI_BYTES_WRITTEN_OFF  (20UL)
+#define FD_METRICS_COUNTER_GUI_BYTES_WRITTEN_OFF  (39UL)
 #define FD_METRICS_COUNTER_GUI_BYTES_WRITTEN_NAME "gui_bytes_written"
 #define FD_METRICS_COUNTER_GUI_BYTES_WRITTEN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GUI_BYTES_WRITTEN_DESC "The total number of bytes written to all connections to the GUI service"
 #define FD_METRICS_COUNTER_GUI_BYTES_WRITTEN_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_GUI_BYTES_READ_OFF  (21UL)
+#define FD_METRICS_COUNTER_GUI_BYTES_READ_OFF  (40UL)
 #define FD_METRICS_COUNTER_GUI_BYTES_READ_NAME "gui_bytes_read"
 #define FD_METRICS_COUNTER_GUI_BYTES_READ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_GUI_BYTES_READ_DESC "The total number of bytes read from all connections to the GUI service"
@@ -6,37 +6,37 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_IPECHO_SHRED_VERSION_OFF  (16UL)
+#define FD_METRICS_GAUGE_IPECHO_SHRED_VERSION_OFF  (35UL)
 #define FD_METRICS_GAUGE_IPECHO_SHRED_VERSION_NAME "ipecho_shred_version"
 #define FD_METRICS_GAUGE_IPECHO_SHRED_VERSION_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_IPECHO_SHRED_VERSION_DESC "The current shred version used by the validator"
 #define FD_METRICS_GAUGE_IPECHO_SHRED_VERSION_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_IPECHO_CONNECTION_COUNT_OFF  (17UL)
+#define FD_METRICS_GAUGE_IPECHO_CONNECTION_COUNT_OFF  (36UL)
 #define FD_METRICS_GAUGE_IPECHO_CONNECTION_COUNT_NAME "ipecho_connection_count"
 #define FD_METRICS_GAUGE_IPECHO_CONNECTION_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_IPECHO_CONNECTION_COUNT_DESC "The number of active connections to the ipecho service"
 #define FD_METRICS_GAUGE_IPECHO_CONNECTION_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_OK_OFF  (18UL)
+#define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_OK_OFF  (37UL)
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_OK_NAME "ipecho_connections_closed_ok"
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_OK_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_OK_DESC "The number of connections to the ipecho service that have been made and closed normally"
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_OK_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_ERROR_OFF  (19UL)
+#define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_ERROR_OFF  (38UL)
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_ERROR_NAME "ipecho_connections_closed_error"
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_ERROR_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_ERROR_DESC "The number of connections to the ipecho service that have been made and closed abnormally"
 #define FD_METRICS_COUNTER_IPECHO_CONNECTIONS_CLOSED_ERROR_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_IPECHO_BYTES_READ_OFF  (20UL)
+#define FD_METRICS_COUNTER_IPECHO_BYTES_READ_OFF  (39UL)
 #define FD_METRICS_COUNTER_IPECHO_BYTES_READ_NAME "ipecho_bytes_read"
 #define FD_METRICS_COUNTER_IPECHO_BYTES_READ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_IPECHO_BYTES_READ_DESC "The total number of bytes read from all connections to the ipecho service"
 #define FD_METRICS_COUNTER_IPECHO_BYTES_READ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_IPECHO_BYTES_WRITTEN_OFF  (21UL)
+#define FD_METRICS_COUNTER_IPECHO_BYTES_WRITTEN_OFF  (40UL)
 #define FD_METRICS_COUNTER_IPECHO_BYTES_WRITTEN_NAME "ipecho_bytes_written"
 #define FD_METRICS_COUNTER_IPECHO_BYTES_WRITTEN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_IPECHO_BYTES_WRITTEN_DESC "The total number of bytes written to all connections to the ipecho service"
@@ -6,25 +6,25 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_OFF  (16UL)
+#define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_OFF  (35UL)
 #define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_NAME "metric_boot_timestamp_nanos"
 #define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_DESC "Timestamp when validator was started (nanoseconds since epoch)"
 #define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_METRIC_CONNECTION_COUNT_OFF  (17UL)
+#define FD_METRICS_GAUGE_METRIC_CONNECTION_COUNT_OFF  (36UL)
 #define FD_METRICS_GAUGE_METRIC_CONNECTION_COUNT_NAME "metric_connection_count"
 #define FD_METRICS_GAUGE_METRIC_CONNECTION_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_METRIC_CONNECTION_COUNT_DESC "The number of active http connections to the Prometheus endpoint"
 #define FD_METRICS_GAUGE_METRIC_CONNECTION_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_METRIC_BYTES_WRITTEN_OFF  (18UL)
+#define FD_METRICS_COUNTER_METRIC_BYTES_WRITTEN_OFF  (37UL)
 #define FD_METRICS_COUNTER_METRIC_BYTES_WRITTEN_NAME "metric_bytes_written"
 #define FD_METRICS_COUNTER_METRIC_BYTES_WRITTEN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_METRIC_BYTES_WRITTEN_DESC "The total number of bytes written to all responses on the Prometheus endpoint"
 #define FD_METRICS_COUNTER_METRIC_BYTES_WRITTEN_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_METRIC_BYTES_READ_OFF  (19UL)
+#define FD_METRICS_COUNTER_METRIC_BYTES_READ_OFF  (38UL)
 #define FD_METRICS_COUNTER_METRIC_BYTES_READ_NAME "metric_bytes_read"
 #define FD_METRICS_COUNTER_METRIC_BYTES_READ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_METRIC_BYTES_READ_DESC "The total number of bytes read from all requests to the Prometheus endpoint"
@@ -6,70 +6,70 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_NETLNK_DROP_EVENTS_OFF  (16UL)
+#define FD_METRICS_COUNTER_NETLNK_DROP_EVENTS_OFF  (35UL)
 #define FD_METRICS_COUNTER_NETLNK_DROP_EVENTS_NAME "netlnk_drop_events"
 #define FD_METRICS_COUNTER_NETLNK_DROP_EVENTS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_DROP_EVENTS_DESC "Number of netlink drop events caught"
 #define FD_METRICS_COUNTER_NETLNK_DROP_EVENTS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_NETLNK_LINK_FULL_SYNCS_OFF  (17UL)
+#define FD_METRICS_COUNTER_NETLNK_LINK_FULL_SYNCS_OFF  (36UL)
 #define FD_METRICS_COUNTER_NETLNK_LINK_FULL_SYNCS_NAME "netlnk_link_full_syncs"
 #define FD_METRICS_COUNTER_NETLNK_LINK_FULL_SYNCS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_LINK_FULL_SYNCS_DESC "Number of full link table syncs done"
 #define FD_METRICS_COUNTER_NETLNK_LINK_FULL_SYNCS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_NETLNK_ROUTE_FULL_SYNCS_OFF  (18UL)
+#define FD_METRICS_COUNTER_NETLNK_ROUTE_FULL_SYNCS_OFF  (37UL)
 #define FD_METRICS_COUNTER_NETLNK_ROUTE_FULL_SYNCS_NAME "netlnk_route_full_syncs"
 #define FD_METRICS_COUNTER_NETLNK_ROUTE_FULL_SYNCS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_ROUTE_FULL_SYNCS_DESC "Number of full route table syncs done"
 #define FD_METRICS_COUNTER_NETLNK_ROUTE_FULL_SYNCS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_NETLNK_UPDATES_OFF  (19UL)
+#define FD_METRICS_COUNTER_NETLNK_UPDATES_OFF  (38UL)
 #define FD_METRICS_COUNTER_NETLNK_UPDATES_NAME "netlnk_updates"
 #define FD_METRICS_COUNTER_NETLNK_UPDATES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_UPDATES_DESC "Number of netlink live updates processed"
 #define FD_METRICS_COUNTER_NETLNK_UPDATES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_NETLNK_UPDATES_CNT  (3UL)
 
-#define FD_METRICS_COUNTER_NETLNK_UPDATES_LINK_OFF (19UL)
-#define FD_METRICS_COUNTER_NETLNK_UPDATES_NEIGH_OFF (20UL)
-#define FD_METRICS_COUNTER_NETLNK_UPDATES_IPV4_ROUTE_OFF (21UL)
+#define FD_METRICS_COUNTER_NETLNK_UPDATES_LINK_OFF (38UL)
+#define FD_METRICS_COUNTER_NETLNK_UPDATES_NEIGH_OFF (39UL)
+#define FD_METRICS_COUNTER_NETLNK_UPDATES_IPV4_ROUTE_OFF (40UL)
 
-#define FD_METRICS_GAUGE_NETLNK_INTERFACE_COUNT_OFF  (22UL)
+#define FD_METRICS_GAUGE_NETLNK_INTERFACE_COUNT_OFF  (41UL)
 #define FD_METRICS_GAUGE_NETLNK_INTERFACE_COUNT_NAME "netlnk_interface_count"
 #define FD_METRICS_GAUGE_NETLNK_INTERFACE_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_NETLNK_INTERFACE_COUNT_DESC "Number of network interfaces"
 #define FD_METRICS_GAUGE_NETLNK_INTERFACE_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_OFF  (23UL)
+#define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_OFF  (42UL)
 #define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_NAME "netlnk_route_count"
 #define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_DESC "Number of IPv4 routes"
 #define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_CNT  (2UL)
 
-#define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_LOCAL_OFF (23UL)
-#define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_MAIN_OFF (24UL)
+#define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_LOCAL_OFF (42UL)
+#define FD_METRICS_GAUGE_NETLNK_ROUTE_COUNT_MAIN_OFF (43UL)
 
-#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_SENT_OFF  (25UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_SENT_OFF  (44UL)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_SENT_NAME "netlnk_neigh_probe_sent"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_SENT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_SENT_DESC "Number of neighbor solicit requests sent to kernel"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_SENT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_FAILS_OFF  (26UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_FAILS_OFF  (45UL)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_FAILS_NAME "netlnk_neigh_probe_fails"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_FAILS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_FAILS_DESC "Number of neighbor solicit requests that failed to send (kernel too slow)"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_FAILS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_HOST_OFF  (27UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_HOST_OFF  (46UL)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_HOST_NAME "netlnk_neigh_probe_rate_limit_host"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_HOST_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_HOST_DESC "Number of neighbor solicit that exceeded the per-host rate limit"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_HOST_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL_OFF  (28UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL_OFF  (47UL)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL_NAME "netlnk_neigh_probe_rate_limit_global"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL_DESC "Number of neighbor solicit that exceeded the global rate limit"
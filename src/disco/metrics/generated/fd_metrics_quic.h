@@ -6,279 +6,279 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_QUIC_TXNS_OVERRUN_OFF  (16UL)
+#define FD_METRICS_COUNTER_QUIC_TXNS_OVERRUN_OFF  (35UL)
 #define FD_METRICS_COUNTER_QUIC_TXNS_OVERRUN_NAME "quic_txns_overrun"
 #define FD_METRICS_COUNTER_QUIC_TXNS_OVERRUN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_TXNS_OVERRUN_DESC "Count of txns overrun before reassembled (too small txn_reassembly_count)."
 #define FD_METRICS_COUNTER_QUIC_TXNS_OVERRUN_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_TXN_REASMS_STARTED_OFF  (17UL)
+#define FD_METRICS_COUNTER_QUIC_TXN_REASMS_STARTED_OFF  (36UL)
 #define FD_METRICS_COUNTER_QUIC_TXN_REASMS_STARTED_NAME "quic_txn_reasms_started"
 #define FD_METRICS_COUNTER_QUIC_TXN_REASMS_STARTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_TXN_REASMS_STARTED_DESC "Count of fragmented txn receive ops started."
 #define FD_METRICS_COUNTER_QUIC_TXN_REASMS_STARTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_QUIC_TXN_REASMS_ACTIVE_OFF  (18UL)
+#define FD_METRICS_GAUGE_QUIC_TXN_REASMS_ACTIVE_OFF  (37UL)
 #define FD_METRICS_GAUGE_QUIC_TXN_REASMS_ACTIVE_NAME "quic_txn_reasms_active"
 #define FD_METRICS_GAUGE_QUIC_TXN_REASMS_ACTIVE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_QUIC_TXN_REASMS_ACTIVE_DESC "Number of fragmented txn receive ops currently active."
 #define FD_METRICS_GAUGE_QUIC_TXN_REASMS_ACTIVE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_FRAGS_OK_OFF  (19UL)
+#define FD_METRICS_COUNTER_QUIC_FRAGS_OK_OFF  (38UL)
 #define FD_METRICS_COUNTER_QUIC_FRAGS_OK_NAME "quic_frags_ok"
 #define FD_METRICS_COUNTER_QUIC_FRAGS_OK_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_FRAGS_OK_DESC "Count of txn frags received"
 #define FD_METRICS_COUNTER_QUIC_FRAGS_OK_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_FRAGS_GAP_OFF  (20UL)
+#define FD_METRICS_COUNTER_QUIC_FRAGS_GAP_OFF  (39UL)
 #define FD_METRICS_COUNTER_QUIC_FRAGS_GAP_NAME "quic_frags_gap"
 #define FD_METRICS_COUNTER_QUIC_FRAGS_GAP_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_FRAGS_GAP_DESC "Count of txn frags dropped due to data gap"
 #define FD_METRICS_COUNTER_QUIC_FRAGS_GAP_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_FRAGS_DUP_OFF  (21UL)
+#define FD_METRICS_COUNTER_QUIC_FRAGS_DUP_OFF  (40UL)
 #define FD_METRICS_COUNTER_QUIC_FRAGS_DUP_NAME "quic_frags_dup"
 #define FD_METRICS_COUNTER_QUIC_FRAGS_DUP_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_FRAGS_DUP_DESC "Count of txn frags dropped due to dup (stream already completed)"
 #define FD_METRICS_COUNTER_QUIC_FRAGS_DUP_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_OFF  (22UL)
+#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_OFF  (41UL)
 #define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_NAME "quic_txns_received"
 #define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_DESC "Count of txns received via TPU."
 #define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_CNT  (3UL)
 
-#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_UDP_OFF (22UL)
-#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_QUIC_FAST_OFF (23UL)
-#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_QUIC_FRAG_OFF (24UL)
+#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_UDP_OFF (41UL)
+#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_QUIC_FAST_OFF (42UL)
+#define FD_METRICS_COUNTER_QUIC_TXNS_RECEIVED_QUIC_FRAG_OFF (43UL)
 
-#define FD_METRICS_COUNTER_QUIC_TXNS_ABANDONED_OFF  (25UL)
+#define FD_METRICS_COUNTER_QUIC_TXNS_ABANDONED_OFF  (44UL)
 #define FD_METRICS_COUNTER_QUIC_TXNS_ABANDONED_NAME "quic_txns_abandoned"
 #define FD_METRICS_COUNTER_QUIC_TXNS_ABANDONED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_TXNS_ABANDONED_DESC "Count of txns abandoned because a conn was lost."
 #define FD_METRICS_COUNTER_QUIC_TXNS_ABANDONED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_TXN_UNDERSZ_OFF  (26UL)
+#define FD_METRICS_COUNTER_QUIC_TXN_UNDERSZ_OFF  (45UL)
 #define FD_METRICS_COUNTER_QUIC_TXN_UNDERSZ_NAME "quic_txn_undersz"
 #define FD_METRICS_COUNTER_QUIC_TXN_UNDERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_TXN_UNDERSZ_DESC "Count of txns received via QUIC dropped because they were too small."
 #define FD_METRICS_COUNTER_QUIC_TXN_UNDERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_TXN_OVERSZ_OFF  (27UL)
+#define FD_METRICS_COUNTER_QUIC_TXN_OVERSZ_OFF  (46UL)
 #define FD_METRICS_COUNTER_QUIC_TXN_OVERSZ_NAME "quic_txn_oversz"
 #define FD_METRICS_COUNTER_QUIC_TXN_OVERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_TXN_OVERSZ_DESC "Count of txns received via QUIC dropped because they were too large."
 #define FD_METRICS_COUNTER_QUIC_TXN_OVERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_UNDERSZ_OFF  (28UL)
+#define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_UNDERSZ_OFF  (47UL)
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_UNDERSZ_NAME "quic_legacy_txn_undersz"
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_UNDERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_UNDERSZ_DESC "Count of packets received on the non-QUIC port that were too small to be a valid IP packet."
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_UNDERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_OVERSZ_OFF  (29UL)
+#define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_OVERSZ_OFF  (48UL)
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_OVERSZ_NAME "quic_legacy_txn_oversz"
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_OVERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_OVERSZ_DESC "Count of packets received on the non-QUIC port that were too large to be a valid transaction."
 #define FD_METRICS_COUNTER_QUIC_LEGACY_TXN_OVERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_PACKETS_OFF  (30UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_PACKETS_OFF  (49UL)
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_PACKETS_NAME "quic_received_packets"
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_PACKETS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_PACKETS_DESC "Number of IP packets received."
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_PACKETS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_BYTES_OFF  (31UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_BYTES_OFF  (50UL)
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_BYTES_NAME "quic_received_bytes"
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_BYTES_DESC "Total bytes received (including IP, UDP, QUIC headers)."
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_SENT_PACKETS_OFF  (32UL)
+#define FD_METRICS_COUNTER_QUIC_SENT_PACKETS_OFF  (51UL)
 #define FD_METRICS_COUNTER_QUIC_SENT_PACKETS_NAME "quic_sent_packets"
 #define FD_METRICS_COUNTER_QUIC_SENT_PACKETS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_SENT_PACKETS_DESC "Number of IP packets sent."
 #define FD_METRICS_COUNTER_QUIC_SENT_PACKETS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_SENT_BYTES_OFF  (33UL)
+#define FD_METRICS_COUNTER_QUIC_SENT_BYTES_OFF  (52UL)
 #define FD_METRICS_COUNTER_QUIC_SENT_BYTES_NAME "quic_sent_bytes"
 #define FD_METRICS_COUNTER_QUIC_SENT_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_SENT_BYTES_DESC "Total bytes sent (including IP, UDP, QUIC headers)."
 #define FD_METRICS_COUNTER_QUIC_SENT_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_ALLOC_OFF  (34UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_ALLOC_OFF  (53UL)
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_ALLOC_NAME "quic_connections_alloc"
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_ALLOC_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_ALLOC_DESC "The number of currently allocated QUIC connections."
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_ALLOC_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_OFF  (35UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_OFF  (54UL)
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_NAME "quic_connections_state"
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_DESC "The number of QUIC connections in each state."
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_CNT  (8UL)
 
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_INVALID_OFF (35UL)
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_HANDSHAKE_OFF (36UL)
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_HANDSHAKE_COMPLETE_OFF (37UL)
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_ACTIVE_OFF (38UL)
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_PEER_CLOSE_OFF (39UL)
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_ABORT_OFF (40UL)
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_CLOSE_PENDING_OFF (41UL)
-#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_DEAD_OFF (42UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_INVALID_OFF (54UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_HANDSHAKE_OFF (55UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_HANDSHAKE_COMPLETE_OFF (56UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_ACTIVE_OFF (57UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_PEER_CLOSE_OFF (58UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_ABORT_OFF (59UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_CLOSE_PENDING_OFF (60UL)
+#define FD_METRICS_GAUGE_QUIC_CONNECTIONS_STATE_DEAD_OFF (61UL)
 
-#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CREATED_OFF  (43UL)
+#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CREATED_OFF  (62UL)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CREATED_NAME "quic_connections_created"
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CREATED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CREATED_DESC "The total number of connections that have been created."
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CREATED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CLOSED_OFF  (44UL)
+#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CLOSED_OFF  (63UL)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CLOSED_NAME "quic_connections_closed"
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CLOSED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CLOSED_DESC "Number of connections gracefully closed."
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_CLOSED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_ABORTED_OFF  (45UL)
+#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_ABORTED_OFF  (64UL)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_ABORTED_NAME "quic_connections_aborted"
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_ABORTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_ABORTED_DESC "Number of connections aborted."
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_ABORTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_TIMED_OUT_OFF  (46UL)
+#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_TIMED_OUT_OFF  (65UL)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_TIMED_OUT_NAME "quic_connections_timed_out"
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_TIMED_OUT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_TIMED_OUT_DESC "Number of connections timed out."
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_TIMED_OUT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_RETRIED_OFF  (47UL)
+#define FD_METRICS_COUNTER_QUIC_CONNECTIONS_RETRIED_OFF  (66UL)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_RETRIED_NAME "quic_connections_retried"
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_RETRIED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_RETRIED_DESC "Number of connections established with retry."
 #define FD_METRICS_COUNTER_QUIC_CONNECTIONS_RETRIED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_NO_SLOTS_OFF  (48UL)
+#define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_NO_SLOTS_OFF  (67UL)
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_NO_SLOTS_NAME "quic_connection_error_no_slots"
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_NO_SLOTS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_NO_SLOTS_DESC "Number of connections that failed to create due to lack of slots."
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_NO_SLOTS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_RETRY_FAIL_OFF  (49UL)
+#define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_RETRY_FAIL_OFF  (68UL)
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_RETRY_FAIL_NAME "quic_connection_error_retry_fail"
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_RETRY_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_RETRY_FAIL_DESC "Number of connections that failed during retry (e.g. invalid token)."
 #define FD_METRICS_COUNTER_QUIC_CONNECTION_ERROR_RETRY_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_OFF  (50UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_OFF  (69UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_NAME "quic_pkt_no_conn"
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_DESC "Number of packets with an unknown connection ID."
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_INITIAL_OFF (50UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_RETRY_OFF (51UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_HANDSHAKE_OFF (52UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_ONE_RTT_OFF (53UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_INITIAL_OFF (69UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_RETRY_OFF (70UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_HANDSHAKE_OFF (71UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_CONN_ONE_RTT_OFF (72UL)
 
-#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_OFF  (54UL)
+#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_OFF  (73UL)
 #define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_NAME "quic_frame_tx_alloc"
 #define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_DESC "Results of attempts to acquire QUIC frame metadata."
 #define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_CNT  (3UL)
 
-#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_SUCCESS_OFF (54UL)
-#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_FAIL_EMPTY_POOL_OFF (55UL)
-#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_FAIL_CONN_MAX_OFF (56UL)
+#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_SUCCESS_OFF (73UL)
+#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_FAIL_EMPTY_POOL_OFF (74UL)
+#define FD_METRICS_COUNTER_QUIC_FRAME_TX_ALLOC_FAIL_CONN_MAX_OFF (75UL)
 
-#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_OFF  (57UL)
+#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_OFF  (76UL)
 #define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_NAME "quic_initial_token_len"
 #define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_DESC "Number of Initial packets grouped by token length."
 #define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_CNT  (3UL)
 
-#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_ZERO_OFF (57UL)
-#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_FD_QUIC_LEN_OFF (58UL)
-#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_INVALID_LEN_OFF (59UL)
+#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_ZERO_OFF (76UL)
+#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_FD_QUIC_LEN_OFF (77UL)
+#define FD_METRICS_COUNTER_QUIC_INITIAL_TOKEN_LEN_INVALID_LEN_OFF (78UL)
 
-#define FD_METRICS_COUNTER_QUIC_HANDSHAKES_CREATED_OFF  (60UL)
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKES_CREATED_OFF  (79UL)
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKES_CREATED_NAME "quic_handshakes_created"
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKES_CREATED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKES_CREATED_DESC "Number of handshake flows created."
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKES_CREATED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_ERROR_ALLOC_FAIL_OFF  (61UL)
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_ERROR_ALLOC_FAIL_OFF  (80UL)
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_ERROR_ALLOC_FAIL_NAME "quic_handshake_error_alloc_fail"
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_ERROR_ALLOC_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_ERROR_ALLOC_FAIL_DESC "Number of handshakes dropped due to alloc fail."
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_ERROR_ALLOC_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_EVICTED_OFF  (62UL)
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_EVICTED_OFF  (81UL)
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_EVICTED_NAME "quic_handshake_evicted"
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_EVICTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_EVICTED_DESC "Number of handshakes dropped due to eviction."
 #define FD_METRICS_COUNTER_QUIC_HANDSHAKE_EVICTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_EVENTS_OFF  (63UL)
+#define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_EVENTS_OFF  (82UL)
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_EVENTS_NAME "quic_stream_received_events"
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_EVENTS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_EVENTS_DESC "Number of stream RX events."
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_EVENTS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_BYTES_OFF  (64UL)
+#define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_BYTES_OFF  (83UL)
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_BYTES_NAME "quic_stream_received_bytes"
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_BYTES_DESC "Total stream payload bytes received."
 #define FD_METRICS_COUNTER_QUIC_STREAM_RECEIVED_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_OFF  (65UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_OFF  (84UL)
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_NAME "quic_received_frames"
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_DESC "Number of QUIC frames received."
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CNT  (22UL)
 
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_UNKNOWN_OFF (65UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_ACK_OFF (66UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_RESET_STREAM_OFF (67UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STOP_SENDING_OFF (68UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CRYPTO_OFF (69UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_NEW_TOKEN_OFF (70UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STREAM_OFF (71UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_MAX_DATA_OFF (72UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_MAX_STREAM_DATA_OFF (73UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_MAX_STREAMS_OFF (74UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_DATA_BLOCKED_OFF (75UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STREAM_DATA_BLOCKED_OFF (76UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STREAMS_BLOCKED_OFF (77UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_NEW_CONN_ID_OFF (78UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_RETIRE_CONN_ID_OFF (79UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PATH_CHALLENGE_OFF (80UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PATH_RESPONSE_OFF (81UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CONN_CLOSE_QUIC_OFF (82UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CONN_CLOSE_APP_OFF (83UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_HANDSHAKE_DONE_OFF (84UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PING_OFF (85UL)
-#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PADDING_OFF (86UL)
-
-#define FD_METRICS_COUNTER_QUIC_ACK_TX_OFF  (87UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_UNKNOWN_OFF (84UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_ACK_OFF (85UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_RESET_STREAM_OFF (86UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STOP_SENDING_OFF (87UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CRYPTO_OFF (88UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_NEW_TOKEN_OFF (89UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STREAM_OFF (90UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_MAX_DATA_OFF (91UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_MAX_STREAM_DATA_OFF (92UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_MAX_STREAMS_OFF (93UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_DATA_BLOCKED_OFF (94UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STREAM_DATA_BLOCKED_OFF (95UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_STREAMS_BLOCKED_OFF (96UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_NEW_CONN_ID_OFF (97UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_RETIRE_CONN_ID_OFF (98UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PATH_CHALLENGE_OFF (99UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PATH_RESPONSE_OFF (100UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CONN_CLOSE_QUIC_OFF (101UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_CONN_CLOSE_APP_OFF (102UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_HANDSHAKE_DONE_OFF (103UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PING_OFF (104UL)
+#define FD_METRICS_COUNTER_QUIC_RECEIVED_FRAMES_PADDING_OFF (105UL)
+
+#define FD_METRICS_COUNTER_QUIC_ACK_TX_OFF  (106UL)
 #define FD_METRICS_COUNTER_QUIC_ACK_TX_NAME "quic_ack_tx"
 #define FD_METRICS_COUNTER_QUIC_ACK_TX_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_ACK_TX_DESC "ACK events"
 #define FD_METRICS_COUNTER_QUIC_ACK_TX_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_ACK_TX_CNT  (5UL)
 
-#define FD_METRICS_COUNTER_QUIC_ACK_TX_NOOP_OFF (87UL)
-#define FD_METRICS_COUNTER_QUIC_ACK_TX_NEW_OFF (88UL)
-#define FD_METRICS_COUNTER_QUIC_ACK_TX_MERGED_OFF (89UL)
-#define FD_METRICS_COUNTER_QUIC_ACK_TX_DROP_OFF (90UL)
-#define FD_METRICS_COUNTER_QUIC_ACK_TX_CANCEL_OFF (91UL)
+#define FD_METRICS_COUNTER_QUIC_ACK_TX_NOOP_OFF (106UL)
+#define FD_METRICS_COUNTER_QUIC_ACK_TX_NEW_OFF (107UL)
+#define FD_METRICS_COUNTER_QUIC_ACK_TX_MERGED_OFF (108UL)
+#define FD_METRICS_COUNTER_QUIC_ACK_TX_DROP_OFF (109UL)
+#define FD_METRICS_COUNTER_QUIC_ACK_TX_CANCEL_OFF (110UL)
 
-#define FD_METRICS_HISTOGRAM_QUIC_SERVICE_DURATION_SECONDS_OFF  (92UL)
+#define FD_METRICS_HISTOGRAM_QUIC_SERVICE_DURATION_SECONDS_OFF  (111UL)
 #define FD_METRICS_HISTOGRAM_QUIC_SERVICE_DURATION_SECONDS_NAME "quic_service_duration_seconds"
 #define FD_METRICS_HISTOGRAM_QUIC_SERVICE_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_QUIC_SERVICE_DURATION_SECONDS_DESC "Duration spent in service"
@@ -286,7 +286,7 @@
 #define FD_METRICS_HISTOGRAM_QUIC_SERVICE_DURATION_SECONDS_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_QUIC_SERVICE_DURATION_SECONDS_MAX  (0.1)
 
-#define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_OFF  (109UL)
+#define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_OFF  (128UL)
 #define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_NAME "quic_receive_duration_seconds"
 #define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_DESC "Duration spent processing packets"
@@ -294,83 +294,83 @@
 #define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_MAX  (0.1)
 
-#define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_OFF  (126UL)
+#define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_OFF  (145UL)
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_NAME "quic_frame_fail_parse"
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_DESC "Number of QUIC frames failed to parse."
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_OFF  (127UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_OFF  (146UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_NAME "quic_pkt_crypto_failed"
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_DESC "Number of packets that failed decryption."
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_INITIAL_OFF (127UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_EARLY_OFF (128UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_HANDSHAKE_OFF (129UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_APP_OFF (130UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_INITIAL_OFF (146UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_EARLY_OFF (147UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_HANDSHAKE_OFF (148UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_APP_OFF (149UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_OFF  (131UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_OFF  (150UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_NAME "quic_pkt_no_key"
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_DESC "Number of packets that failed decryption due to missing key."
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_INITIAL_OFF (131UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_EARLY_OFF (132UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_HANDSHAKE_OFF (133UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_APP_OFF (134UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_INITIAL_OFF (150UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_EARLY_OFF (151UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_HANDSHAKE_OFF (152UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_APP_OFF (153UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_OFF  (135UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_OFF  (154UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_NAME "quic_pkt_net_header_invalid"
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_DESC "Number of packets dropped due to weird IP or UDP header."
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_OFF  (136UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_OFF  (155UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_NAME "quic_pkt_quic_header_invalid"
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_DESC "Number of packets dropped due to weird QUIC header."
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_OFF  (137UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_OFF  (156UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_NAME "quic_pkt_undersz"
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_DESC "Number of QUIC packets dropped due to being too small."
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_OFF  (138UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_OFF  (157UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_NAME "quic_pkt_oversz"
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_DESC "Number of QUIC packets dropped due to being too large."
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_OFF  (139UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_OFF  (158UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_NAME "quic_pkt_verneg"
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_DESC "Number of QUIC version negotiation packets received."
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_RETRY_SENT_OFF  (140UL)
+#define FD_METRICS_COUNTER_QUIC_RETRY_SENT_OFF  (159UL)
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_NAME "quic_retry_sent"
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_DESC "Number of QUIC Retry packets sent."
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_OFF  (141UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_OFF  (160UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_NAME "quic_pkt_retransmissions"
 #define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_DESC "Number of QUIC packets that retransmitted."
 #define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_INITIAL_OFF (141UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_EARLY_OFF (142UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_HANDSHAKE_OFF (143UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_APP_OFF (144UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_INITIAL_OFF (160UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_EARLY_OFF (161UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_HANDSHAKE_OFF (162UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_RETRANSMISSIONS_APP_OFF (163UL)
 
 #define FD_METRICS_QUIC_TOTAL (97UL)
 extern const fd_metrics_meta_t FD_METRICS_QUIC[FD_METRICS_QUIC_TOTAL];
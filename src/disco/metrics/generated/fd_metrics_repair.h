@@ -6,67 +6,67 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_REPAIR_TOTAL_PKT_COUNT_OFF  (16UL)
+#define FD_METRICS_COUNTER_REPAIR_TOTAL_PKT_COUNT_OFF  (35UL)
 #define FD_METRICS_COUNTER_REPAIR_TOTAL_PKT_COUNT_NAME "repair_total_pkt_count"
 #define FD_METRICS_COUNTER_REPAIR_TOTAL_PKT_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_TOTAL_PKT_COUNT_DESC "How many network packets we have sent, including reqs, pings, pongs, etc."
 #define FD_METRICS_COUNTER_REPAIR_TOTAL_PKT_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_OFF  (17UL)
+#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_OFF  (36UL)
 #define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_NAME "repair_sent_pkt_types"
 #define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_DESC "What types of client messages are we sending"
 #define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_NEEDED_WINDOW_OFF (17UL)
-#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_NEEDED_HIGHEST_WINDOW_OFF (18UL)
-#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_NEEDED_ORPHAN_OFF (19UL)
-#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_PONG_OFF (20UL)
+#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_NEEDED_WINDOW_OFF (36UL)
+#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_NEEDED_HIGHEST_WINDOW_OFF (37UL)
+#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_NEEDED_ORPHAN_OFF (38UL)
+#define FD_METRICS_COUNTER_REPAIR_SENT_PKT_TYPES_PONG_OFF (39UL)
 
-#define FD_METRICS_COUNTER_REPAIR_REPAIRED_SLOTS_OFF  (21UL)
+#define FD_METRICS_COUNTER_REPAIR_REPAIRED_SLOTS_OFF  (40UL)
 #define FD_METRICS_COUNTER_REPAIR_REPAIRED_SLOTS_NAME "repair_repaired_slots"
 #define FD_METRICS_COUNTER_REPAIR_REPAIRED_SLOTS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_REPAIRED_SLOTS_DESC "Until which slots have we fully repaired"
 #define FD_METRICS_COUNTER_REPAIR_REPAIRED_SLOTS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPAIR_CURRENT_SLOT_OFF  (22UL)
+#define FD_METRICS_COUNTER_REPAIR_CURRENT_SLOT_OFF  (41UL)
 #define FD_METRICS_COUNTER_REPAIR_CURRENT_SLOT_NAME "repair_current_slot"
 #define FD_METRICS_COUNTER_REPAIR_CURRENT_SLOT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_CURRENT_SLOT_DESC "Our view of the current cluster slot, max slot received"
 #define FD_METRICS_COUNTER_REPAIR_CURRENT_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPAIR_REQUEST_PEERS_OFF  (23UL)
+#define FD_METRICS_COUNTER_REPAIR_REQUEST_PEERS_OFF  (42UL)
 #define FD_METRICS_COUNTER_REPAIR_REQUEST_PEERS_NAME "repair_request_peers"
 #define FD_METRICS_COUNTER_REPAIR_REQUEST_PEERS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_REQUEST_PEERS_DESC "How many peers have we requested"
 #define FD_METRICS_COUNTER_REPAIR_REQUEST_PEERS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPAIR_SIGN_TILE_UNAVAIL_OFF  (24UL)
+#define FD_METRICS_COUNTER_REPAIR_SIGN_TILE_UNAVAIL_OFF  (43UL)
 #define FD_METRICS_COUNTER_REPAIR_SIGN_TILE_UNAVAIL_NAME "repair_sign_tile_unavail"
 #define FD_METRICS_COUNTER_REPAIR_SIGN_TILE_UNAVAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_SIGN_TILE_UNAVAIL_DESC "How many times no sign tiles were available to send request"
 #define FD_METRICS_COUNTER_REPAIR_SIGN_TILE_UNAVAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPAIR_EAGER_REPAIR_AGGRESSES_OFF  (25UL)
+#define FD_METRICS_COUNTER_REPAIR_EAGER_REPAIR_AGGRESSES_OFF  (44UL)
 #define FD_METRICS_COUNTER_REPAIR_EAGER_REPAIR_AGGRESSES_NAME "repair_eager_repair_aggresses"
 #define FD_METRICS_COUNTER_REPAIR_EAGER_REPAIR_AGGRESSES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_EAGER_REPAIR_AGGRESSES_DESC "How many times we pass eager repair threshold"
 #define FD_METRICS_COUNTER_REPAIR_EAGER_REPAIR_AGGRESSES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPAIR_REREQUEST_QUEUE_OFF  (26UL)
+#define FD_METRICS_COUNTER_REPAIR_REREQUEST_QUEUE_OFF  (45UL)
 #define FD_METRICS_COUNTER_REPAIR_REREQUEST_QUEUE_NAME "repair_rerequest_queue"
 #define FD_METRICS_COUNTER_REPAIR_REREQUEST_QUEUE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_REREQUEST_QUEUE_DESC "How many times we re-request a shred from the inflights queue"
 #define FD_METRICS_COUNTER_REPAIR_REREQUEST_QUEUE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPAIR_MALFORMED_PING_OFF  (27UL)
+#define FD_METRICS_COUNTER_REPAIR_MALFORMED_PING_OFF  (46UL)
 #define FD_METRICS_COUNTER_REPAIR_MALFORMED_PING_NAME "repair_malformed_ping"
 #define FD_METRICS_COUNTER_REPAIR_MALFORMED_PING_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPAIR_MALFORMED_PING_DESC "How many times we received a malformed ping"
 #define FD_METRICS_COUNTER_REPAIR_MALFORMED_PING_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_HISTOGRAM_REPAIR_SLOT_COMPLETE_TIME_OFF  (28UL)
+#define FD_METRICS_HISTOGRAM_REPAIR_SLOT_COMPLETE_TIME_OFF  (47UL)
 #define FD_METRICS_HISTOGRAM_REPAIR_SLOT_COMPLETE_TIME_NAME "repair_slot_complete_time"
 #define FD_METRICS_HISTOGRAM_REPAIR_SLOT_COMPLETE_TIME_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPAIR_SLOT_COMPLETE_TIME_DESC "Time in seconds it took to complete a slot"
@@ -74,7 +74,7 @@
 #define FD_METRICS_HISTOGRAM_REPAIR_SLOT_COMPLETE_TIME_MIN  (0.2)
 #define FD_METRICS_HISTOGRAM_REPAIR_SLOT_COMPLETE_TIME_MAX  (2.0)
 
-#define FD_METRICS_HISTOGRAM_REPAIR_RESPONSE_LATENCY_OFF  (45UL)
+#define FD_METRICS_HISTOGRAM_REPAIR_RESPONSE_LATENCY_OFF  (64UL)
 #define FD_METRICS_HISTOGRAM_REPAIR_RESPONSE_LATENCY_NAME "repair_response_latency"
 #define FD_METRICS_HISTOGRAM_REPAIR_RESPONSE_LATENCY_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPAIR_RESPONSE_LATENCY_DESC "Time in nanoseconds it took to receive a repair request response"
@@ -82,7 +82,7 @@
 #define FD_METRICS_HISTOGRAM_REPAIR_RESPONSE_LATENCY_MIN  (10000000UL)
 #define FD_METRICS_HISTOGRAM_REPAIR_RESPONSE_LATENCY_MAX  (1000000000UL)
 
-#define FD_METRICS_HISTOGRAM_REPAIR_SIGN_DURATION_SECONDS_OFF  (62UL)
+#define FD_METRICS_HISTOGRAM_REPAIR_SIGN_DURATION_SECONDS_OFF  (81UL)
 #define FD_METRICS_HISTOGRAM_REPAIR_SIGN_DURATION_SECONDS_NAME "repair_sign_duration_seconds"
 #define FD_METRICS_HISTOGRAM_REPAIR_SIGN_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPAIR_SIGN_DURATION_SECONDS_DESC "Duration of signing a message"
@@ -6,7 +6,7 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WAIT_OFF  (16UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WAIT_OFF  (35UL)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WAIT_NAME "replay_store_link_wait"
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WAIT_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WAIT_DESC "Time in seconds spent waiting for the store to link a new FEC set"
@@ -14,7 +14,7 @@
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WAIT_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WAIT_MAX  (0.0005)
 
-#define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WORK_OFF  (33UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WORK_OFF  (52UL)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WORK_NAME "replay_store_link_work"
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WORK_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WORK_DESC "Time in seconds spent on linking a new FEC set"
@@ -22,7 +22,7 @@
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WORK_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_LINK_WORK_MAX  (0.0005)
 
-#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_OFF  (50UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_OFF  (69UL)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_NAME "replay_store_read_wait"
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_DESC "Time in seconds spent waiting for the store to read a FEC set"
@@ -30,7 +30,7 @@
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_MAX  (0.001)
 
-#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_OFF  (67UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_OFF  (86UL)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_NAME "replay_store_read_work"
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_DESC "Time in seconds spent on reading a FEC set"
@@ -38,7 +38,7 @@
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_MAX  (0.001)
 
-#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_OFF  (84UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_OFF  (103UL)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_NAME "replay_store_publish_wait"
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_DESC "Time in seconds spent waiting for the store to publish a new FEC set"
@@ -46,7 +46,7 @@
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_MAX  (0.001)
 
-#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_OFF  (101UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_OFF  (120UL)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_NAME "replay_store_publish_work"
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_DESC "Time in seconds spent on publishing a new FEC set"
@@ -54,145 +54,145 @@
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_MAX  (0.001)
 
-#define FD_METRICS_GAUGE_REPLAY_ROOT_SLOT_OFF  (118UL)
+#define FD_METRICS_GAUGE_REPLAY_ROOT_SLOT_OFF  (137UL)
 #define FD_METRICS_GAUGE_REPLAY_ROOT_SLOT_NAME "replay_root_slot"
 #define FD_METRICS_GAUGE_REPLAY_ROOT_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_ROOT_SLOT_DESC "The slot at which our node has most recently rooted"
 #define FD_METRICS_GAUGE_REPLAY_ROOT_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_ROOT_DISTANCE_OFF  (119UL)
+#define FD_METRICS_GAUGE_REPLAY_ROOT_DISTANCE_OFF  (138UL)
 #define FD_METRICS_GAUGE_REPLAY_ROOT_DISTANCE_NAME "replay_root_distance"
 #define FD_METRICS_GAUGE_REPLAY_ROOT_DISTANCE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_ROOT_DISTANCE_DESC "The distance in slots between our current root and the current reset slot"
 #define FD_METRICS_GAUGE_REPLAY_ROOT_DISTANCE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_LEADER_SLOT_OFF  (120UL)
+#define FD_METRICS_GAUGE_REPLAY_LEADER_SLOT_OFF  (139UL)
 #define FD_METRICS_GAUGE_REPLAY_LEADER_SLOT_NAME "replay_leader_slot"
 #define FD_METRICS_GAUGE_REPLAY_LEADER_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_LEADER_SLOT_DESC "The slot at which we are currently leader, or 0 if none"
 #define FD_METRICS_GAUGE_REPLAY_LEADER_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_NEXT_LEADER_SLOT_OFF  (121UL)
+#define FD_METRICS_GAUGE_REPLAY_NEXT_LEADER_SLOT_OFF  (140UL)
 #define FD_METRICS_GAUGE_REPLAY_NEXT_LEADER_SLOT_NAME "replay_next_leader_slot"
 #define FD_METRICS_GAUGE_REPLAY_NEXT_LEADER_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_NEXT_LEADER_SLOT_DESC "The slot at which we are next leader, or 0 if none. If we are currently leader, this is the same as the current leader slot"
 #define FD_METRICS_GAUGE_REPLAY_NEXT_LEADER_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_RESET_SLOT_OFF  (122UL)
+#define FD_METRICS_GAUGE_REPLAY_RESET_SLOT_OFF  (141UL)
 #define FD_METRICS_GAUGE_REPLAY_RESET_SLOT_NAME "replay_reset_slot"
 #define FD_METRICS_GAUGE_REPLAY_RESET_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_RESET_SLOT_DESC "The slot at which we last reset the replay stage, or 0 if unknown"
 #define FD_METRICS_GAUGE_REPLAY_RESET_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_MAX_LIVE_BANKS_OFF  (123UL)
+#define FD_METRICS_GAUGE_REPLAY_MAX_LIVE_BANKS_OFF  (142UL)
 #define FD_METRICS_GAUGE_REPLAY_MAX_LIVE_BANKS_NAME "replay_max_live_banks"
 #define FD_METRICS_GAUGE_REPLAY_MAX_LIVE_BANKS_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_MAX_LIVE_BANKS_DESC "The maximum number of banks we can have alive"
 #define FD_METRICS_GAUGE_REPLAY_MAX_LIVE_BANKS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_LIVE_BANKS_OFF  (124UL)
+#define FD_METRICS_GAUGE_REPLAY_LIVE_BANKS_OFF  (143UL)
 #define FD_METRICS_GAUGE_REPLAY_LIVE_BANKS_NAME "replay_live_banks"
 #define FD_METRICS_GAUGE_REPLAY_LIVE_BANKS_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_LIVE_BANKS_DESC "The number of banks we currently have alive"
 #define FD_METRICS_GAUGE_REPLAY_LIVE_BANKS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_REASM_FREE_OFF  (125UL)
+#define FD_METRICS_GAUGE_REPLAY_REASM_FREE_OFF  (144UL)
 #define FD_METRICS_GAUGE_REPLAY_REASM_FREE_NAME "replay_reasm_free"
 #define FD_METRICS_GAUGE_REPLAY_REASM_FREE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_REASM_FREE_DESC "The number of free FEC sets in the reassembly queue"
 #define FD_METRICS_GAUGE_REPLAY_REASM_FREE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_SLOT_OFF  (126UL)
+#define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_SLOT_OFF  (145UL)
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_SLOT_NAME "replay_reasm_latest_slot"
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_SLOT_DESC "Slot of the latest FEC set in the reassembly queue that can be replayed"
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_FEC_IDX_OFF  (127UL)
+#define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_FEC_IDX_OFF  (146UL)
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_FEC_IDX_NAME "replay_reasm_latest_fec_idx"
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_FEC_IDX_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_FEC_IDX_DESC "FEC set index of the latest FEC set in the reassembly queue that can be replayed"
 #define FD_METRICS_GAUGE_REPLAY_REASM_LATEST_FEC_IDX_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_SLOTS_TOTAL_OFF  (128UL)
+#define FD_METRICS_COUNTER_REPLAY_SLOTS_TOTAL_OFF  (147UL)
 #define FD_METRICS_COUNTER_REPLAY_SLOTS_TOTAL_NAME "replay_slots_total"
 #define FD_METRICS_COUNTER_REPLAY_SLOTS_TOTAL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_SLOTS_TOTAL_DESC "Count of slots replayed successfully"
 #define FD_METRICS_COUNTER_REPLAY_SLOTS_TOTAL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_TRANSACTIONS_TOTAL_OFF  (129UL)
+#define FD_METRICS_COUNTER_REPLAY_TRANSACTIONS_TOTAL_OFF  (148UL)
 #define FD_METRICS_COUNTER_REPLAY_TRANSACTIONS_TOTAL_NAME "replay_transactions_total"
 #define FD_METRICS_COUNTER_REPLAY_TRANSACTIONS_TOTAL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_TRANSACTIONS_TOTAL_DESC "Count of transactions processed overall on the current fork"
 #define FD_METRICS_COUNTER_REPLAY_TRANSACTIONS_TOTAL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_SCHED_FULL_OFF  (130UL)
+#define FD_METRICS_COUNTER_REPLAY_SCHED_FULL_OFF  (149UL)
 #define FD_METRICS_COUNTER_REPLAY_SCHED_FULL_NAME "replay_sched_full"
 #define FD_METRICS_COUNTER_REPLAY_SCHED_FULL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_SCHED_FULL_DESC "Times where sched is full and a FEC set can't be processed"
 #define FD_METRICS_COUNTER_REPLAY_SCHED_FULL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_REASM_EMPTY_OFF  (131UL)
+#define FD_METRICS_COUNTER_REPLAY_REASM_EMPTY_OFF  (150UL)
 #define FD_METRICS_COUNTER_REPLAY_REASM_EMPTY_NAME "replay_reasm_empty"
 #define FD_METRICS_COUNTER_REPLAY_REASM_EMPTY_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_REASM_EMPTY_DESC "Times where reasm is empty and a FEC set can't be processed"
 #define FD_METRICS_COUNTER_REPLAY_REASM_EMPTY_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_LEADER_BID_WAIT_OFF  (132UL)
+#define FD_METRICS_COUNTER_REPLAY_LEADER_BID_WAIT_OFF  (151UL)
 #define FD_METRICS_COUNTER_REPLAY_LEADER_BID_WAIT_NAME "replay_leader_bid_wait"
 #define FD_METRICS_COUNTER_REPLAY_LEADER_BID_WAIT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_LEADER_BID_WAIT_DESC "Times where replay is blocked by the PoH tile not sending an end of leader message"
 #define FD_METRICS_COUNTER_REPLAY_LEADER_BID_WAIT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_BANKS_FULL_OFF  (133UL)
+#define FD_METRICS_COUNTER_REPLAY_BANKS_FULL_OFF  (152UL)
 #define FD_METRICS_COUNTER_REPLAY_BANKS_FULL_NAME "replay_banks_full"
 #define FD_METRICS_COUNTER_REPLAY_BANKS_FULL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_BANKS_FULL_DESC "Times where banks are full and a FEC set can't be processed"
 #define FD_METRICS_COUNTER_REPLAY_BANKS_FULL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_STORAGE_ROOT_BEHIND_OFF  (134UL)
+#define FD_METRICS_COUNTER_REPLAY_STORAGE_ROOT_BEHIND_OFF  (153UL)
 #define FD_METRICS_COUNTER_REPLAY_STORAGE_ROOT_BEHIND_NAME "replay_storage_root_behind"
 #define FD_METRICS_COUNTER_REPLAY_STORAGE_ROOT_BEHIND_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_STORAGE_ROOT_BEHIND_DESC "Times where the storage root is behind the consensus root and can't be advanced"
 #define FD_METRICS_COUNTER_REPLAY_STORAGE_ROOT_BEHIND_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_PROGCACHE_ROOTED_OFF  (135UL)
+#define FD_METRICS_COUNTER_REPLAY_PROGCACHE_ROOTED_OFF  (154UL)
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_ROOTED_NAME "replay_progcache_rooted"
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_ROOTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_ROOTED_DESC "Number of program cache entries rooted"
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_ROOTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_PROGCACHE_GC_ROOT_OFF  (136UL)
+#define FD_METRICS_COUNTER_REPLAY_PROGCACHE_GC_ROOT_OFF  (155UL)
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_GC_ROOT_NAME "replay_progcache_gc_root"
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_GC_ROOT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_GC_ROOT_DESC "Number of program cache entries garbage collected while rooting"
 #define FD_METRICS_COUNTER_REPLAY_PROGCACHE_GC_ROOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_ACCDB_CREATED_OFF  (137UL)
+#define FD_METRICS_COUNTER_REPLAY_ACCDB_CREATED_OFF  (156UL)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_CREATED_NAME "replay_accdb_created"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_CREATED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_CREATED_DESC "Number of account database records created"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_CREATED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_ACCDB_REVERTED_OFF  (138UL)
+#define FD_METRICS_COUNTER_REPLAY_ACCDB_REVERTED_OFF  (157UL)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_REVERTED_NAME "replay_accdb_reverted"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_REVERTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_REVERTED_DESC "Number of account database records reverted"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_REVERTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_ACCDB_ROOTED_OFF  (139UL)
+#define FD_METRICS_COUNTER_REPLAY_ACCDB_ROOTED_OFF  (158UL)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_ROOTED_NAME "replay_accdb_rooted"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_ROOTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_ROOTED_DESC "Number of account database entries rooted"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_ROOTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_ACCDB_GC_ROOT_OFF  (140UL)
+#define FD_METRICS_COUNTER_REPLAY_ACCDB_GC_ROOT_OFF  (159UL)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_GC_ROOT_NAME "replay_accdb_gc_root"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_GC_ROOT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_GC_ROOT_DESC "Number of account database entries garbage collected"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_GC_ROOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_REPLAY_ACCDB_RECLAIMED_OFF  (141UL)
+#define FD_METRICS_COUNTER_REPLAY_ACCDB_RECLAIMED_OFF  (160UL)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_RECLAIMED_NAME "replay_accdb_reclaimed"
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_RECLAIMED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_REPLAY_ACCDB_RECLAIMED_DESC "Number of account database entries reclaimed (deletion rooted)"
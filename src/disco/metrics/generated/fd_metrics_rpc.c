@@ -0,0 +1,15 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+#include "fd_metrics_rpc.h"
+
+const fd_metrics_meta_t FD_METRICS_RPC[FD_METRICS_RPC_TOTAL] = {
+    DECLARE_METRIC( RPC_RESPONSE_CACHE_HITS, COUNTER ),
+    DECLARE_METRIC( RPC_RESPONSE_CACHE_MISSES, COUNTER ),
+    DECLARE_METRIC( RPC_RESPONSE_CACHE_INSERT_FAILURES, COUNTER ),
+    DECLARE_METRIC( RPC_PUBSUB_SUBSCRIPTIONS, GAUGE ),
+    DECLARE_METRIC( RPC_PUBSUB_SUBSCRIBE_FAILURES, COUNTER ),
+    DECLARE_METRIC( RPC_PUBSUB_NOTIFICATIONS, COUNTER ),
+    DECLARE_METRIC( RPC_PUBSUB_SERIALIZATIONS, COUNTER ),
+    DECLARE_METRIC( RPC_PUBSUB_CONFLATED, COUNTER ),
+    DECLARE_METRIC( RPC_PUBSUB_OVERSIZE, COUNTER ),
+    DECLARE_METRIC( RPC_PUBSUB_EVICTIONS, COUNTER ),
+};
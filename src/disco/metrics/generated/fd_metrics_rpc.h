@@ -0,0 +1,72 @@
+#ifndef HEADER_fd_src_disco_metrics_generated_fd_metrics_rpc_h
+#define HEADER_fd_src_disco_metrics_generated_fd_metrics_rpc_h
+
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_HITS_OFF  (35UL)
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_HITS_NAME "rpc_response_cache_hits"
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_HITS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_HITS_DESC "The number of RPC requests answered from the response cache"
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_HITS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_MISSES_OFF  (36UL)
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_MISSES_NAME "rpc_response_cache_misses"
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_MISSES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_MISSES_DESC "The number of cacheable RPC requests that were not in the response cache and had to be serialized"
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_MISSES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_INSERT_FAILURES_OFF  (37UL)
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_INSERT_FAILURES_NAME "rpc_response_cache_insert_failures"
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_INSERT_FAILURES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_INSERT_FAILURES_DESC "The number of serialized RPC responses that could not be cached because the cache was full"
+#define FD_METRICS_COUNTER_RPC_RESPONSE_CACHE_INSERT_FAILURES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_RPC_PUBSUB_SUBSCRIPTIONS_OFF  (38UL)
+#define FD_METRICS_GAUGE_RPC_PUBSUB_SUBSCRIPTIONS_NAME "rpc_pubsub_subscriptions"
+#define FD_METRICS_GAUGE_RPC_PUBSUB_SUBSCRIPTIONS_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_RPC_PUBSUB_SUBSCRIPTIONS_DESC "The number of active WebSocket subscriptions"
+#define FD_METRICS_GAUGE_RPC_PUBSUB_SUBSCRIPTIONS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SUBSCRIBE_FAILURES_OFF  (39UL)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SUBSCRIBE_FAILURES_NAME "rpc_pubsub_subscribe_failures"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SUBSCRIBE_FAILURES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SUBSCRIBE_FAILURES_DESC "The number of WebSocket subscribe requests refused because the subscription limit was reached"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SUBSCRIBE_FAILURES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_PUBSUB_NOTIFICATIONS_OFF  (40UL)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_NOTIFICATIONS_NAME "rpc_pubsub_notifications"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_NOTIFICATIONS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_NOTIFICATIONS_DESC "The number of WebSocket subscription notifications sent"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_NOTIFICATIONS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SERIALIZATIONS_OFF  (41UL)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SERIALIZATIONS_NAME "rpc_pubsub_serializations"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SERIALIZATIONS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SERIALIZATIONS_DESC "The number of notification bodies serialized, each shared by all subscribers of the same account, slot or signature"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_SERIALIZATIONS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_PUBSUB_CONFLATED_OFF  (42UL)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_CONFLATED_NAME "rpc_pubsub_conflated"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_CONFLATED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_CONFLATED_DESC "The number of notifications skipped or delayed because the subscriber was behind, superseded by a later notification"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_CONFLATED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_PUBSUB_OVERSIZE_OFF  (43UL)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_OVERSIZE_NAME "rpc_pubsub_oversize"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_OVERSIZE_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_OVERSIZE_DESC "The number of account notifications dropped because the account was too large"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_OVERSIZE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_RPC_PUBSUB_EVICTIONS_OFF  (44UL)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_EVICTIONS_NAME "rpc_pubsub_evictions"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_EVICTIONS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_RPC_PUBSUB_EVICTIONS_DESC "The number of WebSocket connections closed for not reading their notifications"
+#define FD_METRICS_COUNTER_RPC_PUBSUB_EVICTIONS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_RPC_TOTAL (10UL)
+extern const fd_metrics_meta_t FD_METRICS_RPC[FD_METRICS_RPC_TOTAL];
+
+#endif /* HEADER_fd_src_disco_metrics_generated_fd_metrics_rpc_h */
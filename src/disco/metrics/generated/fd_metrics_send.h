@@ -6,437 +6,437 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_SEND_LEADER_NOT_FOUND_OFF  (16UL)
+#define FD_METRICS_COUNTER_SEND_LEADER_NOT_FOUND_OFF  (35UL)
 #define FD_METRICS_COUNTER_SEND_LEADER_NOT_FOUND_NAME "send_leader_not_found"
 #define FD_METRICS_COUNTER_SEND_LEADER_NOT_FOUND_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_LEADER_NOT_FOUND_DESC "Total number of times slot leader not found"
 #define FD_METRICS_COUNTER_SEND_LEADER_NOT_FOUND_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_UNSTAKED_CI_OFF  (17UL)
+#define FD_METRICS_COUNTER_SEND_UNSTAKED_CI_OFF  (36UL)
 #define FD_METRICS_COUNTER_SEND_UNSTAKED_CI_NAME "send_unstaked_ci"
 #define FD_METRICS_COUNTER_SEND_UNSTAKED_CI_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_UNSTAKED_CI_DESC "Total number of times we received contact info for an unstaked node"
 #define FD_METRICS_COUNTER_SEND_UNSTAKED_CI_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_CI_REMOVED_OFF  (18UL)
+#define FD_METRICS_COUNTER_SEND_CI_REMOVED_OFF  (37UL)
 #define FD_METRICS_COUNTER_SEND_CI_REMOVED_NAME "send_ci_removed"
 #define FD_METRICS_COUNTER_SEND_CI_REMOVED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CI_REMOVED_DESC "Total number of times we removed contact info"
 #define FD_METRICS_COUNTER_SEND_CI_REMOVED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_OFF  (19UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_OFF  (38UL)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_NAME "send_new_contact_info_quic_vote"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_DESC "Total number of contact infos received and handled for QUIC Vote port"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_UNROUTABLE_OFF (19UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_INITIALIZED_OFF (20UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_CHANGED_OFF (21UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_NO_CHANGE_OFF (22UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_UNROUTABLE_OFF (38UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_INITIALIZED_OFF (39UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_CHANGED_OFF (40UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_VOTE_NO_CHANGE_OFF (41UL)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_OFF  (23UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_OFF  (42UL)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_NAME "send_new_contact_info_quic_tpu"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_DESC "Total number of contact infos received and handled for QUIC TPU port"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_UNROUTABLE_OFF (23UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_INITIALIZED_OFF (24UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_CHANGED_OFF (25UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_NO_CHANGE_OFF (26UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_UNROUTABLE_OFF (42UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_INITIALIZED_OFF (43UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_CHANGED_OFF (44UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_QUIC_TPU_NO_CHANGE_OFF (45UL)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_OFF  (27UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_OFF  (46UL)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_NAME "send_new_contact_info_udp_vote"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_DESC "Total number of contact infos received and handled for UDP Vote port"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_UNROUTABLE_OFF (27UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_INITIALIZED_OFF (28UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_CHANGED_OFF (29UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_NO_CHANGE_OFF (30UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_UNROUTABLE_OFF (46UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_INITIALIZED_OFF (47UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_CHANGED_OFF (48UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_VOTE_NO_CHANGE_OFF (49UL)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_OFF  (31UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_OFF  (50UL)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_NAME "send_new_contact_info_udp_tpu"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_DESC "Total number of contact infos received and handled for UDP TPU port"
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_UNROUTABLE_OFF (31UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_INITIALIZED_OFF (32UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_CHANGED_OFF (33UL)
-#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_NO_CHANGE_OFF (34UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_UNROUTABLE_OFF (50UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_INITIALIZED_OFF (51UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_CHANGED_OFF (52UL)
+#define FD_METRICS_COUNTER_SEND_NEW_CONTACT_INFO_UDP_TPU_NO_CHANGE_OFF (53UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_OFF  (35UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_OFF  (54UL)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_NAME "send_send_result_quic_vote"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_DESC "Total count of results from trying to send via QUIC Vote port"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_SUCCESS_OFF (35UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_NO_CI_OFF (36UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_NO_CONN_OFF (37UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_NO_STREAM_OFF (38UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_SUCCESS_OFF (54UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_NO_CI_OFF (55UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_NO_CONN_OFF (56UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_VOTE_NO_STREAM_OFF (57UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_OFF  (39UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_OFF  (58UL)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_NAME "send_send_result_quic_tpu"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_DESC "Total count of results from trying to send via QUIC TPU port"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_SUCCESS_OFF (39UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_NO_CI_OFF (40UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_NO_CONN_OFF (41UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_NO_STREAM_OFF (42UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_SUCCESS_OFF (58UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_NO_CI_OFF (59UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_NO_CONN_OFF (60UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_QUIC_TPU_NO_STREAM_OFF (61UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_OFF  (43UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_OFF  (62UL)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_NAME "send_send_result_udp_vote"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_DESC "Total count of results from trying to send via UDP Vote port"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_SUCCESS_OFF (43UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_NO_CI_OFF (44UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_NO_CONN_OFF (45UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_NO_STREAM_OFF (46UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_SUCCESS_OFF (62UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_NO_CI_OFF (63UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_NO_CONN_OFF (64UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_VOTE_NO_STREAM_OFF (65UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_OFF  (47UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_OFF  (66UL)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_NAME "send_send_result_udp_tpu"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_DESC "Total count of results from trying to send via UDP TPU port"
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_SUCCESS_OFF (47UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_NO_CI_OFF (48UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_NO_CONN_OFF (49UL)
-#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_NO_STREAM_OFF (50UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_SUCCESS_OFF (66UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_NO_CI_OFF (67UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_NO_CONN_OFF (68UL)
+#define FD_METRICS_COUNTER_SEND_SEND_RESULT_UDP_TPU_NO_STREAM_OFF (69UL)
 
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_OFF  (51UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_OFF  (70UL)
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_NAME "send_ensure_conn_result_quic_vote"
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_DESC "Total count of results from trying to ensure a connection for a leader for QUIC Vote port"
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_CNT  (6UL)
 
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_NO_LEADER_OFF (51UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_NO_CI_OFF (52UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_NEW_CONNECTION_OFF (53UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_CONN_FAILED_OFF (54UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_CONNECTED_OFF (55UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_COOLDOWN_OFF (56UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_NO_LEADER_OFF (70UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_NO_CI_OFF (71UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_NEW_CONNECTION_OFF (72UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_CONN_FAILED_OFF (73UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_CONNECTED_OFF (74UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_VOTE_COOLDOWN_OFF (75UL)
 
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_OFF  (57UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_OFF  (76UL)
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_NAME "send_ensure_conn_result_quic_tpu"
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_DESC "Total count of results from trying to ensure a connection for a leader for QUIC TPU port"
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_CNT  (6UL)
 
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_NO_LEADER_OFF (57UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_NO_CI_OFF (58UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_NEW_CONNECTION_OFF (59UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_CONN_FAILED_OFF (60UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_CONNECTED_OFF (61UL)
-#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_COOLDOWN_OFF (62UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_NO_LEADER_OFF (76UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_NO_CI_OFF (77UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_NEW_CONNECTION_OFF (78UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_CONN_FAILED_OFF (79UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_CONNECTED_OFF (80UL)
+#define FD_METRICS_COUNTER_SEND_ENSURE_CONN_RESULT_QUIC_TPU_COOLDOWN_OFF (81UL)
 
-#define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_OFF  (63UL)
+#define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_OFF  (82UL)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_NAME "send_handshake_complete"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_DESC "Total number of times we completed a handshake"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_CNT  (2UL)
 
-#define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_QUIC_VOTE_OFF (63UL)
-#define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_QUIC_TPU_OFF (64UL)
+#define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_QUIC_VOTE_OFF (82UL)
+#define FD_METRICS_COUNTER_SEND_HANDSHAKE_COMPLETE_QUIC_TPU_OFF (83UL)
 
-#define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_OFF  (65UL)
+#define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_OFF  (84UL)
 #define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_NAME "send_quic_conn_final"
 #define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_DESC "Total number of times QUIC connection closed"
 #define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_CNT  (2UL)
 
-#define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_QUIC_VOTE_OFF (65UL)
-#define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_QUIC_TPU_OFF (66UL)
+#define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_QUIC_VOTE_OFF (84UL)
+#define FD_METRICS_COUNTER_SEND_QUIC_CONN_FINAL_QUIC_TPU_OFF (85UL)
 
-#define FD_METRICS_COUNTER_SEND_RECEIVED_PACKETS_OFF  (67UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_PACKETS_OFF  (86UL)
 #define FD_METRICS_COUNTER_SEND_RECEIVED_PACKETS_NAME "send_received_packets"
 #define FD_METRICS_COUNTER_SEND_RECEIVED_PACKETS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_RECEIVED_PACKETS_DESC "Total count of QUIC packets received"
 #define FD_METRICS_COUNTER_SEND_RECEIVED_PACKETS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_RECEIVED_BYTES_OFF  (68UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_BYTES_OFF  (87UL)
 #define FD_METRICS_COUNTER_SEND_RECEIVED_BYTES_NAME "send_received_bytes"
 #define FD_METRICS_COUNTER_SEND_RECEIVED_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_RECEIVED_BYTES_DESC "Total bytes received via QUIC"
 #define FD_METRICS_COUNTER_SEND_RECEIVED_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_SENT_PACKETS_OFF  (69UL)
+#define FD_METRICS_COUNTER_SEND_SENT_PACKETS_OFF  (88UL)
 #define FD_METRICS_COUNTER_SEND_SENT_PACKETS_NAME "send_sent_packets"
 #define FD_METRICS_COUNTER_SEND_SENT_PACKETS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_SENT_PACKETS_DESC "Total count of QUIC packets sent"
 #define FD_METRICS_COUNTER_SEND_SENT_PACKETS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_SENT_BYTES_OFF  (70UL)
+#define FD_METRICS_COUNTER_SEND_SENT_BYTES_OFF  (89UL)
 #define FD_METRICS_COUNTER_SEND_SENT_BYTES_NAME "send_sent_bytes"
 #define FD_METRICS_COUNTER_SEND_SENT_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_SENT_BYTES_DESC "Total bytes sent via QUIC"
 #define FD_METRICS_COUNTER_SEND_SENT_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_RETRY_SENT_OFF  (71UL)
+#define FD_METRICS_COUNTER_SEND_RETRY_SENT_OFF  (90UL)
 #define FD_METRICS_COUNTER_SEND_RETRY_SENT_NAME "send_retry_sent"
 #define FD_METRICS_COUNTER_SEND_RETRY_SENT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_RETRY_SENT_DESC "Total count of QUIC retry packets sent"
 #define FD_METRICS_COUNTER_SEND_RETRY_SENT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_ALLOC_OFF  (72UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_ALLOC_OFF  (91UL)
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_ALLOC_NAME "send_connections_alloc"
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_ALLOC_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_ALLOC_DESC "Number of currently allocated QUIC connections"
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_ALLOC_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_OFF  (73UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_OFF  (92UL)
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_NAME "send_connections_state"
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_DESC "Number of QUIC connections in each state"
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_CNT  (8UL)
 
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_INVALID_OFF (73UL)
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_HANDSHAKE_OFF (74UL)
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_HANDSHAKE_COMPLETE_OFF (75UL)
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_ACTIVE_OFF (76UL)
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_PEER_CLOSE_OFF (77UL)
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_ABORT_OFF (78UL)
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_CLOSE_PENDING_OFF (79UL)
-#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_DEAD_OFF (80UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_INVALID_OFF (92UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_HANDSHAKE_OFF (93UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_HANDSHAKE_COMPLETE_OFF (94UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_ACTIVE_OFF (95UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_PEER_CLOSE_OFF (96UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_ABORT_OFF (97UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_CLOSE_PENDING_OFF (98UL)
+#define FD_METRICS_GAUGE_SEND_CONNECTIONS_STATE_DEAD_OFF (99UL)
 
-#define FD_METRICS_COUNTER_SEND_CONNECTIONS_CREATED_OFF  (81UL)
+#define FD_METRICS_COUNTER_SEND_CONNECTIONS_CREATED_OFF  (100UL)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CREATED_NAME "send_connections_created"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CREATED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CREATED_DESC "Total count of QUIC connections created"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CREATED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_CONNECTIONS_CLOSED_OFF  (82UL)
+#define FD_METRICS_COUNTER_SEND_CONNECTIONS_CLOSED_OFF  (101UL)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CLOSED_NAME "send_connections_closed"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CLOSED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CLOSED_DESC "Total count of QUIC connections closed"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_CLOSED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_CONNECTIONS_ABORTED_OFF  (83UL)
+#define FD_METRICS_COUNTER_SEND_CONNECTIONS_ABORTED_OFF  (102UL)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_ABORTED_NAME "send_connections_aborted"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_ABORTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_ABORTED_DESC "Total count of QUIC connections aborted"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_ABORTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_CONNECTIONS_TIMED_OUT_OFF  (84UL)
+#define FD_METRICS_COUNTER_SEND_CONNECTIONS_TIMED_OUT_OFF  (103UL)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_TIMED_OUT_NAME "send_connections_timed_out"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_TIMED_OUT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_TIMED_OUT_DESC "Total count of QUIC connections timed out"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_TIMED_OUT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_CONNECTIONS_RETRIED_OFF  (85UL)
+#define FD_METRICS_COUNTER_SEND_CONNECTIONS_RETRIED_OFF  (104UL)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_RETRIED_NAME "send_connections_retried"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_RETRIED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_RETRIED_DESC "Total count of QUIC connections retried"
 #define FD_METRICS_COUNTER_SEND_CONNECTIONS_RETRIED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_NO_SLOTS_OFF  (86UL)
+#define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_NO_SLOTS_OFF  (105UL)
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_NO_SLOTS_NAME "send_connection_error_no_slots"
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_NO_SLOTS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_NO_SLOTS_DESC "Total count of connection errors due to no slots"
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_NO_SLOTS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_RETRY_FAIL_OFF  (87UL)
+#define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_RETRY_FAIL_OFF  (106UL)
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_RETRY_FAIL_NAME "send_connection_error_retry_fail"
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_RETRY_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_RETRY_FAIL_DESC "Total count of connection retry failures"
 #define FD_METRICS_COUNTER_SEND_CONNECTION_ERROR_RETRY_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_OFF  (88UL)
+#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_OFF  (107UL)
 #define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_NAME "send_pkt_crypto_failed"
 #define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_DESC "Total count of packets with crypto failures"
 #define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_INITIAL_OFF (88UL)
-#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_EARLY_OFF (89UL)
-#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_HANDSHAKE_OFF (90UL)
-#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_APP_OFF (91UL)
+#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_INITIAL_OFF (107UL)
+#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_EARLY_OFF (108UL)
+#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_HANDSHAKE_OFF (109UL)
+#define FD_METRICS_COUNTER_SEND_PKT_CRYPTO_FAILED_APP_OFF (110UL)
 
-#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_OFF  (92UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_OFF  (111UL)
 #define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_NAME "send_pkt_no_key"
 #define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_DESC "Total count of packets with no key"
 #define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_INITIAL_OFF (92UL)
-#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_EARLY_OFF (93UL)
-#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_HANDSHAKE_OFF (94UL)
-#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_APP_OFF (95UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_INITIAL_OFF (111UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_EARLY_OFF (112UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_HANDSHAKE_OFF (113UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_KEY_APP_OFF (114UL)
 
-#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_OFF  (96UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_OFF  (115UL)
 #define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_NAME "send_pkt_no_conn"
 #define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_DESC "Total count of packets with no connection"
 #define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_INITIAL_OFF (96UL)
-#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_RETRY_OFF (97UL)
-#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_HANDSHAKE_OFF (98UL)
-#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_ONE_RTT_OFF (99UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_INITIAL_OFF (115UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_RETRY_OFF (116UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_HANDSHAKE_OFF (117UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NO_CONN_ONE_RTT_OFF (118UL)
 
-#define FD_METRICS_COUNTER_SEND_PKT_TX_ALLOC_FAIL_OFF  (100UL)
+#define FD_METRICS_COUNTER_SEND_PKT_TX_ALLOC_FAIL_OFF  (119UL)
 #define FD_METRICS_COUNTER_SEND_PKT_TX_ALLOC_FAIL_NAME "send_pkt_tx_alloc_fail"
 #define FD_METRICS_COUNTER_SEND_PKT_TX_ALLOC_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_TX_ALLOC_FAIL_DESC "Total count of packet TX allocation failures"
 #define FD_METRICS_COUNTER_SEND_PKT_TX_ALLOC_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_PKT_NET_HEADER_INVALID_OFF  (101UL)
+#define FD_METRICS_COUNTER_SEND_PKT_NET_HEADER_INVALID_OFF  (120UL)
 #define FD_METRICS_COUNTER_SEND_PKT_NET_HEADER_INVALID_NAME "send_pkt_net_header_invalid"
 #define FD_METRICS_COUNTER_SEND_PKT_NET_HEADER_INVALID_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_NET_HEADER_INVALID_DESC "Total count of packets with invalid network headers"
 #define FD_METRICS_COUNTER_SEND_PKT_NET_HEADER_INVALID_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_PKT_QUIC_HEADER_INVALID_OFF  (102UL)
+#define FD_METRICS_COUNTER_SEND_PKT_QUIC_HEADER_INVALID_OFF  (121UL)
 #define FD_METRICS_COUNTER_SEND_PKT_QUIC_HEADER_INVALID_NAME "send_pkt_quic_header_invalid"
 #define FD_METRICS_COUNTER_SEND_PKT_QUIC_HEADER_INVALID_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_QUIC_HEADER_INVALID_DESC "Total count of packets with invalid QUIC headers"
 #define FD_METRICS_COUNTER_SEND_PKT_QUIC_HEADER_INVALID_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_PKT_UNDERSZ_OFF  (103UL)
+#define FD_METRICS_COUNTER_SEND_PKT_UNDERSZ_OFF  (122UL)
 #define FD_METRICS_COUNTER_SEND_PKT_UNDERSZ_NAME "send_pkt_undersz"
 #define FD_METRICS_COUNTER_SEND_PKT_UNDERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_UNDERSZ_DESC "Total count of undersized packets"
 #define FD_METRICS_COUNTER_SEND_PKT_UNDERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_PKT_OVERSZ_OFF  (104UL)
+#define FD_METRICS_COUNTER_SEND_PKT_OVERSZ_OFF  (123UL)
 #define FD_METRICS_COUNTER_SEND_PKT_OVERSZ_NAME "send_pkt_oversz"
 #define FD_METRICS_COUNTER_SEND_PKT_OVERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_OVERSZ_DESC "Total count of oversized packets"
 #define FD_METRICS_COUNTER_SEND_PKT_OVERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_PKT_VERNEG_OFF  (105UL)
+#define FD_METRICS_COUNTER_SEND_PKT_VERNEG_OFF  (124UL)
 #define FD_METRICS_COUNTER_SEND_PKT_VERNEG_NAME "send_pkt_verneg"
 #define FD_METRICS_COUNTER_SEND_PKT_VERNEG_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_VERNEG_DESC "Total count of version negotiation packets"
 #define FD_METRICS_COUNTER_SEND_PKT_VERNEG_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_OFF  (106UL)
+#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_OFF  (125UL)
 #define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_NAME "send_pkt_retransmissions"
 #define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_DESC "Total count of QUIC packet retransmissions."
 #define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_INITIAL_OFF (106UL)
-#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_EARLY_OFF (107UL)
-#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_HANDSHAKE_OFF (108UL)
-#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_APP_OFF (109UL)
+#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_INITIAL_OFF (125UL)
+#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_EARLY_OFF (126UL)
+#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_HANDSHAKE_OFF (127UL)
+#define FD_METRICS_COUNTER_SEND_PKT_RETRANSMISSIONS_APP_OFF (128UL)
 
-#define FD_METRICS_COUNTER_SEND_HANDSHAKES_CREATED_OFF  (110UL)
+#define FD_METRICS_COUNTER_SEND_HANDSHAKES_CREATED_OFF  (129UL)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKES_CREATED_NAME "send_handshakes_created"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKES_CREATED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKES_CREATED_DESC "Total count of QUIC handshakes created"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKES_CREATED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_HANDSHAKE_ERROR_ALLOC_FAIL_OFF  (111UL)
+#define FD_METRICS_COUNTER_SEND_HANDSHAKE_ERROR_ALLOC_FAIL_OFF  (130UL)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_ERROR_ALLOC_FAIL_NAME "send_handshake_error_alloc_fail"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_ERROR_ALLOC_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_ERROR_ALLOC_FAIL_DESC "Total count of handshake allocation failures"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_ERROR_ALLOC_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_HANDSHAKE_EVICTED_OFF  (112UL)
+#define FD_METRICS_COUNTER_SEND_HANDSHAKE_EVICTED_OFF  (131UL)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_EVICTED_NAME "send_handshake_evicted"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_EVICTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_EVICTED_DESC "Total count of handshakes evicted"
 #define FD_METRICS_COUNTER_SEND_HANDSHAKE_EVICTED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_EVENTS_OFF  (113UL)
+#define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_EVENTS_OFF  (132UL)
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_EVENTS_NAME "send_stream_received_events"
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_EVENTS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_EVENTS_DESC "Total count of stream events received"
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_EVENTS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_BYTES_OFF  (114UL)
+#define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_BYTES_OFF  (133UL)
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_BYTES_NAME "send_stream_received_bytes"
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_BYTES_DESC "Total bytes received via streams"
 #define FD_METRICS_COUNTER_SEND_STREAM_RECEIVED_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_OFF  (115UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_OFF  (134UL)
 #define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_NAME "send_received_frames"
 #define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_DESC "Total count of QUIC frames received"
 #define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CNT  (22UL)
 
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_UNKNOWN_OFF (115UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_ACK_OFF (116UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_RESET_STREAM_OFF (117UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STOP_SENDING_OFF (118UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CRYPTO_OFF (119UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_NEW_TOKEN_OFF (120UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STREAM_OFF (121UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_MAX_DATA_OFF (122UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_MAX_STREAM_DATA_OFF (123UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_MAX_STREAMS_OFF (124UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_DATA_BLOCKED_OFF (125UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STREAM_DATA_BLOCKED_OFF (126UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STREAMS_BLOCKED_OFF (127UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_NEW_CONN_ID_OFF (128UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_RETIRE_CONN_ID_OFF (129UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PATH_CHALLENGE_OFF (130UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PATH_RESPONSE_OFF (131UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CONN_CLOSE_QUIC_OFF (132UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CONN_CLOSE_APP_OFF (133UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_HANDSHAKE_DONE_OFF (134UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PING_OFF (135UL)
-#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PADDING_OFF (136UL)
-
-#define FD_METRICS_COUNTER_SEND_FRAME_FAIL_PARSE_OFF  (137UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_UNKNOWN_OFF (134UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_ACK_OFF (135UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_RESET_STREAM_OFF (136UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STOP_SENDING_OFF (137UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CRYPTO_OFF (138UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_NEW_TOKEN_OFF (139UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STREAM_OFF (140UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_MAX_DATA_OFF (141UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_MAX_STREAM_DATA_OFF (142UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_MAX_STREAMS_OFF (143UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_DATA_BLOCKED_OFF (144UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STREAM_DATA_BLOCKED_OFF (145UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_STREAMS_BLOCKED_OFF (146UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_NEW_CONN_ID_OFF (147UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_RETIRE_CONN_ID_OFF (148UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PATH_CHALLENGE_OFF (149UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PATH_RESPONSE_OFF (150UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CONN_CLOSE_QUIC_OFF (151UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_CONN_CLOSE_APP_OFF (152UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_HANDSHAKE_DONE_OFF (153UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PING_OFF (154UL)
+#define FD_METRICS_COUNTER_SEND_RECEIVED_FRAMES_PADDING_OFF (155UL)
+
+#define FD_METRICS_COUNTER_SEND_FRAME_FAIL_PARSE_OFF  (156UL)
 #define FD_METRICS_COUNTER_SEND_FRAME_FAIL_PARSE_NAME "send_frame_fail_parse"
 #define FD_METRICS_COUNTER_SEND_FRAME_FAIL_PARSE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_FRAME_FAIL_PARSE_DESC "Total count of frame parse failures"
 #define FD_METRICS_COUNTER_SEND_FRAME_FAIL_PARSE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_OFF  (138UL)
+#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_OFF  (157UL)
 #define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_NAME "send_frame_tx_alloc"
 #define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_DESC "Results of attempts to acquire QUIC frame metadata."
 #define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_CNT  (3UL)
 
-#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_SUCCESS_OFF (138UL)
-#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_FAIL_EMPTY_POOL_OFF (139UL)
-#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_FAIL_CONN_MAX_OFF (140UL)
+#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_SUCCESS_OFF (157UL)
+#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_FAIL_EMPTY_POOL_OFF (158UL)
+#define FD_METRICS_COUNTER_SEND_FRAME_TX_ALLOC_FAIL_CONN_MAX_OFF (159UL)
 
-#define FD_METRICS_COUNTER_SEND_ACK_TX_OFF  (141UL)
+#define FD_METRICS_COUNTER_SEND_ACK_TX_OFF  (160UL)
 #define FD_METRICS_COUNTER_SEND_ACK_TX_NAME "send_ack_tx"
 #define FD_METRICS_COUNTER_SEND_ACK_TX_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SEND_ACK_TX_DESC "Total count of ACK frames transmitted"
 #define FD_METRICS_COUNTER_SEND_ACK_TX_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SEND_ACK_TX_CNT  (5UL)
 
-#define FD_METRICS_COUNTER_SEND_ACK_TX_NOOP_OFF (141UL)
-#define FD_METRICS_COUNTER_SEND_ACK_TX_NEW_OFF (142UL)
-#define FD_METRICS_COUNTER_SEND_ACK_TX_MERGED_OFF (143UL)
-#define FD_METRICS_COUNTER_SEND_ACK_TX_DROP_OFF (144UL)
-#define FD_METRICS_COUNTER_SEND_ACK_TX_CANCEL_OFF (145UL)
+#define FD_METRICS_COUNTER_SEND_ACK_TX_NOOP_OFF (160UL)
+#define FD_METRICS_COUNTER_SEND_ACK_TX_NEW_OFF (161UL)
+#define FD_METRICS_COUNTER_SEND_ACK_TX_MERGED_OFF (162UL)
+#define FD_METRICS_COUNTER_SEND_ACK_TX_DROP_OFF (163UL)
+#define FD_METRICS_COUNTER_SEND_ACK_TX_CANCEL_OFF (164UL)
 
-#define FD_METRICS_HISTOGRAM_SEND_SERVICE_DURATION_SECONDS_OFF  (146UL)
+#define FD_METRICS_HISTOGRAM_SEND_SERVICE_DURATION_SECONDS_OFF  (165UL)
 #define FD_METRICS_HISTOGRAM_SEND_SERVICE_DURATION_SECONDS_NAME "send_service_duration_seconds"
 #define FD_METRICS_HISTOGRAM_SEND_SERVICE_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_SEND_SERVICE_DURATION_SECONDS_DESC "Duration spent in service"
@@ -444,7 +444,7 @@
 #define FD_METRICS_HISTOGRAM_SEND_SERVICE_DURATION_SECONDS_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_SEND_SERVICE_DURATION_SECONDS_MAX  (0.1)
 
-#define FD_METRICS_HISTOGRAM_SEND_RECEIVE_DURATION_SECONDS_OFF  (163UL)
+#define FD_METRICS_HISTOGRAM_SEND_RECEIVE_DURATION_SECONDS_OFF  (182UL)
 #define FD_METRICS_HISTOGRAM_SEND_RECEIVE_DURATION_SECONDS_NAME "send_receive_duration_seconds"
 #define FD_METRICS_HISTOGRAM_SEND_RECEIVE_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_SEND_RECEIVE_DURATION_SECONDS_DESC "Duration spent processing packets"
@@ -452,7 +452,7 @@
 #define FD_METRICS_HISTOGRAM_SEND_RECEIVE_DURATION_SECONDS_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_SEND_RECEIVE_DURATION_SECONDS_MAX  (0.1)
 
-#define FD_METRICS_HISTOGRAM_SEND_SIGN_DURATION_NANOS_OFF  (180UL)
+#define FD_METRICS_HISTOGRAM_SEND_SIGN_DURATION_NANOS_OFF  (199UL)
 #define FD_METRICS_HISTOGRAM_SEND_SIGN_DURATION_NANOS_NAME "send_sign_duration_nanos"
 #define FD_METRICS_HISTOGRAM_SEND_SIGN_DURATION_NANOS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_SEND_SIGN_DURATION_NANOS_DESC "Duration spent waiting for tls_cv signatures"
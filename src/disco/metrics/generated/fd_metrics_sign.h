@@ -6,7 +6,7 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_OFF  (16UL)
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_OFF  (35UL)
 #define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_NAME "sign_sign_duration_seconds"
 #define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_DESC "Duration of signing a message"
@@ -6,91 +6,91 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_SNAPCT_STATE_OFF  (16UL)
+#define FD_METRICS_GAUGE_SNAPCT_STATE_OFF  (35UL)
 #define FD_METRICS_GAUGE_SNAPCT_STATE_NAME "snapct_state"
 #define FD_METRICS_GAUGE_SNAPCT_STATE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_STATE_DESC "State of the tile"
 #define FD_METRICS_GAUGE_SNAPCT_STATE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SNAPCT_FULL_NUM_RETRIES_OFF  (17UL)
+#define FD_METRICS_COUNTER_SNAPCT_FULL_NUM_RETRIES_OFF  (36UL)
 #define FD_METRICS_COUNTER_SNAPCT_FULL_NUM_RETRIES_NAME "snapct_full_num_retries"
 #define FD_METRICS_COUNTER_SNAPCT_FULL_NUM_RETRIES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SNAPCT_FULL_NUM_RETRIES_DESC "Number of times we aborted and retried full snapshot download because the peer was too slow"
 #define FD_METRICS_COUNTER_SNAPCT_FULL_NUM_RETRIES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SNAPCT_INCREMENTAL_NUM_RETRIES_OFF  (18UL)
+#define FD_METRICS_COUNTER_SNAPCT_INCREMENTAL_NUM_RETRIES_OFF  (37UL)
 #define FD_METRICS_COUNTER_SNAPCT_INCREMENTAL_NUM_RETRIES_NAME "snapct_incremental_num_retries"
 #define FD_METRICS_COUNTER_SNAPCT_INCREMENTAL_NUM_RETRIES_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SNAPCT_INCREMENTAL_NUM_RETRIES_DESC "Number of times we aborted and retried incremental snapshot download because the peer was too slow"
 #define FD_METRICS_COUNTER_SNAPCT_INCREMENTAL_NUM_RETRIES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_READ_OFF  (19UL)
+#define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_READ_OFF  (38UL)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_READ_NAME "snapct_full_bytes_read"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_READ_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_READ_DESC "Number of bytes read so far from the full snapshot. Might decrease if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_READ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_WRITTEN_OFF  (20UL)
+#define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_WRITTEN_OFF  (39UL)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_WRITTEN_NAME "snapct_full_bytes_written"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_WRITTEN_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_WRITTEN_DESC "Number of bytes written so far from the full snapshot. Might decrease if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_WRITTEN_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_TOTAL_OFF  (21UL)
+#define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_TOTAL_OFF  (40UL)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_TOTAL_NAME "snapct_full_bytes_total"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_TOTAL_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_TOTAL_DESC "Total size of the full snapshot file. Might change if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_BYTES_TOTAL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_FULL_DOWNLOAD_RETRIES_OFF  (22UL)
+#define FD_METRICS_GAUGE_SNAPCT_FULL_DOWNLOAD_RETRIES_OFF  (41UL)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_DOWNLOAD_RETRIES_NAME "snapct_full_download_retries"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_DOWNLOAD_RETRIES_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_FULL_DOWNLOAD_RETRIES_DESC "Number of times we retried the full snapshot download because the peer was too slow"
 #define FD_METRICS_GAUGE_SNAPCT_FULL_DOWNLOAD_RETRIES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_READ_OFF  (23UL)
+#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_READ_OFF  (42UL)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_READ_NAME "snapct_incremental_bytes_read"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_READ_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_READ_DESC "Number of bytes read so far from the incremental snapshot. Might decrease if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_READ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_WRITTEN_OFF  (24UL)
+#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_WRITTEN_OFF  (43UL)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_WRITTEN_NAME "snapct_incremental_bytes_written"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_WRITTEN_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_WRITTEN_DESC "Number of bytes written so far from the incremental snapshot. Might decrease if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_WRITTEN_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_TOTAL_OFF  (25UL)
+#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_TOTAL_OFF  (44UL)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_TOTAL_NAME "snapct_incremental_bytes_total"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_TOTAL_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_TOTAL_DESC "Total size of the incremental snapshot file. Might change if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_BYTES_TOTAL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_DOWNLOAD_RETRIES_OFF  (26UL)
+#define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_DOWNLOAD_RETRIES_OFF  (45UL)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_DOWNLOAD_RETRIES_NAME "snapct_incremental_download_retries"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_DOWNLOAD_RETRIES_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_DOWNLOAD_RETRIES_DESC "Number of times we retried the incremental snapshot download because the peer was too slow"
 #define FD_METRICS_GAUGE_SNAPCT_INCREMENTAL_DOWNLOAD_RETRIES_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_PREDICTED_SLOT_OFF  (27UL)
+#define FD_METRICS_GAUGE_SNAPCT_PREDICTED_SLOT_OFF  (46UL)
 #define FD_METRICS_GAUGE_SNAPCT_PREDICTED_SLOT_NAME "snapct_predicted_slot"
 #define FD_METRICS_GAUGE_SNAPCT_PREDICTED_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_PREDICTED_SLOT_DESC "The predicted slot from which replay starts after snapshot loading finishes. Might change if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPCT_PREDICTED_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_GOSSIP_FRESH_COUNT_OFF  (28UL)
+#define FD_METRICS_GAUGE_SNAPCT_GOSSIP_FRESH_COUNT_OFF  (47UL)
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_FRESH_COUNT_NAME "snapct_gossip_fresh_count"
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_FRESH_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_FRESH_COUNT_DESC "Number of fresh gossip peers seen when collecting gossip peers."
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_FRESH_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPCT_GOSSIP_TOTAL_COUNT_OFF  (29UL)
+#define FD_METRICS_GAUGE_SNAPCT_GOSSIP_TOTAL_COUNT_OFF  (48UL)
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_TOTAL_COUNT_NAME "snapct_gossip_total_count"
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_TOTAL_COUNT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_TOTAL_COUNT_DESC "Number of total gossip peers seen when collecting gossip peers."
 #define FD_METRICS_GAUGE_SNAPCT_GOSSIP_TOTAL_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SNAPCT_SSL_ALLOC_ERRORS_OFF  (30UL)
+#define FD_METRICS_COUNTER_SNAPCT_SSL_ALLOC_ERRORS_OFF  (49UL)
 #define FD_METRICS_COUNTER_SNAPCT_SSL_ALLOC_ERRORS_NAME "snapct_ssl_alloc_errors"
 #define FD_METRICS_COUNTER_SNAPCT_SSL_ALLOC_ERRORS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SNAPCT_SSL_ALLOC_ERRORS_DESC "Number of SSL allocation errors encountered."
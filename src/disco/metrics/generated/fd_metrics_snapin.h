@@ -6,37 +6,37 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_SNAPIN_STATE_OFF  (16UL)
+#define FD_METRICS_GAUGE_SNAPIN_STATE_OFF  (35UL)
 #define FD_METRICS_GAUGE_SNAPIN_STATE_NAME "snapin_state"
 #define FD_METRICS_GAUGE_SNAPIN_STATE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPIN_STATE_DESC "State of the tile. 0=IDLE, 1=PROCESSING, 2=FINISHING, 3=ERROR, 4=SHUTDOWN"
 #define FD_METRICS_GAUGE_SNAPIN_STATE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPIN_FULL_BYTES_READ_OFF  (17UL)
+#define FD_METRICS_GAUGE_SNAPIN_FULL_BYTES_READ_OFF  (36UL)
 #define FD_METRICS_GAUGE_SNAPIN_FULL_BYTES_READ_NAME "snapin_full_bytes_read"
 #define FD_METRICS_GAUGE_SNAPIN_FULL_BYTES_READ_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPIN_FULL_BYTES_READ_DESC "Number of bytes read so far from the full snapshot. Might decrease if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPIN_FULL_BYTES_READ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPIN_INCREMENTAL_BYTES_READ_OFF  (18UL)
+#define FD_METRICS_GAUGE_SNAPIN_INCREMENTAL_BYTES_READ_OFF  (37UL)
 #define FD_METRICS_GAUGE_SNAPIN_INCREMENTAL_BYTES_READ_NAME "snapin_incremental_bytes_read"
 #define FD_METRICS_GAUGE_SNAPIN_INCREMENTAL_BYTES_READ_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPIN_INCREMENTAL_BYTES_READ_DESC "Number of bytes read so far from the incremental snapshot. Might decrease if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPIN_INCREMENTAL_BYTES_READ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_LOADED_OFF  (19UL)
+#define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_LOADED_OFF  (38UL)
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_LOADED_NAME "snapin_accounts_loaded"
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_LOADED_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_LOADED_DESC "Number of accounts seen during snapshot loading. Includes duplicates. Resets if snapshot load restarts"
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_LOADED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_REPLACED_OFF  (20UL)
+#define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_REPLACED_OFF  (39UL)
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_REPLACED_NAME "snapin_accounts_replaced"
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_REPLACED_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_REPLACED_DESC "Number of previously inserted accounts replaced by a later duplicate. Resets if snapshot load restarts"
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_REPLACED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_IGNORED_OFF  (21UL)
+#define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_IGNORED_OFF  (40UL)
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_IGNORED_NAME "snapin_accounts_ignored"
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_IGNORED_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPIN_ACCOUNTS_IGNORED_DESC "Number of stale duplicate accounts dropped because a previously inserted account was newer. Resets if snapshot load restarts"
@@ -6,19 +6,19 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_SNAPLA_STATE_OFF  (16UL)
+#define FD_METRICS_GAUGE_SNAPLA_STATE_OFF  (35UL)
 #define FD_METRICS_GAUGE_SNAPLA_STATE_NAME "snapla_state"
 #define FD_METRICS_GAUGE_SNAPLA_STATE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPLA_STATE_DESC "State of the tile. 0=IDLE, 1=PROCESSING, 2=FINISHING, 3=ERROR, 4=SHUTDOWN"
 #define FD_METRICS_GAUGE_SNAPLA_STATE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPLA_FULL_ACCOUNTS_HASHED_OFF  (17UL)
+#define FD_METRICS_GAUGE_SNAPLA_FULL_ACCOUNTS_HASHED_OFF  (36UL)
 #define FD_METRICS_GAUGE_SNAPLA_FULL_ACCOUNTS_HASHED_NAME "snapla_full_accounts_hashed"
 #define FD_METRICS_GAUGE_SNAPLA_FULL_ACCOUNTS_HASHED_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPLA_FULL_ACCOUNTS_HASHED_DESC "Number of accounts hashed for the full snapshot during snapshot loading. Might decrease if snapshot load is aborted and restarted"
 #define FD_METRICS_GAUGE_SNAPLA_FULL_ACCOUNTS_HASHED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_SNAPLA_INCREMENTAL_ACCOUNTS_HASHED_OFF  (18UL)
+#define FD_METRICS_GAUGE_SNAPLA_INCREMENTAL_ACCOUNTS_HASHED_OFF  (37UL)
 #define FD_METRICS_GAUGE_SNAPLA_INCREMENTAL_ACCOUNTS_HASHED_NAME "snapla_incremental_accounts_hashed"
 #define FD_METRICS_GAUGE_SNAPLA_INCREMENTAL_ACCOUNTS_HASHED_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPLA_INCREMENTAL_ACCOUNTS_HASHED_DESC "Number of accounts hashed for the incremental snapshot during snapshot loading. Might decrease if snapshot load is aborted and restarted"
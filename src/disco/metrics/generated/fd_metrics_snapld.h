@@ -6,13 +6,13 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_SNAPLD_STATE_OFF  (16UL)
+#define FD_METRICS_GAUGE_SNAPLD_STATE_OFF  (35UL)
 #define FD_METRICS_GAUGE_SNAPLD_STATE_NAME "snapld_state"
 #define FD_METRICS_GAUGE_SNAPLD_STATE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_SNAPLD_STATE_DESC "State of the tile. 0=IDLE, 1=PROCESSING, 2=FINISHING, 3=ERROR, 4=SHUTDOWN"
 #define FD_METRICS_GAUGE_SNAPLD_STATE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SNAPLD_SSL_ALLOC_ERRORS_OFF  (17UL)
+#define FD_METRICS_COUNTER_SNAPLD_SSL_ALLOC_ERRORS_OFF  (36UL)
 #define FD_METRICS_COUNTER_SNAPLD_SSL_ALLOC_ERRORS_NAME "snapld_ssl_alloc_errors"
 #define FD_METRICS_COUNTER_SNAPLD_SSL_ALLOC_ERRORS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SNAPLD_SSL_ALLOC_ERRORS_DESC "Number of SSL allocation errors encountered."
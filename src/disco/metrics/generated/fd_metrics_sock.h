@@ -6,51 +6,51 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_OFF  (16UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_OFF  (35UL)
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_NAME "sock_syscalls_sendmmsg"
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_DESC "Number of sendmmsg syscalls dispatched"
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_CNT  (6UL)
 
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_NO_ERROR_OFF (16UL)
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_SLOW_OFF (17UL)
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_PERM_OFF (18UL)
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_UNREACH_OFF (19UL)
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_DOWN_OFF (20UL)
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_OTHER_OFF (21UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_NO_ERROR_OFF (35UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_SLOW_OFF (36UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_PERM_OFF (37UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_UNREACH_OFF (38UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_DOWN_OFF (39UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_SENDMMSG_OTHER_OFF (40UL)
 
-#define FD_METRICS_COUNTER_SOCK_SYSCALLS_RECVMMSG_OFF  (22UL)
+#define FD_METRICS_COUNTER_SOCK_SYSCALLS_RECVMMSG_OFF  (41UL)
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_RECVMMSG_NAME "sock_syscalls_recvmmsg"
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_RECVMMSG_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_RECVMMSG_DESC "Number of recvmsg syscalls dispatched"
 #define FD_METRICS_COUNTER_SOCK_SYSCALLS_RECVMMSG_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SOCK_RX_PKT_CNT_OFF  (23UL)
+#define FD_METRICS_COUNTER_SOCK_RX_PKT_CNT_OFF  (42UL)
 #define FD_METRICS_COUNTER_SOCK_RX_PKT_CNT_NAME "sock_rx_pkt_cnt"
 #define FD_METRICS_COUNTER_SOCK_RX_PKT_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SOCK_RX_PKT_CNT_DESC "Number of packets received"
 #define FD_METRICS_COUNTER_SOCK_RX_PKT_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SOCK_TX_PKT_CNT_OFF  (24UL)
+#define FD_METRICS_COUNTER_SOCK_TX_PKT_CNT_OFF  (43UL)
 #define FD_METRICS_COUNTER_SOCK_TX_PKT_CNT_NAME "sock_tx_pkt_cnt"
 #define FD_METRICS_COUNTER_SOCK_TX_PKT_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SOCK_TX_PKT_CNT_DESC "Number of packets sent"
 #define FD_METRICS_COUNTER_SOCK_TX_PKT_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_OFF  (25UL)
+#define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_OFF  (44UL)
 #define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_NAME "sock_tx_drop_cnt"
 #define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_DESC "Number of packets failed to send"
 #define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SOCK_TX_BYTES_TOTAL_OFF  (26UL)
+#define FD_METRICS_COUNTER_SOCK_TX_BYTES_TOTAL_OFF  (45UL)
 #define FD_METRICS_COUNTER_SOCK_TX_BYTES_TOTAL_NAME "sock_tx_bytes_total"
 #define FD_METRICS_COUNTER_SOCK_TX_BYTES_TOTAL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SOCK_TX_BYTES_TOTAL_DESC "Total number of bytes transmitted (including Ethernet header)."
 #define FD_METRICS_COUNTER_SOCK_TX_BYTES_TOTAL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_SOCK_RX_BYTES_TOTAL_OFF  (27UL)
+#define FD_METRICS_COUNTER_SOCK_RX_BYTES_TOTAL_OFF  (46UL)
 #define FD_METRICS_COUNTER_SOCK_RX_BYTES_TOTAL_NAME "sock_rx_bytes_total"
 #define FD_METRICS_COUNTER_SOCK_RX_BYTES_TOTAL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_SOCK_RX_BYTES_TOTAL_DESC "Total number of bytes received (including Ethernet header)."
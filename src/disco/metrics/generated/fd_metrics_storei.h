@@ -6,13 +6,13 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_GAUGE_STOREI_FIRST_TURBINE_SLOT_OFF  (16UL)
+#define FD_METRICS_GAUGE_STOREI_FIRST_TURBINE_SLOT_OFF  (35UL)
 #define FD_METRICS_GAUGE_STOREI_FIRST_TURBINE_SLOT_NAME "storei_first_turbine_slot"
 #define FD_METRICS_GAUGE_STOREI_FIRST_TURBINE_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_STOREI_FIRST_TURBINE_SLOT_DESC ""
 #define FD_METRICS_GAUGE_STOREI_FIRST_TURBINE_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_STOREI_CURRENT_TURBINE_SLOT_OFF  (17UL)
+#define FD_METRICS_GAUGE_STOREI_CURRENT_TURBINE_SLOT_OFF  (36UL)
 #define FD_METRICS_GAUGE_STOREI_CURRENT_TURBINE_SLOT_NAME "storei_current_turbine_slot"
 #define FD_METRICS_GAUGE_STOREI_CURRENT_TURBINE_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_STOREI_CURRENT_TURBINE_SLOT_DESC ""
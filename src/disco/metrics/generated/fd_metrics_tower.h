@@ -6,91 +6,91 @@
 #include "../fd_metrics_base.h"
 #include "fd_metrics_enums.h"
 
-#define FD_METRICS_COUNTER_TOWER_VOTE_TXN_INVALID_OFF  (16UL)
+#define FD_METRICS_COUNTER_TOWER_VOTE_TXN_INVALID_OFF  (35UL)
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_INVALID_NAME "tower_vote_txn_invalid"
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_INVALID_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_INVALID_DESC "Number of times we dropped a vote txn because it was invalid (malformed, bad signature, etc.)"
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_INVALID_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_VOTE_TXN_IGNORED_OFF  (17UL)
+#define FD_METRICS_COUNTER_TOWER_VOTE_TXN_IGNORED_OFF  (36UL)
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_IGNORED_NAME "tower_vote_txn_ignored"
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_IGNORED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_IGNORED_DESC "Number of times we ignored all or part of a vote txn because we didn't recognize a slot (eg. our replay was behind)"
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_IGNORED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_VOTE_TXN_MISMATCH_OFF  (18UL)
+#define FD_METRICS_COUNTER_TOWER_VOTE_TXN_MISMATCH_OFF  (37UL)
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_MISMATCH_NAME "tower_vote_txn_mismatch"
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_MISMATCH_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_MISMATCH_DESC "Number of times a vote txn mismatched our own block id"
 #define FD_METRICS_COUNTER_TOWER_VOTE_TXN_MISMATCH_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_ANCESTOR_ROLLBACK_OFF  (19UL)
+#define FD_METRICS_COUNTER_TOWER_ANCESTOR_ROLLBACK_OFF  (38UL)
 #define FD_METRICS_COUNTER_TOWER_ANCESTOR_ROLLBACK_NAME "tower_ancestor_rollback"
 #define FD_METRICS_COUNTER_TOWER_ANCESTOR_ROLLBACK_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_ANCESTOR_ROLLBACK_DESC "Rollback to an ancestor of our prev vote (can't vote)"
 #define FD_METRICS_COUNTER_TOWER_ANCESTOR_ROLLBACK_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_SIBLING_CONFIRMED_OFF  (20UL)
+#define FD_METRICS_COUNTER_TOWER_SIBLING_CONFIRMED_OFF  (39UL)
 #define FD_METRICS_COUNTER_TOWER_SIBLING_CONFIRMED_NAME "tower_sibling_confirmed"
 #define FD_METRICS_COUNTER_TOWER_SIBLING_CONFIRMED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_SIBLING_CONFIRMED_DESC "Duplicate sibling got confirmed (can't vote)"
 #define FD_METRICS_COUNTER_TOWER_SIBLING_CONFIRMED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_SAME_FORK_OFF  (21UL)
+#define FD_METRICS_COUNTER_TOWER_SAME_FORK_OFF  (40UL)
 #define FD_METRICS_COUNTER_TOWER_SAME_FORK_NAME "tower_same_fork"
 #define FD_METRICS_COUNTER_TOWER_SAME_FORK_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_SAME_FORK_DESC "Same fork as prev vote (can vote)"
 #define FD_METRICS_COUNTER_TOWER_SAME_FORK_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_SWITCH_PASS_OFF  (22UL)
+#define FD_METRICS_COUNTER_TOWER_SWITCH_PASS_OFF  (41UL)
 #define FD_METRICS_COUNTER_TOWER_SWITCH_PASS_NAME "tower_switch_pass"
 #define FD_METRICS_COUNTER_TOWER_SWITCH_PASS_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_SWITCH_PASS_DESC "Prev vote was on a different fork, but we are allowed to switch (can vote)"
 #define FD_METRICS_COUNTER_TOWER_SWITCH_PASS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_SWITCH_FAIL_OFF  (23UL)
+#define FD_METRICS_COUNTER_TOWER_SWITCH_FAIL_OFF  (42UL)
 #define FD_METRICS_COUNTER_TOWER_SWITCH_FAIL_NAME "tower_switch_fail"
 #define FD_METRICS_COUNTER_TOWER_SWITCH_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_SWITCH_FAIL_DESC "Prev vote was on a different fork, and we are not allowed to switch (can't vote)"
 #define FD_METRICS_COUNTER_TOWER_SWITCH_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_LOCKOUT_FAIL_OFF  (24UL)
+#define FD_METRICS_COUNTER_TOWER_LOCKOUT_FAIL_OFF  (43UL)
 #define FD_METRICS_COUNTER_TOWER_LOCKOUT_FAIL_NAME "tower_lockout_fail"
 #define FD_METRICS_COUNTER_TOWER_LOCKOUT_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_LOCKOUT_FAIL_DESC "Locked out (can't vote)"
 #define FD_METRICS_COUNTER_TOWER_LOCKOUT_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_THRESHOLD_FAIL_OFF  (25UL)
+#define FD_METRICS_COUNTER_TOWER_THRESHOLD_FAIL_OFF  (44UL)
 #define FD_METRICS_COUNTER_TOWER_THRESHOLD_FAIL_NAME "tower_threshold_fail"
 #define FD_METRICS_COUNTER_TOWER_THRESHOLD_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_THRESHOLD_FAIL_DESC "Did not pass threshold check (can't vote)"
 #define FD_METRICS_COUNTER_TOWER_THRESHOLD_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_PROPAGATED_FAIL_OFF  (26UL)
+#define FD_METRICS_COUNTER_TOWER_PROPAGATED_FAIL_OFF  (45UL)
 #define FD_METRICS_COUNTER_TOWER_PROPAGATED_FAIL_NAME "tower_propagated_fail"
 #define FD_METRICS_COUNTER_TOWER_PROPAGATED_FAIL_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_PROPAGATED_FAIL_DESC "Prev leader block did not propagate (can't vote)"
 #define FD_METRICS_COUNTER_TOWER_PROPAGATED_FAIL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_HARD_FORKS_SEEN_OFF  (27UL)
+#define FD_METRICS_COUNTER_TOWER_HARD_FORKS_SEEN_OFF  (46UL)
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_SEEN_NAME "tower_hard_forks_seen"
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_SEEN_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_SEEN_DESC "Number of hard forks we've seen (block ids with multiple candidate bank hashes)"
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_SEEN_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_HARD_FORKS_PRUNED_OFF  (28UL)
+#define FD_METRICS_COUNTER_TOWER_HARD_FORKS_PRUNED_OFF  (47UL)
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_PRUNED_NAME "tower_hard_forks_pruned"
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_PRUNED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_PRUNED_DESC "Number of hard forks (candidate bank hashes) we've pruned"
 #define FD_METRICS_COUNTER_TOWER_HARD_FORKS_PRUNED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_TOWER_HARD_FORKS_ACTIVE_OFF  (29UL)
+#define FD_METRICS_GAUGE_TOWER_HARD_FORKS_ACTIVE_OFF  (48UL)
 #define FD_METRICS_GAUGE_TOWER_HARD_FORKS_ACTIVE_NAME "tower_hard_forks_active"
 #define FD_METRICS_GAUGE_TOWER_HARD_FORKS_ACTIVE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_TOWER_HARD_FORKS_ACTIVE_DESC "Currently active hard forks"
 #define FD_METRICS_GAUGE_TOWER_HARD_FORKS_ACTIVE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_TOWER_SLOT_IGNORED_OFF  (30UL)
+#define FD_METRICS_COUNTER_TOWER_SLOT_IGNORED_OFF  (49UL)
 #define FD_METRICS_COUNTER_TOWER_SLOT_IGNORED_NAME "tower_slot_ignored"
 #define FD_METRICS_COUNTER_TOWER_SLOT_IGNORED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_TOWER_SLOT_IGNORED_DESC "Number of times we ignored a slot likely due to minority fork publish"
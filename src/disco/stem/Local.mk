@@ -0,0 +1,16 @@
+$(call make-unit-test,test_stem_idle,test_stem_idle,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_stem_idle)
+$(call make-unit-test,test_stem_mp,test_stem_mp,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_stem_mp)
+ifdef FD_HAS_ALLOCA
+$(call make-unit-test,test_stem_lat,test_stem_lat,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_stem_lat)
+$(call make-unit-test,test_stem_regime,test_stem_regime,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_stem_regime)
+endif
+
+ifdef FD_HAS_HOSTED
+ifdef FD_HAS_ALLOCA
+$(call make-unit-test,bench_stem_batch,bench_stem_batch,fd_disco fd_tango fd_util)
+endif
+endif
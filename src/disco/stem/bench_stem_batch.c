@@ -0,0 +1,246 @@
+/* bench_stem_batch measures the frag consume rate of a dedup-like
+   stem consumer, with frags delivered one at a time (DURING_FRAG) vs
+   in batches (DURING_FRAG_BATCH).  The run loop is single threaded:
+   the BEFORE_CREDIT callback plays the part of the upstream producer
+   and publishes synthetic transaction signatures into the in mcache,
+   keeping up to half the mcache depth outstanding.  The consumer
+   hashes each 64 byte signature and inserts it into a tcache, as the
+   dedup tile does.  Producer overhead is the same for both modes. */
+
+#include "fd_stem.h"
+#include "../metrics/fd_metrics.h"
+
+#define DEPTH        (4096UL)
+#define TCACHE_DEPTH ((1UL<<20)-2UL)
+
+struct bench_ctx {
+  fd_frag_meta_t * mcache;
+  uchar *          dcache;
+  ulong            tx_seq;
+  ulong            rx_cnt;
+  ulong            rx_max;
+  ulong            pub_max;
+  ulong            seed;
+  ulong            dup_cnt;
+  ulong            batch_cnt;
+
+  ulong            tcache_depth;
+  ulong            tcache_map_cnt;
+  ulong *          tcache_sync;
+  ulong *          tcache_ring;
+  ulong *          tcache_map;
+};
+
+typedef struct bench_ctx bench_ctx_t;
+
+static uchar mcache_mem[ FD_MCACHE_FOOTPRINT( DEPTH, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+static uchar fseq_mem  [ FD_FSEQ_FOOTPRINT                 ] __attribute__((aligned(FD_FSEQ_ALIGN)));
+static uchar dcache_mem[ DEPTH*FD_CHUNK_SZ                 ] __attribute__((aligned(FD_CHUNK_ALIGN)));
+static uchar metrics_mem[ FD_METRICS_FOOTPRINT( 1UL, 0UL ) ] __attribute__((aligned(FD_METRICS_ALIGN)));
+
+static int
+should_shutdown( bench_ctx_t * ctx ) {
+  return ctx->rx_cnt>=ctx->rx_max;
+}
+
+static void
+before_credit( bench_ctx_t *       ctx,
+               fd_stem_context_t * stem,
+               int *               charge_busy ) {
+  (void)stem; (void)charge_busy;
+
+  /* Every 4th signature repeats the one published 1023 frags earlier
+     to give the tcache a realistic mix of duplicates */
+  ulong pub_cnt = 0UL;
+  while( (ctx->tx_seq-ctx->rx_cnt)<DEPTH/2UL && pub_cnt<ctx->pub_max ) {
+    ulong   seq   = ctx->tx_seq;
+    ulong   chunk = seq & (DEPTH-1UL);
+    ulong * sig   = (ulong *)fd_chunk_to_laddr( ctx->dcache, chunk );
+    ulong   tag   = (seq & 3UL) ? seq : (seq-1023UL);
+    sig[0] = tag; sig[1] = ~tag; sig[2] = tag*0x9e3779b97f4a7c15UL; sig[3] = tag^0x5555UL;
+    fd_mcache_publish( ctx->mcache, DEPTH, seq, 0UL, chunk, 64UL, 0UL, 0UL, 0UL );
+    ctx->tx_seq = seq+1UL;
+    pub_cnt++;
+  }
+}
+
+static inline void
+dedup_one( bench_ctx_t * ctx,
+           ulong         tag ) {
+  int is_dup;
+  FD_TCACHE_INSERT( is_dup, *ctx->tcache_sync, ctx->tcache_ring, ctx->tcache_depth, ctx->tcache_map, ctx->tcache_map_cnt, tag );
+  ctx->dup_cnt += (ulong)is_dup;
+}
+
+static inline void
+during_frag( bench_ctx_t * ctx,
+             ulong         in_idx,
+             ulong         seq,
+             ulong         sig,
+             ulong         chunk,
+             ulong         sz,
+             ulong         ctl ) {
+  (void)in_idx; (void)sig; (void)ctl;
+  FD_TEST( seq==ctx->rx_cnt );
+  dedup_one( ctx, fd_hash( ctx->seed, fd_chunk_to_laddr_const( ctx->dcache, chunk ), sz ) );
+  ctx->rx_cnt++;
+}
+
+static inline void
+during_frag_batch( bench_ctx_t *          ctx,
+                   ulong                  in_idx,
+                   fd_frag_meta_t const * meta,
+                   ulong                  meta_cnt ) {
+  (void)in_idx;
+  FD_TEST( meta[0].seq==ctx->rx_cnt );
+
+  /* Hash the whole batch first so the hashes of independent frags
+     overlap, then prefetch the tcache map slots before inserting. */
+  ulong tag[ 64 ];
+  for( ulong i=0UL; i<meta_cnt; i++ ) {
+    tag[ i ] = fd_hash( ctx->seed, fd_chunk_to_laddr_const( ctx->dcache, meta[i].chunk ), meta[i].sz );
+    __builtin_prefetch( ctx->tcache_map + fd_tcache_map_start( tag[ i ], ctx->tcache_map_cnt ) );
+  }
+  for( ulong i=0UL; i<meta_cnt; i++ ) dedup_one( ctx, tag[ i ] );
+
+  ctx->rx_cnt += meta_cnt;
+  ctx->batch_cnt++;
+}
+
+#define STEM_BURST                    (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE    bench_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN   alignof(bench_ctx_t)
+
+#define STEM_NAME                     stem_single
+#define STEM_CALLBACK_SHOULD_SHUTDOWN should_shutdown
+#define STEM_CALLBACK_BEFORE_CREDIT   before_credit
+#define STEM_CALLBACK_DURING_FRAG     during_frag
+#include "fd_stem.c"
+
+/* Instantiate the batched stem at a few batch sizes */
+
+#define STEM_BURST                      (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE      bench_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN     alignof(bench_ctx_t)
+#define STEM_FRAG_BATCH_MAX             (4UL)
+#define STEM_NAME                       stem_batch4
+#define STEM_CALLBACK_SHOULD_SHUTDOWN   should_shutdown
+#define STEM_CALLBACK_BEFORE_CREDIT     before_credit
+#define STEM_CALLBACK_DURING_FRAG_BATCH during_frag_batch
+#include "fd_stem.c"
+
+#define STEM_BURST                      (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE      bench_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN     alignof(bench_ctx_t)
+#define STEM_FRAG_BATCH_MAX             (16UL)
+#define STEM_NAME                       stem_batch16
+#define STEM_CALLBACK_SHOULD_SHUTDOWN   should_shutdown
+#define STEM_CALLBACK_BEFORE_CREDIT     before_credit
+#define STEM_CALLBACK_DURING_FRAG_BATCH during_frag_batch
+#include "fd_stem.c"
+
+#define STEM_BURST                      (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE      bench_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN     alignof(bench_ctx_t)
+#define STEM_FRAG_BATCH_MAX             (64UL)
+#define STEM_NAME                       stem_batch64
+#define STEM_CALLBACK_SHOULD_SHUTDOWN   should_shutdown
+#define STEM_CALLBACK_BEFORE_CREDIT     before_credit
+#define STEM_CALLBACK_DURING_FRAG_BATCH during_frag_batch
+#include "fd_stem.c"
+
+static void
+bench( ulong         batch_max,
+       bench_ctx_t * ctx,
+       ulong         frag_cnt,
+       ulong         pub_max,
+       void *        tcache_mem,
+       fd_rng_t *    rng ) {
+  ctx->mcache    = fd_mcache_join( fd_mcache_new( mcache_mem, DEPTH, 0UL, 0UL ) ); FD_TEST( ctx->mcache );
+  ctx->dcache    = dcache_mem;
+  ctx->tx_seq    = 0UL;
+  ctx->rx_cnt    = 0UL;
+  ctx->rx_max    = frag_cnt;
+  ctx->pub_max   = pub_max;
+  ctx->seed      = 0x1234UL;
+  ctx->dup_cnt   = 0UL;
+  ctx->batch_cnt = 0UL;
+
+  fd_tcache_t * tcache = fd_tcache_join( fd_tcache_new( tcache_mem, TCACHE_DEPTH, 0UL ) ); FD_TEST( tcache );
+  ctx->tcache_depth   = fd_tcache_depth       ( tcache );
+  ctx->tcache_map_cnt = fd_tcache_map_cnt     ( tcache );
+  ctx->tcache_sync    = fd_tcache_oldest_laddr( tcache );
+  ctx->tcache_ring    = fd_tcache_ring_laddr  ( tcache );
+  ctx->tcache_map     = fd_tcache_map_laddr   ( tcache );
+
+  ulong * fseq = fd_fseq_join( fd_fseq_new( fseq_mem, 0UL ) ); FD_TEST( fseq );
+  fd_metrics_register( fd_metrics_new( metrics_mem, 1UL, 0UL ) );
+
+  fd_frag_meta_t const * in_mcache[1] = { ctx->mcache };
+  ulong *                in_fseq  [1] = { fseq };
+
+# define RUN( name ) name##_run1( 1UL, in_mcache, in_fseq, 0UL, NULL, NULL, 0UL, NULL, NULL, 1UL, 0L, 0UL, NULL, rng, \
+                                  fd_alloca( FD_STEM_SCRATCH_ALIGN, name##_scratch_footprint( 1UL, 0UL, 0UL ) ), ctx )
+  long dt = -fd_log_wallclock();
+  switch( batch_max ) {
+  case  1UL: RUN( stem_single  ); break;
+  case  4UL: RUN( stem_batch4  ); break;
+  case 16UL: RUN( stem_batch16 ); break;
+  case 64UL: RUN( stem_batch64 ); break;
+  default: FD_LOG_ERR(( "unsupported batch_max %lu", batch_max ));
+  }
+  dt += fd_log_wallclock();
+# undef RUN
+
+  FD_TEST( ctx->rx_cnt==ctx->rx_max );
+  FD_TEST( ctx->dup_cnt );
+  FD_TEST( fd_metrics_link_in( fd_metrics_base_tl, 0UL )[ FD_METRICS_COUNTER_LINK_CONSUMED_COUNT_OFF ]<=frag_cnt );
+
+  FD_LOG_NOTICE(( "batch_max %2lu: %7.3f Mfrag/s (avg batch %5.2f)",
+                  batch_max, 1e3*(double)frag_cnt/(double)dt,
+                  batch_max>1UL ? (double)frag_cnt/(double)ctx->batch_cnt : 1. ));
+
+  fd_fseq_delete  ( fd_fseq_leave  ( fseq        ) );
+  fd_tcache_delete( fd_tcache_leave( tcache      ) );
+  fd_mcache_delete( fd_mcache_leave( ctx->mcache ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong cpu_idx = fd_tile_cpu_id( fd_tile_idx() );
+  if( cpu_idx>fd_shmem_cpu_cnt() ) cpu_idx = 0UL;
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "gigantic"                   );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL                          );
+  ulong        numa_idx = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx", NULL, fd_shmem_numa_idx( cpu_idx ) );
+  ulong        frag_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--frag-cnt", NULL, 10000000UL                   );
+  ulong        pub_max  = fd_env_strip_cmdline_ulong( &argc, &argv, "--pub-max",  NULL, 64UL                         );
+
+  FD_LOG_NOTICE(( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)", page_cnt, _page_sz, numa_idx ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+
+  void * tcache_mem = fd_wksp_alloc_laddr( wksp, fd_tcache_align(), fd_tcache_footprint( TCACHE_DEPTH, 0UL ), 1UL );
+  FD_TEST( tcache_mem );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  FD_LOG_NOTICE(( "Benchmarking dedup-like consumer (--frag-cnt %lu --pub-max %lu)", frag_cnt, pub_max ));
+
+  bench_ctx_t ctx[1];
+  bench(  1UL, ctx, frag_cnt, pub_max, tcache_mem, rng );
+  bench(  4UL, ctx, frag_cnt, pub_max, tcache_mem, rng );
+  bench( 16UL, ctx, frag_cnt, pub_max, tcache_mem, rng );
+  bench( 64UL, ctx, frag_cnt, pub_max, tcache_mem, rng );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_wksp_free_laddr( tcache_mem );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
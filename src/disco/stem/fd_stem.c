@@ -160,6 +160,31 @@
    mcache fragment that was received.  If the producer is not respecting
    flow control, these may be corrupt or torn and should not be trusted.
 
+      DURING_FRAG_BATCH
+   An alternative to DURING_FRAG for tiles that want to process a burst
+   of frags at once (e.g. to vectorize hashing or interleave memory
+   prefetches across frags).  When a new frag is detected on an in, the
+   stem gathers it and up to STEM_FRAG_BATCH_MAX-1 following frags from
+   the same in that have already been published (stopping at the first
+   frag that is not yet ready), copies their metadata into a local
+   array and passes the array to this callback in a single call.  meta
+   points to meta_cnt (in [1,STEM_FRAG_BATCH_MAX]) frag metadata
+   entries in sequence order, the first of which has sequence number
+   seq.  The metadata copies are consistent (each entry was read
+   without being torn), but as with DURING_FRAG the frag data itself
+   may be overrun while the callback runs if the producer is not
+   respecting flow control.  After the callback returns, the stem checks
+   for overrun of the oldest frag of the batch (as the producer
+   publishes sequentially, this covers the entire batch).  If overrun,
+   the whole batch is abandoned.  Otherwise, AFTER_FRAG (if defined) is
+   invoked once per frag of the batch in sequence order.  The batch is
+   additionally limited to min_cr_avail/STEM_BURST frags, so a tile
+   that publishes at most STEM_BURST frags per AFTER_FRAG invocation
+   keeps honoring flow control.  BEFORE_FRAG, DURING_FRAG and
+   RETURNABLE_FRAG cannot be used together with DURING_FRAG_BATCH.
+   Tiles that want to filter frags should instead inspect the sig of
+   each meta entry in the batch callback.
+
       AFTER_POLL_OVERRUN
    Is called when an overrun is detected while polling for new frags.
    This callback is not called when an overrun is detected in
@@ -194,10 +219,24 @@
 #define STEM_LAZY (0L)
 #endif
 
+#ifdef STEM_CALLBACK_DURING_FRAG_BATCH
+#if defined(STEM_CALLBACK_BEFORE_FRAG) || defined(STEM_CALLBACK_DURING_FRAG) || defined(STEM_CALLBACK_RETURNABLE_FRAG)
+#error "STEM_CALLBACK_DURING_FRAG_BATCH cannot be combined with BEFORE_FRAG, DURING_FRAG or RETURNABLE_FRAG"
+#endif
+#ifndef STEM_FRAG_BATCH_MAX
+#define STEM_FRAG_BATCH_MAX (16UL)
+#endif
+#endif
+
 #define STEM_SHUTDOWN_SEQ (ULONG_MAX-1UL)
 
+/* STEM_(in_update) returns flow control credits to an in and drains
+   its diagnostics.  lat, if non-NULL, points to the in's publish and
+   origin latency histograms, which are also copied out. */
+
 static inline void
-STEM_(in_update)( fd_stem_tile_in_t * in ) {
+STEM_(in_update)( fd_stem_tile_in_t * in,
+                  fd_histf_t const *  lat ) {
   fd_fseq_update( in->fseq, in->seq );
 
   volatile ulong * metrics = fd_metrics_link_in( fd_metrics_base_tl, in->idx );
@@ -211,6 +250,33 @@ STEM_(in_update)( fd_stem_tile_in_t * in ) {
   FD_COMPILER_MFENCE();
   accum[0] = 0U;              accum[1] = 0U;              accum[2] = 0U;
   accum[3] = 0U;              accum[4] = 0U;              accum[5] = 0U;
+
+  if( FD_UNLIKELY( lat ) ) {
+    volatile ulong * pub  = metrics + FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_OFF;
+    volatile ulong * orig = metrics + FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_OFF;
+    FD_COMPILER_MFENCE();
+    for( ulong i=0UL; i<FD_HISTF_BUCKET_CNT; i++ ) {
+      pub [ i ] = lat[0].counts[ i ];
+      orig[ i ] = lat[1].counts[ i ];
+    }
+    pub [ FD_HISTF_BUCKET_CNT ] = lat[0].sum;
+    orig[ FD_HISTF_BUCKET_CNT ] = lat[1].sum;
+    FD_COMPILER_MFENCE();
+  }
+}
+
+/* STEM_(in_lat_sample) records the publish (tspub) and origin (tsorig)
+   latency of a frag consumed at time now into lat[0] and lat[1]
+   respectively.  Producers that do not stamp a timestamp leave it at
+   zero, and those are not sampled. */
+
+static inline void
+STEM_(in_lat_sample)( fd_histf_t * lat,
+                      ulong        tsorig,
+                      ulong        tspub,
+                      long         now ) {
+  if( FD_LIKELY( tspub  ) ) fd_histf_sample( lat+0, (ulong)fd_long_max( now - fd_frag_meta_ts_decomp( tspub,  now ), 0L ) );
+  if( FD_LIKELY( tsorig ) ) fd_histf_sample( lat+1, (ulong)fd_long_max( now - fd_frag_meta_ts_decomp( tsorig, now ), 0L ) );
 }
 
 FD_FN_PURE static inline ulong
@@ -236,17 +302,42 @@ STEM_(scratch_footprint)( ulong in_cnt,
   return FD_LAYOUT_FINI( l, STEM_(scratch_align)() );
 }
 
+/* STEM_(out_cr_max) returns the max flow control credits of an out,
+   which is the mcache depth, or this producer's credit share for a
+   multi-producer out. */
+
+FD_FN_PURE static inline ulong
+STEM_(out_cr_max)( ulong const *            out_depth,
+                   fd_stem_mp_out_t const * out_mp,
+                   ulong                    out_idx ) {
+  if( FD_UNLIKELY( out_mp && out_mp[ out_idx ].seq ) ) return out_mp[ out_idx ].own_mask+1UL;
+  return out_depth[ out_idx ];
+}
+
+/* out_mp is NULL if all outs have a single producer (the usual case).
+   Otherwise, out_mp[out_idx] for out_idx in [0,out_cnt) has the seq,
+   own and own_mask fields of a fd_stem_mp_out_t initialized for outs
+   that are multi-producer links and seq set to NULL for the others.
+
+   in_lat is NULL if per in link latency histograms are disabled.
+   Otherwise, it points to 2*in_cnt histograms (any contents, they are
+   formatted here), where in_lat[2*in_idx] and in_lat[2*in_idx+1] are
+   the publish and origin latency histograms of in_idx. */
+
 static inline void
 STEM_(run1)( ulong                        in_cnt,
              fd_frag_meta_t const **      in_mcache,
              ulong **                     in_fseq,
              ulong                        out_cnt,
              fd_frag_meta_t **            out_mcache,
+             fd_stem_mp_out_t *           out_mp,
              ulong                        cons_cnt,
              ulong *                      _cons_out,
              ulong **                     _cons_fseq,
              ulong                        burst,
              long                         lazy,
+             ulong                        idle_wake_ns,
+             fd_histf_t *                 in_lat,
              fd_rng_t *                   rng,
              void *                       scratch,
              STEM_CALLBACK_CONTEXT_TYPE * ctx ) {
@@ -280,6 +371,10 @@ STEM_(run1)( ulong                        in_cnt,
 
   ulong metric_regime_ticks[ FD_METRICS_ENUM_TILE_REGIME_CNT ]; /* How many ticks the tile has spent in each regime */
 
+  /* idle backoff state */
+  fd_stem_idle_t idle[1];
+  fd_histf_t     metric_idle_wake[1]; /* latency from publication to pickup of the first frag after an idle wait */
+
   if( FD_UNLIKELY( !scratch ) ) FD_LOG_ERR(( "NULL scratch" ));
   if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)scratch, STEM_(scratch_align)() ) ) ) FD_LOG_ERR(( "misaligned scratch" ));
 
@@ -289,6 +384,17 @@ STEM_(run1)( ulong                        in_cnt,
   metric_backp_cnt = 0UL;
   memset( metric_regime_ticks, 0, sizeof( metric_regime_ticks ) );
 
+  if( FD_UNLIKELY( idle_wake_ns>(ulong)1e9 ) ) FD_LOG_ERR(( "excessive stem idle_wake_ns value: %lu", idle_wake_ns ));
+  idle->wake_ticks = idle_wake_ns ? fd_long_max( (long)((double)idle_wake_ns*fd_tempo_tick_per_ns( NULL )), 1L ) : 0L;
+  idle->start      = 0L;
+  idle->waitpkg    = !!idle->wake_ticks && fd_stem_idle_has_waitpkg();
+  idle->waited     = 0;
+  idle->wait_cnt   = 0UL;
+  idle->wait_ticks = 0UL;
+  FD_TEST( fd_histf_join( fd_histf_new( metric_idle_wake, FD_MHIST_SECONDS_MIN( TILE, IDLE_WAKEUP_LATENCY_SECONDS ),
+                                                          FD_MHIST_SECONDS_MAX( TILE, IDLE_WAKEUP_LATENCY_SECONDS ) ) ) );
+  if( FD_UNLIKELY( idle->wake_ticks ) ) FD_LOG_INFO(( "Configuring idle backoff (wake %lu ns, umwait %d)", idle_wake_ns, idle->waitpkg ));
+
   /* in frag stream init */
 
   in_seq = 0UL; /* First in to poll */
@@ -318,6 +424,13 @@ STEM_(run1)( ulong                        in_cnt,
 
     this_in->accum[0] = 0U; this_in->accum[1] = 0U; this_in->accum[2] = 0U;
     this_in->accum[3] = 0U; this_in->accum[4] = 0U; this_in->accum[5] = 0U;
+
+    if( FD_UNLIKELY( in_lat ) ) {
+      FD_TEST( fd_histf_join( fd_histf_new( in_lat+2UL*in_idx,     FD_MHIST_SECONDS_MIN( LINK, PUBLISH_LATENCY_SECONDS ),
+                                                                   FD_MHIST_SECONDS_MAX( LINK, PUBLISH_LATENCY_SECONDS ) ) ) );
+      FD_TEST( fd_histf_join( fd_histf_new( in_lat+2UL*in_idx+1UL, FD_MHIST_SECONDS_MIN( LINK, ORIGIN_LATENCY_SECONDS ),
+                                                                   FD_MHIST_SECONDS_MAX( LINK, ORIGIN_LATENCY_SECONDS ) ) ) );
+    }
   }
 
   /* out frag stream init */
@@ -337,7 +450,17 @@ STEM_(run1)( ulong                        in_cnt,
     out_depth[ out_idx ] = fd_mcache_depth( out_mcache[ out_idx ] );
     out_seq[ out_idx ] = 0UL;
 
-    cr_avail[ out_idx ] = out_depth[ out_idx ];
+    if( FD_UNLIKELY( out_mp && out_mp[ out_idx ].seq ) ) {
+      fd_stem_mp_out_t * mp = &out_mp[ out_idx ];
+      if( FD_UNLIKELY( !mp->own ) ) FD_LOG_ERR(( "NULL out_mp[%lu].own", out_idx ));
+      if( FD_UNLIKELY( !fd_ulong_is_pow2( mp->own_mask+1UL ) || mp->own_mask>=out_depth[ out_idx ] ) )
+        FD_LOG_ERR(( "bad out_mp[%lu].own_mask %lu for depth %lu", out_idx, mp->own_mask, out_depth[ out_idx ] ));
+      mp->own_head = 0UL;
+      mp->own_tail = 0UL;
+      mp->own_scan = 0UL;
+    }
+
+    cr_avail[ out_idx ] = STEM_(out_cr_max)( out_depth, out_mp, out_idx );
   }
 
   cons_fseq = (ulong const **)FD_SCRATCH_ALLOC_APPEND( l, alignof(ulong const *), cons_cnt*sizeof(ulong const *) );
@@ -353,7 +476,7 @@ STEM_(run1)( ulong                        in_cnt,
     cons_slow[ cons_idx ] = (ulong*)(fd_metrics_link_out( fd_metrics_base_tl, cons_idx ) + FD_METRICS_COUNTER_LINK_SLOW_COUNT_OFF);
     cons_seq [ cons_idx ] = fd_fseq_query( _cons_fseq[ cons_idx ] );
 
-    cr_max = fd_ulong_min( cr_max, out_depth[ cons_out[ cons_idx ] ] );
+    cr_max = fd_ulong_min( cr_max, STEM_(out_cr_max)( out_depth, out_mp, cons_out[ cons_idx ] ) );
   }
 
   if( FD_UNLIKELY( burst>cr_max ) ) FD_LOG_ERR(( "one or more out links have insufficient depth for STEM_BURST %lu. cr_max is %lu", burst, cr_max ));
@@ -413,7 +536,7 @@ STEM_(run1)( ulong                        in_cnt,
         /* Send flow control credits and drain flow control diagnostics
            for in_idx. */
 
-        STEM_(in_update)( &in[ in_idx ] );
+        STEM_(in_update)( &in[ in_idx ], in_lat ? in_lat+2UL*in[ in_idx ].idx : NULL );
 
       } else { /* event_idx==cons_cnt, housekeeping event */
 
@@ -423,34 +546,54 @@ STEM_(run1)( ulong                        in_cnt,
         FD_MGAUGE_SET( TILE, IN_BACKPRESSURE,           metric_in_backp );
         FD_MCNT_INC  ( TILE, BACKPRESSURE_COUNT,        metric_backp_cnt );
         FD_MCNT_ENUM_COPY( TILE, REGIME_DURATION_NANOS, metric_regime_ticks );
+        FD_MCNT_INC  ( TILE, IDLE_WAIT_COUNT,           idle->wait_cnt );
+        FD_MCNT_INC  ( TILE, IDLE_WAIT_DURATION_NANOS,  idle->wait_ticks );
+        FD_MHIST_COPY( TILE, IDLE_WAKEUP_LATENCY_SECONDS, metric_idle_wake );
 #ifdef STEM_CALLBACK_METRICS_WRITE
         STEM_CALLBACK_METRICS_WRITE( ctx );
 #endif
         FD_COMPILER_MFENCE();
         metric_backp_cnt = 0UL;
+        idle->wait_cnt   = 0UL;
+        idle->wait_ticks = 0UL;
 
         /* Receive flow control credits */
         if( FD_LIKELY( min_cr_avail<cr_max ) ) {
           ulong slowest_cons = ULONG_MAX;
           min_cr_avail = cr_max;
           for( ulong out_idx=0; out_idx<out_cnt; out_idx++ ) {
-            cr_avail[ out_idx ] = out_depth[ out_idx ];
+            cr_avail[ out_idx ] = STEM_(out_cr_max)( out_depth, out_mp, out_idx );
+            if( FD_UNLIKELY( out_mp && out_mp[ out_idx ].seq ) ) out_mp[ out_idx ].own_scan = out_mp[ out_idx ].own_head;
           }
 
           for( ulong cons_idx=0UL; cons_idx<cons_cnt; cons_idx++ ) {
             ulong out_idx = cons_out[ cons_idx ];
-            ulong cons_cr_avail = (ulong)fd_long_max( (long)out_depth[ out_idx ]-fd_long_max( fd_seq_diff( out_seq[ out_idx ], cons_seq[ cons_idx ] ), 0L ), 0L );
+            ulong cons_cr_avail;
 
             /* If a reliable consumer exits, they can set the credit
                return fseq to STEM_SHUTDOWN_SEQ to indicate they are no
                longer actively consuming. */
-            cons_cr_avail = fd_ulong_if( cons_seq[ cons_idx ]==STEM_SHUTDOWN_SEQ, out_depth[ out_idx ], cons_cr_avail );
+            if( FD_UNLIKELY( cons_seq[ cons_idx ]==STEM_SHUTDOWN_SEQ ) ) {
+              cons_cr_avail = STEM_(out_cr_max)( out_depth, out_mp, out_idx );
+            } else if( FD_UNLIKELY( out_mp && out_mp[ out_idx ].seq ) ) {
+              cons_cr_avail = fd_stem_mp_cr_avail( &out_mp[ out_idx ], cons_seq[ cons_idx ] );
+            } else {
+              cons_cr_avail = (ulong)fd_long_max( (long)out_depth[ out_idx ]-fd_long_max( fd_seq_diff( out_seq[ out_idx ], cons_seq[ cons_idx ] ), 0L ), 0L );
+            }
             slowest_cons = fd_ulong_if( cons_cr_avail<min_cr_avail, cons_idx, slowest_cons );
 
             cr_avail[ out_idx ] = fd_ulong_min( cr_avail[ out_idx ], cons_cr_avail );
             min_cr_avail        = fd_ulong_min( cons_cr_avail, min_cr_avail );
           }
 
+          /* Forget reserved seqs of multi-producer outs that all the
+             reliable consumers have moved past */
+          if( FD_UNLIKELY( out_mp ) ) {
+            for( ulong out_idx=0; out_idx<out_cnt; out_idx++ ) {
+              if( out_mp[ out_idx ].seq ) out_mp[ out_idx ].own_tail = out_mp[ out_idx ].own_scan;
+            }
+          }
+
           /* See notes above about use of quasi-atomic diagnostic accum */
           if( FD_LIKELY( slowest_cons!=ULONG_MAX ) ) {
             FD_COMPILER_MFENCE();
@@ -508,6 +651,7 @@ STEM_(run1)( ulong                        in_cnt,
       .mcaches             = out_mcache,
       .depths              = out_depth,
       .seqs                = out_seq,
+      .mp_outs             = out_mp,
 
       .cr_avail            = cr_avail,
       .min_cr_avail        = &min_cr_avail,
@@ -558,6 +702,8 @@ STEM_(run1)( ulong                        in_cnt,
     if( FD_UNLIKELY( !in_cnt ) ) {
       int was_busy = charge_busy_before+charge_busy_after;
       metric_regime_ticks[0] += housekeeping_ticks;
+      if( FD_UNLIKELY( was_busy ) ) fd_stem_idle_busy( idle );
+      else                          fd_stem_idle_poll( idle, NULL, 0UL, now, then );
       long next = fd_tickcount();
       if( FD_UNLIKELY( was_busy ) ) metric_regime_ticks[3] += (ulong)(next - now);
       else                          metric_regime_ticks[6] += (ulong)(next - now);
@@ -615,10 +761,16 @@ STEM_(run1)( ulong                        in_cnt,
         finish_regime = &metric_regime_ticks[7];
         this_in->accum[ FD_METRICS_COUNTER_LINK_OVERRUN_POLLING_COUNT_OFF ]++;
         this_in->accum[ FD_METRICS_COUNTER_LINK_OVERRUN_POLLING_FRAG_COUNT_OFF ] += (uint)(-diff);
+        fd_stem_idle_busy( idle );
 
 #ifdef STEM_CALLBACK_AFTER_POLL_OVERRUN
         STEM_CALLBACK_AFTER_POLL_OVERRUN( ctx );
 #endif
+      } else if( FD_UNLIKELY( prefrag_ticks ) ) { /* Caught up, but the credit callbacks did work */
+        fd_stem_idle_busy( idle );
+      } else { /* Caught up, back off if we have been for a while.  The
+                  wait is charged to the caught up regime below. */
+        fd_stem_idle_poll( idle, this_in_mline, seq_found, now, then );
       }
 
       /* Don't bother with spin as polling multiple locations */
@@ -630,6 +782,15 @@ STEM_(run1)( ulong                        in_cnt,
       continue;
     }
 
+    fd_stem_idle_busy( idle );
+    if( FD_UNLIKELY( idle->waited ) ) {
+      /* First frag after an idle wait, sample how long it took us to
+         notice it (tspub is 0 if the producer does not stamp it). */
+      idle->waited = 0;
+      ulong tspub = (ulong)FD_VOLATILE_CONST( this_in_mline->tspub );
+      if( FD_LIKELY( tspub ) ) fd_histf_sample( metric_idle_wake, (ulong)fd_long_max( now - fd_frag_meta_ts_decomp( tspub, now ), 0L ) );
+    }
+
 #ifdef STEM_CALLBACK_BEFORE_FRAG
     int filter = STEM_CALLBACK_BEFORE_FRAG( ctx, (ulong)this_in->idx, seq_found, sig );
     if( FD_UNLIKELY( filter<0 ) ) {
@@ -675,6 +836,31 @@ STEM_(run1)( ulong                        in_cnt,
     STEM_CALLBACK_DURING_FRAG( ctx, (ulong)this_in->idx, seq_found, sig, chunk, sz, ctl );
 #endif
 
+#ifdef STEM_CALLBACK_DURING_FRAG_BATCH
+    /* Gather this frag and any immediately following frags on this in
+       that are already published.  Each metadata copy is bracketed by
+       seq checks so the copy is known not to be torn.  A frag that
+       fails either check (not yet published or overrun) ends the batch.
+       If the first frag fails, the overrun check below will catch it.
+       The batch is limited by the number of credits available so that
+       AFTER_FRAG can publish up to burst frags per consumed frag. */
+    fd_frag_meta_t batch_meta[ STEM_FRAG_BATCH_MAX ];
+    ulong batch_max = fd_ulong_min( STEM_FRAG_BATCH_MAX, min_cr_avail / fd_ulong_max( burst, 1UL ) );
+    ulong batch_cnt = 0UL;
+    do {
+      ulong                  batch_seq   = fd_seq_inc( this_in_seq, batch_cnt );
+      fd_frag_meta_t const * batch_mline = this_in->mcache + fd_mcache_line_idx( batch_seq, this_in->depth );
+      if( FD_UNLIKELY( fd_seq_ne( FD_VOLATILE_CONST( batch_mline->seq ), batch_seq ) ) ) break;
+      FD_COMPILER_MFENCE();
+      batch_meta[ batch_cnt ] = *batch_mline;
+      FD_COMPILER_MFENCE();
+      if( FD_UNLIKELY( fd_seq_ne( FD_VOLATILE_CONST( batch_mline->seq ), batch_seq ) ) ) break;
+      batch_cnt++;
+    } while( batch_cnt<batch_max );
+
+    if( FD_LIKELY( batch_cnt ) ) STEM_CALLBACK_DURING_FRAG_BATCH( ctx, (ulong)this_in->idx, batch_meta, batch_cnt );
+#endif
+
     FD_COMPILER_MFENCE();
     ulong seq_test =        this_in_mline->seq;
     FD_COMPILER_MFENCE();
@@ -703,18 +889,34 @@ STEM_(run1)( ulong                        in_cnt,
     }
 #endif
 
+#ifdef STEM_CALLBACK_DURING_FRAG_BATCH
+    ulong consumed_cnt = batch_cnt;
+    ulong consumed_sz  = 0UL;
+    for( ulong batch_idx=0UL; batch_idx<batch_cnt; batch_idx++ ) {
+      fd_frag_meta_t const * meta = &batch_meta[ batch_idx ];
+#ifdef STEM_CALLBACK_AFTER_FRAG
+      STEM_CALLBACK_AFTER_FRAG( ctx, (ulong)this_in->idx, meta->seq, meta->sig, (ulong)meta->sz, (ulong)meta->tsorig, (ulong)meta->tspub, &stem );
+#endif
+      consumed_sz += (ulong)meta->sz;
+      if( FD_UNLIKELY( in_lat ) ) STEM_(in_lat_sample)( in_lat+2UL*this_in->idx, (ulong)meta->tsorig, (ulong)meta->tspub, now );
+    }
+#else
 #ifdef STEM_CALLBACK_AFTER_FRAG
     STEM_CALLBACK_AFTER_FRAG( ctx, (ulong)this_in->idx, seq_found, sig, sz, tsorig, tspub, &stem );
 #endif
+    ulong consumed_cnt = 1UL;
+    ulong consumed_sz  = sz;
+    if( FD_UNLIKELY( in_lat ) ) STEM_(in_lat_sample)( in_lat+2UL*this_in->idx, tsorig, tspub, now );
+#endif
 
     /* Windup for the next in poll and accumulate diagnostics */
 
-    this_in_seq    = fd_seq_inc( this_in_seq, 1UL );
+    this_in_seq    = fd_seq_inc( this_in_seq, consumed_cnt );
     this_in->seq   = this_in_seq;
     this_in->mline = this_in->mcache + fd_mcache_line_idx( this_in_seq, this_in->depth );
 
-    this_in->accum[ FD_METRICS_COUNTER_LINK_CONSUMED_COUNT_OFF ]++;
-    this_in->accum[ FD_METRICS_COUNTER_LINK_CONSUMED_SIZE_BYTES_OFF ] += (uint)sz;
+    this_in->accum[ FD_METRICS_COUNTER_LINK_CONSUMED_COUNT_OFF      ] += (uint)consumed_cnt;
+    this_in->accum[ FD_METRICS_COUNTER_LINK_CONSUMED_SIZE_BYTES_OFF ] += (uint)consumed_sz;
 
     metric_regime_ticks[1] += housekeeping_ticks;
     metric_regime_ticks[4] += prefrag_ticks;
@@ -747,6 +949,23 @@ STEM_(run)( fd_topo_t *      topo,
     FD_TEST( out_mcache[ i ] );
   }
 
+  /* Multi-producer outs share the mcache seq and each producer gets an
+     equal share of the depth as credits (see fd_topob_link_mp). */
+  fd_stem_mp_out_t   out_mp_mem[ FD_TOPO_MAX_LINKS ];
+  fd_stem_mp_out_t * out_mp = NULL;
+  for( ulong i=0UL; i<tile->out_cnt; i++ ) {
+    fd_topo_link_t const * link = &topo->links[ tile->out_link_id[ i ] ];
+    out_mp_mem[ i ].seq = NULL;
+    if( FD_LIKELY( !link->multi_producer ) ) continue;
+
+    ulong cr = fd_mcache_mp_cr_max( link->depth, fd_topo_link_producer_cnt( topo, link ) );
+    FD_TEST( cr );
+    out_mp_mem[ i ].seq      = fd_mcache_seq_laddr( out_mcache[ i ] );
+    out_mp_mem[ i ].own      = fd_alloca( alignof(ulong), cr*sizeof(ulong) );
+    out_mp_mem[ i ].own_mask = cr-1UL;
+    out_mp = out_mp_mem;
+  }
+
   ulong   reliable_cons_cnt = 0UL;
   ulong   cons_out[ FD_TOPO_MAX_LINKS ];
   ulong * cons_fseq[ FD_TOPO_MAX_LINKS ];
@@ -773,16 +992,22 @@ STEM_(run)( fd_topo_t *      topo,
 
   STEM_CALLBACK_CONTEXT_TYPE * ctx = (STEM_CALLBACK_CONTEXT_TYPE*)fd_ulong_align_up( (ulong)fd_topo_obj_laddr( topo, tile->tile_obj_id ), STEM_CALLBACK_CONTEXT_ALIGN );
 
+  fd_histf_t * in_lat = NULL;
+  if( FD_UNLIKELY( tile->link_latency && polled_in_cnt ) ) in_lat = fd_alloca( FD_HISTF_ALIGN, 2UL*polled_in_cnt*sizeof(fd_histf_t) );
+
   STEM_(run1)( polled_in_cnt,
                in_mcache,
                in_fseq,
                tile->out_cnt,
                out_mcache,
+               out_mp,
                reliable_cons_cnt,
                cons_out,
                cons_fseq,
                STEM_BURST,
                STEM_LAZY,
+               tile->idle_wake_ns,
+               in_lat,
                rng,
                fd_alloca( FD_STEM_SCRATCH_ALIGN, STEM_(scratch_footprint)( polled_in_cnt, tile->out_cnt, reliable_cons_cnt ) ),
                ctx );
@@ -823,4 +1048,6 @@ STEM_(run)( fd_topo_t *      topo,
 #undef STEM_CALLBACK_DURING_FRAG
 #undef STEM_CALLBACK_RETURNABLE_FRAG
 #undef STEM_CALLBACK_AFTER_FRAG
+#undef STEM_CALLBACK_DURING_FRAG_BATCH
+#undef STEM_FRAG_BATCH_MAX
 #undef STEM_CALLBACK_AFTER_POLL_OVERRUN
@@ -5,18 +5,71 @@
 
 #define FD_STEM_SCRATCH_ALIGN (128UL)
 
+/* fd_stem_mp_out_t is the producer side state of an out that is a
+   multi-producer link (see fd_mcache_mp_reserve).  Sequence numbers are
+   reserved from the shared seq[0] of the mcache instead of being
+   assigned locally.  Since other producers interleave their frags, the
+   stem can't compute its outstanding frags from the consumer position
+   alone, so it remembers the sequence numbers it reserved in the own
+   ring until all reliable consumers have moved past them.  The ring
+   capacity is this producer's share of flow control credits. */
+
+struct fd_stem_mp_out {
+  ulong * seq;      /* ==fd_mcache_seq_laddr( mcache ) if this out is multi-producer, NULL otherwise */
+  ulong * own;      /* own[i&own_mask] for i in [own_tail,own_head) are reserved seqs not yet consumed by everyone */
+  ulong   own_mask; /* ring capacity - 1, capacity is a power of 2 */
+  ulong   own_head;
+  ulong   own_tail;
+  ulong   own_scan; /* scratch used to find the new own_tail during housekeeping */
+};
+
+typedef struct fd_stem_mp_out fd_stem_mp_out_t;
+
 struct fd_stem_context {
-   fd_frag_meta_t ** mcaches;
-   ulong *           seqs;
-   ulong *           depths;
+   fd_frag_meta_t **  mcaches;
+   ulong *            seqs;
+   ulong *            depths;
+   fd_stem_mp_out_t * mp_outs; /* indexed by out_idx, NULL if there are no multi-producer outs */
 
-   ulong *           cr_avail;
-   ulong *           min_cr_avail;
-   ulong             cr_decrement_amount;
+   ulong *            cr_avail;
+   ulong *            min_cr_avail;
+   ulong              cr_decrement_amount;
 };
 
 typedef struct fd_stem_context fd_stem_context_t;
 
+/* fd_stem_mp_reserve reserves the next sequence number of a
+   multi-producer out and records it in the own ring.  The caller
+   must have a flow control credit for the out. */
+
+static inline ulong
+fd_stem_mp_reserve( fd_stem_mp_out_t * mp ) {
+# if FD_HAS_ATOMIC
+  ulong seq = fd_mcache_mp_reserve( mp->seq, 1UL );
+# else
+  ulong seq = (*mp->seq)++; /* No concurrent producers on this target */
+# endif
+  mp->own[ mp->own_head & mp->own_mask ] = seq;
+  mp->own_head++;
+  return seq;
+}
+
+/* fd_stem_mp_cr_avail returns the flow control credits available on a
+   multi-producer out given the position cons_seq of one of its
+   reliable consumers, which is the ring capacity minus the reserved
+   seqs that the consumer has not consumed yet.  It also lowers
+   own_scan to the oldest reserved seq still needed by this consumer.
+   Seqs are reserved in increasing order, so that is a prefix scan. */
+
+static inline ulong
+fd_stem_mp_cr_avail( fd_stem_mp_out_t * mp,
+                     ulong              cons_seq ) {
+  ulong tail = mp->own_tail;
+  while( tail!=mp->own_head && fd_seq_lt( mp->own[ tail & mp->own_mask ], cons_seq ) ) tail++;
+  mp->own_scan = fd_ulong_min( mp->own_scan, tail );
+  return mp->own_mask + 1UL - (mp->own_head - tail);
+}
+
 struct __attribute__((aligned(64))) fd_stem_tile_in {
   fd_frag_meta_t const * mcache;   /* local join to this in's mcache */
   uint                   depth;    /* == fd_mcache_depth( mcache ), depth of this in's cache (const) */
@@ -42,6 +95,7 @@ fd_stem_publish( fd_stem_context_t * stem,
                  ulong               tspub ) {
   ulong * seqp = &stem->seqs[ out_idx ];
   ulong   seq  = *seqp;
+  if( FD_UNLIKELY( stem->mp_outs && stem->mp_outs[ out_idx ].seq ) ) seq = fd_stem_mp_reserve( &stem->mp_outs[ out_idx ] );
   fd_mcache_publish( stem->mcaches[ out_idx ], stem->depths[ out_idx ], seq, sig, chunk, sz, ctl, tsorig, tspub );
   stem->cr_avail[ out_idx ] -= stem->cr_decrement_amount;
   *stem->min_cr_avail        = fd_ulong_min( stem->cr_avail[ out_idx ], *stem->min_cr_avail );
@@ -53,10 +107,139 @@ fd_stem_advance( fd_stem_context_t * stem,
                  ulong               out_idx ) {
   ulong * seqp = &stem->seqs[ out_idx ];
   ulong   seq  = *seqp;
+  if( FD_UNLIKELY( stem->mp_outs && stem->mp_outs[ out_idx ].seq ) ) seq = fd_stem_mp_reserve( &stem->mp_outs[ out_idx ] );
   stem->cr_avail[ out_idx ] -= stem->cr_decrement_amount;
   *stem->min_cr_avail        = fd_ulong_min( stem->cr_avail[ out_idx ], *stem->min_cr_avail );
   *seqp = fd_seq_inc( seq, 1UL );
   return seq;
 }
 
+/* fd_stem_idle_has_waitpkg returns 1 if the CPU supports the
+   UMONITOR/UMWAIT instructions (WAITPKG) and the tickcounter is the
+   TSC, and 0 otherwise.  These let an idle tile release its core
+   without a syscall (tiles are sandboxed and typically cannot sleep). */
+
+static inline int
+fd_stem_idle_has_waitpkg( void ) {
+#if FD_HAS_X86 && FD_TICKCOUNT_STYLE==1
+  uint a = 0U; uint b; uint c = 0U; uint d;
+  __asm__ __volatile__( "cpuid" : "+a"(a), "=b"(b), "+c"(c), "=d"(d) );
+  if( FD_UNLIKELY( a<7U ) ) return 0;
+  a = 7U; c = 0U;
+  __asm__ __volatile__( "cpuid" : "+a"(a), "=b"(b), "+c"(c), "=d"(d) );
+  return (int)((c>>5) & 1U); /* CPUID.(EAX=7,ECX=0):ECX[5] */
+#else
+  return 0;
+#endif
+}
+
+/* fd_stem_idle_wait waits until the sequence number stored at mline
+   no longer matches seq (i.e. the producer published or overran the
+   frag we are waiting for) or the tickcounter reaches deadline,
+   whichever comes first.  mline may be NULL, in which case it just
+   waits until the deadline.  If has_waitpkg is non-zero, the wait uses
+   UMWAIT (TPAUSE if mline is NULL) in the lighter C0.1 state, otherwise
+   it is a PAUSE loop.
+   Note that the OS caps the duration of a single UMWAIT, so this loops
+   until one of the conditions is met.  Returns the tickcount at the
+   end of the wait. */
+
+static inline long
+fd_stem_idle_wait( fd_frag_meta_t const * mline,
+                   ulong                  seq,
+                   long                   deadline,
+                   int                    has_waitpkg ) {
+  long now = fd_tickcount();
+  while( now<deadline ) {
+    if( FD_LIKELY( mline ) ) {
+#if FD_HAS_X86 && FD_TICKCOUNT_STYLE==1
+      if( FD_LIKELY( has_waitpkg ) ) __asm__ __volatile__( "umonitor %0" :: "r"(&mline->seq) : "memory" );
+#endif
+      if( FD_UNLIKELY( FD_VOLATILE_CONST( mline->seq )!=seq ) ) break;
+    }
+#if FD_HAS_X86 && FD_TICKCOUNT_STYLE==1
+    if( FD_LIKELY( has_waitpkg ) ) {
+      ulong d = (ulong)deadline;
+      if( FD_LIKELY( mline ) ) __asm__ __volatile__( "umwait %0" :: "r"(1U), "a"((uint)d), "d"((uint)(d>>32)) : "memory", "cc" );
+      else                     __asm__ __volatile__( "tpause %0" :: "r"(1U), "a"((uint)d), "d"((uint)(d>>32)) : "memory", "cc" );
+    } else {
+      FD_SPIN_PAUSE();
+    }
+#else
+    (void)has_waitpkg;
+    FD_SPIN_PAUSE();
+#endif
+    now = fd_tickcount();
+  }
+  return now;
+}
+
+/* fd_stem_idle_t tracks the idle backoff of a stem run loop.  A tile
+   that finds no work keeps busy polling for the first wake_ticks of an
+   idle period, then polls with a PAUSE hint for another wake_ticks, and
+   after that does bounded waits of at most wake_ticks each on the in
+   it last polled.  Spinning for as long as the wake latency budget
+   before backing off bounds the cost of a wrong guess to at most twice
+   that of the optimal policy (classic rent or buy argument), so
+   bursty links do not pay the wait latency.  With wake_ticks of zero
+   the tile busy polls as before. */
+
+struct fd_stem_idle {
+  long  wake_ticks; /* max ticks of a single idle wait, 0 to busy poll */
+  long  start;      /* tickcount when the current idle period began, 0 if the tile is busy */
+  int   waitpkg;    /* use UMONITOR/UMWAIT for waits */
+  int   waited;     /* non-zero if the tile did an idle wait since it last found a frag */
+  ulong wait_cnt;   /* local diagnostic accumulators, drained during housekeeping */
+  ulong wait_ticks;
+};
+
+typedef struct fd_stem_idle fd_stem_idle_t;
+
+/* fd_stem_idle_busy marks the tile as having done work, ending the
+   current idle period (if any). */
+
+static inline void
+fd_stem_idle_busy( fd_stem_idle_t * idle ) {
+  idle->start = 0L;
+}
+
+/* fd_stem_idle_poll is called when a poll of the ins found no work at
+   tickcount now.  mline and seq are the mcache line that was polled
+   and the sequence number found there (mline may be NULL if there is
+   no in to monitor).  then is the tickcount of the next housekeeping
+   event, which a wait will not be extended past.  Advances the backoff
+   and returns the tickcount after any pause or wait.  The caller
+   should charge the whole interval, wait included, to its caught up
+   regime so the regimes keep adding up to wall time (wait_ticks is a
+   subset of that regime). */
+
+static inline long
+fd_stem_idle_poll( fd_stem_idle_t *       idle,
+                   fd_frag_meta_t const * mline,
+                   ulong                  seq,
+                   long                   now,
+                   long                   then ) {
+  if( FD_LIKELY( !idle->wake_ticks ) ) return now;
+  if( FD_UNLIKELY( !idle->start ) ) {
+    idle->start = now;
+    return now;
+  }
+
+  long idle_ticks = now - idle->start;
+  if( idle_ticks<idle->wake_ticks ) return now;
+  if( idle_ticks<2L*idle->wake_ticks ) {
+    FD_SPIN_PAUSE();
+    return fd_tickcount();
+  }
+
+  long deadline = fd_long_min( now + idle->wake_ticks, then );
+  if( FD_UNLIKELY( deadline<=now ) ) return now;
+
+  long next = fd_stem_idle_wait( mline, seq, deadline, idle->waitpkg );
+  idle->wait_cnt++;
+  idle->wait_ticks += (ulong)(next - now);
+  idle->waited      = 1;
+  return next;
+}
+
 #endif /* HEADER_fd_src_disco_stem_fd_stem_h */
@@ -0,0 +1,107 @@
+#include "../fd_disco.h"
+
+#include "fd_stem.h"
+
+static void
+test_idle_disabled( void ) {
+  fd_stem_idle_t idle[1] = {{ .wake_ticks = 0L }};
+
+  long now = fd_tickcount();
+  for( ulong i=0UL; i<1024UL; i++ ) FD_TEST( fd_stem_idle_poll( idle, NULL, 0UL, now, LONG_MAX )==now );
+  FD_TEST( !idle->start );
+  FD_TEST( !idle->waited );
+  FD_TEST( !idle->wait_cnt );
+  FD_TEST( !idle->wait_ticks );
+}
+
+static void
+test_idle_backoff( int waitpkg ) {
+  long wake_ticks = (long)(50e3*fd_tempo_tick_per_ns( NULL )); /* 50 us */
+  fd_stem_idle_t idle[1] = {{ .wake_ticks = wake_ticks, .waitpkg = waitpkg }};
+
+  fd_frag_meta_t mline[1];
+  memset( mline, 0, sizeof(fd_frag_meta_t) );
+  mline->seq = 7UL;
+
+  /* First idle poll starts the idle period, and we keep spinning
+     (no pause, no wait) for wake_ticks. */
+
+  long start = 1000L*wake_ticks;
+  FD_TEST( fd_stem_idle_poll( idle, mline, 7UL, start, LONG_MAX )==start );
+  FD_TEST( idle->start==start );
+  FD_TEST( fd_stem_idle_poll( idle, mline, 7UL, start+wake_ticks/2L, LONG_MAX )==start+wake_ticks/2L );
+  FD_TEST( !idle->wait_cnt );
+
+  /* Then we spin with a pause hint, which returns a fresh tickcount
+     but does not wait. */
+
+  fd_stem_idle_poll( idle, mline, 7UL, start+wake_ticks+wake_ticks/2L, LONG_MAX );
+  FD_TEST( !idle->wait_cnt );
+  FD_TEST( !idle->waited );
+
+  /* Then do bounded waits.  The wait lasts until the deadline if
+     nothing gets published. */
+
+  idle->start = fd_tickcount() - 3L*wake_ticks;
+  long now  = fd_tickcount();
+  long next = fd_stem_idle_poll( idle, mline, 7UL, now, LONG_MAX );
+  FD_TEST( next>=now+wake_ticks );
+  FD_TEST( idle->wait_cnt==1UL );
+  FD_TEST( idle->wait_ticks==(ulong)(next-now) );
+  FD_TEST( idle->waited );
+
+  /* The wait does not extend past the next housekeeping event, and
+     does not happen at all if housekeeping is already due. */
+
+  now  = fd_tickcount();
+  next = fd_stem_idle_poll( idle, mline, 7UL, now, now+wake_ticks/4L );
+  FD_TEST( next>=now+wake_ticks/4L );
+  FD_TEST( next< now+wake_ticks    );
+  FD_TEST( idle->wait_cnt==2UL );
+
+  now = fd_tickcount();
+  FD_TEST( fd_stem_idle_poll( idle, mline, 7UL, now, now )==now );
+  FD_TEST( idle->wait_cnt==2UL );
+
+  /* The wait ends immediately if the monitored line was already
+     updated by the producer. */
+
+  mline->seq = 8UL;
+  now  = fd_tickcount();
+  next = fd_stem_idle_poll( idle, mline, 7UL, now, LONG_MAX );
+  FD_TEST( next<now+wake_ticks );
+  FD_TEST( idle->wait_cnt==3UL );
+
+  /* Waits without an in to monitor just wait for the deadline. */
+
+  now  = fd_tickcount();
+  next = fd_stem_idle_poll( idle, NULL, 0UL, now, LONG_MAX );
+  FD_TEST( next>=now+wake_ticks );
+  FD_TEST( idle->wait_cnt==4UL );
+
+  /* Doing work restarts the backoff from spinning. */
+
+  fd_stem_idle_busy( idle );
+  FD_TEST( !idle->start );
+  now = fd_tickcount();
+  FD_TEST( fd_stem_idle_poll( idle, mline, 7UL, now, LONG_MAX )==now );
+  FD_TEST( idle->start==now );
+  FD_TEST( idle->wait_cnt==4UL );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  int has_waitpkg = fd_stem_idle_has_waitpkg();
+  FD_LOG_NOTICE(( "waitpkg %d", has_waitpkg ));
+
+  test_idle_disabled();
+  test_idle_backoff( 0 );
+  if( has_waitpkg ) test_idle_backoff( 1 );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,144 @@
+#include "fd_stem.h"
+#include "../metrics/fd_metrics.h"
+
+/* test_stem_lat runs a single threaded stem whose BEFORE_CREDIT
+   callback publishes frags into its own in, stamped as if they had
+   been published PUB_DELAY ago and originated ORIG_DELAY ago.  It
+   checks that the in link latency histograms see every frag with at
+   least that latency, and that they stay empty when disabled. */
+
+#define DEPTH      (256UL)
+#define FRAG_CNT   (10000UL)
+#define PUB_DELAY  (1e-6)
+#define ORIG_DELAY (1e-3)
+
+struct test_ctx {
+  fd_frag_meta_t * mcache;
+  ulong            tx_seq;
+  ulong            rx_cnt;
+  long             pub_delay;
+  long             orig_delay;
+  long             deadline;
+};
+
+typedef struct test_ctx test_ctx_t;
+
+static uchar mcache_mem [ FD_MCACHE_FOOTPRINT( DEPTH, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+static uchar fseq_mem   [ FD_FSEQ_FOOTPRINT                 ] __attribute__((aligned(FD_FSEQ_ALIGN)));
+static uchar metrics_mem[ FD_METRICS_FOOTPRINT( 1UL, 0UL )  ] __attribute__((aligned(FD_METRICS_ALIGN)));
+
+/* Keep running for a while after the last frag so the in housekeeping
+   event copies out the final histograms */
+
+static int
+should_shutdown( test_ctx_t * ctx ) {
+  if( FD_LIKELY( ctx->rx_cnt<FRAG_CNT ) ) return 0;
+  long now = fd_log_wallclock();
+  if( !ctx->deadline ) ctx->deadline = now + 10000000L;
+  return now>=ctx->deadline;
+}
+
+static void
+before_credit( test_ctx_t *        ctx,
+               fd_stem_context_t * stem,
+               int *               charge_busy ) {
+  (void)stem; (void)charge_busy;
+  while( (ctx->tx_seq-ctx->rx_cnt)<DEPTH/2UL && ctx->tx_seq<FRAG_CNT ) {
+    long  now    = fd_tickcount();
+    ulong tspub  = fd_frag_meta_ts_comp( now - ctx->pub_delay  );
+    ulong tsorig = fd_frag_meta_ts_comp( now - ctx->orig_delay );
+    /* A zero timestamp means not stamped (see in_lat_sample in fd_stem.c) */
+    fd_mcache_publish( ctx->mcache, DEPTH, ctx->tx_seq, 0UL, 0UL, 0UL, 0UL, fd_ulong_max( tsorig, 1UL ), fd_ulong_max( tspub, 1UL ) );
+    ctx->tx_seq++;
+  }
+}
+
+static void
+after_frag( test_ctx_t *        ctx,
+            ulong               in_idx,
+            ulong               seq,
+            ulong               sig,
+            ulong               sz,
+            ulong               tsorig,
+            ulong               tspub,
+            fd_stem_context_t * stem ) {
+  (void)in_idx; (void)sig; (void)sz; (void)tsorig; (void)tspub; (void)stem;
+  FD_TEST( seq==ctx->rx_cnt );
+  ctx->rx_cnt++;
+}
+
+#define STEM_BURST                    (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE    test_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN   alignof(test_ctx_t)
+#define STEM_CALLBACK_SHOULD_SHUTDOWN should_shutdown
+#define STEM_CALLBACK_BEFORE_CREDIT   before_credit
+#define STEM_CALLBACK_AFTER_FRAG      after_frag
+#include "fd_stem.c"
+
+static void
+test_lat( int        enabled,
+          fd_rng_t * rng ) {
+  test_ctx_t ctx[1] = {{
+    .mcache     = fd_mcache_join( fd_mcache_new( mcache_mem, DEPTH, 0UL, 0UL ) ),
+    .pub_delay  = (long)fd_metrics_convert_seconds_to_ticks( PUB_DELAY  ),
+    .orig_delay = (long)fd_metrics_convert_seconds_to_ticks( ORIG_DELAY )
+  }};
+  FD_TEST( ctx->mcache );
+
+  ulong * fseq = fd_fseq_join( fd_fseq_new( fseq_mem, 0UL ) ); FD_TEST( fseq );
+  fd_metrics_register( fd_metrics_new( metrics_mem, 1UL, 0UL ) );
+
+  fd_frag_meta_t const * in_mcache[1] = { ctx->mcache };
+  ulong *                in_fseq  [1] = { fseq };
+  fd_histf_t             in_lat   [2];
+
+  stem_run1( 1UL, in_mcache, in_fseq, 0UL, NULL, NULL, 0UL, NULL, NULL, 1UL, 0L, 0UL, enabled ? in_lat : NULL, rng,
+             fd_alloca( FD_STEM_SCRATCH_ALIGN, stem_scratch_footprint( 1UL, 0UL, 0UL ) ), ctx );
+  FD_TEST( ctx->rx_cnt==FRAG_CNT );
+
+  volatile ulong const * link = fd_metrics_link_in( fd_metrics_base_tl, 0UL );
+  FD_TEST( link[ FD_METRICS_COUNTER_LINK_CONSUMED_COUNT_OFF ]==FRAG_CNT );
+
+  ulong pub_cnt  = 0UL;
+  ulong orig_cnt = 0UL;
+  for( ulong i=0UL; i<FD_HISTF_BUCKET_CNT; i++ ) {
+    pub_cnt  += link[ FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_OFF + i ];
+    orig_cnt += link[ FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_OFF  + i ];
+  }
+  ulong pub_sum  = link[ FD_METRICS_HISTOGRAM_LINK_PUBLISH_LATENCY_SECONDS_OFF + FD_HISTF_BUCKET_CNT ];
+  ulong orig_sum = link[ FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_OFF  + FD_HISTF_BUCKET_CNT ];
+
+  if( !enabled ) {
+    FD_TEST( !pub_cnt && !orig_cnt && !pub_sum && !orig_sum );
+  } else {
+    FD_TEST( pub_cnt==FRAG_CNT && orig_cnt==FRAG_CNT );
+    FD_TEST( pub_sum >=FRAG_CNT*(ulong)ctx->pub_delay  );
+    FD_TEST( orig_sum>=FRAG_CNT*(ulong)ctx->orig_delay );
+    /* The origin delay dominates, so nothing lands in the underflow
+       bucket of the origin histogram */
+    FD_TEST( !link[ FD_METRICS_HISTOGRAM_LINK_ORIGIN_LATENCY_SECONDS_OFF ] );
+    FD_LOG_NOTICE(( "avg publish latency %.3f us, avg origin latency %.3f us",
+                    1e6*fd_metrics_convert_ticks_to_seconds( pub_sum/FRAG_CNT ),
+                    1e6*fd_metrics_convert_ticks_to_seconds( orig_sum/FRAG_CNT ) ));
+  }
+
+  fd_fseq_delete  ( fd_fseq_leave  ( fseq        ) );
+  fd_mcache_delete( fd_mcache_leave( ctx->mcache ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  test_lat( 0, rng );
+  test_lat( 1, rng );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
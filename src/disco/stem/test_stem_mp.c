@@ -0,0 +1,117 @@
+#include "../fd_disco.h"
+
+#include "fd_stem.h"
+
+#define DEPTH (64UL)
+
+static uchar mcache_mem[ FD_MCACHE_FOOTPRINT( DEPTH, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+
+/* Two producers share a multi-producer mcache through their own stem
+   contexts with a credit share of DEPTH/2 each. */
+
+struct producer {
+  fd_stem_context_t stem[1];
+  fd_stem_mp_out_t  mp[1];
+  fd_frag_meta_t *  mcache[1];
+  ulong             seq[1];
+  ulong             depth[1];
+  ulong             cr_avail[1];
+  ulong             min_cr_avail;
+  ulong             own[ DEPTH/2UL ];
+};
+
+typedef struct producer producer_t;
+
+static void
+producer_init( producer_t *     p,
+               fd_frag_meta_t * mcache ) {
+  memset( p, 0, sizeof(producer_t) );
+  p->mcache[0]   = mcache;
+  p->depth[0]    = DEPTH;
+  p->cr_avail[0] = DEPTH/2UL;
+  p->min_cr_avail = DEPTH/2UL;
+  p->mp->seq      = fd_mcache_seq_laddr( mcache );
+  p->mp->own      = p->own;
+  p->mp->own_mask = DEPTH/2UL-1UL;
+  *p->stem = (fd_stem_context_t) {
+    .mcaches             = p->mcache,
+    .seqs                = p->seq,
+    .depths              = p->depth,
+    .mp_outs             = p->mp,
+    .cr_avail            = p->cr_avail,
+    .min_cr_avail        = &p->min_cr_avail,
+    .cr_decrement_amount = 1UL
+  };
+}
+
+/* Housekeeping for a single reliable consumer at cons_seq, as done by
+   the stem run loop */
+
+static ulong
+producer_credits( producer_t * p,
+                  ulong        cons_seq ) {
+  p->mp->own_scan = p->mp->own_head;
+  ulong cr_avail = fd_stem_mp_cr_avail( p->mp, cons_seq );
+  p->mp->own_tail = p->mp->own_scan;
+  return cr_avail;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  FD_TEST( fd_mcache_mp_cr_max( DEPTH, 2UL )==DEPTH/2UL );
+
+  fd_frag_meta_t * mcache = fd_mcache_join( fd_mcache_new( mcache_mem, DEPTH, 0UL, 0UL ) );
+  FD_TEST( mcache );
+
+  producer_t a[1]; producer_init( a, mcache );
+  producer_t b[1]; producer_init( b, mcache );
+
+  /* Interleave publishes from both producers.  Sequence numbers are
+     handed out in reservation order regardless of producer. */
+
+  fd_stem_publish( a->stem, 0UL, 0xaUL, 0UL, 0UL, 0UL, 0UL, 0UL );
+  fd_stem_publish( b->stem, 0UL, 0xbUL, 0UL, 0UL, 0UL, 0UL, 0UL );
+  fd_stem_publish( a->stem, 0UL, 0xaUL, 0UL, 0UL, 0UL, 0UL, 0UL );
+  ulong seq = fd_stem_advance( b->stem, 0UL );
+  FD_TEST( seq==3UL );
+  fd_mcache_publish( mcache, DEPTH, seq, 0xbUL, 0UL, 0UL, 0UL, 0UL, 0UL );
+
+  FD_TEST( fd_mcache_seq_query( fd_mcache_seq_laddr( mcache ) )==4UL );
+  for( ulong i=0UL; i<4UL; i++ ) {
+    FD_TEST( mcache[ i ].seq==i );
+    FD_TEST( mcache[ i ].sig==((i&1UL) ? 0xbUL : 0xaUL) );
+  }
+  FD_TEST( a->own[0]==0UL && a->own[1]==2UL && a->mp->own_head==2UL );
+  FD_TEST( b->own[0]==1UL && b->own[1]==3UL && b->mp->own_head==2UL );
+  FD_TEST( a->cr_avail[0]==DEPTH/2UL-2UL && a->min_cr_avail==DEPTH/2UL-2UL );
+
+  /* Credits come back as the consumer moves past each producer's own
+     frags, independent of the other producer's frags. */
+
+  FD_TEST( producer_credits( a, 0UL )==DEPTH/2UL-2UL ); FD_TEST( a->mp->own_tail==0UL );
+  FD_TEST( producer_credits( a, 1UL )==DEPTH/2UL-1UL ); FD_TEST( a->mp->own_tail==1UL );
+  FD_TEST( producer_credits( b, 1UL )==DEPTH/2UL-2UL ); FD_TEST( b->mp->own_tail==0UL );
+  FD_TEST( producer_credits( a, 3UL )==DEPTH/2UL     ); FD_TEST( a->mp->own_tail==2UL );
+  FD_TEST( producer_credits( b, 3UL )==DEPTH/2UL-1UL ); FD_TEST( b->mp->own_tail==1UL );
+  FD_TEST( producer_credits( b, 4UL )==DEPTH/2UL     ); FD_TEST( b->mp->own_tail==2UL );
+
+  /* With multiple consumers, the slowest one holds the tail. */
+
+  for( ulong i=0UL; i<DEPTH/2UL; i++ ) fd_stem_publish( a->stem, 0UL, 0xaUL, 0UL, 0UL, 0UL, 0UL, 0UL );
+  FD_TEST( a->mp->own_head-a->mp->own_tail==DEPTH/2UL );
+  a->mp->own_scan = a->mp->own_head;
+  FD_TEST( fd_stem_mp_cr_avail( a->mp, 4UL+DEPTH/2UL )==DEPTH/2UL     );
+  FD_TEST( fd_stem_mp_cr_avail( a->mp, 5UL           )==1UL           );
+  FD_TEST( fd_stem_mp_cr_avail( a->mp, 4UL+DEPTH/4UL )==DEPTH/4UL     );
+  a->mp->own_tail = a->mp->own_scan;
+  FD_TEST( a->mp->own_tail==3UL );
+
+  fd_mcache_delete( fd_mcache_leave( mcache ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
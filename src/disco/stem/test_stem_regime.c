@@ -0,0 +1,114 @@
+#include "fd_stem.h"
+#include "../metrics/fd_metrics.h"
+
+/* test_stem_regime runs a single threaded stem that never receives a
+   frag, with idle backoff enabled, so nearly all of its time is spent
+   in idle waits.  At every housekeeping metrics write it checks that
+   the regime durations add up to the ticks elapsed since the stem
+   started (idle waits included), and that the idle wait duration is a
+   subset of the caught up regime. */
+
+#define DEPTH     (64UL)
+#define WAKE_NS   (20000UL)  /* 20 us */
+#define RUN_NS    (200e6)    /* 200 ms */
+#define SLACK_NS  (10e6)     /* 10 ms */
+
+struct test_ctx {
+  long  start;
+  long  deadline;
+  ulong write_cnt;
+  long  min_gap;
+  long  last_gap;
+  ulong wait_ticks;
+};
+
+typedef struct test_ctx test_ctx_t;
+
+static uchar mcache_mem [ FD_MCACHE_FOOTPRINT( DEPTH, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+static uchar fseq_mem   [ FD_FSEQ_FOOTPRINT                 ] __attribute__((aligned(FD_FSEQ_ALIGN)));
+static uchar metrics_mem[ FD_METRICS_FOOTPRINT( 1UL, 0UL )  ] __attribute__((aligned(FD_METRICS_ALIGN)));
+
+static int
+should_shutdown( test_ctx_t * ctx ) {
+  return fd_tickcount()>=ctx->deadline;
+}
+
+static void
+metrics_write( test_ctx_t * ctx ) {
+  long  now = fd_tickcount();
+  ulong sum = 0UL;
+  for( ulong i=0UL; i<FD_METRICS_ENUM_TILE_REGIME_CNT; i++ ) sum += fd_metrics_tl[ FD_METRICS_COUNTER_TILE_REGIME_DURATION_NANOS_OFF+i ];
+  ulong wait_ticks = FD_MCNT_GET( TILE, IDLE_WAIT_DURATION_NANOS );
+
+  /* The regimes cover up to the start of this run loop iteration, so
+     they never exceed the elapsed ticks and only trail them by the
+     stem init and this housekeeping event.  The init part is fixed, so
+     the gap should not grow over the run (it can spike for one write
+     if we get descheduled during housekeeping). */
+  FD_TEST( sum<=(ulong)(now - ctx->start) );
+  long gap = (now - ctx->start) - (long)sum;
+  ctx->min_gap = ctx->write_cnt ? fd_long_min( ctx->min_gap, gap ) : gap;
+  ctx->last_gap = gap;
+
+  FD_TEST( wait_ticks<=fd_metrics_tl[ FD_METRICS_COUNTER_TILE_REGIME_DURATION_NANOS_CAUGHT_UP_POSTFRAG_OFF ] );
+  ctx->wait_ticks = wait_ticks;
+  ctx->write_cnt++;
+}
+
+#define STEM_BURST                    (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE    test_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN   alignof(test_ctx_t)
+#define STEM_CALLBACK_SHOULD_SHUTDOWN should_shutdown
+#define STEM_CALLBACK_METRICS_WRITE   metrics_write
+#include "fd_stem.c"
+
+static void
+test_regime( ulong      in_cnt,
+             fd_rng_t * rng ) {
+  fd_frag_meta_t * mcache = fd_mcache_join( fd_mcache_new( mcache_mem, DEPTH, 0UL, 0UL ) ); FD_TEST( mcache );
+  ulong *          fseq   = fd_fseq_join( fd_fseq_new( fseq_mem, 0UL ) );                   FD_TEST( fseq   );
+  fd_metrics_register( fd_metrics_new( metrics_mem, 1UL, 0UL ) );
+
+  fd_frag_meta_t const * in_mcache[1] = { mcache };
+  ulong *                in_fseq  [1] = { fseq };
+
+  double tick_per_ns = fd_tempo_tick_per_ns( NULL ); /* Calibrate before taking the start tickcount */
+
+  test_ctx_t ctx[1] = {{ 0 }};
+  ctx->start    = fd_tickcount();
+  ctx->deadline = ctx->start + (long)(RUN_NS*tick_per_ns);
+
+  stem_run1( in_cnt, in_mcache, in_fseq, 0UL, NULL, NULL, 0UL, NULL, NULL, 1UL, 0L, WAKE_NS, NULL, rng,
+             fd_alloca( FD_STEM_SCRATCH_ALIGN, stem_scratch_footprint( in_cnt, 0UL, 0UL ) ), ctx );
+
+  long slack = (long)(SLACK_NS*tick_per_ns);
+  FD_LOG_NOTICE(( "in_cnt %lu: %lu metrics writes, idle wait %.3f ms, regime gap min %.3f us last %.3f us", in_cnt, ctx->write_cnt,
+                  1e3*fd_metrics_convert_ticks_to_seconds( ctx->wait_ticks ),
+                  1e6*fd_metrics_convert_ticks_to_seconds( (ulong)ctx->min_gap ),
+                  1e6*fd_metrics_convert_ticks_to_seconds( (ulong)ctx->last_gap ) ));
+  FD_TEST( ctx->write_cnt>1UL );
+  /* Mostly idle, so the waits dominate and a regime gap that dropped
+     them would be far larger than the slack */
+  FD_TEST( ctx->wait_ticks>(ulong)(5L*slack) );
+  FD_TEST( ctx->last_gap-ctx->min_gap<slack );
+
+  fd_fseq_delete  ( fd_fseq_leave  ( fseq   ) );
+  fd_mcache_delete( fd_mcache_leave( mcache ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  test_regime( 0UL, rng );
+  test_regime( 1UL, rng );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -3,6 +3,8 @@ ifdef FD_HAS_THREADS
 ifdef FD_HAS_LINUX
 $(call add-hdrs,fd_topo.h)
 $(call add-objs,fd_topo fd_topob fd_cpu_topo fd_topo_run,fd_disco)
+$(call make-unit-test,test_topob,test_topob,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_topob)
 endif
 endif
 endif
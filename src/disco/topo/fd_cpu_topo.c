@@ -83,6 +83,43 @@ fd_topob_sibling_idx( ulong cpu_idx ) {
   else FD_LOG_ERR(( "failed to find sibling of cpu%lu", cpu_idx ));
 }
 
+/* Return the lowest numbered CPU sharing the L3 cache with the provided
+   CPU (identifying the cache domain, e.g. the CCX on AMD EPYC), or
+   ULONG_MAX if the cache topology is not reported by the OS (e.g. some
+   virtual machines or an offline CPU).  On error, logs an error and
+   exits the process. */
+
+static ulong
+fd_topo_cpu_l3( ulong cpu_idx ) {
+  for( ulong cache_idx=0UL;; cache_idx++ ) {
+    char path[ PATH_MAX ];
+    FD_TEST( fd_cstr_printf_check( path, PATH_MAX, NULL, "/sys/devices/system/cpu/cpu%lu/cache/index%lu/level", cpu_idx, cache_idx ) );
+
+    FILE * fp = fopen( path, "r" );
+    if( FD_UNLIKELY( !fp ) ) {
+      if( FD_LIKELY( errno==ENOENT ) ) return ULONG_MAX;
+      FD_LOG_ERR(( "fopen failed `%s` (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    }
+    uint level = 0U;
+    int  ok    = 1==fscanf( fp, "%u\n", &level );
+    if( FD_UNLIKELY( fclose( fp ) ) ) FD_LOG_ERR(( "fclose failed `%s` (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    if( FD_UNLIKELY( !ok ) ) FD_LOG_ERR(( "failed to read uint from `%s`", path ));
+    if( level!=3U ) continue;
+
+    /* The list is sorted ascending, like "0-7,128-135", so the domain
+       is identified by the leading number. */
+
+    FD_TEST( fd_cstr_printf_check( path, PATH_MAX, NULL, "/sys/devices/system/cpu/cpu%lu/cache/index%lu/shared_cpu_list", cpu_idx, cache_idx ) );
+    fp = fopen( path, "r" );
+    if( FD_UNLIKELY( !fp ) ) FD_LOG_ERR(( "fopen failed `%s` (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    ulong first = ULONG_MAX;
+    ok = 1==fscanf( fp, "%lu", &first );
+    if( FD_UNLIKELY( fclose( fp ) ) ) FD_LOG_ERR(( "fclose failed `%s` (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    if( FD_UNLIKELY( !ok || first>cpu_idx ) ) FD_LOG_ERR(( "failed to parse shared cpu list of cpu%lu `%s`", cpu_idx, path ));
+    return first;
+  }
+}
+
 static int
 fd_topo_cpus_online( ulong cpu_idx ) {
   if( FD_UNLIKELY( cpu_idx==0UL ) ) return 1; /* Cannot set cpu0 to offline */
@@ -104,11 +141,31 @@ fd_topo_cpus_init( fd_topo_cpus_t * cpus ) {
     if( FD_LIKELY( cpus->cpu[ i ].online ) ) cpus->cpu[ i ].sibling = fd_topob_sibling_idx( i );
     else                                     cpus->cpu[ i ].sibling = ULONG_MAX;
   }
+
+  /* Number the L3 cache domains densely in order of their lowest CPU.
+     CPUs without cache topology info are grouped by NUMA node (keys
+     past the last CPU so they can't collide with a real domain). */
+
+  ulong l3_key[ 2UL*1024UL ];
+  ulong l3_cnt = 0UL;
+  for( ulong i=0UL; i<cpus->cpu_cnt; i++ ) {
+    ulong key = cpus->cpu[ i ].online ? fd_topo_cpu_l3( i ) : ULONG_MAX;
+    if( FD_UNLIKELY( key==ULONG_MAX ) ) key = 1024UL + cpus->cpu[ i ].numa_node;
+
+    ulong l3 = 0UL;
+    while( l3<l3_cnt && l3_key[ l3 ]!=key ) l3++;
+    if( l3==l3_cnt ) {
+      FD_TEST( l3_cnt<sizeof(l3_key)/sizeof(l3_key[0]) );
+      l3_key[ l3_cnt++ ] = key;
+    }
+    cpus->cpu[ i ].l3 = l3;
+  }
+  cpus->l3_cnt = l3_cnt;
 }
 
 void
 fd_topo_cpus_printf( fd_topo_cpus_t * cpus ) {
   for( ulong i=0UL; i<cpus->cpu_cnt; i++ ) {
-    FD_LOG_NOTICE(( "cpu%lu: online=%i sibling=%lu numa_node=%lu", i, cpus->cpu[ i ].online, cpus->cpu[ i ].sibling, cpus->cpu[ i ].numa_node ));
+    FD_LOG_NOTICE(( "cpu%lu: online=%i sibling=%lu numa_node=%lu l3=%lu", i, cpus->cpu[ i ].online, cpus->cpu[ i ].sibling, cpus->cpu[ i ].numa_node, cpus->cpu[ i ].l3 ));
   }
 }
@@ -8,12 +8,14 @@ struct fd_topo_cpu {
   int   online;
   ulong numa_node;
   ulong sibling;
+  ulong l3;        /* Index of the L3 cache domain (e.g. AMD CCX) of the CPU, in [0,l3_cnt) */
 };
 
 typedef struct fd_topo_cpu fd_topo_cpu_t;
 
 struct fd_topo_cpus {
   ulong         numa_node_cnt;
+  ulong         l3_cnt;        /* Number of L3 cache domains, one per NUMA node if the OS does not report cache topology */
 
   ulong         cpu_cnt;
   fd_topo_cpu_t cpu[ 1024 ];
@@ -59,7 +59,8 @@ typedef struct {
    fragments referred to by the mcache entries.
 
    A link belongs to exactly one workspace.  A link has exactly one
-   producer, and 1 or more consumers.  Each consumer is either reliable
+   producer (unless it is a multi-producer link, see
+   fd_mcache_mp_reserve), and 1 or more consumers.  Each consumer is either reliable
    or not reliable.  A link has a depth and a MTU, which correspond to
    the depth and MTU of the mcache and dcache respectively.  A MTU of
    zero means no dcache is needed, as there is no data. */
@@ -83,6 +84,7 @@ typedef struct {
 
   uint permit_no_consumers : 1;  /* Permit a topology where this link has no consumers */
   uint permit_no_producers : 1;  /* Permit a topology where this link has no producers */
+  uint multi_producer      : 1;  /* Link can have more than one producer, which share the mcache and partition the dcache */
 } fd_topo_link_t;
 
 /* Be careful: ip and host are in different byte order */
@@ -125,6 +127,8 @@ struct fd_topo_tile {
   int   allow_shutdown;         /* If the tile is allowed to shutdown gracefully.  If false, when the tile exits it will tear down the entire application. */
 
   ulong cpu_idx;                /* The CPU index to pin the tile on.  A value of ULONG_MAX or more indicates the tile should be floating and not pinned to a core. */
+  ulong idle_wake_ns;           /* If non-zero, the tile backs off when it has no work instead of busy polling, and wakes up to check its inputs at least this often.  Zero means busy poll. */
+  int   link_latency;           /* If non-zero, the tile records publish and origin latency histograms for each polled in link into its link metrics. */
 
   ulong in_cnt;                 /* The number of links that this tile reads from. */
   ulong in_link_id[ FD_TOPO_MAX_TILE_IN_LINKS ];       /* The link_id of each link that this tile reads from, indexed in [0, in_cnt). */
@@ -348,11 +352,16 @@ struct fd_topo_tile {
       ushort listen_port;
 
       ulong max_http_connections;
+      ulong max_websocket_connections;
+      ulong max_subscriptions;
       ulong send_buffer_size_mb;
       ulong max_http_request_length;
+      int   reuse_port; /* set SO_REUSEPORT on the listen socket, only when several rpc tiles share the port */
 
       ulong max_live_slots;
 
+      ulong sigstatus_obj_id;
+
       char identity_key_path[ PATH_MAX ];
     } rpc;
 
@@ -368,6 +377,7 @@ struct fd_topo_tile {
       ulong funk_obj_id;
       ulong txncache_obj_id;
       ulong progcache_obj_id;
+      ulong sigstatus_obj_id; /* ULONG_MAX if RPC is disabled */
 
       char  shred_cap[ PATH_MAX ];
 
@@ -408,6 +418,7 @@ struct fd_topo_tile {
       ulong txncache_obj_id;
       ulong progcache_obj_id;
       ulong acc_pool_obj_id;
+      ulong sigstatus_obj_id; /* ULONG_MAX if RPC is disabled */
 
       ulong max_live_slots;
 
@@ -418,6 +429,8 @@ struct fd_topo_tile {
       int   dump_txn_to_pb;
       int   dump_syscall_to_pb;
       int   dump_elf_to_pb;
+
+      ulong vm_prof_obj_id; /* ULONG_MAX if not profiling */
     } exec;
 
     struct {
@@ -595,6 +608,7 @@ struct fd_topo_tile {
       ulong funk_obj_id;
       ulong progcache_obj_id;
       ulong acc_pool_obj_id;
+      ulong sigstatus_obj_id; /* ULONG_MAX if RPC is disabled */
     } bank;
 
     struct {
@@ -864,6 +878,46 @@ fd_topo_link_reliable_consumer_cnt( fd_topo_t const *      topo,
   return cnt;
 }
 
+/* Given a link, count the number of producers of that link among all
+   the tiles in the topology.  This is at most one unless the link is a
+   multi-producer link. */
+FD_FN_PURE static inline ulong
+fd_topo_link_producer_cnt( fd_topo_t const *      topo,
+                           fd_topo_link_t const * link ) {
+  ulong cnt = 0;
+  for( ulong i=0; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ i ];
+    for( ulong j=0; j<tile->out_cnt; j++ ) {
+      if( FD_UNLIKELY( tile->out_link_id[ j ] == link->id ) ) cnt++;
+    }
+  }
+
+  return cnt;
+}
+
+/* Given a link and one of its producer tiles, return the index of the
+   producer among all the producers of the link, ordered by tile id.
+   This is the dcache partition the producer writes to for
+   multi-producer links.  Returns ULONG_MAX if the tile does not
+   produce the link. */
+FD_FN_PURE static inline ulong
+fd_topo_link_producer_idx( fd_topo_t const *      topo,
+                           fd_topo_link_t const * link,
+                           fd_topo_tile_t const * producer ) {
+  ulong idx = 0;
+  for( ulong i=0; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ i ];
+    for( ulong j=0; j<tile->out_cnt; j++ ) {
+      if( FD_UNLIKELY( tile->out_link_id[ j ] == link->id ) ) {
+        if( FD_UNLIKELY( tile->id==producer->id ) ) return idx;
+        idx++;
+      }
+    }
+  }
+
+  return ULONG_MAX;
+}
+
 FD_FN_PURE static inline ulong
 fd_topo_tile_consumer_cnt( fd_topo_t const *      topo,
                            fd_topo_tile_t const * tile ) {
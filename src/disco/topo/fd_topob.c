@@ -88,6 +88,7 @@ fd_topob_link( fd_topo_t *  topo,
   link->depth    = depth;
   link->mtu      = mtu;
   link->burst    = burst;
+  link->multi_producer = 0;
 
   fd_topo_obj_t * obj = fd_topob_obj( topo, "mcache", wksp_name );
   link->mcache_obj_id = obj->id;
@@ -105,6 +106,18 @@ fd_topob_link( fd_topo_t *  topo,
   return link;
 }
 
+fd_topo_link_t *
+fd_topob_link_mp( fd_topo_t *  topo,
+                  char const * link_name,
+                  char const * wksp_name,
+                  ulong        depth,
+                  ulong        mtu,
+                  ulong        burst ) {
+  fd_topo_link_t * link = fd_topob_link( topo, link_name, wksp_name, depth, mtu, burst );
+  link->multi_producer = 1;
+  return link;
+}
+
 void
 fd_topob_tile_uses( fd_topo_t *      topo,
                     fd_topo_tile_t * tile,
@@ -143,6 +156,8 @@ fd_topob_tile( fd_topo_t *    topo,
   tile->kind_id             = kind_id;
   tile->is_agave            = is_agave;
   tile->cpu_idx             = cpu_idx;
+  tile->idle_wake_ns        = 0UL;
+  tile->link_latency        = 0;
   tile->in_cnt              = 0UL;
   tile->out_cnt             = 0UL;
   tile->uses_obj_cnt        = 0UL;
@@ -312,7 +327,8 @@ validate( fd_topo_t const * topo ) {
       FD_LOG_ERR(( "workspace %lu has id %lu", i, topo->workspaces[ i ].id ));
   }
 
-  /* Each link has exactly one producer */
+  /* Each link has exactly one producer, or at least one if it is a
+     multi-producer link */
   for( ulong i=0UL; i<topo->link_cnt; i++ ) {
     ulong producer_cnt = 0;
     for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
@@ -320,7 +336,7 @@ validate( fd_topo_t const * topo ) {
         if( topo->tiles[ j ].out_link_id[ k ]==i ) producer_cnt++;
       }
     }
-    if( FD_UNLIKELY( producer_cnt>1UL || ( producer_cnt==0UL && !topo->links[ i ].permit_no_producers ) ) )
+    if( FD_UNLIKELY( ( producer_cnt>1UL && !topo->links[ i ].multi_producer ) || ( producer_cnt==0UL && !topo->links[ i ].permit_no_producers ) ) )
       FD_LOG_ERR(( "link %lu (%s:%lu) has %lu producers", i, topo->links[ i ].name, topo->links[ i ].kind_id, producer_cnt ));
   }
 
@@ -333,12 +349,113 @@ validate( fd_topo_t const * topo ) {
   }
 }
 
+void
+fd_topob_tile_idle( fd_topo_t *  topo,
+                    char const * tile_name,
+                    ulong        wake_ns ) {
+  ulong cnt = 0UL;
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t * tile = &topo->tiles[ i ];
+    if( FD_LIKELY( strcmp( tile->name, tile_name ) ) ) continue;
+    tile->idle_wake_ns = wake_ns;
+    cnt++;
+  }
+  if( FD_UNLIKELY( !cnt ) ) FD_LOG_ERR(( "idle tile `%s` is not in the topology", tile_name ));
+}
+
+ulong
+fd_topob_link_weight( fd_topo_link_t const * link ) {
+  return sizeof(fd_frag_meta_t) + link->mtu;
+}
+
+/* Same as fd_topob_cross_l3_weight but with the producer tile of each
+   link (or ULONG_MAX if none) already looked up. */
+
+static ulong
+cross_l3_weight( fd_topo_t const *      topo,
+                 fd_topo_cpus_t const * cpus,
+                 ulong const *          producer,
+                 ulong *                _opt_total ) {
+  ulong cross = 0UL;
+  ulong total = 0UL;
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * consumer = &topo->tiles[ i ];
+    if( FD_UNLIKELY( consumer->cpu_idx>=cpus->cpu_cnt ) ) continue;
+
+    for( ulong j=0UL; j<consumer->in_cnt; j++ ) {
+      ulong link_id = consumer->in_link_id[ j ];
+      if( FD_UNLIKELY( producer[ link_id ]==ULONG_MAX ) ) continue;
+      fd_topo_tile_t const * prod = &topo->tiles[ producer[ link_id ] ];
+      if( FD_UNLIKELY( prod->cpu_idx>=cpus->cpu_cnt ) ) continue;
+
+      ulong weight = fd_topob_link_weight( &topo->links[ link_id ] );
+      total += weight;
+      if( cpus->cpu[ prod->cpu_idx ].l3!=cpus->cpu[ consumer->cpu_idx ].l3 ) cross += weight;
+    }
+  }
+  if( _opt_total ) *_opt_total = total;
+  return cross;
+}
+
+ulong
+fd_topob_cross_l3_weight( fd_topo_t const *      topo,
+                          fd_topo_cpus_t const * cpus,
+                          ulong *                _opt_total ) {
+  ulong producer[ FD_TOPO_MAX_LINKS ];
+  for( ulong i=0UL; i<topo->link_cnt; i++ ) producer[ i ] = fd_topo_find_link_producer( topo, &topo->links[ i ] );
+  return cross_l3_weight( topo, cpus, producer, _opt_total );
+}
+
+/* l3_swap greedily swaps the CPUs of pairs of pinned tiles on the same
+   NUMA node but in different L3 domains of cpus while that reduces the
+   link traffic crossing L3 domains.  Only tiles that are both HT
+   critical or both not (per is_critical, indexed by tile id) are
+   swapped, so the set of CPUs in use and the HT pairs kept idle for
+   critical tiles don't change.  Returns the resulting
+   fd_topob_cross_l3_weight, which is never more than before. */
+
+static ulong
+l3_swap( fd_topo_t *            topo,
+         fd_topo_cpus_t const * cpus,
+         int const *            is_critical ) {
+  ulong producer[ FD_TOPO_MAX_LINKS ];
+  for( ulong i=0UL; i<topo->link_cnt; i++ ) producer[ i ] = fd_topo_find_link_producer( topo, &topo->links[ i ] );
+
+  ulong cross = cross_l3_weight( topo, cpus, producer, NULL );
+  for( ulong pass=0UL; cross && pass<8UL; pass++ ) {
+    ulong cross_pass = cross;
+    for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+      fd_topo_tile_t * a = &topo->tiles[ i ];
+      if( FD_UNLIKELY( a->cpu_idx>=cpus->cpu_cnt ) ) continue;
+      for( ulong j=i+1UL; j<topo->tile_cnt; j++ ) {
+        fd_topo_tile_t * b = &topo->tiles[ j ];
+        if( FD_UNLIKELY( b->cpu_idx>=cpus->cpu_cnt ) ) continue;
+        if( is_critical[ i ]!=is_critical[ j ] ) continue;
+
+        fd_topo_cpu_t const * cpu_a = &cpus->cpu[ a->cpu_idx ];
+        fd_topo_cpu_t const * cpu_b = &cpus->cpu[ b->cpu_idx ];
+        if( cpu_a->numa_node!=cpu_b->numa_node || cpu_a->l3==cpu_b->l3 ) continue;
+
+        fd_swap( a->cpu_idx, b->cpu_idx );
+        ulong cross_swap = cross_l3_weight( topo, cpus, producer, NULL );
+        if( cross_swap<cross ) cross = cross_swap;
+        else                   fd_swap( a->cpu_idx, b->cpu_idx );
+      }
+    }
+    if( cross==cross_pass ) break;
+  }
+  return cross;
+}
+
 void
 fd_topob_auto_layout( fd_topo_t * topo,
                       int         reserve_agave_cores ) {
-  /* Incredibly simple automatic layout system for now ... just assign
-     tiles to CPU cores in NUMA sequential order, except for a few tiles
-     which should be floating. */
+  /* Simple automatic layout system for now ... just assign tiles to
+     CPU cores in NUMA and then L3 cache domain sequential order, except
+     for a few tiles which should be floating.  The ordered tiles below
+     are roughly in pipeline order, so most producer and consumer tiles
+     end up near each other, and a final pass below fixes up links that
+     still cross L3 domains. */
 
   char const * FLOATING[] = {
     "netlnk",
@@ -413,11 +530,13 @@ fd_topob_auto_layout( fd_topo_t * topo,
   int   pairs_assigned[ FD_TILE_MAX ] = { 0 };
 
   ulong next_cpu_idx   = 0UL;
-  for( ulong i=0UL; i<cpus->numa_node_cnt; i++ ) {
+  for( ulong i=0UL; i<cpus->numa_node_cnt*cpus->l3_cnt; i++ ) {
+    ulong numa_node = i / cpus->l3_cnt;
+    ulong l3        = i % cpus->l3_cnt;
     for( ulong j=0UL; j<cpus->cpu_cnt; j++ ) {
       fd_topo_cpu_t * cpu = &cpus->cpu[ j ];
 
-      if( FD_UNLIKELY( pairs_assigned[ j ] || cpu->numa_node!=i ) ) continue;
+      if( FD_UNLIKELY( pairs_assigned[ j ] || cpu->numa_node!=numa_node || cpu->l3!=l3 ) ) continue;
 
       FD_TEST( next_cpu_idx<FD_TILE_MAX );
       cpu_ordering[ next_cpu_idx++ ] = j;
@@ -482,6 +601,18 @@ fd_topob_auto_layout( fd_topo_t * topo,
     }
   }
 
+  /* Greedily swap tiles between L3 domains to reduce the link traffic
+     crossing them (see l3_swap). */
+
+  int is_critical[ FD_TOPO_MAX_TILES ] = {0};
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    for( ulong k=0UL; k<sizeof(CRITICAL_TILES)/sizeof(CRITICAL_TILES[0]); k++ ) {
+      if( !strcmp( topo->tiles[ i ].name, CRITICAL_TILES[ k ] ) ) is_critical[ i ] = 1;
+    }
+  }
+
+  l3_swap( topo, cpus, is_critical );
+
   /* Make sure all the tiles we haven't set are supposed to be floating. */
   for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
     fd_topo_tile_t * tile = &topo->tiles[ i ];
@@ -516,7 +647,11 @@ static void
 initialize_numa_assignments( fd_topo_t * topo ) {
   /* Assign workspaces to NUMA nodes.  The heuristic here is pretty
      simple for now: workspaces go on the NUMA node of the first
-     tile which maps the largest object in the workspace. */
+     tile which maps the largest object in the workspace.  If the
+     largest object belongs to a link, the workspace goes on the NUMA
+     node of the first pinned consumer of the link instead, since
+     consumers poll the mcache and read the payloads remotely while the
+     producer only streams writes into them. */
 
   for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
     ulong max_footprint = 0UL;
@@ -534,6 +669,25 @@ initialize_numa_assignments( fd_topo_t * topo ) {
 
     if( FD_UNLIKELY( max_obj==ULONG_MAX ) ) FD_LOG_ERR(( "no object found for workspace %s", topo->workspaces[ i ].name ));
 
+    int found_link = 0;
+    for( ulong j=0UL; j<topo->link_cnt && !found_link; j++ ) {
+      fd_topo_link_t const * link = &topo->links[ j ];
+      if( link->mcache_obj_id!=max_obj && !(link->mtu && link->dcache_obj_id==max_obj) ) continue;
+
+      for( ulong k=0UL; k<topo->tile_cnt && !found_link; k++ ) {
+        fd_topo_tile_t const * tile = &topo->tiles[ k ];
+        if( tile->cpu_idx>=FD_TILE_MAX ) continue;
+        for( ulong l=0UL; l<tile->in_cnt; l++ ) {
+          if( tile->in_link_id[ l ]!=link->id ) continue;
+          topo->workspaces[ i ].numa_idx = fd_numa_node_idx( tile->cpu_idx );
+          FD_TEST( topo->workspaces[ i ].numa_idx!=ULONG_MAX );
+          found_link = 1;
+          break;
+        }
+      }
+    }
+    if( FD_UNLIKELY( found_link ) ) continue;
+
     int found_strict = 0;
     int found_lazy   = 0;
     for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
@@ -605,6 +759,25 @@ fd_topob_finish( fd_topo_t *                topo,
     FD_TEST( !fd_pod_replacef_ulong( topo->props, cons_cnt, "obj.%lu.cons_cnt", tile->metrics_obj_id ) );
   }
 
+  /* Each producer of a multi-producer link gets an equal share of the
+     mcache depth as flow control credits and its own partition of the
+     dcache, which needs to be sized accordingly. */
+  for( ulong i=0UL; i<topo->link_cnt; i++ ) {
+    fd_topo_link_t * link = &topo->links[ i ];
+    if( FD_LIKELY( !link->multi_producer ) ) continue;
+
+    ulong producer_cnt = fd_ulong_max( fd_topo_link_producer_cnt( topo, link ), 1UL );
+    ulong cr_max       = fd_mcache_mp_cr_max( link->depth, producer_cnt );
+    if( FD_UNLIKELY( !cr_max || cr_max<link->burst ) )
+      FD_LOG_ERR(( "link %lu (%s:%lu) depth %lu too small for %lu producers with burst %lu",
+                   i, link->name, link->kind_id, link->depth, producer_cnt, link->burst ));
+
+    if( FD_LIKELY( link->mtu ) ) {
+      ulong data_sz = producer_cnt*fd_dcache_req_data_sz( link->mtu, cr_max, link->burst, 1 );
+      FD_TEST( !fd_pod_replacef_ulong( topo->props, data_sz, "obj.%lu.data_sz", link->dcache_obj_id ) );
+    }
+  }
+
   for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
     fd_topo_wksp_t * wksp = &topo->workspaces[ i ];
 
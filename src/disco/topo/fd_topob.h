@@ -5,6 +5,7 @@
    functions for creating a useful topology. */
 
 #include "../../disco/topo/fd_topo.h"
+#include "fd_cpu_topo.h"
 
 /* A link in the topology is either unpolled or polled.  Almost all
    links are polled, which means a tile which has this link as an in
@@ -80,6 +81,25 @@ fd_topob_link( fd_topo_t *  topo,
                ulong        mtu,
                ulong        burst );
 
+/* Same as fd_topob_link, but the link can have more than one producer
+   tile (see fd_mcache_mp_reserve).  Producers share the mcache and each
+   gets an equal share of the depth as flow control credits, so depth
+   should be at least the number of producers times burst.  The dcache
+   is partitioned between the producers and sized at fd_topob_finish
+   time once the producers are known.
+
+   No topology uses this yet.  A producer tile must write its payloads
+   into its own dcache partition (see fd_topo_link_producer_idx and
+   fd_dcache_compact_part_chunk0) before its links can be switched. */
+
+fd_topo_link_t *
+fd_topob_link_mp( fd_topo_t *  topo,
+                  char const * link_name,
+                  char const * wksp_name,
+                  ulong        depth,
+                  ulong        mtu,
+                  ulong        burst );
+
 /* Add a tile to the topology.  This creates various objects needed for
    a standard tile, including tile scratch memory, metrics memory and so
    on.  These objects will be created and linked to the respective
@@ -127,13 +147,48 @@ fd_topob_tile_out( fd_topo_t *  topo,
                    char const * link_name,
                    ulong        link_kind_id );
 
+/* Configure every tile named tile_name to back off when it has no
+   work to do instead of busy polling.  An idle tile escalates from
+   spinning, to spinning with a pause hint, to waiting on the input
+   link it last polled, and wakes up at least every wake_ns nanoseconds
+   to check all of its inputs and do housekeeping.  wake_ns of zero
+   restores busy polling.  Logs an error and exits if no tile in the
+   topology has the given name. */
+
+void
+fd_topob_tile_idle( fd_topo_t *  topo,
+                    char const * tile_name,
+                    ulong        wake_ns );
+
 /* Automatically layout the tiles onto CPUs in the topology for a
-   best effort. */
+   best effort.  Tiles are assigned in pipeline order to CPUs ordered
+   by NUMA node and then L3 cache domain, and then tiles on the same
+   NUMA node are swapped between cache domains where that reduces the
+   link traffic crossing them (see fd_topob_cross_l3_weight). */
 
 void
 fd_topob_auto_layout( fd_topo_t * topo,
                       int         reserve_agave_cores );
 
+/* fd_topob_link_weight returns the estimated number of bytes a frag
+   published to link moves from the cache of its producer to the cache
+   of each consumer: the frag metadata (fd_frag_meta_t) and, if the
+   link has a dcache, up to mtu bytes of payload. */
+
+FD_FN_PURE ulong
+fd_topob_link_weight( fd_topo_link_t const * link );
+
+/* fd_topob_cross_l3_weight returns the sum of fd_topob_link_weight
+   over all the (producer,consumer) tile pairs of links in topo where
+   both tiles are pinned to CPUs in different L3 cache domains of cpus.
+   If _opt_total is non-NULL, on return *_opt_total will hold the sum
+   over all pairs where both tiles are pinned. */
+
+ulong
+fd_topob_cross_l3_weight( fd_topo_t const *      topo,
+                          fd_topo_cpus_t const * cpus,
+                          ulong *                _opt_total );
+
 /* Finish creating the topology.  Lays out all the objects in the
    given workspaces, and sizes everything correctly.  Also validates
    the topology before returning.
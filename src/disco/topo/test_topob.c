@@ -0,0 +1,164 @@
+/* test_topob covers the L3 cache domain pass of fd_topob_auto_layout
+   (l3_swap) on synthetic topologies and CPU layouts, so it includes
+   fd_topob.c to get at the static pass. */
+
+#include "fd_topob.c"
+
+#define TILE_CNT (8UL)
+#define CPU_CNT  (8UL)
+
+static fd_topo_t      _topo[1];
+static fd_topo_cpus_t _cpus[1];
+
+/* cpus_init lays out CPU_CNT CPUs on one NUMA node with two L3 domains
+   interleaved in CPU numbering (even CPUs in domain 0, odd in 1), as
+   some AMD parts number their CCXs. */
+
+static fd_topo_cpus_t *
+cpus_init( fd_topo_cpus_t * cpus ) {
+  memset( cpus, 0, sizeof(fd_topo_cpus_t) );
+  cpus->numa_node_cnt = 1UL;
+  cpus->l3_cnt        = 2UL;
+  cpus->cpu_cnt       = CPU_CNT;
+  for( ulong i=0UL; i<CPU_CNT; i++ ) {
+    cpus->cpu[ i ] = (fd_topo_cpu_t){ .idx = i, .online = 1, .numa_node = 0UL, .sibling = ULONG_MAX, .l3 = i & 1UL };
+  }
+  return cpus;
+}
+
+/* topo_pipeline builds a pipeline of TILE_CNT tiles, tile i publishing
+   to tile i+1 on a link with a distinct mtu, plus a few fan out links
+   if fan_out is set. */
+
+static fd_topo_t *
+topo_pipeline( fd_topo_t * topo,
+               int         fan_out ) {
+  FD_TEST( fd_topob_new( topo, "test" )==topo );
+  fd_topob_wksp( topo, "test" );
+  for( ulong i=0UL; i<TILE_CNT; i++ ) fd_topob_tile( topo, "tile", "test", "test", ULONG_MAX, 0, 0 );
+  for( ulong i=0UL; i<TILE_CNT-1UL; i++ ) {
+    fd_topo_link_t * link = fd_topob_link( topo, "pipe", "test", 128UL, 256UL*(i+1UL), 1UL );
+    FD_TEST( fd_topob_link_weight( link )==sizeof(fd_frag_meta_t)+256UL*(i+1UL) );
+    fd_topob_tile_out( topo, "tile", i,     "pipe", i );
+    fd_topob_tile_in ( topo, "tile", i+1UL, "test", "pipe", i, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
+  }
+  if( fan_out ) {
+    for( ulong i=0UL; i<TILE_CNT/2UL; i++ ) {
+      fd_topo_link_t * link = fd_topob_link( topo, "fan", "test", 128UL, 0UL, 1UL );
+      FD_TEST( fd_topob_link_weight( link )==sizeof(fd_frag_meta_t) );
+      fd_topob_tile_out( topo, "tile", i,              "fan", i );
+      fd_topob_tile_in ( topo, "tile", TILE_CNT-1UL-i, "test", "fan", i, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
+    }
+  }
+  return topo;
+}
+
+/* test_swap runs l3_swap on topo with cpus assigned to tiles per
+   cpu_idx and checks that the cross L3 weight did not increase, that
+   the CPUs in use are the same, that tiles only move within the set of
+   same criticality and returns the resulting cross L3 weight. */
+
+static ulong
+test_swap( fd_topo_t *            topo,
+           fd_topo_cpus_t const * cpus,
+           ulong const *          cpu_idx,
+           int const *            is_critical ) {
+  for( ulong i=0UL; i<TILE_CNT; i++ ) topo->tiles[ i ].cpu_idx = cpu_idx[ i ];
+
+  ulong total  = 0UL;
+  ulong before = fd_topob_cross_l3_weight( topo, cpus, &total );
+  FD_TEST( total );
+  FD_TEST( before<=total );
+
+  ulong after = l3_swap( topo, cpus, is_critical );
+  FD_TEST( after<=before );
+
+  ulong total_after = 0UL;
+  FD_TEST( fd_topob_cross_l3_weight( topo, cpus, &total_after )==after );
+  FD_TEST( total_after==total );
+
+  int used[ CPU_CNT ] = {0};
+  for( ulong i=0UL; i<TILE_CNT; i++ ) {
+    ulong cpu = topo->tiles[ i ].cpu_idx;
+    FD_TEST( cpu<CPU_CNT );
+    FD_TEST( !used[ cpu ] );
+    used[ cpu ] = 1;
+
+    int found = 0;
+    for( ulong j=0UL; j<TILE_CNT; j++ ) found |= (cpu_idx[ j ]==cpu) & (is_critical[ j ]==is_critical[ i ]);
+    FD_TEST( found );
+  }
+  return after;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  fd_topo_cpus_t * cpus = cpus_init( _cpus );
+  int const no_critical[ TILE_CNT ] = {0};
+
+  /* Pipeline laid out in CPU order, so every link crosses L3 domains.
+     Swapping must reduce that while keeping half the tiles in each
+     domain. */
+
+  fd_topo_t * topo = topo_pipeline( _topo, 0 );
+  ulong const interleaved[ TILE_CNT ] = { 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL };
+  ulong total = 0UL;
+  for( ulong i=0UL; i<TILE_CNT; i++ ) topo->tiles[ i ].cpu_idx = interleaved[ i ];
+  FD_TEST( fd_topob_cross_l3_weight( topo, cpus, &total )==total );
+
+  FD_TEST( test_swap( topo, cpus, interleaved, no_critical )<total );
+  ulong l3_cnt[ 2 ] = {0};
+  for( ulong i=0UL; i<TILE_CNT; i++ ) l3_cnt[ cpus->cpu[ topo->tiles[ i ].cpu_idx ].l3 ]++;
+  FD_TEST( l3_cnt[ 0 ]==TILE_CNT/2UL && l3_cnt[ 1 ]==TILE_CNT/2UL );
+
+  /* Already optimal: nothing moves */
+
+  ulong const grouped[ TILE_CNT ] = { 0UL, 2UL, 4UL, 6UL, 1UL, 3UL, 5UL, 7UL };
+  FD_TEST( test_swap( topo, cpus, grouped, no_critical )==fd_topob_link_weight( &topo->links[ 3 ] ) );
+  for( ulong i=0UL; i<TILE_CNT; i++ ) FD_TEST( topo->tiles[ i ].cpu_idx==grouped[ i ] );
+
+  /* A critical tile has no other critical tile to swap with, so it
+     stays put. */
+
+  int const one_critical[ TILE_CNT ] = { 0, 0, 0, 1, 0, 0, 0, 0 };
+  test_swap( topo, cpus, interleaved, one_critical );
+  FD_TEST( topo->tiles[ 3 ].cpu_idx==interleaved[ 3 ] );
+
+  /* Random layouts and criticality, with and without fan out links */
+
+  for( int fan_out=0; fan_out<2; fan_out++ ) {
+    topo = topo_pipeline( _topo, fan_out );
+    for( ulong iter=0UL; iter<1000UL; iter++ ) {
+      ulong cpu_idx    [ TILE_CNT ];
+      int   is_critical[ TILE_CNT ];
+      for( ulong i=0UL; i<TILE_CNT; i++ ) {
+        cpu_idx    [ i ] = i;
+        is_critical[ i ] = !fd_rng_uint_roll( rng, 4U );
+      }
+      for( ulong i=TILE_CNT-1UL; i>0UL; i-- ) {
+        ulong j = fd_rng_ulong_roll( rng, i+1UL );
+        fd_swap( cpu_idx[ i ], cpu_idx[ j ] );
+      }
+      test_swap( topo, cpus, cpu_idx, is_critical );
+    }
+  }
+
+  /* Tiles on different NUMA nodes are never swapped */
+
+  topo = topo_pipeline( _topo, 1 );
+  for( ulong i=0UL; i<CPU_CNT; i++ ) cpus->cpu[ i ].numa_node = i & 1UL;
+  cpus->numa_node_cnt = 2UL;
+  test_swap( topo, cpus, interleaved, no_critical );
+  for( ulong i=0UL; i<TILE_CNT; i++ ) FD_TEST( topo->tiles[ i ].cpu_idx==interleaved[ i ] );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -14,6 +14,7 @@
 #include "../../flamenco/runtime/fd_runtime.h"
 #include "../../flamenco/runtime/fd_bank.h"
 #include "../../flamenco/runtime/fd_acc_pool.h"
+#include "../../flamenco/runtime/fd_sigstatus.h"
 #include "../../flamenco/accdb/fd_accdb_impl_v1.h"
 #include "../../flamenco/progcache/fd_progcache_user.h"
 #include "../../flamenco/log_collector/fd_log_collector.h"
@@ -57,6 +58,8 @@ struct fd_bank_ctx {
   fd_accdb_user_t accdb[1];
   fd_progcache_t  progcache[1];
 
+  fd_sigstatus_t * sigstatus; /* NULL if RPC is disabled */
+
   fd_runtime_t runtime[1];
 
   /* For bundle execution, we need to execute each transaction against
@@ -251,6 +254,11 @@ handle_microblock( fd_bank_ctx_t *     ctx,
                     cost_tracker->account_cost_limit ));
     }
 
+    if( FD_UNLIKELY( ctx->sigstatus ) ) {
+      fd_sigstatus_insert( ctx->sigstatus, txn->payload+TXN( txn )->signature_off, fd_bank_slot_get( bank ),
+                           txn_out->err.txn_err, txn_out->err.exec_err, (uint)txn_out->err.exec_err_idx, txn_out->err.custom_err );
+    }
+
     uint actual_execution_cus = (uint)(txn_out->details.compute_budget.compute_unit_limit - txn_out->details.compute_budget.compute_meter);
     uint actual_acct_data_cus = (uint)(txn_out->details.txn_cost.transaction.loaded_accounts_data_size_cost);
 
@@ -420,6 +428,11 @@ handle_bundle( fd_bank_ctx_t *     ctx,
                       cost_tracker->account_cost_limit ));
       }
 
+      if( FD_UNLIKELY( ctx->sigstatus ) ) {
+        fd_sigstatus_insert( ctx->sigstatus, signature, fd_bank_slot_get( bank ),
+                             txn_out->err.txn_err, txn_out->err.exec_err, (uint)txn_out->err.exec_err_idx, txn_out->err.custom_err );
+      }
+
       uint actual_execution_cus = (uint)(txn_out->details.compute_budget.compute_unit_limit - txn_out->details.compute_budget.compute_meter);
       uint actual_acct_data_cus = (uint)(txn_out->details.txn_cost.transaction.loaded_accounts_data_size_cost);
       if( FD_UNLIKELY( fd_txn_is_simple_vote_transaction( TXN( &txns[ i ] ), txns[ i ].payload ) ) ) {
@@ -597,6 +610,11 @@ unprivileged_init( fd_topo_t *      topo,
   fd_txncache_t * txncache = fd_txncache_join( fd_txncache_new( _txncache, txncache_shmem ) );
   FD_TEST( txncache );
 
+  ctx->sigstatus = NULL;
+  if( FD_UNLIKELY( tile->bank.sigstatus_obj_id!=ULONG_MAX ) ) {
+    ctx->sigstatus = fd_sigstatus_join( fd_topo_obj_laddr( topo, tile->bank.sigstatus_obj_id ) );
+    FD_TEST( ctx->sigstatus );
+  }
 
   fd_acc_pool_t * acc_pool = fd_acc_pool_join( fd_topo_obj_laddr( topo, tile->bank.acc_pool_obj_id ) );
   FD_TEST( acc_pool );
@@ -617,6 +635,7 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->runtime->log.capture_ctx          = NULL;
   ctx->runtime->log.dumping_mem          = NULL;
   ctx->runtime->log.tracing_mem          = NULL;
+  ctx->runtime->log.vm_prof              = NULL;
 
   ulong banks_obj_id = fd_pod_queryf_ulong( topo->props, ULONG_MAX, "banks" );
   FD_TEST( banks_obj_id!=ULONG_MAX );
@@ -7,6 +7,7 @@
 #include "../../flamenco/runtime/fd_bank.h"
 #include "../../flamenco/runtime/fd_runtime.h"
 #include "../../flamenco/runtime/fd_acc_pool.h"
+#include "../../flamenco/runtime/fd_sigstatus.h"
 #include "../../flamenco/accdb/fd_accdb_impl_v1.h"
 #include "../../flamenco/progcache/fd_progcache_user.h"
 #include "../../flamenco/log_collector/fd_log_collector.h"
@@ -51,6 +52,7 @@ typedef struct fd_exec_tile_ctx {
   fd_progcache_t        progcache[1];
 
   fd_txncache_t *       txncache;
+  fd_sigstatus_t *      sigstatus; /* NULL if RPC is disabled */
 
   ulong                 txn_idx;
   ulong                 slot;
@@ -191,6 +193,15 @@ returnable_frag( fd_exec_tile_ctx_t * ctx,
 
         if( FD_LIKELY( ctx->txn_out.err.is_committable ) ) {
           fd_runtime_commit_txn( ctx->runtime, ctx->bank, &ctx->txn_out );
+          if( FD_UNLIKELY( ctx->sigstatus ) ) {
+            fd_sigstatus_insert( ctx->sigstatus,
+                                 (uchar *)ctx->txn_in.txn->payload + TXN( ctx->txn_in.txn )->signature_off,
+                                 fd_bank_slot_get( ctx->bank ),
+                                 ctx->txn_out.err.txn_err,
+                                 ctx->txn_out.err.exec_err,
+                                 (uint)ctx->txn_out.err.exec_err_idx,
+                                 ctx->txn_out.err.custom_err );
+          }
         } else {
           fd_runtime_cancel_txn( ctx->runtime, &ctx->txn_out );
         }
@@ -344,6 +355,12 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->txncache = fd_txncache_join( fd_txncache_new( _txncache, txncache_shmem ) );
   FD_TEST( ctx->txncache );
 
+  ctx->sigstatus = NULL;
+  if( FD_UNLIKELY( tile->exec.sigstatus_obj_id!=ULONG_MAX ) ) {
+    ctx->sigstatus = fd_sigstatus_join( fd_topo_obj_laddr( topo, tile->exec.sigstatus_obj_id ) );
+    FD_TEST( ctx->sigstatus );
+  }
+
   ctx->txn_in.bundle.is_bundle = 0;
 
   /********************************************************************/
@@ -419,6 +436,11 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->runtime->log.enable_vm_tracing    = 0;
   ctx->runtime->log.tracing_mem          = &ctx->tracing_mem[0][0];
   ctx->runtime->log.capture_ctx          = ctx->capture_ctx;
+  ctx->runtime->log.vm_prof              = NULL;
+  if( FD_UNLIKELY( tile->exec.vm_prof_obj_id!=ULONG_MAX ) ) {
+    ctx->runtime->log.vm_prof = fd_vm_prof_join( fd_topo_obj_laddr( topo, tile->exec.vm_prof_obj_id ) );
+    if( FD_UNLIKELY( !ctx->runtime->log.vm_prof ) ) FD_LOG_ERR(( "Failed to join vm_prof" ));
+  }
 
   memset( &ctx->metrics,          0, sizeof(ctx->metrics)          );
   memset( &ctx->runtime->metrics, 0, sizeof(ctx->runtime->metrics) );
@@ -28,6 +28,7 @@
 
 #include "../../flamenco/runtime/fd_runtime.h"
 #include "../../flamenco/runtime/fd_runtime_stack.h"
+#include "../../flamenco/runtime/fd_sigstatus.h"
 #include "../../flamenco/runtime/fd_genesis_parse.h"
 #include "../../flamenco/fd_flamenco_base.h"
 #include "../../flamenco/runtime/sysvar/fd_sysvar_epoch_schedule.h"
@@ -149,6 +150,8 @@ struct fd_replay_tile {
   fd_store_t *    store;
   fd_banks_t *    banks;
 
+  fd_sigstatus_t * sigstatus; /* NULL if RPC is disabled */
+
   /* This flag is 1 If we have seen a vote signature that our node has
      sent out get rooted at least one time.  The value is 0 otherwise.
      We can't become leader and pack blocks until this flag has been
@@ -380,9 +383,10 @@ struct fd_replay_tile {
   /* The gui tile needs to reliably own a reference to the most recent
      completed active bank.  Replay needs to know if the gui as a
      consumer is enabled so it can increment the bank's refcnt before
-     publishing the bank_idx to the gui. */
-  int gui_enabled;
-  int rpc_enabled;
+     publishing the bank_idx to the gui.  Likewise every rpc tile
+     holds its own reference to the most recent reset bank. */
+  int   gui_enabled;
+  ulong rpc_tile_cnt;
 
 # if FD_HAS_FLATCC
   /* For dumping blocks to protobuf. For backtest only. */
@@ -605,6 +609,7 @@ replay_block_start( fd_replay_tile_t *  ctx,
   fd_bank_slot_set( bank, slot );
   fd_bank_parent_slot_set( bank, parent_slot );
   bank->txncache_fork_id = fd_txncache_attach_child( ctx->txncache, parent_bank->txncache_fork_id );
+  if( FD_UNLIKELY( ctx->sigstatus ) ) fd_sigstatus_slot_begin( ctx->sigstatus, slot );
 
   /* Create a new funk txn for the block. */
 
@@ -874,6 +879,7 @@ prepare_leader_bank( fd_replay_tile_t *  ctx,
   fd_bank_slot_set( ctx->leader_bank, slot );
   fd_bank_parent_slot_set( ctx->leader_bank, parent_slot );
   ctx->leader_bank->txncache_fork_id = fd_txncache_attach_child( ctx->txncache, parent_bank->txncache_fork_id );
+  if( FD_UNLIKELY( ctx->sigstatus ) ) fd_sigstatus_slot_begin( ctx->sigstatus, slot );
   /* prepare the funk transaction for the leader bank */
   fd_funk_txn_xid_t xid        = { .ul = { slot, ctx->leader_bank->idx } };
   fd_funk_txn_xid_t parent_xid = { .ul = { parent_slot, parent_bank_idx } };
@@ -1306,7 +1312,7 @@ publish_reset( fd_replay_tile_t *  ctx,
   }
   reset->next_leader_slot = ctx->next_leader_slot;
 
-  if( FD_LIKELY( ctx->rpc_enabled ) ) bank->refcnt++;
+  bank->refcnt += ctx->rpc_tile_cnt;
   FD_LOG_DEBUG(( "bank (idx=%lu, slot=%lu) refcnt incremented to %lu", bank->idx, reset->completed_slot, bank->refcnt ));
 
   fd_stem_publish( stem, ctx->replay_out->idx, REPLAY_SIG_RESET, ctx->replay_out->chunk, sizeof(fd_poh_reset_t), 0UL, 0UL, fd_frag_meta_ts_comp( fd_tickcount() ) );
@@ -1892,6 +1898,7 @@ advance_published_root( fd_replay_tile_t * ctx ) {
   funk_publish( ctx, advanceable_root_slot, bank->idx );
 
   fd_txncache_advance_root( ctx->txncache, bank->txncache_fork_id );
+  if( FD_UNLIKELY( ctx->sigstatus ) ) fd_sigstatus_slot_root( ctx->sigstatus, advanceable_root_slot );
   fd_sched_advance_root( ctx->sched, advanceable_root_idx );
   fd_banks_advance_root( ctx->banks, advanceable_root_idx );
   fd_reasm_publish( ctx->reasm, &advanceable_root_ele->block_id );
@@ -2146,7 +2153,7 @@ process_tower_slot_done( fd_replay_tile_t *           ctx,
     }
     reset->next_leader_slot = ctx->next_leader_slot;
 
-    if( FD_LIKELY( ctx->rpc_enabled ) ) bank->refcnt++;
+    bank->refcnt += ctx->rpc_tile_cnt;
     FD_LOG_DEBUG(( "bank (idx=%lu, slot=%lu) refcnt incremented to %lu", bank->idx, msg->reset_slot, bank->refcnt ));
 
     fd_stem_publish( stem, ctx->replay_out->idx, REPLAY_SIG_RESET, ctx->replay_out->chunk, sizeof(fd_poh_reset_t), 0UL, 0UL, fd_frag_meta_ts_comp( fd_tickcount() ) );
@@ -2537,6 +2544,12 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->txncache = fd_txncache_join( fd_txncache_new( _txncache, txncache_shmem ) );
   FD_TEST( ctx->txncache );
 
+  ctx->sigstatus = NULL;
+  if( FD_UNLIKELY( tile->replay.sigstatus_obj_id!=ULONG_MAX ) ) {
+    ctx->sigstatus = fd_sigstatus_join( fd_topo_obj_laddr( topo, tile->replay.sigstatus_obj_id ) );
+    FD_TEST( ctx->sigstatus );
+  }
+
   ctx->capture_ctx = NULL;
   if( FD_UNLIKELY( strcmp( "", tile->replay.solcap_capture ) || strcmp( "", tile->replay.dump_proto_dir ) ) ) {
     ctx->capture_ctx = fd_capture_ctx_join( fd_capture_ctx_new( _capture_ctx ) );
@@ -2636,7 +2649,7 @@ unprivileged_init( fd_topo_t *      topo,
   exec_out->chunk  = exec_out->chunk0;
 
   ctx->gui_enabled = fd_topo_find_tile( topo, "gui", 0UL )!=ULONG_MAX;
-  ctx->rpc_enabled = fd_topo_find_tile( topo, "rpc", 0UL )!=ULONG_MAX;
+  ctx->rpc_tile_cnt = fd_topo_tile_name_cnt( topo, "rpc" );
 
   if( FD_UNLIKELY( strcmp( "", tile->replay.solcap_capture ) ) ) {
     idx = fd_topo_find_tile_out_link( topo, tile, "cap_repl", 0UL );
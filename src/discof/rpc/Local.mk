@@ -1,3 +1,18 @@
 ifdef FD_HAS_ALLOCA
 $(call add-objs,fd_rpc_tile,fd_discof)
 endif
+$(call add-objs,fd_rpc_json,fd_discof)
+$(call add-objs,fd_rpc_cache,fd_discof)
+$(call add-objs,fd_rpc_pubsub,fd_discof)
+ifdef FD_HAS_ATOMIC
+$(call make-unit-test,test_rpc_json,test_rpc_json,fd_discof fd_ballet fd_util)
+$(call run-unit-test,test_rpc_json)
+$(call make-unit-test,test_rpc_cache,test_rpc_cache,fd_discof fd_util)
+$(call run-unit-test,test_rpc_cache)
+$(call make-unit-test,test_rpc_pubsub,test_rpc_pubsub,fd_discof fd_ballet fd_util)
+$(call run-unit-test,test_rpc_pubsub)
+ifdef FD_HAS_HOSTED
+$(call make-unit-test,bench_rpc_reuseport,bench_rpc_reuseport,fd_waltz fd_ballet fd_util)
+$(call make-unit-test,bench_rpc_pubsub,bench_rpc_pubsub,fd_discof fd_ballet fd_util)
+endif
+endif
@@ -0,0 +1,230 @@
+/* bench_rpc_pubsub measures the notification pass of the RPC
+   subscription engine (fd_rpc_pubsub) against a synthetic swarm of
+   WebSocket clients.
+
+   --conn-cnt connections each subscribe to --sub-per-conn accounts.
+   Half of the subscriptions are drawn from --hot-cnt popular accounts
+   which change every pass, the rest from --cold-cnt accounts of which
+   --cold-pct percent change per pass.  All accounts hold --data-sz
+   bytes.  One in --slow-every connections only drains its send queue
+   every eighth pass, and so gets conflated notifications, and one in
+   --dead-every never drains at all, and so is eventually evicted.
+   The sink copies each message into a scratch buffer, which stands in
+   for staging it into the HTTP server's outgoing ring.
+
+   Each of --pass-cnt passes looks at every subscribed account, as the
+   RPC tile does on a replay reset.  Reports notifications per second,
+   how many bodies were serialized for them, and, for comparison, the
+   time it takes to serialize one body, which a server encoding every
+   notification separately would pay per notification. */
+
+#include "fd_rpc_pubsub.h"
+#include "../../util/fd_util.h"
+
+#if FD_HAS_HOSTED
+
+#include <stdlib.h>
+
+#define ACCT_MAX (1UL<<20)
+#define MSG_MAX  (FD_RPC_PUBSUB_BODY_SZ( 1UL<<20 )+256UL)
+
+struct bench_sink {
+  ulong   pass;
+  ulong   slow_every;
+  ulong * room;
+  uchar * msg;
+  ulong   msg_sz;
+  ulong   close_cnt;
+};
+
+typedef struct bench_sink bench_sink_t;
+
+static ulong
+bench_room( ulong  conn,
+            void * ctx ) {
+  bench_sink_t * s = ctx;
+  return s->room[ conn ];
+}
+
+static void
+bench_send( ulong                       conn,
+            fd_rpc_pubsub_msg_t const * msg,
+            void *                      ctx ) {
+  bench_sink_t * s = ctx;
+  s->room[ conn ]--;
+
+  ulong off = 0UL;
+  for( ulong i=0UL; i<FD_RPC_PUBSUB_MSG_PART_CNT; i++ ) {
+    fd_memcpy( s->msg+off, msg->part[ i ].data, msg->part[ i ].sz );
+    off += msg->part[ i ].sz;
+  }
+  s->msg_sz += off;
+}
+
+static void
+bench_close( ulong  conn,
+             void * ctx ) {
+  bench_sink_t * s = ctx;
+  s->room[ conn ] = 0UL;
+  s->close_cnt++;
+}
+
+static fd_rpc_pubsub_sink_t const bench_sink = { .room = bench_room, .send = bench_send, .close = bench_close };
+
+/* drain refills the send queues of the connections which are due to
+   drain this pass. */
+
+static void
+drain( bench_sink_t * s,
+       ulong          conn_cnt,
+       uchar const *  dead ) {
+  for( ulong conn=0UL; conn<conn_cnt; conn++ ) {
+    if( FD_UNLIKELY( dead[ conn ] ) ) continue;
+    int slow = s->slow_every && !(conn % s->slow_every);
+    if( FD_UNLIKELY( slow && (s->pass & 7UL) ) ) continue;
+    s->room[ conn ] = 64UL;
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong conn_cnt     = fd_env_strip_cmdline_ulong( &argc, &argv, "--conn-cnt",     NULL, 1024UL );
+  ulong sub_per_conn = fd_env_strip_cmdline_ulong( &argc, &argv, "--sub-per-conn", NULL,   16UL );
+  ulong hot_cnt      = fd_env_strip_cmdline_ulong( &argc, &argv, "--hot-cnt",      NULL,   16UL );
+  ulong cold_cnt     = fd_env_strip_cmdline_ulong( &argc, &argv, "--cold-cnt",     NULL, 8192UL );
+  ulong cold_pct     = fd_env_strip_cmdline_ulong( &argc, &argv, "--cold-pct",     NULL,    1UL );
+  ulong data_sz      = fd_env_strip_cmdline_ulong( &argc, &argv, "--data-sz",      NULL,  512UL );
+  ulong slow_every   = fd_env_strip_cmdline_ulong( &argc, &argv, "--slow-every",   NULL,   20UL );
+  ulong dead_every   = fd_env_strip_cmdline_ulong( &argc, &argv, "--dead-every",   NULL,  200UL );
+  ulong pass_cnt     = fd_env_strip_cmdline_ulong( &argc, &argv, "--pass-cnt",     NULL,  256UL );
+
+  ulong acct_cnt = hot_cnt+cold_cnt;
+  ulong sub_max  = conn_cnt*sub_per_conn;
+  if( FD_UNLIKELY( !conn_cnt || !sub_per_conn || !hot_cnt || acct_cnt>ACCT_MAX || data_sz>(1UL<<20) ) ) FD_LOG_ERR(( "invalid arguments" ));
+
+  FD_LOG_NOTICE(( "--conn-cnt %lu --sub-per-conn %lu --hot-cnt %lu --cold-cnt %lu --cold-pct %lu --data-sz %lu --slow-every %lu --dead-every %lu --pass-cnt %lu",
+                  conn_cnt, sub_per_conn, hot_cnt, cold_cnt, cold_pct, data_sz, slow_every, dead_every, pass_cnt ));
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  ulong body_max = FD_RPC_PUBSUB_BODY_SZ( data_sz );
+  ulong fp       = fd_rpc_pubsub_footprint( sub_max, conn_cnt, body_max );
+  FD_TEST( fp );
+  void * mem = aligned_alloc( FD_RPC_PUBSUB_ALIGN, fd_ulong_align_up( fp, FD_RPC_PUBSUB_ALIGN ) );
+  FD_TEST( mem );
+
+  bench_sink_t s[1] = {{ .slow_every = slow_every }};
+  s->room = calloc( conn_cnt, sizeof(ulong) );
+  s->msg  = malloc( MSG_MAX );
+  uchar       * dead     = calloc( conn_cnt, 1UL );
+  fd_pubkey_t * keys     = malloc( acct_cnt*sizeof(fd_pubkey_t) );
+  ulong       * mod_slot = calloc( acct_cnt, sizeof(ulong) );
+  uchar       * data     = malloc( data_sz+1UL );
+  FD_TEST( s->room && s->msg && dead && keys && mod_slot && data );
+
+  for( ulong i=0UL; i<acct_cnt; i++ ) {
+    for( ulong j=0UL; j<4UL; j++ ) keys[ i ].ul[ j ] = fd_rng_ulong( rng );
+  }
+  for( ulong i=0UL; i<data_sz; i++ ) data[ i ] = fd_rng_uchar( rng );
+  uchar owner[ 32 ]; memset( owner, 7, 32UL );
+
+  fd_rpc_pubsub_t * pubsub = fd_rpc_pubsub_join( fd_rpc_pubsub_new( mem, sub_max, conn_cnt, body_max, fd_rng_ulong( rng ), &bench_sink, s ) );
+  FD_TEST( pubsub );
+
+  /* Subscribe.  Accounts look unchanged since slot 0. */
+
+  for( ulong conn=0UL; conn<conn_cnt; conn++ ) {
+    dead[ conn ] = (uchar)( dead_every && !((conn+1UL) % dead_every) );
+    for( ulong i=0UL; i<sub_per_conn; i++ ) {
+      ulong acct = (i&1UL) ? fd_rng_ulong_roll( rng, hot_cnt ) : hot_cnt+fd_rng_ulong_roll( rng, fd_ulong_max( cold_cnt, 1UL ) );
+      acct = fd_ulong_min( acct, acct_cnt-1UL );
+      FD_TEST( fd_rpc_pubsub_account_subscribe( pubsub, conn, &keys[ acct ], 0UL )!=ULONG_MAX );
+    }
+  }
+
+  /* Map engine account indices back to accounts once, as a funk lookup
+     would by address. */
+
+  ulong * idx_acct = malloc( sub_max*sizeof(ulong) );
+  FD_TEST( idx_acct );
+  ulong sub_acct_cnt = 0UL;
+  for( ulong idx=fd_rpc_pubsub_account_first( pubsub ); idx!=ULONG_MAX; idx=fd_rpc_pubsub_account_next( pubsub, idx ) ) {
+    fd_pubkey_t const * key = fd_rpc_pubsub_account_pubkey( pubsub, idx );
+    ulong acct = ULONG_MAX;
+    for( ulong i=0UL; i<acct_cnt; i++ ) if( fd_pubkey_eq( &keys[ i ], key ) ) { acct = i; break; }
+    FD_TEST( acct!=ULONG_MAX && idx<sub_max );
+    idx_acct[ idx ] = acct;
+    sub_acct_cnt++;
+  }
+  FD_LOG_NOTICE(( "%lu subscriptions on %lu accounts", fd_rpc_pubsub_metrics( pubsub )->sub_cnt, sub_acct_cnt ));
+
+  /* Passes */
+
+  long dt = 0L;
+  for( ulong pass=1UL; pass<=pass_cnt; pass++ ) {
+    s->pass = pass;
+    for( ulong i=0UL; i<hot_cnt; i++ ) mod_slot[ i ] = pass;
+    for( ulong i=hot_cnt; i<acct_cnt; i++ ) if( fd_rng_ulong_roll( rng, 100UL )<cold_pct ) mod_slot[ i ] = pass;
+    drain( s, conn_cnt, dead );
+
+    long t0 = fd_log_wallclock();
+    fd_rpc_pubsub_publish_begin( pubsub );
+    for( ulong idx=fd_rpc_pubsub_account_first( pubsub ); idx!=ULONG_MAX; idx=fd_rpc_pubsub_account_next( pubsub, idx ) ) {
+      ulong acct = idx_acct[ idx ];
+      if( FD_LIKELY( !fd_rpc_pubsub_account_stale( pubsub, idx, mod_slot[ acct ] ) ) ) continue;
+      data[ 0 ] = (uchar)pass;
+      fd_rpc_pubsub_account_t a = { .data = data, .data_sz = data_sz, .lamports = pass, .owner = owner, .executable = 0 };
+      fd_rpc_pubsub_account_stage( pubsub, pass, &a );
+      fd_rpc_pubsub_account_publish( pubsub, idx, mod_slot[ acct ] );
+    }
+    fd_rpc_pubsub_publish_end( pubsub );
+    dt += fd_log_wallclock() - t0;
+  }
+
+  fd_rpc_pubsub_metrics_t const * m = fd_rpc_pubsub_metrics( pubsub );
+  FD_LOG_NOTICE(( "%lu passes in %.3f ms, %.3f us/pass", pass_cnt, (double)dt/1e6, (double)dt/1e3/(double)pass_cnt ));
+  FD_LOG_NOTICE(( "%lu notifications (%.3f M/s, %.1f ns each), %lu bodies serialized (%.1f notifications per body)",
+                  m->notify_cnt, (double)m->notify_cnt*1e3/(double)dt, (double)dt/(double)fd_ulong_max( m->notify_cnt, 1UL ),
+                  m->serialize_cnt, (double)m->notify_cnt/(double)fd_ulong_max( m->serialize_cnt, 1UL ) ));
+  FD_LOG_NOTICE(( "%lu conflated, %lu evicted (sink closed %lu), %lu oversize, %.1f MiB sent",
+                  m->conflate_cnt, m->evict_cnt, s->close_cnt, m->oversize_cnt, (double)s->msg_sz/(double)(1UL<<20) ));
+
+  /* The cost of serializing a single body, which a server encoding
+     each notification separately would pay per notification. */
+
+  fd_rpc_pubsub_publish_begin( pubsub );
+  ulong iter_cnt = 4096UL;
+  fd_rpc_pubsub_account_t a = { .data = data, .data_sz = data_sz, .lamports = 1UL, .owner = owner, .executable = 0 };
+  long t0 = fd_log_wallclock();
+  for( ulong i=0UL; i<iter_cnt; i++ ) {
+    data[ 0 ] = (uchar)i;
+    FD_TEST( fd_rpc_pubsub_account_stage( pubsub, i, &a ) );
+  }
+  long stage_dt = fd_log_wallclock() - t0;
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_LOG_NOTICE(( "serializing one %lu byte account takes %.1f ns", data_sz, (double)stage_dt/(double)iter_cnt ));
+
+  FD_TEST( fd_rpc_pubsub_delete( fd_rpc_pubsub_leave( pubsub ) )==mem );
+  free( idx_acct ); free( data ); free( mod_slot ); free( keys ); free( dead ); free( s->msg ); free( s->room ); free( mem );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
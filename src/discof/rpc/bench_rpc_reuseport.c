@@ -0,0 +1,286 @@
+/* bench_rpc_reuseport measures request latency of an RPC service that
+   is sharded across several tiles listening on the same port with
+   SO_REUSEPORT, as the rpc tiles are, against the number of tiles.
+
+   Tiles [1,server_cnt] each run an fd_http_server event loop answering
+   JSON-RPC style POST requests.  Most requests are answered right away,
+   but one in --slow-every takes --slow-us of busy work to stand in for
+   an expensive method like getLeaderSchedule or a large getBlock.  The
+   following client_cnt tiles are local HTTP clients that each send
+   --req-cnt requests back to back, one connection per request as the
+   server does not keep connections alive, and record the latency of
+   each from connect to the end of the response.  Reports throughput and
+   the p50 and p99 latency of the cheap requests, which is what a single
+   server loop makes suffer, and of all requests.
+
+   Run with at least 1+client_cnt+server_cnt tiles, e.g.
+
+     --tile-cpus f,f,f,f,f,f,f,f,f
+
+   for 4 clients and up to 4 servers (use dedicated cores for meaningful
+   numbers).  Server counts of 1,2,4,... are benchmarked as tile count
+   permits. */
+
+#include "../../waltz/http/fd_http_server.h"
+#include "../../util/fd_util.h"
+#include "../../util/net/fd_ip4.h"
+
+#if FD_HAS_HOSTED && FD_HAS_ATOMIC
+
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#define SORT_NAME        sort_lat
+#define SORT_KEY_T       long
+#define SORT_BEFORE(a,b) ((a)<(b))
+#include "../../util/tmpl/fd_sort.c"
+
+#define SERVER_MAX (32UL)
+#define CLIENT_MAX (16UL)
+#define REQ_MAX    (1UL<<14)
+
+#define REQ_PREFIX "{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\""
+#define REQ_SLOW   "getLeaderSchedule"
+#define REQ_FAST   "getSlot"
+
+static ushort       port;
+static ulong        server_cnt;
+static ulong        req_cnt;
+static ulong        slow_every;
+static long         slow_ns;
+static ulong        ready_cnt;
+static volatile int halt;
+
+static ulong served_cnt[ SERVER_MAX ];
+static long  lat     [ CLIENT_MAX ][ REQ_MAX ];
+static uchar lat_slow[ CLIENT_MAX ][ REQ_MAX ];
+static long  all_lat [ CLIENT_MAX*REQ_MAX ];
+static long  fast_lat[ CLIENT_MAX*REQ_MAX ];
+
+struct bench_server {
+  fd_http_server_t * http;
+  ulong              idx;
+};
+
+typedef struct bench_server bench_server_t;
+
+static fd_http_server_response_t
+request( fd_http_server_request_t const * request ) {
+  bench_server_t * server = (bench_server_t *)request->ctx;
+
+  if( FD_UNLIKELY( request->method!=FD_HTTP_SERVER_METHOD_POST ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  ulong prefix_len = sizeof(REQ_PREFIX)-1UL;
+  int   slow       = request->post.body_len>=prefix_len+sizeof(REQ_SLOW)-1UL &&
+                     !memcmp( request->post.body+prefix_len, REQ_SLOW, sizeof(REQ_SLOW)-1UL );
+  if( FD_UNLIKELY( slow ) ) {
+    long deadline = fd_log_wallclock() + slow_ns;
+    while( fd_log_wallclock()<deadline ) FD_SPIN_PAUSE();
+  }
+
+  fd_http_server_printf( server->http, "{\"jsonrpc\":\"2.0\",\"result\":%lu,\"id\":1}", server->idx );
+  fd_http_server_response_t response = { .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
+  FD_TEST( !fd_http_server_stage_body( server->http, &response ) );
+  served_cnt[ server->idx ]++;
+  return response;
+}
+
+static int
+server_main( int     argc,
+             char ** argv ) {
+  (void)argv;
+
+  fd_http_server_params_t params = {
+    .max_connection_cnt    = 2UL*CLIENT_MAX,
+    .max_ws_connection_cnt = 0UL,
+    .max_request_len       = 1024UL,
+    .max_ws_recv_frame_len = 0UL,
+    .max_ws_send_frame_cnt = 0UL,
+    .outgoing_buffer_sz    = 1UL<<20,
+    .reuse_port            = 1,
+  };
+
+  fd_http_server_callbacks_t callbacks = { .request = request };
+
+  bench_server_t server = { .idx = (ulong)argc };
+  void * mem = aligned_alloc( fd_http_server_align(), fd_http_server_footprint( params ) ); FD_TEST( mem );
+  server.http = fd_http_server_join( fd_http_server_new( mem, params, callbacks, &server ) );
+  FD_TEST( server.http );
+
+  FD_TEST( fd_http_server_listen( server.http, FD_IP4_ADDR( 127, 0, 0, 1 ), port ) );
+  FD_ATOMIC_FETCH_AND_ADD( &ready_cnt, 1UL );
+
+  while( !halt ) fd_http_server_poll( server.http, 0 );
+
+  /* Clients are stopped first, so every connection has been answered
+     and closed.  Close the listener so the next round does not share
+     the port with this one. */
+
+  if( FD_UNLIKELY( close( fd_http_server_fd( server.http ) ) ) ) FD_LOG_ERR(( "close failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+  free( fd_http_server_delete( fd_http_server_leave( server.http ) ) );
+  return 0;
+}
+
+static int
+client_main( int     argc,
+             char ** argv ) {
+  (void)argv;
+  ulong client_idx = (ulong)argc;
+
+  fd_rng_t _rng[1];
+  fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, (uint)client_idx, 0UL ) );
+
+  struct sockaddr_in addr = {
+    .sin_family      = AF_INET,
+    .sin_port        = fd_ushort_bswap( port ),
+    .sin_addr.s_addr = FD_IP4_ADDR( 127, 0, 0, 1 ),
+  };
+
+  char req_slow[ 256 ];
+  char req_fast[ 256 ];
+  ulong req_slow_len;
+  ulong req_fast_len;
+# define REQ_FMT "POST / HTTP/1.1\r\nHost: localhost\r\nContent-Type: application/json\r\nContent-Length: %lu\r\n\r\n%s"
+  FD_TEST( fd_cstr_printf_check( req_slow, sizeof(req_slow), &req_slow_len, REQ_FMT, sizeof(REQ_PREFIX REQ_SLOW "\"}")-1UL, REQ_PREFIX REQ_SLOW "\"}" ) );
+  FD_TEST( fd_cstr_printf_check( req_fast, sizeof(req_fast), &req_fast_len, REQ_FMT, sizeof(REQ_PREFIX REQ_FAST "\"}")-1UL, REQ_PREFIX REQ_FAST "\"}" ) );
+# undef REQ_FMT
+
+  for( ulong i=0UL; i<req_cnt; i++ ) {
+    int slow = !fd_rng_ulong_roll( rng, slow_every );
+
+    long t0 = fd_log_wallclock();
+
+    int fd = socket( AF_INET, SOCK_STREAM, 0 );
+    if( FD_UNLIKELY( -1==fd ) ) FD_LOG_ERR(( "socket failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+    if( FD_UNLIKELY( -1==connect( fd, fd_type_pun( &addr ), sizeof(addr) ) ) ) FD_LOG_ERR(( "connect failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+
+    char const * req     = slow ? req_slow     : req_fast;
+    ulong        req_len = slow ? req_slow_len : req_fast_len;
+    if( FD_UNLIKELY( (long)req_len!=send( fd, req, req_len, MSG_NOSIGNAL ) ) ) FD_LOG_ERR(( "send failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+
+    /* The server closes the connection after the response */
+
+    char  resp[ 1024 ];
+    ulong resp_len = 0UL;
+    for(;;) {
+      long n = recv( fd, resp+resp_len, sizeof(resp)-resp_len, 0 );
+      if( FD_UNLIKELY( n<0L ) ) FD_LOG_ERR(( "recv failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+      if( !n ) break;
+      resp_len += (ulong)n;
+      FD_TEST( resp_len<sizeof(resp) );
+    }
+    close( fd );
+
+    lat     [ client_idx ][ i ] = fd_log_wallclock() - t0;
+    lat_slow[ client_idx ][ i ] = (uchar)slow;
+
+    FD_TEST( resp_len>=12UL && !memcmp( resp, "HTTP/1.1 200", 12UL ) );
+  }
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  return 0;
+}
+
+static void
+bench( ulong _server_cnt,
+       ulong client_cnt ) {
+  server_cnt = _server_cnt;
+  ready_cnt  = 0UL;
+  halt       = 0;
+  memset( served_cnt, 0, sizeof(served_cnt) );
+  FD_COMPILER_MFENCE();
+
+  fd_tile_exec_t * server_exec[ SERVER_MAX ];
+  for( ulong i=0UL; i<server_cnt; i++ ) {
+    server_exec[ i ] = fd_tile_exec_new( 1UL+i, server_main, (int)i, NULL );
+    FD_TEST( server_exec[ i ] );
+  }
+  while( FD_VOLATILE_CONST( ready_cnt )<server_cnt ) FD_SPIN_PAUSE();
+
+  long dt = -fd_log_wallclock();
+  fd_tile_exec_t * client_exec[ CLIENT_MAX ];
+  for( ulong i=0UL; i<client_cnt; i++ ) {
+    client_exec[ i ] = fd_tile_exec_new( 1UL+server_cnt+i, client_main, (int)i, NULL );
+    FD_TEST( client_exec[ i ] );
+  }
+  for( ulong i=0UL; i<client_cnt; i++ ) fd_tile_exec_delete( client_exec[ i ], NULL );
+  dt += fd_log_wallclock();
+
+  halt = 1;
+  FD_COMPILER_MFENCE();
+  for( ulong i=0UL; i<server_cnt; i++ ) fd_tile_exec_delete( server_exec[ i ], NULL );
+
+  ulong all_cnt  = 0UL;
+  ulong fast_cnt = 0UL;
+  for( ulong c=0UL; c<client_cnt; c++ ) {
+    for( ulong i=0UL; i<req_cnt; i++ ) {
+      all_lat[ all_cnt++ ] = lat[ c ][ i ];
+      if( !lat_slow[ c ][ i ] ) fast_lat[ fast_cnt++ ] = lat[ c ][ i ];
+    }
+  }
+  FD_TEST( fast_cnt );
+  sort_lat_inplace( all_lat,  all_cnt  );
+  sort_lat_inplace( fast_lat, fast_cnt );
+
+  ulong served_min = ULONG_MAX;
+  ulong served_max = 0UL;
+  for( ulong i=0UL; i<server_cnt; i++ ) {
+    served_min = fd_ulong_min( served_min, served_cnt[ i ] );
+    served_max = fd_ulong_max( served_max, served_cnt[ i ] );
+  }
+
+  FD_LOG_NOTICE(( "server_cnt %2lu: %9.1f req/s, fast p50 %8.1f us p99 %8.1f us, all p50 %8.1f us p99 %8.1f us (per server requests [%lu,%lu])",
+                  server_cnt, 1e9*(double)all_cnt/(double)dt,
+                  1e-3*(double)fast_lat[ fast_cnt/2UL ], 1e-3*(double)fast_lat[ (fast_cnt*99UL)/100UL ],
+                  1e-3*(double)all_lat [ all_cnt /2UL ], 1e-3*(double)all_lat [ (all_cnt *99UL)/100UL ],
+                  served_min, served_max ));
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong client_cnt = fd_env_strip_cmdline_ulong ( &argc, &argv, "--client-cnt", NULL,           4UL );
+  ulong slow_us    = fd_env_strip_cmdline_ulong ( &argc, &argv, "--slow-us",    NULL,        2000UL );
+  port             = fd_env_strip_cmdline_ushort( &argc, &argv, "--port",       NULL, (ushort)18899 );
+  req_cnt          = fd_env_strip_cmdline_ulong ( &argc, &argv, "--req-cnt",    NULL,        2000UL );
+  slow_every       = fd_env_strip_cmdline_ulong ( &argc, &argv, "--slow-every", NULL,          16UL );
+  slow_ns          = 1000L*(long)slow_us;
+
+  if( FD_UNLIKELY( !client_cnt || client_cnt>CLIENT_MAX ) ) FD_LOG_ERR(( "--client-cnt must be in [1,%lu]", CLIENT_MAX ));
+  if( FD_UNLIKELY( !req_cnt    || req_cnt>REQ_MAX       ) ) FD_LOG_ERR(( "--req-cnt must be in [1,%lu]", REQ_MAX ));
+  if( FD_UNLIKELY( slow_every<2UL                       ) ) FD_LOG_ERR(( "--slow-every must be at least 2" ));
+
+  ulong tile_cnt = fd_tile_cnt();
+  if( FD_UNLIKELY( tile_cnt<2UL+client_cnt ) ) {
+    FD_LOG_WARNING(( "skip: benchmark requires at least %lu tiles (e.g. --tile-cpus f,f,f,f,f,f)", 2UL+client_cnt ));
+    fd_halt();
+    return 0;
+  }
+
+  FD_LOG_NOTICE(( "Benchmarking sharded RPC serving (--port %hu --client-cnt %lu --req-cnt %lu --slow-every %lu --slow-us %ld)",
+                  port, client_cnt, req_cnt, slow_every, slow_ns/1000L ));
+
+  for( ulong s=1UL; s<=fd_ulong_min( tile_cnt-1UL-client_cnt, SERVER_MAX ); s<<=1 ) bench( s, client_cnt );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED and FD_HAS_ATOMIC capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
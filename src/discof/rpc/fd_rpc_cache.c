@@ -0,0 +1,183 @@
+#include "fd_rpc_cache.h"
+#include "../../util/log/fd_log.h"
+
+#define FD_RPC_CACHE_MAGIC (0xf17eda2ce59cac00UL) /* firedancer rpc cache v0 */
+
+struct fd_rpc_cache_ent {
+  ulong key; /* 0 if empty */
+  ulong off; /* offset of the body in the data region */
+  ulong sz;
+};
+
+typedef struct fd_rpc_cache_ent fd_rpc_cache_ent_t;
+
+struct __attribute__((aligned(FD_RPC_CACHE_ALIGN))) fd_rpc_cache_private {
+  ulong magic;
+  ulong ent_max;
+  ulong data_max;
+  ulong ent_cnt;
+  ulong data_used;
+
+  fd_rpc_cache_metrics_t metrics;
+
+  /* ent_max fd_rpc_cache_ent_t then data_max bytes follow */
+};
+
+static inline fd_rpc_cache_ent_t *
+fd_rpc_cache_private_ent( fd_rpc_cache_t const * cache ) {
+  return (fd_rpc_cache_ent_t *)( (ulong)cache + sizeof(fd_rpc_cache_t) );
+}
+
+static inline uchar *
+fd_rpc_cache_private_data( fd_rpc_cache_t const * cache ) {
+  return (uchar *)( (ulong)fd_rpc_cache_private_ent( cache ) + cache->ent_max*sizeof(fd_rpc_cache_ent_t) );
+}
+
+FD_FN_CONST ulong
+fd_rpc_cache_align( void ) {
+  return FD_RPC_CACHE_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_rpc_cache_footprint( ulong ent_max,
+                        ulong data_max ) {
+  if( FD_UNLIKELY( ent_max<2UL || !fd_ulong_is_pow2( ent_max ) || ent_max>(1UL<<32) ) ) return 0UL;
+  if( FD_UNLIKELY( !data_max || data_max>(1UL<<40) ) ) return 0UL;
+  return fd_ulong_align_up( sizeof(fd_rpc_cache_t) + ent_max*sizeof(fd_rpc_cache_ent_t) + data_max, FD_RPC_CACHE_ALIGN );
+}
+
+void *
+fd_rpc_cache_new( void * shmem,
+                  ulong  ent_max,
+                  ulong  data_max ) {
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_rpc_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_rpc_cache_footprint( ent_max, data_max ) ) ) {
+    FD_LOG_WARNING(( "bad ent_max (%lu) or data_max (%lu)", ent_max, data_max ));
+    return NULL;
+  }
+
+  fd_rpc_cache_t * cache = (fd_rpc_cache_t *)shmem;
+  memset( cache, 0, sizeof(fd_rpc_cache_t) );
+  cache->ent_max  = ent_max;
+  cache->data_max = data_max;
+  memset( fd_rpc_cache_private_ent( cache ), 0, ent_max*sizeof(fd_rpc_cache_ent_t) );
+
+  FD_COMPILER_MFENCE();
+  cache->magic = FD_RPC_CACHE_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_rpc_cache_t *
+fd_rpc_cache_join( void * shcache ) {
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  fd_rpc_cache_t * cache = (fd_rpc_cache_t *)shcache;
+  if( FD_UNLIKELY( cache->magic!=FD_RPC_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return cache;
+}
+
+void *
+fd_rpc_cache_leave( fd_rpc_cache_t * cache ) {
+  return (void *)cache;
+}
+
+void *
+fd_rpc_cache_delete( void * shcache ) {
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  fd_rpc_cache_t * cache = (fd_rpc_cache_t *)shcache;
+  if( FD_UNLIKELY( cache->magic!=FD_RPC_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  cache->magic = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shcache;
+}
+
+void
+fd_rpc_cache_reset( fd_rpc_cache_t * cache ) {
+  if( FD_LIKELY( !cache->ent_cnt ) ) return;
+  memset( fd_rpc_cache_private_ent( cache ), 0, cache->ent_max*sizeof(fd_rpc_cache_ent_t) );
+  cache->ent_cnt   = 0UL;
+  cache->data_used = 0UL;
+}
+
+uchar const *
+fd_rpc_cache_query( fd_rpc_cache_t * cache,
+                    ulong            key,
+                    ulong *          sz ) {
+  fd_rpc_cache_ent_t const * ent  = fd_rpc_cache_private_ent( cache );
+  ulong                      mask = cache->ent_max-1UL;
+
+  /* The table is never more than half full, so probing terminates */
+
+  for( ulong i=fd_ulong_hash( key )&mask;; i=(i+1UL)&mask ) {
+    if( ent[ i ].key==key ) {
+      cache->metrics.hit_cnt++;
+      *sz = ent[ i ].sz;
+      return fd_rpc_cache_private_data( cache ) + ent[ i ].off;
+    }
+    if( !ent[ i ].key ) break;
+  }
+
+  cache->metrics.miss_cnt++;
+  return NULL;
+}
+
+int
+fd_rpc_cache_insert( fd_rpc_cache_t * cache,
+                     ulong            key,
+                     uchar const *    body,
+                     ulong            sz ) {
+  if( FD_UNLIKELY( !key ) ) FD_LOG_ERR(( "zero key" ));
+
+  if( FD_UNLIKELY( cache->ent_cnt>=cache->ent_max/2UL || sz>cache->data_max-cache->data_used ) ) {
+    cache->metrics.insert_fail_cnt++;
+    return 0;
+  }
+
+  fd_rpc_cache_ent_t * ent  = fd_rpc_cache_private_ent( cache );
+  ulong                mask = cache->ent_max-1UL;
+
+  ulong i = fd_ulong_hash( key )&mask;
+  while( ent[ i ].key ) i = (i+1UL)&mask;
+
+  fd_memcpy( fd_rpc_cache_private_data( cache ) + cache->data_used, body, sz );
+  ent[ i ].key = key;
+  ent[ i ].off = cache->data_used;
+  ent[ i ].sz  = sz;
+
+  cache->ent_cnt++;
+  cache->data_used += sz;
+  return 1;
+}
+
+fd_rpc_cache_metrics_t const *
+fd_rpc_cache_metrics( fd_rpc_cache_t const * cache ) {
+  return &cache->metrics;
+}
@@ -0,0 +1,111 @@
+#ifndef HEADER_fd_src_discof_rpc_fd_rpc_cache_h
+#define HEADER_fd_src_discof_rpc_fd_rpc_cache_h
+
+/* fd_rpc_cache is a cache of pre-serialized JSON-RPC response bodies.
+   Many RPC methods return exactly the same result to every caller until
+   the node's view of the chain changes (a slot completes, the fork
+   choice resets, ...), yet clients poll them at a high rate.  The RPC
+   tile serializes such a response once, stores it here, and serves
+   later requests with a single copy into the outgoing buffer.
+
+   Entries are keyed by a ulong chosen by the caller, which must capture
+   the method and every request parameter that affects the response
+   (see FD_RPC_CACHE_KEY).  Since the parameters are parsed first, the
+   key is canonical: requests that differ only in whitespace, key
+   order, or parameters that do not affect the result share an entry.
+
+   A JSON-RPC response also echoes the request id, which differs between
+   callers.  The RPC tile always writes the id last, so the cached body
+   is the response up to and including the "id": key, and the id and
+   closing brace are appended when serving.
+
+   There is no per-entry expiry.  The owner calls fd_rpc_cache_reset
+   whenever any input to a cached response may have changed, which
+   drops everything.  Entries and their bodies are bump allocated from
+   a fixed region between resets, and inserts simply fail once it is
+   full.  The cache is local to a single tile and not thread safe. */
+
+#include "../../util/fd_util_base.h"
+
+#define FD_RPC_CACHE_ALIGN (64UL)
+
+/* FD_RPC_CACHE_KEY forms a cache key from a method (FD_RPC_METHOD_*)
+   and a method specific variant in [0,2^32) describing the parameters
+   that affect the response. */
+
+#define FD_RPC_CACHE_KEY( method, variant ) ((((ulong)(method)+1UL)<<32) | (ulong)(uint)(variant))
+
+struct fd_rpc_cache_metrics {
+  ulong hit_cnt;         /* queries that found an entry */
+  ulong miss_cnt;        /* queries that did not */
+  ulong insert_fail_cnt; /* inserts dropped because the cache was full */
+};
+
+typedef struct fd_rpc_cache_metrics fd_rpc_cache_metrics_t;
+
+struct fd_rpc_cache_private;
+typedef struct fd_rpc_cache_private fd_rpc_cache_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_rpc_cache_{align,footprint} give the alignment and footprint of a
+   memory region suitable to hold a cache of at most ent_max entries
+   (a power of two) with data_max bytes of bodies in total.  Returns 0
+   footprint for invalid parameters.
+
+   fd_rpc_cache_new formats such a region, the cache starts out empty.
+   fd_rpc_cache_{join,leave,delete} are the usual. */
+
+FD_FN_CONST ulong
+fd_rpc_cache_align( void );
+
+FD_FN_CONST ulong
+fd_rpc_cache_footprint( ulong ent_max,
+                        ulong data_max );
+
+void *
+fd_rpc_cache_new( void * shmem,
+                  ulong  ent_max,
+                  ulong  data_max );
+
+fd_rpc_cache_t *
+fd_rpc_cache_join( void * shcache );
+
+void *
+fd_rpc_cache_leave( fd_rpc_cache_t * cache );
+
+void *
+fd_rpc_cache_delete( void * shcache );
+
+/* fd_rpc_cache_reset drops all entries.  Cheap, it does not touch the
+   body region, and the entry table only if it is not already empty. */
+
+void
+fd_rpc_cache_reset( fd_rpc_cache_t * cache );
+
+/* fd_rpc_cache_query looks up key.  On a hit, returns a pointer to the
+   cached body and sets *sz to its size.  The pointer is valid until the
+   next reset.  Returns NULL on a miss.  Updates the hit and miss
+   counters. */
+
+uchar const *
+fd_rpc_cache_query( fd_rpc_cache_t * cache,
+                    ulong            key,
+                    ulong *          sz );
+
+/* fd_rpc_cache_insert stores a copy of body [body,body+sz) under key,
+   which must not already be present.  Returns 1 on success and 0 if the
+   cache is full. */
+
+int
+fd_rpc_cache_insert( fd_rpc_cache_t * cache,
+                     ulong            key,
+                     uchar const *    body,
+                     ulong            sz );
+
+fd_rpc_cache_metrics_t const *
+fd_rpc_cache_metrics( fd_rpc_cache_t const * cache );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_discof_rpc_fd_rpc_cache_h */
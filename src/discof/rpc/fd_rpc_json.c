@@ -0,0 +1,273 @@
+#include "fd_rpc_json.h"
+
+static inline int
+fd_rpc_json_is_ws( char c ) {
+  return (c==' ') | (c=='\t') | (c=='\n') | (c=='\r');
+}
+
+static inline int
+fd_rpc_json_is_digit( char c ) {
+  return (uint)(c-'0')<10U;
+}
+
+static inline int
+fd_rpc_json_is_hex( char c ) {
+  return fd_rpc_json_is_digit( c ) | ((uint)((c|0x20)-'a')<6U);
+}
+
+static inline ulong
+fd_rpc_json_skip_ws( char const * buf,
+                     ulong        i,
+                     ulong        sz ) {
+  while( FD_LIKELY( i<sz && fd_rpc_json_is_ws( buf[ i ] ) ) ) i++;
+  return i;
+}
+
+/* fd_rpc_json_scan_string scans the string whose opening quote is at
+   buf[ i ].  Returns the index one past the closing quote and sets
+   *escaped if a backslash was seen, or returns ULONG_MAX if the string
+   is malformed or unterminated. */
+
+static ulong
+fd_rpc_json_scan_string( char const * buf,
+                         ulong        i,
+                         ulong        sz,
+                         int *        escaped ) {
+  i++;
+  for(;;) {
+    if( FD_UNLIKELY( i>=sz ) ) return ULONG_MAX;
+    char c = buf[ i ];
+    if( FD_LIKELY( c=='"' ) ) return i+1UL;
+    if( FD_UNLIKELY( (uchar)c<0x20 ) ) return ULONG_MAX;
+    if( FD_UNLIKELY( c=='\\' ) ) {
+      *escaped = 1;
+      if( FD_UNLIKELY( i+1UL>=sz ) ) return ULONG_MAX;
+      switch( buf[ i+1UL ] ) {
+        case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+          i += 2UL;
+          break;
+        case 'u':
+          if( FD_UNLIKELY( i+6UL>sz ) ) return ULONG_MAX;
+          if( FD_UNLIKELY( !( fd_rpc_json_is_hex( buf[ i+2UL ] ) & fd_rpc_json_is_hex( buf[ i+3UL ] ) &
+                              fd_rpc_json_is_hex( buf[ i+4UL ] ) & fd_rpc_json_is_hex( buf[ i+5UL ] ) ) ) ) return ULONG_MAX;
+          i += 6UL;
+          break;
+        default:
+          return ULONG_MAX;
+      }
+      continue;
+    }
+    i++;
+  }
+}
+
+/* fd_rpc_json_scan_number scans the number starting at buf[ i ].
+   Returns the index one past the end of the number, or ULONG_MAX if it
+   does not match the JSON number grammar. */
+
+static ulong
+fd_rpc_json_scan_number( char const * buf,
+                         ulong        i,
+                         ulong        sz ) {
+  if( buf[ i ]=='-' ) i++;
+  if( FD_UNLIKELY( i>=sz || !fd_rpc_json_is_digit( buf[ i ] ) ) ) return ULONG_MAX;
+  if( buf[ i ]=='0' ) i++;
+  else while( i<sz && fd_rpc_json_is_digit( buf[ i ] ) ) i++;
+
+  if( i<sz && buf[ i ]=='.' ) {
+    i++;
+    if( FD_UNLIKELY( i>=sz || !fd_rpc_json_is_digit( buf[ i ] ) ) ) return ULONG_MAX;
+    while( i<sz && fd_rpc_json_is_digit( buf[ i ] ) ) i++;
+  }
+
+  if( i<sz && (buf[ i ]|0x20)=='e' ) {
+    i++;
+    if( i<sz && (buf[ i ]=='+' || buf[ i ]=='-') ) i++;
+    if( FD_UNLIKELY( i>=sz || !fd_rpc_json_is_digit( buf[ i ] ) ) ) return ULONG_MAX;
+    while( i<sz && fd_rpc_json_is_digit( buf[ i ] ) ) i++;
+  }
+
+  return i;
+}
+
+long
+fd_rpc_json_parse( fd_rpc_json_tok_t * tok,
+                   ulong               tok_max,
+                   char const *        buf,
+                   ulong               sz ) {
+  if( FD_UNLIKELY( sz>(ulong)UINT_MAX ) ) return FD_RPC_JSON_ERR_INVAL;
+
+  uint  stack[ FD_RPC_JSON_DEPTH_MAX ]; /* indices of open containers */
+  ulong depth = 0UL;
+  ulong cnt   = 0UL;
+  ulong i     = fd_rpc_json_skip_ws( buf, 0UL, sz );
+
+  for(;;) {
+
+    /* Expecting a value at buf[ i ] */
+
+    if( FD_UNLIKELY( i>=sz       ) ) return FD_RPC_JSON_ERR_INVAL;
+    if( FD_UNLIKELY( cnt>=tok_max ) ) return FD_RPC_JSON_ERR_FULL;
+
+    fd_rpc_json_tok_t * t = tok+cnt;
+    t->flags = 0;
+    t->off   = (uint)i;
+    t->cnt   = 0U;
+    cnt++;
+
+    char c = buf[ i ];
+    switch( c ) {
+      case '{':
+      case '[': {
+        if( FD_UNLIKELY( depth>=FD_RPC_JSON_DEPTH_MAX ) ) return FD_RPC_JSON_ERR_INVAL;
+        t->type = (uchar)fd_int_if( c=='{', FD_RPC_JSON_TYPE_OBJECT, FD_RPC_JSON_TYPE_ARRAY );
+        stack[ depth++ ] = (uint)(cnt-1UL);
+        i = fd_rpc_json_skip_ws( buf, i+1UL, sz );
+        if( FD_UNLIKELY( i>=sz ) ) return FD_RPC_JSON_ERR_INVAL;
+        if( buf[ i ]==(c+2) ) goto close; /* '{'+2=='}', '['+2==']' */
+        if( c=='{' ) goto key;
+        continue;
+      }
+      case '"': {
+        int   escaped = 0;
+        ulong end     = fd_rpc_json_scan_string( buf, i, sz, &escaped );
+        if( FD_UNLIKELY( end==ULONG_MAX ) ) return FD_RPC_JSON_ERR_INVAL;
+        t->type  = FD_RPC_JSON_TYPE_STRING;
+        t->flags = (uchar)escaped;
+        t->off   = (uint)(i+1UL);
+        t->len   = (uint)(end-i-2UL);
+        i = end;
+        break;
+      }
+      case 't':
+        if( FD_UNLIKELY( i+4UL>sz || memcmp( buf+i, "true", 4UL ) ) ) return FD_RPC_JSON_ERR_INVAL;
+        t->type = FD_RPC_JSON_TYPE_TRUE;  t->len = 4U; i += 4UL;
+        break;
+      case 'f':
+        if( FD_UNLIKELY( i+5UL>sz || memcmp( buf+i, "false", 5UL ) ) ) return FD_RPC_JSON_ERR_INVAL;
+        t->type = FD_RPC_JSON_TYPE_FALSE; t->len = 5U; i += 5UL;
+        break;
+      case 'n':
+        if( FD_UNLIKELY( i+4UL>sz || memcmp( buf+i, "null", 4UL ) ) ) return FD_RPC_JSON_ERR_INVAL;
+        t->type = FD_RPC_JSON_TYPE_NULL;  t->len = 4U; i += 4UL;
+        break;
+      default: {
+        ulong end = fd_rpc_json_scan_number( buf, i, sz );
+        if( FD_UNLIKELY( end==ULONG_MAX ) ) return FD_RPC_JSON_ERR_INVAL;
+        t->type = FD_RPC_JSON_TYPE_NUMBER;
+        t->len  = (uint)(end-i);
+        i = end;
+        break;
+      }
+    }
+    t->next = (uint)cnt;
+
+    /* A value just finished.  Account for it in the enclosing container
+       and figure out what comes next, closing as many containers as
+       needed. */
+
+    for(;;) {
+      if( FD_UNLIKELY( !depth ) ) {
+        i = fd_rpc_json_skip_ws( buf, i, sz );
+        if( FD_UNLIKELY( i!=sz ) ) return FD_RPC_JSON_ERR_INVAL;
+        return (long)cnt;
+      }
+
+      tok[ stack[ depth-1UL ] ].cnt++;
+
+      i = fd_rpc_json_skip_ws( buf, i, sz );
+      if( FD_UNLIKELY( i>=sz ) ) return FD_RPC_JSON_ERR_INVAL;
+
+      if( buf[ i ]==',' ) {
+        i = fd_rpc_json_skip_ws( buf, i+1UL, sz );
+        if( tok[ stack[ depth-1UL ] ].type==FD_RPC_JSON_TYPE_OBJECT ) goto key;
+        break;
+      }
+
+close:
+      {
+        fd_rpc_json_tok_t * p = tok + stack[ depth-1UL ];
+        char want = fd_char_if( p->type==FD_RPC_JSON_TYPE_OBJECT, '}', ']' );
+        if( FD_UNLIKELY( buf[ i ]!=want ) ) return FD_RPC_JSON_ERR_INVAL;
+        i++;
+        p->len  = (uint)(i-p->off);
+        p->next = (uint)cnt;
+        depth--;
+      }
+      continue;
+
+key:
+      {
+        /* Expecting "key": at buf[ i ] */
+        if( FD_UNLIKELY( i>=sz || buf[ i ]!='"' ) ) return FD_RPC_JSON_ERR_INVAL;
+        if( FD_UNLIKELY( cnt>=tok_max           ) ) return FD_RPC_JSON_ERR_FULL;
+        int   escaped = 0;
+        ulong end     = fd_rpc_json_scan_string( buf, i, sz, &escaped );
+        if( FD_UNLIKELY( end==ULONG_MAX ) ) return FD_RPC_JSON_ERR_INVAL;
+        fd_rpc_json_tok_t * k = tok+cnt;
+        k->type  = FD_RPC_JSON_TYPE_STRING;
+        k->flags = (uchar)escaped;
+        k->off   = (uint)(i+1UL);
+        k->len   = (uint)(end-i-2UL);
+        k->cnt   = 0U;
+        cnt++;
+        k->next  = (uint)cnt;
+        i = fd_rpc_json_skip_ws( buf, end, sz );
+        if( FD_UNLIKELY( i>=sz || buf[ i ]!=':' ) ) return FD_RPC_JSON_ERR_INVAL;
+        i = fd_rpc_json_skip_ws( buf, i+1UL, sz );
+      }
+      break;
+    }
+  }
+}
+
+ulong
+fd_rpc_json_obj_get( fd_rpc_json_tok_t const * tok,
+                     char const *              buf,
+                     ulong                     obj,
+                     char const *              key,
+                     ulong                     key_len ) {
+  if( FD_UNLIKELY( tok[ obj ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return FD_RPC_JSON_IDX_NULL;
+
+  ulong cnt = tok[ obj ].cnt;
+  ulong k   = obj+1UL;
+  for( ulong i=0UL; i<cnt; i++ ) {
+    ulong v = k+1UL;
+    if( fd_rpc_json_str_eq( tok, buf, k, key, key_len ) ) return v;
+    k = tok[ v ].next;
+  }
+  return FD_RPC_JSON_IDX_NULL;
+}
+
+ulong
+fd_rpc_json_arr_get( fd_rpc_json_tok_t const * tok,
+                     ulong                     arr,
+                     ulong                     i ) {
+  if( FD_UNLIKELY( tok[ arr ].type!=FD_RPC_JSON_TYPE_ARRAY ) ) return FD_RPC_JSON_IDX_NULL;
+  if( FD_UNLIKELY( i>=tok[ arr ].cnt                       ) ) return FD_RPC_JSON_IDX_NULL;
+
+  ulong e = arr+1UL;
+  for( ulong j=0UL; j<i; j++ ) e = tok[ e ].next;
+  return e;
+}
+
+int
+fd_rpc_json_ulong( fd_rpc_json_tok_t const * tok,
+                   char const *              buf,
+                   ulong                     idx,
+                   ulong *                   out ) {
+  fd_rpc_json_tok_t const * t = tok+idx;
+  if( FD_UNLIKELY( t->type!=FD_RPC_JSON_TYPE_NUMBER ) ) return 0;
+
+  char const * s   = buf+t->off;
+  ulong        len = t->len;
+  ulong        val = 0UL;
+  for( ulong i=0UL; i<len; i++ ) {
+    ulong d = (ulong)(s[ i ]-'0');
+    if( FD_UNLIKELY( d>9UL ) ) return 0; /* sign, fraction or exponent */
+    if( FD_UNLIKELY( val>(ULONG_MAX-d)/10UL ) ) return 0;
+    val = val*10UL + d;
+  }
+  *out = val;
+  return 1;
+}
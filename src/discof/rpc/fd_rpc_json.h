@@ -0,0 +1,135 @@
+#ifndef HEADER_fd_src_discof_rpc_fd_rpc_json_h
+#define HEADER_fd_src_discof_rpc_fd_rpc_json_h
+
+/* fd_rpc_json is a single pass, allocation free JSON tokenizer for
+   JSON-RPC request bodies.  It is in the spirit of jsmn: the input is
+   never copied or modified, and instead a flat array of tokens is
+   produced in document order, each referencing a byte range of the
+   input.  Container tokens record the index one past the end of their
+   subtree, so skipping over a value of any size is O(1), and looking up
+   a key in an object is a linear scan over just that object's direct
+   members.
+
+   The tokenizer fully validates the input against the JSON grammar
+   (RFC 8259), except that it does not validate UTF-8 inside strings,
+   and it rejects documents nested deeper than FD_RPC_JSON_DEPTH_MAX.
+   Strings are not unescaped, the token refers to the raw bytes between
+   the quotes and FD_RPC_JSON_FLAG_ESCAPED is set if there was a
+   backslash in there somewhere.  Every JSON-RPC key and enumeration
+   value the RPC server understands is plain ASCII, so callers simply
+   treat escaped strings as not matching anything.
+
+   A document of sz bytes never produces more than sz/2+1 tokens, so a
+   caller that bounds the request size can size the token array such
+   that parsing never fails with FD_RPC_JSON_ERR_FULL. */
+
+#include "../../util/bits/fd_bits.h"
+
+#define FD_RPC_JSON_TYPE_OBJECT (1)
+#define FD_RPC_JSON_TYPE_ARRAY  (2)
+#define FD_RPC_JSON_TYPE_STRING (3)
+#define FD_RPC_JSON_TYPE_NUMBER (4)
+#define FD_RPC_JSON_TYPE_TRUE   (5)
+#define FD_RPC_JSON_TYPE_FALSE  (6)
+#define FD_RPC_JSON_TYPE_NULL   (7)
+
+#define FD_RPC_JSON_FLAG_ESCAPED (1)
+
+#define FD_RPC_JSON_ERR_INVAL (-1) /* input is not a valid JSON document */
+#define FD_RPC_JSON_ERR_FULL  (-2) /* token array too small for the input */
+
+#define FD_RPC_JSON_DEPTH_MAX (32UL)
+
+#define FD_RPC_JSON_IDX_NULL (ULONG_MAX)
+
+/* fd_rpc_json_tok_t is a single token.  off and len give the byte range
+   in the input.  For strings this excludes the quotes.  For containers
+   it covers the opening through the closing bracket.  next is the index
+   of the first token after this token's subtree (idx+1 for scalars).
+   cnt is the number of elements of an array or the number of key-value
+   pairs of an object, and zero otherwise.  In an object, each member is
+   a STRING key token immediately followed by its value subtree. */
+
+struct fd_rpc_json_tok {
+  uchar type;
+  uchar flags;
+  uint  off;
+  uint  len;
+  uint  next;
+  uint  cnt;
+};
+
+typedef struct fd_rpc_json_tok fd_rpc_json_tok_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_rpc_json_tok_max returns the number of tokens needed to tokenize
+   any document of up to sz bytes. */
+
+FD_FN_CONST static inline ulong
+fd_rpc_json_tok_max( ulong sz ) {
+  return sz/2UL + 1UL;
+}
+
+/* fd_rpc_json_parse tokenizes the sz byte JSON document at buf into the
+   tok_max entry array tok.  Leading and trailing whitespace is allowed,
+   anything else after the top-level value is an error.  On success
+   returns the number of tokens written (positive) and tok[0] is the
+   top-level value.  On failure, returns one of FD_RPC_JSON_ERR_* and
+   the contents of tok are unspecified.  sz must be less than 2^32. */
+
+long
+fd_rpc_json_parse( fd_rpc_json_tok_t * tok,
+                   ulong               tok_max,
+                   char const *        buf,
+                   ulong               sz );
+
+/* fd_rpc_json_obj_get returns the index of the value for key in the
+   object at tok[ obj ], or FD_RPC_JSON_IDX_NULL if obj is not an object
+   or has no such key.  If the key appears more than once, the first
+   occurrence wins, matching cJSON.  Keys in the document containing
+   escapes never match. */
+
+ulong
+fd_rpc_json_obj_get( fd_rpc_json_tok_t const * tok,
+                     char const *              buf,
+                     ulong                     obj,
+                     char const *              key,
+                     ulong                     key_len );
+
+/* fd_rpc_json_arr_get returns the index of element i of the array at
+   tok[ arr ], or FD_RPC_JSON_IDX_NULL if arr is not an array or i is
+   out of bounds. */
+
+ulong
+fd_rpc_json_arr_get( fd_rpc_json_tok_t const * tok,
+                     ulong                     arr,
+                     ulong                     i );
+
+/* fd_rpc_json_str_eq returns 1 if tok[ idx ] is an unescaped string
+   equal to the s_len bytes at s, and 0 otherwise. */
+
+static inline int
+fd_rpc_json_str_eq( fd_rpc_json_tok_t const * tok,
+                    char const *              buf,
+                    ulong                     idx,
+                    char const *              s,
+                    ulong                     s_len ) {
+  fd_rpc_json_tok_t const * t = tok+idx;
+  return (t->type==FD_RPC_JSON_TYPE_STRING) & (!t->flags) & (t->len==s_len) && !memcmp( buf+t->off, s, s_len );
+}
+
+/* fd_rpc_json_ulong parses the number at tok[ idx ] as an unsigned
+   64-bit integer and stores it in *out.  Returns 1 on success, or 0 if
+   the token is not a number, is negative, has a fraction or exponent,
+   or does not fit. */
+
+int
+fd_rpc_json_ulong( fd_rpc_json_tok_t const * tok,
+                   char const *              buf,
+                   ulong                     idx,
+                   ulong *                   out );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_discof_rpc_fd_rpc_json_h */
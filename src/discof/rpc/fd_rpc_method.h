@@ -0,0 +1,167 @@
+#ifndef HEADER_fd_src_discof_rpc_fd_rpc_method_h
+#define HEADER_fd_src_discof_rpc_fd_rpc_method_h
+
+/* fd_rpc_method maps JSON-RPC method names to method ids with a compile
+   time perfect hash table, so dispatching a request costs one hash and
+   a single memcmp rather than a chain of strcmp. */
+
+#include "../../util/bits/fd_bits.h"
+
+#define FD_RPC_METHOD_GET_ACCOUNT_INFO                       ( 0)
+#define FD_RPC_METHOD_GET_BALANCE                            ( 1)
+#define FD_RPC_METHOD_GET_BLOCK                              ( 2)
+#define FD_RPC_METHOD_GET_BLOCK_COMMITMENT                   ( 3)
+#define FD_RPC_METHOD_GET_BLOCK_HEIGHT                       ( 4)
+#define FD_RPC_METHOD_GET_BLOCK_PRODUCTION                   ( 5)
+#define FD_RPC_METHOD_GET_BLOCKS                             ( 6)
+#define FD_RPC_METHOD_GET_BLOCKS_WITH_LIMIT                  ( 7)
+#define FD_RPC_METHOD_GET_BLOCK_TIME                         ( 8)
+#define FD_RPC_METHOD_GET_CLUSTER_NODES                      ( 9)
+#define FD_RPC_METHOD_GET_EPOCH_INFO                         (10)
+#define FD_RPC_METHOD_GET_EPOCH_SCHEDULE                     (11)
+#define FD_RPC_METHOD_GET_FEE_FOR_MESSAGE                    (12)
+#define FD_RPC_METHOD_GET_FIRST_AVAILABLE_BLOCK              (13)
+#define FD_RPC_METHOD_GET_GENESIS_HASH                       (14)
+#define FD_RPC_METHOD_GET_HEALTH                             (15)
+#define FD_RPC_METHOD_GET_HIGHEST_SNAPSHOT_SLOT              (16)
+#define FD_RPC_METHOD_GET_IDENTITY                           (17)
+#define FD_RPC_METHOD_GET_INFLATION_GOVERNOR                 (18)
+#define FD_RPC_METHOD_GET_INFLATION_RATE                     (19)
+#define FD_RPC_METHOD_GET_INFLATION_REWARD                   (20)
+#define FD_RPC_METHOD_GET_LARGEST_ACCOUNTS                   (21)
+#define FD_RPC_METHOD_GET_LATEST_BLOCKHASH                   (22)
+#define FD_RPC_METHOD_GET_LEADER_SCHEDULE                    (23)
+#define FD_RPC_METHOD_GET_MAX_RETRANSMIT_SLOT                (24)
+#define FD_RPC_METHOD_GET_MAX_SHRED_INSERT_SLOT              (25)
+#define FD_RPC_METHOD_GET_MINIMUM_BALANCE_FOR_RENT_EXEMPTION (26)
+#define FD_RPC_METHOD_GET_MULTIPLE_ACCOUNTS                  (27)
+#define FD_RPC_METHOD_GET_PROGRAM_ACCOUNTS                   (28)
+#define FD_RPC_METHOD_GET_RECENT_PERFORMANCE_SAMPLES         (29)
+#define FD_RPC_METHOD_GET_RECENT_PRIORITIZATION_FEES         (30)
+#define FD_RPC_METHOD_GET_SIGNATURES_FOR_ADDRESS             (31)
+#define FD_RPC_METHOD_GET_SIGNATURE_STATUSES                 (32)
+#define FD_RPC_METHOD_GET_SLOT                               (33)
+#define FD_RPC_METHOD_GET_SLOT_LEADER                        (34)
+#define FD_RPC_METHOD_GET_SLOT_LEADERS                       (35)
+#define FD_RPC_METHOD_GET_STAKE_MINIMUM_DELEGATION           (36)
+#define FD_RPC_METHOD_GET_SUPPLY                             (37)
+#define FD_RPC_METHOD_GET_TOKEN_ACCOUNT_BALANCE              (38)
+#define FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_DELEGATE         (39)
+#define FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_OWNER            (40)
+#define FD_RPC_METHOD_GET_TOKEN_LARGEST_ACCOUNTS             (41)
+#define FD_RPC_METHOD_GET_TOKEN_SUPPLY                       (42)
+#define FD_RPC_METHOD_GET_TRANSACTION                        (43)
+#define FD_RPC_METHOD_GET_TRANSACTION_COUNT                  (44)
+#define FD_RPC_METHOD_GET_VERSION                            (45)
+#define FD_RPC_METHOD_GET_VOTE_ACCOUNTS                      (46)
+#define FD_RPC_METHOD_IS_BLOCKHASH_VALID                     (47)
+#define FD_RPC_METHOD_MINIMUM_LEDGER_SLOT                    (48)
+#define FD_RPC_METHOD_REQUEST_AIRDROP                        (49)
+#define FD_RPC_METHOD_SEND_TRANSACTION                       (50)
+#define FD_RPC_METHOD_SIMULATE_TRANSACTION                   (51)
+
+#define FD_RPC_METHOD_CNT                                    (52)
+
+struct fd_rpc_method {
+  uchar        sig[ 3 ];
+  int          id;
+  char const * name;
+};
+
+typedef struct fd_rpc_method fd_rpc_method_t;
+
+/* The hash key is the name length together with its middle and last
+   characters, which happen to be distinct across all the methods.  The
+   full name is then compared, as arbitrary user supplied strings can
+   share a signature with a real method. */
+
+#define MAP_PERFECT_NAME        fd_rpc_method_tbl
+#define MAP_PERFECT_LG_TBL_SZ   7
+#define MAP_PERFECT_T           fd_rpc_method_t
+#define MAP_PERFECT_HASH_C      2762488034U
+#define MAP_PERFECT_KEY         sig
+#define MAP_PERFECT_KEY_T       uchar const *
+#define MAP_PERFECT_ZERO_KEY    (0,0,0)
+#define MAP_PERFECT_COMPLEX_KEY 1
+#define MAP_PERFECT_KEYS_EQUAL(k1,k2) (!memcmp( (k1), (k2), 3UL ))
+
+#define PERFECT_HASH( u ) (((MAP_PERFECT_HASH_C*(u))>>25)&0x7FU)
+
+#define MAP_PERFECT_HASH_PP( a0,a1,a2 ) PERFECT_HASH( ((a0) | ((a1)<<8) | ((a2)<<16)) )
+#define MAP_PERFECT_HASH_R( ptr ) PERFECT_HASH( ((uint)(ptr)[0] | ((uint)(ptr)[1]<<8) | ((uint)(ptr)[2]<<16)) )
+
+#define MAP_PERFECT_0  ( 14, 'u', 'o' ), .name = "getAccountInfo",                    .id = FD_RPC_METHOD_GET_ACCOUNT_INFO
+#define MAP_PERFECT_1  ( 10, 'l', 'e' ), .name = "getBalance",                        .id = FD_RPC_METHOD_GET_BALANCE
+#define MAP_PERFECT_2  (  8, 'l', 'k' ), .name = "getBlock",                          .id = FD_RPC_METHOD_GET_BLOCK
+#define MAP_PERFECT_3  ( 18, 'o', 't' ), .name = "getBlockCommitment",                .id = FD_RPC_METHOD_GET_BLOCK_COMMITMENT
+#define MAP_PERFECT_4  ( 14, 'k', 't' ), .name = "getBlockHeight",                    .id = FD_RPC_METHOD_GET_BLOCK_HEIGHT
+#define MAP_PERFECT_5  ( 18, 'r', 'n' ), .name = "getBlockProduction",                .id = FD_RPC_METHOD_GET_BLOCK_PRODUCTION
+#define MAP_PERFECT_6  (  9, 'l', 's' ), .name = "getBlocks",                         .id = FD_RPC_METHOD_GET_BLOCKS
+#define MAP_PERFECT_7  ( 18, 'W', 't' ), .name = "getBlocksWithLimit",                .id = FD_RPC_METHOD_GET_BLOCKS_WITH_LIMIT
+#define MAP_PERFECT_8  ( 12, 'c', 'e' ), .name = "getBlockTime",                      .id = FD_RPC_METHOD_GET_BLOCK_TIME
+#define MAP_PERFECT_9  ( 15, 't', 's' ), .name = "getClusterNodes",                   .id = FD_RPC_METHOD_GET_CLUSTER_NODES
+#define MAP_PERFECT_10 ( 12, 'c', 'o' ), .name = "getEpochInfo",                      .id = FD_RPC_METHOD_GET_EPOCH_INFO
+#define MAP_PERFECT_11 ( 16, 'S', 'e' ), .name = "getEpochSchedule",                  .id = FD_RPC_METHOD_GET_EPOCH_SCHEDULE
+#define MAP_PERFECT_12 ( 16, 'r', 'e' ), .name = "getFeeForMessage",                  .id = FD_RPC_METHOD_GET_FEE_FOR_MESSAGE
+#define MAP_PERFECT_13 ( 22, 'i', 'k' ), .name = "getFirstAvailableBlock",            .id = FD_RPC_METHOD_GET_FIRST_AVAILABLE_BLOCK
+#define MAP_PERFECT_14 ( 14, 's', 'h' ), .name = "getGenesisHash",                    .id = FD_RPC_METHOD_GET_GENESIS_HASH
+#define MAP_PERFECT_15 (  9, 'e', 'h' ), .name = "getHealth",                         .id = FD_RPC_METHOD_GET_HEALTH
+#define MAP_PERFECT_16 ( 22, 'n', 't' ), .name = "getHighestSnapshotSlot",            .id = FD_RPC_METHOD_GET_HIGHEST_SNAPSHOT_SLOT
+#define MAP_PERFECT_17 ( 11, 'e', 'y' ), .name = "getIdentity",                       .id = FD_RPC_METHOD_GET_IDENTITY
+#define MAP_PERFECT_18 ( 20, 'o', 'r' ), .name = "getInflationGovernor",              .id = FD_RPC_METHOD_GET_INFLATION_GOVERNOR
+#define MAP_PERFECT_19 ( 16, 't', 'e' ), .name = "getInflationRate",                  .id = FD_RPC_METHOD_GET_INFLATION_RATE
+#define MAP_PERFECT_20 ( 18, 'i', 'd' ), .name = "getInflationReward",                .id = FD_RPC_METHOD_GET_INFLATION_REWARD
+#define MAP_PERFECT_21 ( 18, 't', 's' ), .name = "getLargestAccounts",                .id = FD_RPC_METHOD_GET_LARGEST_ACCOUNTS
+#define MAP_PERFECT_22 ( 18, 'B', 'h' ), .name = "getLatestBlockhash",                .id = FD_RPC_METHOD_GET_LATEST_BLOCKHASH
+#define MAP_PERFECT_23 ( 17, 'r', 'e' ), .name = "getLeaderSchedule",                 .id = FD_RPC_METHOD_GET_LEADER_SCHEDULE
+#define MAP_PERFECT_24 ( 20, 'a', 't' ), .name = "getMaxRetransmitSlot",              .id = FD_RPC_METHOD_GET_MAX_RETRANSMIT_SLOT
+#define MAP_PERFECT_25 ( 21, 'd', 't' ), .name = "getMaxShredInsertSlot",             .id = FD_RPC_METHOD_GET_MAX_SHRED_INSERT_SLOT
+#define MAP_PERFECT_26 ( 33, 'e', 'n' ), .name = "getMinimumBalanceForRentExemption", .id = FD_RPC_METHOD_GET_MINIMUM_BALANCE_FOR_RENT_EXEMPTION
+#define MAP_PERFECT_27 ( 19, 'l', 's' ), .name = "getMultipleAccounts",               .id = FD_RPC_METHOD_GET_MULTIPLE_ACCOUNTS
+#define MAP_PERFECT_28 ( 18, 'm', 's' ), .name = "getProgramAccounts",                .id = FD_RPC_METHOD_GET_PROGRAM_ACCOUNTS
+#define MAP_PERFECT_29 ( 27, 'o', 's' ), .name = "getRecentPerformanceSamples",       .id = FD_RPC_METHOD_GET_RECENT_PERFORMANCE_SAMPLES
+#define MAP_PERFECT_30 ( 27, 'r', 's' ), .name = "getRecentPrioritizationFees",       .id = FD_RPC_METHOD_GET_RECENT_PRIORITIZATION_FEES
+#define MAP_PERFECT_31 ( 23, 'e', 's' ), .name = "getSignaturesForAddress",           .id = FD_RPC_METHOD_GET_SIGNATURES_FOR_ADDRESS
+#define MAP_PERFECT_32 ( 20, 'r', 's' ), .name = "getSignatureStatuses",              .id = FD_RPC_METHOD_GET_SIGNATURE_STATUSES
+#define MAP_PERFECT_33 (  7, 'S', 't' ), .name = "getSlot",                           .id = FD_RPC_METHOD_GET_SLOT
+#define MAP_PERFECT_34 ( 13, 't', 'r' ), .name = "getSlotLeader",                     .id = FD_RPC_METHOD_GET_SLOT_LEADER
+#define MAP_PERFECT_35 ( 14, 'L', 's' ), .name = "getSlotLeaders",                    .id = FD_RPC_METHOD_GET_SLOT_LEADERS
+#define MAP_PERFECT_36 ( 25, 'm', 'n' ), .name = "getStakeMinimumDelegation",         .id = FD_RPC_METHOD_GET_STAKE_MINIMUM_DELEGATION
+#define MAP_PERFECT_37 (  9, 'u', 'y' ), .name = "getSupply",                         .id = FD_RPC_METHOD_GET_SUPPLY
+#define MAP_PERFECT_38 ( 22, 'o', 'e' ), .name = "getTokenAccountBalance",            .id = FD_RPC_METHOD_GET_TOKEN_ACCOUNT_BALANCE
+#define MAP_PERFECT_39 ( 26, 'n', 'e' ), .name = "getTokenAccountsByDelegate",        .id = FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_DELEGATE
+#define MAP_PERFECT_40 ( 23, 'o', 'r' ), .name = "getTokenAccountsByOwner",           .id = FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_OWNER
+#define MAP_PERFECT_41 ( 23, 'g', 's' ), .name = "getTokenLargestAccounts",           .id = FD_RPC_METHOD_GET_TOKEN_LARGEST_ACCOUNTS
+#define MAP_PERFECT_42 ( 14, 'n', 'y' ), .name = "getTokenSupply",                    .id = FD_RPC_METHOD_GET_TOKEN_SUPPLY
+#define MAP_PERFECT_43 ( 14, 's', 'n' ), .name = "getTransaction",                    .id = FD_RPC_METHOD_GET_TRANSACTION
+#define MAP_PERFECT_44 ( 19, 'c', 't' ), .name = "getTransactionCount",               .id = FD_RPC_METHOD_GET_TRANSACTION_COUNT
+#define MAP_PERFECT_45 ( 10, 'r', 'n' ), .name = "getVersion",                        .id = FD_RPC_METHOD_GET_VERSION
+#define MAP_PERFECT_46 ( 15, 'A', 's' ), .name = "getVoteAccounts",                   .id = FD_RPC_METHOD_GET_VOTE_ACCOUNTS
+#define MAP_PERFECT_47 ( 16, 'a', 'd' ), .name = "isBlockhashValid",                  .id = FD_RPC_METHOD_IS_BLOCKHASH_VALID
+#define MAP_PERFECT_48 ( 17, 'e', 't' ), .name = "minimumLedgerSlot",                 .id = FD_RPC_METHOD_MINIMUM_LEDGER_SLOT
+#define MAP_PERFECT_49 ( 14, 'A', 'p' ), .name = "requestAirdrop",                    .id = FD_RPC_METHOD_REQUEST_AIRDROP
+#define MAP_PERFECT_50 ( 15, 'n', 'n' ), .name = "sendTransaction",                   .id = FD_RPC_METHOD_SEND_TRANSACTION
+#define MAP_PERFECT_51 ( 19, 'r', 'n' ), .name = "simulateTransaction",               .id = FD_RPC_METHOD_SIMULATE_TRANSACTION
+
+#include "../../util/tmpl/fd_map_perfect.c"
+#undef PERFECT_HASH
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_rpc_method_query returns the FD_RPC_METHOD_* id of the method
+   named by the name_len bytes at name (not necessarily NUL terminated),
+   or -1 if there is no such method. */
+
+static inline int
+fd_rpc_method_query( char const * name,
+                     ulong        name_len ) {
+  if( FD_UNLIKELY( (!name_len) | (name_len>UCHAR_MAX) ) ) return -1;
+  uchar sig[ 3 ] = { (uchar)name_len, (uchar)name[ name_len/2UL ], (uchar)name[ name_len-1UL ] };
+  fd_rpc_method_t const * method = fd_rpc_method_tbl_query( sig, NULL );
+  if( FD_UNLIKELY( !method || memcmp( method->name, name, name_len ) ) ) return -1;
+  return method->id;
+}
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_discof_rpc_fd_rpc_method_h */
@@ -0,0 +1,758 @@
+#include "fd_rpc_pubsub.h"
+#include "../../ballet/base58/fd_base58.h"
+#include "../../ballet/base64/fd_base64.h"
+
+#define FD_RPC_PUBSUB_MAGIC (0xf17eda2ce5b5b500UL) /* firedancer rpc pubsub v0 */
+
+/* A subscription.  Lives on two lists at once: the subscribers of its
+   key (or the slot subscribers), and the subscriptions of its
+   connection. */
+
+struct fd_rpc_pubsub_sub {
+  ulong id;         /* ULONG_MAX if free */
+  ulong conn;
+  ulong key;        /* key index, ULONG_MAX for slot subscriptions */
+  int   kind;
+  int   commitment; /* signature subscriptions only */
+  int   dirty;      /* owes the subscriber a conflated notification */
+  int   dead;       /* removed during the current pass */
+
+  ulong pool_next;
+  ulong prev;
+  ulong next;
+  ulong cprev;
+  ulong cnext;
+  ulong reap_next;
+};
+
+typedef struct fd_rpc_pubsub_sub fd_rpc_pubsub_sub_t;
+
+#define POOL_NAME sub_pool
+#define POOL_T    fd_rpc_pubsub_sub_t
+#define POOL_NEXT pool_next
+#include "../../util/tmpl/fd_pool.c"
+
+#define DLIST_NAME  sub_dlist
+#define DLIST_ELE_T fd_rpc_pubsub_sub_t
+#define DLIST_PREV  prev
+#define DLIST_NEXT  next
+#include "../../util/tmpl/fd_dlist.c"
+
+#define DLIST_NAME  conn_dlist
+#define DLIST_ELE_T fd_rpc_pubsub_sub_t
+#define DLIST_PREV  cprev
+#define DLIST_NEXT  cnext
+#include "../../util/tmpl/fd_dlist.c"
+
+/* A subscribed account or signature, shared by all of its
+   subscriptions. */
+
+struct fd_rpc_pubsub_key {
+  union {
+    fd_pubkey_t    pubkey;
+    fd_signature_t sig;
+  } id;
+
+  ulong pool_next;
+  ulong map_next;
+  ulong prev;
+  ulong next;
+
+  sub_dlist_t subs[1];
+  ulong       dirty_cnt;
+  ulong       mod_slot;  /* accounts only, state of the last publish */
+};
+
+typedef struct fd_rpc_pubsub_key fd_rpc_pubsub_key_t;
+
+#define POOL_NAME key_pool
+#define POOL_T    fd_rpc_pubsub_key_t
+#define POOL_NEXT pool_next
+#include "../../util/tmpl/fd_pool.c"
+
+#define DLIST_NAME  key_dlist
+#define DLIST_ELE_T fd_rpc_pubsub_key_t
+#define DLIST_PREV  prev
+#define DLIST_NEXT  next
+#include "../../util/tmpl/fd_dlist.c"
+
+#define MAP_NAME               acct_map
+#define MAP_ELE_T              fd_rpc_pubsub_key_t
+#define MAP_KEY_T              fd_pubkey_t
+#define MAP_KEY                id.pubkey
+#define MAP_NEXT               map_next
+#define MAP_KEY_EQ(k0,k1)      fd_pubkey_eq( k0, k1 )
+#define MAP_KEY_HASH(key,seed) fd_hash( (seed), (key)->uc, sizeof(fd_pubkey_t) )
+#include "../../util/tmpl/fd_map_chain.c"
+
+#define MAP_NAME               sig_map
+#define MAP_ELE_T              fd_rpc_pubsub_key_t
+#define MAP_KEY_T              fd_signature_t
+#define MAP_KEY                id.sig
+#define MAP_NEXT               map_next
+#define MAP_KEY_EQ(k0,k1)      fd_signature_eq( k0, k1 )
+#define MAP_KEY_HASH(key,seed) fd_hash( (seed), (key)->uc, sizeof(fd_signature_t) )
+#include "../../util/tmpl/fd_map_chain.c"
+
+struct fd_rpc_pubsub_conn {
+  conn_dlist_t subs[1];
+  ulong        sub_cnt;
+  ulong        stall_cnt;  /* consecutive passes where nothing could be sent */
+
+  int          closing;    /* closed during the current pass */
+  int          blocked;    /* a notification was skipped in the current pass */
+  int          sent;       /* a notification was sent in the current pass */
+  int          touched;    /* on the touched list */
+  ulong        reap_next;
+  ulong        touch_next;
+};
+
+typedef struct fd_rpc_pubsub_conn fd_rpc_pubsub_conn_t;
+
+struct __attribute__((aligned(FD_RPC_PUBSUB_ALIGN))) fd_rpc_pubsub_private {
+  ulong magic;
+  ulong sub_max;
+  ulong conn_max;
+  ulong body_max;
+  ulong seed;
+  ulong seq;
+  ulong seq_max;
+
+  fd_rpc_pubsub_sink_t sink;
+  void *               sink_ctx;
+
+  /* Local joins, set up in join */
+
+  fd_rpc_pubsub_sub_t *  subs;
+  fd_rpc_pubsub_key_t *  keys;
+  acct_map_t *           acct_map;
+  sig_map_t *            sig_map;
+  fd_rpc_pubsub_conn_t * conns;
+  char *                 body;
+
+  sub_dlist_t slot_subs[1];
+  key_dlist_t acct_keys[1];
+  key_dlist_t sig_keys[1];
+
+  int   in_pass;
+  ulong body_sz;     /* size of the staged account body, ULONG_MAX if none */
+  ulong reap_sub;    /* subscriptions to free at the end of the pass */
+  ulong reap_conn;   /* connections to close at the end of the pass */
+  ulong touch_conn;  /* connections notified (or not) in the pass */
+
+  fd_rpc_pubsub_metrics_t metrics;
+
+  /* sub pool, key pool, account map, signature map, conn_max
+     fd_rpc_pubsub_conn_t and body_max bytes follow */
+};
+
+static char const head_account  [] = "{\"jsonrpc\":\"2.0\",\"method\":\"accountNotification\",\"params\":{\"result\":";
+static char const head_slot     [] = "{\"jsonrpc\":\"2.0\",\"method\":\"slotNotification\",\"params\":{\"result\":";
+static char const head_signature[] = "{\"jsonrpc\":\"2.0\",\"method\":\"signatureNotification\",\"params\":{\"result\":";
+
+FD_FN_CONST ulong
+fd_rpc_pubsub_align( void ) {
+  return FD_RPC_PUBSUB_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_rpc_pubsub_footprint( ulong sub_max,
+                         ulong conn_max,
+                         ulong body_max ) {
+  if( FD_UNLIKELY( !sub_max  || sub_max>(1UL<<32)  ) ) return 0UL;
+  if( FD_UNLIKELY( !conn_max || conn_max>(1UL<<32) ) ) return 0UL;
+  if( FD_UNLIKELY( body_max<FD_RPC_PUBSUB_BODY_MIN || body_max>(1UL<<40) ) ) return 0UL;
+
+  ulong chain_cnt = acct_map_chain_cnt_est( sub_max );
+
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_RPC_PUBSUB_ALIGN,            sizeof(fd_rpc_pubsub_t)                 );
+  l = FD_LAYOUT_APPEND( l, sub_pool_align(),               sub_pool_footprint( sub_max )           );
+  l = FD_LAYOUT_APPEND( l, key_pool_align(),               key_pool_footprint( sub_max )           );
+  l = FD_LAYOUT_APPEND( l, acct_map_align(),               acct_map_footprint( chain_cnt )         );
+  l = FD_LAYOUT_APPEND( l, sig_map_align(),                sig_map_footprint( chain_cnt )          );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_rpc_pubsub_conn_t),  conn_max*sizeof(fd_rpc_pubsub_conn_t)   );
+  l = FD_LAYOUT_APPEND( l, 1UL,                            body_max                                );
+  return FD_LAYOUT_FINI( l, FD_RPC_PUBSUB_ALIGN );
+}
+
+void *
+fd_rpc_pubsub_new( void *                       shmem,
+                   ulong                        sub_max,
+                   ulong                        conn_max,
+                   ulong                        body_max,
+                   ulong                        seed,
+                   fd_rpc_pubsub_sink_t const * sink,
+                   void *                       ctx ) {
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_rpc_pubsub_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_rpc_pubsub_footprint( sub_max, conn_max, body_max ) ) ) {
+    FD_LOG_WARNING(( "bad sub_max (%lu), conn_max (%lu) or body_max (%lu)", sub_max, conn_max, body_max ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !sink || !sink->room || !sink->send || !sink->close ) ) {
+    FD_LOG_WARNING(( "bad sink" ));
+    return NULL;
+  }
+
+  ulong chain_cnt = acct_map_chain_cnt_est( sub_max );
+
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_rpc_pubsub_t *      pubsub = FD_SCRATCH_ALLOC_APPEND( l, FD_RPC_PUBSUB_ALIGN,           sizeof(fd_rpc_pubsub_t)               );
+  void *                 _subs  = FD_SCRATCH_ALLOC_APPEND( l, sub_pool_align(),              sub_pool_footprint( sub_max )         );
+  void *                 _keys  = FD_SCRATCH_ALLOC_APPEND( l, key_pool_align(),              key_pool_footprint( sub_max )         );
+  void *                 _acct  = FD_SCRATCH_ALLOC_APPEND( l, acct_map_align(),              acct_map_footprint( chain_cnt )       );
+  void *                 _sig   = FD_SCRATCH_ALLOC_APPEND( l, sig_map_align(),               sig_map_footprint( chain_cnt )        );
+  fd_rpc_pubsub_conn_t * conns  = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_rpc_pubsub_conn_t), conn_max*sizeof(fd_rpc_pubsub_conn_t) );
+
+  memset( pubsub, 0, sizeof(fd_rpc_pubsub_t) );
+  pubsub->sub_max  = sub_max;
+  pubsub->conn_max = conn_max;
+  pubsub->body_max = body_max;
+  pubsub->seed     = seed;
+  pubsub->seq_max  = (1UL<<53)/sub_max;
+  pubsub->sink     = *sink;
+  pubsub->sink_ctx = ctx;
+
+  fd_rpc_pubsub_sub_t * subs = sub_pool_join( sub_pool_new( _subs, sub_max ) );
+  for( ulong i=0UL; i<sub_max; i++ ) subs[ i ].id = ULONG_MAX;
+  sub_pool_leave( subs );
+  key_pool_new( _keys, sub_max );
+  acct_map_new( _acct, chain_cnt, seed );
+  sig_map_new ( _sig,  chain_cnt, seed );
+
+  for( ulong i=0UL; i<conn_max; i++ ) {
+    memset( &conns[ i ], 0, sizeof(fd_rpc_pubsub_conn_t) );
+    conn_dlist_join( conn_dlist_new( conns[ i ].subs ) );
+  }
+
+  sub_dlist_join( sub_dlist_new( pubsub->slot_subs ) );
+  key_dlist_join( key_dlist_new( pubsub->acct_keys ) );
+  key_dlist_join( key_dlist_new( pubsub->sig_keys  ) );
+
+  pubsub->body_sz    = ULONG_MAX;
+  pubsub->reap_sub   = ULONG_MAX;
+  pubsub->reap_conn  = ULONG_MAX;
+  pubsub->touch_conn = ULONG_MAX;
+
+  FD_COMPILER_MFENCE();
+  pubsub->magic = FD_RPC_PUBSUB_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_rpc_pubsub_t *
+fd_rpc_pubsub_join( void * shpubsub ) {
+  if( FD_UNLIKELY( !shpubsub ) ) {
+    FD_LOG_WARNING(( "NULL shpubsub" ));
+    return NULL;
+  }
+
+  fd_rpc_pubsub_t * pubsub = (fd_rpc_pubsub_t *)shpubsub;
+  if( FD_UNLIKELY( pubsub->magic!=FD_RPC_PUBSUB_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  ulong chain_cnt = acct_map_chain_cnt_est( pubsub->sub_max );
+
+  FD_SCRATCH_ALLOC_INIT( l, shpubsub );
+                          FD_SCRATCH_ALLOC_APPEND( l, FD_RPC_PUBSUB_ALIGN,           sizeof(fd_rpc_pubsub_t)                       );
+  void * _subs          = FD_SCRATCH_ALLOC_APPEND( l, sub_pool_align(),              sub_pool_footprint( pubsub->sub_max )         );
+  void * _keys          = FD_SCRATCH_ALLOC_APPEND( l, key_pool_align(),              key_pool_footprint( pubsub->sub_max )         );
+  void * _acct          = FD_SCRATCH_ALLOC_APPEND( l, acct_map_align(),              acct_map_footprint( chain_cnt )               );
+  void * _sig           = FD_SCRATCH_ALLOC_APPEND( l, sig_map_align(),               sig_map_footprint( chain_cnt )                );
+  pubsub->conns         = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_rpc_pubsub_conn_t), pubsub->conn_max*sizeof(fd_rpc_pubsub_conn_t) );
+  pubsub->body          = FD_SCRATCH_ALLOC_APPEND( l, 1UL,                           pubsub->body_max                              );
+
+  pubsub->subs     = sub_pool_join( _subs );
+  pubsub->keys     = key_pool_join( _keys );
+  pubsub->acct_map = acct_map_join( _acct );
+  pubsub->sig_map  = sig_map_join ( _sig  );
+  FD_TEST( pubsub->subs && pubsub->keys && pubsub->acct_map && pubsub->sig_map );
+
+  return pubsub;
+}
+
+void *
+fd_rpc_pubsub_leave( fd_rpc_pubsub_t * pubsub ) {
+  return (void *)pubsub;
+}
+
+void *
+fd_rpc_pubsub_delete( void * shpubsub ) {
+  if( FD_UNLIKELY( !shpubsub ) ) {
+    FD_LOG_WARNING(( "NULL shpubsub" ));
+    return NULL;
+  }
+
+  fd_rpc_pubsub_t * pubsub = (fd_rpc_pubsub_t *)shpubsub;
+  if( FD_UNLIKELY( pubsub->magic!=FD_RPC_PUBSUB_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  pubsub->magic = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shpubsub;
+}
+
+/* Subscription bookkeeping *******************************************/
+
+static ulong
+sub_acquire( fd_rpc_pubsub_t * pubsub,
+             ulong             conn,
+             int               kind,
+             ulong             key ) {
+  fd_rpc_pubsub_sub_t * sub = pubsub->subs + sub_pool_idx_acquire( pubsub->subs );
+  ulong                 idx = (ulong)(sub - pubsub->subs);
+
+  sub->id         = pubsub->seq*pubsub->sub_max + idx;
+  sub->conn       = conn;
+  sub->key        = key;
+  sub->kind       = kind;
+  sub->commitment = 0;
+  sub->dirty      = 0;
+  sub->dead       = 0;
+  pubsub->seq     = (pubsub->seq+1UL)%pubsub->seq_max;
+
+  if( FD_LIKELY( key!=ULONG_MAX ) ) sub_dlist_idx_push_tail( pubsub->keys[ key ].subs, idx, pubsub->subs );
+  else                              sub_dlist_idx_push_tail( pubsub->slot_subs,        idx, pubsub->subs );
+
+  fd_rpc_pubsub_conn_t * c = &pubsub->conns[ conn ];
+  conn_dlist_idx_push_tail( c->subs, idx, pubsub->subs );
+  c->sub_cnt++;
+
+  pubsub->metrics.sub_cnt++;
+  return sub->id;
+}
+
+static void
+sub_release( fd_rpc_pubsub_t * pubsub,
+             ulong             idx ) {
+  fd_rpc_pubsub_sub_t *  sub = &pubsub->subs[ idx ];
+  fd_rpc_pubsub_conn_t * c   = &pubsub->conns[ sub->conn ];
+
+  conn_dlist_idx_remove( c->subs, idx, pubsub->subs );
+  c->sub_cnt--;
+
+  if( FD_LIKELY( sub->key!=ULONG_MAX ) ) {
+    fd_rpc_pubsub_key_t * key = &pubsub->keys[ sub->key ];
+    sub_dlist_idx_remove( key->subs, idx, pubsub->subs );
+    key->dirty_cnt -= (ulong)sub->dirty;
+
+    if( FD_UNLIKELY( sub_dlist_is_empty( key->subs, pubsub->subs ) ) ) {
+      if( sub->kind==FD_RPC_PUBSUB_KIND_ACCOUNT ) {
+        acct_map_idx_remove( pubsub->acct_map, &key->id.pubkey, ULONG_MAX, pubsub->keys );
+        key_dlist_idx_remove( pubsub->acct_keys, sub->key, pubsub->keys );
+      } else {
+        sig_map_idx_remove( pubsub->sig_map, &key->id.sig, ULONG_MAX, pubsub->keys );
+        key_dlist_idx_remove( pubsub->sig_keys, sub->key, pubsub->keys );
+      }
+      key_pool_idx_release( pubsub->keys, sub->key );
+    }
+  } else {
+    sub_dlist_idx_remove( pubsub->slot_subs, idx, pubsub->subs );
+  }
+
+  sub->id = ULONG_MAX;
+  sub_pool_idx_release( pubsub->subs, idx );
+  pubsub->metrics.sub_cnt--;
+}
+
+static ulong
+key_acquire( fd_rpc_pubsub_t *   pubsub,
+             key_dlist_t *       list,
+             fd_rpc_pubsub_key_t * key ) {
+  ulong idx = (ulong)(key - pubsub->keys);
+  sub_dlist_join( sub_dlist_new( key->subs ) );
+  key->dirty_cnt = 0UL;
+  key->mod_slot  = FD_RPC_PUBSUB_SLOT_UNKNOWN;
+  key_dlist_idx_push_tail( list, idx, pubsub->keys );
+  return idx;
+}
+
+static int
+sub_full( fd_rpc_pubsub_t * pubsub,
+          ulong             conn ) {
+  if( FD_UNLIKELY( conn>=pubsub->conn_max ) ) FD_LOG_ERR(( "conn %lu out of range", conn ));
+  if( FD_UNLIKELY( pubsub->in_pass ) ) FD_LOG_ERR(( "subscribe during a pass" ));
+  if( FD_UNLIKELY( !sub_pool_free( pubsub->subs ) ) ) {
+    pubsub->metrics.sub_fail_cnt++;
+    return 1;
+  }
+  return 0;
+}
+
+ulong
+fd_rpc_pubsub_account_subscribe( fd_rpc_pubsub_t *   pubsub,
+                                 ulong               conn,
+                                 fd_pubkey_t const * pubkey,
+                                 ulong               mod_slot ) {
+  if( FD_UNLIKELY( sub_full( pubsub, conn ) ) ) return ULONG_MAX;
+
+  /* There are as many keys as subscriptions, so this cannot fail */
+  ulong key = acct_map_idx_query( pubsub->acct_map, pubkey, ULONG_MAX, pubsub->keys );
+  if( FD_LIKELY( key==ULONG_MAX ) ) {
+    fd_rpc_pubsub_key_t * ele = key_pool_ele_acquire( pubsub->keys );
+    ele->id.pubkey = *pubkey;
+    key = key_acquire( pubsub, pubsub->acct_keys, ele );
+    ele->mod_slot = mod_slot;
+    acct_map_idx_insert( pubsub->acct_map, key, pubsub->keys );
+  }
+
+  return sub_acquire( pubsub, conn, FD_RPC_PUBSUB_KIND_ACCOUNT, key );
+}
+
+ulong
+fd_rpc_pubsub_slot_subscribe( fd_rpc_pubsub_t * pubsub,
+                              ulong             conn ) {
+  if( FD_UNLIKELY( sub_full( pubsub, conn ) ) ) return ULONG_MAX;
+  return sub_acquire( pubsub, conn, FD_RPC_PUBSUB_KIND_SLOT, ULONG_MAX );
+}
+
+ulong
+fd_rpc_pubsub_signature_subscribe( fd_rpc_pubsub_t *      pubsub,
+                                   ulong                  conn,
+                                   fd_signature_t const * sig,
+                                   int                    commitment ) {
+  if( FD_UNLIKELY( commitment!=FD_RPC_PUBSUB_COMMITMENT_PROCESSED &&
+                   commitment!=FD_RPC_PUBSUB_COMMITMENT_FINALIZED ) ) FD_LOG_ERR(( "bad commitment %d", commitment ));
+  if( FD_UNLIKELY( sub_full( pubsub, conn ) ) ) return ULONG_MAX;
+
+  ulong key = sig_map_idx_query( pubsub->sig_map, sig, ULONG_MAX, pubsub->keys );
+  if( FD_LIKELY( key==ULONG_MAX ) ) {
+    fd_rpc_pubsub_key_t * ele = key_pool_ele_acquire( pubsub->keys );
+    ele->id.sig = *sig;
+    key = key_acquire( pubsub, pubsub->sig_keys, ele );
+    sig_map_idx_insert( pubsub->sig_map, key, pubsub->keys );
+  }
+
+  ulong sub_id = sub_acquire( pubsub, conn, FD_RPC_PUBSUB_KIND_SIGNATURE, key );
+  pubsub->subs[ sub_id%pubsub->sub_max ].commitment = commitment;
+  return sub_id;
+}
+
+int
+fd_rpc_pubsub_unsubscribe( fd_rpc_pubsub_t * pubsub,
+                           ulong             conn,
+                           int               kind,
+                           ulong             sub_id ) {
+  if( FD_UNLIKELY( pubsub->in_pass ) ) FD_LOG_ERR(( "unsubscribe during a pass" ));
+
+  ulong                       idx = sub_id%pubsub->sub_max;
+  fd_rpc_pubsub_sub_t const * sub = &pubsub->subs[ idx ];
+  if( FD_UNLIKELY( sub_id==ULONG_MAX || sub->id!=sub_id || sub->conn!=conn || sub->kind!=kind ) ) return 0;
+
+  sub_release( pubsub, idx );
+  return 1;
+}
+
+void
+fd_rpc_pubsub_conn_close( fd_rpc_pubsub_t * pubsub,
+                          ulong             conn ) {
+  if( FD_UNLIKELY( conn>=pubsub->conn_max ) ) FD_LOG_ERR(( "conn %lu out of range", conn ));
+  fd_rpc_pubsub_conn_t * c = &pubsub->conns[ conn ];
+
+  if( FD_UNLIKELY( pubsub->in_pass ) ) {
+    if( FD_LIKELY( !c->closing ) ) {
+      c->closing   = 1;
+      c->reap_next = pubsub->reap_conn;
+      pubsub->reap_conn = conn;
+    }
+    return;
+  }
+
+  while( !conn_dlist_is_empty( c->subs, pubsub->subs ) ) sub_release( pubsub, conn_dlist_idx_peek_head( c->subs, pubsub->subs ) );
+  c->stall_cnt = 0UL;
+}
+
+/* Notification passes ************************************************/
+
+void
+fd_rpc_pubsub_publish_begin( fd_rpc_pubsub_t * pubsub ) {
+  if( FD_UNLIKELY( pubsub->in_pass ) ) FD_LOG_ERR(( "nested pass" ));
+  pubsub->in_pass = 1;
+  pubsub->body_sz = ULONG_MAX;
+}
+
+void
+fd_rpc_pubsub_publish_end( fd_rpc_pubsub_t * pubsub ) {
+  if( FD_UNLIKELY( !pubsub->in_pass ) ) FD_LOG_ERR(( "not in a pass" ));
+  pubsub->in_pass = 0;
+
+  /* Subscriptions that fired go first, as they might belong to a
+     connection that was also closed. */
+
+  while( pubsub->reap_sub!=ULONG_MAX ) {
+    ulong idx = pubsub->reap_sub;
+    pubsub->reap_sub = pubsub->subs[ idx ].reap_next;
+    sub_release( pubsub, idx );
+  }
+
+  while( pubsub->reap_conn!=ULONG_MAX ) {
+    ulong conn = pubsub->reap_conn;
+    pubsub->reap_conn = pubsub->conns[ conn ].reap_next;
+    pubsub->conns[ conn ].closing = 0;
+    fd_rpc_pubsub_conn_close( pubsub, conn );
+  }
+
+  /* A connection stalls if it was due notifications but could not
+     take any of them. */
+
+  while( pubsub->touch_conn!=ULONG_MAX ) {
+    ulong                  conn = pubsub->touch_conn;
+    fd_rpc_pubsub_conn_t * c    = &pubsub->conns[ conn ];
+    pubsub->touch_conn = c->touch_next;
+
+    if( FD_LIKELY( c->sent ) )  c->stall_cnt = 0UL;
+    else if( c->blocked )       c->stall_cnt++;
+    c->sent    = 0;
+    c->blocked = 0;
+    c->touched = 0;
+
+    if( FD_UNLIKELY( c->sub_cnt && c->stall_cnt>=FD_RPC_PUBSUB_STALL_MAX ) ) {
+      pubsub->metrics.evict_cnt++;
+      pubsub->sink.close( conn, pubsub->sink_ctx );
+      fd_rpc_pubsub_conn_close( pubsub, conn );
+    }
+  }
+}
+
+/* notify delivers the notification head+body to the subscriber of sub,
+   with its subscription id as the tail.  Returns 1 if sent and 0 if
+   the connection had no room or is closing. */
+
+static int
+notify( fd_rpc_pubsub_t *           pubsub,
+        fd_rpc_pubsub_sub_t const * sub,
+        char const *                head,
+        ulong                       head_sz,
+        char const *                body,
+        ulong                       body_sz ) {
+  fd_rpc_pubsub_conn_t * c = &pubsub->conns[ sub->conn ];
+  if( FD_UNLIKELY( c->closing ) ) return 0;
+
+  if( FD_UNLIKELY( !c->touched ) ) {
+    c->touched    = 1;
+    c->touch_next = pubsub->touch_conn;
+    pubsub->touch_conn = sub->conn;
+  }
+
+  if( FD_UNLIKELY( !pubsub->sink.room( sub->conn, pubsub->sink_ctx ) ) ) {
+    c->blocked = 1;
+    pubsub->metrics.conflate_cnt++;
+    return 0;
+  }
+
+  char  tail[ 48 ];
+  ulong tail_sz;
+  FD_TEST( fd_cstr_printf_check( tail, sizeof(tail), &tail_sz, ",\"subscription\":%lu}}", sub->id ) );
+
+  fd_rpc_pubsub_msg_t msg = {
+    .part = {
+      { .data = (uchar const *)head, .sz = head_sz },
+      { .data = (uchar const *)body, .sz = body_sz },
+      { .data = (uchar const *)tail, .sz = tail_sz },
+    }
+  };
+  pubsub->sink.send( sub->conn, &msg, pubsub->sink_ctx );
+
+  c->sent = 1;
+  pubsub->metrics.notify_cnt++;
+  return 1;
+}
+
+void
+fd_rpc_pubsub_slot_notify( fd_rpc_pubsub_t * pubsub,
+                           ulong             slot,
+                           ulong             parent,
+                           ulong             root ) {
+  if( FD_UNLIKELY( !pubsub->in_pass ) ) FD_LOG_ERR(( "not in a pass" ));
+  if( FD_UNLIKELY( sub_dlist_is_empty( pubsub->slot_subs, pubsub->subs ) ) ) return;
+
+  char  body[ 128 ];
+  ulong body_sz;
+  FD_TEST( fd_cstr_printf_check( body, sizeof(body), &body_sz, "{\"parent\":%lu,\"root\":%lu,\"slot\":%lu}", parent, root, slot ) );
+  pubsub->metrics.serialize_cnt++;
+
+  /* A skipped slot notification is not retried, the next slot
+     supersedes it. */
+
+  for( sub_dlist_iter_t iter = sub_dlist_iter_fwd_init( pubsub->slot_subs, pubsub->subs );
+       !sub_dlist_iter_done( iter, pubsub->slot_subs, pubsub->subs );
+       iter = sub_dlist_iter_fwd_next( iter, pubsub->slot_subs, pubsub->subs ) ) {
+    notify( pubsub, sub_dlist_iter_ele_const( iter, pubsub->slot_subs, pubsub->subs ), head_slot, sizeof(head_slot)-1UL, body, body_sz );
+  }
+}
+
+static ulong
+key_iter( key_dlist_t const *         list,
+          fd_rpc_pubsub_key_t const * keys,
+          key_dlist_iter_t            iter ) {
+  return key_dlist_iter_done( iter, list, keys ) ? ULONG_MAX : key_dlist_iter_idx( iter, list, keys );
+}
+
+ulong
+fd_rpc_pubsub_account_first( fd_rpc_pubsub_t const * pubsub ) {
+  return key_iter( pubsub->acct_keys, pubsub->keys, key_dlist_iter_fwd_init( pubsub->acct_keys, pubsub->keys ) );
+}
+
+ulong
+fd_rpc_pubsub_account_next( fd_rpc_pubsub_t const * pubsub,
+                            ulong                   idx ) {
+  return key_iter( pubsub->acct_keys, pubsub->keys, key_dlist_iter_fwd_next( idx, pubsub->acct_keys, pubsub->keys ) );
+}
+
+fd_pubkey_t const *
+fd_rpc_pubsub_account_pubkey( fd_rpc_pubsub_t const * pubsub,
+                              ulong                   idx ) {
+  return &pubsub->keys[ idx ].id.pubkey;
+}
+
+int
+fd_rpc_pubsub_account_stale( fd_rpc_pubsub_t * pubsub,
+                             ulong             idx,
+                             ulong             mod_slot ) {
+  fd_rpc_pubsub_key_t * key = &pubsub->keys[ idx ];
+  if( FD_UNLIKELY( key->mod_slot==FD_RPC_PUBSUB_SLOT_UNKNOWN ) ) key->mod_slot = mod_slot;
+  return key->mod_slot!=mod_slot || key->dirty_cnt;
+}
+
+int
+fd_rpc_pubsub_account_stage( fd_rpc_pubsub_t *               pubsub,
+                             ulong                           ctx_slot,
+                             fd_rpc_pubsub_account_t const * acct ) {
+  if( FD_UNLIKELY( !pubsub->in_pass ) ) FD_LOG_ERR(( "not in a pass" ));
+  pubsub->body_sz = ULONG_MAX;
+
+  /* A missing account is reported like Agave does, as an empty account
+     owned by the system program. */
+
+  static uchar const system_program[ 32 ] = { 0 };
+  fd_rpc_pubsub_account_t const missing = { .data = NULL, .data_sz = 0UL, .lamports = 0UL, .owner = system_program, .executable = 0 };
+  if( FD_UNLIKELY( !acct ) ) acct = &missing;
+
+  if( FD_UNLIKELY( FD_RPC_PUBSUB_BODY_SZ( acct->data_sz )>pubsub->body_max ) ) {
+    pubsub->metrics.oversize_cnt++;
+    return 0;
+  }
+
+  char owner[ FD_BASE58_ENCODED_32_SZ ];
+  fd_base58_encode_32( acct->owner, NULL, owner );
+
+  char * p   = pubsub->body;
+  ulong  len;
+  fd_cstr_printf( p, pubsub->body_max, &len, "{\"context\":{\"slot\":%lu},\"value\":{\"data\":[\"", ctx_slot );
+  p += len;
+  p += fd_base64_encode( p, acct->data, acct->data_sz );
+  fd_cstr_printf( p, pubsub->body_max-(ulong)(p-pubsub->body), &len,
+                  "\",\"base64\"],\"executable\":%s,\"lamports\":%lu,\"owner\":\"%s\",\"rentEpoch\":18446744073709551615,\"space\":%lu}}",
+                  acct->executable ? "true" : "false", acct->lamports, owner, acct->data_sz );
+  p += len;
+
+  pubsub->body_sz = (ulong)(p-pubsub->body);
+  pubsub->metrics.serialize_cnt++;
+  return 1;
+}
+
+void
+fd_rpc_pubsub_account_publish( fd_rpc_pubsub_t * pubsub,
+                               ulong             idx,
+                               ulong             mod_slot ) {
+  if( FD_UNLIKELY( !pubsub->in_pass ) ) FD_LOG_ERR(( "not in a pass" ));
+
+  fd_rpc_pubsub_key_t * key     = &pubsub->keys[ idx ];
+  int                   changed = key->mod_slot!=mod_slot;
+  key->mod_slot = mod_slot;
+
+  int staged = pubsub->body_sz!=ULONG_MAX;
+
+  for( sub_dlist_iter_t iter = sub_dlist_iter_fwd_init( key->subs, pubsub->subs );
+       !sub_dlist_iter_done( iter, key->subs, pubsub->subs );
+       iter = sub_dlist_iter_fwd_next( iter, key->subs, pubsub->subs ) ) {
+    fd_rpc_pubsub_sub_t * sub = sub_dlist_iter_ele( iter, key->subs, pubsub->subs );
+    if( FD_UNLIKELY( !changed && !sub->dirty ) ) continue;
+
+    /* If the body did not fit, the state is dropped for everyone,
+       there is no point in retrying it. */
+
+    int sent = staged && notify( pubsub, sub, head_account, sizeof(head_account)-1UL, pubsub->body, pubsub->body_sz );
+    int dirty = staged && !sent;
+    key->dirty_cnt += (ulong)dirty;
+    key->dirty_cnt -= (ulong)sub->dirty;
+    sub->dirty      = dirty;
+  }
+}
+
+ulong
+fd_rpc_pubsub_signature_first( fd_rpc_pubsub_t const * pubsub ) {
+  return key_iter( pubsub->sig_keys, pubsub->keys, key_dlist_iter_fwd_init( pubsub->sig_keys, pubsub->keys ) );
+}
+
+ulong
+fd_rpc_pubsub_signature_next( fd_rpc_pubsub_t const * pubsub,
+                              ulong                   idx ) {
+  return key_iter( pubsub->sig_keys, pubsub->keys, key_dlist_iter_fwd_next( idx, pubsub->sig_keys, pubsub->keys ) );
+}
+
+fd_signature_t const *
+fd_rpc_pubsub_signature_sig( fd_rpc_pubsub_t const * pubsub,
+                             ulong                   idx ) {
+  return &pubsub->keys[ idx ].id.sig;
+}
+
+void
+fd_rpc_pubsub_signature_publish( fd_rpc_pubsub_t * pubsub,
+                                 ulong             idx,
+                                 ulong             ctx_slot,
+                                 int               status,
+                                 char const *      err,
+                                 ulong             err_sz ) {
+  if( FD_UNLIKELY( !pubsub->in_pass ) ) FD_LOG_ERR(( "not in a pass" ));
+  if( FD_UNLIKELY( err_sz>FD_RPC_PUBSUB_SIG_ERR_MAX ) ) FD_LOG_ERR(( "err too long (%lu)", err_sz ));
+  if( FD_UNLIKELY( !status ) ) return;
+
+  fd_rpc_pubsub_key_t * key = &pubsub->keys[ idx ];
+
+  char  body[ 64UL+FD_RPC_PUBSUB_SIG_ERR_MAX ];
+  ulong body_sz = 0UL;
+
+  for( sub_dlist_iter_t iter = sub_dlist_iter_fwd_init( key->subs, pubsub->subs );
+       !sub_dlist_iter_done( iter, key->subs, pubsub->subs );
+       iter = sub_dlist_iter_fwd_next( iter, key->subs, pubsub->subs ) ) {
+    fd_rpc_pubsub_sub_t * sub = sub_dlist_iter_ele( iter, key->subs, pubsub->subs );
+    if( FD_UNLIKELY( sub->dead || sub->commitment>status ) ) continue;
+
+    if( FD_LIKELY( !body_sz ) ) {
+      FD_TEST( fd_cstr_printf_check( body, sizeof(body), &body_sz, "{\"context\":{\"slot\":%lu},\"value\":{\"err\":%.*s}}", ctx_slot, (int)err_sz, err ) );
+      pubsub->metrics.serialize_cnt++;
+    }
+
+    /* Unlike accounts there is only one notification per subscription,
+       so it is kept pending until the subscriber can take it. */
+
+    if( FD_LIKELY( notify( pubsub, sub, head_signature, sizeof(head_signature)-1UL, body, body_sz ) ) ) {
+      sub->dead      = 1;
+      sub->reap_next = pubsub->reap_sub;
+      pubsub->reap_sub = (ulong)(sub - pubsub->subs);
+    }
+  }
+}
+
+fd_rpc_pubsub_metrics_t const *
+fd_rpc_pubsub_metrics( fd_rpc_pubsub_t const * pubsub ) {
+  return &pubsub->metrics;
+}
@@ -0,0 +1,350 @@
+#ifndef HEADER_fd_src_discof_rpc_fd_rpc_pubsub_h
+#define HEADER_fd_src_discof_rpc_fd_rpc_pubsub_h
+
+/* fd_rpc_pubsub is the subscription engine behind the WebSocket side of
+   the RPC tile (accountSubscribe, slotSubscribe, signatureSubscribe).
+   It is transport agnostic: connections are identified by a ulong in
+   [0,conn_max), and notifications are handed to a sink of callbacks
+   (fd_rpc_pubsub_sink_t) which the RPC tile implements on top of
+   fd_http_server WebSocket frames.
+
+   Subscriptions are indexed by what they watch.  Every subscribed
+   account (and signature) has a single key entry, found through a
+   hash map, which holds the list of all subscriptions on it across all
+   connections.  Each connection also has a list of its subscriptions,
+   so closing a connection is proportional to what it subscribed to.
+
+   Notifications are produced in passes, one per replay reset (for
+   accounts and signatures) or completed slot (for slots).  The owner
+   brackets a pass with fd_rpc_pubsub_publish_{begin,end}.  For every
+   subscribed account, the owner looks the account up once and checks
+   with fd_rpc_pubsub_account_stale whether anyone needs to hear about
+   it, which is only the case if it was modified since the previous
+   notification.  If so, the notification body, the part of the
+   message which is the same for every subscriber (context slot,
+   lamports, owner, base64 data, ...), is serialized once with
+   fd_rpc_pubsub_account_stage and then sent to all subscribers of the
+   account with fd_rpc_pubsub_account_publish.  Only the short envelope
+   head and the subscription id tail differ per subscriber.  With
+   thousands of subscribers on a popular account, this turns thousands
+   of base64 encodings per slot into one.
+
+   Slow consumers are handled by conflation rather than queueing.
+   Before each send, the engine asks the sink how many more frames the
+   connection can take.  If none, the notification is skipped and the
+   subscription is marked dirty: it will be sent the latest state of
+   the account on a later pass, even if the account did not change in
+   between, and intermediate states are never sent.  Slot
+   notifications are simply skipped, the next slot supersedes them.
+   Signature notifications are kept pending until they can be sent.  A
+   connection which could not take anything for FD_RPC_PUBSUB_STALL_MAX
+   consecutive passes is closed with the sink's close callback.
+
+   The sink callbacks may close connections as a side effect (the HTTP
+   server drops connections when its outgoing buffer wraps), so
+   fd_rpc_pubsub_conn_close is safe to call from within a callback.
+   During a pass, subscriptions are never freed, only marked, and the
+   bookkeeping is done in fd_rpc_pubsub_publish_end.  The engine is
+   local to a single tile and not thread safe. */
+
+#include "../../flamenco/types/fd_types_custom.h"
+
+#define FD_RPC_PUBSUB_ALIGN (128UL)
+
+/* Kinds of subscription */
+
+#define FD_RPC_PUBSUB_KIND_ACCOUNT   (0)
+#define FD_RPC_PUBSUB_KIND_SLOT      (1)
+#define FD_RPC_PUBSUB_KIND_SIGNATURE (2)
+
+/* Signature subscription commitment levels, compatible with the
+   FD_SIGSTATUS_STATUS_* a signature status query returns.  A
+   subscription fires once the signature reached its level. */
+
+#define FD_RPC_PUBSUB_COMMITMENT_PROCESSED (1)
+#define FD_RPC_PUBSUB_COMMITMENT_FINALIZED (2)
+
+/* FD_RPC_PUBSUB_SLOT_{MISSING,UNKNOWN} are special values for the
+   modification slot of an account.  MISSING means the account does
+   not exist (or has zero lamports), and UNKNOWN that its state was not
+   looked up yet. */
+
+#define FD_RPC_PUBSUB_SLOT_MISSING (ULONG_MAX)
+#define FD_RPC_PUBSUB_SLOT_UNKNOWN (ULONG_MAX-1UL)
+
+/* FD_RPC_PUBSUB_STALL_MAX is the number of consecutive passes a
+   connection may be unable to take any notification before it is
+   closed.  With a pass per slot this is about 25 seconds. */
+
+#define FD_RPC_PUBSUB_STALL_MAX (64UL)
+
+/* FD_RPC_PUBSUB_BODY_MIN is the smallest supported body buffer, which
+   fits the notification of an account with no data. */
+
+#define FD_RPC_PUBSUB_BODY_MIN (512UL)
+
+/* FD_RPC_PUBSUB_BODY_SZ is the body buffer size needed to notify an
+   account with data_sz bytes of data. */
+
+#define FD_RPC_PUBSUB_BODY_SZ( data_sz ) (FD_RPC_PUBSUB_BODY_MIN + (((data_sz)+2UL)/3UL)*4UL)
+
+/* FD_RPC_PUBSUB_SIG_ERR_MAX is the max length of the transaction
+   error of a signature notification. */
+
+#define FD_RPC_PUBSUB_SIG_ERR_MAX (256UL)
+
+/* fd_rpc_pubsub_msg_t is a notification handed to the sink.  The
+   message is the concatenation of the parts. */
+
+#define FD_RPC_PUBSUB_MSG_PART_CNT (3UL)
+
+struct fd_rpc_pubsub_msg {
+  struct {
+    uchar const * data;
+    ulong         sz;
+  } part[ FD_RPC_PUBSUB_MSG_PART_CNT ];
+};
+
+typedef struct fd_rpc_pubsub_msg fd_rpc_pubsub_msg_t;
+
+struct fd_rpc_pubsub_sink {
+  /* Returns the number of messages that can currently be sent on conn
+     without blocking. */
+
+  ulong ( * room  )( ulong conn, void * ctx );
+
+  /* Sends msg on conn as a single message.  Only called if room was
+     positive.  The message is valid only for the duration of the call. */
+
+  void  ( * send  )( ulong conn, fd_rpc_pubsub_msg_t const * msg, void * ctx );
+
+  /* Closes conn, which has stalled.  Its subscriptions are removed
+     by the engine right after, so a nested fd_rpc_pubsub_conn_close is
+     fine but not needed. */
+
+  void  ( * close )( ulong conn, void * ctx );
+};
+
+typedef struct fd_rpc_pubsub_sink fd_rpc_pubsub_sink_t;
+
+/* fd_rpc_pubsub_account_t describes the state of an account to notify.
+   data is only accessed in fd_rpc_pubsub_account_stage. */
+
+struct fd_rpc_pubsub_account {
+  uchar const * data;
+  ulong         data_sz;
+  ulong         lamports;
+  uchar const * owner;      /* 32 bytes */
+  int           executable;
+};
+
+typedef struct fd_rpc_pubsub_account fd_rpc_pubsub_account_t;
+
+struct fd_rpc_pubsub_metrics {
+  ulong sub_cnt;        /* current number of subscriptions */
+  ulong sub_fail_cnt;   /* subscribes refused because the engine was full */
+  ulong notify_cnt;     /* notifications sent */
+  ulong serialize_cnt;  /* notification bodies serialized */
+  ulong conflate_cnt;   /* notifications skipped or delayed because the subscriber was behind */
+  ulong oversize_cnt;   /* account notifications dropped because the body did not fit */
+  ulong evict_cnt;      /* connections closed for stalling */
+};
+
+typedef struct fd_rpc_pubsub_metrics fd_rpc_pubsub_metrics_t;
+
+struct fd_rpc_pubsub_private;
+typedef struct fd_rpc_pubsub_private fd_rpc_pubsub_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_rpc_pubsub_{align,footprint} give the alignment and footprint of
+   a memory region suitable to hold an engine with at most sub_max
+   subscriptions in total over conn_max connections, which can notify
+   bodies of up to body_max bytes (see FD_RPC_PUBSUB_BODY_SZ).  Returns
+   0 footprint for invalid parameters.
+
+   fd_rpc_pubsub_new formats such a region.  seed is the hash seed.
+   sink and ctx are the callbacks notifications are sent to and their
+   context.  fd_rpc_pubsub_{join,leave,delete} are the usual. */
+
+FD_FN_CONST ulong
+fd_rpc_pubsub_align( void );
+
+FD_FN_CONST ulong
+fd_rpc_pubsub_footprint( ulong sub_max,
+                         ulong conn_max,
+                         ulong body_max );
+
+void *
+fd_rpc_pubsub_new( void *                       shmem,
+                   ulong                        sub_max,
+                   ulong                        conn_max,
+                   ulong                        body_max,
+                   ulong                        seed,
+                   fd_rpc_pubsub_sink_t const * sink,
+                   void *                       ctx );
+
+fd_rpc_pubsub_t *
+fd_rpc_pubsub_join( void * shpubsub );
+
+void *
+fd_rpc_pubsub_leave( fd_rpc_pubsub_t * pubsub );
+
+void *
+fd_rpc_pubsub_delete( void * shpubsub );
+
+/* fd_rpc_pubsub_{account,slot,signature}_subscribe add a subscription
+   on conn and return its id, or ULONG_MAX if the engine is full.  Ids
+   are unique among live subscriptions and below 2^53, so they survive
+   a round trip through a JavaScript number.
+
+   For accounts, mod_slot is the slot in which the account was last
+   modified at the time of subscribing, FD_RPC_PUBSUB_SLOT_MISSING if it
+   does not exist, or FD_RPC_PUBSUB_SLOT_UNKNOWN.  It is only used if
+   there is no other subscription on the account, and a notification is
+   sent on the first change after it.  If UNKNOWN, the state seen in
+   the first pass is taken as the baseline.
+
+   For signatures, commitment is FD_RPC_PUBSUB_COMMITMENT_*.  Must not
+   be called during a pass. */
+
+ulong
+fd_rpc_pubsub_account_subscribe( fd_rpc_pubsub_t *   pubsub,
+                                 ulong               conn,
+                                 fd_pubkey_t const * pubkey,
+                                 ulong               mod_slot );
+
+ulong
+fd_rpc_pubsub_slot_subscribe( fd_rpc_pubsub_t * pubsub,
+                              ulong             conn );
+
+ulong
+fd_rpc_pubsub_signature_subscribe( fd_rpc_pubsub_t *      pubsub,
+                                   ulong                  conn,
+                                   fd_signature_t const * sig,
+                                   int                    commitment );
+
+/* fd_rpc_pubsub_unsubscribe removes the subscription with the given id
+   and kind on conn.  Returns 1 on success and 0 if there is no such
+   subscription.  Must not be called during a pass. */
+
+int
+fd_rpc_pubsub_unsubscribe( fd_rpc_pubsub_t * pubsub,
+                           ulong             conn,
+                           int               kind,
+                           ulong             sub_id );
+
+/* fd_rpc_pubsub_conn_close removes all subscriptions of conn.  May be
+   called at any time, including from within a sink callback. */
+
+void
+fd_rpc_pubsub_conn_close( fd_rpc_pubsub_t * pubsub,
+                          ulong             conn );
+
+/* fd_rpc_pubsub_publish_{begin,end} bracket a notification pass.  All
+   of the notify, stage and publish functions below must be called
+   within a pass.  Subscriptions removed during the pass are freed, and
+   stalled connections closed, in publish_end. */
+
+void
+fd_rpc_pubsub_publish_begin( fd_rpc_pubsub_t * pubsub );
+
+void
+fd_rpc_pubsub_publish_end( fd_rpc_pubsub_t * pubsub );
+
+/* fd_rpc_pubsub_slot_notify sends a slot notification to all slot
+   subscribers. */
+
+void
+fd_rpc_pubsub_slot_notify( fd_rpc_pubsub_t * pubsub,
+                           ulong             slot,
+                           ulong             parent,
+                           ulong             root );
+
+/* fd_rpc_pubsub_account_{first,next} iterate over the subscribed
+   accounts, identified by an index, in no particular order.  Returns
+   ULONG_MAX when done.  fd_rpc_pubsub_account_pubkey gives the address
+   of the account at idx. */
+
+ulong
+fd_rpc_pubsub_account_first( fd_rpc_pubsub_t const * pubsub );
+
+ulong
+fd_rpc_pubsub_account_next( fd_rpc_pubsub_t const * pubsub,
+                            ulong                   idx );
+
+fd_pubkey_t const *
+fd_rpc_pubsub_account_pubkey( fd_rpc_pubsub_t const * pubsub,
+                              ulong                   idx );
+
+/* fd_rpc_pubsub_account_stale returns 1 if the account at idx, which
+   was last modified in mod_slot (or is FD_RPC_PUBSUB_SLOT_MISSING),
+   must be published, because it changed since the last notification or
+   some subscriber still owes a conflated one.  Returns 0 otherwise.  If
+   the previous state is unknown, records mod_slot as the baseline. */
+
+int
+fd_rpc_pubsub_account_stale( fd_rpc_pubsub_t * pubsub,
+                             ulong             idx,
+                             ulong             mod_slot );
+
+/* fd_rpc_pubsub_account_stage serializes the notification body for
+   acct (NULL if the account does not exist) in the context of
+   ctx_slot into the engine's body buffer, replacing any previously
+   staged body.  Returns 1 on success and 0 if it does not fit.  Cheap
+   to repeat, as is needed when a speculative account read must be
+   retried. */
+
+int
+fd_rpc_pubsub_account_stage( fd_rpc_pubsub_t *               pubsub,
+                             ulong                           ctx_slot,
+                             fd_rpc_pubsub_account_t const * acct );
+
+/* fd_rpc_pubsub_account_publish sends the staged body to the
+   subscribers of the account at idx, whose state was last modified in
+   mod_slot.  If that differs from the previously published state, all
+   subscribers are notified, otherwise only those owing a conflated
+   notification.  Must also be called if staging failed, in which case
+   the state is recorded but nothing is sent. */
+
+void
+fd_rpc_pubsub_account_publish( fd_rpc_pubsub_t * pubsub,
+                               ulong             idx,
+                               ulong             mod_slot );
+
+/* fd_rpc_pubsub_signature_{first,next} iterate over the subscribed
+   signatures like the account variants.  fd_rpc_pubsub_signature_sig
+   gives the signature at idx. */
+
+ulong
+fd_rpc_pubsub_signature_first( fd_rpc_pubsub_t const * pubsub );
+
+ulong
+fd_rpc_pubsub_signature_next( fd_rpc_pubsub_t const * pubsub,
+                              ulong                   idx );
+
+fd_signature_t const *
+fd_rpc_pubsub_signature_sig( fd_rpc_pubsub_t const * pubsub,
+                             ulong                   idx );
+
+/* fd_rpc_pubsub_signature_publish notifies the subscribers of the
+   signature at idx whose commitment is satisfied by status (a
+   FD_RPC_PUBSUB_COMMITMENT_* level, 0 if not found), and removes their
+   subscriptions.  err is the JSON value of the transaction error
+   ("null" on success) of length err_sz, at most
+   FD_RPC_PUBSUB_SIG_ERR_MAX. */
+
+void
+fd_rpc_pubsub_signature_publish( fd_rpc_pubsub_t * pubsub,
+                                 ulong             idx,
+                                 ulong             ctx_slot,
+                                 int               status,
+                                 char const *      err,
+                                 ulong             err_sz );
+
+fd_rpc_pubsub_metrics_t const *
+fd_rpc_pubsub_metrics( fd_rpc_pubsub_t const * pubsub );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_discof_rpc_fd_rpc_pubsub_h */
@@ -3,23 +3,52 @@
 #include "../../disco/topo/fd_topo.h"
 #include "../../disco/keyguard/fd_keyload.h"
 #include "../../disco/keyguard/fd_keyswitch.h"
+#include "../../disco/metrics/fd_metrics.h"
 #include "../../flamenco/features/fd_features.h"
 #include "../../flamenco/runtime/sysvar/fd_sysvar_rent.h"
+#include "../../flamenco/runtime/fd_sigstatus.h"
+#include "../../flamenco/runtime/fd_runtime_err.h"
+#include "../../flamenco/runtime/fd_executor_err.h"
+#include "../../flamenco/runtime/fd_runtime_const.h"
+#include "../../flamenco/accdb/fd_accdb_sync.h"
+#include "../../flamenco/accdb/fd_accdb_impl_v1.h"
 #include "../../waltz/http/fd_http_server.h"
 #include "../../waltz/http/fd_http_server_private.h"
-#include "../../ballet/json/cJSON.h"
-#include "../../ballet/json/cJSON_alloc.h"
 #include "../../ballet/lthash/fd_lthash.h"
+#include "../../util/pod/fd_pod.h"
+#include "fd_rpc_json.h"
+#include "fd_rpc_method.h"
+#include "fd_rpc_cache.h"
+#include "fd_rpc_pubsub.h"
 
 #include <stddef.h>
 #include <sys/socket.h>
 
 #include "generated/fd_rpc_tile_seccomp.h"
 
-#define FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN 8192UL
+/* Large enough for a getSignatureStatuses request with the maximum of
+   256 base58 signatures. */
+#define FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN 32768UL
+
+/* Response cache sizing.  Only a handful of (method, parameters)
+   combinations are cacheable, but bodies like the leader schedule can
+   be large. */
+#define FD_RPC_CACHE_ENT_MAX  (64UL)
+#define FD_RPC_CACHE_DATA_MAX (1UL<<20)
+
+/* WebSocket requests are subscribe and unsubscribe calls, a base58
+   address or signature and a small config object.  The send frame
+   count bounds how far behind a subscriber can fall before its
+   notifications are conflated, see fd_rpc_pubsub.h. */
+#define FD_HTTP_SERVER_RPC_MAX_WS_RECV_FRAME_LEN 8192UL
+#define FD_HTTP_SERVER_RPC_MAX_WS_SEND_FRAME_CNT 8192UL
+
+/* The notification body buffer must hold the largest possible account,
+   base64 encoded. */
+#define FD_RPC_PUBSUB_BODY_MAX FD_RPC_PUBSUB_BODY_SZ( FD_RUNTIME_ACC_SZ_MAX )
 
 #define IN_KIND_REPLAY (0)
-#define IN_KIND_GENESI (0)
+#define IN_KIND_GENESI (1)
 
 #define FD_RPC_COMMITMENT_PROCESSED (0)
 #define FD_RPC_COMMITMENT_CONFIRMED (1)
@@ -31,59 +60,6 @@
 #define FD_RPC_ENCODING_BINARY      (3)
 #define FD_RPC_ENCODING_JSON_PARSED (4)
 
-#define FD_RPC_METHOD_GET_ACCOUNT_INFO                       ( 0)
-#define FD_RPC_METHOD_GET_BALANCE                            ( 1)
-#define FD_RPC_METHOD_GET_BLOCK                              ( 2)
-#define FD_RPC_METHOD_GET_BLOCK_COMMITMENT                   ( 3)
-#define FD_RPC_METHOD_GET_BLOCK_HEIGHT                       ( 4)
-#define FD_RPC_METHOD_GET_BLOCK_PRODUCTION                   ( 5)
-#define FD_RPC_METHOD_GET_BLOCKS                             ( 6)
-#define FD_RPC_METHOD_GET_BLOCKS_WITH_LIMIT                  ( 7)
-#define FD_RPC_METHOD_GET_BLOCK_TIME                         ( 8)
-#define FD_RPC_METHOD_GET_CLUSTER_NODES                      ( 9)
-#define FD_RPC_METHOD_GET_EPOCH_INFO                         (10)
-#define FD_RPC_METHOD_GET_EPOCH_SCHEDULE                     (11)
-#define FD_RPC_METHOD_GET_FEE_FOR_MESSAGE                    (12)
-#define FD_RPC_METHOD_GET_FIRST_AVAILABLE_BLOCK              (13)
-#define FD_RPC_METHOD_GET_GENESIS_HASH                       (14)
-#define FD_RPC_METHOD_GET_HEALTH                             (15)
-#define FD_RPC_METHOD_GET_HIGHEST_SNAPSHOT_SLOT              (16)
-#define FD_RPC_METHOD_GET_IDENTITY                           (17)
-#define FD_RPC_METHOD_GET_INFLATION_GOVERNOR                 (18)
-#define FD_RPC_METHOD_GET_INFLATION_RATE                     (19)
-#define FD_RPC_METHOD_GET_INFLATION_REWARD                   (20)
-#define FD_RPC_METHOD_GET_LARGEST_ACCOUNTS                   (21)
-#define FD_RPC_METHOD_GET_LATEST_BLOCKHASH                   (22)
-#define FD_RPC_METHOD_GET_LEADER_SCHEDULE                    (23)
-#define FD_RPC_METHOD_GET_MAX_RETRANSMIT_SLOT                (24)
-#define FD_RPC_METHOD_GET_MAX_SHRED_INSERT_SLOT              (25)
-#define FD_RPC_METHOD_GET_MINIMUM_BALANCE_FOR_RENT_EXEMPTION (26)
-#define FD_RPC_METHOD_GET_MULTIPLE_ACCOUNTS                  (27)
-#define FD_RPC_METHOD_GET_PROGRAM_ACCOUNTS                   (28)
-#define FD_RPC_METHOD_GET_RECENT_PERFORMANCE_SAMPLES         (29)
-#define FD_RPC_METHOD_GET_RECENT_PRIORITIZATION_FEES         (30)
-#define FD_RPC_METHOD_GET_SIGNATURES_FOR_ADDRESS             (31)
-#define FD_RPC_METHOD_GET_SIGNATURE_STATUSES                 (32)
-#define FD_RPC_METHOD_GET_SLOT                               (33)
-#define FD_RPC_METHOD_GET_SLOT_LEADER                        (34)
-#define FD_RPC_METHOD_GET_SLOT_LEADERS                       (35)
-#define FD_RPC_METHOD_GET_STAKE_MINIMUM_DELEGATION           (36)
-#define FD_RPC_METHOD_GET_SUPPLY                             (37)
-#define FD_RPC_METHOD_GET_TOKEN_ACCOUNT_BALANCE              (38)
-#define FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_DELEGATE         (39)
-#define FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_OWNER            (40)
-#define FD_RPC_METHOD_GET_TOKEN_LARGEST_ACCOUNTS             (41)
-#define FD_RPC_METHOD_GET_TOKEN_SUPPLY                       (42)
-#define FD_RPC_METHOD_GET_TRANSACTION                        (43)
-#define FD_RPC_METHOD_GET_TRANSACTION_COUNT                  (44)
-#define FD_RPC_METHOD_GET_VERSION                            (45)
-#define FD_RPC_METHOD_GET_VOTE_ACCOUNTS                      (46)
-#define FD_RPC_METHOD_IS_BLOCKHASH_VALID                     (47)
-#define FD_RPC_METHOD_MINIMUM_LEDGER_SLOT                    (48)
-#define FD_RPC_METHOD_REQUEST_AIRDROP                        (49)
-#define FD_RPC_METHOD_SEND_TRANSACTION                       (50)
-#define FD_RPC_METHOD_SIMULATE_TRANSACTION                   (51)
-
 // Keep in sync with https://github.com/solana-labs/solana-web3.js/blob/master/src/errors.ts
 // and https://github.com/anza-xyz/agave/blob/master/rpc-client-api/src/custom_error.rs
 #define FD_RPC_ERROR_BLOCK_CLEANED_UP                            (-32001)
@@ -110,12 +86,13 @@ static fd_http_server_params_t
 derive_http_params( fd_topo_tile_t const * tile ) {
   return (fd_http_server_params_t) {
     .max_connection_cnt    = tile->rpc.max_http_connections,
-    .max_ws_connection_cnt = 0UL,
+    .max_ws_connection_cnt = tile->rpc.max_websocket_connections,
     .max_request_len       = FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN,
-    .max_ws_recv_frame_len = 0UL,
-    .max_ws_send_frame_cnt = 0UL,
+    .max_ws_recv_frame_len = FD_HTTP_SERVER_RPC_MAX_WS_RECV_FRAME_LEN,
+    .max_ws_send_frame_cnt = FD_HTTP_SERVER_RPC_MAX_WS_SEND_FRAME_CNT,
     .outgoing_buffer_sz    = tile->rpc.send_buffer_size_mb * (1UL<<20UL),
     .compress_websocket    = 0,
+    .reuse_port            = tile->rpc.reuse_port,
   };
 }
 
@@ -164,11 +141,28 @@ typedef struct bank_info bank_info_t;
 struct fd_rpc_tile {
   fd_http_server_t * http;
 
+  /* Token storage for the request currently being handled, and the
+     body it refers to.  Sized so that tokenizing can never run out. */
+  fd_rpc_json_tok_t * tok;
+  char const *        body;
+
   bank_info_t * banks;
 
+  fd_sigstatus_t * sigstatus;
+
+  /* WebSocket subscriptions, see fd_rpc_pubsub.h.  Accounts are read
+     from the accounts database at the processed bank when notifying. */
+  fd_rpc_pubsub_t * pubsub;
+  fd_accdb_user_t   accdb[1];
+
+  /* Pre-serialized responses, valid until the next replay or genesis
+     frag or identity switch, see fd_rpc_cache.h. */
+  fd_rpc_cache_t * cache;
+
   ulong cluster_confirmed_slot;
 
   ulong processed_idx;
+  ulong processed_slot;
   ulong confirmed_idx;
   ulong finalized_idx;
 
@@ -199,28 +193,45 @@ FD_FN_PURE static inline ulong
 scratch_footprint( fd_topo_tile_t const * tile ) {
   ulong http_fp = fd_http_server_footprint( derive_http_params( tile ) );
   if( FD_UNLIKELY( !http_fp ) ) FD_LOG_ERR(( "Invalid [tiles.rpc] config parameters" ));
+  ulong pubsub_fp = fd_rpc_pubsub_footprint( tile->rpc.max_subscriptions, tile->rpc.max_websocket_connections, FD_RPC_PUBSUB_BODY_MAX );
+  if( FD_UNLIKELY( !pubsub_fp ) ) FD_LOG_ERR(( "Invalid [tiles.rpc] config parameters" ));
 
   ulong l = FD_LAYOUT_INIT;
-  l = FD_LAYOUT_APPEND( l, alignof( fd_rpc_tile_t ), sizeof( fd_rpc_tile_t )                      );
-  l = FD_LAYOUT_APPEND( l, fd_http_server_align(),   http_fp                                      );
-  l = FD_LAYOUT_APPEND( l, fd_alloc_align(),         fd_alloc_footprint()                         );
-  l = FD_LAYOUT_APPEND( l, alignof(bank_info_t),     tile->rpc.max_live_slots*sizeof(bank_info_t) );
+  l = FD_LAYOUT_APPEND( l, alignof( fd_rpc_tile_t ),     sizeof( fd_rpc_tile_t )                                                           );
+  l = FD_LAYOUT_APPEND( l, fd_http_server_align(),       http_fp                                                                           );
+  l = FD_LAYOUT_APPEND( l, alignof( fd_rpc_json_tok_t ), fd_rpc_json_tok_max( FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN )*sizeof(fd_rpc_json_tok_t) );
+  l = FD_LAYOUT_APPEND( l, alignof(bank_info_t),         tile->rpc.max_live_slots*sizeof(bank_info_t)                                      );
+  l = FD_LAYOUT_APPEND( l, fd_rpc_cache_align(),         fd_rpc_cache_footprint( FD_RPC_CACHE_ENT_MAX, FD_RPC_CACHE_DATA_MAX )             );
+  l = FD_LAYOUT_APPEND( l, fd_rpc_pubsub_align(),        pubsub_fp                                                                         );
   return FD_LAYOUT_FINI( l, scratch_align() );
 }
 
-FD_FN_PURE static inline ulong
-loose_footprint( fd_topo_tile_t const * tile FD_PARAM_UNUSED ) {
-  return 256UL * (1UL<<20UL); /* 256MiB of heap space for the cJSON allocator */
-}
-
 static inline void
 during_housekeeping( fd_rpc_tile_t * ctx ) {
   if( FD_UNLIKELY( fd_keyswitch_state_query( ctx->keyswitch )==FD_KEYSWITCH_STATE_SWITCH_PENDING ) ) {
     fd_memcpy( ctx->identity_pubkey, ctx->keyswitch->bytes, 32UL );
+    fd_rpc_cache_reset( ctx->cache );
     fd_keyswitch_state( ctx->keyswitch, FD_KEYSWITCH_STATE_COMPLETED );
   }
 }
 
+static inline void
+metrics_write( fd_rpc_tile_t * ctx ) {
+  fd_rpc_cache_metrics_t const * metrics = fd_rpc_cache_metrics( ctx->cache );
+  FD_MCNT_SET( RPC, RESPONSE_CACHE_HITS,            metrics->hit_cnt         );
+  FD_MCNT_SET( RPC, RESPONSE_CACHE_MISSES,          metrics->miss_cnt        );
+  FD_MCNT_SET( RPC, RESPONSE_CACHE_INSERT_FAILURES, metrics->insert_fail_cnt );
+
+  fd_rpc_pubsub_metrics_t const * pubsub = fd_rpc_pubsub_metrics( ctx->pubsub );
+  FD_MGAUGE_SET( RPC, PUBSUB_SUBSCRIPTIONS,      pubsub->sub_cnt       );
+  FD_MCNT_SET(   RPC, PUBSUB_SUBSCRIBE_FAILURES, pubsub->sub_fail_cnt  );
+  FD_MCNT_SET(   RPC, PUBSUB_NOTIFICATIONS,      pubsub->notify_cnt    );
+  FD_MCNT_SET(   RPC, PUBSUB_SERIALIZATIONS,     pubsub->serialize_cnt );
+  FD_MCNT_SET(   RPC, PUBSUB_CONFLATED,          pubsub->conflate_cnt  );
+  FD_MCNT_SET(   RPC, PUBSUB_OVERSIZE,           pubsub->oversize_cnt  );
+  FD_MCNT_SET(   RPC, PUBSUB_EVICTIONS,          pubsub->evict_cnt     );
+}
+
 static void
 before_credit( fd_rpc_tile_t *     ctx,
                fd_stem_context_t * stem,
@@ -234,6 +245,11 @@ before_credit( fd_rpc_tile_t *     ctx,
   }
 }
 
+static void
+pubsub_publish_reset( fd_rpc_tile_t * ctx,
+                      ulong           slot,
+                      ulong           bank_idx );
+
 static inline int
 returnable_frag( fd_rpc_tile_t *     ctx,
                  ulong               in_idx,
@@ -256,6 +272,11 @@ returnable_frag( fd_rpc_tile_t *     ctx,
   (void)tspub;
   (void)stem;
 
+  /* Every frag we consume updates state that responses are built from.
+     Rather than tracking which cached responses depend on what, drop
+     them all.  There are only a few frags per slot. */
+  fd_rpc_cache_reset( ctx->cache );
+
   if( ctx->in_kind[ in_idx ]==IN_KIND_REPLAY ) {
     switch( sig ) {
       case REPLAY_SIG_SLOT_COMPLETED: {
@@ -277,13 +298,22 @@ returnable_frag( fd_rpc_tile_t *     ctx,
         bank->rent.exemption_threshold     = slot_completed->rent.exemption_threshold;
         bank->rent.burn_percent            = slot_completed->rent.burn_percent;
 
+        fd_rpc_pubsub_publish_begin( ctx->pubsub );
+        fd_rpc_pubsub_slot_notify( ctx->pubsub, slot_completed->slot, slot_completed->parent_slot, slot_completed->root_slot );
+        fd_rpc_pubsub_publish_end( ctx->pubsub );
         break;
       }
       case REPLAY_SIG_RESET: {
         fd_poh_reset_t const * reset = fd_chunk_to_laddr_const( ctx->in[ in_idx ].mem, chunk );
 
         ulong prior_processed_idx = ctx->processed_idx;
-        ctx->processed_idx = reset->bank_idx;
+        ctx->processed_idx  = reset->bank_idx;
+        ctx->processed_slot = reset->completed_slot;
+
+        /* The accounts database is read at the new processed bank, so
+           the notification pass must run before the prior bank is
+           released back to replay. */
+        pubsub_publish_reset( ctx, reset->completed_slot, reset->bank_idx );
 
         if( FD_LIKELY( prior_processed_idx!=ULONG_MAX ) ) fd_stem_publish( stem, ctx->replay_out->idx, prior_processed_idx, 0UL, 0UL, 0UL, 0UL, 0UL );
         break;
@@ -410,11 +440,104 @@ jsonp_close_envelope( fd_http_server_t * http,
   jsonp_strip_trailing_comma( http );
 }
 
+/* cache_serve answers the request from the response cache if there is
+   an entry for key.  The cached body ends with the "id": key, so the
+   request id and closing brace are appended here.  Returns 1 and fills
+   in *response on a hit, and 0 on a miss. */
+
+static int
+cache_serve( fd_rpc_tile_t *             ctx,
+             ulong                       key,
+             ulong                       request_id,
+             fd_http_server_response_t * response ) {
+  ulong         sz;
+  uchar const * body = fd_rpc_cache_query( ctx->cache, key, &sz );
+  if( FD_UNLIKELY( !body ) ) return 0;
+
+  fd_http_server_memcpy( ctx->http, body, sz );
+  fd_http_server_printf( ctx->http, "%lu}", request_id );
+  *response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
+  FD_TEST( !fd_http_server_stage_body( ctx->http, response ) );
+  return 1;
+}
+
+/* jsonp_close_envelope_cached is jsonp_close_envelope for a cacheable
+   response.  Everything staged up to the request id is stored in the
+   cache under key before the id is written. */
+
+static void
+jsonp_close_envelope_cached( fd_rpc_tile_t * ctx,
+                             ulong           key,
+                             ulong           id ) {
+  fd_http_server_t * http = ctx->http;
+  jsonp_close_object( http );
+  fd_http_server_printf( http, "\"id\":" );
+  if( FD_LIKELY( !http->stage_err ) ) {
+    fd_rpc_cache_insert( ctx->cache, key, http->oring+(http->stage_off%http->oring_sz), http->stage_len );
+  }
+  fd_http_server_printf( http, "%lu}", id );
+}
+
+/* params_cnt returns the number of elements in the request's "params"
+   array, which is the token at index params, or FD_RPC_JSON_IDX_NULL
+   if the request had none. */
+
+static inline ulong
+params_cnt( fd_rpc_tile_t const * ctx,
+            ulong                 params ) {
+  return params==FD_RPC_JSON_IDX_NULL ? 0UL : ctx->tok[ params ].cnt;
+}
+
+static inline ulong
+params_get( fd_rpc_tile_t const * ctx,
+            ulong                 params,
+            ulong                 i ) {
+  return fd_rpc_json_arr_get( ctx->tok, params, i );
+}
+
+#define CONFIG_GET( ctx, config, key ) fd_rpc_json_obj_get( (ctx)->tok, (ctx)->body, (config), (key), sizeof(key)-1UL )
+#define STR_EQ( ctx, idx, s )          fd_rpc_json_str_eq( (ctx)->tok, (ctx)->body, (idx), (s), sizeof(s)-1UL )
+
+/* parse_commitment reads the optional "commitment" field of the config
+   object at token index config into *commitment, leaving it unchanged
+   if the field is absent.  Returns 0 on success, or -1 if the field is
+   not one of the known commitment levels. */
+
+static int
+parse_commitment( fd_rpc_tile_t const * ctx,
+                  ulong                 config,
+                  int *                 commitment ) {
+  ulong idx = CONFIG_GET( ctx, config, "commitment" );
+  if( FD_LIKELY( idx==FD_RPC_JSON_IDX_NULL ) ) return 0;
+
+  if(      FD_LIKELY( STR_EQ( ctx, idx, "processed" ) ) ) *commitment = FD_RPC_COMMITMENT_PROCESSED;
+  else if( FD_LIKELY( STR_EQ( ctx, idx, "confirmed" ) ) ) *commitment = FD_RPC_COMMITMENT_CONFIRMED;
+  else if( FD_LIKELY( STR_EQ( ctx, idx, "finalized" ) ) ) *commitment = FD_RPC_COMMITMENT_FINALIZED;
+  else return -1;
+  return 0;
+}
+
+/* parse_min_context_slot is the same for the optional "minContextSlot"
+   field. */
+
+static int
+parse_min_context_slot( fd_rpc_tile_t const * ctx,
+                        ulong                 config,
+                        ulong *               min_context_slot ) {
+  ulong idx = CONFIG_GET( ctx, config, "minContextSlot" );
+  if( FD_LIKELY( idx==FD_RPC_JSON_IDX_NULL ) ) return 0;
+
+  ulong slot;
+  if( FD_UNLIKELY( !fd_rpc_json_ulong( ctx->tok, ctx->body, idx, &slot ) || slot==ULONG_MAX ) ) return -1;
+  *min_context_slot = slot;
+  return 0;
+}
+
 #define UNIMPLEMENTED(X)                               \
 static fd_http_server_response_t                       \
 X( fd_rpc_tile_t * ctx,                                \
    ulong           request_id,                         \
-   cJSON const *   params ) {                          \
+   ulong           params ) {                          \
   (void)ctx; (void)request_id; (void)params;           \
   return (fd_http_server_response_t){ .status = 501 }; \
 }
@@ -427,29 +550,18 @@ UNIMPLEMENTED(getBlockCommitment)
 static fd_http_server_response_t
 getBlockHeight( fd_rpc_tile_t * ctx,
                 ulong           request_id,
-                cJSON const *   params ) {
+                ulong           params ) {
   int commitment = FD_RPC_COMMITMENT_FINALIZED;
   ulong minContextSlot = ULONG_MAX;
 
-  if( FD_UNLIKELY( params && cJSON_GetArraySize( params ) ) ) {
-    if( FD_UNLIKELY( cJSON_GetArraySize( params )>1 ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * param = cJSON_GetArrayItem( params, 0 );
-    if( FD_UNLIKELY( !cJSON_IsObject( param ) ) ) return (fd_http_server_response_t){ .status = 400 };
+  if( FD_UNLIKELY( params_cnt( ctx, params ) ) ) {
+    if( FD_UNLIKELY( params_cnt( ctx, params )>1UL ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    const cJSON * _commitment = cJSON_GetObjectItemCaseSensitive( param, "commitment" );
-    if( FD_UNLIKELY( _commitment && ( !cJSON_IsString( _commitment ) || _commitment->valuestring==NULL ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    ulong config = params_get( ctx, params, 0UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    if( FD_LIKELY( !strcmp( _commitment->valuestring, "processed" ) ) ) commitment = FD_RPC_COMMITMENT_PROCESSED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "confirmed" ) ) ) commitment = FD_RPC_COMMITMENT_CONFIRMED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "finalized" ) ) ) commitment = FD_RPC_COMMITMENT_FINALIZED;
-    else return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * _minContextSlot = cJSON_GetObjectItemCaseSensitive( param, "minContextSlot" );
-    if( FD_UNLIKELY( _minContextSlot ) ) {
-      if( FD_UNLIKELY( !cJSON_IsNumber( _minContextSlot ) || _minContextSlot->valueulong==ULONG_MAX ) ) return (fd_http_server_response_t){ .status = 400 };
-      minContextSlot = _minContextSlot->valueulong;
-    }
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    if( FD_UNLIKELY( parse_min_context_slot( ctx, config, &minContextSlot ) ) ) return (fd_http_server_response_t){ .status = 400 };
   }
 
   if( FD_UNLIKELY( commitment!=FD_RPC_COMMITMENT_PROCESSED ) ) return (fd_http_server_response_t){ .status = 400 };
@@ -487,7 +599,7 @@ UNIMPLEMENTED(getFirstAvailableBlock) // TODO: Used by solana-exporter
 static fd_http_server_response_t
 getGenesisHash( fd_rpc_tile_t * ctx,
                 ulong           request_id,
-                cJSON const *   params ) {
+                ulong           params ) {
   (void)params;
 
   if( FD_UNLIKELY( !ctx->has_genesis_hash ) ) {
@@ -543,7 +655,7 @@ getGenesisHash( fd_rpc_tile_t * ctx,
 static fd_http_server_response_t
 getHealth( fd_rpc_tile_t * ctx,
            ulong           request_id,
-           cJSON const *   params ) {
+           ulong           params ) {
   (void)params;
 
   // TODO: We should probably implement the same waiting_for_supermajority
@@ -565,7 +677,7 @@ getHealth( fd_rpc_tile_t * ctx,
 static fd_http_server_response_t
 getHighestSnapshotSlot( fd_rpc_tile_t * ctx,
                         ulong           request_id,
-                        cJSON const *   params ) {
+                        ulong           params ) {
   (void)params;
   fd_http_server_printf( ctx->http, "{\"jsonrpc\":\"2.0\",\"error\":{\"code\":%d,\"message\":\"No snapshot\"},\"id\":%lu}\n", FD_RPC_ERROR_NO_SNAPSHOT, request_id );
   fd_http_server_response_t response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
@@ -576,7 +688,7 @@ getHighestSnapshotSlot( fd_rpc_tile_t * ctx,
 static fd_http_server_response_t
 getIdentity( fd_rpc_tile_t * ctx,
              ulong           request_id,
-             cJSON const *   params ) {
+             ulong           params ) {
   (void)params;
 
   FD_BASE58_ENCODE_32_BYTES( ctx->identity_pubkey, identity_pubkey_b58 );
@@ -589,27 +701,26 @@ getIdentity( fd_rpc_tile_t * ctx,
 static fd_http_server_response_t
 getInflationGovernor( fd_rpc_tile_t * ctx,
                      ulong           request_id,
-                     cJSON const *   params ) {
+                     ulong           params ) {
   (void)params;
 
   int commitment = FD_RPC_COMMITMENT_FINALIZED;
 
-  if( FD_UNLIKELY( params && cJSON_GetArraySize( params ) ) ) {
-    if( FD_UNLIKELY( cJSON_GetArraySize( params )>1 ) ) return (fd_http_server_response_t){ .status = 400 };
+  if( FD_UNLIKELY( params_cnt( ctx, params ) ) ) {
+    if( FD_UNLIKELY( params_cnt( ctx, params )>1UL ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    const cJSON * param = cJSON_GetArrayItem( params, 0 );
-    if( FD_UNLIKELY( !cJSON_IsObject( param ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    ulong config = params_get( ctx, params, 0UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    const cJSON * _commitment = cJSON_GetObjectItemCaseSensitive( param, "commitment" );
-    if( FD_UNLIKELY( _commitment && ( !cJSON_IsString( _commitment ) || _commitment->valuestring==NULL ) ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    if( FD_LIKELY( !strcmp( _commitment->valuestring, "processed" ) ) ) commitment = FD_RPC_COMMITMENT_PROCESSED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "confirmed" ) ) ) commitment = FD_RPC_COMMITMENT_CONFIRMED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "finalized" ) ) ) commitment = FD_RPC_COMMITMENT_FINALIZED;
-    else return (fd_http_server_response_t){ .status = 400 };
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return (fd_http_server_response_t){ .status = 400 };
   }
 
   if( FD_UNLIKELY( commitment!=FD_RPC_COMMITMENT_PROCESSED ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  fd_http_server_response_t response;
+  ulong cache_key = FD_RPC_CACHE_KEY( FD_RPC_METHOD_GET_INFLATION_GOVERNOR, commitment );
+  if( FD_LIKELY( cache_serve( ctx, cache_key, request_id, &response ) ) ) return response;
+
   bank_info_t const * bank = &ctx->banks[ ctx->processed_idx ];
 
   jsonp_open_envelope( ctx->http );
@@ -618,9 +729,9 @@ getInflationGovernor( fd_rpc_tile_t * ctx,
     jsonp_double( ctx->http, "initial",         bank->inflation.initial );
     jsonp_double( ctx->http, "taper",           bank->inflation.taper );
     jsonp_double( ctx->http, "terminal",        bank->inflation.terminal );
-  jsonp_close_envelope( ctx->http, request_id );
+  jsonp_close_envelope_cached( ctx, cache_key, request_id );
 
-  fd_http_server_response_t response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
+  response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
   FD_TEST( !fd_http_server_stage_body( ctx->http, &response ) );
   return response;
 }
@@ -632,29 +743,18 @@ UNIMPLEMENTED(getLargestAccounts)
 static fd_http_server_response_t
 getLatestBlockhash( fd_rpc_tile_t * ctx,
                     ulong           request_id,
-                    cJSON const *   params ) {
+                    ulong           params ) {
   int commitment = FD_RPC_COMMITMENT_FINALIZED;
   ulong minContextSlot = ULONG_MAX;
 
-  if( FD_UNLIKELY( params && cJSON_GetArraySize( params ) ) ) {
-    if( FD_UNLIKELY( cJSON_GetArraySize( params )>1 ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * param = cJSON_GetArrayItem( params, 0 );
-    if( FD_UNLIKELY( !cJSON_IsObject( param ) ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * _commitment = cJSON_GetObjectItemCaseSensitive( param, "commitment" );
-    if( FD_UNLIKELY( _commitment && ( !cJSON_IsString( _commitment ) || _commitment->valuestring==NULL ) ) ) return (fd_http_server_response_t){ .status = 400 };
+  if( FD_UNLIKELY( params_cnt( ctx, params ) ) ) {
+    if( FD_UNLIKELY( params_cnt( ctx, params )>1UL ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    if( FD_LIKELY( !strcmp( _commitment->valuestring, "processed" ) ) ) commitment = FD_RPC_COMMITMENT_PROCESSED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "confirmed" ) ) ) commitment = FD_RPC_COMMITMENT_CONFIRMED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "finalized" ) ) ) commitment = FD_RPC_COMMITMENT_FINALIZED;
-    else return (fd_http_server_response_t){ .status = 400 };
+    ulong config = params_get( ctx, params, 0UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    const cJSON * _minContextSlot = cJSON_GetObjectItemCaseSensitive( param, "minContextSlot" );
-    if( FD_UNLIKELY( _minContextSlot ) ) {
-      if( FD_UNLIKELY( !cJSON_IsNumber( _minContextSlot ) || _minContextSlot->valueulong==ULONG_MAX ) ) return (fd_http_server_response_t){ .status = 400 };
-      minContextSlot = _minContextSlot->valueulong;
-    }
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    if( FD_UNLIKELY( parse_min_context_slot( ctx, config, &minContextSlot ) ) ) return (fd_http_server_response_t){ .status = 400 };
   }
 
   if( FD_UNLIKELY( commitment!=FD_RPC_COMMITMENT_PROCESSED ) ) return (fd_http_server_response_t){ .status = 400 };
@@ -667,6 +767,12 @@ getLatestBlockhash( fd_rpc_tile_t * ctx,
     return response;
   }
 
+  /* minContextSlot only selects the error above, so it is not part of
+     the cache key */
+  fd_http_server_response_t response;
+  ulong cache_key = FD_RPC_CACHE_KEY( FD_RPC_METHOD_GET_LATEST_BLOCKHASH, commitment );
+  if( FD_LIKELY( cache_serve( ctx, cache_key, request_id, &response ) ) ) return response;
+
   FD_BASE58_ENCODE_32_BYTES( bank->block_hash, block_hash_b58 );
   jsonp_open_envelope( ctx->http );
     jsonp_open_object( ctx->http, "context" );
@@ -677,9 +783,9 @@ getLatestBlockhash( fd_rpc_tile_t * ctx,
       jsonp_string( ctx->http, "blockhash", block_hash_b58 );
       jsonp_ulong( ctx->http, "lastValidBlockHeight", 0UL /* TODO: Implement */ );
     jsonp_close_object( ctx->http );
-  jsonp_close_envelope( ctx->http, request_id );
+  jsonp_close_envelope_cached( ctx, cache_key, request_id );
 
-  fd_http_server_response_t response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
+  response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
   FD_TEST( !fd_http_server_stage_body( ctx->http, &response ) );
   return response;
 }
@@ -691,27 +797,19 @@ UNIMPLEMENTED(getMaxShredInsertSlot)
 static fd_http_server_response_t
 getMinimumBalanceForRentExemption( fd_rpc_tile_t * ctx,
                                    ulong           request_id,
-                                   cJSON const *   params ) {
+                                   ulong           params ) {
   int commitment = FD_RPC_COMMITMENT_FINALIZED;
 
-  if( FD_UNLIKELY( cJSON_GetArraySize( params )>2 || !cJSON_GetArraySize( params ) ) ) return (fd_http_server_response_t){ .status = 400 };
+  if( FD_UNLIKELY( params_cnt( ctx, params )>2UL || !params_cnt( ctx, params ) ) ) return (fd_http_server_response_t){ .status = 400 };
 
-  const cJSON * data_len = cJSON_GetArrayItem( params, 0 );
-  if( FD_UNLIKELY( !cJSON_IsNumber( data_len ) ) ) return (fd_http_server_response_t){ .status = 400 };
+  ulong data_len;
+  if( FD_UNLIKELY( !fd_rpc_json_ulong( ctx->tok, ctx->body, params_get( ctx, params, 0UL ), &data_len ) ) ) return (fd_http_server_response_t){ .status = 400 };
 
-  if( FD_UNLIKELY( cJSON_GetArraySize( params )==2 ) ) {
-    const cJSON * config = cJSON_GetArrayItem( params, 1 );
-    if( FD_UNLIKELY( !cJSON_IsObject( config ) ) ) return (fd_http_server_response_t){ .status = 400 };
+  if( FD_UNLIKELY( params_cnt( ctx, params )==2UL ) ) {
+    ulong config = params_get( ctx, params, 1UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    const cJSON * _commitment = cJSON_GetObjectItemCaseSensitive( config, "commitment" );
-    if( FD_UNLIKELY( _commitment && ( !cJSON_IsString( _commitment ) || _commitment->valuestring==NULL ) ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    if( FD_UNLIKELY( _commitment ) ) {
-      if( FD_LIKELY( !strcmp( _commitment->valuestring, "processed" ) ) ) commitment = FD_RPC_COMMITMENT_PROCESSED;
-      else if( FD_LIKELY( !strcmp( _commitment->valuestring, "confirmed" ) ) ) commitment = FD_RPC_COMMITMENT_CONFIRMED;
-      else if( FD_LIKELY( !strcmp( _commitment->valuestring, "finalized" ) ) ) commitment = FD_RPC_COMMITMENT_FINALIZED;
-      else return (fd_http_server_response_t){ .status = 400 };
-    }
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return (fd_http_server_response_t){ .status = 400 };
   }
 
   if( FD_UNLIKELY( commitment!=FD_RPC_COMMITMENT_PROCESSED ) ) return (fd_http_server_response_t){ .status = 400 };
@@ -722,7 +820,7 @@ getMinimumBalanceForRentExemption( fd_rpc_tile_t * ctx,
     .exemption_threshold = bank->rent.exemption_threshold,
     .burn_percent = bank->rent.burn_percent,
   };
-  ulong minimum = fd_rent_exempt_minimum_balance( &rent, data_len->valueulong );
+  ulong minimum = fd_rent_exempt_minimum_balance( &rent, data_len );
 
   fd_http_server_printf( ctx->http, "{\"jsonrpc\":\"2.0\",\"result\":%lu,\"id\":%lu}\n", minimum, request_id );
   fd_http_server_response_t response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
@@ -735,34 +833,197 @@ UNIMPLEMENTED(getProgramAccounts)
 UNIMPLEMENTED(getRecentPerformanceSamples)
 UNIMPLEMENTED(getRecentPrioritizationFees)
 UNIMPLEMENTED(getSignaturesForAddress)
-UNIMPLEMENTED(getSignatureStatuses)
+
+/* Names of Agave TransactionError and InstructionError variants, in
+   declaration order.  FD_RUNTIME_TXN_ERR_* and FD_EXECUTOR_INSTR_ERR_*
+   codes are the negated variant index plus one. */
+
+static char const * const txn_err_names[] = {
+  "AccountInUse", "AccountLoadedTwice", "AccountNotFound", "ProgramAccountNotFound",
+  "InsufficientFundsForFee", "InvalidAccountForFee", "AlreadyProcessed", "BlockhashNotFound",
+  "InstructionError", "CallChainTooDeep", "MissingSignatureForFee", "InvalidAccountIndex",
+  "SignatureFailure", "InvalidProgramForExecution", "SanitizeFailure", "ClusterMaintenance",
+  "AccountBorrowOutstanding", "WouldExceedMaxBlockCostLimit", "UnsupportedVersion", "InvalidWritableAccount",
+  "WouldExceedMaxAccountCostLimit", "WouldExceedAccountDataBlockLimit", "TooManyAccountLocks", "AddressLookupTableNotFound",
+  "InvalidAddressLookupTableOwner", "InvalidAddressLookupTableData", "InvalidAddressLookupTableIndex", "InvalidRentPayingAccount",
+  "WouldExceedMaxVoteCostLimit", "WouldExceedAccountDataTotalLimit", "DuplicateInstruction", "InsufficientFundsForRent",
+  "MaxLoadedAccountsDataSizeExceeded", "InvalidLoadedAccountsDataSizeLimit", "ResanitizationNeeded", "ProgramExecutionTemporarilyRestricted",
+  "UnbalancedTransaction", "ProgramCacheHitMaxLimit", "CommitCancelled", "BundlePeer",
+};
+
+static char const * const instr_err_names[] = {
+  "GenericError", "InvalidArgument", "InvalidInstructionData", "InvalidAccountData",
+  "AccountDataTooSmall", "InsufficientFunds", "IncorrectProgramId", "MissingRequiredSignature",
+  "AccountAlreadyInitialized", "UninitializedAccount", "UnbalancedInstruction", "ModifiedProgramId",
+  "ExternalAccountLamportSpend", "ExternalAccountDataModified", "ReadonlyLamportChange", "ReadonlyDataModified",
+  "DuplicateAccountIndex", "ExecutableModified", "RentEpochModified", "NotEnoughAccountKeys",
+  "AccountDataSizeChanged", "AccountNotExecutable", "AccountBorrowFailed", "AccountBorrowOutstanding",
+  "DuplicateAccountOutOfSync", "Custom", "InvalidError", "ExecutableDataModified",
+  "ExecutableLamportChange", "ExecutableAccountNotRentExempt", "UnsupportedProgramId", "CallDepth",
+  "MissingAccount", "ReentrancyNotAllowed", "MaxSeedLengthExceeded", "InvalidSeeds",
+  "InvalidRealloc", "ComputationalBudgetExceeded", "PrivilegeEscalation", "ProgramEnvironmentSetupFailure",
+  "ProgramFailedToComplete", "ProgramFailedToCompile", "Immutable", "IncorrectAuthority",
+  "BorshIoError", "AccountNotRentExempt", "InvalidAccountOwner", "ArithmeticOverflow",
+  "UnsupportedSysvar", "IllegalOwner", "MaxAccountsDataAllocationsExceeded", "MaxAccountsExceeded",
+  "MaxInstructionTraceLengthExceeded", "BuiltinProgramsMustConsumeComputeUnits",
+};
+
+/* txn_err_json writes the transaction error of res to out as JSON, the
+   way Agave serializes a TransactionError, or null on success.  Returns
+   the length written, which is less than FD_RPC_PUBSUB_SIG_ERR_MAX. */
+
+static ulong
+txn_err_json( char                          out[ static FD_RPC_PUBSUB_SIG_ERR_MAX ],
+              fd_sigstatus_result_t const * res ) {
+  ulong len = 0UL;
+
+  int txn_err = res->txn_err;
+  if( FD_LIKELY( !txn_err ) ) {
+    FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "null" ) );
+    return len;
+  }
+
+  /* Firedancer specific blockhash errors are all BlockhashNotFound. */
+  if( FD_UNLIKELY( txn_err<=FD_RUNTIME_TXN_ERR_BLOCKHASH_NONCE_ALREADY_ADVANCED ) ) txn_err = FD_RUNTIME_TXN_ERR_BLOCKHASH_NOT_FOUND;
+
+  ulong txn_err_idx = (ulong)(-txn_err-1);
+  if( FD_UNLIKELY( txn_err>0 || txn_err_idx>=sizeof(txn_err_names)/sizeof(txn_err_names[0]) ) ) {
+    FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "\"Unknown\"" ) );
+    return len;
+  }
+
+  switch( txn_err ) {
+    case FD_RUNTIME_TXN_ERR_INSTRUCTION_ERROR: {
+      ulong instr_err_idx = (ulong)(-res->instr_err-1);
+      if( FD_UNLIKELY( res->instr_err==FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR ) ) {
+        FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "{\"InstructionError\":[%u,{\"Custom\":%u}]}", res->instr_idx, res->custom_err ) );
+      } else if( FD_LIKELY( res->instr_err<0 && instr_err_idx<sizeof(instr_err_names)/sizeof(instr_err_names[0]) ) ) {
+        FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "{\"InstructionError\":[%u,\"%s\"]}", res->instr_idx, instr_err_names[ instr_err_idx ] ) );
+      } else {
+        FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "{\"InstructionError\":[%u,\"InvalidError\"]}", res->instr_idx ) );
+      }
+      break;
+    }
+    case FD_RUNTIME_TXN_ERR_DUPLICATE_INSTRUCTION:
+      FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "{\"%s\":%u}", txn_err_names[ txn_err_idx ], res->instr_idx ) );
+      break;
+    case FD_RUNTIME_TXN_ERR_INSUFFICIENT_FUNDS_FOR_RENT:
+    case FD_RUNTIME_TXN_ERR_PROGRAM_EXECUTION_TEMPORARILY_RESTRICTED:
+      FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "{\"%s\":{\"account_index\":%u}}", txn_err_names[ txn_err_idx ], res->instr_idx ) );
+      break;
+    default:
+      FD_TEST( fd_cstr_printf_check( out, FD_RPC_PUBSUB_SIG_ERR_MAX, &len, "\"%s\"", txn_err_names[ txn_err_idx ] ) );
+      break;
+  }
+  return len;
+}
+
+static void
+jsonp_txn_err( fd_http_server_t *            http,
+               char const *                  key,
+               fd_sigstatus_result_t const * res ) {
+  if( FD_LIKELY( key ) ) fd_http_server_printf( http, "\"%s\":", key );
+
+  char  err[ FD_RPC_PUBSUB_SIG_ERR_MAX ];
+  ulong err_sz = txn_err_json( err, res );
+  fd_http_server_memcpy( http, (uchar const *)err, err_sz );
+  fd_http_server_printf( http, "," );
+}
+
+static fd_http_server_response_t
+getSignatureStatuses( fd_rpc_tile_t * ctx,
+                      ulong           request_id,
+                      ulong           params ) {
+  if( FD_UNLIKELY( params_cnt( ctx, params )<1UL || params_cnt( ctx, params )>2UL ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  ulong sigs_arr = params_get( ctx, params, 0UL );
+  if( FD_UNLIKELY( ctx->tok[ sigs_arr ].type!=FD_RPC_JSON_TYPE_ARRAY ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  ulong sig_cnt = ctx->tok[ sigs_arr ].cnt;
+  if( FD_UNLIKELY( sig_cnt>FD_SIGSTATUS_QUERY_MAX ) ) {
+    fd_http_server_printf( ctx->http, "{\"jsonrpc\":\"2.0\",\"error\":{\"code\":-32602,\"message\":\"Too many inputs provided; max %lu\"},\"id\":%lu}\n", FD_SIGSTATUS_QUERY_MAX, request_id );
+    fd_http_server_response_t response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
+    FD_TEST( !fd_http_server_stage_body( ctx->http, &response ) );
+    return response;
+  }
+
+  if( FD_UNLIKELY( params_cnt( ctx, params )==2UL ) ) {
+    ulong config = params_get( ctx, params, 1UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
+
+    /* Only the retained window of recent slots is searched, regardless
+       of searchTransactionHistory. */
+    ulong search = CONFIG_GET( ctx, config, "searchTransactionHistory" );
+    if( FD_UNLIKELY( search!=FD_RPC_JSON_IDX_NULL &&
+                     ctx->tok[ search ].type!=FD_RPC_JSON_TYPE_TRUE &&
+                     ctx->tok[ search ].type!=FD_RPC_JSON_TYPE_FALSE ) ) return (fd_http_server_response_t){ .status = 400 };
+  }
+
+  uchar         sig_mem[ FD_SIGSTATUS_QUERY_MAX ][ 64 ];
+  uchar const * sigs   [ FD_SIGSTATUS_QUERY_MAX ];
+  for( ulong i=0UL; i<sig_cnt; i++ ) {
+    fd_rpc_json_tok_t const * tok = &ctx->tok[ params_get( ctx, sigs_arr, i ) ];
+    if( FD_UNLIKELY( tok->type!=FD_RPC_JSON_TYPE_STRING || tok->flags || tok->len>=FD_BASE58_ENCODED_64_SZ ) ) return (fd_http_server_response_t){ .status = 400 };
+
+    char sig_b58[ FD_BASE58_ENCODED_64_SZ ];
+    fd_memcpy( sig_b58, ctx->body+tok->off, tok->len );
+    sig_b58[ tok->len ] = '\0';
+    if( FD_UNLIKELY( !fd_base58_decode_64( sig_b58, sig_mem[ i ] ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    sigs[ i ] = sig_mem[ i ];
+  }
+
+  fd_sigstatus_result_t res[ FD_SIGSTATUS_QUERY_MAX ];
+  fd_sigstatus_query_batch( ctx->sigstatus, sigs, sig_cnt, res );
+
+  ulong context_slot = ctx->processed_idx!=ULONG_MAX ? ctx->banks[ ctx->processed_idx ].slot : 0UL;
+  jsonp_open_envelope( ctx->http );
+    jsonp_open_object( ctx->http, "context" );
+      jsonp_ulong( ctx->http, "slot", context_slot );
+    jsonp_close_object( ctx->http );
+
+    jsonp_open_array( ctx->http, "value" );
+    for( ulong i=0UL; i<sig_cnt; i++ ) {
+      if( FD_UNLIKELY( res[ i ].status==FD_SIGSTATUS_STATUS_NONE ) ) {
+        jsonp_null( ctx->http, NULL );
+        continue;
+      }
+
+      int finalized = res[ i ].status==FD_SIGSTATUS_STATUS_FINALIZED;
+      jsonp_open_object( ctx->http, NULL );
+        jsonp_ulong( ctx->http, "slot", res[ i ].slot );
+        if( FD_LIKELY( finalized ) ) jsonp_null( ctx->http, "confirmations" );
+        else                         jsonp_ulong( ctx->http, "confirmations", 0UL );
+        jsonp_txn_err( ctx->http, "err", &res[ i ] );
+        jsonp_open_object( ctx->http, "status" );
+          if( FD_LIKELY( !res[ i ].txn_err ) ) jsonp_null( ctx->http, "Ok" );
+          else                                 jsonp_txn_err( ctx->http, "Err", &res[ i ] );
+        jsonp_close_object( ctx->http );
+        jsonp_string( ctx->http, "confirmationStatus", finalized ? "finalized" : "processed" );
+      jsonp_close_object( ctx->http );
+    }
+    jsonp_close_array( ctx->http );
+  jsonp_close_envelope( ctx->http, request_id );
+
+  fd_http_server_response_t response = (fd_http_server_response_t){ .content_type = "application/json", .status = 200, .upgrade_websocket = 0 };
+  FD_TEST( !fd_http_server_stage_body( ctx->http, &response ) );
+  return response;
+}
 
 static fd_http_server_response_t
 getSlot( fd_rpc_tile_t * ctx,
          ulong           request_id,
-         cJSON const *   params ) {
+         ulong           params ) {
   int commitment = FD_RPC_COMMITMENT_FINALIZED;
   ulong minContextSlot = ULONG_MAX;
 
-  if( FD_UNLIKELY( params && cJSON_GetArraySize( params ) ) ) {
-    if( FD_UNLIKELY( cJSON_GetArraySize( params )>1 ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * param = cJSON_GetArrayItem( params, 0 );
-    if( FD_UNLIKELY( !cJSON_IsObject( param ) ) ) return (fd_http_server_response_t){ .status = 400 };
+  if( FD_UNLIKELY( params_cnt( ctx, params ) ) ) {
+    if( FD_UNLIKELY( params_cnt( ctx, params )>1UL ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    const cJSON * _commitment = cJSON_GetObjectItemCaseSensitive( param, "commitment" );
-    if( FD_UNLIKELY( _commitment && ( !cJSON_IsString( _commitment ) || _commitment->valuestring==NULL ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    ulong config = params_get( ctx, params, 0UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    if( FD_LIKELY( !strcmp( _commitment->valuestring, "processed" ) ) ) commitment = FD_RPC_COMMITMENT_PROCESSED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "confirmed" ) ) ) commitment = FD_RPC_COMMITMENT_CONFIRMED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "finalized" ) ) ) commitment = FD_RPC_COMMITMENT_FINALIZED;
-    else return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * _minContextSlot = cJSON_GetObjectItemCaseSensitive( param, "minContextSlot" );
-    if( FD_UNLIKELY( _minContextSlot ) ) {
-      if( FD_UNLIKELY( !cJSON_IsNumber( _minContextSlot ) || _minContextSlot->valueulong==ULONG_MAX ) ) return (fd_http_server_response_t){ .status = 400 };
-      minContextSlot = _minContextSlot->valueulong;
-    }
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    if( FD_UNLIKELY( parse_min_context_slot( ctx, config, &minContextSlot ) ) ) return (fd_http_server_response_t){ .status = 400 };
   }
 
   if( FD_UNLIKELY( commitment!=FD_RPC_COMMITMENT_PROCESSED ) ) return (fd_http_server_response_t){ .status = 400 };
@@ -795,29 +1056,18 @@ UNIMPLEMENTED(getTransaction)
 static fd_http_server_response_t
 getTransactionCount( fd_rpc_tile_t * ctx,
                      ulong           request_id,
-                     cJSON const *   params ) {
+                     ulong           params ) {
   int commitment = FD_RPC_COMMITMENT_FINALIZED;
   ulong minContextSlot = ULONG_MAX;
 
-  if( FD_UNLIKELY( params && cJSON_GetArraySize( params ) ) ) {
-    if( FD_UNLIKELY( cJSON_GetArraySize( params )>1 ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * param = cJSON_GetArrayItem( params, 0 );
-    if( FD_UNLIKELY( !cJSON_IsObject( param ) ) ) return (fd_http_server_response_t){ .status = 400 };
-
-    const cJSON * _commitment = cJSON_GetObjectItemCaseSensitive( param, "commitment" );
-    if( FD_UNLIKELY( _commitment && ( !cJSON_IsString( _commitment ) || _commitment->valuestring==NULL ) ) ) return (fd_http_server_response_t){ .status = 400 };
+  if( FD_UNLIKELY( params_cnt( ctx, params ) ) ) {
+    if( FD_UNLIKELY( params_cnt( ctx, params )>1UL ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    if( FD_LIKELY( !strcmp( _commitment->valuestring, "processed" ) ) ) commitment = FD_RPC_COMMITMENT_PROCESSED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "confirmed" ) ) ) commitment = FD_RPC_COMMITMENT_CONFIRMED;
-    else if( FD_LIKELY( !strcmp( _commitment->valuestring, "finalized" ) ) ) commitment = FD_RPC_COMMITMENT_FINALIZED;
-    else return (fd_http_server_response_t){ .status = 400 };
+    ulong config = params_get( ctx, params, 0UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
 
-    const cJSON * _minContextSlot = cJSON_GetObjectItemCaseSensitive( param, "minContextSlot" );
-    if( FD_UNLIKELY( _minContextSlot ) ) {
-      if( FD_UNLIKELY( !cJSON_IsNumber( _minContextSlot ) || _minContextSlot->valueulong==ULONG_MAX ) ) return (fd_http_server_response_t){ .status = 400 };
-      minContextSlot = _minContextSlot->valueulong;
-    }
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return (fd_http_server_response_t){ .status = 400 };
+    if( FD_UNLIKELY( parse_min_context_slot( ctx, config, &minContextSlot ) ) ) return (fd_http_server_response_t){ .status = 400 };
   }
 
   if( FD_UNLIKELY( commitment!=FD_RPC_COMMITMENT_PROCESSED ) ) return (fd_http_server_response_t){ .status = 400 };
@@ -839,7 +1089,7 @@ getTransactionCount( fd_rpc_tile_t * ctx,
 static fd_http_server_response_t
 getVersion( fd_rpc_tile_t * ctx,
             ulong           request_id,
-            cJSON const *   params ) {
+            ulong           params ) {
   (void)params;
 
   fd_http_server_printf( ctx->http, "{\"jsonrpc\":\"2.0\",\"result\":{\"solana-core\":\"%s\",\"feature-set\":%u},\"id\":%lu}\n", ctx->version_string, FD_FEATURE_SET_ID, request_id );
@@ -855,97 +1105,465 @@ UNIMPLEMENTED(requestAirdrop)
 UNIMPLEMENTED(sendTransaction)
 UNIMPLEMENTED(simulateTransaction)
 
+typedef fd_http_server_response_t (* fd_rpc_method_fn_t)( fd_rpc_tile_t * ctx, ulong request_id, ulong params );
+
+static fd_rpc_method_fn_t const fd_rpc_method_fn[ FD_RPC_METHOD_CNT ] = {
+  [ FD_RPC_METHOD_GET_ACCOUNT_INFO                       ] = getAccountInfo,
+  [ FD_RPC_METHOD_GET_BALANCE                            ] = getBalance,
+  [ FD_RPC_METHOD_GET_BLOCK                              ] = getBlock,
+  [ FD_RPC_METHOD_GET_BLOCK_COMMITMENT                   ] = getBlockCommitment,
+  [ FD_RPC_METHOD_GET_BLOCK_HEIGHT                       ] = getBlockHeight,
+  [ FD_RPC_METHOD_GET_BLOCK_PRODUCTION                   ] = getBlockProduction,
+  [ FD_RPC_METHOD_GET_BLOCKS                             ] = getBlocks,
+  [ FD_RPC_METHOD_GET_BLOCKS_WITH_LIMIT                  ] = getBlocksWithLimit,
+  [ FD_RPC_METHOD_GET_BLOCK_TIME                         ] = getBlockTime,
+  [ FD_RPC_METHOD_GET_CLUSTER_NODES                      ] = getClusterNodes,
+  [ FD_RPC_METHOD_GET_EPOCH_INFO                         ] = getEpochInfo,
+  [ FD_RPC_METHOD_GET_EPOCH_SCHEDULE                     ] = getEpochSchedule,
+  [ FD_RPC_METHOD_GET_FEE_FOR_MESSAGE                    ] = getFeeForMessage,
+  [ FD_RPC_METHOD_GET_FIRST_AVAILABLE_BLOCK              ] = getFirstAvailableBlock,
+  [ FD_RPC_METHOD_GET_GENESIS_HASH                       ] = getGenesisHash,
+  [ FD_RPC_METHOD_GET_HEALTH                             ] = getHealth,
+  [ FD_RPC_METHOD_GET_HIGHEST_SNAPSHOT_SLOT              ] = getHighestSnapshotSlot,
+  [ FD_RPC_METHOD_GET_IDENTITY                           ] = getIdentity,
+  [ FD_RPC_METHOD_GET_INFLATION_GOVERNOR                 ] = getInflationGovernor,
+  [ FD_RPC_METHOD_GET_INFLATION_RATE                     ] = getInflationRate,
+  [ FD_RPC_METHOD_GET_INFLATION_REWARD                   ] = getInflationReward,
+  [ FD_RPC_METHOD_GET_LARGEST_ACCOUNTS                   ] = getLargestAccounts,
+  [ FD_RPC_METHOD_GET_LATEST_BLOCKHASH                   ] = getLatestBlockhash,
+  [ FD_RPC_METHOD_GET_LEADER_SCHEDULE                    ] = getLeaderSchedule,
+  [ FD_RPC_METHOD_GET_MAX_RETRANSMIT_SLOT                ] = getMaxRetransmitSlot,
+  [ FD_RPC_METHOD_GET_MAX_SHRED_INSERT_SLOT              ] = getMaxShredInsertSlot,
+  [ FD_RPC_METHOD_GET_MINIMUM_BALANCE_FOR_RENT_EXEMPTION ] = getMinimumBalanceForRentExemption,
+  [ FD_RPC_METHOD_GET_MULTIPLE_ACCOUNTS                  ] = getMultipleAccounts,
+  [ FD_RPC_METHOD_GET_PROGRAM_ACCOUNTS                   ] = getProgramAccounts,
+  [ FD_RPC_METHOD_GET_RECENT_PERFORMANCE_SAMPLES         ] = getRecentPerformanceSamples,
+  [ FD_RPC_METHOD_GET_RECENT_PRIORITIZATION_FEES         ] = getRecentPrioritizationFees,
+  [ FD_RPC_METHOD_GET_SIGNATURES_FOR_ADDRESS             ] = getSignaturesForAddress,
+  [ FD_RPC_METHOD_GET_SIGNATURE_STATUSES                 ] = getSignatureStatuses,
+  [ FD_RPC_METHOD_GET_SLOT                               ] = getSlot,
+  [ FD_RPC_METHOD_GET_SLOT_LEADER                        ] = getSlotLeader,
+  [ FD_RPC_METHOD_GET_SLOT_LEADERS                       ] = getSlotLeaders,
+  [ FD_RPC_METHOD_GET_STAKE_MINIMUM_DELEGATION           ] = getStakeMinimumDelegation,
+  [ FD_RPC_METHOD_GET_SUPPLY                             ] = getSupply,
+  [ FD_RPC_METHOD_GET_TOKEN_ACCOUNT_BALANCE              ] = getTokenAccountBalance,
+  [ FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_DELEGATE         ] = getTokenAccountsByDelegate,
+  [ FD_RPC_METHOD_GET_TOKEN_ACCOUNTS_BY_OWNER            ] = getTokenAccountsByOwner,
+  [ FD_RPC_METHOD_GET_TOKEN_LARGEST_ACCOUNTS             ] = getTokenLargestAccounts,
+  [ FD_RPC_METHOD_GET_TOKEN_SUPPLY                       ] = getTokenSupply,
+  [ FD_RPC_METHOD_GET_TRANSACTION                        ] = getTransaction,
+  [ FD_RPC_METHOD_GET_TRANSACTION_COUNT                  ] = getTransactionCount,
+  [ FD_RPC_METHOD_GET_VERSION                            ] = getVersion,
+  [ FD_RPC_METHOD_GET_VOTE_ACCOUNTS                      ] = getVoteAccounts,
+  [ FD_RPC_METHOD_IS_BLOCKHASH_VALID                     ] = isBlockhashValid,
+  [ FD_RPC_METHOD_MINIMUM_LEDGER_SLOT                    ] = minimumLedgerSlot,
+  [ FD_RPC_METHOD_REQUEST_AIRDROP                        ] = requestAirdrop,
+  [ FD_RPC_METHOD_SEND_TRANSACTION                       ] = sendTransaction,
+  [ FD_RPC_METHOD_SIMULATE_TRANSACTION                   ] = simulateTransaction,
+};
+
+/* envelope_fields picks the envelope fields out of the top-level
+   object of the parsed request in a single pass over its members.  As
+   with cJSON, the first occurrence of a duplicated key wins.  Absent
+   fields are FD_RPC_JSON_IDX_NULL. */
+
+static void
+envelope_fields( fd_rpc_tile_t const * ctx,
+                 ulong *               jsonrpc,
+                 ulong *               id,
+                 ulong *               method,
+                 ulong *               params ) {
+  fd_rpc_json_tok_t const * tok = ctx->tok;
+
+  *jsonrpc = FD_RPC_JSON_IDX_NULL;
+  *id      = FD_RPC_JSON_IDX_NULL;
+  *method  = FD_RPC_JSON_IDX_NULL;
+  *params  = FD_RPC_JSON_IDX_NULL;
+
+  ulong k = 1UL;
+  for( ulong i=0UL; i<tok[ 0 ].cnt; i++ ) {
+    ulong v = k+1UL;
+    if(      STR_EQ( ctx, k, "jsonrpc" ) ) *jsonrpc = fd_ulong_if( *jsonrpc==FD_RPC_JSON_IDX_NULL, v, *jsonrpc );
+    else if( STR_EQ( ctx, k, "id"      ) ) *id      = fd_ulong_if( *id     ==FD_RPC_JSON_IDX_NULL, v, *id      );
+    else if( STR_EQ( ctx, k, "method"  ) ) *method  = fd_ulong_if( *method ==FD_RPC_JSON_IDX_NULL, v, *method  );
+    else if( STR_EQ( ctx, k, "params"  ) ) *params  = fd_ulong_if( *params ==FD_RPC_JSON_IDX_NULL, v, *params  );
+    k = tok[ v ].next;
+  }
+}
+
 static fd_http_server_response_t
 rpc_http_request( fd_http_server_request_t const * request ) {
   fd_rpc_tile_t * ctx = (fd_rpc_tile_t *)request->ctx;
 
+  /* Subscriptions are served over WebSocket on the same port, see
+     rpc_ws_message. */
+  if( FD_UNLIKELY( request->method==FD_HTTP_SERVER_METHOD_GET && request->headers.upgrade_websocket ) ) {
+    return (fd_http_server_response_t){
+      .status            = 200,
+      .upgrade_websocket = 1,
+    };
+  }
+
   if( FD_UNLIKELY( request->method!=FD_HTTP_SERVER_METHOD_POST ) ) {
     return (fd_http_server_response_t){
       .status = 400,
     };
   }
 
-  const char * parse_end;
-  cJSON * json = cJSON_ParseWithLengthOpts( (char *)request->post.body, request->post.body_len, &parse_end, 0 );
-  if( FD_UNLIKELY( !json ) ) {
-    return (fd_http_server_response_t){ .status = 400 };
+  char const * body = (char const *)request->post.body;
+  ulong        sz   = request->post.body_len;
+  if( FD_UNLIKELY( sz>FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  fd_rpc_json_tok_t * tok = ctx->tok;
+  long tok_cnt = fd_rpc_json_parse( tok, fd_rpc_json_tok_max( FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN ), body, sz );
+  if( FD_UNLIKELY( tok_cnt<0L || tok[ 0 ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return (fd_http_server_response_t){ .status = 400 };
+  ctx->body = body;
+
+  ulong jsonrpc, id, method, params;
+  envelope_fields( ctx, &jsonrpc, &id, &method, &params );
+
+  if( FD_UNLIKELY( jsonrpc==FD_RPC_JSON_IDX_NULL || !STR_EQ( ctx, jsonrpc, "2.0" ) ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  ulong request_id;
+  if( FD_UNLIKELY( id==FD_RPC_JSON_IDX_NULL || !fd_rpc_json_ulong( tok, body, id, &request_id ) ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  if( FD_UNLIKELY( params!=FD_RPC_JSON_IDX_NULL && tok[ params ].type!=FD_RPC_JSON_TYPE_ARRAY ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  if( FD_UNLIKELY( method==FD_RPC_JSON_IDX_NULL || tok[ method ].type!=FD_RPC_JSON_TYPE_STRING || tok[ method ].flags ) ) return (fd_http_server_response_t){ .status = 400 };
+  int method_id = fd_rpc_method_query( body+tok[ method ].off, tok[ method ].len );
+  if( FD_UNLIKELY( method_id<0 ) ) return (fd_http_server_response_t){ .status = 400 };
+
+  return fd_rpc_method_fn[ method_id ]( ctx, request_id, params );
+}
+
+/* WebSocket subscriptions ********************************************/
+
+/* The pubsub sink sends notifications as WebSocket frames.  A
+   connection can take as many more frames as it has free send frame
+   slots, staging never blocks. */
+
+static ulong
+pubsub_room( ulong  conn,
+             void * _ctx ) {
+  fd_http_server_t * http = ((fd_rpc_tile_t *)_ctx)->http;
+  return http->max_ws_send_frame_cnt - http->ws_conns[ conn ].send_frame_cnt;
+}
+
+static void
+pubsub_send( ulong                       conn,
+             fd_rpc_pubsub_msg_t const * msg,
+             void *                      _ctx ) {
+  fd_http_server_t * http = ((fd_rpc_tile_t *)_ctx)->http;
+  for( ulong i=0UL; i<FD_RPC_PUBSUB_MSG_PART_CNT; i++ ) fd_http_server_memcpy( http, msg->part[ i ].data, msg->part[ i ].sz );
+  fd_http_server_ws_send( http, conn );
+}
+
+static void
+pubsub_close( ulong  conn,
+              void * _ctx ) {
+  fd_http_server_ws_close( ((fd_rpc_tile_t *)_ctx)->http, conn, FD_HTTP_SERVER_CONNECTION_CLOSE_WS_CLIENT_TOO_SLOW );
+}
+
+static fd_rpc_pubsub_sink_t const pubsub_sink = {
+  .room  = pubsub_room,
+  .send  = pubsub_send,
+  .close = pubsub_close,
+};
+
+FD_STATIC_ASSERT( FD_SIGSTATUS_STATUS_PROCESSED==FD_RPC_PUBSUB_COMMITMENT_PROCESSED, pubsub );
+FD_STATIC_ASSERT( FD_SIGSTATUS_STATUS_FINALIZED==FD_RPC_PUBSUB_COMMITMENT_FINALIZED, pubsub );
+
+/* pubsub_mod_slot returns the slot in which the account at pubkey was
+   last modified as of the bank xid, or FD_RPC_PUBSUB_SLOT_MISSING if it
+   does not exist. */
+
+static ulong
+pubsub_mod_slot( fd_rpc_tile_t *           ctx,
+                 fd_funk_txn_xid_t const * xid,
+                 fd_pubkey_t const *       pubkey ) {
+  for(;;) {
+    fd_accdb_peek_t _peek[1];
+    fd_accdb_peek_t * peek = fd_accdb_peek( ctx->accdb, _peek, xid, pubkey->uc );
+    if( FD_UNLIKELY( !peek ) ) return FD_RPC_PUBSUB_SLOT_MISSING;
+
+    ulong mod_slot = fd_accdb_ref_slot( peek->acc );
+    int   peek_ok  = fd_accdb_peek_test( peek );
+    fd_accdb_peek_drop( peek );
+    if( FD_LIKELY( peek_ok ) ) return mod_slot;
+    FD_SPIN_PAUSE();
   }
+}
 
-  const cJSON * jsonrpc = cJSON_GetObjectItemCaseSensitive( json, "jsonrpc" );
-  if( FD_UNLIKELY( !cJSON_IsString( jsonrpc ) || strcmp( jsonrpc->valuestring, "2.0" ) ) ) goto bad_request;
+/* pubsub_publish_reset runs the account and signature notification
+   pass for a reset to the bank at bank_idx.  Each subscribed account
+   is looked up once, and only serialized if it changed or a subscriber
+   is owed a notification.  Signatures are queried in batches. */
 
-  const cJSON * id = cJSON_GetObjectItemCaseSensitive( json, "id" );
-  ulong request_id = 0UL;
-  if( FD_UNLIKELY( !cJSON_IsNumber( id ) ) ) goto bad_request;
-  request_id = id->valueulong;
+static void
+pubsub_publish_reset( fd_rpc_tile_t * ctx,
+                      ulong           slot,
+                      ulong           bank_idx ) {
+  fd_rpc_pubsub_t * pubsub = ctx->pubsub;
+  fd_funk_txn_xid_t xid = { .ul = { slot, bank_idx } };
+
+  fd_rpc_pubsub_publish_begin( pubsub );
+
+  for( ulong idx=fd_rpc_pubsub_account_first( pubsub ); idx!=ULONG_MAX; idx=fd_rpc_pubsub_account_next( pubsub, idx ) ) {
+    fd_pubkey_t const * pubkey = fd_rpc_pubsub_account_pubkey( pubsub, idx );
+
+    ulong mod_slot = pubsub_mod_slot( ctx, &xid, pubkey );
+    if( FD_LIKELY( !fd_rpc_pubsub_account_stale( pubsub, idx, mod_slot ) ) ) continue;
+
+    for(;;) {
+      fd_accdb_peek_t _peek[1];
+      fd_accdb_peek_t * peek = fd_accdb_peek( ctx->accdb, _peek, &xid, pubkey->uc );
+      if( FD_UNLIKELY( !peek ) ) {
+        mod_slot = FD_RPC_PUBSUB_SLOT_MISSING;
+        fd_rpc_pubsub_account_stage( pubsub, slot, NULL );
+        break;
+      }
 
-  const cJSON * params = cJSON_GetObjectItemCaseSensitive( json, "params" );
-  if( FD_UNLIKELY( params && !cJSON_IsArray( params ) ) ) goto bad_request;
+      fd_rpc_pubsub_account_t acct = {
+        .data       = fd_accdb_ref_data_const( peek->acc ),
+        .data_sz    = fd_accdb_ref_data_sz   ( peek->acc ),
+        .lamports   = fd_accdb_ref_lamports  ( peek->acc ),
+        .owner      = fd_accdb_ref_owner     ( peek->acc ),
+        .executable = (int)fd_accdb_ref_exec_bit( peek->acc ),
+      };
+      mod_slot = fd_accdb_ref_slot( peek->acc );
+      fd_rpc_pubsub_account_stage( pubsub, slot, &acct );
+
+      int peek_ok = fd_accdb_peek_test( peek );
+      fd_accdb_peek_drop( peek );
+      if( FD_LIKELY( peek_ok ) ) break;
+      FD_SPIN_PAUSE();
+    }
+    fd_rpc_pubsub_account_publish( pubsub, idx, mod_slot );
+  }
 
-  fd_http_server_response_t response;
+  uchar const * sigs[ FD_SIGSTATUS_QUERY_MAX ];
+  ulong         idxs[ FD_SIGSTATUS_QUERY_MAX ];
+  ulong         sig_cnt = 0UL;
+  ulong         idx     = fd_rpc_pubsub_signature_first( pubsub );
+  while( idx!=ULONG_MAX || sig_cnt ) {
+    if( FD_LIKELY( idx!=ULONG_MAX ) ) {
+      sigs[ sig_cnt ] = fd_rpc_pubsub_signature_sig( pubsub, idx )->uc;
+      idxs[ sig_cnt ] = idx;
+      sig_cnt++;
+      idx = fd_rpc_pubsub_signature_next( pubsub, idx );
+      if( FD_LIKELY( idx!=ULONG_MAX && sig_cnt<FD_SIGSTATUS_QUERY_MAX ) ) continue;
+    }
 
-  const cJSON * _method = cJSON_GetObjectItemCaseSensitive( json, "method" );
-  if( FD_LIKELY( !cJSON_IsString( _method ) || _method->valuestring==NULL ) ) goto bad_request;
-  if( FD_LIKELY(      !strcmp( _method->valuestring, "getAccountInfo"                    ) ) ) response = getAccountInfo( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBalance"                        ) ) ) response = getBalance( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBlock"                          ) ) ) response = getBlock( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBlockCommitment"                ) ) ) response = getBlockCommitment( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBlockHeight"                    ) ) ) response = getBlockHeight( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBlockProduction"                ) ) ) response = getBlockProduction( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBlocks"                         ) ) ) response = getBlocks( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBlocksWithLimit"                ) ) ) response = getBlocksWithLimit( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getBlockTime"                      ) ) ) response = getBlockTime( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getClusterNodes"                   ) ) ) response = getClusterNodes( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getEpochInfo"                      ) ) ) response = getEpochInfo( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getEpochSchedule"                  ) ) ) response = getEpochSchedule( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getFeeForMessage"                  ) ) ) response = getFeeForMessage( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getFirstAvailableBlock"            ) ) ) response = getFirstAvailableBlock( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getGenesisHash"                    ) ) ) response = getGenesisHash( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getHealth"                         ) ) ) response = getHealth( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getHighestSnapshotSlot"            ) ) ) response = getHighestSnapshotSlot( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getIdentity"                       ) ) ) response = getIdentity( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getInflationGovernor"              ) ) ) response = getInflationGovernor( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getInflationRate"                  ) ) ) response = getInflationRate( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getInflationReward"                ) ) ) response = getInflationReward( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getLargestAccounts"                ) ) ) response = getLargestAccounts( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getLatestBlockhash"                ) ) ) response = getLatestBlockhash( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getLeaderSchedule"                 ) ) ) response = getLeaderSchedule( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getMaxRetransmitSlot"              ) ) ) response = getMaxRetransmitSlot( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getMaxShredInsertSlot"             ) ) ) response = getMaxShredInsertSlot( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getMinimumBalanceForRentExemption" ) ) ) response = getMinimumBalanceForRentExemption( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getMultipleAccounts"               ) ) ) response = getMultipleAccounts( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getProgramAccounts"                ) ) ) response = getProgramAccounts( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getRecentPerformanceSamples"       ) ) ) response = getRecentPerformanceSamples( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getRecentPrioritizationFees"       ) ) ) response = getRecentPrioritizationFees( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getSignaturesForAddress"           ) ) ) response = getSignaturesForAddress( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getSignatureStatuses"              ) ) ) response = getSignatureStatuses( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getSlot"                           ) ) ) response = getSlot( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getSlotLeader"                     ) ) ) response = getSlotLeader( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getSlotLeaders"                    ) ) ) response = getSlotLeaders( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getStakeMinimumDelegation"         ) ) ) response = getStakeMinimumDelegation( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getSupply"                         ) ) ) response = getSupply( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getTokenAccountBalance"            ) ) ) response = getTokenAccountBalance( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getTokenAccountsByDelegate"        ) ) ) response = getTokenAccountsByDelegate( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getTokenAccountsByOwner"           ) ) ) response = getTokenAccountsByOwner( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getTokenLargestAccounts"           ) ) ) response = getTokenLargestAccounts( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getTokenSupply"                    ) ) ) response = getTokenSupply( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getTransaction"                    ) ) ) response = getTransaction( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getTransactionCount"               ) ) ) response = getTransactionCount( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getVersion"                        ) ) ) response = getVersion( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "getVoteAccounts"                   ) ) ) response = getVoteAccounts( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "isBlockhashValid"                  ) ) ) response = isBlockhashValid( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "minimumLedgerSlot"                 ) ) ) response = minimumLedgerSlot( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "requestAirdrop"                    ) ) ) response = requestAirdrop( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "sendTransaction"                   ) ) ) response = sendTransaction( ctx, request_id, params );
-  else if( FD_LIKELY( !strcmp( _method->valuestring, "simulateTransaction"               ) ) ) response = simulateTransaction( ctx, request_id, params );
-  else goto bad_request;
-
-  cJSON_Delete( json );
-  return response;
+    fd_sigstatus_result_t res[ FD_SIGSTATUS_QUERY_MAX ];
+    fd_sigstatus_query_batch( ctx->sigstatus, sigs, sig_cnt, res );
+    for( ulong i=0UL; i<sig_cnt; i++ ) {
+      if( FD_LIKELY( res[ i ].status==FD_SIGSTATUS_STATUS_NONE ) ) continue;
+      char  err[ FD_RPC_PUBSUB_SIG_ERR_MAX ];
+      ulong err_sz = txn_err_json( err, &res[ i ] );
+      fd_rpc_pubsub_signature_publish( pubsub, idxs[ i ], res[ i ].slot, res[ i ].status, err, err_sz );
+    }
+    sig_cnt = 0UL;
+  }
+
+  fd_rpc_pubsub_publish_end( pubsub );
+}
 
-bad_request:
-  cJSON_Delete( json );
-  return (fd_http_server_response_t){ .status = 400 };
+/* ws_result and ws_error reply to a WebSocket request.  A request
+   without a usable id is answered with a null id. */
+
+static void
+ws_result( fd_rpc_tile_t * ctx,
+           ulong           ws_conn_id,
+           ulong           request_id,
+           char const *    result ) {
+  fd_http_server_printf( ctx->http, "{\"jsonrpc\":\"2.0\",\"result\":%s,\"id\":%lu}", result, request_id );
+  fd_http_server_ws_send( ctx->http, ws_conn_id );
+}
+
+static void
+ws_error( fd_rpc_tile_t * ctx,
+          ulong           ws_conn_id,
+          ulong const *   request_id,
+          long            code,
+          char const *    message ) {
+  fd_http_server_printf( ctx->http, "{\"jsonrpc\":\"2.0\",\"error\":{\"code\":%ld,\"message\":\"%s\"},\"id\":", code, message );
+  if( FD_LIKELY( request_id ) ) fd_http_server_printf( ctx->http, "%lu}", *request_id );
+  else                          fd_http_server_printf( ctx->http, "null}" );
+  fd_http_server_ws_send( ctx->http, ws_conn_id );
+}
+
+static void
+ws_subscribed( fd_rpc_tile_t * ctx,
+               ulong           ws_conn_id,
+               ulong           request_id,
+               ulong           sub_id ) {
+  if( FD_UNLIKELY( sub_id==ULONG_MAX ) ) {
+    ws_error( ctx, ws_conn_id, &request_id, -32603, "Subscription limit reached" );
+    return;
+  }
+  char result[ 21 ];
+  FD_TEST( fd_cstr_printf_check( result, sizeof(result), NULL, "%lu", sub_id ) );
+  ws_result( ctx, ws_conn_id, request_id, result );
+}
+
+/* The subscribe handlers return NULL on success, having replied, or
+   an error message for an invalid params reply. */
+
+static char const *
+accountSubscribe( fd_rpc_tile_t * ctx,
+                  ulong           ws_conn_id,
+                  ulong           request_id,
+                  ulong           params ) {
+  if( FD_UNLIKELY( params_cnt( ctx, params )<1UL || params_cnt( ctx, params )>2UL ) ) return "Invalid params";
+
+  fd_rpc_json_tok_t const * tok = &ctx->tok[ params_get( ctx, params, 0UL ) ];
+  if( FD_UNLIKELY( tok->type!=FD_RPC_JSON_TYPE_STRING || tok->flags || tok->len>=FD_BASE58_ENCODED_32_SZ ) ) return "Invalid pubkey";
+
+  char pubkey_b58[ FD_BASE58_ENCODED_32_SZ ];
+  fd_memcpy( pubkey_b58, ctx->body+tok->off, tok->len );
+  pubkey_b58[ tok->len ] = '\0';
+  fd_pubkey_t pubkey;
+  if( FD_UNLIKELY( !fd_base58_decode_32( pubkey_b58, pubkey.uc ) ) ) return "Invalid pubkey";
+
+  /* Notifications are only serialized once per account, so all
+     subscribers must agree on the encoding and commitment. */
+  int   commitment = FD_RPC_COMMITMENT_FINALIZED;
+  ulong encoding   = FD_RPC_JSON_IDX_NULL;
+  if( FD_LIKELY( params_cnt( ctx, params )==2UL ) ) {
+    ulong config = params_get( ctx, params, 1UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return "Invalid params";
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return "Invalid commitment";
+    encoding = CONFIG_GET( ctx, config, "encoding" );
+  }
+  if( FD_UNLIKELY( encoding==FD_RPC_JSON_IDX_NULL || !STR_EQ( ctx, encoding, "base64" ) ) ) return "Only base64 encoding is supported";
+  if( FD_UNLIKELY( commitment!=FD_RPC_COMMITMENT_PROCESSED ) ) return "Only processed commitment is supported";
+
+  ulong mod_slot = FD_RPC_PUBSUB_SLOT_UNKNOWN;
+  if( FD_LIKELY( ctx->processed_idx!=ULONG_MAX ) ) {
+    fd_funk_txn_xid_t xid = { .ul = { ctx->processed_slot, ctx->processed_idx } };
+    mod_slot = pubsub_mod_slot( ctx, &xid, &pubkey );
+  }
+
+  ws_subscribed( ctx, ws_conn_id, request_id, fd_rpc_pubsub_account_subscribe( ctx->pubsub, ws_conn_id, &pubkey, mod_slot ) );
+  return NULL;
+}
+
+static char const *
+slotSubscribe( fd_rpc_tile_t * ctx,
+               ulong           ws_conn_id,
+               ulong           request_id,
+               ulong           params ) {
+  if( FD_UNLIKELY( params_cnt( ctx, params ) ) ) return "Invalid params";
+
+  ws_subscribed( ctx, ws_conn_id, request_id, fd_rpc_pubsub_slot_subscribe( ctx->pubsub, ws_conn_id ) );
+  return NULL;
+}
+
+static char const *
+signatureSubscribe( fd_rpc_tile_t * ctx,
+                    ulong           ws_conn_id,
+                    ulong           request_id,
+                    ulong           params ) {
+  if( FD_UNLIKELY( params_cnt( ctx, params )<1UL || params_cnt( ctx, params )>2UL ) ) return "Invalid params";
+
+  fd_rpc_json_tok_t const * tok = &ctx->tok[ params_get( ctx, params, 0UL ) ];
+  if( FD_UNLIKELY( tok->type!=FD_RPC_JSON_TYPE_STRING || tok->flags || tok->len>=FD_BASE58_ENCODED_64_SZ ) ) return "Invalid signature";
+
+  char sig_b58[ FD_BASE58_ENCODED_64_SZ ];
+  fd_memcpy( sig_b58, ctx->body+tok->off, tok->len );
+  sig_b58[ tok->len ] = '\0';
+  fd_signature_t sig;
+  if( FD_UNLIKELY( !fd_base58_decode_64( sig_b58, sig.uc ) ) ) return "Invalid signature";
+
+  int commitment = FD_RPC_COMMITMENT_FINALIZED;
+  if( FD_LIKELY( params_cnt( ctx, params )==2UL ) ) {
+    ulong config = params_get( ctx, params, 1UL );
+    if( FD_UNLIKELY( ctx->tok[ config ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) return "Invalid params";
+    if( FD_UNLIKELY( parse_commitment( ctx, config, &commitment ) ) ) return "Invalid commitment";
+
+    ulong received = CONFIG_GET( ctx, config, "enableReceivedNotification" );
+    if( FD_UNLIKELY( received!=FD_RPC_JSON_IDX_NULL && ctx->tok[ received ].type!=FD_RPC_JSON_TYPE_FALSE ) ) return "Received notifications are not supported";
+  }
+
+  int level;
+  switch( commitment ) {
+    case FD_RPC_COMMITMENT_PROCESSED: level = FD_RPC_PUBSUB_COMMITMENT_PROCESSED; break;
+    case FD_RPC_COMMITMENT_FINALIZED: level = FD_RPC_PUBSUB_COMMITMENT_FINALIZED; break;
+    default: return "Only processed and finalized commitment are supported";
+  }
+
+  ws_subscribed( ctx, ws_conn_id, request_id, fd_rpc_pubsub_signature_subscribe( ctx->pubsub, ws_conn_id, &sig, level ) );
+  return NULL;
+}
+
+static char const *
+unsubscribe( fd_rpc_tile_t * ctx,
+             ulong           ws_conn_id,
+             ulong           request_id,
+             ulong           params,
+             int             kind ) {
+  ulong sub_id;
+  if( FD_UNLIKELY( params_cnt( ctx, params )!=1UL ||
+                   !fd_rpc_json_ulong( ctx->tok, ctx->body, params_get( ctx, params, 0UL ), &sub_id ) ) ) return "Invalid params";
+
+  if( FD_UNLIKELY( !fd_rpc_pubsub_unsubscribe( ctx->pubsub, ws_conn_id, kind, sub_id ) ) ) return "Invalid subscription id.";
+  ws_result( ctx, ws_conn_id, request_id, "true" );
+  return NULL;
+}
+
+static void
+rpc_ws_message( ulong         ws_conn_id,
+                uchar const * data,
+                ulong         data_len,
+                void *        _ctx ) {
+  fd_rpc_tile_t * ctx  = (fd_rpc_tile_t *)_ctx;
+  char const *    body = (char const *)data;
+
+  fd_rpc_json_tok_t * tok = ctx->tok;
+  long tok_cnt = fd_rpc_json_parse( tok, fd_rpc_json_tok_max( FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN ), body, data_len );
+  if( FD_UNLIKELY( tok_cnt<0L || tok[ 0 ].type!=FD_RPC_JSON_TYPE_OBJECT ) ) {
+    ws_error( ctx, ws_conn_id, NULL, -32700, "Parse error" );
+    return;
+  }
+  ctx->body = body;
+
+  ulong jsonrpc, id, method, params;
+  envelope_fields( ctx, &jsonrpc, &id, &method, &params );
+
+  ulong request_id;
+  if( FD_UNLIKELY( id==FD_RPC_JSON_IDX_NULL || !fd_rpc_json_ulong( tok, body, id, &request_id ) ) ) {
+    ws_error( ctx, ws_conn_id, NULL, -32600, "Invalid request" );
+    return;
+  }
+
+  if( FD_UNLIKELY( jsonrpc==FD_RPC_JSON_IDX_NULL || !STR_EQ( ctx, jsonrpc, "2.0" ) ||
+                   (params!=FD_RPC_JSON_IDX_NULL && tok[ params ].type!=FD_RPC_JSON_TYPE_ARRAY) ||
+                   method==FD_RPC_JSON_IDX_NULL || tok[ method ].type!=FD_RPC_JSON_TYPE_STRING ) ) {
+    ws_error( ctx, ws_conn_id, &request_id, -32600, "Invalid request" );
+    return;
+  }
+
+  char const * err;
+  if(      STR_EQ( ctx, method, "accountSubscribe"     ) ) err = accountSubscribe  ( ctx, ws_conn_id, request_id, params );
+  else if( STR_EQ( ctx, method, "slotSubscribe"        ) ) err = slotSubscribe     ( ctx, ws_conn_id, request_id, params );
+  else if( STR_EQ( ctx, method, "signatureSubscribe"   ) ) err = signatureSubscribe( ctx, ws_conn_id, request_id, params );
+  else if( STR_EQ( ctx, method, "accountUnsubscribe"   ) ) err = unsubscribe( ctx, ws_conn_id, request_id, params, FD_RPC_PUBSUB_KIND_ACCOUNT   );
+  else if( STR_EQ( ctx, method, "slotUnsubscribe"      ) ) err = unsubscribe( ctx, ws_conn_id, request_id, params, FD_RPC_PUBSUB_KIND_SLOT      );
+  else if( STR_EQ( ctx, method, "signatureUnsubscribe" ) ) err = unsubscribe( ctx, ws_conn_id, request_id, params, FD_RPC_PUBSUB_KIND_SIGNATURE );
+  else {
+    ws_error( ctx, ws_conn_id, &request_id, -32601, "Method not found" );
+    return;
+  }
+
+  if( FD_UNLIKELY( err ) ) ws_error( ctx, ws_conn_id, &request_id, -32602, err );
+}
+
+static void
+rpc_ws_close( ulong  ws_conn_id,
+              int    reason,
+              void * _ctx ) {
+  (void)reason;
+  fd_rpc_pubsub_conn_close( ((fd_rpc_tile_t *)_ctx)->pubsub, ws_conn_id );
 }
 
 static void
@@ -966,7 +1584,9 @@ privileged_init( fd_topo_t *      topo,
   fd_memcpy( ctx->identity_pubkey, identity_key, 32UL );
 
   fd_http_server_callbacks_t callbacks = {
-    .request = rpc_http_request,
+    .request    = rpc_http_request,
+    .ws_close   = rpc_ws_close,
+    .ws_message = rpc_ws_message,
   };
   ctx->http = fd_http_server_join( fd_http_server_new( _http, http_params, callbacks, ctx ) );
   fd_http_server_listen( ctx->http, tile->rpc.listen_addr, tile->rpc.listen_port );
@@ -1009,14 +1629,15 @@ unprivileged_init( fd_topo_t *      topo,
   void * scratch = fd_topo_obj_laddr( topo, tile->tile_obj_id );
 
   FD_SCRATCH_ALLOC_INIT( l, scratch );
-  fd_rpc_tile_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_rpc_tile_t ), sizeof( fd_rpc_tile_t )                                );
-                        FD_SCRATCH_ALLOC_APPEND( l, fd_http_server_align(),   fd_http_server_footprint( derive_http_params( tile ) ) );
-  void * _alloc       = FD_SCRATCH_ALLOC_APPEND( l, fd_alloc_align(),         fd_alloc_footprint()                                   );
-  void * _banks       = FD_SCRATCH_ALLOC_APPEND( l, alignof(bank_info_t),     tile->rpc.max_live_slots*sizeof(bank_info_t)           );
+  fd_rpc_tile_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_rpc_tile_t ),     sizeof( fd_rpc_tile_t )                                                           );
+                        FD_SCRATCH_ALLOC_APPEND( l, fd_http_server_align(),       fd_http_server_footprint( derive_http_params( tile ) )                            );
+  void * _tok         = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_rpc_json_tok_t ), fd_rpc_json_tok_max( FD_HTTP_SERVER_RPC_MAX_REQUEST_LEN )*sizeof(fd_rpc_json_tok_t) );
+  void * _banks       = FD_SCRATCH_ALLOC_APPEND( l, alignof(bank_info_t),         tile->rpc.max_live_slots*sizeof(bank_info_t)                                      );
+  void * _cache       = FD_SCRATCH_ALLOC_APPEND( l, fd_rpc_cache_align(),         fd_rpc_cache_footprint( FD_RPC_CACHE_ENT_MAX, FD_RPC_CACHE_DATA_MAX )             );
+  void * _pubsub      = FD_SCRATCH_ALLOC_APPEND( l, fd_rpc_pubsub_align(),        fd_rpc_pubsub_footprint( tile->rpc.max_subscriptions, tile->rpc.max_websocket_connections, FD_RPC_PUBSUB_BODY_MAX ) );
 
-  fd_alloc_t * alloc = fd_alloc_join( fd_alloc_new( _alloc, 1UL ), 1UL );
-  FD_TEST( alloc );
-  cJSON_alloc_install( alloc );
+  ctx->tok  = _tok;
+  ctx->body = NULL;
 
   ctx->keyswitch = fd_keyswitch_join( fd_topo_obj_laddr( topo, tile->keyswitch_obj_id ) );
   FD_TEST( ctx->keyswitch );
@@ -1025,12 +1646,26 @@ unprivileged_init( fd_topo_t *      topo,
 
   ctx->cluster_confirmed_slot = ULONG_MAX;
 
-  ctx->processed_idx = ULONG_MAX;
-  ctx->confirmed_idx = ULONG_MAX;
-  ctx->finalized_idx = ULONG_MAX;
+  ctx->processed_idx  = ULONG_MAX;
+  ctx->processed_slot = ULONG_MAX;
+  ctx->confirmed_idx  = ULONG_MAX;
+  ctx->finalized_idx  = ULONG_MAX;
 
   ctx->banks = _banks;
 
+  ctx->cache = fd_rpc_cache_join( fd_rpc_cache_new( _cache, FD_RPC_CACHE_ENT_MAX, FD_RPC_CACHE_DATA_MAX ) );
+  FD_TEST( ctx->cache );
+
+  ctx->sigstatus = fd_sigstatus_join( fd_topo_obj_laddr( topo, tile->rpc.sigstatus_obj_id ) );
+  FD_TEST( ctx->sigstatus );
+
+  ulong funk_obj_id = fd_pod_query_ulong( topo->props, "funk", ULONG_MAX );
+  FD_TEST( funk_obj_id!=ULONG_MAX );
+  FD_TEST( fd_accdb_user_v1_init( ctx->accdb, fd_topo_obj_laddr( topo, funk_obj_id ) ) );
+
+  ctx->pubsub = fd_rpc_pubsub_join( fd_rpc_pubsub_new( _pubsub, tile->rpc.max_subscriptions, tile->rpc.max_websocket_connections, FD_RPC_PUBSUB_BODY_MAX, (ulong)fd_tickcount(), &pubsub_sink, ctx ) );
+  FD_TEST( ctx->pubsub );
+
   FD_TEST( fd_cstr_printf_check( ctx->version_string, sizeof( ctx->version_string ), NULL, "%s", fdctl_version_string ) );
 
   FD_TEST( tile->in_cnt<=sizeof( ctx->in )/sizeof( ctx->in[ 0 ] ) );
@@ -1092,7 +1727,7 @@ rlimit_file_cnt( fd_topo_t const *      topo FD_PARAM_UNUSED,
                  fd_topo_tile_t const * tile ) {
   /* pipefd, socket, stderr, logfile, and one spare for new accept() connections */
   ulong base = 5UL;
-  return base+tile->rpc.max_http_connections;
+  return base+tile->rpc.max_http_connections+tile->rpc.max_websocket_connections;
 }
 
 #define STEM_BURST (1UL)
@@ -1102,6 +1737,7 @@ rlimit_file_cnt( fd_topo_t const *      topo FD_PARAM_UNUSED,
 #define STEM_CALLBACK_CONTEXT_ALIGN alignof(fd_rpc_tile_t)
 
 #define STEM_CALLBACK_DURING_HOUSEKEEPING during_housekeeping
+#define STEM_CALLBACK_METRICS_WRITE       metrics_write
 #define STEM_CALLBACK_BEFORE_CREDIT       before_credit
 #define STEM_CALLBACK_RETURNABLE_FRAG     returnable_frag
 
@@ -1114,7 +1750,6 @@ fd_topo_run_tile_t fd_tile_rpc = {
   .populate_allowed_fds     = populate_allowed_fds,
   .scratch_align            = scratch_align,
   .scratch_footprint        = scratch_footprint,
-  .loose_footprint          = loose_footprint,
   .privileged_init          = privileged_init,
   .unprivileged_init        = unprivileged_init,
   .run                      = stem_run,
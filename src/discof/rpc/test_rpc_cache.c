@@ -0,0 +1,114 @@
+#include "fd_rpc_cache.h"
+#include "../../util/fd_util.h"
+
+#define ENT_MAX  (16UL)
+#define DATA_MAX (256UL)
+
+static uchar scratch[ 4096UL ] __attribute__((aligned(FD_RPC_CACHE_ALIGN)));
+
+static void
+test_new_join( void ) {
+  FD_TEST( fd_rpc_cache_align()==FD_RPC_CACHE_ALIGN );
+  FD_TEST( !fd_rpc_cache_footprint( 0UL,     DATA_MAX ) );
+  FD_TEST( !fd_rpc_cache_footprint( 1UL,     DATA_MAX ) );
+  FD_TEST( !fd_rpc_cache_footprint( 12UL,    DATA_MAX ) );
+  FD_TEST( !fd_rpc_cache_footprint( ENT_MAX, 0UL      ) );
+  FD_TEST( fd_rpc_cache_footprint( ENT_MAX, DATA_MAX )<=sizeof(scratch) );
+
+  FD_TEST( !fd_rpc_cache_new( NULL,        ENT_MAX, DATA_MAX ) );
+  FD_TEST( !fd_rpc_cache_new( scratch+1UL, ENT_MAX, DATA_MAX ) );
+  FD_TEST( !fd_rpc_cache_new( scratch,     12UL,    DATA_MAX ) );
+  FD_TEST( !fd_rpc_cache_join( NULL ) );
+
+  FD_TEST( fd_rpc_cache_new( scratch, ENT_MAX, DATA_MAX )==scratch );
+  fd_rpc_cache_t * cache = fd_rpc_cache_join( scratch );
+  FD_TEST( cache );
+  FD_TEST( fd_rpc_cache_leave( cache )==scratch );
+  FD_TEST( fd_rpc_cache_delete( scratch )==scratch );
+  FD_TEST( !fd_rpc_cache_join( scratch ) );
+}
+
+static void
+test_basic( void ) {
+  fd_rpc_cache_t * cache = fd_rpc_cache_join( fd_rpc_cache_new( scratch, ENT_MAX, DATA_MAX ) );
+  FD_TEST( cache );
+
+  ulong key0 = FD_RPC_CACHE_KEY( 0, 0 );
+  ulong key1 = FD_RPC_CACHE_KEY( 0, 1 );
+  ulong key2 = FD_RPC_CACHE_KEY( 7, 0 );
+  FD_TEST( key0 && key0!=key1 && key0!=key2 && key1!=key2 );
+
+  ulong sz;
+  FD_TEST( !fd_rpc_cache_query( cache, key0, &sz ) );
+  FD_TEST( fd_rpc_cache_metrics( cache )->miss_cnt==1UL );
+
+  FD_TEST( fd_rpc_cache_insert( cache, key0, (uchar const *)"hello", 5UL ) );
+  FD_TEST( fd_rpc_cache_insert( cache, key2, (uchar const *)"",      0UL ) );
+
+  uchar const * body = fd_rpc_cache_query( cache, key0, &sz );
+  FD_TEST( body && sz==5UL && !memcmp( body, "hello", 5UL ) );
+  body = fd_rpc_cache_query( cache, key2, &sz );
+  FD_TEST( body && sz==0UL );
+  FD_TEST( !fd_rpc_cache_query( cache, key1, &sz ) );
+
+  FD_TEST( fd_rpc_cache_metrics( cache )->hit_cnt ==2UL );
+  FD_TEST( fd_rpc_cache_metrics( cache )->miss_cnt==2UL );
+
+  /* Reset drops everything but keeps the counters */
+  fd_rpc_cache_reset( cache );
+  FD_TEST( !fd_rpc_cache_query( cache, key0, &sz ) );
+  FD_TEST( !fd_rpc_cache_query( cache, key2, &sz ) );
+  FD_TEST( fd_rpc_cache_metrics( cache )->miss_cnt==4UL );
+
+  FD_TEST( fd_rpc_cache_insert( cache, key0, (uchar const *)"world", 5UL ) );
+  body = fd_rpc_cache_query( cache, key0, &sz );
+  FD_TEST( body && sz==5UL && !memcmp( body, "world", 5UL ) );
+
+  fd_rpc_cache_delete( fd_rpc_cache_leave( cache ) );
+}
+
+static void
+test_full( void ) {
+  fd_rpc_cache_t * cache = fd_rpc_cache_join( fd_rpc_cache_new( scratch, ENT_MAX, DATA_MAX ) );
+  FD_TEST( cache );
+
+  uchar buf[ DATA_MAX ];
+  for( ulong i=0UL; i<DATA_MAX; i++ ) buf[ i ] = (uchar)i;
+
+  /* At most half the table is used */
+  for( ulong i=0UL; i<ENT_MAX/2UL; i++ ) FD_TEST( fd_rpc_cache_insert( cache, FD_RPC_CACHE_KEY( 1, i ), buf+i, 1UL ) );
+  FD_TEST( !fd_rpc_cache_insert( cache, FD_RPC_CACHE_KEY( 1, ENT_MAX ), buf, 1UL ) );
+  FD_TEST( fd_rpc_cache_metrics( cache )->insert_fail_cnt==1UL );
+  for( ulong i=0UL; i<ENT_MAX/2UL; i++ ) {
+    ulong sz;
+    uchar const * body = fd_rpc_cache_query( cache, FD_RPC_CACHE_KEY( 1, i ), &sz );
+    FD_TEST( body && sz==1UL && body[ 0 ]==(uchar)i );
+  }
+
+  /* Body space */
+  fd_rpc_cache_reset( cache );
+  FD_TEST( fd_rpc_cache_insert( cache, FD_RPC_CACHE_KEY( 2, 0 ), buf, DATA_MAX-1UL ) );
+  FD_TEST( !fd_rpc_cache_insert( cache, FD_RPC_CACHE_KEY( 2, 1 ), buf, 2UL ) );
+  FD_TEST( fd_rpc_cache_insert( cache, FD_RPC_CACHE_KEY( 2, 1 ), buf, 1UL ) );
+  FD_TEST( fd_rpc_cache_metrics( cache )->insert_fail_cnt==2UL );
+
+  ulong sz;
+  uchar const * body = fd_rpc_cache_query( cache, FD_RPC_CACHE_KEY( 2, 0 ), &sz );
+  FD_TEST( body && sz==DATA_MAX-1UL && !memcmp( body, buf, sz ) );
+
+  fd_rpc_cache_delete( fd_rpc_cache_leave( cache ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  test_new_join();
+  test_basic();
+  test_full();
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,336 @@
+#include "fd_rpc_json.h"
+#include "fd_rpc_method.h"
+#include "../../ballet/json/cJSON.h"
+#include "../../ballet/json/cJSON_alloc.h"
+#include "../../util/fd_util.h"
+
+#define TOK_MAX (1024UL)
+
+static fd_rpc_json_tok_t tok[ TOK_MAX ];
+
+static long
+parse_cstr( char const * s ) {
+  return fd_rpc_json_parse( tok, TOK_MAX, s, strlen( s ) );
+}
+
+static void
+test_valid( void ) {
+  static struct { char const * doc; long cnt; } const valid[] = {
+    { "0",                                   1L },
+    { "-0",                                  1L },
+    { "-12.5e+3",                            1L },
+    { "1E9",                                 1L },
+    { " \t\r\n true \n",                     1L },
+    { "false",                               1L },
+    { "null",                                1L },
+    { "\"\"",                                1L },
+    { "\"a\\\"b\\\\c\\/\\b\\f\\n\\r\\t\\u00aF\"", 1L },
+    { "[]",                                  1L },
+    { "{}",                                  1L },
+    { "[ ]",                                 1L },
+    { "{ }",                                 1L },
+    { "[[],[],{}]",                          4L },
+    { "[1,\"2\",[3,[4]],{\"5\":6}]",        10L },
+    { "{\"a\":{\"b\":{\"c\":[]}}}",          7L },
+    { NULL,                                  0L }
+  };
+  for( ulong i=0UL; valid[ i ].doc; i++ ) {
+    long cnt = parse_cstr( valid[ i ].doc );
+    if( FD_UNLIKELY( cnt!=valid[ i ].cnt ) ) FD_LOG_ERR(( "FAIL: \"%s\" (%ld, expected %ld)", valid[ i ].doc, cnt, valid[ i ].cnt ));
+    FD_TEST( tok[ 0 ].next==(uint)cnt );
+  }
+
+  /* Check the token structure of a typical request */
+
+  char const * doc = "{\"jsonrpc\":\"2.0\",\"id\":7,\"method\":\"getSlot\",\"params\":[{\"commitment\":\"processed\",\"minContextSlot\":42}],\"x\":[[1,2],3]}";
+  FD_TEST( parse_cstr( doc )==20L );
+
+  FD_TEST( tok[  0 ].type==FD_RPC_JSON_TYPE_OBJECT ); FD_TEST( tok[ 0 ].cnt==5U ); FD_TEST( tok[ 0 ].off==0U ); FD_TEST( tok[ 0 ].len==strlen( doc ) );
+  FD_TEST( tok[  1 ].type==FD_RPC_JSON_TYPE_STRING ); FD_TEST( !memcmp( doc+tok[ 1 ].off, "jsonrpc", tok[ 1 ].len ) );
+  FD_TEST( tok[  2 ].type==FD_RPC_JSON_TYPE_STRING ); FD_TEST( tok[ 2 ].len==3U );
+  FD_TEST( tok[  4 ].type==FD_RPC_JSON_TYPE_NUMBER ); FD_TEST( tok[ 4 ].len==1U );
+  FD_TEST( tok[  8 ].type==FD_RPC_JSON_TYPE_ARRAY  ); FD_TEST( tok[ 8 ].cnt==1U ); FD_TEST( tok[ 8 ].next==14U );
+  FD_TEST( tok[  9 ].type==FD_RPC_JSON_TYPE_OBJECT ); FD_TEST( tok[ 9 ].cnt==2U ); FD_TEST( tok[ 9 ].next==14U );
+  FD_TEST( tok[ 15 ].type==FD_RPC_JSON_TYPE_ARRAY  ); FD_TEST( tok[ 15 ].cnt==2U ); FD_TEST( tok[ 15 ].next==20U );
+  FD_TEST( tok[ 16 ].type==FD_RPC_JSON_TYPE_ARRAY  ); FD_TEST( tok[ 16 ].next==19U );
+
+  FD_TEST( fd_rpc_json_obj_get( tok, doc, 0UL, "method", 6UL )==6UL );
+  FD_TEST( fd_rpc_json_obj_get( tok, doc, 0UL, "x",      1UL )==15UL );
+  FD_TEST( fd_rpc_json_obj_get( tok, doc, 0UL, "meth",   4UL )==FD_RPC_JSON_IDX_NULL );
+  FD_TEST( fd_rpc_json_obj_get( tok, doc, 8UL, "x",      1UL )==FD_RPC_JSON_IDX_NULL );
+  FD_TEST( fd_rpc_json_obj_get( tok, doc, 9UL, "minContextSlot", 14UL )==13UL );
+
+  FD_TEST( fd_rpc_json_arr_get( tok, 8UL,  0UL )==9UL  );
+  FD_TEST( fd_rpc_json_arr_get( tok, 8UL,  1UL )==FD_RPC_JSON_IDX_NULL );
+  FD_TEST( fd_rpc_json_arr_get( tok, 15UL, 1UL )==19UL );
+  FD_TEST( fd_rpc_json_arr_get( tok, 0UL,  0UL )==FD_RPC_JSON_IDX_NULL );
+
+  FD_TEST( fd_rpc_json_str_eq( tok, doc, 11UL, "processed", 9UL ) );
+  FD_TEST( !fd_rpc_json_str_eq( tok, doc, 11UL, "processe", 8UL ) );
+  FD_TEST( !fd_rpc_json_str_eq( tok, doc, 13UL, "42", 2UL ) );
+
+  ulong val;
+  FD_TEST( fd_rpc_json_ulong( tok, doc, 13UL, &val ) && val==42UL );
+  FD_TEST( !fd_rpc_json_ulong( tok, doc, 11UL, &val ) );
+
+  /* First occurrence of a duplicate key wins, escaped keys never match */
+
+  doc = "{\"a\":1,\"a\":2,\"\\u0062\":3,\"b\":4}";
+  FD_TEST( parse_cstr( doc )==9L );
+  FD_TEST( fd_rpc_json_obj_get( tok, doc, 0UL, "a", 1UL )==2UL );
+  FD_TEST( fd_rpc_json_obj_get( tok, doc, 0UL, "b", 1UL )==8UL );
+  FD_TEST( tok[ 5 ].flags==FD_RPC_JSON_FLAG_ESCAPED );
+}
+
+static void
+test_ulong( void ) {
+  static struct { char const * doc; int ok; ulong val; } const cases[] = {
+    { "0",                     1, 0UL        },
+    { "18446744073709551615",  1, ULONG_MAX  },
+    { "18446744073709551616",  0, 0UL        },
+    { "99999999999999999999",  0, 0UL        },
+    { "-1",                    0, 0UL        },
+    { "1.0",                   0, 0UL        },
+    { "1e3",                   0, 0UL        },
+    { "\"1\"",                 0, 0UL        },
+    { NULL,                    0, 0UL        }
+  };
+  for( ulong i=0UL; cases[ i ].doc; i++ ) {
+    FD_TEST( parse_cstr( cases[ i ].doc )==1L );
+    ulong val = 12345UL;
+    FD_TEST( fd_rpc_json_ulong( tok, cases[ i ].doc, 0UL, &val )==cases[ i ].ok );
+    if( cases[ i ].ok ) FD_TEST( val==cases[ i ].val );
+  }
+}
+
+static void
+test_invalid( void ) {
+  static char const * const invalid[] = {
+    "", " ", "{", "}", "[", "]", "[1,]", "[,1]", "{\"a\"}", "{\"a\":}", "{\"a\":1,}", "{1:2}", "{\"a\" 1}",
+    "[1 2]", "{]", "[}", "[[]", "[]]", "01", "-", "1.", ".1", "1e", "1e+", "+1", "--1", "0x1",
+    "tru", "truee", "nul", "False", "\"", "\"\\\"", "\"\\x\"", "\"\\u12\"", "\"\\u12g4\"", "\"a\nb\"",
+    "1 2", "{} {}", "[]x", "'a'", "NaN", "Infinity",
+    NULL
+  };
+  for( ulong i=0UL; invalid[ i ]; i++ ) {
+    long cnt = parse_cstr( invalid[ i ] );
+    if( FD_UNLIKELY( cnt!=FD_RPC_JSON_ERR_INVAL ) ) FD_LOG_ERR(( "FAIL: \"%s\" (%ld)", invalid[ i ], cnt ));
+  }
+
+  /* Nesting limit */
+
+  char deep[ 2UL*FD_RPC_JSON_DEPTH_MAX+2UL ];
+  for( ulong i=0UL; i<FD_RPC_JSON_DEPTH_MAX; i++ ) { deep[ i ] = '['; deep[ 2UL*FD_RPC_JSON_DEPTH_MAX-1UL-i ] = ']'; }
+  FD_TEST( fd_rpc_json_parse( tok, TOK_MAX, deep, 2UL*FD_RPC_JSON_DEPTH_MAX )==(long)FD_RPC_JSON_DEPTH_MAX );
+  memmove( deep+1UL, deep, 2UL*FD_RPC_JSON_DEPTH_MAX ); deep[ 0 ] = '['; deep[ 2UL*FD_RPC_JSON_DEPTH_MAX+1UL ] = ']';
+  FD_TEST( fd_rpc_json_parse( tok, TOK_MAX, deep, 2UL*FD_RPC_JSON_DEPTH_MAX+2UL )==FD_RPC_JSON_ERR_INVAL );
+
+  /* Token array exhaustion */
+
+  FD_TEST( fd_rpc_json_parse( tok, 2UL, "[1,2]", 5UL )==FD_RPC_JSON_ERR_FULL );
+  FD_TEST( fd_rpc_json_parse( tok, 3UL, "[1,2]", 5UL )==3L );
+  FD_TEST( fd_rpc_json_parse( tok, 2UL, "{\"a\":1}", 7UL )==FD_RPC_JSON_ERR_FULL );
+}
+
+/* gen emits a random JSON value of at most about max bytes into buf,
+   returning the number of bytes written. */
+
+static ulong
+gen( fd_rng_t * rng,
+     char *     buf,
+     ulong      max,
+     ulong      depth ) {
+  if( max<8UL ) { buf[ 0 ] = (char)('0'+fd_rng_uint_roll( rng, 10U )); return 1UL; }
+  uint r = fd_rng_uint_roll( rng, depth<8UL ? 6U : 3U );
+  switch( r ) {
+    case 0U: buf[ 0 ] = (char)('0'+fd_rng_uint_roll( rng, 10U )); return 1UL;
+    case 1U: memcpy( buf, "\"\"", 2UL ); return 2UL;
+    case 2U: memcpy( buf, "null", 4UL ); return 4UL;
+    default: {
+      int   obj = r==5U;
+      ulong n   = 0UL;
+      ulong cnt = fd_rng_uint_roll( rng, 8U );
+      buf[ n++ ] = obj ? '{' : '[';
+      for( ulong i=0UL; i<cnt && n+8UL<max; i++ ) {
+        if( i ) buf[ n++ ] = ',';
+        if( obj ) { memcpy( buf+n, "\"\":", 3UL ); n += 3UL; }
+        n += gen( rng, buf+n, (max-n-2UL)/2UL, depth+1UL );
+      }
+      buf[ n++ ] = obj ? '}' : ']';
+      return n;
+    }
+  }
+}
+
+static void
+test_tok_max( fd_rng_t * rng ) {
+  static char buf[ 2000UL ]; /* tok_max( sizeof(buf) )<=TOK_MAX */
+
+  /* The densest documents hit the bound exactly */
+
+  ulong n = 0UL;
+  buf[ n++ ] = '[';
+  for( ulong i=0UL; i<100UL; i++ ) { if( i ) buf[ n++ ] = ','; buf[ n++ ] = '1'; }
+  buf[ n++ ] = ']';
+  FD_TEST( fd_rpc_json_parse( tok, fd_rpc_json_tok_max( n ), buf, n )==(long)fd_rpc_json_tok_max( n ) );
+
+  for( ulong iter=0UL; iter<100000UL; iter++ ) {
+    ulong sz  = gen( rng, buf, 1+fd_rng_ulong_roll( rng, sizeof(buf) ), 0UL );
+    long  cnt = fd_rpc_json_parse( tok, fd_rpc_json_tok_max( sz ), buf, sz );
+    if( FD_UNLIKELY( cnt<=0L ) ) FD_LOG_ERR(( "FAIL: %ld \"%.*s\"", cnt, (int)sz, buf ));
+    FD_TEST( tok[ 0 ].next==(uint)cnt );
+
+    /* Any proper prefix of a generated document is invalid */
+    ulong cut = fd_rng_ulong_roll( rng, sz );
+    if( cut ) FD_TEST( fd_rpc_json_parse( tok, TOK_MAX, buf, cut )<0L );
+  }
+}
+
+static char const * const method_names[ FD_RPC_METHOD_CNT ] = {
+  "getAccountInfo", "getBalance", "getBlock", "getBlockCommitment", "getBlockHeight", "getBlockProduction",
+  "getBlocks", "getBlocksWithLimit", "getBlockTime", "getClusterNodes", "getEpochInfo", "getEpochSchedule",
+  "getFeeForMessage", "getFirstAvailableBlock", "getGenesisHash", "getHealth", "getHighestSnapshotSlot",
+  "getIdentity", "getInflationGovernor", "getInflationRate", "getInflationReward", "getLargestAccounts",
+  "getLatestBlockhash", "getLeaderSchedule", "getMaxRetransmitSlot", "getMaxShredInsertSlot",
+  "getMinimumBalanceForRentExemption", "getMultipleAccounts", "getProgramAccounts",
+  "getRecentPerformanceSamples", "getRecentPrioritizationFees", "getSignaturesForAddress",
+  "getSignatureStatuses", "getSlot", "getSlotLeader", "getSlotLeaders", "getStakeMinimumDelegation",
+  "getSupply", "getTokenAccountBalance", "getTokenAccountsByDelegate", "getTokenAccountsByOwner",
+  "getTokenLargestAccounts", "getTokenSupply", "getTransaction", "getTransactionCount", "getVersion",
+  "getVoteAccounts", "isBlockhashValid", "minimumLedgerSlot", "requestAirdrop", "sendTransaction",
+  "simulateTransaction"
+};
+
+static void
+test_method( void ) {
+  for( int i=0; i<FD_RPC_METHOD_CNT; i++ ) {
+    char const * name = method_names[ i ];
+    ulong        len  = strlen( name );
+    FD_TEST( fd_rpc_method_query( name, len )==i );
+
+    char buf[ 64 ];
+    memcpy( buf, name, len );
+    buf[ len-2UL ] ^= 0x20; /* same signature, different name */
+    FD_TEST( fd_rpc_method_query( buf, len )==-1 );
+    FD_TEST( fd_rpc_method_query( name, len-1UL )!=i );
+    buf[ len-2UL ] ^= 0x20; buf[ len ] = 's';
+    FD_TEST( fd_rpc_method_query( buf, len+1UL )!=i );
+  }
+  FD_TEST( fd_rpc_method_query( "", 0UL )==-1 );
+  FD_TEST( fd_rpc_method_query( "x", 1UL )==-1 );
+}
+
+/* Benchmark the request front end, tokenizing the body, picking out the
+   envelope and the commitment config and resolving the method, against
+   the equivalent with cJSON and a strcmp chain. */
+
+static char const * const bench_reqs[] = {
+  "{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"getSlot\",\"params\":[{\"commitment\":\"processed\"}]}",
+  "{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"getLatestBlockhash\",\"params\":[{\"commitment\":\"processed\",\"minContextSlot\":1000}]}",
+  "{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"getHealth\"}",
+  "{\"jsonrpc\":\"2.0\",\"id\":4,\"method\":\"getMinimumBalanceForRentExemption\",\"params\":[50,{\"commitment\":\"processed\"}]}",
+  "{\"jsonrpc\":\"2.0\",\"id\":5,\"method\":\"getTransactionCount\",\"params\":[{\"commitment\":\"processed\"}]}",
+  "{\"jsonrpc\":\"2.0\",\"id\":6,\"method\":\"getVersion\"}",
+};
+#define BENCH_REQ_CNT (sizeof(bench_reqs)/sizeof(bench_reqs[0]))
+
+static ulong
+bench_fd( char const * body,
+          ulong        sz ) {
+  if( FD_UNLIKELY( fd_rpc_json_parse( tok, TOK_MAX, body, sz )<0L ) ) return ULONG_MAX;
+  ulong method = fd_rpc_json_obj_get( tok, body, 0UL, "method", 6UL );
+  ulong id     = fd_rpc_json_obj_get( tok, body, 0UL, "id",     2UL );
+  ulong params = fd_rpc_json_obj_get( tok, body, 0UL, "params", 6UL );
+  ulong request_id;
+  if( FD_UNLIKELY( !fd_rpc_json_str_eq( tok, body, fd_rpc_json_obj_get( tok, body, 0UL, "jsonrpc", 7UL ), "2.0", 3UL ) ) ) return ULONG_MAX;
+  if( FD_UNLIKELY( !fd_rpc_json_ulong( tok, body, id, &request_id ) ) ) return ULONG_MAX;
+  int m = fd_rpc_method_query( body+tok[ method ].off, tok[ method ].len );
+  ulong commitment = 0UL;
+  if( params!=FD_RPC_JSON_IDX_NULL ) {
+    ulong config = fd_rpc_json_arr_get( tok, params, tok[ params ].cnt-1UL );
+    commitment = fd_rpc_json_obj_get( tok, body, config, "commitment", 10UL );
+    if( commitment!=FD_RPC_JSON_IDX_NULL ) commitment = (ulong)fd_rpc_json_str_eq( tok, body, commitment, "processed", 9UL );
+  }
+  return request_id + (ulong)m + commitment;
+}
+
+static ulong
+bench_cjson( char const * body,
+             ulong        sz ) {
+  char const * parse_end;
+  cJSON * json = cJSON_ParseWithLengthOpts( body, sz, &parse_end, 0 );
+  if( FD_UNLIKELY( !json ) ) return ULONG_MAX;
+  cJSON const * jsonrpc = cJSON_GetObjectItemCaseSensitive( json, "jsonrpc" );
+  if( FD_UNLIKELY( !cJSON_IsString( jsonrpc ) || strcmp( jsonrpc->valuestring, "2.0" ) ) ) { cJSON_Delete( json ); return ULONG_MAX; }
+  cJSON const * id     = cJSON_GetObjectItemCaseSensitive( json, "id"     );
+  cJSON const * params = cJSON_GetObjectItemCaseSensitive( json, "params" );
+  cJSON const * method = cJSON_GetObjectItemCaseSensitive( json, "method" );
+  int m = -1;
+  for( int i=0; i<FD_RPC_METHOD_CNT; i++ ) if( !strcmp( method->valuestring, method_names[ i ] ) ) { m = i; break; }
+  ulong commitment = 0UL;
+  if( params ) {
+    cJSON const * config = cJSON_GetArrayItem( params, cJSON_GetArraySize( params )-1 );
+    cJSON const * c      = cJSON_GetObjectItemCaseSensitive( config, "commitment" );
+    if( c ) commitment = (ulong)!strcmp( c->valuestring, "processed" );
+  }
+  ulong ret = id->valueulong + (ulong)m + commitment;
+  cJSON_Delete( json );
+  return ret;
+}
+
+static void
+bench( void ) {
+  ulong sz[ BENCH_REQ_CNT ];
+  for( ulong i=0UL; i<BENCH_REQ_CNT; i++ ) {
+    sz[ i ] = strlen( bench_reqs[ i ] );
+    FD_TEST( bench_fd( bench_reqs[ i ], sz[ i ] )==bench_cjson( bench_reqs[ i ], sz[ i ] ) );
+  }
+
+  ulong const iter_cnt = 200000UL;
+
+  for( ulong b=0UL; b<2UL; b++ ) {
+    ulong sum = 0UL;
+    for( ulong i=0UL; i<1000UL; i++ ) sum += b ? bench_cjson( bench_reqs[ i%BENCH_REQ_CNT ], sz[ i%BENCH_REQ_CNT ] )
+                                               : bench_fd   ( bench_reqs[ i%BENCH_REQ_CNT ], sz[ i%BENCH_REQ_CNT ] );
+    long dt = -fd_log_wallclock();
+    for( ulong i=0UL; i<iter_cnt; i++ ) sum += b ? bench_cjson( bench_reqs[ i%BENCH_REQ_CNT ], sz[ i%BENCH_REQ_CNT ] )
+                                                 : bench_fd   ( bench_reqs[ i%BENCH_REQ_CNT ], sz[ i%BENCH_REQ_CNT ] );
+    dt += fd_log_wallclock();
+    FD_COMPILER_FORGET( sum );
+    FD_LOG_NOTICE(( "%-13s %.3f Mreq/s (%.1f ns/req)", b ? "cJSON+strcmp:" : "fd_rpc_json:",
+                    1e3*(double)iter_cnt/(double)dt, (double)dt/(double)iter_cnt ));
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "gigantic"                 );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL                        );
+  ulong        numa_idx = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx", NULL, fd_shmem_numa_idx( 0UL )   );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+  fd_alloc_t * alloc = fd_alloc_join( fd_alloc_new( fd_wksp_alloc_laddr( wksp, fd_alloc_align(), fd_alloc_footprint(), 1UL ), 1UL ), 0UL );
+  FD_TEST( alloc );
+  cJSON_alloc_install( alloc );
+
+  test_valid();
+  test_ulong();
+  test_invalid();
+  test_tok_max( rng );
+  test_method();
+  bench();
+
+  fd_wksp_free_laddr( fd_alloc_delete( fd_alloc_leave( alloc ) ) );
+  fd_wksp_delete_anonymous( wksp );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,409 @@
+#include "fd_rpc_pubsub.h"
+#include "../../util/fd_util.h"
+
+#define SUB_MAX  (16UL)
+#define CONN_MAX (4UL)
+#define BODY_MAX (1024UL)
+
+static uchar scratch[ 1UL<<20 ] __attribute__((aligned(FD_RPC_PUBSUB_ALIGN)));
+
+/* A fake sink which keeps the last message sent on each connection. */
+
+struct test_sink {
+  fd_rpc_pubsub_t * pubsub;
+  ulong             room [ CONN_MAX ];
+  ulong             cnt  [ CONN_MAX ];
+  char              last [ CONN_MAX ][ 2048 ];
+  ulong             closed[ CONN_MAX ];
+  ulong             close_on_send; /* conn to close when sending, or ULONG_MAX */
+};
+
+typedef struct test_sink test_sink_t;
+
+static test_sink_t sink_state[1];
+
+static ulong
+test_room( ulong  conn,
+           void * ctx ) {
+  test_sink_t * s = ctx;
+  return s->room[ conn ];
+}
+
+static void
+test_send( ulong                       conn,
+           fd_rpc_pubsub_msg_t const * msg,
+           void *                      ctx ) {
+  test_sink_t * s = ctx;
+  FD_TEST( s->room[ conn ] );
+  s->room[ conn ]--;
+  s->cnt [ conn ]++;
+
+  char * p = s->last[ conn ];
+  for( ulong i=0UL; i<FD_RPC_PUBSUB_MSG_PART_CNT; i++ ) {
+    fd_memcpy( p, msg->part[ i ].data, msg->part[ i ].sz );
+    p += msg->part[ i ].sz;
+  }
+  *p = '\0';
+
+  if( FD_UNLIKELY( s->close_on_send!=ULONG_MAX ) ) {
+    ulong victim = s->close_on_send;
+    s->close_on_send = ULONG_MAX;
+    fd_rpc_pubsub_conn_close( s->pubsub, victim );
+  }
+}
+
+static void
+test_close( ulong  conn,
+            void * ctx ) {
+  test_sink_t * s = ctx;
+  s->closed[ conn ]++;
+}
+
+static fd_rpc_pubsub_sink_t const test_sink = { .room = test_room, .send = test_send, .close = test_close };
+
+static fd_rpc_pubsub_t *
+test_pubsub( void ) {
+  memset( sink_state, 0, sizeof(test_sink_t) );
+  sink_state->close_on_send = ULONG_MAX;
+  for( ulong i=0UL; i<CONN_MAX; i++ ) sink_state->room[ i ] = ULONG_MAX;
+  fd_rpc_pubsub_t * pubsub = fd_rpc_pubsub_join( fd_rpc_pubsub_new( scratch, SUB_MAX, CONN_MAX, BODY_MAX, 1234UL, &test_sink, sink_state ) );
+  FD_TEST( pubsub );
+  sink_state->pubsub = pubsub;
+  return pubsub;
+}
+
+static ulong
+sub_id( char const * msg ) {
+  char const * p = strstr( msg, "\"subscription\":" );
+  FD_TEST( p );
+  return fd_cstr_to_ulong( p+15 );
+}
+
+static void
+test_new_join( void ) {
+  FD_TEST( fd_rpc_pubsub_align()==FD_RPC_PUBSUB_ALIGN );
+  FD_TEST( !fd_rpc_pubsub_footprint( 0UL,     CONN_MAX, BODY_MAX ) );
+  FD_TEST( !fd_rpc_pubsub_footprint( SUB_MAX, 0UL,      BODY_MAX ) );
+  FD_TEST( !fd_rpc_pubsub_footprint( SUB_MAX, CONN_MAX, 16UL     ) );
+  FD_TEST( fd_rpc_pubsub_footprint( SUB_MAX, CONN_MAX, BODY_MAX )<=sizeof(scratch) );
+
+  fd_rpc_pubsub_sink_t bad_sink = test_sink; bad_sink.room = NULL;
+  FD_TEST( !fd_rpc_pubsub_new( NULL,        SUB_MAX, CONN_MAX, BODY_MAX, 0UL, &test_sink, NULL ) );
+  FD_TEST( !fd_rpc_pubsub_new( scratch+1UL, SUB_MAX, CONN_MAX, BODY_MAX, 0UL, &test_sink, NULL ) );
+  FD_TEST( !fd_rpc_pubsub_new( scratch,     SUB_MAX, CONN_MAX, BODY_MAX, 0UL, &bad_sink,  NULL ) );
+  FD_TEST( !fd_rpc_pubsub_join( NULL ) );
+
+  FD_TEST( fd_rpc_pubsub_new( scratch, SUB_MAX, CONN_MAX, BODY_MAX, 0UL, &test_sink, NULL )==scratch );
+  fd_rpc_pubsub_t * pubsub = fd_rpc_pubsub_join( scratch );
+  FD_TEST( pubsub );
+  FD_TEST( fd_rpc_pubsub_account_first( pubsub )==ULONG_MAX );
+  FD_TEST( fd_rpc_pubsub_signature_first( pubsub )==ULONG_MAX );
+  FD_TEST( fd_rpc_pubsub_leave( pubsub )==scratch );
+  FD_TEST( fd_rpc_pubsub_delete( scratch )==scratch );
+  FD_TEST( !fd_rpc_pubsub_join( scratch ) );
+}
+
+static void
+test_account( void ) {
+  fd_rpc_pubsub_t * pubsub = test_pubsub();
+
+  fd_pubkey_t key0; memset( &key0, 1, sizeof(fd_pubkey_t) );
+  fd_pubkey_t key1; memset( &key1, 2, sizeof(fd_pubkey_t) );
+
+  ulong id0 = fd_rpc_pubsub_account_subscribe( pubsub, 0UL, &key0, 10UL );
+  ulong id1 = fd_rpc_pubsub_account_subscribe( pubsub, 1UL, &key0, FD_RPC_PUBSUB_SLOT_UNKNOWN );
+  ulong id2 = fd_rpc_pubsub_account_subscribe( pubsub, 1UL, &key1, FD_RPC_PUBSUB_SLOT_UNKNOWN );
+  FD_TEST( id0!=ULONG_MAX && id1!=ULONG_MAX && id2!=ULONG_MAX );
+  FD_TEST( id0!=id1 && id0!=id2 && id1!=id2 );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==3UL );
+
+  /* Both subscriptions on key0 share one entry */
+  ulong idx0 = ULONG_MAX;
+  ulong idx1 = ULONG_MAX;
+  ulong cnt  = 0UL;
+  for( ulong idx=fd_rpc_pubsub_account_first( pubsub ); idx!=ULONG_MAX; idx=fd_rpc_pubsub_account_next( pubsub, idx ) ) {
+    if( fd_pubkey_eq( fd_rpc_pubsub_account_pubkey( pubsub, idx ), &key0 ) ) idx0 = idx;
+    if( fd_pubkey_eq( fd_rpc_pubsub_account_pubkey( pubsub, idx ), &key1 ) ) idx1 = idx;
+    cnt++;
+  }
+  FD_TEST( cnt==2UL && idx0!=ULONG_MAX && idx1!=ULONG_MAX );
+
+  /* Unchanged accounts are not stale, and the first look at key1 is
+     the baseline */
+  fd_rpc_pubsub_publish_begin( pubsub );
+  FD_TEST( !fd_rpc_pubsub_account_stale( pubsub, idx0, 10UL ) );
+  FD_TEST( !fd_rpc_pubsub_account_stale( pubsub, idx1, FD_RPC_PUBSUB_SLOT_MISSING ) );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( !sink_state->cnt[ 0 ] && !sink_state->cnt[ 1 ] );
+
+  /* A change is serialized once and sent to both subscribers */
+  uchar owner[ 32 ]; memset( owner, 0, 32UL ); owner[ 31 ] = 1;
+  uchar data[ 3 ] = { 'a', 'b', 'c' };
+  fd_rpc_pubsub_account_t acct = { .data = data, .data_sz = 3UL, .lamports = 42UL, .owner = owner, .executable = 1 };
+
+  fd_rpc_pubsub_publish_begin( pubsub );
+  FD_TEST( fd_rpc_pubsub_account_stale( pubsub, idx0, 11UL ) );
+  FD_TEST( fd_rpc_pubsub_account_stage( pubsub, 12UL, &acct ) );
+  fd_rpc_pubsub_account_publish( pubsub, idx0, 11UL );
+  FD_TEST( !fd_rpc_pubsub_account_stale( pubsub, idx1, FD_RPC_PUBSUB_SLOT_MISSING ) );
+  fd_rpc_pubsub_publish_end( pubsub );
+
+  FD_TEST( sink_state->cnt[ 0 ]==1UL && sink_state->cnt[ 1 ]==1UL );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->serialize_cnt==1UL );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->notify_cnt==2UL );
+
+  char expected[ 1024 ];
+  FD_TEST( fd_cstr_printf_check( expected, sizeof(expected), NULL,
+    "{\"jsonrpc\":\"2.0\",\"method\":\"accountNotification\",\"params\":{\"result\":"
+    "{\"context\":{\"slot\":12},\"value\":{\"data\":[\"YWJj\",\"base64\"],\"executable\":true,\"lamports\":42,"
+    "\"owner\":\"11111111111111111111111111111112\",\"rentEpoch\":18446744073709551615,\"space\":3}}"
+    ",\"subscription\":%lu}}", id0 ) );
+  FD_TEST( !strcmp( sink_state->last[ 0 ], expected ) );
+  FD_TEST( sub_id( sink_state->last[ 1 ] )==id1 );
+
+  /* Deletion */
+  fd_rpc_pubsub_publish_begin( pubsub );
+  FD_TEST( fd_rpc_pubsub_account_stale( pubsub, idx0, FD_RPC_PUBSUB_SLOT_MISSING ) );
+  FD_TEST( fd_rpc_pubsub_account_stage( pubsub, 13UL, NULL ) );
+  fd_rpc_pubsub_account_publish( pubsub, idx0, FD_RPC_PUBSUB_SLOT_MISSING );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( strstr( sink_state->last[ 0 ], "{\"context\":{\"slot\":13},\"value\":{\"data\":[\"\",\"base64\"],\"executable\":false,\"lamports\":0,\"owner\":\"11111111111111111111111111111111\"" ) );
+
+  /* Bodies that do not fit are dropped, but the state is recorded */
+  uchar big[ BODY_MAX ]; memset( big, 0, sizeof(big) );
+  acct.data = big; acct.data_sz = sizeof(big);
+  fd_rpc_pubsub_publish_begin( pubsub );
+  FD_TEST( fd_rpc_pubsub_account_stale( pubsub, idx0, 14UL ) );
+  FD_TEST( !fd_rpc_pubsub_account_stage( pubsub, 14UL, &acct ) );
+  fd_rpc_pubsub_account_publish( pubsub, idx0, 14UL );
+  FD_TEST( !fd_rpc_pubsub_account_stale( pubsub, idx0, 14UL ) );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( sink_state->cnt[ 0 ]==2UL );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->oversize_cnt==1UL );
+
+  /* Unsubscribe */
+  FD_TEST( !fd_rpc_pubsub_unsubscribe( pubsub, 1UL, FD_RPC_PUBSUB_KIND_ACCOUNT, id0 ) );
+  FD_TEST( !fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_SLOT,    id0 ) );
+  FD_TEST( !fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_ACCOUNT, ULONG_MAX ) );
+  FD_TEST( fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_ACCOUNT, id0 ) );
+  FD_TEST( !fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_ACCOUNT, id0 ) );
+  FD_TEST( fd_rpc_pubsub_unsubscribe( pubsub, 1UL, FD_RPC_PUBSUB_KIND_ACCOUNT, id1 ) );
+  FD_TEST( fd_rpc_pubsub_account_first( pubsub )==idx1 );
+  FD_TEST( fd_rpc_pubsub_account_next( pubsub, idx1 )==ULONG_MAX );
+  fd_rpc_pubsub_conn_close( pubsub, 1UL );
+  FD_TEST( fd_rpc_pubsub_account_first( pubsub )==ULONG_MAX );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==0UL );
+
+  fd_rpc_pubsub_delete( fd_rpc_pubsub_leave( pubsub ) );
+}
+
+static void
+test_conflate( void ) {
+  fd_rpc_pubsub_t * pubsub = test_pubsub();
+
+  fd_pubkey_t key; memset( &key, 3, sizeof(fd_pubkey_t) );
+  ulong id0 = fd_rpc_pubsub_account_subscribe( pubsub, 0UL, &key, 1UL );
+  ulong id1 = fd_rpc_pubsub_account_subscribe( pubsub, 1UL, &key, 1UL );
+  ulong idx = fd_rpc_pubsub_account_first( pubsub );
+
+  uchar owner[ 32 ] = { 0 };
+  fd_rpc_pubsub_account_t acct = { .data = NULL, .data_sz = 0UL, .lamports = 1UL, .owner = owner, .executable = 0 };
+
+  /* Connection 1 is behind, and misses slots 2 and 3 */
+  sink_state->room[ 1 ] = 0UL;
+  for( ulong slot=2UL; slot<=3UL; slot++ ) {
+    acct.lamports = slot;
+    fd_rpc_pubsub_publish_begin( pubsub );
+    FD_TEST( fd_rpc_pubsub_account_stale( pubsub, idx, slot ) );
+    FD_TEST( fd_rpc_pubsub_account_stage( pubsub, slot, &acct ) );
+    fd_rpc_pubsub_account_publish( pubsub, idx, slot );
+    fd_rpc_pubsub_publish_end( pubsub );
+  }
+  FD_TEST( sink_state->cnt[ 0 ]==2UL && sink_state->cnt[ 1 ]==0UL );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->conflate_cnt==2UL );
+
+  /* Once it catches up, it only gets the latest state, even though the
+     account did not change.  Connection 0 is not notified again. */
+  sink_state->room[ 1 ] = 1UL;
+  fd_rpc_pubsub_publish_begin( pubsub );
+  FD_TEST( fd_rpc_pubsub_account_stale( pubsub, idx, 3UL ) );
+  FD_TEST( fd_rpc_pubsub_account_stage( pubsub, 4UL, &acct ) );
+  fd_rpc_pubsub_account_publish( pubsub, idx, 3UL );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( sink_state->cnt[ 0 ]==2UL && sink_state->cnt[ 1 ]==1UL );
+  FD_TEST( strstr( sink_state->last[ 1 ], "\"lamports\":3," ) );
+  FD_TEST( sub_id( sink_state->last[ 1 ] )==id1 );
+  FD_TEST( sub_id( sink_state->last[ 0 ] )==id0 );
+
+  fd_rpc_pubsub_publish_begin( pubsub );
+  FD_TEST( !fd_rpc_pubsub_account_stale( pubsub, idx, 3UL ) );
+  fd_rpc_pubsub_publish_end( pubsub );
+
+  /* A connection that stalls for too long is closed */
+  sink_state->room[ 1 ] = 0UL;
+  for( ulong slot=5UL; slot<5UL+FD_RPC_PUBSUB_STALL_MAX; slot++ ) {
+    FD_TEST( !sink_state->closed[ 1 ] );
+    fd_rpc_pubsub_publish_begin( pubsub );
+    if( fd_rpc_pubsub_account_stale( pubsub, idx, slot ) ) {
+      FD_TEST( fd_rpc_pubsub_account_stage( pubsub, slot, &acct ) );
+      fd_rpc_pubsub_account_publish( pubsub, idx, slot );
+    }
+    fd_rpc_pubsub_publish_end( pubsub );
+  }
+  FD_TEST( sink_state->closed[ 1 ]==1UL );
+  FD_TEST( !sink_state->closed[ 0 ] );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->evict_cnt==1UL );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==1UL );
+  FD_TEST( !fd_rpc_pubsub_unsubscribe( pubsub, 1UL, FD_RPC_PUBSUB_KIND_ACCOUNT, id1 ) );
+
+  fd_rpc_pubsub_delete( fd_rpc_pubsub_leave( pubsub ) );
+}
+
+static void
+test_slot( void ) {
+  fd_rpc_pubsub_t * pubsub = test_pubsub();
+
+  ulong id0 = fd_rpc_pubsub_slot_subscribe( pubsub, 0UL );
+  ulong id1 = fd_rpc_pubsub_slot_subscribe( pubsub, 2UL );
+  FD_TEST( id0!=ULONG_MAX && id1!=ULONG_MAX );
+
+  sink_state->room[ 2 ] = 0UL;
+  fd_rpc_pubsub_publish_begin( pubsub );
+  fd_rpc_pubsub_slot_notify( pubsub, 100UL, 99UL, 68UL );
+  fd_rpc_pubsub_publish_end( pubsub );
+
+  char expected[ 256 ];
+  FD_TEST( fd_cstr_printf_check( expected, sizeof(expected), NULL,
+    "{\"jsonrpc\":\"2.0\",\"method\":\"slotNotification\",\"params\":{\"result\":{\"parent\":99,\"root\":68,\"slot\":100},\"subscription\":%lu}}", id0 ) );
+  FD_TEST( !strcmp( sink_state->last[ 0 ], expected ) );
+  FD_TEST( !sink_state->cnt[ 2 ] );
+
+  /* Skipped slots are not retried */
+  sink_state->room[ 2 ] = ULONG_MAX;
+  fd_rpc_pubsub_publish_begin( pubsub );
+  fd_rpc_pubsub_slot_notify( pubsub, 101UL, 100UL, 68UL );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( sink_state->cnt[ 0 ]==2UL && sink_state->cnt[ 2 ]==1UL );
+  FD_TEST( strstr( sink_state->last[ 2 ], "\"slot\":101}" ) );
+
+  FD_TEST( !fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_ACCOUNT, id0 ) );
+  FD_TEST( fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_SLOT, id0 ) );
+  fd_rpc_pubsub_publish_begin( pubsub );
+  fd_rpc_pubsub_slot_notify( pubsub, 102UL, 101UL, 68UL );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( sink_state->cnt[ 0 ]==2UL && sink_state->cnt[ 2 ]==2UL );
+
+  fd_rpc_pubsub_delete( fd_rpc_pubsub_leave( pubsub ) );
+}
+
+static void
+test_signature( void ) {
+  fd_rpc_pubsub_t * pubsub = test_pubsub();
+
+  fd_signature_t sig; memset( &sig, 7, sizeof(fd_signature_t) );
+  ulong id0 = fd_rpc_pubsub_signature_subscribe( pubsub, 0UL, &sig, FD_RPC_PUBSUB_COMMITMENT_PROCESSED );
+  ulong id1 = fd_rpc_pubsub_signature_subscribe( pubsub, 1UL, &sig, FD_RPC_PUBSUB_COMMITMENT_FINALIZED );
+  ulong id2 = fd_rpc_pubsub_signature_subscribe( pubsub, 2UL, &sig, FD_RPC_PUBSUB_COMMITMENT_PROCESSED );
+  ulong idx = fd_rpc_pubsub_signature_first( pubsub );
+  FD_TEST( idx!=ULONG_MAX && fd_rpc_pubsub_signature_next( pubsub, idx )==ULONG_MAX );
+  FD_TEST( fd_signature_eq( fd_rpc_pubsub_signature_sig( pubsub, idx ), &sig ) );
+
+  /* Not found yet */
+  fd_rpc_pubsub_publish_begin( pubsub );
+  fd_rpc_pubsub_signature_publish( pubsub, idx, 5UL, 0, "null", 4UL );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( !sink_state->cnt[ 0 ] && !sink_state->cnt[ 1 ] && !sink_state->cnt[ 2 ] );
+
+  /* Processed fires the processed subscriptions, connection 2 is
+     behind and keeps it pending */
+  sink_state->room[ 2 ] = 0UL;
+  fd_rpc_pubsub_publish_begin( pubsub );
+  fd_rpc_pubsub_signature_publish( pubsub, idx, 6UL, FD_RPC_PUBSUB_COMMITMENT_PROCESSED, "null", 4UL );
+  fd_rpc_pubsub_publish_end( pubsub );
+  char expected[ 256 ];
+  FD_TEST( fd_cstr_printf_check( expected, sizeof(expected), NULL,
+    "{\"jsonrpc\":\"2.0\",\"method\":\"signatureNotification\",\"params\":{\"result\":{\"context\":{\"slot\":6},\"value\":{\"err\":null}},\"subscription\":%lu}}", id0 ) );
+  FD_TEST( !strcmp( sink_state->last[ 0 ], expected ) );
+  FD_TEST( sink_state->cnt[ 0 ]==1UL && !sink_state->cnt[ 1 ] && !sink_state->cnt[ 2 ] );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==2UL );
+  FD_TEST( !fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_SIGNATURE, id0 ) );
+
+  /* Finalized fires the rest */
+  sink_state->room[ 2 ] = ULONG_MAX;
+  fd_rpc_pubsub_publish_begin( pubsub );
+  fd_rpc_pubsub_signature_publish( pubsub, idx, 7UL, FD_RPC_PUBSUB_COMMITMENT_FINALIZED, "\"AccountInUse\"", 14UL );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( sink_state->cnt[ 0 ]==1UL && sink_state->cnt[ 1 ]==1UL && sink_state->cnt[ 2 ]==1UL );
+  FD_TEST( strstr( sink_state->last[ 1 ], "\"value\":{\"err\":\"AccountInUse\"}}" ) );
+  FD_TEST( sub_id( sink_state->last[ 1 ] )==id1 );
+  FD_TEST( sub_id( sink_state->last[ 2 ] )==id2 );
+  FD_TEST( fd_rpc_pubsub_signature_first( pubsub )==ULONG_MAX );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==0UL );
+
+  fd_rpc_pubsub_delete( fd_rpc_pubsub_leave( pubsub ) );
+}
+
+static void
+test_close_in_pass( void ) {
+  fd_rpc_pubsub_t * pubsub = test_pubsub();
+
+  for( ulong i=0UL; i<CONN_MAX; i++ ) FD_TEST( fd_rpc_pubsub_slot_subscribe( pubsub, i )!=ULONG_MAX );
+
+  /* Sending to the first subscriber closes the last connection, which
+     must then be skipped */
+  sink_state->close_on_send = CONN_MAX-1UL;
+  fd_rpc_pubsub_publish_begin( pubsub );
+  fd_rpc_pubsub_slot_notify( pubsub, 1UL, 0UL, 0UL );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==CONN_MAX );
+  fd_rpc_pubsub_publish_end( pubsub );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==CONN_MAX-1UL );
+  for( ulong i=0UL; i<CONN_MAX-1UL; i++ ) FD_TEST( sink_state->cnt[ i ]==1UL );
+  FD_TEST( !sink_state->cnt[ CONN_MAX-1UL ] );
+
+  fd_rpc_pubsub_delete( fd_rpc_pubsub_leave( pubsub ) );
+}
+
+static void
+test_full( void ) {
+  fd_rpc_pubsub_t * pubsub = test_pubsub();
+
+  fd_pubkey_t key;
+  ulong ids[ SUB_MAX ];
+  for( ulong i=0UL; i<SUB_MAX; i++ ) {
+    memset( &key, 0, sizeof(fd_pubkey_t) ); key.ul[ 0 ] = i;
+    ids[ i ] = fd_rpc_pubsub_account_subscribe( pubsub, i%CONN_MAX, &key, FD_RPC_PUBSUB_SLOT_UNKNOWN );
+    FD_TEST( ids[ i ]!=ULONG_MAX );
+  }
+  FD_TEST( fd_rpc_pubsub_slot_subscribe( pubsub, 0UL )==ULONG_MAX );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_fail_cnt==1UL );
+
+  /* Ids are not reused */
+  FD_TEST( fd_rpc_pubsub_unsubscribe( pubsub, 0UL, FD_RPC_PUBSUB_KIND_ACCOUNT, ids[ 0 ] ) );
+  ulong id = fd_rpc_pubsub_slot_subscribe( pubsub, 0UL );
+  FD_TEST( id!=ULONG_MAX );
+  for( ulong i=0UL; i<SUB_MAX; i++ ) FD_TEST( id!=ids[ i ] );
+
+  for( ulong i=0UL; i<CONN_MAX; i++ ) fd_rpc_pubsub_conn_close( pubsub, i );
+  FD_TEST( fd_rpc_pubsub_metrics( pubsub )->sub_cnt==0UL );
+  FD_TEST( fd_rpc_pubsub_account_first( pubsub )==ULONG_MAX );
+
+  fd_rpc_pubsub_delete( fd_rpc_pubsub_leave( pubsub ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  test_new_join();
+  test_account();
+  test_conflate();
+  test_slot();
+  test_signature();
+  test_close_in_pass();
+  test_full();
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
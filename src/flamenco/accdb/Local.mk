@@ -2,6 +2,10 @@
 $(call add-hdrs,fd_accdb_admin.h)
 $(call add-objs,fd_accdb_admin,fd_flamenco)
 
+# Secondary indexes
+$(call add-hdrs,fd_accdb_owner_idx.h)
+$(call add-objs,fd_accdb_owner_idx,fd_flamenco)
+
 # User API
 $(call add-hdrs,fd_accdb_user.h fd_accdb_sync.h)
 
@@ -27,6 +31,8 @@ endif
 ifdef FD_HAS_ATOMIC
 $(call make-unit-test,test_accdb_v1,test_accdb_v1,fd_flamenco fd_funk fd_util)
 $(call run-unit-test,test_accdb_v1)
+$(call make-unit-test,test_accdb_owner_idx,test_accdb_owner_idx,fd_flamenco fd_funk fd_util)
+$(call run-unit-test,test_accdb_owner_idx)
 ifdef FD_HAS_LZ4
 $(call make-unit-test,test_accdb_v2,test_accdb_v2,fd_flamenco fd_vinyl fd_funk fd_tango fd_util)
 endif
@@ -1,4 +1,5 @@
 #include "fd_accdb_admin.h"
+#include "fd_accdb_owner_idx.h"
 #include "../fd_flamenco_base.h"
 
 fd_accdb_admin_t *
@@ -31,6 +32,13 @@ fd_accdb_admin_leave( fd_accdb_admin_t * admin,
   return admin;
 }
 
+void
+fd_accdb_admin_owner_idx_set( fd_accdb_admin_t *     admin,
+                              fd_accdb_owner_idx_t * owner_idx ) {
+  admin->owner_idx = owner_idx;
+  if( owner_idx ) fd_accdb_owner_idx_rebuild( owner_idx, admin->funk );
+}
+
 /* Begin transaction-level operations.  It is assumed that funk_txn data
    structures are not concurrently modified.  This includes txn_pool and
    txn_map. */
@@ -289,7 +297,8 @@ fd_accdb_publish_recs( fd_accdb_admin_t * accdb,
   uint head = txn->rec_head_idx;
   txn->rec_head_idx = FD_FUNK_REC_IDX_NULL;
   txn->rec_tail_idx = FD_FUNK_REC_IDX_NULL;
-  fd_wksp_t * funk_wksp = accdb->funk->wksp;
+  fd_wksp_t *            funk_wksp = accdb->funk->wksp;
+  fd_accdb_owner_idx_t * owner_idx = accdb->owner_idx;
   while( !fd_funk_rec_idx_is_null( head ) ) {
     fd_funk_rec_t * rec = &accdb->funk->rec_pool->ele[ head ];
 
@@ -309,9 +318,11 @@ fd_accdb_publish_recs( fd_accdb_admin_t * accdb,
       rec->next_idx = FD_FUNK_REC_IDX_NULL;
       fd_funk_txn_xid_t const root = { .ul = { ULONG_MAX, ULONG_MAX } };
       fd_funk_txn_xid_st_atomic( rec->pair.xid, &root );
+      if( owner_idx ) fd_accdb_owner_idx_upsert( owner_idx, rec->pair.key, meta->owner );
       accdb->metrics.root_cnt++;
     } else {
       /* Remove record */
+      if( owner_idx ) fd_accdb_owner_idx_remove( owner_idx, rec->pair.key );
       fd_accdb_chain_reclaim( accdb, rec );
     }
 
@@ -493,6 +504,7 @@ fd_accdb_clear( fd_accdb_admin_t * cache ) {
   fd_funk_t * funk = cache->funk;
   clear_txn_list( funk, fd_funk_txn_idx( funk->shmem->child_head_cidx ) );
   reset_rec_map( funk );
+  if( cache->owner_idx ) fd_accdb_owner_idx_reset( cache->owner_idx );
 }
 
 void
@@ -3,9 +3,15 @@
 
 #include "../../funk/fd_funk.h"
 
+struct fd_accdb_owner_idx;
+typedef struct fd_accdb_owner_idx fd_accdb_owner_idx_t;
+
 struct fd_accdb_admin {
   fd_funk_t funk[1];
 
+  /* Optional owner secondary index, updated as records are rooted */
+  fd_accdb_owner_idx_t * owner_idx;
+
   struct {
     ulong root_cnt;     /* moved to database root */
     ulong reclaim_cnt;  /* 0 lamport account removed while rooting */
@@ -26,6 +32,17 @@ void *
 fd_accdb_admin_leave( fd_accdb_admin_t * admin,
                       void **            opt_shfunk );
 
+/* fd_accdb_admin_owner_idx_set attaches an owner index (see
+   fd_accdb_owner_idx.h) to the admin join, or detaches it if owner_idx
+   is NULL.  On attach, the index is rebuilt from the current database
+   root (O(rec_max)).  From then on, it is updated incrementally by
+   fd_accdb_advance_root and fd_accdb_clear.  Any other writer to the
+   database root must keep the index in sync itself. */
+
+void
+fd_accdb_admin_owner_idx_set( fd_accdb_admin_t *     admin,
+                              fd_accdb_owner_idx_t * owner_idx );
+
 /* Transaction-level operations ***************************************/
 
 /* FIXME rename these to?
@@ -0,0 +1,423 @@
+#include "fd_accdb_owner_idx.h"
+#include "fd_accdb_impl_v1.h"
+#include "fd_accdb_sync.h"
+#if FD_HAS_AVX
+#include "../../util/simd/fd_avx.h"
+#endif
+
+ulong
+fd_accdb_owner_idx_align( void ) {
+  return alignof(fd_accdb_owner_idx_shmem_t);
+}
+
+ulong
+fd_accdb_owner_idx_footprint( ulong ele_max,
+                              ulong grp_max ) {
+  if( FD_UNLIKELY( !ele_max || ele_max>=(ulong)UINT_MAX ) ) return 0UL;
+  if( FD_UNLIKELY( !grp_max || grp_max>=(ulong)UINT_MAX ) ) return 0UL;
+  ulong ele_chain_cnt = fd_accdb_owner_ele_map_chain_cnt_est( ele_max );
+  ulong grp_chain_cnt = fd_accdb_owner_grp_map_chain_cnt_est( grp_max );
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, alignof(fd_accdb_owner_idx_shmem_t), sizeof(fd_accdb_owner_idx_shmem_t)                  );
+  l = FD_LAYOUT_APPEND( l, fd_accdb_owner_ele_pool_align(),     fd_accdb_owner_ele_pool_footprint( ele_max )       );
+  l = FD_LAYOUT_APPEND( l, fd_accdb_owner_ele_map_align(),      fd_accdb_owner_ele_map_footprint( ele_chain_cnt )  );
+  l = FD_LAYOUT_APPEND( l, fd_accdb_owner_grp_pool_align(),     fd_accdb_owner_grp_pool_footprint( grp_max )       );
+  l = FD_LAYOUT_APPEND( l, fd_accdb_owner_grp_map_align(),      fd_accdb_owner_grp_map_footprint( grp_chain_cnt )  );
+  return FD_LAYOUT_FINI( l, fd_accdb_owner_idx_align() );
+}
+
+void *
+fd_accdb_owner_idx_new( void * shmem,
+                        ulong  ele_max,
+                        ulong  grp_max,
+                        ulong  seed ) {
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_accdb_owner_idx_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !fd_accdb_owner_idx_footprint( ele_max, grp_max ) ) ) {
+    FD_LOG_WARNING(( "invalid ele_max %lu or grp_max %lu", ele_max, grp_max ));
+    return NULL;
+  }
+
+  ulong ele_chain_cnt = fd_accdb_owner_ele_map_chain_cnt_est( ele_max );
+  ulong grp_chain_cnt = fd_accdb_owner_grp_map_chain_cnt_est( grp_max );
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_accdb_owner_idx_shmem_t * hdr = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_accdb_owner_idx_shmem_t), sizeof(fd_accdb_owner_idx_shmem_t)                 );
+  void * ele_pool                  = FD_SCRATCH_ALLOC_APPEND( l, fd_accdb_owner_ele_pool_align(),     fd_accdb_owner_ele_pool_footprint( ele_max )      );
+  void * ele_map                   = FD_SCRATCH_ALLOC_APPEND( l, fd_accdb_owner_ele_map_align(),      fd_accdb_owner_ele_map_footprint( ele_chain_cnt ) );
+  void * grp_pool                  = FD_SCRATCH_ALLOC_APPEND( l, fd_accdb_owner_grp_pool_align(),     fd_accdb_owner_grp_pool_footprint( grp_max )      );
+  void * grp_map                   = FD_SCRATCH_ALLOC_APPEND( l, fd_accdb_owner_grp_map_align(),      fd_accdb_owner_grp_map_footprint( grp_chain_cnt ) );
+  FD_SCRATCH_ALLOC_FINI( l, fd_accdb_owner_idx_align() );
+
+  memset( hdr, 0, sizeof(fd_accdb_owner_idx_shmem_t) );
+  hdr->ele_max      = ele_max;
+  hdr->grp_max      = grp_max;
+  hdr->ele_pool_off = (ulong)ele_pool - (ulong)shmem;
+  hdr->ele_map_off  = (ulong)ele_map  - (ulong)shmem;
+  hdr->grp_pool_off = (ulong)grp_pool - (ulong)shmem;
+  hdr->grp_map_off  = (ulong)grp_map  - (ulong)shmem;
+
+  FD_TEST( fd_accdb_owner_ele_pool_new( ele_pool, ele_max                ) );
+  FD_TEST( fd_accdb_owner_ele_map_new ( ele_map,  ele_chain_cnt, seed    ) );
+  FD_TEST( fd_accdb_owner_grp_pool_new( grp_pool, grp_max                ) );
+  FD_TEST( fd_accdb_owner_grp_map_new ( grp_map,  grp_chain_cnt, seed+1UL ) );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( hdr->magic ) = FD_ACCDB_OWNER_IDX_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_accdb_owner_idx_t *
+fd_accdb_owner_idx_join( fd_accdb_owner_idx_t * ljoin,
+                         void *                 shidx ) {
+  if( FD_UNLIKELY( !ljoin ) ) {
+    FD_LOG_WARNING(( "NULL ljoin" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !shidx ) ) {
+    FD_LOG_WARNING(( "NULL shidx" ));
+    return NULL;
+  }
+  fd_accdb_owner_idx_shmem_t * hdr = shidx;
+  if( FD_UNLIKELY( hdr->magic!=FD_ACCDB_OWNER_IDX_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  memset( ljoin, 0, sizeof(fd_accdb_owner_idx_t) );
+  ljoin->shmem    = hdr;
+  ljoin->ele_pool = fd_accdb_owner_ele_pool_join( (uchar *)shidx + hdr->ele_pool_off );
+  ljoin->ele_map  = fd_accdb_owner_ele_map_join ( (uchar *)shidx + hdr->ele_map_off  );
+  ljoin->grp_pool = fd_accdb_owner_grp_pool_join( (uchar *)shidx + hdr->grp_pool_off );
+  ljoin->grp_map  = fd_accdb_owner_grp_map_join ( (uchar *)shidx + hdr->grp_map_off  );
+  if( FD_UNLIKELY( !ljoin->ele_pool || !ljoin->ele_map || !ljoin->grp_pool || !ljoin->grp_map ) ) {
+    FD_LOG_WARNING(( "corrupt owner index" ));
+    return NULL;
+  }
+  return ljoin;
+}
+
+void *
+fd_accdb_owner_idx_leave( fd_accdb_owner_idx_t * idx ) {
+  if( FD_UNLIKELY( !idx ) ) {
+    FD_LOG_WARNING(( "NULL idx" ));
+    return NULL;
+  }
+  void * shidx = idx->shmem;
+  fd_accdb_owner_ele_pool_leave( idx->ele_pool );
+  fd_accdb_owner_ele_map_leave ( idx->ele_map  );
+  fd_accdb_owner_grp_pool_leave( idx->grp_pool );
+  fd_accdb_owner_grp_map_leave ( idx->grp_map  );
+  memset( idx, 0, sizeof(fd_accdb_owner_idx_t) );
+  return shidx;
+}
+
+void *
+fd_accdb_owner_idx_delete( void * shidx ) {
+  if( FD_UNLIKELY( !shidx ) ) {
+    FD_LOG_WARNING(( "NULL shidx" ));
+    return NULL;
+  }
+  fd_accdb_owner_idx_shmem_t * hdr = shidx;
+  if( FD_UNLIKELY( hdr->magic!=FD_ACCDB_OWNER_IDX_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( hdr->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+  return shidx;
+}
+
+ulong
+fd_accdb_owner_idx_owner_cnt( fd_accdb_owner_idx_t const * idx,
+                              void const *                 owner ) {
+  fd_pubkey_t key = FD_LOAD( fd_pubkey_t, owner );
+  fd_accdb_owner_grp_t const * grp = fd_accdb_owner_grp_map_ele_query_const( idx->grp_map, &key, NULL, idx->grp_pool );
+  return grp ? grp->cnt : 0UL;
+}
+
+/* fd_accdb_owner_list_unlink removes ele from its owner list, and
+   frees the owner group if it became empty. */
+
+static void
+fd_accdb_owner_list_unlink( fd_accdb_owner_idx_t * idx,
+                            fd_accdb_owner_ele_t * ele ) {
+  fd_accdb_owner_ele_t * ele_pool = idx->ele_pool;
+  fd_accdb_owner_grp_t * grp      = idx->grp_pool + ele->grp_idx;
+
+  if( ele->prev_idx!=FD_ACCDB_OWNER_IDX_NULL ) ele_pool[ ele->prev_idx ].next_idx = ele->next_idx;
+  else                                         grp->head_idx                      = ele->next_idx;
+  if( ele->next_idx!=FD_ACCDB_OWNER_IDX_NULL ) ele_pool[ ele->next_idx ].prev_idx = ele->prev_idx;
+  ele->prev_idx = FD_ACCDB_OWNER_IDX_NULL;
+  ele->next_idx = FD_ACCDB_OWNER_IDX_NULL;
+  ele->grp_idx  = FD_ACCDB_OWNER_IDX_NULL;
+
+  if( !--grp->cnt ) {
+    fd_accdb_owner_grp_map_ele_remove( idx->grp_map, &grp->owner, NULL, idx->grp_pool );
+    fd_accdb_owner_grp_pool_ele_release( idx->grp_pool, grp );
+  }
+}
+
+/* fd_accdb_owner_list_link adds ele to the head of owner's list,
+   creating the owner group if necessary. */
+
+static void
+fd_accdb_owner_list_link( fd_accdb_owner_idx_t * idx,
+                          fd_accdb_owner_ele_t * ele,
+                          fd_pubkey_t const *    owner ) {
+  fd_accdb_owner_grp_t * grp = fd_accdb_owner_grp_map_ele_query( idx->grp_map, owner, NULL, idx->grp_pool );
+  if( !grp ) {
+    if( FD_UNLIKELY( !fd_accdb_owner_grp_pool_free( idx->grp_pool ) ) ) {
+      FD_LOG_CRIT(( "owner index is full (grp_max=%lu), increase the owner index size", idx->shmem->grp_max ));
+    }
+    grp = fd_accdb_owner_grp_pool_ele_acquire( idx->grp_pool );
+    grp->owner    = *owner;
+    grp->cnt      = 0UL;
+    grp->head_idx = FD_ACCDB_OWNER_IDX_NULL;
+    fd_accdb_owner_grp_map_ele_insert( idx->grp_map, grp, idx->grp_pool );
+  }
+
+  uint ele_idx = (uint)( ele - idx->ele_pool );
+  ele->grp_idx  = (uint)( grp - idx->grp_pool );
+  ele->prev_idx = FD_ACCDB_OWNER_IDX_NULL;
+  ele->next_idx = grp->head_idx;
+  if( grp->head_idx!=FD_ACCDB_OWNER_IDX_NULL ) idx->ele_pool[ grp->head_idx ].prev_idx = ele_idx;
+  grp->head_idx = ele_idx;
+  grp->cnt++;
+}
+
+void
+fd_accdb_owner_idx_upsert( fd_accdb_owner_idx_t * idx,
+                           void const *           address,
+                           void const *           owner ) {
+  fd_pubkey_t addr_key  = FD_LOAD( fd_pubkey_t, address );
+  fd_pubkey_t owner_key = FD_LOAD( fd_pubkey_t, owner   );
+
+  fd_accdb_owner_ele_t * ele = fd_accdb_owner_ele_map_ele_query( idx->ele_map, &addr_key, NULL, idx->ele_pool );
+  if( ele ) {
+    /* Optimize for owner unchanged */
+    if( FD_LIKELY( fd_pubkey_eq( &idx->grp_pool[ ele->grp_idx ].owner, &owner_key ) ) ) return;
+    fd_accdb_owner_list_unlink( idx, ele );
+  } else {
+    if( FD_UNLIKELY( !fd_accdb_owner_ele_pool_free( idx->ele_pool ) ) ) {
+      FD_LOG_CRIT(( "owner index is full (ele_max=%lu), increase the owner index size", idx->shmem->ele_max ));
+    }
+    ele = fd_accdb_owner_ele_pool_ele_acquire( idx->ele_pool );
+    ele->addr = addr_key;
+    fd_accdb_owner_ele_map_ele_insert( idx->ele_map, ele, idx->ele_pool );
+  }
+  fd_accdb_owner_list_link( idx, ele, &owner_key );
+}
+
+void
+fd_accdb_owner_idx_remove( fd_accdb_owner_idx_t * idx,
+                           void const *           address ) {
+  fd_pubkey_t addr_key = FD_LOAD( fd_pubkey_t, address );
+  fd_accdb_owner_ele_t * ele = fd_accdb_owner_ele_map_ele_remove( idx->ele_map, &addr_key, NULL, idx->ele_pool );
+  if( !ele ) return;
+  fd_accdb_owner_list_unlink( idx, ele );
+  fd_accdb_owner_ele_pool_ele_release( idx->ele_pool, ele );
+}
+
+void
+fd_accdb_owner_idx_reset( fd_accdb_owner_idx_t * idx ) {
+  fd_accdb_owner_ele_pool_reset( idx->ele_pool );
+  fd_accdb_owner_ele_map_reset ( idx->ele_map  );
+  fd_accdb_owner_grp_pool_reset( idx->grp_pool );
+  fd_accdb_owner_grp_map_reset ( idx->grp_map  );
+}
+
+void
+fd_accdb_owner_idx_rebuild( fd_accdb_owner_idx_t * idx,
+                            fd_funk_t *            funk ) {
+  fd_accdb_owner_idx_reset( idx );
+
+  fd_wksp_t *         wksp    = funk->wksp;
+  fd_funk_rec_map_t * rec_map = funk->rec_map;
+  ulong chain_cnt = fd_funk_rec_map_chain_cnt( rec_map );
+  for( ulong chain_idx=0UL; chain_idx<chain_cnt; chain_idx++ ) {
+    for( fd_funk_rec_map_iter_t iter = fd_funk_rec_map_iter( rec_map, chain_idx );
+         !fd_funk_rec_map_iter_done( iter );
+         iter = fd_funk_rec_map_iter_next( iter ) ) {
+      fd_funk_rec_t const * rec = fd_funk_rec_map_iter_ele_const( iter );
+      if( !fd_funk_txn_xid_eq_root( rec->pair.xid ) ) continue;
+      fd_account_meta_t const * meta = fd_funk_val_const( rec, wksp );
+      if( FD_UNLIKELY( !meta || rec->val_sz<sizeof(fd_account_meta_t) ) ) continue;
+      if( !meta->lamports ) continue;
+      fd_accdb_owner_idx_upsert( idx, rec->pair.key, meta->owner );
+    }
+  }
+}
+
+/* fd_accdb_filter_memeq compares sz bytes at a and b.  Filter patterns
+   are up to 128 bytes, so with AVX this is at most 4 compares plus a
+   short tail. */
+
+static inline int
+fd_accdb_filter_memeq( uchar const * a,
+                       uchar const * b,
+                       ulong         sz ) {
+# if FD_HAS_AVX
+  ulong i = 0UL;
+  for( ; i+32UL<=sz; i+=32UL ) {
+    if( !wb_all_fast( wb_eq( wb_ldu( a+i ), wb_ldu( b+i ) ) ) ) return 0;
+  }
+  return !memcmp( a+i, b+i, sz-i );
+# else
+  return !memcmp( a, b, sz );
+# endif
+}
+
+int
+fd_accdb_filter_match( fd_accdb_filter_t const * filter,
+                       ulong                     filter_cnt,
+                       uchar const *             data,
+                       ulong                     data_sz ) {
+  for( ulong i=0UL; i<filter_cnt; i++ ) {
+    fd_accdb_filter_t const * f = filter+i;
+    switch( f->type ) {
+    case FD_ACCDB_FILTER_DATA_SZ:
+      if( data_sz!=f->data_sz ) return 0;
+      break;
+    case FD_ACCDB_FILTER_MEMCMP:
+      if( f->off>data_sz || f->sz>data_sz-f->off ) return 0;
+      if( !fd_accdb_filter_memeq( data+f->off, f->bytes, f->sz ) ) return 0;
+      break;
+    default:
+      return 0;
+    }
+  }
+  return 1;
+}
+
+ulong
+fd_accdb_program_accounts( fd_accdb_owner_idx_t const *   idx,
+                           fd_accdb_user_t *              accdb,
+                           fd_funk_txn_xid_t const *      xid,
+                           void const *                   owner,
+                           fd_accdb_filter_t const *      filter,
+                           ulong                          filter_cnt,
+                           fd_accdb_program_accounts_cb_t cb,
+                           void *                         cb_ctx ) {
+  if( FD_UNLIKELY( accdb->base.accdb_type!=FD_ACCDB_TYPE_V1 ) ) {
+    FD_LOG_CRIT(( "fd_accdb_program_accounts: unsupported accdb type %u", accdb->base.accdb_type ));
+  }
+  fd_funk_t *       funk     = fd_accdb_user_v1_funk( accdb );
+  fd_wksp_t *       wksp     = funk->wksp;
+  fd_funk_rec_t *   rec_tbl  = funk->rec_pool->ele;
+  fd_funk_txn_t *   txn_tbl  = funk->txn_pool->ele;
+  fd_pubkey_t       owner_key = FD_LOAD( fd_pubkey_t, owner );
+  ulong             hit_cnt  = 0UL;
+
+  /* Phase 1: Visit accounts modified by unrooted fork nodes between xid
+     and the root.  A record is only considered if it is the newest
+     revision of that account as seen from xid. */
+
+  fd_funk_txn_t const * txn = NULL;
+  fd_funk_txn_map_query_t txn_query[1];
+  if( fd_funk_txn_map_query_try( funk->txn_map, xid, NULL, txn_query, 0 )==FD_MAP_SUCCESS ) {
+    txn = fd_funk_txn_map_query_ele( txn_query );
+  }
+  for( ulong depth=0UL; txn; depth++ ) {
+    if( FD_UNLIKELY( depth>=FD_ACCDB_DEPTH_MAX ) ) FD_LOG_CRIT(( "fork depth exceeds FD_ACCDB_DEPTH_MAX (cycle in fork graph?)" ));
+
+    for( uint rec_idx=txn->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx=rec_tbl[ rec_idx ].next_idx ) {
+      fd_funk_rec_t const *     rec  = rec_tbl + rec_idx;
+      fd_account_meta_t const * meta = fd_funk_val_const( rec, wksp );
+      if( FD_UNLIKELY( !meta || rec->val_sz<sizeof(fd_account_meta_t) ) ) continue;
+      if( !meta->lamports                                                ) continue;
+      if( memcmp( meta->owner, owner_key.uc, sizeof(fd_pubkey_t) )       ) continue;
+
+      fd_accdb_peek_t peek[1];
+      if( !fd_accdb_peek( accdb, peek, xid, rec->pair.key ) ) continue;
+      int newest = peek->acc->rec==rec;
+      fd_accdb_peek_drop( peek );
+      if( !newest ) continue;
+
+      if( !fd_accdb_filter_match( filter, filter_cnt, fd_account_data( meta ), meta->dlen ) ) continue;
+      hit_cnt++;
+      if( cb( cb_ctx, rec->pair.key, meta ) ) return hit_cnt;
+    }
+
+    ulong parent_idx = fd_funk_txn_idx( txn->parent_cidx );
+    txn = fd_funk_txn_idx_is_null( parent_idx ) ? NULL : txn_tbl + parent_idx;
+  }
+
+  /* Phase 2: Visit rooted accounts.  Accounts that were modified or
+     deleted by the fork were already handled above. */
+
+  fd_accdb_owner_grp_t const * grp = fd_accdb_owner_grp_map_ele_query_const( idx->grp_map, &owner_key, NULL, idx->grp_pool );
+  if( !grp ) return hit_cnt;
+
+  for( uint ele_idx=grp->head_idx; ele_idx!=FD_ACCDB_OWNER_IDX_NULL; ele_idx=idx->ele_pool[ ele_idx ].next_idx ) {
+    fd_accdb_owner_ele_t const * ele = idx->ele_pool + ele_idx;
+
+    fd_accdb_peek_t peek[1];
+    if( !fd_accdb_peek( accdb, peek, xid, ele->addr.uc ) ) continue;
+    fd_accdb_ro_t const * ro = peek->acc;
+    int visit =
+      fd_funk_txn_xid_eq_root( ro->rec->pair.xid ) &&
+      !memcmp( fd_accdb_ref_owner( ro ), owner_key.uc, sizeof(fd_pubkey_t) ) &&
+      fd_accdb_filter_match( filter, filter_cnt, fd_accdb_ref_data_const( ro ), fd_accdb_ref_data_sz( ro ) );
+    int stop = 0;
+    if( visit ) {
+      hit_cnt++;
+      stop = cb( cb_ctx, ele->addr.uc, ro->meta );
+    }
+    fd_accdb_peek_drop( peek );
+    if( stop ) break;
+  }
+
+  return hit_cnt;
+}
+
+int
+fd_accdb_owner_idx_verify( fd_accdb_owner_idx_t const * idx ) {
+# define TEST(c) do { if( FD_UNLIKELY( !(c) ) ) { FD_LOG_WARNING(( "FAIL: %s", #c )); return -1; } } while(0)
+
+  ulong ele_max = idx->shmem->ele_max;
+  ulong grp_max = idx->shmem->grp_max;
+  TEST( !fd_accdb_owner_ele_map_verify( idx->ele_map, ele_max, idx->ele_pool ) );
+  TEST( !fd_accdb_owner_grp_map_verify( idx->grp_map, grp_max, idx->grp_pool ) );
+
+  /* Every owner list is well formed and owner lists account for every
+     indexed account exactly once */
+
+  ulong ele_cnt = 0UL;
+  ulong grp_cnt = 0UL;
+  for( fd_accdb_owner_grp_map_iter_t iter = fd_accdb_owner_grp_map_iter_init( idx->grp_map, idx->grp_pool );
+       !fd_accdb_owner_grp_map_iter_done( iter, idx->grp_map, idx->grp_pool );
+       iter = fd_accdb_owner_grp_map_iter_next( iter, idx->grp_map, idx->grp_pool ) ) {
+    fd_accdb_owner_grp_t const * grp = fd_accdb_owner_grp_map_iter_ele_const( iter, idx->grp_map, idx->grp_pool );
+    uint  grp_idx = (uint)( grp - idx->grp_pool );
+    ulong cnt     = 0UL;
+    uint  prev    = FD_ACCDB_OWNER_IDX_NULL;
+    TEST( grp->cnt );
+    for( uint ele_idx=grp->head_idx; ele_idx!=FD_ACCDB_OWNER_IDX_NULL; ele_idx=idx->ele_pool[ ele_idx ].next_idx ) {
+      TEST( ele_idx<ele_max );
+      TEST( cnt<grp->cnt );
+      fd_accdb_owner_ele_t const * ele = idx->ele_pool + ele_idx;
+      TEST( ele->grp_idx==grp_idx );
+      TEST( ele->prev_idx==prev );
+      TEST( fd_accdb_owner_ele_map_ele_query_const( idx->ele_map, &ele->addr, NULL, idx->ele_pool )==ele );
+      prev = ele_idx;
+      cnt++;
+    }
+    TEST( cnt==grp->cnt );
+    ele_cnt += cnt;
+    grp_cnt++;
+  }
+  TEST( ele_cnt==fd_accdb_owner_ele_pool_used( idx->ele_pool ) );
+  TEST( grp_cnt==fd_accdb_owner_grp_pool_used( idx->grp_pool ) );
+
+# undef TEST
+  return 0;
+}
@@ -0,0 +1,261 @@
+#ifndef HEADER_fd_src_flamenco_accdb_fd_accdb_owner_idx_h
+#define HEADER_fd_src_flamenco_accdb_fd_accdb_owner_idx_h
+
+/* fd_accdb_owner_idx.h provides a secondary index over the account
+   database mapping an owner (program) address to the set of account
+   addresses it owns.  This backs RPC methods like getProgramAccounts,
+   which would otherwise require a full scan of the database.
+
+   The index only tracks the database root.  At the root, every account
+   has exactly one owner, so the index is keyed by account address, and
+   each entry is threaded into a doubly linked list hanging off a per-
+   owner group.  It is maintained incrementally by fd_accdb_admin as
+   records are rooted or reclaimed (see fd_accdb_admin_owner_idx_set).
+
+   Unrooted forks are small (at most FD_ACCDB_DEPTH_MAX slots), so
+   queries against an unrooted fork node overlay the root index with a
+   walk over the records of each transaction between the fork node and
+   the root.  Every candidate is confirmed against the account database
+   itself, so the index never produces stale results; it only narrows
+   down the set of accounts to look at. */
+
+#include "fd_accdb_user.h"
+#include "../types/fd_types_custom.h"
+
+/* fd_accdb_owner_ele_t is an account in the owner index. */
+
+struct fd_accdb_owner_ele {
+  fd_pubkey_t addr;
+  uint        grp_idx;   /* index of owner group */
+  uint        prev_idx;  /* owner list */
+  uint        next_idx;  /* owner list */
+  uint        map_next;  /* addr map chain / pool free list */
+};
+
+typedef struct fd_accdb_owner_ele fd_accdb_owner_ele_t;
+
+/* fd_accdb_owner_grp_t is the list of accounts owned by a program. */
+
+struct fd_accdb_owner_grp {
+  fd_pubkey_t owner;
+  ulong       cnt;       /* number of accounts in list */
+  uint        head_idx;  /* first account */
+  uint        map_next;  /* owner map chain / pool free list */
+};
+
+typedef struct fd_accdb_owner_grp fd_accdb_owner_grp_t;
+
+#define FD_ACCDB_OWNER_IDX_NULL (UINT_MAX)
+
+#define POOL_NAME  fd_accdb_owner_ele_pool
+#define POOL_T     fd_accdb_owner_ele_t
+#define POOL_NEXT  map_next
+#define POOL_IDX_T uint
+#include "../../util/tmpl/fd_pool.c"
+
+#define MAP_NAME          fd_accdb_owner_ele_map
+#define MAP_ELE_T         fd_accdb_owner_ele_t
+#define MAP_KEY_T         fd_pubkey_t
+#define MAP_KEY           addr
+#define MAP_IDX_T         uint
+#define MAP_NEXT          map_next
+#define MAP_KEY_EQ(k0,k1) fd_pubkey_eq( (k0), (k1) )
+#define MAP_KEY_HASH(k,s) fd_hash( (s), (k)->uc, sizeof(fd_pubkey_t) )
+#include "../../util/tmpl/fd_map_chain.c"
+
+#define POOL_NAME  fd_accdb_owner_grp_pool
+#define POOL_T     fd_accdb_owner_grp_t
+#define POOL_NEXT  map_next
+#define POOL_IDX_T uint
+#include "../../util/tmpl/fd_pool.c"
+
+#define MAP_NAME          fd_accdb_owner_grp_map
+#define MAP_ELE_T         fd_accdb_owner_grp_t
+#define MAP_KEY_T         fd_pubkey_t
+#define MAP_KEY           owner
+#define MAP_IDX_T         uint
+#define MAP_NEXT          map_next
+#define MAP_KEY_EQ(k0,k1) fd_pubkey_eq( (k0), (k1) )
+#define MAP_KEY_HASH(k,s) fd_hash( (s), (k)->uc, sizeof(fd_pubkey_t) )
+#include "../../util/tmpl/fd_map_chain.c"
+
+#define FD_ACCDB_OWNER_IDX_MAGIC (0xf17eda2ce7a0101dUL) /* firedancer owner idx version 1 */
+
+/* fd_accdb_owner_idx_shmem_t is the header of an owner index in shared
+   memory.  Sub-structures are addressed by offset from the header, so
+   the index is position independent. */
+
+struct __attribute__((aligned(64))) fd_accdb_owner_idx_shmem {
+  ulong magic;
+  ulong ele_max;
+  ulong grp_max;
+  ulong ele_pool_off;
+  ulong ele_map_off;
+  ulong grp_pool_off;
+  ulong grp_map_off;
+};
+
+typedef struct fd_accdb_owner_idx_shmem fd_accdb_owner_idx_shmem_t;
+
+/* fd_accdb_owner_idx_t is a local join to an owner index. */
+
+struct fd_accdb_owner_idx {
+  fd_accdb_owner_idx_shmem_t * shmem;
+  fd_accdb_owner_ele_t *       ele_pool;
+  fd_accdb_owner_ele_map_t *   ele_map;
+  fd_accdb_owner_grp_t *       grp_pool;
+  fd_accdb_owner_grp_map_t *   grp_map;
+};
+
+typedef struct fd_accdb_owner_idx fd_accdb_owner_idx_t;
+
+/* Account filters ****************************************************/
+
+/* fd_accdb_filter_t is a getProgramAccounts style account filter.
+   DATA_SZ matches accounts with exactly data_sz bytes of data.  MEMCMP
+   matches accounts whose data at byte offset off equals the sz bytes
+   at bytes.  An account passes a list of filters if it matches all of
+   them. */
+
+#define FD_ACCDB_FILTER_DATA_SZ (1)
+#define FD_ACCDB_FILTER_MEMCMP  (2)
+
+#define FD_ACCDB_FILTER_MEMCMP_MAX (128UL)
+#define FD_ACCDB_FILTER_MAX        (4UL)
+
+struct fd_accdb_filter {
+  uint  type;
+  uint  sz;
+  ulong off;
+  ulong data_sz;
+  uchar bytes[ FD_ACCDB_FILTER_MEMCMP_MAX ] __attribute__((aligned(32)));
+};
+
+typedef struct fd_accdb_filter fd_accdb_filter_t;
+
+/* fd_accdb_program_accounts_cb_t is called for every account matching
+   a program accounts query.  address points to the 32 byte account
+   address, meta to the account (data follows).  Both are only valid
+   for the duration of the call.  Return 0 to continue the query or
+   non-zero to stop it. */
+
+typedef int
+(* fd_accdb_program_accounts_cb_t)( void *                    ctx,
+                                    void const *              address,
+                                    fd_account_meta_t const * meta );
+
+FD_PROTOTYPES_BEGIN
+
+/* Constructors */
+
+ulong
+fd_accdb_owner_idx_align( void );
+
+ulong
+fd_accdb_owner_idx_footprint( ulong ele_max,
+                              ulong grp_max );
+
+void *
+fd_accdb_owner_idx_new( void * shmem,
+                        ulong  ele_max,
+                        ulong  grp_max,
+                        ulong  seed );
+
+fd_accdb_owner_idx_t *
+fd_accdb_owner_idx_join( fd_accdb_owner_idx_t * ljoin,
+                         void *                 shidx );
+
+void *
+fd_accdb_owner_idx_leave( fd_accdb_owner_idx_t * idx );
+
+void *
+fd_accdb_owner_idx_delete( void * shidx );
+
+/* Accessors */
+
+FD_FN_PURE static inline ulong
+fd_accdb_owner_idx_ele_cnt( fd_accdb_owner_idx_t const * idx ) {
+  return fd_accdb_owner_ele_pool_used( idx->ele_pool );
+}
+
+FD_FN_PURE static inline ulong
+fd_accdb_owner_idx_grp_cnt( fd_accdb_owner_idx_t const * idx ) {
+  return fd_accdb_owner_grp_pool_used( idx->grp_pool );
+}
+
+/* fd_accdb_owner_idx_owner_cnt returns the number of rooted accounts
+   owned by owner. */
+
+ulong
+fd_accdb_owner_idx_owner_cnt( fd_accdb_owner_idx_t const * idx,
+                              void const *                 owner );
+
+/* Modifiers.  These assume no concurrent users of the index. */
+
+/* fd_accdb_owner_idx_upsert records that the rooted account at address
+   is owned by owner, moving it between owner lists if it was previously
+   indexed under a different owner.  Terminates the app with
+   FD_LOG_CRIT if the index is out of space. */
+
+void
+fd_accdb_owner_idx_upsert( fd_accdb_owner_idx_t * idx,
+                           void const *           address,
+                           void const *           owner );
+
+/* fd_accdb_owner_idx_remove removes the account at address from the
+   index.  No-op if it is not indexed. */
+
+void
+fd_accdb_owner_idx_remove( fd_accdb_owner_idx_t * idx,
+                           void const *           address );
+
+/* fd_accdb_owner_idx_reset removes all entries from the index. */
+
+void
+fd_accdb_owner_idx_reset( fd_accdb_owner_idx_t * idx );
+
+/* fd_accdb_owner_idx_rebuild resets the index and re-populates it
+   from all rooted records in funk.  This is used to build the index
+   for a database restored outside of fd_accdb_advance_root (e.g. a
+   full snapshot loaded directly into the root).  O(rec_max). */
+
+void
+fd_accdb_owner_idx_rebuild( fd_accdb_owner_idx_t * idx,
+                            fd_funk_t *            funk );
+
+/* Queries */
+
+/* fd_accdb_filter_match returns 1 if the account data of data_sz bytes
+   at data passes all filter_cnt filters, and 0 otherwise. */
+
+int
+fd_accdb_filter_match( fd_accdb_filter_t const * filter,
+                       ulong                     filter_cnt,
+                       uchar const *             data,
+                       ulong                     data_sz );
+
+/* fd_accdb_program_accounts invokes cb for every account owned by
+   owner that is visible at fork node xid, is not deleted, and passes
+   all filter_cnt filters.  accdb must be a v1 (funk) database client.
+   xid should refer to a frozen fork node (or the root).  Returns the
+   number of callbacks made. */
+
+ulong
+fd_accdb_program_accounts( fd_accdb_owner_idx_t const *   idx,
+                           fd_accdb_user_t *              accdb,
+                           fd_funk_txn_xid_t const *      xid,
+                           void const *                   owner,
+                           fd_accdb_filter_t const *      filter,
+                           ulong                          filter_cnt,
+                           fd_accdb_program_accounts_cb_t cb,
+                           void *                         cb_ctx );
+
+/* fd_accdb_owner_idx_verify does expensive integrity checks.  Returns
+   0 on success and -1 on failure (logs details). */
+
+int
+fd_accdb_owner_idx_verify( fd_accdb_owner_idx_t const * idx );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_flamenco_accdb_fd_accdb_owner_idx_h */
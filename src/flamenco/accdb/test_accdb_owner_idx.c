@@ -0,0 +1,334 @@
+#include "fd_accdb_owner_idx.h"
+#include "fd_accdb_admin.h"
+#include "fd_accdb_sync.h"
+#include "fd_accdb_impl_v1.h"
+
+#define WKSP_TAG 1UL
+
+/* Test helpers */
+
+static fd_pubkey_t
+test_key( ulong x ) {
+  fd_pubkey_t key = {0};
+  key.ul[ 0 ] = x;
+  key.ul[ 3 ] = ~x;
+  return key;
+}
+
+static void
+test_put( fd_accdb_user_t *         accdb,
+          fd_funk_txn_xid_t const * xid,
+          ulong                     addr,
+          ulong                     owner,
+          ulong                     lamports,
+          void const *              data,
+          ulong                     data_sz ) {
+  fd_pubkey_t addr_key  = test_key( addr  );
+  fd_pubkey_t owner_key = test_key( owner );
+  fd_accdb_rw_t rw[1];
+  FD_TEST( fd_accdb_open_rw( accdb, rw, xid, &addr_key, data_sz, FD_ACCDB_FLAG_CREATE|FD_ACCDB_FLAG_TRUNCATE ) );
+  fd_accdb_ref_lamports_set( rw, lamports );
+  fd_accdb_ref_owner_set   ( rw, &owner_key );
+  fd_accdb_ref_data_set    ( rw, data, data_sz );
+  fd_accdb_close_rw( accdb, rw );
+}
+
+struct test_hits {
+  ulong addr[ 64 ];
+  ulong cnt;
+  ulong stop_after;
+};
+
+typedef struct test_hits test_hits_t;
+
+static int
+test_collect( void *                    ctx,
+              void const *              address,
+              fd_account_meta_t const * meta ) {
+  test_hits_t * hits = ctx;
+  FD_TEST( meta->lamports );
+  FD_TEST( hits->cnt<64UL );
+  hits->addr[ hits->cnt++ ] = FD_LOAD( ulong, address );
+  return hits->cnt==hits->stop_after;
+}
+
+/* test_query runs a program accounts query and checks that exactly the
+   addresses listed in expected (in any order) were returned. */
+
+static void
+test_query( fd_accdb_owner_idx_t const * idx,
+            fd_accdb_user_t *            accdb,
+            fd_funk_txn_xid_t const *    xid,
+            ulong                        owner,
+            fd_accdb_filter_t const *    filter,
+            ulong                        filter_cnt,
+            ulong const *                expected,
+            ulong                        expected_cnt ) {
+  fd_pubkey_t owner_key = test_key( owner );
+  test_hits_t hits = {0};
+  ulong hit_cnt = fd_accdb_program_accounts( idx, accdb, xid, &owner_key, filter, filter_cnt, test_collect, &hits );
+  FD_TEST( hit_cnt==hits.cnt );
+  if( FD_UNLIKELY( hits.cnt!=expected_cnt ) ) FD_LOG_ERR(( "expected %lu hits, got %lu", expected_cnt, hits.cnt ));
+  for( ulong i=0UL; i<expected_cnt; i++ ) {
+    ulong found = 0UL;
+    for( ulong j=0UL; j<hits.cnt; j++ ) found += hits.addr[ j ]==expected[ i ];
+    if( FD_UNLIKELY( found!=1UL ) ) FD_LOG_ERR(( "expected address %lu once, found %lu times", expected[ i ], found ));
+  }
+}
+
+/* test_idx_basic exercises index modifiers without a database */
+
+static void
+test_idx_basic( fd_wksp_t * wksp ) {
+  ulong ele_max = 64UL;
+  ulong grp_max = 8UL;
+  FD_TEST( !fd_accdb_owner_idx_footprint( 0UL, grp_max ) );
+  FD_TEST( !fd_accdb_owner_idx_footprint( ele_max, 0UL ) );
+  void * mem = fd_wksp_alloc_laddr( wksp, fd_accdb_owner_idx_align(), fd_accdb_owner_idx_footprint( ele_max, grp_max ), WKSP_TAG );
+  FD_TEST( mem );
+  FD_TEST( fd_accdb_owner_idx_new( mem, ele_max, grp_max, 42UL )==mem );
+  fd_accdb_owner_idx_t idx[1];
+  FD_TEST( fd_accdb_owner_idx_join( idx, mem )==idx );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==0UL );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+
+  fd_pubkey_t a = test_key( 1UL ); fd_pubkey_t b = test_key( 2UL ); fd_pubkey_t c = test_key( 3UL );
+  fd_pubkey_t x = test_key( 100UL ); fd_pubkey_t y = test_key( 101UL );
+
+  fd_accdb_owner_idx_upsert( idx, &a, &x );
+  fd_accdb_owner_idx_upsert( idx, &b, &x );
+  fd_accdb_owner_idx_upsert( idx, &c, &y );
+  fd_accdb_owner_idx_upsert( idx, &a, &x ); /* no-op */
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==3UL );
+  FD_TEST( fd_accdb_owner_idx_grp_cnt( idx )==2UL );
+  FD_TEST( fd_accdb_owner_idx_owner_cnt( idx, &x )==2UL );
+  FD_TEST( fd_accdb_owner_idx_owner_cnt( idx, &y )==1UL );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+
+  /* Owner change moves between lists and frees empty groups */
+  fd_accdb_owner_idx_upsert( idx, &c, &x );
+  FD_TEST( fd_accdb_owner_idx_owner_cnt( idx, &x )==3UL );
+  FD_TEST( fd_accdb_owner_idx_owner_cnt( idx, &y )==0UL );
+  FD_TEST( fd_accdb_owner_idx_grp_cnt( idx )==1UL );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+
+  /* Remove from the middle, head and tail of a list */
+  fd_accdb_owner_idx_remove( idx, &b );
+  fd_accdb_owner_idx_remove( idx, &b ); /* no-op */
+  FD_TEST( fd_accdb_owner_idx_owner_cnt( idx, &x )==2UL );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+  fd_accdb_owner_idx_remove( idx, &c );
+  fd_accdb_owner_idx_remove( idx, &a );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==0UL );
+  FD_TEST( fd_accdb_owner_idx_grp_cnt( idx )==0UL );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+
+  /* Fill up and reset */
+  for( ulong i=0UL; i<ele_max; i++ ) {
+    fd_pubkey_t addr  = test_key( 1000UL+i );
+    fd_pubkey_t owner = test_key( i%grp_max );
+    fd_accdb_owner_idx_upsert( idx, &addr, &owner );
+  }
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==ele_max );
+  FD_TEST( fd_accdb_owner_idx_grp_cnt( idx )==grp_max );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+  fd_accdb_owner_idx_reset( idx );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==0UL );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+
+  FD_TEST( fd_accdb_owner_idx_leave( idx )==mem );
+  FD_TEST( fd_accdb_owner_idx_delete( mem )==mem );
+  FD_TEST( !fd_accdb_owner_idx_join( idx, mem ) );
+  fd_wksp_free_laddr( mem );
+}
+
+/* test_filter checks dataSize and memcmp filters, including patterns
+   longer than a SIMD register */
+
+static void
+test_filter( void ) {
+  uchar data[ 200 ];
+  for( ulong i=0UL; i<200UL; i++ ) data[ i ] = (uchar)( i*7UL );
+
+  fd_accdb_filter_t f[2] = {0};
+  FD_TEST( fd_accdb_filter_match( f, 0UL, data, 200UL ) );
+
+  f[0].type = FD_ACCDB_FILTER_DATA_SZ; f[0].data_sz = 200UL;
+  FD_TEST(  fd_accdb_filter_match( f, 1UL, data, 200UL ) );
+  FD_TEST( !fd_accdb_filter_match( f, 1UL, data, 199UL ) );
+
+  f[1].type = FD_ACCDB_FILTER_MEMCMP;
+  for( ulong off=0UL; off<80UL; off+=9UL ) {
+    for( ulong sz=0UL; sz<=FD_ACCDB_FILTER_MEMCMP_MAX; sz+=7UL ) {
+      f[1].off = off;
+      f[1].sz  = (uint)sz;
+      memcpy( f[1].bytes, data+off, sz );
+      FD_TEST( fd_accdb_filter_match( f, 2UL, data, 200UL ) );
+      if( sz ) {
+        /* Flip the first and last byte */
+        f[1].bytes[ 0    ] ^= 1; FD_TEST( !fd_accdb_filter_match( f, 2UL, data, 200UL ) ); f[1].bytes[ 0    ] ^= 1;
+        f[1].bytes[ sz-1 ] ^= 1; FD_TEST( !fd_accdb_filter_match( f, 2UL, data, 200UL ) ); f[1].bytes[ sz-1 ] ^= 1;
+      }
+    }
+  }
+
+  /* Out of bounds memcmp never matches */
+  f[1].off = 190UL; f[1].sz = 11U;
+  FD_TEST( !fd_accdb_filter_match( f+1, 1UL, data, 200UL ) );
+  f[1].off = ULONG_MAX; f[1].sz = 1U;
+  FD_TEST( !fd_accdb_filter_match( f+1, 1UL, data, 200UL ) );
+  f[1].off = 200UL; f[1].sz = 0U;
+  FD_TEST(  fd_accdb_filter_match( f+1, 1UL, data, 200UL ) );
+
+  /* Unknown filter type never matches */
+  f[0].type = 0U;
+  FD_TEST( !fd_accdb_filter_match( f, 1UL, data, 200UL ) );
+}
+
+/* test_program_accounts checks that the index is maintained as records
+   are rooted, and that queries against unrooted fork nodes see the
+   fork's modifications */
+
+static void
+test_program_accounts( fd_wksp_t * wksp ) {
+  ulong txn_max = 8UL;
+  ulong rec_max = 256UL;
+  void * shfunk = fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint( txn_max, rec_max ), WKSP_TAG );
+  FD_TEST( shfunk );
+  FD_TEST( fd_funk_new( shfunk, WKSP_TAG, 0UL, txn_max, rec_max ) );
+  fd_accdb_admin_t admin[1];
+  FD_TEST( fd_accdb_admin_join( admin, shfunk ) );
+  fd_accdb_user_t accdb[1];
+  FD_TEST( fd_accdb_user_v1_init( accdb, shfunk ) );
+
+  void * mem = fd_wksp_alloc_laddr( wksp, fd_accdb_owner_idx_align(), fd_accdb_owner_idx_footprint( rec_max, 16UL ), WKSP_TAG );
+  FD_TEST( fd_accdb_owner_idx_new( mem, rec_max, 16UL, 1UL ) );
+  fd_accdb_owner_idx_t idx[1];
+  FD_TEST( fd_accdb_owner_idx_join( idx, mem ) );
+
+  uchar data[ 64 ]; memset( data, 0, sizeof(data) );
+  ulong const prog_a = 100UL;
+  ulong const prog_b = 101UL;
+
+  /* Slot 1: accounts 1..3 owned by A, 4 owned by B.  Account 1 has
+     distinct data. */
+
+  fd_funk_txn_xid_t root  = *fd_funk_last_publish( admin->funk );
+  fd_funk_txn_xid_t xid_1 = { .ul={ 1UL, 0UL } };
+  fd_accdb_attach_child( admin, &root, &xid_1 );
+  data[ 40 ] = 0xaa;
+  test_put( accdb, &xid_1, 1UL, prog_a, 1UL, data, 64UL );
+  data[ 40 ] = 0x00;
+  test_put( accdb, &xid_1, 2UL, prog_a, 1UL, data, 64UL );
+  test_put( accdb, &xid_1, 3UL, prog_a, 1UL, data, 32UL );
+  test_put( accdb, &xid_1, 4UL, prog_b, 1UL, data, 64UL );
+
+  /* Attaching rebuilds from root, which is still empty */
+  fd_accdb_admin_owner_idx_set( admin, idx );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==0UL );
+
+  /* Unrooted fork node queries are served from the fork overlay */
+  { ulong e[] = { 1UL, 2UL, 3UL }; test_query( idx, accdb, &xid_1, prog_a, NULL, 0UL, e, 3UL ); }
+  { ulong e[] = { 4UL };           test_query( idx, accdb, &xid_1, prog_b, NULL, 0UL, e, 1UL ); }
+  test_query( idx, accdb, &root, prog_a, NULL, 0UL, NULL, 0UL );
+
+  /* Rooting updates the index */
+  fd_accdb_advance_root( admin, &xid_1 );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==4UL );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+  { ulong e[] = { 1UL, 2UL, 3UL }; test_query( idx, accdb, &xid_1, prog_a, NULL, 0UL, e, 3UL ); }
+
+  /* Filters */
+  fd_accdb_filter_t f[2] = {0};
+  f[0].type = FD_ACCDB_FILTER_DATA_SZ; f[0].data_sz = 64UL;
+  { ulong e[] = { 1UL, 2UL }; test_query( idx, accdb, &xid_1, prog_a, f, 1UL, e, 2UL ); }
+  f[1].type = FD_ACCDB_FILTER_MEMCMP; f[1].off = 8UL; f[1].sz = 40U; f[1].bytes[ 32 ] = 0xaa;
+  { ulong e[] = { 1UL }; test_query( idx, accdb, &xid_1, prog_a, f, 2UL, e, 1UL ); }
+
+  /* Slot 2 forks off the root: account 2 changes owner to B, account 3
+     is deleted, account 5 is created for A.  Slot 3 is a sibling that
+     does not see any of it. */
+
+  fd_funk_txn_xid_t xid_2 = { .ul={ 2UL, 0UL } };
+  fd_funk_txn_xid_t xid_3 = { .ul={ 3UL, 0UL } };
+  fd_accdb_attach_child( admin, &xid_1, &xid_2 );
+  fd_accdb_attach_child( admin, &xid_1, &xid_3 );
+  test_put( accdb, &xid_2, 2UL, prog_b, 1UL, data, 64UL );
+  test_put( accdb, &xid_2, 3UL, prog_a, 0UL, data,  0UL );
+  test_put( accdb, &xid_2, 5UL, prog_a, 1UL, data, 16UL );
+
+  { ulong e[] = { 1UL, 5UL };      test_query( idx, accdb, &xid_2, prog_a, NULL, 0UL, e, 2UL ); }
+  { ulong e[] = { 2UL, 4UL };      test_query( idx, accdb, &xid_2, prog_b, NULL, 0UL, e, 2UL ); }
+  { ulong e[] = { 1UL, 2UL, 3UL }; test_query( idx, accdb, &xid_3, prog_a, NULL, 0UL, e, 3UL ); }
+
+  /* Slot 4 on top of slot 2 modifies account 5 again, and moves
+     account 2 back to A.  Only the newest revision is reported. */
+
+  fd_funk_txn_xid_t xid_4 = { .ul={ 4UL, 0UL } };
+  fd_accdb_attach_child( admin, &xid_2, &xid_4 );
+  test_put( accdb, &xid_4, 5UL, prog_a, 2UL, data, 16UL );
+  test_put( accdb, &xid_4, 2UL, prog_a, 1UL, data, 64UL );
+  { ulong e[] = { 1UL, 2UL, 5UL }; test_query( idx, accdb, &xid_4, prog_a, NULL, 0UL, e, 3UL ); }
+  { ulong e[] = { 4UL };           test_query( idx, accdb, &xid_4, prog_b, NULL, 0UL, e, 1UL ); }
+
+  /* Early stop */
+  {
+    fd_pubkey_t owner_key = test_key( prog_a );
+    test_hits_t hits = { .stop_after = 1UL };
+    FD_TEST( fd_accdb_program_accounts( idx, accdb, &xid_4, &owner_key, NULL, 0UL, test_collect, &hits )==1UL );
+  }
+
+  /* Cancelling a fork does not touch the index, rooting slot 2 prunes
+     slot 3 and applies slot 2's changes */
+
+  fd_accdb_advance_root( admin, &xid_2 );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+  FD_TEST( fd_accdb_owner_idx_owner_cnt( idx, &(fd_pubkey_t){ .ul={ prog_a, 0UL, 0UL, ~prog_a } } )==2UL );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==4UL ); /* 1,2,4,5 */
+  { ulong e[] = { 1UL, 5UL };      test_query( idx, accdb, &xid_2, prog_a, NULL, 0UL, e, 2UL ); }
+  { ulong e[] = { 1UL, 2UL, 5UL }; test_query( idx, accdb, &xid_4, prog_a, NULL, 0UL, e, 3UL ); }
+
+  fd_accdb_advance_root( admin, &xid_4 );
+  FD_TEST( !fd_accdb_owner_idx_verify( idx ) );
+  { ulong e[] = { 1UL, 2UL, 5UL }; test_query( idx, accdb, &xid_4, prog_a, NULL, 0UL, e, 3UL ); }
+
+  /* Re-attaching rebuilds an equivalent index */
+  fd_accdb_owner_idx_reset( idx );
+  fd_accdb_admin_owner_idx_set( admin, idx );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==4UL );
+  { ulong e[] = { 1UL, 2UL, 5UL }; test_query( idx, accdb, &xid_4, prog_a, NULL, 0UL, e, 3UL ); }
+
+  fd_accdb_clear( admin );
+  FD_TEST( fd_accdb_owner_idx_ele_cnt( idx )==0UL );
+
+  fd_accdb_admin_owner_idx_set( admin, NULL );
+  fd_wksp_free_laddr( fd_accdb_owner_idx_delete( fd_accdb_owner_idx_leave( idx ) ) );
+  fd_accdb_user_fini( accdb );
+  fd_accdb_admin_leave( admin, NULL );
+  fd_wksp_free_laddr( fd_funk_delete( shfunk ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL,      "gigantic" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL,             1UL );
+  ulong        near_cpu = fd_env_strip_cmdline_ulong( &argc, &argv, "--near-cpu", NULL, fd_log_cpu_id() );
+
+  FD_LOG_NOTICE(( "using an anonymous local workspace, --page-sz %s, --page-cnt %lu, --near-cpu %lu",
+                  _page_sz, page_cnt, near_cpu ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  if( FD_UNLIKELY( !wksp ) ) FD_LOG_ERR(( "Unable to attach to wksp" ));
+
+  test_idx_basic( wksp );
+  test_filter();
+  test_program_accounts( wksp );
+
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -1,5 +1,5 @@
 #include "fd_progcache_rec.h"
-#include "../vm/fd_vm.h" /* fd_vm_syscall_register_slot, fd_vm_validate */
+#include "../vm/fd_vm.h" /* fd_vm_syscall_register_slot, fd_vm_validate, fd_vm_fuse */
 
 fd_progcache_rec_t *
 fd_progcache_rec_new( void *                          mem,
@@ -23,6 +23,10 @@ fd_progcache_rec_new( void *                          mem,
     /*               */calldests_mem = FD_SCRATCH_ALLOC_APPEND( l, fd_sbpf_calldests_align(), fd_sbpf_calldests_footprint( elf_info->text_cnt ) );
   }
   void *               rodata_mem    = FD_SCRATCH_ALLOC_APPEND( l, 8UL,                       elf_info->bin_sz );
+  ulong *              fused_mem     = NULL;
+  if( elf_info->text_cnt ) {
+    /*               */fused_mem     = FD_SCRATCH_ALLOC_APPEND( l, 8UL,                       elf_info->text_cnt*sizeof(ulong) );
+  }
   FD_SCRATCH_ALLOC_FINI( l, fd_progcache_rec_align() );
   memset( rec, 0, sizeof(fd_progcache_rec_t) );
   rec->calldests_off = has_calldests ? (uint)( (ulong)calldests_mem - (ulong)mem ) : 0U;
@@ -95,6 +99,13 @@ fd_progcache_rec_new( void *                          mem,
 
   if( FD_UNLIKELY( fd_vm_validate( vm )!=FD_VM_SUCCESS ) ) return NULL;
 
+  /* Pre-decode the validated text for the interpreter */
+
+  if( fused_mem ) {
+    fd_vm_fuse( fused_mem, prog->text, rec->text_cnt, elf_info->sbpf_version );
+    rec->fused_off = (uint)( (ulong)fused_mem - (ulong)mem );
+  }
+
   rec->slot       = load_slot;
   rec->executable = 1;
   return rec;
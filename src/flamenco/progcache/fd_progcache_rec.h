@@ -25,6 +25,7 @@ struct fd_progcache_rec {
 
   uint calldests_off;  /* offset to sbpf_calldests map */
   uint rodata_off;     /* offset to rodata segment */
+  uint fused_off;      /* offset to fd_vm_fuse text stream (0 if none) */
 
   /* SBPF version, SIMD-0161 */
   uchar sbpf_version;
@@ -49,11 +50,23 @@ fd_progcache_rec_calldests( fd_progcache_rec_t const * rec ) {
   return fd_sbpf_calldests_join( (void *)( (ulong)rec + rec->calldests_off ) );
 }
 
+/* fd_progcache_rec_fused_text returns the pre-decoded text stream
+   (see fd_vm_fuse) of an executable entry, suitable for
+   vm->fused_text.  Returns NULL if the entry has none. */
+
+static inline ulong const *
+fd_progcache_rec_fused_text( fd_progcache_rec_t const * rec ) {
+  if( FD_UNLIKELY( !rec->fused_off ) ) return NULL;
+  return (ulong const *)( (ulong)rec + rec->fused_off );
+}
+
 /* Private APIs */
 
 /* fd_progcache_rec_{align,footprint} give the params of backing memory
    of a progcache_rec object for the given ELF info.  If elf_info is
-   NULL, implies a non-executable cache entry (sizeof(fd_progcache_rec_t)). */
+   NULL, implies a non-executable cache entry (sizeof(fd_progcache_rec_t)).
+   Executable entries also hold a fused copy of the text (fd_vm_fuse)
+   such that the interpreter does not need to pre-decode per call. */
 
 FD_FN_CONST static inline ulong
 fd_progcache_rec_align( void ) {
@@ -73,6 +86,9 @@ fd_progcache_rec_footprint( fd_sbpf_elf_info_t const * elf_info ) {
     l = FD_LAYOUT_APPEND( l, fd_sbpf_calldests_align(), fd_sbpf_calldests_footprint( pc_max ) );
   }
   l = FD_LAYOUT_APPEND( l, 8UL, elf_info->bin_sz );
+  if( elf_info->text_cnt ) {
+    l = FD_LAYOUT_APPEND( l, 8UL, elf_info->text_cnt*sizeof(ulong) );
+  }
   return FD_LAYOUT_FINI( l, fd_progcache_rec_align() );
 }
 
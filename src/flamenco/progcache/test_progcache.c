@@ -3,6 +3,7 @@
 
 #include "test_progcache_common.c"
 #include "../runtime/fd_system_ids.h"
+#include "../vm/fd_vm.h"
 #include <stdlib.h>
 #include <regex.h>
 
@@ -158,6 +159,16 @@ test_valid_program( fd_wksp_t * wksp ) {
   FD_TEST( fd_progcache_peek( env->progcache, &fork_a, &key, 0UL )==rec );
   FD_TEST( env->progcache->fork_depth==2UL );
 
+  /* Executable entries carry the pre-decoded text */
+
+  ulong const * text  = (ulong const *)( fd_progcache_rec_rodata( rec ) + rec->text_off );
+  ulong const * fused = fd_progcache_rec_fused_text( rec );
+  FD_TEST( rec->text_cnt && fused );
+  ulong * expected = malloc( rec->text_cnt*sizeof(ulong) ); FD_TEST( expected );
+  fd_vm_fuse( expected, text, rec->text_cnt, rec->sbpf_version );
+  FD_TEST( !memcmp( fused, expected, rec->text_cnt*sizeof(ulong) ) );
+  free( expected );
+
   fd_funk_txn_xid_t fork_b = { .ul = { 64UL, 2UL } };
   test_env_txn_prepare( env, &fork_a, &fork_b );
   FD_TEST( fd_progcache_peek( env->progcache, &fork_b, &key, 0UL )==rec );
@@ -11,4 +11,11 @@ $(call add-objs,fd_rewards,fd_flamenco)
 $(call make-unit-test,test_epoch_rewards,test_epoch_rewards,fd_flamenco fd_util fd_ballet)
 $(call run-unit-test,test_epoch_rewards)
 
+ifdef FD_HAS_HOSTED
+ifdef FD_HAS_SECP256K1
+$(call make-unit-test,test_rewards,test_rewards,fd_flamenco fd_funk fd_ballet fd_util)
+$(call run-unit-test,test_rewards)
+endif
+endif
+
 endif
@@ -131,7 +131,8 @@ calculate_stake_points_and_credits_recalculation( fd_stake_history_t const *
                                                   fd_vote_state_credits_t *      recalc_vote_state_credits,
                                                   fd_calculated_stake_points_t * result ) {
   ulong credits_in_stake = stake->credits_observed;
-  ulong credits_in_vote  = recalc_vote_state_credits->credits[ recalc_vote_state_credits->credits_cnt-1UL ];
+  ulong credits_cnt      = recalc_vote_state_credits->credits_cnt;
+  ulong credits_in_vote  = credits_cnt>0UL ? recalc_vote_state_credits->credits[ credits_cnt-1UL ] : 0UL;
 
   /* If the Vote account has less credits observed than the Stake account,
       something is wrong and we need to force an update.
@@ -171,6 +172,11 @@ calculate_stake_points_and_credits_recalculation( fd_stake_history_t const *
 
     new_credits_observed = fd_ulong_max( new_credits_observed, final_epoch_credits );
 
+    /* Only entries past the stake's credits_observed earn points, which
+       is usually just the last one.  Skip the stake history walk for
+       the others. */
+    if( !earned_credits ) continue;
+
     fd_delegation_t delegation = {
       .voter_pubkey         = stake->vote_account,
       .stake                = stake->stake,
@@ -268,6 +274,11 @@ calculate_stake_points_and_credits( fd_funk_t *                    funk,
 
     new_credits_observed = fd_ulong_max( new_credits_observed, final_epoch_credits );
 
+    /* Only entries past the stake's credits_observed earn points, which
+       is usually just the last one.  Skip the stake history walk for
+       the others. */
+    if( !earned_credits ) continue;
+
     fd_delegation_t delegation = {
       .voter_pubkey         = stake->vote_account,
       .stake                = stake->stake,
@@ -291,6 +302,91 @@ calculate_stake_points_and_credits( fd_funk_t *                    funk,
   result->force_credits_update_with_skipped_reward = 0;
 }
 
+/* VOTE_CREDITS_UNCACHED marks a vote account whose epoch credits are
+   not in the vote credits table.  Stake delegations to it read the
+   credits from the vote account in funk instead. */
+
+#define VOTE_CREDITS_UNCACHED (ULONG_MAX)
+
+/* cache_vote_credits decodes the epoch credits of every vote account
+   in vote_states once into the columnar vote_credits table (indexed by
+   vote state idx).  Without it, the passes over all stake delegations
+   would read and decode the vote account of every delegation from
+   funk, i.e. ~1M decodes of a few thousand accounts per pass.  Vote
+   accounts that can't be cached (missing from funk or with epoch
+   credits that don't fit the table) are marked VOTE_CREDITS_UNCACHED
+   and take the per delegation path, which behaves as before. */
+
+static void
+cache_vote_credits( fd_funk_t *               funk,
+                    fd_funk_txn_xid_t const * xid,
+                    fd_vote_states_t const *  vote_states,
+                    fd_vote_state_credits_t * vote_credits ) {
+
+  uchar __attribute__((aligned(FD_VOTE_STATE_VERSIONED_ALIGN))) buf[ FD_VOTE_STATE_VERSIONED_FOOTPRINT ];
+
+  fd_vote_states_iter_t iter_[1];
+  for( fd_vote_states_iter_t * iter = fd_vote_states_iter_init( iter_, vote_states );
+       !fd_vote_states_iter_done( iter );
+       fd_vote_states_iter_next( iter ) ) {
+    fd_vote_state_ele_t const * vote_state = fd_vote_states_iter_ele( iter );
+    fd_vote_state_credits_t *   credits    = &vote_credits[ vote_state->idx ];
+
+    fd_txn_account_t vote_rec[1];
+    if( FD_UNLIKELY( fd_txn_account_init_from_funk_readonly( vote_rec,
+                                                             &vote_state->vote_account,
+                                                             funk,
+                                                             xid )!=FD_ACC_MGR_SUCCESS ) ) {
+      credits->credits_cnt = VOTE_CREDITS_UNCACHED;
+      continue;
+    }
+
+    fd_vote_epoch_credits_t * epoch_credits = NULL;
+    get_vote_credits( fd_txn_account_get_data( vote_rec ), fd_txn_account_get_data_len( vote_rec ), buf, &epoch_credits );
+
+    ulong credits_cnt = deq_fd_vote_epoch_credits_t_cnt( epoch_credits );
+    if( FD_UNLIKELY( credits_cnt>EPOCH_CREDITS_MAX ) ) {
+      credits->credits_cnt = VOTE_CREDITS_UNCACHED;
+      continue;
+    }
+
+    credits->credits_cnt = 0UL;
+    for( deq_fd_vote_epoch_credits_t_iter_t credit_iter = deq_fd_vote_epoch_credits_t_iter_init( epoch_credits );
+         !deq_fd_vote_epoch_credits_t_iter_done( epoch_credits, credit_iter );
+         credit_iter = deq_fd_vote_epoch_credits_t_iter_next( epoch_credits, credit_iter ) ) {
+      fd_vote_epoch_credits_t const * ele = deq_fd_vote_epoch_credits_t_iter_ele_const( epoch_credits, credit_iter );
+      if( FD_UNLIKELY( ele->epoch>USHORT_MAX ) ) {
+        credits->credits_cnt = VOTE_CREDITS_UNCACHED;
+        break;
+      }
+      credits->epoch       [ credits->credits_cnt ] = (ushort)ele->epoch;
+      credits->credits     [ credits->credits_cnt ] = ele->credits;
+      credits->prev_credits[ credits->credits_cnt ] = ele->prev_credits;
+      credits->credits_cnt++;
+    }
+  }
+}
+
+/* calculate_stake_points calculates the points of a stake delegation
+   from the cached epoch credits of its vote account when available
+   and from the vote account in funk otherwise. */
+
+static inline void
+calculate_stake_points( fd_funk_t *                    funk,
+                        fd_funk_txn_xid_t const *      xid,
+                        fd_stake_history_t const *     stake_history,
+                        fd_stake_delegation_t const *  stake,
+                        fd_vote_state_ele_t const *    vote_state,
+                        ulong *                        new_rate_activation_epoch,
+                        fd_vote_state_credits_t *      vote_state_credits,
+                        fd_calculated_stake_points_t * result ) {
+  if( FD_LIKELY( vote_state_credits && vote_state_credits->credits_cnt!=VOTE_CREDITS_UNCACHED ) ) {
+    calculate_stake_points_and_credits_recalculation( stake_history, stake, new_rate_activation_epoch, vote_state_credits, result );
+  } else {
+    calculate_stake_points_and_credits( funk, xid, stake_history, stake, vote_state, new_rate_activation_epoch, result );
+  }
+}
+
 struct fd_commission_split {
   ulong voter_portion;
   ulong staker_portion;
@@ -351,7 +447,7 @@ redeem_rewards( fd_funk_t *                     funk,
                 ulong                           total_rewards,
                 uint128                         total_points,
                 ulong *                         new_rate_activation_epoch,
-                fd_vote_state_credits_t *       recalc_vote_state_credits,
+                fd_vote_state_credits_t *       vote_state_credits,
                 fd_calculated_stake_rewards_t * result ) {
 
   /* The firedancer implementation of redeem_rewards inlines a lot of
@@ -360,23 +456,15 @@ redeem_rewards( fd_funk_t *                     funk,
      calculate_stake_rewards. */
 
   fd_calculated_stake_points_t stake_points_result = {0};
-  if( FD_LIKELY( !recalc_vote_state_credits ) ) {
-    calculate_stake_points_and_credits(
-      funk,
-      xid,
-      stake_history,
-      stake,
-      vote_state,
-      new_rate_activation_epoch,
-      &stake_points_result );
-  } else {
-    calculate_stake_points_and_credits_recalculation(
-      stake_history,
-      stake,
-      new_rate_activation_epoch,
-      recalc_vote_state_credits,
-      &stake_points_result );
-  }
+  calculate_stake_points(
+    funk,
+    xid,
+    stake_history,
+    stake,
+    vote_state,
+    new_rate_activation_epoch,
+    vote_state_credits,
+    &stake_points_result );
 
   // Drive credits_observed forward unconditionally when rewards are disabled
   // or when this is the stake's activation epoch
@@ -460,14 +548,73 @@ get_minimum_stake_delegation( fd_bank_t * bank ) {
   return 1;
 }
 
-/* Calculates epoch reward points from stake/vote accounts.
+/* calculate_reward_points_task sums the reward points of the stake
+   delegations on stake delegation map chains [block_i0,block_i1).
+   Each thread reads vote accounts from funk independently. */
+
+static FD_MAP_REDUCE_BEGIN( calculate_reward_points_task, 4096L, alignof(uint128), sizeof(uint128), 1UL ) {
+  uint128 *                      _points                   = (uint128 *)                     arg[0];
+  fd_funk_t *                    funk                      = (fd_funk_t *)                   arg[1];
+  fd_funk_txn_xid_t const *      xid                       = (fd_funk_txn_xid_t const *)     arg[2];
+  fd_stake_delegations_t const * stake_delegations         = (fd_stake_delegations_t const *)arg[3];
+  fd_stake_history_t const *     stake_history             = (fd_stake_history_t const *)    arg[4];
+  fd_vote_states_t const *       vote_states               = (fd_vote_states_t const *)      arg[5];
+  ulong *                        new_rate_activation_epoch = (ulong *)                       arg[6];
+  ulong                          minimum_stake_delegation  =                                 arg[7];
+  fd_vote_state_credits_t *      vote_credits              = (fd_vote_state_credits_t *)     arg[8];
+
+  uint128 points = 0;
+
+  fd_stake_delegations_iter_t iter_[1];
+  for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init_range( iter_, stake_delegations, (ulong)block_i0, (ulong)block_i1 );
+       !fd_stake_delegations_iter_done( iter );
+       fd_stake_delegations_iter_next( iter ) ) {
+    fd_stake_delegation_t const * stake_delegation = fd_stake_delegations_iter_ele( iter );
+
+    if( FD_UNLIKELY( stake_delegation->stake<minimum_stake_delegation ) ) {
+      continue;
+    }
+
+    fd_vote_state_ele_t * vote_state_ele = fd_vote_states_query( vote_states, &stake_delegation->vote_account );
+    if( FD_UNLIKELY( !vote_state_ele ) ) {
+      continue;
+    }
+
+    fd_calculated_stake_points_t stake_point_result;
+    calculate_stake_points( funk,
+                            xid,
+                            stake_history,
+                            stake_delegation,
+                            vote_state_ele,
+                            new_rate_activation_epoch,
+                            &vote_credits[ vote_state_ele->idx ],
+                            &stake_point_result );
+    points += stake_point_result.points.ud;
+  }
+
+  *_points = points;
+
+} FD_MAP_END {
+
+  *(uint128 *)arg[0] += *(uint128 const *)_r1;
+
+} FD_REDUCE_END
+
+/* Calculates epoch reward points from stake/vote accounts.  The pass
+   over the stake delegations is split across the caller and tpool
+   threads (t0,t1).  The points are an integer sum, so the result does
+   not depend on the number of threads.
    https://github.com/anza-xyz/agave/blob/v2.3.1/runtime/src/bank/partitioned_epoch_rewards/calculation.rs#L445 */
 static uint128
-calculate_reward_points_partitioned( fd_bank_t *                    bank,
+calculate_reward_points_partitioned( fd_tpool_t *                   tpool,
+                                     ulong                          t0,
+                                     ulong                          t1,
+                                     fd_bank_t *                    bank,
                                      fd_funk_t *                    funk,
                                      fd_funk_txn_xid_t const *      xid,
                                      fd_stake_delegations_t const * stake_delegations,
-                                     fd_stake_history_t const *     stake_history ) {
+                                     fd_stake_history_t const *     stake_history,
+                                     fd_vote_state_credits_t *      vote_credits ) {
   ulong minimum_stake_delegation = get_minimum_stake_delegation( bank );
 
   /* Calculate the points for each stake delegation */
@@ -484,39 +631,22 @@ calculate_reward_points_partitioned( fd_bank_t *                    bank,
     new_warmup_cooldown_rate_epoch = NULL;
   }
 
-  uint128 total_points = 0;
+  uint128 total_points[1];
 
   fd_vote_states_t const * vote_states = fd_bank_vote_states_locking_query( bank );
 
-  fd_stake_delegations_iter_t iter_[1];
-  for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init( iter_, stake_delegations );
-       !fd_stake_delegations_iter_done( iter );
-       fd_stake_delegations_iter_next( iter ) ) {
-    fd_stake_delegation_t const * stake_delegation = fd_stake_delegations_iter_ele( iter );
-
-    if( FD_UNLIKELY( stake_delegation->stake<minimum_stake_delegation ) ) {
-      continue;
-    }
-
-    fd_vote_state_ele_t * vote_state_ele = fd_vote_states_query( vote_states, &stake_delegation->vote_account );
-    if( FD_UNLIKELY( !vote_state_ele ) ) {
-      continue;
-    }
+  /* The vote credits table is shared with the stake reward pass that
+     follows, so it is only built once per epoch boundary. */
+  cache_vote_credits( funk, xid, vote_states, vote_credits );
 
-    fd_calculated_stake_points_t stake_point_result;
-    calculate_stake_points_and_credits( funk,
-                                        xid,
-                                        stake_history,
-                                        stake_delegation,
-                                        vote_state_ele,
-                                        new_warmup_cooldown_rate_epoch,
-                                        &stake_point_result );
-    total_points += stake_point_result.points.ud;
-  }
+  long chain_cnt = (long)fd_stake_delegations_chain_cnt( stake_delegations );
+  FD_MAP_REDUCE( calculate_reward_points_task, tpool,t0,t1, 0L,chain_cnt, total_points,
+                 funk, xid, stake_delegations, stake_history, vote_states, new_warmup_cooldown_rate_epoch, minimum_stake_delegation,
+                 vote_credits );
 
   fd_bank_vote_states_end_locking_query( bank );
 
-  return total_points;
+  return total_points[0];
 }
 
 /* Calculates epoch rewards for stake/vote accounts.
@@ -588,8 +718,10 @@ calculate_stake_vote_rewards( fd_bank_t *                    bank,
       continue;
     }
 
-    fd_vote_state_credits_t * realc_credit = !!runtime_stack->stakes.prev_vote_credits_used ?
-                                             &runtime_stack->stakes.vote_credits[ vote_state_ele->idx ] : NULL;
+    /* The vote credits are either the ones cached by the reward points
+       pass or, when recalculating, the ones restored from the snapshot
+       for the end of the previous epoch. */
+    fd_vote_state_credits_t * vote_state_credits = &runtime_stack->stakes.vote_credits[ vote_state_ele->idx ];
 
     /* redeem_rewards is actually just responsible for calculating the
        vote and stake rewards for each stake account.  It does not do
@@ -605,7 +737,7 @@ calculate_stake_vote_rewards( fd_bank_t *                    bank,
         total_rewards,
         total_points,
         new_warmup_cooldown_rate_epoch,
-        realc_credit,
+        vote_state_credits,
         calculated_stake_rewards );
 
     if( FD_UNLIKELY( err!=0 ) ) {
@@ -635,7 +767,10 @@ calculate_stake_vote_rewards( fd_bank_t *                    bank,
 
    https://github.com/anza-xyz/agave/blob/cbc8320d35358da14d79ebcada4dfb6756ffac79/runtime/src/bank/partitioned_epoch_rewards/calculation.rs#L273 */
 static uint128
-calculate_validator_rewards( fd_bank_t *                    bank,
+calculate_validator_rewards( fd_tpool_t *                   tpool,
+                             ulong                          t0,
+                             ulong                          t1,
+                             fd_bank_t *                    bank,
                              fd_funk_t *                    funk,
                              fd_funk_txn_xid_t const *      xid,
                              fd_runtime_stack_t *           runtime_stack,
@@ -651,11 +786,13 @@ calculate_validator_rewards( fd_bank_t *                    bank,
 
   /* Calculate the epoch reward points from stake/vote accounts */
   uint128 points = calculate_reward_points_partitioned(
+      tpool, t0, t1,
       bank,
       funk,
       xid,
       stake_delegations,
-      stake_history );
+      stake_history,
+      runtime_stack->stakes.vote_credits );
 
   /* If there are no points, then we set the rewards to 0. */
   *rewards_out = points>0UL ? *rewards_out: 0UL;
@@ -713,7 +850,10 @@ get_reward_distribution_num_blocks( fd_epoch_schedule_t const * epoch_schedule,
 
    https://github.com/anza-xyz/agave/blob/v3.0.4/runtime/src/bank/partitioned_epoch_rewards/calculation.rs#L277 */
 static void
-calculate_rewards_for_partitioning( fd_bank_t *                            bank,
+calculate_rewards_for_partitioning( fd_tpool_t *                           tpool,
+                                    ulong                                  t0,
+                                    ulong                                  t1,
+                                    fd_bank_t *                            bank,
                                     fd_funk_t *                            funk,
                                     fd_funk_txn_xid_t const *              xid,
                                     fd_runtime_stack_t *                   runtime_stack,
@@ -730,7 +870,8 @@ calculate_rewards_for_partitioning( fd_bank_t *                            bank,
 
   ulong total_rewards = rewards.validator_rewards;
 
-  uint128 points = calculate_validator_rewards( bank,
+  uint128 points = calculate_validator_rewards( tpool, t0, t1,
+                                                bank,
                                                 funk,
                                                 xid,
                                                 runtime_stack,
@@ -753,7 +894,10 @@ calculate_rewards_for_partitioning( fd_bank_t *                            bank,
 /* Calculate rewards from previous epoch and distribute vote rewards
    https://github.com/anza-xyz/agave/blob/v3.0.4/runtime/src/bank/partitioned_epoch_rewards/calculation.rs#L148 */
 static void
-calculate_rewards_and_distribute_vote_rewards( fd_bank_t *                    bank,
+calculate_rewards_and_distribute_vote_rewards( fd_tpool_t *                   tpool,
+                                               ulong                          t0,
+                                               ulong                          t1,
+                                               fd_bank_t *                    bank,
                                                fd_accdb_user_t *              accdb,
                                                fd_funk_txn_xid_t const *      xid,
                                                fd_runtime_stack_t *           runtime_stack,
@@ -767,7 +911,8 @@ calculate_rewards_and_distribute_vote_rewards( fd_bank_t *                    ba
 
   fd_funk_t * funk = fd_accdb_user_v1_funk( accdb );
   fd_partitioned_rewards_calculation_t rewards_calc_result[1] = {0};
-  calculate_rewards_for_partitioning( bank,
+  calculate_rewards_for_partitioning( tpool, t0, t1,
+                                      bank,
                                       funk,
                                       xid,
                                       runtime_stack,
@@ -1017,16 +1162,20 @@ fd_distribute_partitioned_epoch_rewards( fd_bank_t *               bank,
    https://github.com/anza-xyz/agave/blob/v3.0.4/runtime/src/bank/partitioned_epoch_rewards/calculation.rs#L102
 */
 void
-fd_begin_partitioned_rewards( fd_bank_t *                    bank,
-                              fd_accdb_user_t *              accdb,
-                              fd_funk_txn_xid_t const *      xid,
-                              fd_runtime_stack_t *           runtime_stack,
-                              fd_capture_ctx_t *             capture_ctx,
-                              fd_stake_delegations_t const * stake_delegations,
-                              fd_hash_t const *              parent_blockhash,
-                              ulong                          parent_epoch ) {
+fd_begin_partitioned_rewards_tpool( fd_tpool_t *                   tpool,
+                                    ulong                          t0,
+                                    ulong                          t1,
+                                    fd_bank_t *                    bank,
+                                    fd_accdb_user_t *              accdb,
+                                    fd_funk_txn_xid_t const *      xid,
+                                    fd_runtime_stack_t *           runtime_stack,
+                                    fd_capture_ctx_t *             capture_ctx,
+                                    fd_stake_delegations_t const * stake_delegations,
+                                    fd_hash_t const *              parent_blockhash,
+                                    ulong                          parent_epoch ) {
 
   calculate_rewards_and_distribute_vote_rewards(
+      tpool, t0, t1,
       bank,
       accdb,
       xid,
@@ -31,6 +31,13 @@ FD_PROTOTYPES_BEGIN
    increases capitalization.  Called in the epoch boundary (start of
    first block of an epoch).
 
+   fd_begin_partitioned_rewards_tpool is the same but splits the reward
+   points pass over all stake delegations across the caller and tpool
+   threads (t0,t1), which are assumed to be idle.  The result does not
+   depend on the number of threads.  The per stake account reward
+   calculation stays single threaded as it builds the epoch rewards in
+   stake delegation iteration order.
+
    Call stack is as follows:
    - begin_partitioned_rewards
      - calculate_rewards_and_distribute_vote_rewards
@@ -46,6 +53,19 @@ FD_PROTOTYPES_BEGIN
      - ... update epoch rewards bank field ... */
 
 void
+fd_begin_partitioned_rewards_tpool( fd_tpool_t *                   tpool,
+                                    ulong                          t0,
+                                    ulong                          t1,
+                                    fd_bank_t *                    bank,
+                                    fd_accdb_user_t *              accdb,
+                                    fd_funk_txn_xid_t const *      xid,
+                                    fd_runtime_stack_t *           runtime_stack,
+                                    fd_capture_ctx_t *             capture_ctx,
+                                    fd_stake_delegations_t const * stake_delegations,
+                                    fd_hash_t const *              parent_blockhash,
+                                    ulong                          parent_epoch );
+
+static inline void
 fd_begin_partitioned_rewards( fd_bank_t *                    bank,
                               fd_accdb_user_t *              accdb,
                               fd_funk_txn_xid_t const *      xid,
@@ -53,7 +73,10 @@ fd_begin_partitioned_rewards( fd_bank_t *                    bank,
                               fd_capture_ctx_t *             capture_ctx,
                               fd_stake_delegations_t const * stake_delegations,
                               fd_hash_t const *              parent_blockhash,
-                              ulong                          parent_epoch );
+                              ulong                          parent_epoch ) {
+  fd_begin_partitioned_rewards_tpool( NULL, 0UL, 1UL, bank, accdb, xid, runtime_stack, capture_ctx,
+                                      stake_delegations, parent_blockhash, parent_epoch );
+}
 
 /* fd_rewards_recalculate_partitioned_rewards restores epoch bank stake
    and account reward calculations.  Does not update accounts.  Called
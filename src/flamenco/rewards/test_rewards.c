@@ -0,0 +1,346 @@
+/* test_rewards checks that the per vote account credits cache used by
+   the epoch boundary reward passes (cache_vote_credits) doesn't change
+   any result.  The points pass and the stake reward pass are run over
+   a synthetic stake set with and without the cache and the total
+   points, the per delegation points and the per delegation rewards
+   must match exactly.  The vote accounts cover the regular case and
+   the edge cases of the cache: no epoch credits, missing from funk and
+   epoch credits rolling over the ushort epoch of the table.  (Vote
+   accounts hold at most MAX_EPOCH_CREDITS_HISTORY==EPOCH_CREDITS_MAX
+   epoch credits, so the table can't overflow on decodable accounts.) */
+
+#include "fd_rewards.c"
+#include "../accdb/fd_accdb_admin.h"
+#include "../accdb/fd_accdb_sync.h"
+#include "../runtime/fd_system_ids.h"
+
+#define WKSP_TAG (1UL)
+
+#define TEST_EPOCH        (65540UL)  /* rewarded epoch, past USHORT_MAX */
+#define TEST_HISTORY_CNT  (256UL)
+#define TEST_DELEG_CNT    (512UL)
+
+/* Vote accounts by idx */
+
+#define VOTE_REGULAR_CNT  (4UL)
+#define VOTE_ZERO_CREDITS (4UL)  /* empty epoch credits */
+#define VOTE_MISSING      (5UL)  /* in vote states but not in funk */
+#define VOTE_ROLLOVER     (6UL)  /* epoch credits past USHORT_MAX */
+#define VOTE_CNT          (7UL)
+#define VOTE_UNKNOWN      (7UL)  /* not in vote states */
+
+static fd_pubkey_t
+test_key( ulong tag,
+          ulong x ) {
+  fd_pubkey_t key = {0};
+  key.ul[ 0 ] = tag;
+  key.ul[ 1 ] = x;
+  key.ul[ 3 ] = ~x;
+  return key;
+}
+
+static void
+history_init( fd_stake_history_t * history,
+              fd_rng_t *           rng ) {
+  memset( history, 0, sizeof(fd_stake_history_t) );
+  history->fd_stake_history_size   = 512UL;
+  history->fd_stake_history_len    = TEST_HISTORY_CNT;
+  history->fd_stake_history_offset = 0UL;
+  for( ulong i=0UL; i<TEST_HISTORY_CNT; i++ ) {
+    fd_epoch_stake_history_entry_pair_t * pair = history->fd_stake_history + i;
+    pair->epoch              = TEST_EPOCH-i;
+    pair->entry.effective    =  400000000000000000UL + fd_rng_ulong_roll( rng, 1000000000000000UL );
+    pair->entry.activating   = 4000000000000000000UL + fd_rng_ulong_roll( rng, 1000000000000000UL );
+    pair->entry.deactivating = 4000000000000000000UL + fd_rng_ulong_roll( rng, 1000000000000000UL );
+  }
+}
+
+/* vote_account_write writes a v3 vote account with credit_cnt epoch
+   credits for the epochs ending at last_epoch into funk.  Credits are
+   earned in random increments, some of them zero.  Returns the credits
+   of the last entry. */
+
+static ulong
+vote_account_write( fd_wksp_t *               wksp,
+                    fd_accdb_user_t *         accdb,
+                    fd_funk_txn_xid_t const * xid,
+                    fd_pubkey_t const *       vote_account,
+                    ulong                     credit_cnt,
+                    ulong                     last_epoch,
+                    fd_rng_t *                rng ) {
+  void * credits_mem = fd_wksp_alloc_laddr( wksp, deq_fd_vote_epoch_credits_t_align(), deq_fd_vote_epoch_credits_t_footprint( EPOCH_CREDITS_MAX ), WKSP_TAG );
+  FD_TEST( credits_mem );
+
+  fd_vote_state_versioned_t vsv[1];
+  fd_vote_state_versioned_new_disc( vsv, fd_vote_state_versioned_enum_v3 );
+  fd_vote_state_v3_t * vs = &vsv->inner.v3;
+  vs->node_pubkey           = *vote_account;
+  vs->authorized_withdrawer = *vote_account;
+  vs->commission            = 10;
+  vs->epoch_credits         = deq_fd_vote_epoch_credits_t_join( deq_fd_vote_epoch_credits_t_new( credits_mem, EPOCH_CREDITS_MAX ) );
+
+  ulong credits = fd_rng_ulong_roll( rng, 1000UL );
+  for( ulong i=0UL; i<credit_cnt; i++ ) {
+    ulong earned = fd_rng_uint_roll( rng, 4U ) ? fd_rng_ulong_roll( rng, 432000UL ) : 0UL;
+    fd_vote_epoch_credits_t * ele = deq_fd_vote_epoch_credits_t_push_tail_nocopy( vs->epoch_credits );
+    ele->epoch        = last_epoch-(credit_cnt-1UL-i);
+    ele->prev_credits = credits;
+    ele->credits      = credits+earned;
+    credits          += earned;
+  }
+
+  ulong data_sz = fd_vote_state_versioned_size( vsv );
+  uchar data[ FD_VOTE_STATE_VERSIONED_FOOTPRINT ];
+  FD_TEST( data_sz<=sizeof(data) );
+  fd_bincode_encode_ctx_t encode = { .data = data, .dataend = data+data_sz };
+  FD_TEST( fd_vote_state_versioned_encode( vsv, &encode )==FD_BINCODE_SUCCESS );
+
+  /* The reward passes decode into a FD_VOTE_STATE_VERSIONED_FOOTPRINT
+     buffer */
+  fd_bincode_decode_ctx_t decode = { .data = data, .dataend = data+data_sz };
+  ulong decode_sz = 0UL;
+  FD_TEST( fd_vote_state_versioned_decode_footprint( &decode, &decode_sz )==FD_BINCODE_SUCCESS );
+  FD_TEST( decode_sz<=FD_VOTE_STATE_VERSIONED_FOOTPRINT );
+
+  fd_accdb_rw_t rw[1];
+  FD_TEST( fd_accdb_open_rw( accdb, rw, xid, vote_account, data_sz, FD_ACCDB_FLAG_CREATE|FD_ACCDB_FLAG_TRUNCATE ) );
+  fd_accdb_ref_lamports_set( rw, 1000000000UL );
+  fd_accdb_ref_owner_set   ( rw, &fd_solana_vote_program_id );
+  fd_accdb_ref_data_set    ( rw, data, data_sz );
+  fd_accdb_close_rw( accdb, rw );
+
+  fd_wksp_free_laddr( credits_mem );
+  return credits;
+}
+
+/* stake_delegations_init delegates TEST_DELEG_CNT stake accounts to
+   random vote accounts (except VOTE_MISSING, for which both paths
+   fail hard) with a mix of activation states and credits observed
+   below, at and above the credits of the vote account. */
+
+static void
+stake_delegations_init( fd_stake_delegations_t * stake_delegations,
+                        ulong const *            last_credits,
+                        fd_rng_t *               rng ) {
+  for( ulong i=0UL; i<TEST_DELEG_CNT; i++ ) {
+    ulong vote_idx;
+    do vote_idx = fd_rng_ulong_roll( rng, VOTE_UNKNOWN+1UL ); while( vote_idx==VOTE_MISSING );
+
+    fd_pubkey_t stake_account = test_key( 2UL, i        );
+    fd_pubkey_t vote_account  = test_key( 1UL, vote_idx );
+
+    ulong activation_epoch   = ULONG_MAX;
+    ulong deactivation_epoch = ULONG_MAX;
+    switch( fd_rng_uint_roll( rng, 4U ) ) {
+    case 0U: break; /* bootstrap */
+    case 1U: activation_epoch = TEST_EPOCH-fd_rng_ulong_roll( rng, 200UL );                        break;
+    case 2U: activation_epoch = TEST_EPOCH-100UL-fd_rng_ulong_roll( rng, 100UL );
+             deactivation_epoch = activation_epoch+fd_rng_ulong_roll( rng, 100UL );                break;
+    case 3U: activation_epoch = TEST_EPOCH;                                                         break;
+    }
+
+    ulong last = vote_idx<VOTE_CNT ? last_credits[ vote_idx ] : 0UL;
+    ulong credits_observed;
+    switch( fd_rng_uint_roll( rng, 4U ) ) {
+    case 0U:  credits_observed = 0UL;                                     break;
+    case 1U:  credits_observed = last;                                    break;
+    case 2U:  credits_observed = last+1UL+fd_rng_ulong_roll( rng, 10UL ); break;
+    default:  credits_observed = fd_rng_ulong_roll( rng, last+1UL );      break;
+    }
+
+    ulong stake = fd_rng_uint_roll( rng, 16U ) ? 1000000000UL+fd_rng_ulong_roll( rng, 1000000000000000UL ) : fd_rng_ulong_roll( rng, 1000000000UL );
+
+    fd_stake_delegations_update( stake_delegations, &stake_account, &vote_account, stake,
+                                 activation_epoch, deactivation_epoch, credits_observed, 0.25 );
+  }
+}
+
+static uint128
+reward_points( fd_funk_t *                    funk,
+               fd_funk_txn_xid_t const *      xid,
+               fd_stake_delegations_t const * stake_delegations,
+               fd_stake_history_t const *     stake_history,
+               fd_vote_states_t const *       vote_states,
+               ulong *                        new_rate_activation_epoch,
+               fd_vote_state_credits_t *      vote_credits ) {
+  uint128 total_points[1];
+  long chain_cnt = (long)fd_stake_delegations_chain_cnt( stake_delegations );
+  FD_MAP_REDUCE( calculate_reward_points_task, NULL,0UL,1UL, 0L,chain_cnt, total_points,
+                 funk, xid, stake_delegations, stake_history, vote_states, new_rate_activation_epoch, 1000000000UL,
+                 vote_credits );
+  return total_points[0];
+}
+
+static void
+test_rewards_vote_credits_cache( fd_funk_t *                    funk,
+                                 fd_funk_txn_xid_t const *      xid,
+                                 fd_stake_delegations_t const * stake_delegations,
+                                 fd_stake_history_t const *     stake_history,
+                                 fd_vote_states_t const *       vote_states,
+                                 ulong *                        new_rate_activation_epoch,
+                                 fd_vote_state_credits_t *      cached,
+                                 fd_vote_state_credits_t *      uncached ) {
+
+  /* Total points */
+
+  uint128 points_cached   = reward_points( funk, xid, stake_delegations, stake_history, vote_states, new_rate_activation_epoch, cached   );
+  uint128 points_uncached = reward_points( funk, xid, stake_delegations, stake_history, vote_states, new_rate_activation_epoch, uncached );
+  FD_TEST( points_cached>0 );
+  FD_TEST( points_cached==points_uncached );
+
+  /* Per delegation points and rewards */
+
+  ulong const total_rewards[2] = { 0UL, 1000000000000000UL };
+  for( ulong r=0UL; r<2UL; r++ ) {
+    ulong reward_cnt = 0UL;
+    fd_stake_delegations_iter_t iter_[1];
+    for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init( iter_, stake_delegations );
+         !fd_stake_delegations_iter_done( iter );
+         fd_stake_delegations_iter_next( iter ) ) {
+      fd_stake_delegation_t const * stake      = fd_stake_delegations_iter_ele( iter );
+      fd_vote_state_ele_t const *   vote_state = fd_vote_states_query_const( vote_states, &stake->vote_account );
+      if( !vote_state ) continue;
+
+      fd_calculated_stake_points_t p0 = {0};
+      fd_calculated_stake_points_t p1 = {0};
+      calculate_stake_points( funk, xid, stake_history, stake, vote_state, new_rate_activation_epoch, &cached[ vote_state->idx ], &p0 );
+      calculate_stake_points( funk, xid, stake_history, stake, vote_state, new_rate_activation_epoch, NULL,                       &p1 );
+      FD_TEST( p0.points.ud                                ==p1.points.ud                                 );
+      FD_TEST( p0.new_credits_observed                     ==p1.new_credits_observed                      );
+      FD_TEST( p0.force_credits_update_with_skipped_reward==p1.force_credits_update_with_skipped_reward );
+
+      fd_calculated_stake_rewards_t s0 = {0};
+      fd_calculated_stake_rewards_t s1 = {0};
+      int err0 = redeem_rewards( funk, xid, stake_history, stake, vote_state, TEST_EPOCH, total_rewards[ r ], points_cached,
+                                 new_rate_activation_epoch, &cached[ vote_state->idx ], &s0 );
+      int err1 = redeem_rewards( funk, xid, stake_history, stake, vote_state, TEST_EPOCH, total_rewards[ r ], points_uncached,
+                                 new_rate_activation_epoch, NULL, &s1 );
+      FD_TEST( err0==err1 );
+      FD_TEST( s0.staker_rewards      ==s1.staker_rewards       );
+      FD_TEST( s0.voter_rewards       ==s1.voter_rewards        );
+      FD_TEST( s0.new_credits_observed==s1.new_credits_observed );
+      reward_cnt += (ulong)( !err0 && s0.staker_rewards );
+    }
+    if( total_rewards[ r ] ) FD_TEST( reward_cnt );
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "gigantic"                   );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL                          );
+  ulong        numa_idx = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx", NULL, fd_shmem_numa_idx( 0 )     );
+
+  ulong page_sz = fd_cstr_to_shmem_page_sz( _page_sz );
+  if( FD_UNLIKELY( !page_sz ) ) FD_LOG_ERR(( "unsupported --page-sz" ));
+
+  FD_LOG_NOTICE(( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)", page_cnt, _page_sz, numa_idx ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( page_sz, page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1234U, 0UL ) );
+
+  /* Accounts database */
+
+  ulong const txn_max = 1UL;
+  ulong const rec_max = 64UL;
+  void * funk_mem = fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint( txn_max, rec_max ), WKSP_TAG );
+  FD_TEST( funk_mem );
+  FD_TEST( fd_funk_new( funk_mem, WKSP_TAG, 17UL, txn_max, rec_max ) );
+
+  fd_accdb_admin_t accdb_admin[1];
+  fd_accdb_user_t  accdb[1];
+  FD_TEST( fd_accdb_admin_join( accdb_admin, funk_mem ) );
+  FD_TEST( fd_accdb_user_v1_init( accdb, funk_mem ) );
+  fd_funk_t * funk = fd_accdb_user_v1_funk( accdb );
+
+  fd_funk_txn_xid_t root[1];
+  fd_funk_txn_xid_set_root( root );
+  fd_funk_txn_xid_t xid = { .ul = { TEST_EPOCH, 0UL } };
+  fd_accdb_attach_child( accdb_admin, root, &xid );
+
+  /* Vote accounts */
+
+  void * vote_states_mem = fd_wksp_alloc_laddr( wksp, fd_vote_states_align(), fd_vote_states_footprint( VOTE_CNT ), WKSP_TAG );
+  FD_TEST( vote_states_mem );
+  fd_vote_states_t * vote_states = fd_vote_states_join( fd_vote_states_new( vote_states_mem, VOTE_CNT, 42UL ) );
+  FD_TEST( vote_states );
+
+  ulong last_credits[ VOTE_CNT ] = {0};
+  ulong vote_state_idx[ VOTE_CNT ];
+  for( ulong i=0UL; i<VOTE_CNT; i++ ) {
+    fd_pubkey_t vote_account = test_key( 1UL, i );
+    fd_vote_state_ele_t * vote_state = fd_vote_states_update( vote_states, &vote_account );
+    FD_TEST( vote_state );
+    vote_state->commission = (uchar)( i==0UL ? 0 : i==1UL ? 100 : 5UL*i );
+    vote_state_idx[ i ] = vote_state->idx;
+
+    ulong credit_cnt;
+    ulong last_epoch = TEST_EPOCH-1UL;
+    switch( i ) {
+    case VOTE_ZERO_CREDITS: credit_cnt = 0UL;                    break;
+    case VOTE_MISSING:      continue;
+    case VOTE_ROLLOVER:     credit_cnt = 16UL;                   break; /* epochs 65524..65539 */
+    default:                credit_cnt = 1UL+fd_rng_ulong_roll( rng, EPOCH_CREDITS_MAX );
+                            last_epoch = USHORT_MAX-i;           break;
+    }
+    last_credits[ i ] = vote_account_write( wksp, accdb, &xid, &vote_account, credit_cnt, last_epoch, rng );
+  }
+
+  /* The cache holds the regular and zero credit vote accounts and
+     falls back to funk for the others. */
+
+  static fd_vote_state_credits_t cached  [ VOTE_CNT ];
+  static fd_vote_state_credits_t uncached[ VOTE_CNT ];
+  cache_vote_credits( funk, &xid, vote_states, cached );
+  for( ulong i=0UL; i<VOTE_CNT; i++ ) uncached[ i ].credits_cnt = VOTE_CREDITS_UNCACHED;
+
+  for( ulong i=0UL; i<VOTE_REGULAR_CNT; i++ ) {
+    fd_vote_state_credits_t const * credits = &cached[ vote_state_idx[ i ] ];
+    FD_TEST( credits->credits_cnt!=VOTE_CREDITS_UNCACHED );
+    FD_TEST( credits->credits_cnt>0UL );
+    FD_TEST( credits->credits[ credits->credits_cnt-1UL ]==last_credits[ i ] );
+  }
+  FD_TEST( cached[ vote_state_idx[ VOTE_ZERO_CREDITS ] ].credits_cnt==0UL                   );
+  FD_TEST( cached[ vote_state_idx[ VOTE_MISSING      ] ].credits_cnt==VOTE_CREDITS_UNCACHED );
+  FD_TEST( cached[ vote_state_idx[ VOTE_ROLLOVER     ] ].credits_cnt==VOTE_CREDITS_UNCACHED );
+
+  /* Stake delegations */
+
+  void * stake_delegations_mem = fd_wksp_alloc_laddr( wksp, fd_stake_delegations_align(), fd_stake_delegations_footprint( TEST_DELEG_CNT ), WKSP_TAG );
+  FD_TEST( stake_delegations_mem );
+  fd_stake_delegations_t * stake_delegations = fd_stake_delegations_join( fd_stake_delegations_new( stake_delegations_mem, 99UL, TEST_DELEG_CNT, 0 ) );
+  FD_TEST( stake_delegations );
+  stake_delegations_init( stake_delegations, last_credits, rng );
+
+  static fd_stake_history_t stake_history[1];
+  history_init( stake_history, rng );
+
+  /* With and without the new warmup cooldown rate */
+
+  ulong new_rate_activation_epoch = TEST_EPOCH-50UL;
+  test_rewards_vote_credits_cache( funk, &xid, stake_delegations, stake_history, vote_states, NULL,
+                                   cached, uncached );
+  test_rewards_vote_credits_cache( funk, &xid, stake_delegations, stake_history, vote_states, &new_rate_activation_epoch,
+                                   cached, uncached );
+
+  /* Clean up */
+
+  fd_wksp_free_laddr( fd_stake_delegations_delete( fd_stake_delegations_leave( stake_delegations ) ) );
+  fd_wksp_free_laddr( vote_states_mem );
+
+  void * shfunk = NULL;
+  fd_accdb_admin_leave( accdb_admin, &shfunk );
+  fd_accdb_user_fini( accdb );
+  fd_wksp_free_laddr( fd_funk_delete( shfunk ) );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -25,6 +25,13 @@ $(call add-hdrs,fd_txncache_shmem.h fd_txncache.h)
 $(call add-objs,fd_txncache_shmem fd_txncache,fd_flamenco)
 endif
 
+ifdef FD_HAS_ATOMIC
+$(call add-hdrs,fd_sigstatus.h)
+$(call add-objs,fd_sigstatus,fd_flamenco)
+$(call make-unit-test,test_sigstatus,test_sigstatus,fd_flamenco fd_util)
+$(call run-unit-test,test_sigstatus,)
+endif
+
 $(call add-hdrs,fd_cost_tracker.h)
 $(call add-objs,fd_cost_tracker,fd_flamenco)
 ifdef FD_HAS_SECP256K1
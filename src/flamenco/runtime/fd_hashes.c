@@ -95,6 +95,14 @@ fd_hashes_update_lthash1( fd_lthash_value_t *       lthash_post, /* out */
 
   fd_bank_lthash_end_locking_modify( bank );
 
+  fd_hashes_capture_account_update( pubkey, meta, bank, capture_ctx );
+}
+
+void
+fd_hashes_capture_account_update( fd_pubkey_t const *       pubkey,
+                                  fd_account_meta_t const * meta,
+                                  fd_bank_t const *         bank,
+                                  fd_capture_ctx_t *        capture_ctx ) {
   if( capture_ctx && capture_ctx->capture &&
       fd_bank_slot_get( bank )>=capture_ctx->solcap_start_slot ) {
     fd_solana_account_meta_t solana_meta[1];
@@ -114,3 +122,18 @@ fd_hashes_update_lthash1( fd_lthash_value_t *       lthash_post, /* out */
       meta->dlen );
   }
 }
+
+void
+fd_hashes_lthash_batch_commit( fd_hashes_lthash_batch_t * batch,
+                               fd_bank_t *                bank ) {
+  fd_lthash_adder_flush( batch->add, batch->add_sum );
+  fd_lthash_adder_flush( batch->sub, batch->sub_sum );
+
+  fd_lthash_value_t * bank_lthash = fd_type_pun( fd_bank_lthash_locking_modify( bank ) );
+  fd_lthash_sub( bank_lthash, batch->sub_sum );
+  fd_lthash_add( bank_lthash, batch->add_sum );
+  fd_bank_lthash_end_locking_modify( bank );
+
+  fd_lthash_zero( batch->add_sum );
+  fd_lthash_zero( batch->sub_sum );
+}
@@ -4,6 +4,7 @@
 #include "../fd_flamenco_base.h"
 #include "../types/fd_types.h"
 #include "../../ballet/lthash/fd_lthash.h"
+#include "../../ballet/lthash/fd_lthash_adder.h"
 
 /* fd_hashes.h provides functions for computing and updating the bank hash
    for a completed slot.  The bank hash is a cryptographic hash of the
@@ -123,6 +124,116 @@ fd_hashes_update_lthash( fd_pubkey_t const *       pubkey,
   fd_hashes_update_lthash1( post, prev_account_hash, pubkey, meta, bank, capture_ctx );
 }
 
+/* fd_hashes_capture_account_update writes the account update given by
+   pubkey and meta (with data following meta) to the capture if
+   capture_ctx is non-NULL and capturing is enabled for the bank's
+   slot.  On capture write failure, the function will FD_LOG_ERR and
+   terminate. */
+
+void
+fd_hashes_capture_account_update( fd_pubkey_t const *       pubkey,
+                                  fd_account_meta_t const * meta,
+                                  fd_bank_t const *         bank,
+                                  fd_capture_ctx_t *        capture_ctx );
+
+/* fd_hashes_lthash_batch_t accumulates the bank lthash delta of a
+   batch of account modifications (typically all accounts written by a
+   transaction) such that account hashing is spread across the SIMD
+   lanes of fd_lthash_adder and the bank lthash lock is only taken once
+   per batch.  Previous revisions are queued with
+   fd_hashes_lthash_batch_sub and new revisions with
+   fd_hashes_lthash_batch_add.  The result is identical to calling
+   fd_hashes_update_lthash for each account.
+
+   A batch is about 37 KiB, is position dependent and is intended to
+   live on the stack of the caller:
+
+     fd_hashes_lthash_batch_t batch[1];
+     fd_hashes_lthash_batch_init( batch );
+     for( ... each written account ... ) {
+       fd_hashes_lthash_batch_sub( batch, pubkey, prev_meta, prev_data );
+       fd_hashes_lthash_batch_add( batch, pubkey, meta, fd_account_data( meta ) );
+     }
+     fd_hashes_lthash_batch_commit( batch, bank );
+
+   The account contents are copied (or hashed) on push, so the account
+   records may be released before the batch is committed. */
+
+struct fd_hashes_lthash_batch {
+  fd_lthash_value_t add_sum[1];
+  fd_lthash_value_t sub_sum[1];
+  fd_lthash_adder_t add[1];
+  fd_lthash_adder_t sub[1];
+};
+
+typedef struct fd_hashes_lthash_batch fd_hashes_lthash_batch_t;
+
+static inline fd_hashes_lthash_batch_t *
+fd_hashes_lthash_batch_init( fd_hashes_lthash_batch_t * batch ) {
+  fd_lthash_zero( batch->add_sum );
+  fd_lthash_zero( batch->sub_sum );
+  fd_lthash_adder_new( batch->add );
+  fd_lthash_adder_new( batch->sub );
+  return batch;
+}
+
+/* fd_hashes_lthash_batch_push_private queues the lthash of the given
+   account revision (as computed by fd_hashes_account_lthash) into
+   adder.  Zero lamport accounts do not contribute to the lthash. */
+
+static inline void
+fd_hashes_lthash_batch_push_private( fd_lthash_adder_t *       adder,
+                                     fd_lthash_value_t *       sum,
+                                     fd_pubkey_t const *       pubkey,
+                                     fd_account_meta_t const * meta,
+                                     uchar const *             data ) {
+  if( FD_UNLIKELY( !meta->lamports ) ) return;
+  fd_lthash_adder_push_solana_account( adder, sum, pubkey->uc, data, meta->dlen, meta->lamports,
+                                       (uchar)( meta->executable & 0x1 ), meta->owner );
+}
+
+/* fd_hashes_lthash_batch_{sub,add} queue the {removal,addition} of the
+   given account revision from/to the bank lthash.  data points to the
+   account data of meta->dlen bytes. */
+
+static inline void
+fd_hashes_lthash_batch_sub( fd_hashes_lthash_batch_t * batch,
+                            fd_pubkey_t const *        pubkey,
+                            fd_account_meta_t const *  meta,
+                            uchar const *              data ) {
+  fd_hashes_lthash_batch_push_private( batch->sub, batch->sub_sum, pubkey, meta, data );
+}
+
+static inline void
+fd_hashes_lthash_batch_add( fd_hashes_lthash_batch_t * batch,
+                            fd_pubkey_t const *        pubkey,
+                            fd_account_meta_t const *  meta,
+                            uchar const *              data ) {
+  fd_hashes_lthash_batch_push_private( batch->add, batch->add_sum, pubkey, meta, data );
+}
+
+/* fd_hashes_lthash_batch_flush applies all queued removals and
+   additions to lthash and resets the batch for reuse. */
+
+static inline void
+fd_hashes_lthash_batch_flush( fd_hashes_lthash_batch_t * batch,
+                              fd_lthash_value_t *        lthash ) {
+  fd_lthash_adder_flush( batch->add, batch->add_sum );
+  fd_lthash_adder_flush( batch->sub, batch->sub_sum );
+  fd_lthash_sub( lthash, batch->sub_sum );
+  fd_lthash_add( lthash, batch->add_sum );
+  fd_lthash_zero( batch->add_sum );
+  fd_lthash_zero( batch->sub_sum );
+}
+
+/* fd_hashes_lthash_batch_commit is fd_hashes_lthash_batch_flush on the
+   bank lthash (under the bank lthash lock).  The adders are drained
+   before the lock is taken. */
+
+void
+fd_hashes_lthash_batch_commit( fd_hashes_lthash_batch_t * batch,
+                               fd_bank_t *                bank );
+
 /* fd_hashes_hash_bank computes the bank hash for a completed slot.  The
    bank hash is a deterministic hash of the slot's state including all
    account modifications and transaction signatures.
@@ -1062,54 +1062,55 @@ fd_runtime_finalize_account( fd_accdb_user_t *         accdb,
 }
 
 /* fd_runtime_save_account persists a transaction account to the account
-   database and updates the bank lthash.
+   database and queues the bank lthash update into batch.
 
    This function:
    - Loads the previous account revision
-   - Computes the LtHash of the previous revision
-   - Computes the LtHash of the new revision
-   - Removes/adds the previous/new revision's LtHash
+   - Queues the removal/addition of the previous/new revision's LtHash
    - Saves the new version of the account to funk
    - Sends updates to metrics and capture infra
 
+   The bank lthash is only updated once the caller commits the batch
+   (fd_hashes_lthash_batch_commit).
+
    Returns FD_RUNTIME_SAVE_* */
 
 static int
-fd_runtime_save_account( fd_accdb_user_t *         accdb,
-                         fd_funk_txn_xid_t const * xid,
-                         fd_pubkey_t const *       pubkey,
-                         fd_account_meta_t *       meta,
-                         fd_bank_t *               bank,
-                         fd_capture_ctx_t *        capture_ctx ) {
-  fd_lthash_value_t lthash_post[1];
-  fd_lthash_value_t lthash_prev[1];
+fd_runtime_save_account( fd_accdb_user_t *          accdb,
+                         fd_funk_txn_xid_t const *  xid,
+                         fd_pubkey_t const *        pubkey,
+                         fd_account_meta_t *        meta,
+                         fd_bank_t *                bank,
+                         fd_capture_ctx_t *         capture_ctx,
+                         fd_hashes_lthash_batch_t * batch ) {
 
   /* Update LtHash
-     - Query old version of account and hash it
-     - Hash new version of account */
-  fd_accdb_ro_t ro[1];
+     - Query old version of account and queue its removal
+     - Queue addition of new version of account */
+  int new_exist = meta->lamports!=0UL;
   int old_exist = 0;
+  int unchanged = 0;
+  fd_accdb_ro_t ro[1];
   if( fd_accdb_open_ro( accdb, ro, xid, pubkey ) ) {
+    fd_account_meta_t const * prev      = ro->meta;
+    uchar const *             prev_data = fd_accdb_ref_data_const( ro );
     old_exist = fd_accdb_ref_lamports( ro )!=0UL;
-    fd_hashes_account_lthash(
-      pubkey,
-      ro->meta,
-      fd_accdb_ref_data_const( ro ),
-      lthash_prev );
+    fd_hashes_lthash_batch_sub( batch, pubkey, prev, prev_data );
+
+    /* An account is unchanged if all of the inputs to its LtHash are
+       unchanged (this was previously detected by comparing the first
+       32 bytes of the pre and post LtHash, which are the BLAKE3_256
+       hash of these inputs). */
+    unchanged = prev->lamports==meta->lamports &&
+                prev->dlen    ==meta->dlen     &&
+                ( prev->executable & 0x1 )==( meta->executable & 0x1 ) &&
+                fd_memeq( prev->owner, meta->owner, sizeof(fd_pubkey_t) ) &&
+                fd_memeq( prev_data, fd_account_data( meta ), meta->dlen );
     fd_accdb_close_ro( accdb, ro );
-  } else {
-    old_exist = 0;
-    fd_lthash_zero( lthash_prev );
   }
-  int new_exist = meta->lamports!=0UL;
 
-  fd_hashes_update_lthash1( lthash_post, lthash_prev, pubkey, meta, bank, capture_ctx );
-
-  /* The first 32 bytes of an LtHash with a single input element are
-     equal to the BLAKE3_256 hash of an account.  Therefore, comparing
-     the first 32 bytes is a cryptographically secure equality check
-     for an account. */
-  int unchanged = 0==memcmp( lthash_post->bytes, lthash_prev->bytes, 32UL );
+  fd_hashes_lthash_batch_add( batch, pubkey, meta, fd_account_data( meta ) );
+  fd_hashes_capture_account_update( pubkey, meta, bank, capture_ctx );
 
   if( old_exist || new_exist ) {
     fd_runtime_finalize_account( accdb, xid, pubkey, meta );
@@ -1136,6 +1137,12 @@ fd_runtime_commit_txn( fd_runtime_t * runtime,
 
   fd_funk_txn_xid_t xid = { .ul = { fd_bank_slot_get( bank ), bank->idx } };
 
+  /* The LtHash updates of all accounts written by the transaction are
+     batched such that they are hashed across SIMD lanes and applied to
+     the bank lthash under a single lock acquisition. */
+  fd_hashes_lthash_batch_t lthash_batch[1];
+  fd_hashes_lthash_batch_init( lthash_batch );
+
   if( FD_UNLIKELY( txn_out->err.txn_err ) ) {
 
     /* Save the fee_payer. Everything but the fee balance should be reset.
@@ -1159,7 +1166,8 @@ fd_runtime_commit_txn( fd_runtime_t * runtime,
             &txn_out->accounts.keys[txn_out->accounts.nonce_idx_in_txn],
             txn_out->accounts.rollback_nonce,
             bank,
-            runtime->log.capture_ctx );
+            runtime->log.capture_ctx,
+            lthash_batch );
       runtime->metrics.txn_account_save[ save_type ]++;
     }
     /* Now, we must only save the fee payer if the nonce account was not the fee payer (because that was already saved above) */
@@ -1171,7 +1179,8 @@ fd_runtime_commit_txn( fd_runtime_t * runtime,
             &txn_out->accounts.keys[FD_FEE_PAYER_TXN_IDX],
             txn_out->accounts.rollback_fee_payer,
             bank,
-            runtime->log.capture_ctx );
+            runtime->log.capture_ctx,
+            lthash_batch );
       runtime->metrics.txn_account_save[ save_type ]++;
     }
   } else {
@@ -1207,7 +1216,7 @@ fd_runtime_commit_txn( fd_runtime_t * runtime,
       fd_executor_reclaim_account( txn_out->accounts.metas[i], fd_bank_slot_get( bank ) );
 
       int save_type =
-        fd_runtime_save_account( runtime->accdb, &xid, pubkey, meta, bank, runtime->log.capture_ctx );
+        fd_runtime_save_account( runtime->accdb, &xid, pubkey, meta, bank, runtime->log.capture_ctx, lthash_batch );
       runtime->metrics.txn_account_save[ save_type ]++;
     }
 
@@ -1222,6 +1231,8 @@ fd_runtime_commit_txn( fd_runtime_t * runtime,
     }
   }
 
+  fd_hashes_lthash_batch_commit( lthash_batch, bank );
+
   /* Accumulate block-level information to the bank. */
 
   FD_ATOMIC_FETCH_AND_ADD( fd_bank_txn_count_modify( bank ),       1UL );
@@ -99,6 +99,9 @@ struct fd_runtime {
        into protobuf files. */
     int                  enable_vm_tracing;
     uchar *              tracing_mem;
+    /* Profile sBPF program executions are accumulated into (NULL if
+       not profiling), see fd_vm_prof_t. */
+    fd_vm_prof_t *       vm_prof;
   } log;
 
   struct {
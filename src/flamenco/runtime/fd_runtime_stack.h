@@ -32,9 +32,12 @@ union fd_runtime_stack {
 
   struct {
 
-    /* Vote state credits as of the end of the previous epoch.  This
-       only used at boot to recalculate partitioned epoch rewards if
-       needed and is not updated after. */
+    /* Epoch credits of each vote account, indexed by vote state idx.
+       At boot, these are the credits as of the end of the previous
+       epoch, which are used to recalculate partitioned epoch rewards
+       if needed.  At the epoch boundary, the rewards calculation
+       caches the current credits of every vote account here so the
+       passes over all stake delegations don't decode vote accounts. */
     int                     prev_vote_credits_used;
     fd_vote_state_credits_t vote_credits[ FD_RUNTIME_MAX_VOTE_ACCOUNTS ];
 
@@ -0,0 +1,357 @@
+#include "fd_sigstatus.h"
+
+/* FD_SIGSTATUS_PROBE_MAX bounds the length of a probe sequence.  Tables
+   are sized to be at most half full, so long probes only happen when
+   the index is badly undersized, in which case inserts are dropped
+   rather than degrading every query. */
+
+#define FD_SIGSTATUS_PROBE_MAX (128UL)
+
+/* Slot ring states */
+
+#define FD_SIGSTATUS_SLOT_LIVE   (1UL)
+#define FD_SIGSTATUS_SLOT_ROOTED (2UL)
+
+struct fd_sigstatus_ele {
+  ulong  tag;        /* signature bytes [0,8), forced non-zero, 0 if free */
+  ulong  sig1;       /* signature bytes [8,16) */
+  ulong  slot1;      /* slot+1, 0 if not yet published */
+  uint   custom_err;
+  schar  txn_err;
+  schar  instr_err;
+  ushort instr_idx;
+};
+
+typedef struct fd_sigstatus_ele fd_sigstatus_ele_t;
+
+struct __attribute__((aligned(FD_SIGSTATUS_ALIGN))) fd_sigstatus_private {
+  ulong magic;
+  ulong ele_max;
+  ulong slots_per_gen;
+  ulong slot_max;       /* GEN_CNT*slots_per_gen */
+  ulong seed;
+  ulong gen_newest;     /* newest generation begun, ULONG_MAX if none */
+  ulong root_slot;      /* ULONG_MAX if none */
+  ulong drop_cnt;
+  ulong gen_id[ FD_SIGSTATUS_GEN_CNT ]; /* generation held by each table, ULONG_MAX if none */
+  ulong slot_off;       /* ring of slot_max (slot<<2)|state words */
+  ulong tbl_off;        /* GEN_CNT tables of ele_max entries */
+};
+
+FD_STATIC_ASSERT( sizeof(fd_sigstatus_ele_t)==32UL, layout );
+
+static inline ulong *
+fd_sigstatus_slot_ring( fd_sigstatus_t const * ss ) {
+  return (ulong *)( (ulong)ss + ss->slot_off );
+}
+
+static inline fd_sigstatus_ele_t *
+fd_sigstatus_tbl( fd_sigstatus_t const * ss,
+                  ulong                  tbl_idx ) {
+  return (fd_sigstatus_ele_t *)( (ulong)ss + ss->tbl_off ) + tbl_idx*ss->ele_max;
+}
+
+static inline ulong
+fd_sigstatus_tag( uchar const * sig ) {
+  ulong tag = FD_LOAD( ulong, sig );
+  return fd_ulong_if( !tag, 1UL, tag );
+}
+
+FD_FN_CONST ulong
+fd_sigstatus_align( void ) {
+  return FD_SIGSTATUS_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_sigstatus_footprint( ulong ele_max,
+                        ulong slots_per_gen ) {
+  if( FD_UNLIKELY( !ele_max || !fd_ulong_is_pow2( ele_max ) ) ) return 0UL;
+  if( FD_UNLIKELY( ele_max>(ULONG_MAX/(FD_SIGSTATUS_GEN_CNT*sizeof(fd_sigstatus_ele_t))) ) ) return 0UL;
+  if( FD_UNLIKELY( !slots_per_gen || slots_per_gen>(1UL<<24) ) ) return 0UL;
+
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_SIGSTATUS_ALIGN,  sizeof(fd_sigstatus_t) );
+  l = FD_LAYOUT_APPEND( l, alignof(ulong),      FD_SIGSTATUS_GEN_CNT*slots_per_gen*sizeof(ulong) );
+  l = FD_LAYOUT_APPEND( l, FD_SIGSTATUS_ALIGN,  FD_SIGSTATUS_GEN_CNT*ele_max*sizeof(fd_sigstatus_ele_t) );
+  return FD_LAYOUT_FINI( l, FD_SIGSTATUS_ALIGN );
+}
+
+void *
+fd_sigstatus_new( void * shmem,
+                  ulong  ele_max,
+                  ulong  slots_per_gen,
+                  ulong  seed ) {
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_sigstatus_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_sigstatus_footprint( ele_max, slots_per_gen );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "invalid ele_max (%lu) or slots_per_gen (%lu)", ele_max, slots_per_gen ));
+    return NULL;
+  }
+
+  ulong slot_max = FD_SIGSTATUS_GEN_CNT*slots_per_gen;
+
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_sigstatus_t * ss = FD_SCRATCH_ALLOC_APPEND( l, FD_SIGSTATUS_ALIGN, sizeof(fd_sigstatus_t)                                  );
+  void *  slot_ring   = FD_SCRATCH_ALLOC_APPEND( l, alignof(ulong),     slot_max*sizeof(ulong)                                  );
+  void *  tbl         = FD_SCRATCH_ALLOC_APPEND( l, FD_SIGSTATUS_ALIGN, FD_SIGSTATUS_GEN_CNT*ele_max*sizeof(fd_sigstatus_ele_t) );
+  FD_SCRATCH_ALLOC_FINI( l, FD_SIGSTATUS_ALIGN );
+
+  memset( ss, 0, sizeof(fd_sigstatus_t) );
+  ss->ele_max       = ele_max;
+  ss->slots_per_gen = slots_per_gen;
+  ss->slot_max      = slot_max;
+  ss->seed          = seed;
+  ss->gen_newest    = ULONG_MAX;
+  ss->root_slot     = ULONG_MAX;
+  ss->drop_cnt      = 0UL;
+  for( ulong i=0UL; i<FD_SIGSTATUS_GEN_CNT; i++ ) ss->gen_id[ i ] = ULONG_MAX;
+  ss->slot_off      = (ulong)slot_ring - (ulong)ss;
+  ss->tbl_off       = (ulong)tbl       - (ulong)ss;
+
+  memset( slot_ring, 0, slot_max*sizeof(ulong)                                  );
+  memset( tbl,       0, FD_SIGSTATUS_GEN_CNT*ele_max*sizeof(fd_sigstatus_ele_t) );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( ss->magic ) = FD_SIGSTATUS_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_sigstatus_t *
+fd_sigstatus_join( void * shss ) {
+  if( FD_UNLIKELY( !shss ) ) {
+    FD_LOG_WARNING(( "NULL shss" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shss, fd_sigstatus_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shss" ));
+    return NULL;
+  }
+
+  fd_sigstatus_t * ss = (fd_sigstatus_t *)shss;
+  if( FD_UNLIKELY( ss->magic!=FD_SIGSTATUS_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return ss;
+}
+
+void *
+fd_sigstatus_leave( fd_sigstatus_t * ss ) {
+  if( FD_UNLIKELY( !ss ) ) {
+    FD_LOG_WARNING(( "NULL ss" ));
+    return NULL;
+  }
+  return (void *)ss;
+}
+
+void *
+fd_sigstatus_delete( void * shss ) {
+  if( FD_UNLIKELY( !shss ) ) {
+    FD_LOG_WARNING(( "NULL shss" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shss, fd_sigstatus_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shss" ));
+    return NULL;
+  }
+
+  fd_sigstatus_t * ss = (fd_sigstatus_t *)shss;
+  if( FD_UNLIKELY( ss->magic!=FD_SIGSTATUS_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( ss->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shss;
+}
+
+void
+fd_sigstatus_slot_begin( fd_sigstatus_t * ss,
+                         ulong            slot ) {
+  ulong gen = slot / ss->slots_per_gen;
+
+  if( FD_UNLIKELY( ss->gen_newest==ULONG_MAX || gen>ss->gen_newest ) ) {
+    /* Recycle the tables of every generation skipped over, at most
+       GEN_CNT of them.  Readers see the table generation go to
+       ULONG_MAX for the duration of the wipe and ignore it. */
+    ulong gen0 = gen - fd_ulong_min( gen, FD_SIGSTATUS_GEN_CNT-1UL );
+    if( ss->gen_newest!=ULONG_MAX ) gen0 = fd_ulong_max( gen0, ss->gen_newest+1UL );
+    for( ulong g=gen0; g<=gen; g++ ) {
+      ulong tbl_idx = g % FD_SIGSTATUS_GEN_CNT;
+      FD_VOLATILE( ss->gen_id[ tbl_idx ] ) = ULONG_MAX;
+      FD_COMPILER_MFENCE();
+      memset( fd_sigstatus_tbl( ss, tbl_idx ), 0, ss->ele_max*sizeof(fd_sigstatus_ele_t) );
+      FD_COMPILER_MFENCE();
+      FD_VOLATILE( ss->gen_id[ tbl_idx ] ) = g;
+    }
+    ss->gen_newest = gen;
+  }
+
+  ulong * ring = fd_sigstatus_slot_ring( ss );
+  FD_VOLATILE( ring[ slot % ss->slot_max ] ) = (slot<<2) | FD_SIGSTATUS_SLOT_LIVE;
+}
+
+void
+fd_sigstatus_slot_root( fd_sigstatus_t * ss,
+                        ulong            slot ) {
+  ulong * ring = fd_sigstatus_slot_ring( ss );
+  FD_VOLATILE( ring[ slot % ss->slot_max ] ) = (slot<<2) | FD_SIGSTATUS_SLOT_ROOTED;
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( ss->root_slot ) = slot;
+}
+
+ulong
+fd_sigstatus_root_slot( fd_sigstatus_t const * ss ) {
+  return FD_VOLATILE_CONST( ss->root_slot );
+}
+
+ulong
+fd_sigstatus_drop_cnt( fd_sigstatus_t const * ss ) {
+  return FD_VOLATILE_CONST( ss->drop_cnt );
+}
+
+int
+fd_sigstatus_insert( fd_sigstatus_t * ss,
+                     uchar const *    sig,
+                     ulong            slot,
+                     int              txn_err,
+                     int              instr_err,
+                     uint             instr_idx,
+                     uint             custom_err ) {
+  ulong gen     = slot / ss->slots_per_gen;
+  ulong tbl_idx = gen % FD_SIGSTATUS_GEN_CNT;
+  if( FD_UNLIKELY( FD_VOLATILE_CONST( ss->gen_id[ tbl_idx ] )!=gen ) ) {
+    FD_ATOMIC_FETCH_AND_ADD( &ss->drop_cnt, 1UL );
+    return 0;
+  }
+
+  fd_sigstatus_ele_t * tbl  = fd_sigstatus_tbl( ss, tbl_idx );
+  ulong                mask = ss->ele_max-1UL;
+  ulong                tag  = fd_sigstatus_tag( sig );
+  ulong                idx  = fd_ulong_hash( tag ^ ss->seed ) & mask;
+
+  for( ulong probe=0UL; probe<fd_ulong_min( FD_SIGSTATUS_PROBE_MAX, ss->ele_max ); probe++ ) {
+    fd_sigstatus_ele_t * ele = tbl + ((idx+probe) & mask);
+    if( FD_VOLATILE_CONST( ele->tag ) ) continue;
+    if( FD_UNLIKELY( FD_ATOMIC_CAS( &ele->tag, 0UL, tag ) ) ) continue;
+
+    ele->sig1       = FD_LOAD( ulong, sig+8UL );
+    ele->custom_err = custom_err;
+    ele->txn_err    = (schar)txn_err;
+    ele->instr_err  = (schar)instr_err;
+    ele->instr_idx  = (ushort)instr_idx;
+    FD_COMPILER_MFENCE();
+    FD_VOLATILE( ele->slot1 ) = slot+1UL;
+    return 1;
+  }
+
+  FD_ATOMIC_FETCH_AND_ADD( &ss->drop_cnt, 1UL );
+  return 0;
+}
+
+/* fd_sigstatus_slot_status returns the commitment level of entries
+   inserted for slot given the current root, or STATUS_NONE if slot was
+   pruned or fell out of the slot ring. */
+
+static inline int
+fd_sigstatus_slot_status( fd_sigstatus_t const * ss,
+                          ulong const *          ring,
+                          ulong                  root,
+                          ulong                  slot ) {
+  ulong word = FD_VOLATILE_CONST( ring[ slot % ss->slot_max ] );
+  if( FD_UNLIKELY( (word>>2)!=slot ) ) return FD_SIGSTATUS_STATUS_NONE;
+  if( (word&3UL)==FD_SIGSTATUS_SLOT_ROOTED ) return FD_SIGSTATUS_STATUS_FINALIZED;
+  if( root==ULONG_MAX || slot>root ) return FD_SIGSTATUS_STATUS_PROCESSED;
+  return FD_SIGSTATUS_STATUS_NONE;
+}
+
+void
+fd_sigstatus_query_batch( fd_sigstatus_t const *  ss,
+                          uchar const * const *   sigs,
+                          ulong                   cnt,
+                          fd_sigstatus_result_t * out ) {
+  FD_TEST( cnt<=FD_SIGSTATUS_QUERY_MAX );
+
+  ulong tag [ FD_SIGSTATUS_QUERY_MAX ];
+  ulong sig1[ FD_SIGSTATUS_QUERY_MAX ];
+  ulong idx [ FD_SIGSTATUS_QUERY_MAX ];
+
+  ulong mask = ss->ele_max-1UL;
+  ulong seed = ss->seed;
+  ulong const * ring = fd_sigstatus_slot_ring( ss );
+  ulong root = FD_VOLATILE_CONST( ss->root_slot );
+
+  /* Hash the whole batch first, and issue prefetches for the first
+     probe of every signature in every table, so the cache misses of the
+     batch overlap instead of being paid one after another. */
+
+  for( ulong i=0UL; i<cnt; i++ ) {
+    tag [ i ] = fd_sigstatus_tag( sigs[ i ] );
+    sig1[ i ] = FD_LOAD( ulong, sigs[ i ]+8UL );
+    idx [ i ] = fd_ulong_hash( tag[ i ] ^ seed ) & mask;
+    out [ i ] = (fd_sigstatus_result_t){ .slot = ULONG_MAX, .status = FD_SIGSTATUS_STATUS_NONE };
+    for( ulong t=0UL; t<FD_SIGSTATUS_GEN_CNT; t++ ) __builtin_prefetch( fd_sigstatus_tbl( ss, t ) + idx[ i ] );
+  }
+
+  for( ulong t=0UL; t<FD_SIGSTATUS_GEN_CNT; t++ ) {
+    ulong gen = FD_VOLATILE_CONST( ss->gen_id[ t ] );
+    if( FD_UNLIKELY( gen==ULONG_MAX ) ) continue;
+    FD_COMPILER_MFENCE();
+
+    fd_sigstatus_ele_t const * tbl = fd_sigstatus_tbl( ss, t );
+
+    fd_sigstatus_result_t found[ FD_SIGSTATUS_QUERY_MAX ];
+    for( ulong i=0UL; i<cnt; i++ ) {
+      found[ i ].status = FD_SIGSTATUS_STATUS_NONE;
+      for( ulong probe=0UL; probe<fd_ulong_min( FD_SIGSTATUS_PROBE_MAX, ss->ele_max ); probe++ ) {
+        fd_sigstatus_ele_t const * ele = tbl + ((idx[ i ]+probe) & mask);
+        ulong ele_tag = FD_VOLATILE_CONST( ele->tag );
+        if( !ele_tag ) break;
+        if( ele_tag!=tag[ i ] ) continue;
+        ulong slot1 = FD_VOLATILE_CONST( ele->slot1 );
+        if( FD_UNLIKELY( !slot1 ) ) continue;
+        FD_COMPILER_MFENCE();
+        if( ele->sig1!=sig1[ i ] ) continue;
+
+        int status = fd_sigstatus_slot_status( ss, ring, root, slot1-1UL );
+        if( status<=found[ i ].status ) continue;
+        found[ i ] = (fd_sigstatus_result_t){
+          .slot       = slot1-1UL,
+          .status     = status,
+          .txn_err    = ele->txn_err,
+          .instr_err  = ele->instr_err,
+          .instr_idx  = ele->instr_idx,
+          .custom_err = ele->custom_err
+        };
+        if( status==FD_SIGSTATUS_STATUS_FINALIZED ) break;
+      }
+    }
+
+    /* Discard everything read from the table if it was recycled while
+       we were probing it. */
+
+    FD_COMPILER_MFENCE();
+    if( FD_UNLIKELY( FD_VOLATILE_CONST( ss->gen_id[ t ] )!=gen ) ) continue;
+
+    for( ulong i=0UL; i<cnt; i++ ) {
+      if( found[ i ].status>out[ i ].status ) out[ i ] = found[ i ];
+    }
+  }
+}
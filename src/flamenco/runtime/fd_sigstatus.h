@@ -0,0 +1,186 @@
+#ifndef HEADER_fd_src_flamenco_runtime_fd_sigstatus_h
+#define HEADER_fd_src_flamenco_runtime_fd_sigstatus_h
+
+/* A signature status index maps the signature of every recently
+   executed transaction to the slot it executed in and its result.  It
+   backs the getSignatureStatuses RPC method, which clients poll at a
+   high rate to find out whether their transactions have landed.
+
+   The txn cache (fd_txncache.h) cannot serve this, it is keyed by
+   message hash, does not record results, and is private to the
+   execution pipeline.  The index here is a separate, compact structure
+   in shared memory with one writer per executing tile and any number
+   of read-only joins (the RPC tiles).
+
+   The index covers a rolling window of recent slots.  The window is
+   split into FD_SIGSTATUS_GEN_CNT generations of slots_per_gen
+   consecutive slots, and each generation has its own open addressed
+   hash table of ele_max entries.  When the replay tile begins a slot
+   in a new generation, the table of the oldest generation is wiped and
+   reused, so eviction is a single memset per slots_per_gen slots and
+   never touches the hot insert path.
+
+   Each entry is 32 bytes.  It stores the first 16 bytes of the
+   signature (ed25519 signatures are 64 bytes, but 128 bits is more than
+   enough to tell apart the transactions of a few thousand slots), the
+   slot, and a compact form of the transaction error.
+
+     Insert is lockless.  A writer claims an entry with a compare and
+     swap on the tag (first 8 signature bytes), fills in the remaining
+     fields, and publishes by writing the slot last.
+
+     Query is lockless.  A reader ignores entries with no slot yet, and
+     brackets each table probe with a read of the table generation, so
+     results from a table that was recycled during the probe are
+     discarded.
+
+   The same signature can execute on several competing forks.  Fork
+   status is tracked with a small ring of slot states written by the
+   replay tile: a slot is LIVE when replay begins it and ROOTED when it
+   is rooted.  LIVE slots at or below the root were pruned, and entries
+   for them are skipped by queries.  This is only enough to tell apart
+   the "processed" and "finalized" commitment levels.  Entries inserted
+   into a slot whose generation has already been recycled are dropped,
+   so writers must not fall more than (GEN_CNT-1)*slots_per_gen slots
+   behind replay. */
+
+#include "../fd_flamenco_base.h"
+
+#define FD_SIGSTATUS_ALIGN (128UL)
+
+#define FD_SIGSTATUS_MAGIC (0xf17eda2ce5160500UL) /* firedancer sigstatus v0 */
+
+/* FD_SIGSTATUS_GEN_CNT is the number of slot generations retained. */
+
+#define FD_SIGSTATUS_GEN_CNT (4UL)
+
+/* FD_SIGSTATUS_QUERY_MAX is the max number of signatures in a batch
+   query.  Matches the getSignatureStatuses limit. */
+
+#define FD_SIGSTATUS_QUERY_MAX (256UL)
+
+/* Commitment levels of a query result. */
+
+#define FD_SIGSTATUS_STATUS_NONE      (0) /* not found */
+#define FD_SIGSTATUS_STATUS_PROCESSED (1) /* executed on a live fork */
+#define FD_SIGSTATUS_STATUS_FINALIZED (2) /* executed in a rooted slot */
+
+/* fd_sigstatus_result_t is the status of one signature as returned by
+   a query.  txn_err is zero on success or an FD_RUNTIME_TXN_ERR_*
+   code.  If txn_err is FD_RUNTIME_TXN_ERR_INSTRUCTION_ERROR, instr_err
+   is the FD_EXECUTOR_INSTR_ERR_* code of the failing instruction at
+   instr_idx, and custom_err its custom error code if instr_err is
+   FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR. */
+
+struct fd_sigstatus_result {
+  ulong slot;
+  int   status;
+  int   txn_err;
+  int   instr_err;
+  uint  instr_idx;
+  uint  custom_err;
+};
+
+typedef struct fd_sigstatus_result fd_sigstatus_result_t;
+
+struct fd_sigstatus_private;
+typedef struct fd_sigstatus_private fd_sigstatus_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_sigstatus_{align,footprint} give the needed alignment and
+   footprint of a memory region suitable to hold a signature status
+   index.  ele_max is the number of entries per generation and must be
+   a power of two.  It should be at least twice the number of
+   transactions executed in slots_per_gen slots, so probes stay short.
+   Returns 0 footprint for invalid parameters.
+
+   fd_sigstatus_new formats a memory region with suitable alignment and
+   footprint.  seed is the hash seed.  Returns shmem on success and
+   NULL on failure (logs details).
+
+   fd_sigstatus_join joins the caller to the index.  fd_sigstatus_leave
+   and fd_sigstatus_delete are the usual. */
+
+FD_FN_CONST ulong
+fd_sigstatus_align( void );
+
+FD_FN_CONST ulong
+fd_sigstatus_footprint( ulong ele_max,
+                        ulong slots_per_gen );
+
+void *
+fd_sigstatus_new( void * shmem,
+                  ulong  ele_max,
+                  ulong  slots_per_gen,
+                  ulong  seed );
+
+fd_sigstatus_t *
+fd_sigstatus_join( void * shss );
+
+void *
+fd_sigstatus_leave( fd_sigstatus_t * ss );
+
+void *
+fd_sigstatus_delete( void * shss );
+
+/* fd_sigstatus_slot_begin records that replay (or the leader pipeline)
+   started executing slot.  If slot starts a generation newer than any
+   seen before, the table of the oldest generation is wiped for reuse.
+   Must be called before any fd_sigstatus_insert for slot.  Only one
+   thread may call slot_begin and slot_root. */
+
+void
+fd_sigstatus_slot_begin( fd_sigstatus_t * ss,
+                         ulong            slot );
+
+/* fd_sigstatus_slot_root records that slot was rooted.  Slots older
+   than the root which were not rooted are considered pruned. */
+
+void
+fd_sigstatus_slot_root( fd_sigstatus_t * ss,
+                        ulong            slot );
+
+/* fd_sigstatus_root_slot returns the most recently rooted slot, or
+   ULONG_MAX if nothing was rooted yet. */
+
+ulong
+fd_sigstatus_root_slot( fd_sigstatus_t const * ss );
+
+/* fd_sigstatus_insert records that the transaction with the 64 byte
+   signature sig executed in slot with the given errors (as in
+   fd_sigstatus_result_t).  Safe to call concurrently from multiple
+   threads.  Returns 1 if inserted and 0 if dropped, because slot is
+   outside of the retained window or its table is full. */
+
+int
+fd_sigstatus_insert( fd_sigstatus_t * ss,
+                     uchar const *    sig,
+                     ulong            slot,
+                     int              txn_err,
+                     int              instr_err,
+                     uint             instr_idx,
+                     uint             custom_err );
+
+/* fd_sigstatus_query_batch looks up cnt (at most
+   FD_SIGSTATUS_QUERY_MAX) 64 byte signatures at sigs[i] and writes the
+   status of each to out[i].  If a signature executed on several forks,
+   a finalized result is preferred over a processed one.  Hashing and
+   prefetching is done for the whole batch ahead of probing, so batches
+   are much faster than repeated single queries.  Safe to call
+   concurrently with inserts. */
+
+void
+fd_sigstatus_query_batch( fd_sigstatus_t const *  ss,
+                          uchar const * const *   sigs,
+                          ulong                   cnt,
+                          fd_sigstatus_result_t * out );
+
+/* fd_sigstatus_drop_cnt returns the number of inserts dropped. */
+
+ulong
+fd_sigstatus_drop_cnt( fd_sigstatus_t const * ss );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_flamenco_runtime_fd_sigstatus_h */
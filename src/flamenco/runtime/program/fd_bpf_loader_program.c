@@ -475,11 +475,21 @@ fd_bpf_execute( fd_exec_instr_ctx_t *      instr_ctx,
     return FD_EXECUTOR_INSTR_ERR_PROGRAM_ENVIRONMENT_SETUP_FAILURE;
   }
 
+  /* Run the pre-decoded text stream the cache entry was created with */
+  vm->fused_text = fd_progcache_rec_fused_text( cache_entry );
+
   if( FD_UNLIKELY( instr_ctx->runtime->log.enable_vm_tracing && instr_ctx->runtime->log.tracing_mem ) ) {
     vm->trace = fd_vm_trace_join( fd_vm_trace_new( instr_ctx->runtime->log.tracing_mem + ((instr_ctx->runtime->instr.stack_sz-1UL) * FD_RUNTIME_VM_TRACE_STATIC_FOOTPRINT), FD_RUNTIME_VM_TRACE_EVENT_MAX, FD_RUNTIME_VM_TRACE_EVENT_DATA_MAX ));
     if( FD_UNLIKELY( !vm->trace ) ) FD_LOG_ERR(( "unable to create trace; make sure you've compiled with sufficient spad size " ));
   }
 
+  if( FD_UNLIKELY( instr_ctx->runtime->log.vm_prof ) ) {
+    fd_pubkey_t const * program_id = NULL;
+    fd_exec_instr_ctx_get_last_program_key( instr_ctx, &program_id ); /* program_id stays NULL on failure */
+    vm->prof            = instr_ctx->runtime->log.vm_prof;
+    vm->prof_program_id = program_id ? program_id->uc : NULL;
+  }
+
   long const regime1 = fd_tickcount();
 
   int exec_err = fd_vm_exec( vm );
@@ -57,6 +57,7 @@ typedef struct fd_precompile_one_byte_idx_sig_offsets fd_secp256k1_signature_off
 #define SECP256K1_SIGNATURE_OFFSETS_SERIALIZED_SIZE (11UL)
 #define SECP256K1_SIGNATURE_OFFSETS_START            (1UL)
 #define SECP256K1_DATA_START (SECP256K1_SIGNATURE_OFFSETS_SERIALIZED_SIZE + SECP256K1_SIGNATURE_OFFSETS_START)
+#define SECP256K1_SIGNATURE_BATCH_MAX                (8UL)
 
 FD_STATIC_ASSERT( sizeof( fd_ed25519_signature_offsets_t )==SIGNATURE_OFFSETS_SERIALIZED_SIZE, fd_ballet );
 FD_STATIC_ASSERT( sizeof( fd_secp256k1_signature_offsets_t )==SECP256K1_SIGNATURE_OFFSETS_SERIALIZED_SIZE, fd_ballet );
@@ -256,75 +257,102 @@ fd_precompile_secp256k1_verify( fd_exec_instr_ctx_t * ctx ) {
     return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
   }
 
+  /* Signatures are verified in chunks of up to
+     SECP256K1_SIGNATURE_BATCH_MAX.  The message hashes of a chunk are
+     computed as one keccak256 batch, then the public keys are recovered
+     one at a time and the recovered public keys are hashed as a second
+     keccak256 batch.  A data offset error for a signature is reported
+     only if all signatures before it in the chunk verified, which gives
+     the same result as verifying the signatures strictly in order
+     (recovery and address mismatch failures return the same error). */
+
   ulong off = SECP256K1_SIGNATURE_OFFSETS_START;
-  for( ulong i = 0; i < sig_cnt; ++i ) {
-    fd_secp256k1_signature_offsets_t const * sigoffs = (const fd_secp256k1_signature_offsets_t *) (data + off);
-    off += SECP256K1_SIGNATURE_OFFSETS_SERIALIZED_SIZE;
+  for( ulong chunk_idx=0UL; chunk_idx<sig_cnt; chunk_idx+=SECP256K1_SIGNATURE_BATCH_MAX ) {
+    ulong chunk_cnt = fd_ulong_min( sig_cnt-chunk_idx, SECP256K1_SIGNATURE_BATCH_MAX );
+
+    uchar const * chunk_sig        [ SECP256K1_SIGNATURE_BATCH_MAX ];
+    uchar const * chunk_eth_address[ SECP256K1_SIGNATURE_BATCH_MAX ];
+    uchar         chunk_msg_hash   [ SECP256K1_SIGNATURE_BATCH_MAX ][ FD_KECCAK256_HASH_SZ ];
+    uchar         chunk_pubkey     [ SECP256K1_SIGNATURE_BATCH_MAX ][ 64 ];
+    uchar         chunk_pubkey_hash[ SECP256K1_SIGNATURE_BATCH_MAX ][ FD_KECCAK256_HASH_SZ ];
+
+    uchar batch_mem[ FD_KECCAK256_BATCH_FOOTPRINT ] __attribute__((aligned(FD_KECCAK256_BATCH_ALIGN)));
+    fd_keccak256_batch_t * batch = fd_keccak256_batch_init( batch_mem );
+
+    int   data_err = 0;
+    ulong load_cnt = 0UL;
+    for( ; load_cnt<chunk_cnt; load_cnt++ ) {
+      fd_secp256k1_signature_offsets_t const * sigoffs = (const fd_secp256k1_signature_offsets_t *) (data + off);
+      off += SECP256K1_SIGNATURE_OFFSETS_SERIALIZED_SIZE;
+
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L960-L961 */
+      // ???
+
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L963-L973
+         Note: for whatever reason, Agave returns InvalidInstructionDataSize instead of InvalidDataOffsets.
+         We just return the err as is. */
+      data_err = fd_precompile_get_instr_data( ctx,
+                                               sigoffs->sig_instr_idx,
+                                               sigoffs->sig_offset,
+                                               SIGNATURE_SERIALIZED_SIZE + 1, /* extra byte is recovery id */
+                                               &chunk_sig[ load_cnt ] );
+      if( FD_UNLIKELY( data_err ) ) break;
+
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L983-L989 */
+      data_err = fd_precompile_get_instr_data( ctx,
+                                               sigoffs->pubkey_instr_idx,
+                                               sigoffs->pubkey_offset,
+                                               SECP256K1_PUBKEY_SERIALIZED_SIZE,
+                                               &chunk_eth_address[ load_cnt ] );
+      if( FD_UNLIKELY( data_err ) ) break;
+
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L991-L997 */
+      uchar const * msg = NULL;
+      ushort msg_sz = sigoffs->msg_data_sz;
+      data_err = fd_precompile_get_instr_data( ctx,
+                                               sigoffs->msg_instr_idx,
+                                               sigoffs->msg_offset,
+                                               msg_sz,
+                                               &msg );
+      if( FD_UNLIKELY( data_err ) ) break;
+
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L999-L1001 */
+      fd_keccak256_batch_add( batch, msg, msg_sz, chunk_msg_hash[ load_cnt ] );
+    }
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L960-L961 */
-    // ???
+    fd_keccak256_batch_fini( batch );
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L963-L973
-       Note: for whatever reason, Agave returns InvalidInstructionDataSize instead of InvalidDataOffsets.
-       We just return the err as is. */
-    uchar const * sig = NULL;
-    int err = fd_precompile_get_instr_data( ctx,
-                                            sigoffs->sig_instr_idx,
-                                            sigoffs->sig_offset,
-                                            SIGNATURE_SERIALIZED_SIZE + 1, /* extra byte is recovery id */
-                                            &sig );
-    if( FD_UNLIKELY( err ) ) {
-      ctx->txn_out->err.custom_err = (uint)err;
-      return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
-    }
+    batch = fd_keccak256_batch_init( batch_mem );
+    for( ulong j=0UL; j<load_cnt; j++ ) {
+      uchar const * sig = chunk_sig[ j ];
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L975-L981
-       Note: we parse the signature and recovery id as part of fd_secp256k1_recover.
-       Because of this, the return error code might be different from Agave in some edge cases. */
-    int recovery_id = (int)sig[SIGNATURE_SERIALIZED_SIZE]; /* extra byte is recovery id */
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L975-L981
+         Note: we parse the signature and recovery id as part of fd_secp256k1_recover.
+         Because of this, the return error code might be different from Agave in some edge cases. */
+      int recovery_id = (int)sig[SIGNATURE_SERIALIZED_SIZE]; /* extra byte is recovery id */
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L983-L989 */
-    uchar const * eth_address = NULL;
-    err = fd_precompile_get_instr_data( ctx,
-                                        sigoffs->pubkey_instr_idx,
-                                        sigoffs->pubkey_offset,
-                                        SECP256K1_PUBKEY_SERIALIZED_SIZE,
-                                        &eth_address );
-    if( FD_UNLIKELY( err ) ) {
-      ctx->txn_out->err.custom_err = (uint)err;
-      return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
-    }
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L1003-L1008 */
+      if ( FD_UNLIKELY( fd_secp256k1_recover( chunk_pubkey[ j ], chunk_msg_hash[ j ], sig, recovery_id ) == NULL ) ) {
+        fd_keccak256_batch_abort( batch );
+        ctx->txn_out->err.custom_err = FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
+        return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
+      }
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L991-L997 */
-    uchar const * msg = NULL;
-    ushort msg_sz = sigoffs->msg_data_sz;
-    err = fd_precompile_get_instr_data( ctx,
-                                        sigoffs->msg_instr_idx,
-                                        sigoffs->msg_offset,
-                                        msg_sz,
-                                        &msg );
-    if( FD_UNLIKELY( err ) ) {
-      ctx->txn_out->err.custom_err = (uint)err;
-      return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
+      /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L1009-L1013 */
+      fd_keccak256_batch_add( batch, chunk_pubkey[ j ], 64UL, chunk_pubkey_hash[ j ] );
     }
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L999-L1001 */
-    uchar msg_hash[ FD_KECCAK256_HASH_SZ ];
-    fd_keccak256_hash( msg, msg_sz, msg_hash );
+    fd_keccak256_batch_fini( batch );
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L1003-L1008 */
-    uchar pubkey[64];
-    if ( FD_UNLIKELY( fd_secp256k1_recover( pubkey, msg_hash, sig, recovery_id ) == NULL ) ) {
-      ctx->txn_out->err.custom_err = FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
-      return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
+    for( ulong j=0UL; j<load_cnt; j++ ) {
+      if( FD_UNLIKELY( memcmp( chunk_eth_address[ j ], chunk_pubkey_hash[ j ]+(FD_KECCAK256_HASH_SZ-SECP256K1_PUBKEY_SERIALIZED_SIZE), SECP256K1_PUBKEY_SERIALIZED_SIZE ) ) ) {
+        ctx->txn_out->err.custom_err = FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
+        return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
+      }
     }
 
-    /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/secp256k1_instruction.rs#L1009-L1013 */
-    uchar pubkey_hash[ FD_KECCAK256_HASH_SZ ];
-    fd_keccak256_hash( pubkey, 64, pubkey_hash );
-
-    if( FD_UNLIKELY( memcmp( eth_address, pubkey_hash+(FD_KECCAK256_HASH_SZ-SECP256K1_PUBKEY_SERIALIZED_SIZE), SECP256K1_PUBKEY_SERIALIZED_SIZE ) ) ) {
-      ctx->txn_out->err.custom_err = FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
+    if( FD_UNLIKELY( data_err ) ) {
+      ctx->txn_out->err.custom_err = (uint)data_err;
       return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
     }
   }
@@ -636,6 +636,154 @@ test_fd_hashes_update_lthash( void ) {
   FD_LOG_NOTICE(( "test_fd_hashes_update_lthash passed" ));
 }
 
+/* Random account revisions for lthash batch tests and benchmarks.  Data
+   sizes are drawn such that most accounts fit the adder's SIMD lanes
+   with a few large ones hashed out of line. */
+
+#define TEST_ACCT_CNT      (64UL)
+#define TEST_ACCT_DATA_MAX (4096UL)
+
+static fd_pubkey_t       test_acct_key [ TEST_ACCT_CNT ];
+static fd_account_meta_t test_acct_meta[ TEST_ACCT_CNT ];
+static uchar             test_acct_data[ TEST_ACCT_CNT ][ TEST_ACCT_DATA_MAX ];
+
+static void
+test_acct_fill( fd_rng_t * rng,
+                ulong      data_sz ) {
+  for( ulong i=0UL; i<TEST_ACCT_CNT; i++ ) {
+    for( ulong j=0UL; j<sizeof(fd_pubkey_t); j++ ) test_acct_key[ i ].uc[ j ] = fd_rng_uchar( rng );
+    fd_account_meta_t * meta = &test_acct_meta[ i ];
+    memset( meta, 0, sizeof(fd_account_meta_t) );
+    meta->lamports   = fd_rng_uint_roll( rng, 8U ) ? fd_rng_ulong( rng ) : 0UL;
+    meta->executable = fd_rng_uchar( rng );
+    for( ulong j=0UL; j<FD_PUBKEY_FOOTPRINT; j++ ) meta->owner[ j ] = fd_rng_uchar( rng );
+    meta->dlen       = (uint)( data_sz!=ULONG_MAX ? data_sz :
+                               fd_rng_uint_roll( rng, 16U ) ? fd_rng_ulong_roll( rng, 440UL ) : fd_rng_ulong_roll( rng, TEST_ACCT_DATA_MAX+1UL ) );
+    for( ulong j=0UL; j<meta->dlen; j++ ) test_acct_data[ i ][ j ] = fd_rng_uchar( rng );
+  }
+}
+
+static void
+test_fd_hashes_lthash_batch( void ) {
+  FD_LOG_NOTICE(( "Testing fd_hashes_lthash_batch" ));
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1234U, 0UL ) );
+
+  static fd_hashes_lthash_batch_t batch[1];
+  fd_hashes_lthash_batch_init( batch );
+
+  for( ulong iter=0UL; iter<64UL; iter++ ) {
+    test_acct_fill( rng, ULONG_MAX );
+
+    fd_lthash_value_t expected[1];
+    fd_lthash_value_t lthash  [1];
+    for( ulong j=0UL; j<FD_LTHASH_LEN_ELEMS; j++ ) expected->words[ j ] = (ushort)fd_rng_uint( rng );
+    memcpy( lthash, expected, sizeof(fd_lthash_value_t) );
+
+    /* Randomly remove or add accounts, like a transaction replacing
+       account revisions, and compare against the scalar path */
+
+    ulong op_cnt = 1UL + fd_rng_ulong_roll( rng, 2UL*TEST_ACCT_CNT );
+    for( ulong op=0UL; op<op_cnt; op++ ) {
+      ulong               idx  = fd_rng_ulong_roll( rng, TEST_ACCT_CNT );
+      fd_account_meta_t * meta = &test_acct_meta[ idx ];
+      fd_lthash_value_t   tmp[1];
+      fd_hashes_account_lthash( &test_acct_key[ idx ], meta, test_acct_data[ idx ], tmp );
+      if( fd_rng_uint( rng ) & 1U ) {
+        fd_lthash_sub( expected, tmp );
+        fd_hashes_lthash_batch_sub( batch, &test_acct_key[ idx ], meta, test_acct_data[ idx ] );
+      } else {
+        fd_lthash_add( expected, tmp );
+        fd_hashes_lthash_batch_add( batch, &test_acct_key[ idx ], meta, test_acct_data[ idx ] );
+      }
+    }
+
+    fd_hashes_lthash_batch_flush( batch, lthash );
+    FD_TEST( fd_lthash_equal( lthash, expected ) );
+  }
+
+  /* Removing and re-adding the same revisions is a no-op */
+
+  fd_lthash_value_t lthash[1];
+  fd_lthash_zero( lthash );
+  for( ulong i=0UL; i<TEST_ACCT_CNT; i++ ) {
+    fd_hashes_lthash_batch_sub( batch, &test_acct_key[ i ], &test_acct_meta[ i ], test_acct_data[ i ] );
+    fd_hashes_lthash_batch_add( batch, &test_acct_key[ i ], &test_acct_meta[ i ], test_acct_data[ i ] );
+  }
+  fd_hashes_lthash_batch_flush( batch, lthash );
+  fd_lthash_value_t zero[1];
+  fd_lthash_zero( zero );
+  FD_TEST( fd_lthash_equal( lthash, zero ) );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "test_fd_hashes_lthash_batch passed" ));
+}
+
+/* bench_fd_hashes_lthash_batch measures account lthash updates per
+   second on one core, hashing both the previous and the new revision
+   of each account, for the scalar path (fd_hashes_account_lthash per
+   revision) and the batched path with batches of batch_sz accounts
+   (batch_sz is the number of accounts written per transaction). */
+
+static void
+bench_fd_hashes_lthash_batch( void ) {
+  static ulong const data_szs[]  = { 0UL, 165UL, 400UL, ULONG_MAX };
+  static ulong const batch_szs[] = { 4UL, 8UL, 16UL, 64UL };
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 5678U, 0UL ) );
+
+  static fd_hashes_lthash_batch_t batch[1];
+  fd_hashes_lthash_batch_init( batch );
+
+  fd_lthash_value_t lthash[1];
+  fd_lthash_zero( lthash );
+
+  ulong iter_cnt = 1UL<<14;
+
+  FD_LOG_NOTICE(( "Benchmarking account lthash updates (prev and post revision per account)" ));
+  for( ulong i=0UL; i<sizeof(data_szs)/sizeof(data_szs[0]); i++ ) {
+    test_acct_fill( rng, data_szs[ i ] );
+    for( ulong j=0UL; j<TEST_ACCT_CNT; j++ ) test_acct_meta[ j ].lamports |= 1UL;
+
+    long dt = -fd_log_wallclock();
+    for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+      ulong idx  = iter & (TEST_ACCT_CNT-1UL);
+      ulong prev = (iter+1UL) & (TEST_ACCT_CNT-1UL);
+      fd_lthash_value_t tmp[1];
+      fd_hashes_account_lthash( &test_acct_key[ idx ], &test_acct_meta[ prev ], test_acct_data[ prev ], tmp );
+      fd_lthash_sub( lthash, tmp );
+      fd_hashes_account_lthash( &test_acct_key[ idx ], &test_acct_meta[ idx  ], test_acct_data[ idx  ], tmp );
+      fd_lthash_add( lthash, tmp );
+    }
+    dt += fd_log_wallclock();
+    double scalar_rate = 1e3*(double)iter_cnt/(double)dt;
+
+    char   line[ 256 ];
+    char * p = fd_cstr_init( line );
+    for( ulong k=0UL; k<sizeof(batch_szs)/sizeof(batch_szs[0]); k++ ) {
+      ulong batch_sz = batch_szs[ k ];
+      dt = -fd_log_wallclock();
+      for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+        ulong idx  = iter & (TEST_ACCT_CNT-1UL);
+        ulong prev = (iter+1UL) & (TEST_ACCT_CNT-1UL);
+        fd_hashes_lthash_batch_sub( batch, &test_acct_key[ idx ], &test_acct_meta[ prev ], test_acct_data[ prev ] );
+        fd_hashes_lthash_batch_add( batch, &test_acct_key[ idx ], &test_acct_meta[ idx  ], test_acct_data[ idx  ] );
+        if( (iter % batch_sz)==batch_sz-1UL ) fd_hashes_lthash_batch_flush( batch, lthash );
+      }
+      fd_hashes_lthash_batch_flush( batch, lthash );
+      dt += fd_log_wallclock();
+      p = fd_cstr_append_printf( p, " batch %2lu %6.3f", batch_sz, 1e3*(double)iter_cnt/(double)dt );
+    }
+    fd_cstr_fini( p );
+
+    if( data_szs[ i ]==ULONG_MAX ) FD_LOG_NOTICE(( "  data_sz mixed: scalar %6.3f%s Macct/s", scalar_rate, line ));
+    else                           FD_LOG_NOTICE(( "  data_sz %5lu: scalar %6.3f%s Macct/s", data_szs[ i ], scalar_rate, line ));
+  }
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+}
+
 int
 main( int     argc,
       char ** argv ) {
@@ -644,6 +792,8 @@ main( int     argc,
   test_fd_hashes_account_lthash();
   test_fd_hashes_hash_bank();
   test_fd_hashes_update_lthash();
+  test_fd_hashes_lthash_batch();
+  bench_fd_hashes_lthash_batch();
 
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
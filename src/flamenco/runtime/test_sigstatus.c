@@ -0,0 +1,226 @@
+#include "fd_sigstatus.h"
+#include "fd_runtime_err.h"
+#include "fd_executor_err.h"
+
+#define ELE_MAX       (1024UL)
+#define SLOTS_PER_GEN (4UL)
+
+static uchar scratch[ 1UL<<20 ] __attribute__((aligned(FD_SIGSTATUS_ALIGN)));
+
+static void
+make_sig( uchar * sig,
+          ulong   x ) {
+  for( ulong i=0UL; i<8UL; i++ ) FD_STORE( ulong, sig+8UL*i, fd_ulong_hash( x*8UL+i ) );
+}
+
+static fd_sigstatus_result_t
+query1( fd_sigstatus_t const * ss,
+        ulong                  x ) {
+  uchar sig[ 64 ];
+  make_sig( sig, x );
+  uchar const * sigs[ 1 ] = { sig };
+  fd_sigstatus_result_t res[ 1 ];
+  fd_sigstatus_query_batch( ss, sigs, 1UL, res );
+  return res[ 0 ];
+}
+
+static int
+insert1( fd_sigstatus_t * ss,
+         ulong            x,
+         ulong            slot ) {
+  uchar sig[ 64 ];
+  make_sig( sig, x );
+  return fd_sigstatus_insert( ss, sig, slot, 0, 0, 0U, 0U );
+}
+
+static void
+test_new_join( void ) {
+  FD_TEST( fd_sigstatus_align()==FD_SIGSTATUS_ALIGN );
+  FD_TEST( !fd_sigstatus_footprint( 0UL,  SLOTS_PER_GEN ) );
+  FD_TEST( !fd_sigstatus_footprint( 3UL,  SLOTS_PER_GEN ) );
+  FD_TEST( !fd_sigstatus_footprint( 16UL, 0UL           ) );
+  FD_TEST( fd_sigstatus_footprint( ELE_MAX, SLOTS_PER_GEN )<=sizeof(scratch) );
+
+  FD_TEST( !fd_sigstatus_new( NULL,        ELE_MAX, SLOTS_PER_GEN, 0UL ) );
+  FD_TEST( !fd_sigstatus_new( scratch+1UL, ELE_MAX, SLOTS_PER_GEN, 0UL ) );
+  FD_TEST( !fd_sigstatus_new( scratch,     3UL,     SLOTS_PER_GEN, 0UL ) );
+  FD_TEST( !fd_sigstatus_join( NULL ) );
+
+  FD_TEST( fd_sigstatus_new( scratch, ELE_MAX, SLOTS_PER_GEN, 42UL )==scratch );
+  fd_sigstatus_t * ss = fd_sigstatus_join( scratch );
+  FD_TEST( ss );
+  FD_TEST( fd_sigstatus_root_slot( ss )==ULONG_MAX );
+  FD_TEST( fd_sigstatus_leave( ss )==scratch );
+  FD_TEST( fd_sigstatus_delete( scratch )==scratch );
+  FD_TEST( !fd_sigstatus_join( scratch ) );
+}
+
+static void
+test_basic( void ) {
+  fd_sigstatus_t * ss = fd_sigstatus_join( fd_sigstatus_new( scratch, ELE_MAX, SLOTS_PER_GEN, 1UL ) );
+  FD_TEST( ss );
+
+  /* Inserts into a slot that was not begun are dropped */
+  FD_TEST( !insert1( ss, 1UL, 10UL ) );
+  FD_TEST( fd_sigstatus_drop_cnt( ss )==1UL );
+
+  fd_sigstatus_slot_begin( ss, 10UL );
+  FD_TEST( insert1( ss, 1UL, 10UL ) );
+
+  uchar sig[ 64 ];
+  make_sig( sig, 2UL );
+  FD_TEST( fd_sigstatus_insert( ss, sig, 10UL, FD_RUNTIME_TXN_ERR_INSTRUCTION_ERROR, FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR, 3U, 0x1234U ) );
+
+  fd_sigstatus_result_t r = query1( ss, 1UL );
+  FD_TEST( r.status==FD_SIGSTATUS_STATUS_PROCESSED );
+  FD_TEST( r.slot==10UL );
+  FD_TEST( r.txn_err==0 );
+
+  r = query1( ss, 2UL );
+  FD_TEST( r.status==FD_SIGSTATUS_STATUS_PROCESSED );
+  FD_TEST( r.txn_err==FD_RUNTIME_TXN_ERR_INSTRUCTION_ERROR );
+  FD_TEST( r.instr_err==FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR );
+  FD_TEST( r.instr_idx==3U );
+  FD_TEST( r.custom_err==0x1234U );
+
+  FD_TEST( query1( ss, 3UL ).status==FD_SIGSTATUS_STATUS_NONE );
+
+  /* A signature differing only past the first 8 bytes does not match */
+  make_sig( sig, 1UL );
+  sig[ 9 ] ^= 1;
+  uchar const * sigs[ 1 ] = { sig };
+  fd_sigstatus_query_batch( ss, sigs, 1UL, &r );
+  FD_TEST( r.status==FD_SIGSTATUS_STATUS_NONE );
+
+  /* Rooting makes the status finalized */
+  fd_sigstatus_slot_root( ss, 10UL );
+  FD_TEST( fd_sigstatus_root_slot( ss )==10UL );
+  FD_TEST( query1( ss, 1UL ).status==FD_SIGSTATUS_STATUS_FINALIZED );
+
+  fd_sigstatus_delete( fd_sigstatus_leave( ss ) );
+}
+
+static void
+test_forks( void ) {
+  fd_sigstatus_t * ss = fd_sigstatus_join( fd_sigstatus_new( scratch, ELE_MAX, SLOTS_PER_GEN, 2UL ) );
+  FD_TEST( ss );
+
+  /* The same transaction lands on two competing forks, 5 and 6 */
+  fd_sigstatus_slot_begin( ss, 4UL );
+  fd_sigstatus_slot_root ( ss, 4UL );
+  fd_sigstatus_slot_begin( ss, 5UL );
+  fd_sigstatus_slot_begin( ss, 6UL );
+  FD_TEST( insert1( ss, 7UL, 5UL ) );
+  FD_TEST( insert1( ss, 7UL, 6UL ) );
+  FD_TEST( insert1( ss, 8UL, 5UL ) );
+
+  fd_sigstatus_result_t r = query1( ss, 7UL );
+  FD_TEST( r.status==FD_SIGSTATUS_STATUS_PROCESSED );
+
+  /* Fork 6 wins, 5 is pruned */
+  fd_sigstatus_slot_root( ss, 6UL );
+  r = query1( ss, 7UL );
+  FD_TEST( r.status==FD_SIGSTATUS_STATUS_FINALIZED );
+  FD_TEST( r.slot==6UL );
+  FD_TEST( query1( ss, 8UL ).status==FD_SIGSTATUS_STATUS_NONE );
+
+  fd_sigstatus_delete( fd_sigstatus_leave( ss ) );
+}
+
+static void
+test_eviction( void ) {
+  fd_sigstatus_t * ss = fd_sigstatus_join( fd_sigstatus_new( scratch, ELE_MAX, SLOTS_PER_GEN, 3UL ) );
+  FD_TEST( ss );
+
+  /* One transaction per slot for enough slots to cycle every table */
+  ulong slot_cnt = 3UL*FD_SIGSTATUS_GEN_CNT*SLOTS_PER_GEN;
+  for( ulong slot=0UL; slot<slot_cnt; slot++ ) {
+    fd_sigstatus_slot_begin( ss, slot );
+    FD_TEST( insert1( ss, slot, slot ) );
+    fd_sigstatus_slot_root( ss, slot );
+  }
+
+  /* The newest GEN_CNT generations are retained */
+  ulong oldest = (slot_cnt/SLOTS_PER_GEN - FD_SIGSTATUS_GEN_CNT)*SLOTS_PER_GEN;
+  for( ulong slot=0UL; slot<slot_cnt; slot++ ) {
+    fd_sigstatus_result_t r = query1( ss, slot );
+    if( slot<oldest ) {
+      FD_TEST( r.status==FD_SIGSTATUS_STATUS_NONE );
+    } else {
+      FD_TEST( r.status==FD_SIGSTATUS_STATUS_FINALIZED );
+      FD_TEST( r.slot==slot );
+    }
+  }
+
+  /* Writers that fell behind are dropped */
+  ulong drop_cnt = fd_sigstatus_drop_cnt( ss );
+  FD_TEST( !insert1( ss, 999UL, 0UL ) );
+  FD_TEST( fd_sigstatus_drop_cnt( ss )==drop_cnt+1UL );
+
+  /* Jumping far ahead recycles every table */
+  fd_sigstatus_slot_begin( ss, 1000UL );
+  FD_TEST( query1( ss, slot_cnt-1UL ).status==FD_SIGSTATUS_STATUS_NONE );
+
+  fd_sigstatus_delete( fd_sigstatus_leave( ss ) );
+}
+
+static void
+test_batch( void ) {
+  fd_sigstatus_t * ss = fd_sigstatus_join( fd_sigstatus_new( scratch, ELE_MAX, SLOTS_PER_GEN, 4UL ) );
+  FD_TEST( ss );
+
+  fd_sigstatus_slot_begin( ss, 100UL );
+  fd_sigstatus_slot_begin( ss, 104UL );
+  for( ulong i=0UL; i<FD_SIGSTATUS_QUERY_MAX; i+=2UL ) FD_TEST( insert1( ss, i, fd_ulong_if( i&2UL, 104UL, 100UL ) ) );
+
+  static uchar sig_mem[ FD_SIGSTATUS_QUERY_MAX ][ 64 ];
+  uchar const * sigs[ FD_SIGSTATUS_QUERY_MAX ];
+  for( ulong i=0UL; i<FD_SIGSTATUS_QUERY_MAX; i++ ) {
+    make_sig( sig_mem[ i ], i );
+    sigs[ i ] = sig_mem[ i ];
+  }
+
+  fd_sigstatus_result_t res[ FD_SIGSTATUS_QUERY_MAX ];
+  fd_sigstatus_query_batch( ss, sigs, FD_SIGSTATUS_QUERY_MAX, res );
+  for( ulong i=0UL; i<FD_SIGSTATUS_QUERY_MAX; i++ ) {
+    if( i&1UL ) {
+      FD_TEST( res[ i ].status==FD_SIGSTATUS_STATUS_NONE );
+    } else {
+      FD_TEST( res[ i ].status==FD_SIGSTATUS_STATUS_PROCESSED );
+      FD_TEST( res[ i ].slot==fd_ulong_if( i&2UL, 104UL, 100UL ) );
+    }
+  }
+
+  fd_sigstatus_delete( fd_sigstatus_leave( ss ) );
+}
+
+static void
+test_full( void ) {
+  fd_sigstatus_t * ss = fd_sigstatus_join( fd_sigstatus_new( scratch, 16UL, SLOTS_PER_GEN, 5UL ) );
+  FD_TEST( ss );
+
+  fd_sigstatus_slot_begin( ss, 0UL );
+  for( ulong i=0UL; i<16UL; i++ ) FD_TEST( insert1( ss, i, 0UL ) );
+  FD_TEST( !insert1( ss, 16UL, 0UL ) );
+  for( ulong i=0UL; i<16UL; i++ ) FD_TEST( query1( ss, i ).status==FD_SIGSTATUS_STATUS_PROCESSED );
+  FD_TEST( query1( ss, 16UL ).status==FD_SIGSTATUS_STATUS_NONE );
+
+  fd_sigstatus_delete( fd_sigstatus_leave( ss ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  test_new_join();
+  test_basic();
+  test_forks();
+  test_eviction();
+  test_batch();
+  test_full();
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -120,6 +120,7 @@ fd_solfuzz_pb_instr_ctx_create( fd_solfuzz_runner_t *                runner,
   runtime->log.tracing_mem                           = runner->enable_vm_tracing ?
                                                        fd_spad_alloc_check( runner->spad, FD_RUNTIME_VM_TRACE_STATIC_ALIGN, FD_RUNTIME_VM_TRACE_STATIC_FOOTPRINT * FD_MAX_INSTRUCTION_STACK_DEPTH ) :
                                                        NULL;
+  runtime->log.vm_prof                               = NULL;
 
   /* Set up instruction context */
   fd_instr_info_t * info = &runtime->instr.trace[ 0UL ];
@@ -331,6 +331,7 @@ fd_solfuzz_txn_ctx_exec( fd_solfuzz_runner_t * runner,
   runtime->progcache       = runner->progcache;
   runtime->status_cache    = NULL;
   runtime->log.tracing_mem = tracing_mem;
+  runtime->log.vm_prof     = NULL;
   runtime->log.dumping_mem = NULL;
   runtime->log.capture_ctx = NULL;
 
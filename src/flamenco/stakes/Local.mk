@@ -7,6 +7,7 @@ ifdef FD_HAS_HOSTED
 ifdef FD_HAS_SECP256K1
 $(call make-unit-test,test_stake_delegations,test_stake_delegations,fd_flamenco fd_funk fd_ballet fd_util)
 $(call run-unit-test,test_stake_delegations)
+$(call make-unit-test,bench_stakes_para,bench_stakes_para,fd_flamenco fd_funk fd_ballet fd_util)
 endif
 endif
 
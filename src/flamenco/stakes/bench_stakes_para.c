@@ -0,0 +1,204 @@
+/* bench_stakes_para measures the epoch boundary passes over all stake
+   delegations (fd_stakes_accumulate_tpool and
+   fd_stakes_vote_stake_tpool) on a synthetic stake set with
+   --delegation-cnt delegations (1M by default) spread over
+   --vote-cnt vote accounts as the number of threads grows.  The
+   results for every thread count are checked against a serial
+   reference.  Tile 0 is the caller and the remaining tiles are used as
+   tpool workers, e.g.
+
+     --tile-cpus f,f,f,f,f,f,f,f
+
+   for up to 8 threads (use dedicated cores for meaningful numbers).
+   The stake set needs ~250 MiB of workspace (e.g. --page-sz gigantic
+   --page-cnt 1 or --page-sz huge --page-cnt 128). */
+
+#include "fd_stakes.h"
+#include "../runtime/program/fd_stake_program.h"
+
+#if FD_HAS_HOSTED
+
+#define HISTORY_CNT (64UL)
+
+static void
+history_init( fd_stake_history_t * history,
+              ulong                epoch,
+              fd_rng_t *           rng ) {
+  memset( history, 0, sizeof(fd_stake_history_t) );
+  history->fd_stake_history_size   = 512UL;
+  history->fd_stake_history_len    = HISTORY_CNT;
+  history->fd_stake_history_offset = 0UL;
+  for( ulong i=0UL; i<HISTORY_CNT; i++ ) {
+    fd_epoch_stake_history_entry_pair_t * pair = history->fd_stake_history + i;
+    pair->epoch              = epoch-1UL-i;
+    pair->entry.effective    = 400000000000000000UL + fd_rng_ulong_roll( rng, 1000000000000000UL );
+    pair->entry.activating   = 800000000000000000UL + fd_rng_ulong_roll( rng, 1000000000000000UL );
+    pair->entry.deactivating = 800000000000000000UL + fd_rng_ulong_roll( rng, 1000000000000000UL );
+  }
+}
+
+static ulong
+vote_stake_serial( fd_stake_delegations_t const * stake_delegations,
+                   fd_vote_states_t const *       vote_states,
+                   ulong *                        ref,
+                   ulong                          epoch,
+                   fd_stake_history_t const *     history,
+                   fd_stake_history_entry_t *     sum ) {
+  memset( sum, 0, sizeof(fd_stake_history_entry_t) );
+  ulong total_stake = 0UL;
+  fd_stake_delegations_iter_t iter_[1];
+  for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init( iter_, stake_delegations );
+       !fd_stake_delegations_iter_done( iter );
+       fd_stake_delegations_iter_next( iter ) ) {
+    fd_stake_delegation_t const * stake_delegation = fd_stake_delegations_iter_ele( iter );
+    fd_delegation_t delegation = {
+      .voter_pubkey         = stake_delegation->vote_account,
+      .stake                = stake_delegation->stake,
+      .activation_epoch     = stake_delegation->activation_epoch,
+      .deactivation_epoch   = stake_delegation->deactivation_epoch,
+      .warmup_cooldown_rate = stake_delegation->warmup_cooldown_rate,
+    };
+    fd_stake_history_entry_t entry = fd_stake_activating_and_deactivating( &delegation, epoch, history, NULL );
+    sum->effective    += entry.effective;
+    sum->activating   += entry.activating;
+    sum->deactivating += entry.deactivating;
+
+    fd_vote_state_ele_t const * vote_state = fd_vote_states_query_const( vote_states, &stake_delegation->vote_account );
+    if( FD_UNLIKELY( !vote_state ) ) continue;
+    ref[ vote_state->idx ] += entry.effective;
+    total_stake            += entry.effective;
+  }
+  return total_stake;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz       = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",        NULL, "gigantic"                   );
+  ulong        page_cnt       = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt",       NULL, 1UL                          );
+  ulong        numa_idx       = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx",       NULL, fd_shmem_numa_idx( 0UL )     );
+  ulong        delegation_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--delegation-cnt", NULL, 1000000UL                    );
+  ulong        vote_cnt       = fd_env_strip_cmdline_ulong( &argc, &argv, "--vote-cnt",       NULL, 2000UL                       );
+  ulong        iter_cnt       = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-cnt",       NULL, 4UL                          );
+
+  if( FD_UNLIKELY( !delegation_cnt || !vote_cnt || !iter_cnt ) ) FD_LOG_ERR(( "bad --delegation-cnt / --vote-cnt / --iter-cnt" ));
+
+  FD_LOG_NOTICE(( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)", page_cnt, _page_sz, numa_idx ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  void * sd_mem = fd_wksp_alloc_laddr( wksp, fd_stake_delegations_align(), fd_stake_delegations_footprint( delegation_cnt ), 1UL );
+  void * vs_mem = fd_wksp_alloc_laddr( wksp, fd_vote_states_align(),       fd_vote_states_footprint( vote_cnt ),             1UL );
+  ulong * ref   = fd_wksp_alloc_laddr( wksp, alignof(ulong),               vote_cnt*sizeof(ulong),                           1UL );
+  if( FD_UNLIKELY( !sd_mem || !vs_mem || !ref ) ) FD_LOG_ERR(( "workspace too small, increase --page-cnt" ));
+
+  fd_stake_delegations_t * stake_delegations = fd_stake_delegations_join( fd_stake_delegations_new( sd_mem, 1234UL, delegation_cnt, 0 ) );
+  fd_vote_states_t *       vote_states       = fd_vote_states_join      ( fd_vote_states_new      ( vs_mem, vote_cnt, 5678UL       ) );
+  FD_TEST( stake_delegations );
+  FD_TEST( vote_states       );
+
+  /* Synthetic stake set: a mix of fully active, activating and
+     deactivating delegations (which exercise the warmup / cooldown
+     walks over the stake history) and a small fraction delegated to
+     unknown vote accounts. */
+
+  ulong epoch = 800UL;
+  fd_stake_history_t history[1];
+  history_init( history, epoch, rng );
+
+  for( ulong vote_idx=0UL; vote_idx<vote_cnt; vote_idx++ ) {
+    fd_pubkey_t vote_account = { .ul = { vote_idx, 1UL, 2UL, 3UL } };
+    FD_TEST( fd_vote_states_update( vote_states, &vote_account ) );
+  }
+
+  FD_LOG_NOTICE(( "Creating %lu stake delegations over %lu vote accounts", delegation_cnt, vote_cnt ));
+  for( ulong i=0UL; i<delegation_cnt; i++ ) {
+    fd_pubkey_t stake_account = { .ul = { fd_rng_ulong( rng ), fd_rng_ulong( rng ), i, 4UL } };
+    fd_pubkey_t vote_account  = { .ul = { fd_rng_ulong_roll( rng, vote_cnt + vote_cnt/64UL + 1UL ), 1UL, 2UL, 3UL } };
+    ulong r = fd_rng_ulong_roll( rng, 8UL );
+    ulong activation_epoch   = r<5UL ? fd_rng_ulong_roll( rng, epoch-HISTORY_CNT ) : epoch-1UL-fd_rng_ulong_roll( rng, 16UL );
+    ulong deactivation_epoch = r==7UL ? epoch-fd_rng_ulong_roll( rng, 8UL ) : ULONG_MAX;
+    fd_stake_delegations_update( stake_delegations, &stake_account, &vote_account,
+                                 1000000000UL + fd_rng_ulong_roll( rng, 1000000000000UL ),
+                                 activation_epoch, deactivation_epoch, 0UL, r&1UL ? 0.25 : 0.09 );
+  }
+  FD_TEST( fd_stake_delegations_cnt( stake_delegations )==delegation_cnt );
+
+  memset( ref, 0, vote_cnt*sizeof(ulong) );
+  fd_stake_history_entry_t ref_sum[1];
+  long  dt        = -fd_log_wallclock();
+  ulong ref_total = vote_stake_serial( stake_delegations, vote_states, ref, epoch, history, ref_sum );
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "serial reference: %.3f ms (effective %lu activating %lu deactivating %lu vote total %lu)",
+                  1e-6*(double)dt, ref_sum->effective, ref_sum->activating, ref_sum->deactivating, ref_total ));
+
+  /* Create a tpool from all tiles */
+
+  ulong thread_cnt = fd_tile_cnt();
+  static uchar _tpool[ FD_TPOOL_FOOTPRINT( FD_TILE_MAX ) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+  fd_tpool_t * tpool = fd_tpool_init( _tpool, thread_cnt, 0UL );
+  if( FD_UNLIKELY( !tpool ) ) FD_LOG_ERR(( "fd_tpool_init failed" ));
+  for( ulong thread_idx=1UL; thread_idx<thread_cnt; thread_idx++ )
+    if( FD_UNLIKELY( !fd_tpool_worker_push( tpool, thread_idx ) ) ) FD_LOG_ERR(( "fd_tpool_worker_push failed" ));
+
+  for( ulong t1=1UL; t1<=thread_cnt; t1 = (t1<thread_cnt && (t1<<1)>thread_cnt) ? thread_cnt : (t1<<1) ) {
+
+    long dt_accumulate = 0L;
+    long dt_vote_stake = 0L;
+    for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+      dt_accumulate -= fd_log_wallclock();
+      fd_stake_history_entry_t sum = fd_stakes_accumulate_tpool( tpool,0UL,t1, stake_delegations, epoch, history, NULL );
+      dt_accumulate += fd_log_wallclock();
+      FD_TEST( sum.effective==ref_sum->effective && sum.activating==ref_sum->activating && sum.deactivating==ref_sum->deactivating );
+
+      fd_vote_states_reset_stakes( vote_states );
+      dt_vote_stake -= fd_log_wallclock();
+      ulong total = fd_stakes_vote_stake_tpool( tpool,0UL,t1, vote_states, stake_delegations, epoch, history, NULL );
+      dt_vote_stake += fd_log_wallclock();
+      FD_TEST( total==ref_total );
+
+      fd_vote_states_iter_t viter_[1];
+      for( fd_vote_states_iter_t * viter = fd_vote_states_iter_init( viter_, vote_states );
+           !fd_vote_states_iter_done( viter );
+           fd_vote_states_iter_next( viter ) ) {
+        fd_vote_state_ele_t const * vote_state = fd_vote_states_iter_ele( viter );
+        FD_TEST( vote_state->stake==ref[ vote_state->idx ] );
+      }
+    }
+
+    FD_LOG_NOTICE(( "thread_cnt %2lu: accumulate %8.3f ms (%7.3f Mdelegation/s) vote stake %8.3f ms (%7.3f Mdelegation/s)", t1,
+                    1e-6*(double)dt_accumulate/(double)iter_cnt, 1e3*(double)(delegation_cnt*iter_cnt)/(double)dt_accumulate,
+                    1e-6*(double)dt_vote_stake/(double)iter_cnt, 1e3*(double)(delegation_cnt*iter_cnt)/(double)dt_vote_stake ));
+
+    if( t1==thread_cnt ) break;
+  }
+
+  fd_tpool_fini( tpool );
+
+  fd_wksp_free_laddr( ref );
+  fd_wksp_free_laddr( vs_mem );
+  fd_wksp_free_laddr( fd_stake_delegations_delete( fd_stake_delegations_leave( stake_delegations ) ) );
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -446,26 +446,78 @@ fd_stake_delegations_iter_ele( fd_stake_delegations_iter_t * iter ) {
   return fd_stake_delegation_pool_ele( iter->pool, idx );
 }
 
+/* fd_stake_delegations_private_iter_seek positions iter at the first
+   element at or before chain chain_rem-1 (the map iterates over chains
+   in decreasing order) that is on a chain in [chain_lo,chain_rem). */
+
+static void
+fd_stake_delegations_private_iter_seek( fd_stake_delegations_iter_t * iter,
+                                        ulong                         chain_rem ) {
+  fd_stake_delegation_map_private_t const * map   = fd_stake_delegation_map_private_const( iter->map );
+  ulong const *                             chain = fd_stake_delegation_map_private_chain_const( map );
+
+  ulong ele_idx = ULONG_MAX;
+  for( ; chain_rem>iter->chain_lo; chain_rem-- ) {
+    ele_idx = fd_stake_delegation_map_private_unbox( chain[ chain_rem-1UL ] );
+    if( !fd_stake_delegation_map_private_idx_is_null( ele_idx ) ) break;
+  }
+
+  iter->iter.chain_rem = chain_rem;
+  iter->iter.ele_idx   = ele_idx;
+}
+
+ulong
+fd_stake_delegations_chain_cnt( fd_stake_delegations_t const * stake_delegations ) {
+  if( FD_UNLIKELY( !stake_delegations ) ) {
+    FD_LOG_CRIT(( "NULL stake_delegations" ));
+  }
+
+  return fd_stake_delegation_map_chain_cnt( fd_stake_delegations_get_map( stake_delegations ) );
+}
+
 fd_stake_delegations_iter_t *
-fd_stake_delegations_iter_init( fd_stake_delegations_iter_t *  iter,
-                                fd_stake_delegations_t const * stake_delegations ) {
+fd_stake_delegations_iter_init_range( fd_stake_delegations_iter_t *  iter,
+                                      fd_stake_delegations_t const * stake_delegations,
+                                      ulong                          chain0,
+                                      ulong                          chain1 ) {
   if( FD_UNLIKELY( !stake_delegations ) ) {
     FD_LOG_CRIT(( "NULL stake_delegations" ));
   }
 
-  iter->map  = fd_stake_delegations_get_map( stake_delegations );
-  iter->pool = fd_stake_delegations_get_pool( stake_delegations );
-  iter->iter = fd_stake_delegation_map_iter_init( iter->map, iter->pool );
+  iter->map      = fd_stake_delegations_get_map( stake_delegations );
+  iter->pool     = fd_stake_delegations_get_pool( stake_delegations );
+  iter->chain_lo = chain0;
+
+  if( FD_UNLIKELY( (chain0>chain1) | (chain1>fd_stake_delegation_map_chain_cnt( iter->map )) ) ) {
+    FD_LOG_CRIT(( "bad chain range [%lu,%lu)", chain0, chain1 ));
+  }
+
+  fd_stake_delegations_private_iter_seek( iter, chain1 );
 
   return iter;
 }
 
+fd_stake_delegations_iter_t *
+fd_stake_delegations_iter_init( fd_stake_delegations_iter_t *  iter,
+                                fd_stake_delegations_t const * stake_delegations ) {
+  if( FD_UNLIKELY( !stake_delegations ) ) {
+    FD_LOG_CRIT(( "NULL stake_delegations" ));
+  }
+
+  return fd_stake_delegations_iter_init_range( iter, stake_delegations, 0UL, fd_stake_delegations_chain_cnt( stake_delegations ) );
+}
+
 void
 fd_stake_delegations_iter_next( fd_stake_delegations_iter_t * iter ) {
-  iter->iter = fd_stake_delegation_map_iter_next( iter->iter, iter->map, iter->pool );
+  ulong ele_idx = fd_stake_delegation_map_private_unbox( iter->pool[ iter->iter.ele_idx ].next_ );
+  if( FD_LIKELY( !fd_stake_delegation_map_private_idx_is_null( ele_idx ) ) ) {
+    iter->iter.ele_idx = ele_idx;
+    return;
+  }
+  fd_stake_delegations_private_iter_seek( iter, iter->iter.chain_rem-1UL );
 }
 
 int
 fd_stake_delegations_iter_done( fd_stake_delegations_iter_t * iter ) {
-  return fd_stake_delegation_map_iter_done( iter->iter, iter->map, iter->pool );
+  return iter->iter.chain_rem<=iter->chain_lo;
 }
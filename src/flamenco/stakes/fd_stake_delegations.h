@@ -175,6 +175,7 @@ struct fd_stake_delegations_iter {
   fd_stake_delegation_map_t *    map;
   fd_stake_delegation_t *        pool;
   fd_stake_delegation_map_iter_t iter;
+  ulong                          chain_lo;
 };
 typedef struct fd_stake_delegations_iter fd_stake_delegations_iter_t;
 
@@ -353,6 +354,29 @@ fd_stake_delegations_iter_next( fd_stake_delegations_iter_t * iter );
 int
 fd_stake_delegations_iter_done( fd_stake_delegations_iter_t * iter );
 
+/* fd_stake_delegations_chain_cnt returns the number of chains in the
+   underlying map.  Every stake delegation lives on exactly one chain
+   in [0,chain_cnt).
+
+   fd_stake_delegations_iter_init_range is the same as
+   fd_stake_delegations_iter_init but only iterates over the stake
+   delegations on chains [chain0,chain1).  Assumes
+   chain0<=chain1<=chain_cnt.  Iterating over disjoint chain ranges
+   that cover [0,chain_cnt) visits every stake delegation exactly once,
+   which allows passes over all delegations to be split across threads
+   (e.g. with FD_MAP_REDUCE over the chain index range).  Concurrent
+   iterators are safe as long as nobody modifies the stake delegations
+   while iterating. */
+
+ulong
+fd_stake_delegations_chain_cnt( fd_stake_delegations_t const * stake_delegations );
+
+fd_stake_delegations_iter_t *
+fd_stake_delegations_iter_init_range( fd_stake_delegations_iter_t *  iter,
+                                      fd_stake_delegations_t const * stake_delegations,
+                                      ulong                          chain0,
+                                      ulong                          chain1 );
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_flamenco_stakes_fd_stake_delegations_h */
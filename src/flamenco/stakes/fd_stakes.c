@@ -25,6 +25,137 @@ fd_stake_weights_by_node( fd_vote_states_t const * vote_states,
   return weights_cnt;
 }
 
+/* FD_STAKES_PARA_BLOCK_THRESH is the minimum number of stake
+   delegation map chains worth handing to another thread.  With ~1M
+   delegations in a map with 2M chains, this is ~2K delegations per
+   block. */
+
+#define FD_STAKES_PARA_BLOCK_THRESH (4096L)
+
+static inline fd_stake_history_entry_t
+fd_stakes_private_activation( fd_stake_delegation_t const * stake_delegation,
+                              ulong                         epoch,
+                              fd_stake_history_t const *    history,
+                              ulong *                       new_rate_activation_epoch ) {
+  fd_delegation_t delegation = {
+    .voter_pubkey         = stake_delegation->vote_account,
+    .stake                = stake_delegation->stake,
+    .activation_epoch     = stake_delegation->activation_epoch,
+    .deactivation_epoch   = stake_delegation->deactivation_epoch,
+    .warmup_cooldown_rate = stake_delegation->warmup_cooldown_rate,
+  };
+  return fd_stake_activating_and_deactivating( &delegation, epoch, history, new_rate_activation_epoch );
+}
+
+/* fd_stakes_accumulate_task sums the effective, activating and
+   deactivating stake of the delegations on chains
+   [block_i0,block_i1). */
+
+static FD_MAP_REDUCE_BEGIN( fd_stakes_accumulate_task, FD_STAKES_PARA_BLOCK_THRESH,
+                            alignof(fd_stake_history_entry_t), sizeof(fd_stake_history_entry_t), 1UL ) {
+  fd_stake_history_entry_t *     _sum                      = (fd_stake_history_entry_t *)    arg[0];
+  fd_stake_delegations_t const * stake_delegations         = (fd_stake_delegations_t const *)arg[1];
+  ulong                          epoch                     =                                 arg[2];
+  fd_stake_history_t const *     history                   = (fd_stake_history_t const *)    arg[3];
+  ulong *                        new_rate_activation_epoch = (ulong *)                       arg[4];
+
+  fd_stake_history_entry_t sum = { .effective = 0UL, .activating = 0UL, .deactivating = 0UL };
+
+  fd_stake_delegations_iter_t iter_[1];
+  for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init_range( iter_, stake_delegations, (ulong)block_i0, (ulong)block_i1 );
+       !fd_stake_delegations_iter_done( iter );
+       fd_stake_delegations_iter_next( iter ) ) {
+    fd_stake_history_entry_t entry = fd_stakes_private_activation( fd_stake_delegations_iter_ele( iter ), epoch, history, new_rate_activation_epoch );
+    sum.effective    += entry.effective;
+    sum.activating   += entry.activating;
+    sum.deactivating += entry.deactivating;
+  }
+
+  *_sum = sum;
+
+} FD_MAP_END {
+
+  fd_stake_history_entry_t *       sum = (fd_stake_history_entry_t *)      arg[0];
+  fd_stake_history_entry_t const * r1  = (fd_stake_history_entry_t const *)_r1;
+  sum->effective    += r1->effective;
+  sum->activating   += r1->activating;
+  sum->deactivating += r1->deactivating;
+
+} FD_REDUCE_END
+
+/* fd_stakes_vote_stake_task adds the effective stake of the
+   delegations on chains [block_i0,block_i1) to the stake of the vote
+   account they delegate to and sums the stake that was attributed to
+   a vote account.  Different threads can delegate to the same vote
+   account so the vote account stake is updated atomically. */
+
+static FD_MAP_REDUCE_BEGIN( fd_stakes_vote_stake_task, FD_STAKES_PARA_BLOCK_THRESH, alignof(ulong), sizeof(ulong), 1UL ) {
+  ulong *                        _total_stake              = (ulong *)                       arg[0];
+  fd_vote_states_t const *       vote_states               = (fd_vote_states_t const *)      arg[1];
+  fd_stake_delegations_t const * stake_delegations         = (fd_stake_delegations_t const *)arg[2];
+  ulong                          epoch                     =                                 arg[3];
+  fd_stake_history_t const *     history                   = (fd_stake_history_t const *)    arg[4];
+  ulong *                        new_rate_activation_epoch = (ulong *)                       arg[5];
+
+  ulong total_stake = 0UL;
+
+  fd_stake_delegations_iter_t iter_[1];
+  for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init_range( iter_, stake_delegations, (ulong)block_i0, (ulong)block_i1 );
+       !fd_stake_delegations_iter_done( iter );
+       fd_stake_delegations_iter_next( iter ) ) {
+    fd_stake_delegation_t const * stake_delegation = fd_stake_delegations_iter_ele( iter );
+
+    fd_vote_state_ele_t * vote_state = fd_vote_states_query( vote_states, &stake_delegation->vote_account );
+    if( FD_UNLIKELY( !vote_state ) ) continue;
+
+    ulong effective = fd_stakes_private_activation( stake_delegation, epoch, history, new_rate_activation_epoch ).effective;
+    total_stake += effective;
+#   if FD_HAS_ATOMIC
+    FD_ATOMIC_FETCH_AND_ADD( &vote_state->stake, effective );
+#   else
+    vote_state->stake += effective;
+#   endif
+  }
+
+  *_total_stake = total_stake;
+
+} FD_MAP_END {
+
+  *(ulong *)arg[0] += *(ulong const *)_r1;
+
+} FD_REDUCE_END
+
+fd_stake_history_entry_t
+fd_stakes_accumulate_tpool( fd_tpool_t *                   tpool,
+                            ulong                          t0,
+                            ulong                          t1,
+                            fd_stake_delegations_t const * stake_delegations,
+                            ulong                          epoch,
+                            fd_stake_history_t const *     history,
+                            ulong *                        new_rate_activation_epoch ) {
+  fd_stake_history_entry_t sum[1];
+  long chain_cnt = (long)fd_stake_delegations_chain_cnt( stake_delegations );
+  FD_MAP_REDUCE( fd_stakes_accumulate_task, tpool,t0,t1, 0L,chain_cnt, sum,
+                 stake_delegations, epoch, history, new_rate_activation_epoch );
+  return sum[0];
+}
+
+ulong
+fd_stakes_vote_stake_tpool( fd_tpool_t *                   tpool,
+                            ulong                          t0,
+                            ulong                          t1,
+                            fd_vote_states_t *             vote_states,
+                            fd_stake_delegations_t const * stake_delegations,
+                            ulong                          epoch,
+                            fd_stake_history_t const *     history,
+                            ulong *                        new_rate_activation_epoch ) {
+  ulong total_stake[1];
+  long chain_cnt = (long)fd_stake_delegations_chain_cnt( stake_delegations );
+  FD_MAP_REDUCE( fd_stakes_vote_stake_task, tpool,t0,t1, 0L,chain_cnt, total_stake,
+                 vote_states, stake_delegations, epoch, history, new_rate_activation_epoch );
+  return total_stake[0];
+}
+
 /* We need to update the amount of stake that each vote account has for
    the given epoch.  This can only be done after the stake history
    sysvar has been updated.  We also cache the stakes for each of the
@@ -32,15 +163,16 @@ fd_stake_weights_by_node( fd_vote_states_t const * vote_states,
 
    https://github.com/anza-xyz/agave/blob/v3.0.4/runtime/src/stakes.rs#L471 */
 void
-fd_refresh_vote_accounts( fd_bank_t *                    bank,
-                          fd_stake_delegations_t const * stake_delegations,
-                          fd_stake_history_t const *     history,
-                          ulong *                        new_rate_activation_epoch ) {
+fd_refresh_vote_accounts_tpool( fd_tpool_t *                   tpool,
+                                ulong                          t0,
+                                ulong                          t1,
+                                fd_bank_t *                    bank,
+                                fd_stake_delegations_t const * stake_delegations,
+                                fd_stake_history_t const *     history,
+                                ulong *                        new_rate_activation_epoch ) {
 
   ulong epoch = fd_bank_epoch_get( bank );
 
-  ulong total_stake = 0UL;
-
   fd_vote_states_t * vote_states = fd_bank_vote_states_locking_modify( bank );
   if( FD_UNLIKELY( !vote_states ) ) {
     FD_LOG_CRIT(( "vote_states is NULL" ));
@@ -50,32 +182,12 @@ fd_refresh_vote_accounts( fd_bank_t *                    bank,
      current stake delegation values. */
   fd_vote_states_reset_stakes( vote_states );
 
-  fd_stake_delegations_iter_t iter_[1];
-  for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init( iter_, stake_delegations );
-       !fd_stake_delegations_iter_done( iter );
-       fd_stake_delegations_iter_next( iter ) ) {
-    fd_stake_delegation_t const * stake_delegation = fd_stake_delegations_iter_ele( iter );
-
-    fd_delegation_t delegation = {
-      .voter_pubkey         = stake_delegation->vote_account,
-      .stake                = stake_delegation->stake,
-      .deactivation_epoch   = stake_delegation->deactivation_epoch,
-      .activation_epoch     = stake_delegation->activation_epoch,
-      .warmup_cooldown_rate = stake_delegation->warmup_cooldown_rate,
-    };
-
-    fd_stake_history_entry_t new_entry = fd_stake_activating_and_deactivating(
-        &delegation,
-        epoch,
-        history,
-        new_rate_activation_epoch );
-
-    fd_vote_state_ele_t * vote_state = fd_vote_states_query( vote_states, &stake_delegation->vote_account );
-    if( FD_LIKELY( vote_state ) ) {
-      total_stake       += new_entry.effective;
-      vote_state->stake += new_entry.effective;
-    }
-  }
+  ulong total_stake = fd_stakes_vote_stake_tpool( tpool, t0, t1,
+                                                  vote_states,
+                                                  stake_delegations,
+                                                  epoch,
+                                                  history,
+                                                  new_rate_activation_epoch );
 
   fd_bank_total_epoch_stake_set( bank, total_stake );
 
@@ -84,12 +196,15 @@ fd_refresh_vote_accounts( fd_bank_t *                    bank,
 
 /* https://github.com/anza-xyz/agave/blob/v3.0.4/runtime/src/stakes.rs#L280 */
 void
-fd_stakes_activate_epoch( fd_bank_t *                    bank,
-                          fd_accdb_user_t *              accdb,
-                          fd_funk_txn_xid_t const *      xid,
-                          fd_capture_ctx_t *             capture_ctx,
-                          fd_stake_delegations_t const * stake_delegations,
-                          ulong *                        new_rate_activation_epoch ) {
+fd_stakes_activate_epoch_tpool( fd_tpool_t *                   tpool,
+                                ulong                          t0,
+                                ulong                          t1,
+                                fd_bank_t *                    bank,
+                                fd_accdb_user_t *              accdb,
+                                fd_funk_txn_xid_t const *      xid,
+                                fd_capture_ctx_t *             capture_ctx,
+                                fd_stake_delegations_t const * stake_delegations,
+                                ulong *                        new_rate_activation_epoch ) {
 
   /* First, we need to accumulate the stats for the current amount of
      effective, activating, and deactivating stake for the current
@@ -105,37 +220,13 @@ fd_stakes_activate_epoch( fd_bank_t *                    bank,
 
   fd_epoch_stake_history_entry_pair_t new_elem = {
     .epoch = fd_bank_epoch_get( bank ),
-    .entry = {
-      .effective    = 0UL,
-      .activating   = 0UL,
-      .deactivating = 0UL
-    }
+    .entry = fd_stakes_accumulate_tpool( tpool, t0, t1,
+                                         stake_delegations,
+                                         fd_bank_epoch_get( bank ),
+                                         stake_history,
+                                         new_rate_activation_epoch )
   };
 
-  fd_stake_delegations_iter_t iter_[1];
-  for( fd_stake_delegations_iter_t * iter = fd_stake_delegations_iter_init( iter_, stake_delegations );
-       !fd_stake_delegations_iter_done( iter );
-       fd_stake_delegations_iter_next( iter ) ) {
-    fd_stake_delegation_t const * stake_delegation = fd_stake_delegations_iter_ele( iter );
-
-    fd_delegation_t delegation = {
-      .voter_pubkey         = stake_delegation->vote_account,
-      .stake                = stake_delegation->stake,
-      .activation_epoch     = stake_delegation->activation_epoch,
-      .deactivation_epoch   = stake_delegation->deactivation_epoch,
-      .warmup_cooldown_rate = stake_delegation->warmup_cooldown_rate,
-    };
-
-    fd_stake_history_entry_t new_entry = fd_stake_activating_and_deactivating(
-        &delegation,
-        fd_bank_epoch_get( bank ),
-        stake_history,
-        new_rate_activation_epoch );
-    new_elem.entry.effective    += new_entry.effective;
-    new_elem.entry.activating   += new_entry.activating;
-    new_elem.entry.deactivating += new_entry.deactivating;
-  }
-
   fd_sysvar_stake_history_update( bank, accdb, xid, capture_ctx, &new_elem );
 
   if( FD_UNLIKELY( !fd_sysvar_stake_history_read( funk, xid, stake_history ) ) ) {
@@ -147,10 +238,11 @@ fd_stakes_activate_epoch( fd_bank_t *                    bank,
 
   fd_bank_epoch_set( bank, fd_bank_epoch_get( bank ) + 1UL );
 
-  fd_refresh_vote_accounts( bank,
-                            stake_delegations,
-                            stake_history,
-                            new_rate_activation_epoch );
+  fd_refresh_vote_accounts_tpool( tpool, t0, t1,
+                                  bank,
+                                  stake_delegations,
+                                  stake_history,
+                                  new_rate_activation_epoch );
 
 }
 
@@ -42,13 +42,66 @@ ulong
 fd_stake_weights_by_node( fd_vote_states_t const * vote_states,
                           fd_vote_stake_weight_t * weights );
 
+/* fd_stakes_activate_epoch_tpool appends the effective, activating and
+   deactivating stake of all stake delegations at the current epoch to
+   the stake history sysvar, advances the bank to the next epoch and
+   refreshes the vote account stakes for it (see
+   fd_refresh_vote_accounts_tpool).  The passes over all stake
+   delegations are split across the caller and tpool threads (t0,t1),
+   which are assumed to be idle.  The result is independent of the
+   number of threads (all reductions are integer sums).
+   fd_stakes_activate_epoch is the same but runs single threaded. */
+
 void
+fd_stakes_activate_epoch_tpool( fd_tpool_t *                   tpool,
+                                ulong                          t0,
+                                ulong                          t1,
+                                fd_bank_t *                    bank,
+                                fd_accdb_user_t *              accdb,
+                                fd_funk_txn_xid_t const *      xid,
+                                fd_capture_ctx_t *             capture_ctx,
+                                fd_stake_delegations_t const * stake_delegations,
+                                ulong *                        new_rate_activation_epoch );
+
+static inline void
 fd_stakes_activate_epoch( fd_bank_t *                    bank,
                           fd_accdb_user_t *              accdb,
                           fd_funk_txn_xid_t const *      xid,
                           fd_capture_ctx_t *             capture_ctx,
                           fd_stake_delegations_t const * stake_delegations,
-                          ulong *                        new_rate_activation_epoch );
+                          ulong *                        new_rate_activation_epoch ) {
+  fd_stakes_activate_epoch_tpool( NULL, 0UL, 1UL, bank, accdb, xid, capture_ctx, stake_delegations, new_rate_activation_epoch );
+}
+
+/* fd_stakes_accumulate_tpool returns the sum of the effective,
+   activating and deactivating stake of all stake delegations at the
+   given epoch.  fd_stakes_vote_stake_tpool adds the effective stake of
+   each stake delegation at the given epoch to the stake of the vote
+   account it delegates to (delegations to unknown vote accounts are
+   ignored) and returns the total stake added.  Both split the stake
+   delegations by map chain across the caller and tpool threads
+   (t0,t1), which are assumed to be idle, and give the same result for
+   any number of threads.  The caller is responsible for holding any
+   locks needed to read stake_delegations and to modify vote_states. */
+
+fd_stake_history_entry_t
+fd_stakes_accumulate_tpool( fd_tpool_t *                   tpool,
+                            ulong                          t0,
+                            ulong                          t1,
+                            fd_stake_delegations_t const * stake_delegations,
+                            ulong                          epoch,
+                            fd_stake_history_t const *     history,
+                            ulong *                        new_rate_activation_epoch );
+
+ulong
+fd_stakes_vote_stake_tpool( fd_tpool_t *                   tpool,
+                            ulong                          t0,
+                            ulong                          t1,
+                            fd_vote_states_t *             vote_states,
+                            fd_stake_delegations_t const * stake_delegations,
+                            ulong                          epoch,
+                            fd_stake_history_t const *     history,
+                            ulong *                        new_rate_activation_epoch );
 
 fd_stake_history_entry_t
 stake_and_activating( fd_delegation_t const * delegation,
@@ -66,11 +119,28 @@ int
 write_stake_state( fd_txn_account_t *    stake_acc_rec,
                    fd_stake_state_v2_t * stake_state );
 
+/* fd_refresh_vote_accounts_tpool recomputes the stake of each vote
+   account and the total epoch stake of the bank from the stake
+   delegations at the bank's current epoch.  Threads are used as in
+   fd_stakes_activate_epoch_tpool.  fd_refresh_vote_accounts is the
+   same but runs single threaded. */
+
 void
+fd_refresh_vote_accounts_tpool( fd_tpool_t *                   tpool,
+                                ulong                          t0,
+                                ulong                          t1,
+                                fd_bank_t *                    bank,
+                                fd_stake_delegations_t const * stake_delegations,
+                                fd_stake_history_t const *     history,
+                                ulong *                        new_rate_activation_epoch );
+
+static inline void
 fd_refresh_vote_accounts( fd_bank_t *                    bank,
                           fd_stake_delegations_t const * stake_delegations,
                           fd_stake_history_t const *     history,
-                          ulong *                        new_rate_activation_epoch );
+                          ulong *                        new_rate_activation_epoch ) {
+  fd_refresh_vote_accounts_tpool( NULL, 0UL, 1UL, bank, stake_delegations, history, new_rate_activation_epoch );
+}
 
 /* fd_stakes_update_delegation is used to maintain the in-memory cache
    of the stake delegations that is used at the epoch boundary.  Entries
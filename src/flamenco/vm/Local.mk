@@ -1,7 +1,7 @@
 ifdef FD_HAS_HOSTED
 ifdef FD_HAS_INT128
 $(call add-hdrs,fd_vm_base.h fd_vm.h fd_vm_private.h) # FIXME: PRIVATE TEMPORARILY HERE DUE TO SOME MESSINESS IN FD_VM_SYSCALL.H
-$(call add-objs,fd_vm fd_vm_interp fd_vm_disasm fd_vm_trace,fd_flamenco)
+$(call add-objs,fd_vm fd_vm_interp fd_vm_disasm fd_vm_trace fd_vm_prof,fd_flamenco)
 
 $(call add-hdrs,test_vm_util.h)
 $(call add-objs,test_vm_util,fd_flamenco)
@@ -20,6 +20,9 @@ $(call make-unit-test,test_vm_base,test_vm_base,fd_flamenco fd_ballet fd_util)
 
 $(call make-unit-test,test_vm_instr,test_vm_instr,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
 $(call run-unit-test,test_vm_instr)
+$(call make-unit-test,bench_vm_mem,bench_vm_mem,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call make-unit-test,bench_vm_fuse,bench_vm_fuse,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call make-fuzz-test,fuzz_vm_fuse,fuzz_vm_fuse,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
 
 $(call run-unit-test,test_vm_base)
 endif
@@ -0,0 +1,241 @@
+/* bench_vm_fuse measures the interpreter with and without the fused
+   text stream produced by fd_vm_fuse.  It reports, for the sBPF
+   programs in the sbpf fixtures (including the SPL token p-token
+   program), how much of the text fd_vm_fuse can fuse and how long the
+   pre-decode takes.  It then runs a loop program that scans a heap
+   buffer the way programs typically parse account data (loads feeding
+   compares and branches) both ways, checks the results, ic and cu are
+   identical and reports the instruction throughput of each. */
+
+#include "fd_vm_private.h"
+#include "../../ballet/sbpf/fd_sbpf_opcodes.h"
+
+#if FD_HAS_HOSTED
+
+#include <stdlib.h>
+
+FD_IMPORT_BINARY( ptoken_elf,       "src/ballet/sbpf/fixtures/ptoken_program_v3.so"              );
+FD_IMPORT_BINARY( hello_elf,        "src/ballet/sbpf/fixtures/hello_solana_program.so"           );
+FD_IMPORT_BINARY( hello_v2_elf,     "src/ballet/sbpf/fixtures/hello_solana_program_sbpf_v2.so"   );
+FD_IMPORT_BINARY( clock_sysvar_elf, "src/ballet/sbpf/fixtures/clock_sysvar_program.so"           );
+
+static fd_vm_t _vm[1];
+
+/* bench_elf loads the given program and logs fusion statistics */
+
+static void
+bench_elf( char const *  name,
+           uchar const * elf,
+           ulong         elf_sz,
+           ulong         rep_cnt ) {
+
+  fd_sbpf_loader_config_t config = { 0 };
+  config.sbpf_min_version = FD_SBPF_V0;
+  config.sbpf_max_version = FD_SBPF_V3;
+
+  fd_sbpf_elf_info_t info[1];
+  if( FD_UNLIKELY( fd_sbpf_elf_peek( info, elf, elf_sz, &config )<0 ) ) {
+    FD_LOG_WARNING(( "%-14s: fd_sbpf_elf_peek failed, skipping", name ));
+    return;
+  }
+
+  void * rodata  = malloc( info->bin_sz );
+  void * scratch = malloc( elf_sz );
+  fd_sbpf_program_t * prog = fd_sbpf_program_new(
+      aligned_alloc( fd_sbpf_program_align(), fd_sbpf_program_footprint( info ) ), info, rodata );
+  fd_sbpf_syscalls_t * syscalls = fd_sbpf_syscalls_join( fd_sbpf_syscalls_new(
+      aligned_alloc( fd_sbpf_syscalls_align(), fd_sbpf_syscalls_footprint() ) ) );
+  FD_TEST( rodata && scratch && prog && syscalls );
+
+  if( FD_UNLIKELY( fd_sbpf_program_load( prog, elf, elf_sz, syscalls, &config, scratch, elf_sz ) ) ) {
+    FD_LOG_WARNING(( "%-14s: fd_sbpf_program_load failed, skipping", name ));
+  } else {
+    /* The strict (v3+) loader does not copy the ELF into rodata, read
+       the text straight from the ELF in that case */
+
+    ulong const * text     = fd_sbpf_enable_stricter_elf_headers_enabled( info->sbpf_version ) ?
+                             (ulong const *)( elf + info->text_off ) : prog->text;
+    ulong         text_cnt = prog->info.text_cnt;
+    ulong *       fused    = malloc( fd_ulong_max( text_cnt, 1UL )*sizeof(ulong) ); FD_TEST( fused );
+
+    ulong fuse_cnt = fd_vm_fuse( fused, text, text_cnt, info->sbpf_version );
+    long  dt       = -fd_log_wallclock();
+    for( ulong rep=0UL; rep<rep_cnt; rep++ ) {
+      FD_COMPILER_MFENCE();
+      FD_TEST( fd_vm_fuse( fused, text, text_cnt, info->sbpf_version )==fuse_cnt );
+    }
+    dt += fd_log_wallclock();
+
+    FD_LOG_NOTICE(( "%-14s: sbpf v%lu, %6lu words, %5lu ldx+jcc pairs fused (%5.2f%% of words), pre-decode %8.1f us (%5.2f ns/word)",
+                    name, info->sbpf_version, text_cnt, fuse_cnt, 100.*(double)(2UL*fuse_cnt)/(double)fd_ulong_max( text_cnt, 1UL ),
+                    1e-3*(double)dt/(double)rep_cnt, (double)dt/(double)(rep_cnt*fd_ulong_max( text_cnt, 1UL )) ));
+    free( fused );
+  }
+
+  free( fd_sbpf_syscalls_delete( fd_sbpf_syscalls_leave( syscalls ) ) );
+  free( fd_sbpf_program_delete( prog ) );
+  free( scratch );
+  free( rodata );
+}
+
+/* run_scan executes the loop program
+
+     r4 = heap + (i & mask)
+     r2 = *(uchar *)r4;  if( r2!=0   ) r8++
+     r3 = *(uint  *)r4;  if( r3==r9  ) r8++
+     r5 = *(ulong *)r4;  if( r5!=r9  ) r8++
+
+   for i in [0,iter_cnt) rep_cnt times, either on the plain or the
+   fused text.  Returns the average ns per instruction and the final
+   r8, ic and cu in *_r8, *_ic and *_cu. */
+
+static double
+run_scan( fd_vm_t * vm,
+          ulong     sbpf_version,
+          ulong     iter_cnt,
+          ulong     rep_cnt,
+          int       fuse,
+          ulong *   _r8,
+          ulong *   _ic,
+          ulong *   _cu ) {
+
+  int v2 = fd_sbpf_move_memory_ix_classes_enabled( sbpf_version );
+  ulong ldxb  = v2 ? 0x2cUL : 0x71UL;
+  ulong ldxw  = v2 ? 0x8cUL : 0x61UL;
+  ulong ldxdw = v2 ? 0x9cUL : 0x79UL;
+
+  ulong text[16];
+  ulong text_cnt = 0UL;
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_MOV64_IMM, 6, 0,   0, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_MOV64_REG, 4, 6,   0, 0U                 ); /* loop: */
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_AND64_IMM, 4, 0,   0, 0xff0U             );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_ADD64_REG, 4, 7,   0, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( ldxb,                 2, 4,   0, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_JEQ_IMM,   2, 0,   1, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_ADD64_IMM, 8, 0,   0, 1U                 );
+  text[ text_cnt++ ] = fd_vm_instr( ldxw,                 3, 4,   4, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_JNE_REG,   3, 9,   1, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_ADD64_IMM, 8, 0,   0, 1U                 );
+  text[ text_cnt++ ] = fd_vm_instr( ldxdw,                5, 4,   8, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_JEQ_REG,   5, 9,   1, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_ADD64_IMM, 8, 0,   0, 1U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_ADD64_IMM, 6, 0,   0, 1U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_JNE_IMM,   6, 0, -14, (uint)iter_cnt      );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_EXIT,      0, 0,   0, 0U                 );
+
+  ulong fused[16];
+  FD_TEST( fd_vm_fuse( fused, text, text_cnt, sbpf_version )==3UL );
+
+  fd_sbpf_calldests_t * calldests = fd_sbpf_calldests_join( fd_sbpf_calldests_new(
+      aligned_alloc( fd_sbpf_calldests_align(), fd_sbpf_calldests_footprint( text_cnt ) ), text_cnt ) );
+  fd_sbpf_syscalls_t * syscalls = fd_sbpf_syscalls_join( fd_sbpf_syscalls_new(
+      aligned_alloc( fd_sbpf_syscalls_align(), fd_sbpf_syscalls_footprint() ) ) );
+  FD_TEST( calldests && syscalls );
+
+  long dt = 0L;
+  for( ulong rep=0UL; rep<rep_cnt+1UL; rep++ ) {
+    FD_TEST( fd_vm_init(
+      /* vm                                   */ vm,
+      /* instr_ctx                            */ NULL,
+      /* heap_max                             */ FD_VM_HEAP_DEFAULT,
+      /* entry_cu                             */ 1UL<<40,
+      /* rodata                               */ (uchar const *)text,
+      /* rodata_sz                            */ text_cnt*sizeof(ulong),
+      /* text                                 */ text,
+      /* text_cnt                             */ text_cnt,
+      /* text_off                             */ 0UL,
+      /* text_sz                              */ text_cnt*sizeof(ulong),
+      /* entry_pc                             */ 0UL,
+      /* calldests                            */ calldests,
+      /* sbpf_version                         */ sbpf_version,
+      /* syscalls                             */ syscalls,
+      /* trace                                */ NULL,
+      /* sha                                  */ NULL,
+      /* mem_regions                          */ NULL,
+      /* mem_regions_cnt                      */ 0U,
+      /* mem_regions_accs                     */ NULL,
+      /* is_deprecated                        */ 0,
+      /* direct mapping                       */ 1,
+      /* stricter_abi_and_runtime_constraints */ 0,
+      /* dump_syscall_to_pb                   */ 0,
+      /* r2_initial_value                     */ 0UL ) );
+    FD_TEST( !fd_vm_validate( vm ) );
+    if( fuse ) vm->fused_text = fused;
+
+    /* Mostly zero bytes with some set, same data for every run */
+
+    fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1U, 0UL ) );
+    for( ulong i=0UL; i<4096UL; i++ ) vm->heap[ i ] = (uchar)fd_uint_if( !fd_rng_uint_roll( rng, 4U ), fd_rng_uint( rng ), 0U );
+    fd_rng_delete( fd_rng_leave( rng ) );
+    vm->reg[7] = FD_VM_MEM_MAP_HEAP_REGION_START;
+    vm->reg[8] = 0UL;
+    vm->reg[9] = 0UL;
+
+    long t = -fd_log_wallclock();
+    int err = fd_vm_exec_notrace( vm );
+    t += fd_log_wallclock();
+    if( FD_UNLIKELY( err ) ) FD_LOG_ERR(( "exec failed (%i-%s)", err, fd_vm_strerror( err ) ));
+    FD_TEST( vm->reg[6]==iter_cnt );
+    if( rep ) dt += t; /* first rep is warmup */
+  }
+
+  *_r8 = vm->reg[8];
+  *_ic = vm->ic;
+  *_cu = vm->cu;
+
+  free( fd_sbpf_syscalls_delete ( fd_sbpf_syscalls_leave ( syscalls  ) ) );
+  free( fd_sbpf_calldests_delete( fd_sbpf_calldests_leave( calldests ) ) );
+  return (double)dt/(double)(rep_cnt*(*_ic));
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong iter_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-cnt", NULL, 1UL<<20 );
+  ulong rep_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--rep-cnt",  NULL, 8UL     );
+
+  if( FD_UNLIKELY( !iter_cnt || iter_cnt>(ulong)INT_MAX ) ) FD_LOG_ERR(( "bad --iter-cnt" ));
+  if( FD_UNLIKELY( !rep_cnt                             ) ) FD_LOG_ERR(( "bad --rep-cnt"  ));
+
+  /* Static coverage and pre-decode cost on real programs */
+
+  bench_elf( "ptoken",       ptoken_elf,       ptoken_elf_sz,       16UL*rep_cnt );
+  bench_elf( "hello",        hello_elf,        hello_elf_sz,        16UL*rep_cnt );
+  bench_elf( "hello_v2",     hello_v2_elf,     hello_v2_elf_sz,     16UL*rep_cnt );
+  bench_elf( "clock_sysvar", clock_sysvar_elf, clock_sysvar_elf_sz, 16UL*rep_cnt );
+
+  /* Throughput */
+
+  fd_vm_t * vm = fd_vm_join( fd_vm_new( _vm ) );
+  FD_TEST( vm );
+
+  for( ulong sbpf_version=FD_SBPF_V0; sbpf_version<=FD_SBPF_V2; sbpf_version+=2UL ) {
+    ulong r8[2], ic[2], cu[2];
+    double plain = run_scan( vm, sbpf_version, iter_cnt, rep_cnt, 0, r8+0, ic+0, cu+0 );
+    double fused = run_scan( vm, sbpf_version, iter_cnt, rep_cnt, 1, r8+1, ic+1, cu+1 );
+    FD_TEST( r8[0]==r8[1] && ic[0]==ic[1] && cu[0]==cu[1] );
+    FD_LOG_NOTICE(( "scan (sbpf v%lu): plain %7.1f Minstr/s (%5.2f ns/instr)  fused %7.1f Minstr/s (%5.2f ns/instr)  speedup %5.3fx",
+                    sbpf_version, 1e3/plain, plain, 1e3/fused, fused, plain/fused ));
+  }
+
+  FD_TEST( fd_vm_delete( fd_vm_leave( vm ) ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -0,0 +1,212 @@
+/* bench_vm_mem measures the cost of sBPF loads and stores in the
+   interpreter for the different memory regions.  A small loop program
+   does a load and a store per iteration against the stack (with and
+   without stack frame gaps), the heap and the input region, where the
+   input region is split into --region-cnt account sized regions and the
+   loop cycles through a configurable number of them.  Working sets of
+   up to FD_VM_INPUT_TLB_CNT input regions hit the input tlb, larger
+   ones fall back to the binary search.  It also times the input region
+   translation in isolation against a plain binary search reference
+   (which is also used to validate the translations). */
+
+#include "fd_vm_private.h"
+#include "../../ballet/sbpf/fd_sbpf_opcodes.h"
+
+#if FD_HAS_HOSTED
+
+#include <stdlib.h>
+
+#define REGION_MAX (1024UL)
+#define REGION_SZ  (64UL)
+
+static fd_vm_t              _vm[1];
+static fd_vm_input_region_t input_region[ REGION_MAX ];
+static uchar                input_mem   [ REGION_MAX*REGION_SZ ] __attribute__((aligned(64)));
+
+/* ref_translate is the input region translation without the tlb */
+
+static ulong
+ref_translate( fd_vm_t const * vm,
+               ulong           offset,
+               ulong           sz ) {
+  ulong idx = fd_vm_get_input_mem_region_idx( vm, offset );
+  fd_vm_input_region_t const * region = &vm->input_mem_regions[ idx ];
+  ulong bytes_in_region = fd_ulong_sat_sub( region->region_sz, fd_ulong_sat_sub( offset, region->vaddr_offset ) );
+  if( sz>bytes_in_region ) return 0UL;
+  return region->haddr + offset - region->vaddr_offset;
+}
+
+/* run_loop executes the loop program
+
+     r4 = r7 + (i & (hot_cnt-1))*stride
+     r2 = *(ulong *)r4
+     *(ulong *)(r4+8) = r2
+
+   for i in [0,iter_cnt) rep_cnt times and returns the average ns per
+   iteration. */
+
+static double
+run_loop( fd_vm_t * vm,
+          ulong     sbpf_version,
+          ulong     base,
+          ulong     hot_cnt,
+          ulong     stride,
+          ulong     iter_cnt,
+          ulong     rep_cnt,
+          ulong     region_cnt ) {
+
+  ulong text[10];
+  ulong text_cnt = 0UL;
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_MOV64_IMM, 6, 0,  0, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_MOV64_REG, 4, 6,  0, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_AND64_IMM, 4, 0,  0, (uint)(hot_cnt-1UL) );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_MUL64_IMM, 4, 0,  0, (uint)stride        );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_ADD64_REG, 4, 7,  0, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_LDXDW,     2, 4,  0, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_STXDW,     4, 2,  8, 0U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_ADD64_IMM, 6, 0,  0, 1U                 );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_JNE_IMM,   6, 0, -8, (uint)iter_cnt      );
+  text[ text_cnt++ ] = fd_vm_instr( FD_SBPF_OP_EXIT,      0, 0,  0, 0U                 );
+
+  fd_sbpf_calldests_t * calldests = fd_sbpf_calldests_join( fd_sbpf_calldests_new(
+      aligned_alloc( fd_sbpf_calldests_align(), fd_sbpf_calldests_footprint( text_cnt ) ), text_cnt ) );
+  fd_sbpf_syscalls_t * syscalls = fd_sbpf_syscalls_join( fd_sbpf_syscalls_new(
+      aligned_alloc( fd_sbpf_syscalls_align(), fd_sbpf_syscalls_footprint() ) ) );
+  FD_TEST( calldests && syscalls );
+
+  long dt = 0L;
+  for( ulong rep=0UL; rep<rep_cnt+1UL; rep++ ) {
+    FD_TEST( fd_vm_init(
+      /* vm                                   */ vm,
+      /* instr_ctx                            */ NULL,
+      /* heap_max                             */ FD_VM_HEAP_DEFAULT,
+      /* entry_cu                             */ 1UL<<40,
+      /* rodata                               */ (uchar const *)text,
+      /* rodata_sz                            */ text_cnt*sizeof(ulong),
+      /* text                                 */ text,
+      /* text_cnt                             */ text_cnt,
+      /* text_off                             */ 0UL,
+      /* text_sz                              */ text_cnt*sizeof(ulong),
+      /* entry_pc                             */ 0UL,
+      /* calldests                            */ calldests,
+      /* sbpf_version                         */ sbpf_version,
+      /* syscalls                             */ syscalls,
+      /* trace                                */ NULL,
+      /* sha                                  */ NULL,
+      /* mem_regions                          */ input_region,
+      /* mem_regions_cnt                      */ (uint)region_cnt,
+      /* mem_regions_accs                     */ NULL,
+      /* is_deprecated                        */ 0,
+      /* direct mapping                       */ 1,
+      /* stricter_abi_and_runtime_constraints */ 0,
+      /* dump_syscall_to_pb                   */ 0,
+      /* r2_initial_value                     */ 0UL ) );
+    vm->reg[7] = base;
+    FD_TEST( !fd_vm_validate( vm ) );
+
+    long t = -fd_log_wallclock();
+    int err = fd_vm_exec_notrace( vm );
+    t += fd_log_wallclock();
+    if( FD_UNLIKELY( err ) ) FD_LOG_ERR(( "exec failed (%i-%s)", err, fd_vm_strerror( err ) ));
+    FD_TEST( vm->reg[6]==iter_cnt );
+    if( rep ) dt += t; /* first rep is warmup */
+  }
+
+  free( fd_sbpf_syscalls_delete ( fd_sbpf_syscalls_leave ( syscalls  ) ) );
+  free( fd_sbpf_calldests_delete( fd_sbpf_calldests_leave( calldests ) ) );
+  return (double)dt/(double)(rep_cnt*iter_cnt);
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong iter_cnt   = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-cnt",   NULL, 1UL<<20 );
+  ulong rep_cnt    = fd_env_strip_cmdline_ulong( &argc, &argv, "--rep-cnt",    NULL, 8UL     );
+  ulong region_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--region-cnt", NULL, 256UL   );
+
+  if( FD_UNLIKELY( !iter_cnt || iter_cnt>(ulong)INT_MAX ) ) FD_LOG_ERR(( "bad --iter-cnt" ));
+  if( FD_UNLIKELY( !rep_cnt                             ) ) FD_LOG_ERR(( "bad --rep-cnt"  ));
+  if( FD_UNLIKELY( !fd_ulong_is_pow2( region_cnt ) || region_cnt>REGION_MAX ) )
+    FD_LOG_ERR(( "--region-cnt should be a power of 2 in [1,%lu]", REGION_MAX ));
+
+  for( ulong i=0UL; i<region_cnt; i++ ) {
+    input_region[ i ] = (fd_vm_input_region_t){
+      .vaddr_offset           = i*REGION_SZ,
+      .haddr                  = (ulong)input_mem + i*REGION_SZ,
+      .region_sz              = (uint)REGION_SZ,
+      .address_space_reserved = REGION_SZ,
+      .is_writable            = 1U,
+    };
+  }
+
+  fd_vm_t * vm = fd_vm_join( fd_vm_new( _vm ) );
+  FD_TEST( vm );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  /* Translation in isolation.  The offsets are precomputed so only the
+     lookup is timed. */
+
+  FD_TEST( fd_vm_init( vm, NULL, 0UL, 0UL, NULL, 0UL, NULL, 0UL, 0UL, 0UL, 0UL, NULL, FD_SBPF_V0, NULL, NULL, NULL,
+                       input_region, (uint)region_cnt, NULL, 0, 1, 0, 0, 0UL ) );
+
+# define OFF_CNT (1UL<<16)
+  static ulong off[ OFF_CNT ];
+  FD_LOG_NOTICE(( "input translation (--region-cnt %lu)", region_cnt ));
+  for( ulong hot_cnt=1UL; hot_cnt<=region_cnt; hot_cnt<<=1 ) {
+    ulong stride = region_cnt/hot_cnt;
+    for( ulong i=0UL; i<OFF_CNT; i++ ) off[ i ] = (fd_rng_ulong_roll( rng, hot_cnt )*stride)*REGION_SZ + fd_rng_ulong_roll( rng, REGION_SZ-7UL );
+    for( ulong i=0UL; i<OFF_CNT; i++ ) FD_TEST( fd_vm_find_input_mem_region( vm, off[ i ], 8UL, 1, 0UL )==ref_translate( vm, off[ i ], 8UL ) );
+
+    ulong acc = 0UL;
+    long dt_tlb = -fd_log_wallclock();
+    for( ulong rep=0UL; rep<rep_cnt; rep++ )
+      for( ulong i=0UL; i<OFF_CNT; i++ ) acc += fd_vm_find_input_mem_region( vm, off[ i ], 8UL, 1, 0UL );
+    dt_tlb += fd_log_wallclock();
+    long dt_ref = -fd_log_wallclock();
+    for( ulong rep=0UL; rep<rep_cnt; rep++ )
+      for( ulong i=0UL; i<OFF_CNT; i++ ) acc -= ref_translate( vm, off[ i ], 8UL );
+    dt_ref += fd_log_wallclock();
+    FD_TEST( !acc );
+
+    FD_LOG_NOTICE(( "  %4lu hot regions: tlb %6.2f ns/translate, binary search %6.2f ns/translate", hot_cnt,
+                    (double)dt_tlb/(double)(rep_cnt*OFF_CNT), (double)dt_ref/(double)(rep_cnt*OFF_CNT) ));
+  }
+# undef OFF_CNT
+
+  /* Interpreter loads and stores */
+
+  FD_LOG_NOTICE(( "interpreter load+store loop (--iter-cnt %lu --rep-cnt %lu)", iter_cnt, rep_cnt ));
+
+  ulong stack_v0 = FD_VM_MEM_MAP_STACK_REGION_START;                                 /* first frame, before its gap */
+  ulong stack_v1 = FD_VM_MEM_MAP_STACK_REGION_START + FD_VM_STACK_MAX - 4096UL;      /* top of the stack */
+  FD_LOG_NOTICE(( "  stack (frame gaps)   %6.2f ns/iter", run_loop( vm, FD_SBPF_V0, stack_v0, 4UL, 64UL, iter_cnt, rep_cnt, region_cnt ) ));
+  FD_LOG_NOTICE(( "  stack (dynamic)      %6.2f ns/iter", run_loop( vm, FD_SBPF_V1, stack_v1, 4UL, 64UL, iter_cnt, rep_cnt, region_cnt ) ));
+  FD_LOG_NOTICE(( "  heap                 %6.2f ns/iter", run_loop( vm, FD_SBPF_V1, FD_VM_MEM_MAP_HEAP_REGION_START, 4UL, 64UL, iter_cnt, rep_cnt, region_cnt ) ));
+  for( ulong hot_cnt=1UL; hot_cnt<=region_cnt; hot_cnt<<=1 ) {
+    double ns = run_loop( vm, FD_SBPF_V1, FD_VM_MEM_MAP_INPUT_REGION_START, hot_cnt, (region_cnt/hot_cnt)*REGION_SZ, iter_cnt, rep_cnt, region_cnt );
+    FD_LOG_NOTICE(( "  input %4lu hot       %6.2f ns/iter", hot_cnt, ns ));
+  }
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_vm_delete( fd_vm_leave( vm ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -480,6 +480,65 @@ fd_vm_validate( fd_vm_t const * vm ) {
   return FD_VM_SUCCESS;
 }
 
+ulong
+fd_vm_fuse( ulong *       fused,
+            ulong const * text,
+            ulong         text_cnt,
+            ulong         sbpf_version ) {
+
+  int move_memory_ix_classes = fd_sbpf_move_memory_ix_classes_enabled( sbpf_version );
+  int enable_lddw            = fd_sbpf_enable_lddw_enabled           ( sbpf_version );
+
+  ulong fuse_cnt = 0UL;
+  for( ulong i=0UL; i<text_cnt; i++ ) {
+    ulong instr = text[ i ];
+    fused[ i ] = instr;
+
+    /* Never look at the second word of a lddw */
+
+    ulong opcode = fd_vm_instr_opcode( instr );
+    if( enable_lddw && opcode==0x18UL ) { /* FD_SBPF_OP_LDDW */
+      if( FD_LIKELY( i+1UL<text_cnt ) ) { i++; fused[ i ] = text[ i ]; }
+      continue;
+    }
+
+    ulong ldx;
+    if( move_memory_ix_classes ) {
+      switch( opcode ) {
+      case 0x2cUL: ldx = 0UL; break; /* FD_SBPF_OP_LDXB  */
+      case 0x3cUL: ldx = 1UL; break; /* FD_SBPF_OP_LDXH  */
+      case 0x8cUL: ldx = 2UL; break; /* FD_SBPF_OP_LDXW  */
+      case 0x9cUL: ldx = 3UL; break; /* FD_SBPF_OP_LDXDW */
+      default: continue;
+      }
+    } else {
+      switch( opcode ) {
+      case 0x71UL: ldx = 0UL; break; /* FD_SBPF_OP_LDXB  */
+      case 0x69UL: ldx = 1UL; break; /* FD_SBPF_OP_LDXH  */
+      case 0x61UL: ldx = 2UL; break; /* FD_SBPF_OP_LDXW  */
+      case 0x79UL: ldx = 3UL; break; /* FD_SBPF_OP_LDXDW */
+      default: continue;
+      }
+    }
+
+    if( FD_UNLIKELY( i+1UL>=text_cnt ) ) continue;
+
+    ulong jcc;
+    switch( fd_vm_instr_opcode( text[ i+1UL ] ) ) {
+    case 0x15UL: jcc = 0UL; break; /* FD_SBPF_OP_JEQ_IMM */
+    case 0x55UL: jcc = 1UL; break; /* FD_SBPF_OP_JNE_IMM */
+    case 0x1dUL: jcc = 2UL; break; /* FD_SBPF_OP_JEQ_REG */
+    case 0x5dUL: jcc = 3UL; break; /* FD_SBPF_OP_JNE_REG */
+    default: continue;
+    }
+
+    fused[ i ] = (instr & ~255UL) | FD_VM_FUSED_LDX_JCC( ldx, jcc );
+    fuse_cnt++;
+  }
+
+  return fuse_cnt;
+}
+
 FD_FN_CONST ulong
 fd_vm_align( void ) {
   return FD_VM_ALIGN;
@@ -636,6 +695,9 @@ fd_vm_init(
   vm->text_sz                              = text_sz;
   vm->entry_pc                             = entry_pc;
   vm->calldests                            = calldests;
+  vm->fused_text                           = NULL;
+  vm->prof                                 = NULL;
+  vm->prof_program_id                      = NULL;
   vm->sbpf_version                         = sbpf_version;
   vm->syscalls                             = syscalls;
   vm->trace                                = trace;
@@ -192,6 +192,10 @@ struct __attribute__((aligned(FD_VM_HOST_REGION_ALIGN))) fd_vm {
                                                                 The virtual addresses of each region are contigiuous and
                                                                 strictly increasing. */
   uint                      input_mem_regions_cnt;
+  uint                      input_tlb[ FD_VM_INPUT_TLB_CNT ]; /* Indices into input_mem_regions of recently translated regions,
+                                                                checked before falling back to a binary search.  Reset by
+                                                                fd_vm_mem_cfg. */
+  uint                      input_tlb_next;                  /* Next input_tlb entry to replace (round robin) */
   fd_vm_acc_region_meta_t * acc_region_metas;                /* Represents a mapping from the instruction account indicies
                                                                 from the instruction context to the input memory region index
                                                                 of the account's data region in the input space. */
@@ -226,6 +230,13 @@ struct __attribute__((aligned(FD_VM_HOST_REGION_ALIGN))) fd_vm {
 
   ulong sbpf_version;     /* SBPF version, SIMD-0161 */
 
+  ulong const * fused_text; /* Pre-decoded copy of text produced by fd_vm_fuse, indexed [0,text_cnt), aligned 8, NULL if none.
+                               Only read by the non-tracing interpreter, everything else (validation, tracing, callx) uses text.
+                               Kept after stack and heap to preserve their alignment. */
+
+  fd_vm_prof_t * prof;            /* Location to accumulate execution profiles (no profiling if NULL) */
+  uchar const *  prof_program_id; /* Program id the profile records are attributed to (32 bytes), NULL if unknown */
+
   int dump_syscall_to_pb; /* If true, syscalls will be dumped to the specified output directory */
 };
 
@@ -241,7 +252,7 @@ FD_PROTOTYPES_BEGIN
    integer power of 2.  FOOTPRINT is a multiple of align.
    These are provided to facilitate compile time declarations. */
 #define FD_VM_ALIGN     FD_VM_HOST_REGION_ALIGN
-#define FD_VM_FOOTPRINT (527824UL)
+#define FD_VM_FOOTPRINT (527872UL)
 
 /* fd_vm_{align,footprint} give the needed alignment and footprint
    of a memory region suitable to hold an fd_vm_t.
@@ -336,6 +347,24 @@ fd_vm_delete( void * shmem );
 FD_FN_PURE int
 fd_vm_validate( fd_vm_t const * vm );
 
+/* fd_vm_fuse writes into fused[0,text_cnt) a copy of the validated sBPF
+   program text[0,text_cnt) for the given sbpf_version in which each
+   load (LDX{B,H,W,DW}) immediately followed by a 64-bit JEQ / JNE
+   branch has its opcode replaced by a fused superinstruction.  The
+   interpreter executes such a pair with a single dispatch.  All other
+   words (including the branch word of a fused pair, which the fused
+   handler decodes itself) are copied verbatim such that branches into
+   the middle of a pair, faults, ic and cu are identical to running
+   text.  Returns the number of pairs fused.  fused and text should not
+   overlap.  The result can be installed in vm->fused_text after
+   fd_vm_init. */
+
+ulong
+fd_vm_fuse( ulong *       fused,
+            ulong const * text,
+            ulong         text_cnt,
+            ulong         sbpf_version );
+
 /* fd_vm_is_check_align_enabled returns 1 if the vm should check alignment
    when doing memory translation. */
 FD_FN_PURE static inline int
@@ -452,7 +481,14 @@ fd_vm_is_check_size_enabled( fd_vm_t const * vm ) {
 
    fd_vm_exec_trace runs with tracing and requires vm to be attached to
    a trace.  fd_vm_exec_notrace runs without without tracing even if vm
-   is attached to a trace. */
+   is attached to a trace.
+
+   fd_vm_exec_prof runs without tracing and records the execution into
+   the profile vm is attached to (see fd_vm_prof_t), requiring vm to be
+   attached to a profile.  Sampled executions run an instrumented
+   interpreter that additionally records per-syscall and per-pc bucket
+   ticks and compute units.  Execution results are identical to
+   fd_vm_exec_notrace. */
 
 int
 fd_vm_exec_trace( fd_vm_t * vm );
@@ -460,10 +496,14 @@ fd_vm_exec_trace( fd_vm_t * vm );
 int
 fd_vm_exec_notrace( fd_vm_t * vm );
 
+int
+fd_vm_exec_prof( fd_vm_t * vm );
+
 static inline int
 fd_vm_exec( fd_vm_t * vm ) {
-  if( FD_UNLIKELY( vm->trace ) ) return fd_vm_exec_trace  ( vm );
-  else                           return fd_vm_exec_notrace( vm );
+  if     ( FD_UNLIKELY( vm->trace ) ) return fd_vm_exec_trace  ( vm );
+  else if( FD_UNLIKELY( vm->prof  ) ) return fd_vm_exec_prof   ( vm );
+  else                                return fd_vm_exec_notrace( vm );
 }
 
 FD_PROTOTYPES_END
@@ -173,6 +173,12 @@ FD_PROTOTYPES_END
 #define FD_VM_MEM_MAP_REGION_MASK           (~FD_VM_MEM_MAP_REGION_SZ)
 #define FD_VM_MEM_MAP_REGION_VIRT_ADDR_BITS (32)
 
+/* FD_VM_INPUT_TLB_CNT is the number of recently used input memory
+   regions remembered by a vm.  Programs typically bounce between a
+   handful of accounts, so a small power of 2 suffices. */
+
+#define FD_VM_INPUT_TLB_CNT (4UL)
+
 /* VM compute budget.  Note: these names should match exactly the names
    used in existing Solana validator.  See:
    https://github.com/anza-xyz/agave/blob/v1.18.5/program-runtime/src/compute_budget.rs#L19
@@ -669,6 +675,151 @@ int
 fd_vm_trace_printf( fd_vm_trace_t      const * trace,
                     fd_sbpf_syscalls_t const * syscalls );
 
+/* fd_vm_prof API *****************************************************/
+
+/* A fd_vm_prof_t is a low overhead sampling profiler for sBPF program
+   execution.  It aggregates the rdtsc ticks and compute units spent
+   per (program id, kind, id) in a fixed size hash table that can live
+   in shared memory:
+
+     FD_VM_PROF_KIND_PROG     id 0, whole fd_vm_exec of the program
+                              (inclusive of syscalls and CPIs)
+     FD_VM_PROF_KIND_SYSCALL  id is the syscall's hash (the call imm)
+     FD_VM_PROF_KIND_PC       id is pc>>FD_VM_PROF_PC_BUCKET_LG, for the
+                              linear segments starting in that text
+                              bucket (cu is the segment instructions)
+
+   PROG is recorded for every execution.  Only 1 in 2^sample_lg
+   executions run an instrumented interpreter that records SYSCALL and
+   PC (the others run the regular interpreter, such that profiling does
+   not perturb their timing).  So SYSCALL and PC totals should be scaled
+   by 2^sample_lg to compare them with PROG totals.
+
+   A prof has a single writer (e.g. the exec tile running the vm).
+   Readers (e.g. fddev vm-prof) can inspect the slots concurrently;
+   values of a slot might be torn but are monotonically increasing.
+   When the table is full, new keys are dropped (counted in drop_cnt). */
+
+#define FD_VM_PROF_KIND_PROG    (0)
+#define FD_VM_PROF_KIND_SYSCALL (1)
+#define FD_VM_PROF_KIND_PC      (2)
+
+#define FD_VM_PROF_PC_BUCKET_LG (6)    /* 64 text words per pc bucket */
+#define FD_VM_PROF_PROBE_MAX    (64UL) /* Max linear probing before a key is dropped */
+
+#define FD_VM_PROF_MAGIC (0xfdc377a9f0f11e00UL) /* FD VM PROF MAGIC version 0 */
+
+struct fd_vm_prof_slot {
+  uchar program_id[ 32 ]; /* Program id (all zeros if unknown) */
+  ulong tag;              /* fd_vm_prof_tag( kind, id ) */
+  ulong cnt;              /* Number of records, 0 if the slot is free */
+  ulong ticks;            /* Sum of fd_tickcount ticks */
+  ulong cu;               /* Sum of compute units */
+};
+
+typedef struct fd_vm_prof_slot fd_vm_prof_slot_t;
+
+struct __attribute__((aligned(64UL))) fd_vm_prof {
+  ulong magic;      /* ==FD_VM_PROF_MAGIC */
+  ulong slot_max;   /* Number of slots, a power of 2 */
+  ulong sample_lg;  /* 1 in 2^sample_lg executions are sampled */
+  ulong exec_cnt;   /* Number of executions */
+  ulong sample_cnt; /* Number of sampled executions */
+  ulong slot_cnt;   /* Number of used slots */
+  ulong drop_cnt;   /* Number of records dropped because the table was full */
+  ulong reserved;
+  /* This point is aligned 64
+     slot_max fd_vm_prof_slot_t */
+};
+
+typedef struct fd_vm_prof fd_vm_prof_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* prof object structors.  Usual conventions.  slot_max must be a power
+   of 2 in [1,2^32].  sample_lg must be in [0,63]. */
+
+FD_FN_CONST ulong
+fd_vm_prof_align( void );
+
+FD_FN_CONST ulong
+fd_vm_prof_footprint( ulong slot_max );
+
+void *
+fd_vm_prof_new( void * shmem,
+                ulong  slot_max,
+                ulong  sample_lg );
+
+fd_vm_prof_t *
+fd_vm_prof_join( void * _prof );
+
+void *
+fd_vm_prof_leave( fd_vm_prof_t * prof );
+
+void *
+fd_vm_prof_delete( void * _prof );
+
+/* fd_vm_prof_slot returns the location in the caller's address space
+   of the prof slots, indexed [0,slot_max).  Free slots have cnt==0. */
+
+FD_FN_CONST static inline fd_vm_prof_slot_t *
+fd_vm_prof_slot( fd_vm_prof_t * prof ) {
+  return (fd_vm_prof_slot_t *)(prof+1);
+}
+
+FD_FN_CONST static inline fd_vm_prof_slot_t const *
+fd_vm_prof_slot_const( fd_vm_prof_t const * prof ) {
+  return (fd_vm_prof_slot_t const *)(prof+1);
+}
+
+/* fd_vm_prof_tag packs a (kind,id) tuple, id in [0,2^56).
+   fd_vm_prof_tag_{kind,id} unpack it. */
+
+FD_FN_CONST static inline ulong fd_vm_prof_tag     ( int kind, ulong id ) { return (((ulong)kind)<<56) | (id & ((1UL<<56)-1UL)); }
+FD_FN_CONST static inline int   fd_vm_prof_tag_kind( ulong tag          ) { return (int)(tag>>56);                              }
+FD_FN_CONST static inline ulong fd_vm_prof_tag_id  ( ulong tag          ) { return tag & ((1UL<<56)-1UL);                       }
+
+/* fd_vm_prof_sample counts an execution and returns 1 if it should be
+   sampled (i.e. run with the instrumented interpreter) and 0 if not. */
+
+static inline int
+fd_vm_prof_sample( fd_vm_prof_t * prof ) {
+  ulong exec_cnt = prof->exec_cnt;
+  prof->exec_cnt = exec_cnt + 1UL;
+  int sample = !( exec_cnt & ((1UL<<prof->sample_lg)-1UL) );
+  prof->sample_cnt += (ulong)sample;
+  return sample;
+}
+
+/* fd_vm_prof_record adds ticks and cu to the slot of key (program_id,
+   kind, id), creating it if needed.  program_id points to 32 bytes or
+   is NULL (all zeros).  Returns the slot or NULL if the table was full
+   (the record is dropped). */
+
+fd_vm_prof_slot_t *
+fd_vm_prof_record( fd_vm_prof_t * prof,
+                   uchar const *  program_id,
+                   int            kind,
+                   ulong          id,
+                   ulong          ticks,
+                   ulong          cu );
+
+/* fd_vm_prof_merge adds all slots of src into dst (e.g. to aggregate
+   the profiles of multiple exec tiles).  Returns dst. */
+
+fd_vm_prof_t *
+fd_vm_prof_merge( fd_vm_prof_t *       dst,
+                  fd_vm_prof_t const * src );
+
+/* fd_vm_prof_reset frees all slots and zeros all counters.  Returns
+   FD_VM_SUCCESS (0) on success or FD_VM_ERR code (negative) on failure.
+   Reasons for failure include NULL prof. */
+
+int
+fd_vm_prof_reset( fd_vm_prof_t * prof );
+
+FD_PROTOTYPES_END
+
 /* fd_vm_syscall API **************************************************/
 
 /* FIXME: fd_sbpf_syscalls_t and fd_sbpf_syscall_func_t probably should
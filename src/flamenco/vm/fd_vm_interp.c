@@ -15,7 +15,8 @@ fd_vm_exec_notrace( fd_vm_t * vm ) {
   /* Pull out variables needed for the fd_vm_interp_core template */
   ulong frame_max   = FD_VM_STACK_FRAME_MAX; /* FIXME: vm->frame_max to make this run-time configured */
 
-  ulong const * FD_RESTRICT text          = vm->text;
+  int                       text_fused    = !!vm->fused_text;
+  ulong const * FD_RESTRICT text          = text_fused ? vm->fused_text : vm->text;
   ulong                     text_cnt      = vm->text_cnt;
   ulong                     entry_pc      = vm->entry_pc;
   ulong const * FD_RESTRICT calldests     = vm->calldests;
@@ -72,3 +73,67 @@ fd_vm_exec_trace( fd_vm_t * vm ) {
 
   return err;
 }
+
+/* fd_vm_exec_prof_sample is fd_vm_exec_notrace instrumented with the
+   profiler hooks of fd_vm_interp_core. */
+
+static int
+fd_vm_exec_prof_sample( fd_vm_t * vm ) {
+
+# undef  FD_VM_INTERP_EXE_TRACING_ENABLED
+# undef  FD_VM_INTERP_MEM_TRACING_ENABLED
+# define FD_VM_INTERP_PROF_ENABLED 1
+
+  /* Pull out variables needed for the fd_vm_interp_core template */
+  ulong frame_max   = FD_VM_STACK_FRAME_MAX; /* FIXME: vm->frame_max to make this run-time configured */
+
+  int                       text_fused    = !!vm->fused_text;
+  ulong const * FD_RESTRICT text          = text_fused ? vm->fused_text : vm->text;
+  ulong                     text_cnt      = vm->text_cnt;
+  ulong                     entry_pc      = vm->entry_pc;
+  ulong const * FD_RESTRICT calldests     = vm->calldests;
+
+  fd_sbpf_syscalls_t const * FD_RESTRICT syscalls = vm->syscalls;
+
+  ulong const * FD_RESTRICT region_haddr = vm->region_haddr;
+  uint  const * FD_RESTRICT region_ld_sz = vm->region_ld_sz;
+  uint  const * FD_RESTRICT region_st_sz = vm->region_st_sz;
+
+  ulong * FD_RESTRICT reg = vm->reg;
+
+  fd_vm_shadow_t * FD_RESTRICT shadow = vm->shadow;
+
+  fd_vm_prof_t * prof      = vm->prof;
+  uchar const *  prof_id   = vm->prof_program_id;
+  long           prof_tick = fd_tickcount();
+
+  int err = FD_VM_SUCCESS;
+
+  /* Run the VM */
+# include "fd_vm_interp_core.c"
+
+# undef FD_VM_INTERP_PROF_ENABLED
+
+  return err;
+}
+
+int
+fd_vm_exec_prof( fd_vm_t * vm ) {
+  fd_vm_prof_t * prof = vm->prof;
+  if( FD_UNLIKELY( !prof ) ) return FD_VM_ERR_INVAL;
+
+  /* Note: PROG ticks and cu include the time and compute units spent
+     in syscalls and nested (CPI) executions. */
+
+  uchar const * prof_id = vm->prof_program_id;
+  int           sample  = fd_vm_prof_sample( prof );
+  ulong         cu0     = vm->cu;
+  long          tick0   = fd_tickcount();
+
+  int err = sample ? fd_vm_exec_prof_sample( vm ) : fd_vm_exec_notrace( vm );
+
+  long tick1 = fd_tickcount();
+  fd_vm_prof_record( prof, prof_id, FD_VM_PROF_KIND_PROG, 0UL, (ulong)(tick1-tick0), cu0 - fd_ulong_min( vm->cu, cu0 ) );
+
+  return err;
+}
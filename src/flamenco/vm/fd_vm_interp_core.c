@@ -19,9 +19,15 @@
 # pragma clang diagnostic ignored "-Wgnu-label-as-value"
 # endif
 
-  /* Include the jump table */
+  /* Include the jump table (and, when not tracing, the jump table for
+     running a fused text stream) */
 
 # include "fd_vm_interp_jump_table.c"
+# ifndef FD_VM_INTERP_EXE_TRACING_ENABLED
+# define FD_VM_INTERP_JUMP_TABLE_FUSED 1
+# include "fd_vm_interp_jump_table.c"
+# undef FD_VM_INTERP_JUMP_TABLE_FUSED
+# endif
 
   /* Update the jump table based on SBPF version */
 
@@ -34,7 +40,42 @@
   ulong cu        = vm->cu;
   ulong frame_cnt = vm->frame_cnt;
 
+# ifndef FD_VM_INTERP_EXE_TRACING_ENABLED
+  void const * const * const version_interp_jump_table = text_fused ? interp_jump_table_fused[ sbpf_version ]
+                                                                    : interp_jump_table      [ sbpf_version ];
+# else
   void const * const * const version_interp_jump_table = interp_jump_table[ sbpf_version ];
+# endif
+
+  /* FD_VM_INTERP_MEM_HADDR is fd_vm_mem_haddr specialized for the
+     interpreter's loads and stores.  Regions that map to a single flat
+     host range (everything but the input region and, when stack frames
+     have gaps, the stack region) are translated inline with the region
+     arrays already in registers.  The bits of mem_fast_region are these
+     regions.  The remaining accesses take the generic path (which
+     handles the input region tlb, stack gaps and tracing).  Returns
+     haddr on success and 0 on failure. */
+
+# ifdef FD_VM_INTERP_MEM_TRACING_ENABLED
+  ulong const mem_fast_region = 0UL;
+# else
+  ulong const mem_fast_region = (1UL<<FD_VM_LO_REGION) | (1UL<<FD_VM_PROG_REGION) | (1UL<<FD_VM_HEAP_REGION) | (1UL<<FD_VM_HIGH_REGION) |
+                                ((ulong)fd_sbpf_dynamic_stack_frames_enabled( sbpf_version )<<FD_VM_STACK_REGION);
+# endif
+
+# define FD_VM_INTERP_MEM_HADDR( vaddr, sz, region_sz, write ) (__extension__({                    \
+    ulong _vaddr  = (vaddr);                                                                      \
+    ulong _region = FD_VADDR_TO_REGION( _vaddr );                                                 \
+    ulong _haddr;                                                                                 \
+    if( FD_LIKELY( fd_ulong_extract_bit( mem_fast_region, (int)_region ) ) ) {                     \
+      ulong _offset = _vaddr & FD_VM_OFFSET_MASK;                                                 \
+      ulong _sz     = (ulong)region_sz[ _region ];                                                \
+      _haddr = fd_ulong_if( (sz)<=_sz-fd_ulong_min( _offset, _sz ), region_haddr[ _region ]+_offset, 0UL ); \
+    } else {                                                                                      \
+      _haddr = fd_vm_mem_haddr( vm, _vaddr, (sz), region_haddr, region_sz, (write), 0UL );        \
+    }                                                                                             \
+    _haddr;                                                                                       \
+  }))
 
   /* FD_VM_INTERP_INSTR_EXEC loads the first word of the instruction at
      pc, parses it, fetches the associated register values and then
@@ -143,6 +184,36 @@
    At this point, cu is positive and err is clear.
 */
 
+/* FD_VM_INTERP_PROF_{SEGMENT,SYSCALL_BEGIN,SYSCALL_END} are the hooks
+   of the sampling profiler (see fd_vm_exec_prof).  They are only
+   non-empty in the profiling instance of this template, where the
+   caller provides prof, prof_id and prof_tick (the tickcount at the end
+   of the previous profiled event).  SEGMENT is run when the linear text
+   segment starting at pc0 has been billed ic_correction cu, SYSCALL_*
+   bracket the syscall with hash imm. */
+
+# ifdef FD_VM_INTERP_PROF_ENABLED
+# define FD_VM_INTERP_PROF_SEGMENT                                                      \
+  do {                                                                                  \
+    long prof_now = fd_tickcount();                                                     \
+    fd_vm_prof_record( prof, prof_id, FD_VM_PROF_KIND_PC, pc0>>FD_VM_PROF_PC_BUCKET_LG, \
+                       (ulong)(prof_now-prof_tick), ic_correction );                    \
+    prof_tick = prof_now;                                                               \
+  } while(0)
+# define FD_VM_INTERP_PROF_SYSCALL_BEGIN ulong prof_cu = cu
+# define FD_VM_INTERP_PROF_SYSCALL_END                                                  \
+  do {                                                                                  \
+    long prof_now = fd_tickcount();                                                     \
+    fd_vm_prof_record( prof, prof_id, FD_VM_PROF_KIND_SYSCALL, (ulong)imm,              \
+                       (ulong)(prof_now-prof_tick), prof_cu-cu );                       \
+    prof_tick = prof_now;                                                               \
+  } while(0)
+# else
+# define FD_VM_INTERP_PROF_SEGMENT       do {} while(0)
+# define FD_VM_INTERP_PROF_SYSCALL_BEGIN do {} while(0)
+# define FD_VM_INTERP_PROF_SYSCALL_END   do {} while(0)
+# endif
+
 # if FD_HAS_FLATCC
 # define FD_VM_INTERP_SYSCALL_EXEC_DUMP                                       \
   /* Dumping for debugging purposes */                                        \
@@ -160,12 +231,14 @@
   vm->frame_cnt = frame_cnt;                                                  \
   FD_VM_INTERP_SYSCALL_EXEC_DUMP                                              \
   /* Execution */                                                             \
+  FD_VM_INTERP_PROF_SYSCALL_BEGIN;                                            \
   ulong ret[1];                                                               \
   err = syscall->func( vm, reg[1], reg[2], reg[3], reg[4], reg[5], ret );     \
   reg[0] = ret[0];                                                            \
   /* Error handling */                                                        \
   ulong cu_req = vm->cu;                                                      \
   cu = fd_ulong_min( cu_req, cu );                                            \
+  FD_VM_INTERP_PROF_SYSCALL_END;                                              \
   if( FD_UNLIKELY( err ) ) {                                                  \
     if( err==FD_VM_SYSCALL_ERR_COMPUTE_BUDGET_EXCEEDED ) cu = 0UL; /* cmov */ \
     FD_VM_TEST_ERR_EXISTS( vm );                                              \
@@ -229,6 +302,7 @@
     if( FD_UNLIKELY( ic_correction>cu ) ) goto sigcost; /* Note: untaken branches don't consume BTB */  \
     cu -= ic_correction;                                                                                \
     /* At this point, cu>=0 */                                                                          \
+    FD_VM_INTERP_PROF_SEGMENT;                                                                          \
     ic_correction = 0UL;
 
   /* FIXME: debatable if it is better to do pc++ here or have the
@@ -384,7 +458,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x27) { /* FD_SBPF_OP_STB */
     ulong vaddr = reg_dst + offset;
-    ulong haddr = fd_vm_mem_haddr( vm, vaddr, sizeof(uchar), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(uchar), region_st_sz, 1 );
     if( FD_UNLIKELY( !haddr ) ) {
       vm->segv_vaddr       = vaddr;
       vm->segv_access_type = FD_VM_ACCESS_TYPE_ST;
@@ -397,7 +471,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x2c) { /* FD_SBPF_OP_LDXB */
     ulong vaddr = reg_src + offset;
-    ulong haddr = fd_vm_mem_haddr( vm, vaddr, sizeof(uchar), region_haddr, region_ld_sz, 0, 0UL );
+    ulong haddr = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(uchar), region_ld_sz, 0 );
     if( FD_UNLIKELY( !haddr ) ) {
       vm->segv_vaddr       = vaddr;
       vm->segv_access_type = FD_VM_ACCESS_TYPE_LD;
@@ -414,7 +488,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x2f) { /* FD_SBPF_OP_STXB */
     ulong vaddr = reg_dst + offset;
-    ulong haddr = fd_vm_mem_haddr( vm, vaddr, sizeof(uchar), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(uchar), region_st_sz, 1 );
     if( FD_UNLIKELY( !haddr ) ) {
       vm->segv_vaddr       = vaddr;
       vm->segv_access_type = FD_VM_ACCESS_TYPE_ST;
@@ -455,7 +529,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x37) { /* FD_SBPF_OP_STH */
     ulong vaddr   = reg_dst + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(ushort), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(ushort), region_st_sz, 1 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -469,7 +543,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x3c) { /* FD_SBPF_OP_LDXH */
     ulong vaddr   = reg_src + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(ushort), region_haddr, region_ld_sz, 0, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(ushort), region_ld_sz, 0 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -487,7 +561,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x3f) { /* FD_SBPF_OP_STXH */
     ulong vaddr   = reg_dst + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(ushort), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(ushort), region_st_sz, 1 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -738,7 +812,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x87) { /* FD_SBPF_OP_STW */
     ulong vaddr   = reg_dst + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(uint), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(uint), region_st_sz, 1 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -755,7 +829,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x8c) { /* FD_SBPF_OP_LDXW */
     ulong vaddr   = reg_src + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(uint), region_haddr, region_ld_sz, 0, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(uint), region_ld_sz, 0 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -802,7 +876,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x8f) { /* FD_SBPF_OP_STXW */
     ulong vaddr    = reg_dst + offset;
-    ulong haddr    = fd_vm_mem_haddr( vm, vaddr, sizeof(uint), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr    = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(uint), region_st_sz, 1 );
     int   sigsegv  = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -835,7 +909,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x97) { /* FD_SBPF_OP_STQ */
     ulong vaddr   = reg_dst + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(ulong), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(ulong), region_st_sz, 1 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -849,7 +923,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x9c) { /* FD_SBPF_OP_LDXQ */
     ulong vaddr   = reg_src + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(ulong), region_haddr, region_ld_sz, 0, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(ulong), region_ld_sz, 0 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -883,7 +957,7 @@ interp_exec:
 
   FD_VM_INTERP_INSTR_BEGIN(0x9f) { /* FD_SBPF_OP_STXQ */
     ulong vaddr   = reg_dst + offset;
-    ulong haddr   = fd_vm_mem_haddr( vm, vaddr, sizeof(ulong), region_haddr, region_st_sz, 1, 0UL );
+    ulong haddr   = FD_VM_INTERP_MEM_HADDR( vaddr, sizeof(ulong), region_st_sz, 1 );
     int   sigsegv = !haddr;
     if( FD_UNLIKELY( sigsegv ) ) {
       vm->segv_vaddr       = vaddr;
@@ -1079,6 +1153,63 @@ interp_exec:
     reg[ dst ] = (ulong)( (long)reg_dst % (long)reg_src );
   FD_VM_INTERP_INSTR_END;
 
+  /* Fused superinstructions ******************************************/
+
+  /* FD_VM_INTERP_FUSED_LDX_JCC implements a FD_VM_FUSED_LDX_JCC opcode
+     produced by fd_vm_fuse.  It executes the load exactly like the
+     plain ldx (pc stays at the load on a fault such that the fault
+     accounting is unchanged), then steps to the branch word (which is
+     not modified in the fused stream), unpacks it and jumps directly
+     into the branch's implementation.  This replaces the indirect
+     dispatch between the two with a direct one.  The branch
+     implementation bills the whole linear segment (including the load)
+     as usual so ic and cu are identical to the unfused stream. */
+
+# ifndef FD_VM_INTERP_EXE_TRACING_ENABLED
+
+# define FD_VM_INTERP_FUSED_LDX_JCC( opcode, sz, ld, jcc_opcode )                                  \
+  interp_##opcode: {                                                                              \
+    ulong vaddr = reg_src + offset;                                                               \
+    ulong haddr = FD_VM_INTERP_MEM_HADDR( vaddr, (sz), region_ld_sz, 0 );                         \
+    if( FD_UNLIKELY( !haddr ) ) {                                                                 \
+      vm->segv_vaddr       = vaddr;                                                               \
+      vm->segv_access_type = FD_VM_ACCESS_TYPE_LD;                                                \
+      vm->segv_access_len  = (sz);                                                                \
+      goto sigsegv; /* Note: untaken branches don't consume BTB */                                \
+    }                                                                                             \
+    reg[ dst ] = (ulong)ld( haddr );                                                              \
+  }                                                                                               \
+  pc++;                                 /* Guaranteed in-bounds by fd_vm_fuse */                  \
+  instr   = text[ pc ];                                                                           \
+  dst     = fd_vm_instr_dst   ( instr );                                                          \
+  src     = fd_vm_instr_src   ( instr );                                                          \
+  offset  = fd_vm_instr_offset( instr );                                                          \
+  imm     = fd_vm_instr_imm   ( instr );                                                          \
+  reg_dst = reg[ dst ];                                                                           \
+  reg_src = reg[ src ];                                                                           \
+  goto interp_##jcc_opcode
+
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xe0, 1UL, fd_vm_mem_ld_1, 0x15 ); /* LDXB  + JEQ_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xe1, 1UL, fd_vm_mem_ld_1, 0x55 ); /* LDXB  + JNE_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xe2, 1UL, fd_vm_mem_ld_1, 0x1d ); /* LDXB  + JEQ_REG */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xe3, 1UL, fd_vm_mem_ld_1, 0x5d ); /* LDXB  + JNE_REG */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xe8, 2UL, fd_vm_mem_ld_2, 0x15 ); /* LDXH  + JEQ_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xe9, 2UL, fd_vm_mem_ld_2, 0x55 ); /* LDXH  + JNE_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xea, 2UL, fd_vm_mem_ld_2, 0x1d ); /* LDXH  + JEQ_REG */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xeb, 2UL, fd_vm_mem_ld_2, 0x5d ); /* LDXH  + JNE_REG */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xf0, 4UL, fd_vm_mem_ld_4, 0x15 ); /* LDXW  + JEQ_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xf1, 4UL, fd_vm_mem_ld_4, 0x55 ); /* LDXW  + JNE_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xf2, 4UL, fd_vm_mem_ld_4, 0x1d ); /* LDXW  + JEQ_REG */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xf3, 4UL, fd_vm_mem_ld_4, 0x5d ); /* LDXW  + JNE_REG */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xf8, 8UL, fd_vm_mem_ld_8, 0x15 ); /* LDXDW + JEQ_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xf9, 8UL, fd_vm_mem_ld_8, 0x55 ); /* LDXDW + JNE_IMM */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xfa, 8UL, fd_vm_mem_ld_8, 0x1d ); /* LDXDW + JEQ_REG */
+  FD_VM_INTERP_FUSED_LDX_JCC( 0xfb, 8UL, fd_vm_mem_ld_8, 0x5d ); /* LDXDW + JNE_REG */
+
+# undef FD_VM_INTERP_FUSED_LDX_JCC
+
+# endif
+
   /* FIXME: sigbus/sigrdonly are mapped to sigsegv for simplicity
      currently but could be enabled if desired. */
 
@@ -1137,12 +1268,17 @@ interp_halt:
 
 # undef FD_VM_INTERP_STACK_PUSH
 
+# undef FD_VM_INTERP_PROF_SYSCALL_END
+# undef FD_VM_INTERP_PROF_SYSCALL_BEGIN
+# undef FD_VM_INTERP_PROF_SEGMENT
+
 # undef FD_VM_INTERP_BRANCH_END
 # undef FD_VM_INTERP_BRANCH_BEGIN
 
 # undef FD_VM_INTERP_INSTR_END
 # undef FD_VM_INTERP_INSTR_BEGIN
 # undef FD_VM_INTERP_INSTR_EXEC
+# undef FD_VM_INTERP_MEM_HADDR
 
 # if defined(__clang__)
 # pragma clang diagnostic pop
@@ -1,8 +1,21 @@
   /* interp_jump_table holds the sBPF interpreter jump table.  It is an
      array where each index is an opcode that can be jumped to be
-     executed.  Invalid opcodes branch to the sigill label. */
+     executed.  Invalid opcodes branch to the sigill label.
+
+     When FD_VM_INTERP_JUMP_TABLE_FUSED is defined, this instead defines
+     interp_jump_table_fused, the table used to run a text stream
+     produced by fd_vm_fuse.  It is identical except the
+     FD_VM_FUSED_LDX_JCC opcodes (illegal in every sBPF version) branch
+     to their fused handlers. */
 #include "../../ballet/sbpf/fd_sbpf_loader.h"
 #   define OPCODE(opcode) interp_##opcode
+#   ifdef FD_VM_INTERP_JUMP_TABLE_FUSED
+#   define JUMP_TABLE interp_jump_table_fused
+#   define FUSED(op) ALL_OPCODE(op)
+#   else
+#   define JUMP_TABLE interp_jump_table
+#   define FUSED(op) ALL_ILLEGAL(op)
+#   endif
 #   define ALL_ILLEGAL(op) [0][op] = &&sigill,     [1][op] = &&sigill,     [2][op] = &&sigill,     [3][op] = &&sigill
 #   define ALL_OPCODE( op) [0][op] = &&OPCODE(op), [1][op] = &&OPCODE(op), [2][op] = &&OPCODE(op), [3][op] = &&OPCODE(op)
 #   define CONDITIONAL(op, C, ltrue, lfalse) \
@@ -11,7 +24,7 @@
                        [2][op] = C(2) ? (ltrue):(lfalse), \
                        [3][op] = C(3) ? (ltrue):(lfalse)
 
-  static void const * const interp_jump_table[ FD_SBPF_VERSION_COUNT ][ 256 ] = {
+  static void const * const JUMP_TABLE[ FD_SBPF_VERSION_COUNT ][ 256 ] = {
     /* First we start with the opcodes that are the same in all version
        of sBPF.  We leave gaps for the ones that depend on the version
        of sBPF, with the gap numbered based on the order they appear in
@@ -75,13 +88,13 @@
     /*    2 :  57  */  ALL_OPCODE (0xd5), /*   45 :  58  */  ALL_ILLEGAL(0xd7),
     ALL_ILLEGAL(0xd8), ALL_ILLEGAL(0xd9), ALL_ILLEGAL(0xda), ALL_ILLEGAL(0xdb),
     ALL_OPCODE (0xdc), ALL_OPCODE (0xdd), /*   46 :  59  */  ALL_ILLEGAL(0xdf),
-    ALL_ILLEGAL(0xe0), ALL_ILLEGAL(0xe1), ALL_ILLEGAL(0xe2), ALL_ILLEGAL(0xe3),
+    FUSED      (0xe0), FUSED      (0xe1), FUSED      (0xe2), FUSED      (0xe3),
     ALL_ILLEGAL(0xe4), ALL_ILLEGAL(0xe5), /*   47 :  60  */  ALL_ILLEGAL(0xe7),
-    ALL_ILLEGAL(0xe8), ALL_ILLEGAL(0xe9), ALL_ILLEGAL(0xea), ALL_ILLEGAL(0xeb),
+    FUSED      (0xe8), FUSED      (0xe9), FUSED      (0xea), FUSED      (0xeb),
     ALL_ILLEGAL(0xec), ALL_ILLEGAL(0xed), /*   48 :  61  */  ALL_ILLEGAL(0xef),
-    ALL_ILLEGAL(0xf0), ALL_ILLEGAL(0xf1), ALL_ILLEGAL(0xf2), ALL_ILLEGAL(0xf3),
+    FUSED      (0xf0), FUSED      (0xf1), FUSED      (0xf2), FUSED      (0xf3),
     ALL_ILLEGAL(0xf4), ALL_ILLEGAL(0xf5), /*   49 :  62  */  /*    1 :  63  */
-    ALL_ILLEGAL(0xf8), ALL_ILLEGAL(0xf9), ALL_ILLEGAL(0xfa), ALL_ILLEGAL(0xfb),
+    FUSED      (0xf8), FUSED      (0xf9), FUSED      (0xfa), FUSED      (0xfb),
     ALL_ILLEGAL(0xfc), ALL_ILLEGAL(0xfd), /*   50 :  64  */  ALL_ILLEGAL(0xff),
 
 
@@ -179,4 +192,6 @@
 #   undef ALL_OPCODE
 #   undef CONDITIONAL
 #   undef OPCODE
+#   undef FUSED
+#   undef JUMP_TABLE
   };
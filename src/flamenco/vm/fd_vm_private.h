@@ -188,6 +188,15 @@ FD_FN_CONST static inline ulong fd_vm_instr_src   ( ulong instr ) { return ((ins
 FD_FN_CONST static inline ulong fd_vm_instr_offset( ulong instr ) { return (ulong)(long)(short)(ushort)(instr>>16); }
 FD_FN_CONST static inline uint  fd_vm_instr_imm   ( ulong instr ) { return (uint)(instr>>32);          }
 
+/* FD_VM_FUSED_LDX_JCC gives the opcode fd_vm_fuse uses in a fused
+   text stream for a load (ldx in 0:B,1:H,2:W,3:DW) immediately
+   followed by a conditional branch (jcc in 0:JEQ_IMM,1:JNE_IMM,
+   2:JEQ_REG,3:JNE_REG).  These are in the 0xe0-0xfb range that is
+   illegal in all sBPF versions and only have meaning to the non-tracing
+   interpreter's fused jump table. */
+
+#define FD_VM_FUSED_LDX_JCC( ldx, jcc ) (0xe0UL + ((ldx)<<3) + (jcc))
+
 FD_FN_CONST static inline ulong fd_vm_instr_opclass       ( ulong instr ) { return  instr      & 7UL; } /* In [0,8)  */
 FD_FN_CONST static inline ulong fd_vm_instr_normal_opsrc  ( ulong instr ) { return (instr>>3) &  1UL; } /* In [0,2)  */
 FD_FN_CONST static inline ulong fd_vm_instr_normal_opmode ( ulong instr ) { return (instr>>4) & 15UL; } /* In [0,16) */
@@ -225,6 +234,8 @@ fd_vm_mem_cfg( fd_vm_t * vm ) {
     vm->region_ld_sz[FD_VM_INPUT_REGION] = vm->input_mem_regions[0].region_sz;
     vm->region_st_sz[FD_VM_INPUT_REGION] = vm->input_mem_regions[0].region_sz;
   }
+  for( ulong i=0UL; i<FD_VM_INPUT_TLB_CNT; i++ ) vm->input_tlb[ i ] = 0U;
+  vm->input_tlb_next = 0U;
   return vm;
 }
 
@@ -305,6 +316,44 @@ fd_vm_get_input_mem_region_idx( fd_vm_t const * vm, ulong offset ) {
   return left;
 }
 
+/* fd_vm_input_tlb_query returns the index of the input memory region
+   holding offset if it is one of the vm's recently translated regions
+   and ULONG_MAX otherwise.  Since input regions are contiguous and
+   strictly increasing, a hit is the same region that
+   fd_vm_get_input_mem_region_idx would have found.  Assumes
+   input_mem_regions_cnt>0. */
+
+static inline ulong
+fd_vm_input_tlb_query( fd_vm_t const * vm,
+                       ulong           offset ) {
+  fd_vm_input_region_t const * regions = vm->input_mem_regions;
+  ulong hit = ULONG_MAX;
+  for( ulong i=0UL; i<FD_VM_INPUT_TLB_CNT; i++ ) { /* branchless, at most one entry can match */
+    ulong idx = (ulong)vm->input_tlb[ i ];
+    hit = fd_ulong_if( offset-regions[ idx ].vaddr_offset<regions[ idx ].address_space_reserved, idx, hit );
+  }
+  return hit;
+}
+
+/* fd_vm_input_tlb_fill looks up the input memory region for offset
+   with a binary search and, if offset is actually inside that region,
+   remembers it in the vm's input tlb (replacing the oldest entry).
+   Returns the same index as fd_vm_get_input_mem_region_idx.  The tlb is
+   a cache and not part of the vm's logical state, hence the const vm. */
+
+static inline ulong
+fd_vm_input_tlb_fill( fd_vm_t const * vm,
+                      ulong           offset ) {
+  ulong region_idx = fd_vm_get_input_mem_region_idx( vm, offset );
+  fd_vm_input_region_t const * region = &vm->input_mem_regions[ region_idx ];
+  if( FD_LIKELY( offset-region->vaddr_offset<region->address_space_reserved ) ) {
+    fd_vm_t * _vm = (fd_vm_t *)vm;
+    _vm->input_tlb[ _vm->input_tlb_next ] = (uint)region_idx;
+    _vm->input_tlb_next = (uint)((_vm->input_tlb_next+1UL) & (FD_VM_INPUT_TLB_CNT-1UL));
+  }
+  return region_idx;
+}
+
 /* If the region is an account, handle the resizing logic. This logic
    corresponds to
    solana_transaction_context::TransactionContext::access_violation_handler
@@ -387,38 +436,34 @@ fd_vm_find_input_mem_region( fd_vm_t const * vm,
     return sentinel; /* Access is too large */
   }
 
-  /* Binary search to find the correct memory region.  If direct mapping is not
-     enabled, then there is only 1 memory region which spans the input region. */
-  ulong region_idx = fd_vm_get_input_mem_region_idx( vm, offset );
-  if( FD_UNLIKELY( region_idx>=vm->input_mem_regions_cnt ) ) {
-    return sentinel; /* Region not found */
-  }
+  /* Look up the region in the tlb of recently used regions and fall
+     back to a binary search on a miss.  If direct mapping is not
+     enabled, then there is only 1 memory region which spans the input
+     region. */
+  ulong region_idx = fd_vm_input_tlb_query( vm, offset );
+  if( FD_UNLIKELY( region_idx==ULONG_MAX ) ) region_idx = fd_vm_input_tlb_fill( vm, offset );
 
-  ulong bytes_in_region = fd_ulong_sat_sub( vm->input_mem_regions[ region_idx ].region_sz,
-                                            fd_ulong_sat_sub( offset, vm->input_mem_regions[ region_idx ].vaddr_offset ) );
+  fd_vm_input_region_t const * region = &vm->input_mem_regions[ region_idx ];
+  ulong region_off      = fd_ulong_sat_sub( offset, region->vaddr_offset );
+  ulong bytes_in_region = fd_ulong_sat_sub( region->region_sz, region_off );
 
   /* If the access is out of bounds, invoke the callback to handle the out of bounds access.
-     This potentially resizes the region if necessary. */
+     This potentially resizes the region if necessary.  After potentially
+     resizing, re-check the bounds and if the access is still out of
+     bounds, return the sentinel. */
   if( FD_UNLIKELY( sz>bytes_in_region ) ) {
     fd_vm_handle_input_mem_region_oob( vm, offset, sz, region_idx, write );
+    bytes_in_region = fd_ulong_sat_sub( region->region_sz, region_off );
+    if( FD_UNLIKELY( sz>bytes_in_region ) ) {
+      return sentinel;
+    }
   }
 
-  /* After potentially resizing, re-check the bounds */
-  bytes_in_region = fd_ulong_sat_sub( vm->input_mem_regions[ region_idx ].region_sz,
-                                      fd_ulong_sat_sub( offset, vm->input_mem_regions[ region_idx ].vaddr_offset ) );
-  /* If the access is still out of bounds, return the sentinel */
-  if( FD_UNLIKELY( sz>bytes_in_region ) ) {
-    return sentinel;
-  }
-
-  if( FD_UNLIKELY( write && vm->input_mem_regions[ region_idx ].is_writable==0U ) ) {
+  if( FD_UNLIKELY( write && region->is_writable==0U ) ) {
     return sentinel; /* Illegal write */
   }
 
-  ulong start_region_idx = region_idx;
-
-  ulong adjusted_haddr = vm->input_mem_regions[ start_region_idx ].haddr + offset - vm->input_mem_regions[ start_region_idx ].vaddr_offset;
-  return adjusted_haddr;
+  return region->haddr + offset - region->vaddr_offset;
 }
 
 
@@ -0,0 +1,209 @@
+#include "fd_vm.h"
+
+ulong
+fd_vm_prof_align( void ) {
+  return alignof(fd_vm_prof_t);
+}
+
+ulong
+fd_vm_prof_footprint( ulong slot_max ) {
+  if( FD_UNLIKELY( (!slot_max) | (slot_max>(1UL<<32)) | (!fd_ulong_is_pow2( slot_max )) ) ) return 0UL;
+  return sizeof(fd_vm_prof_t) + slot_max*sizeof(fd_vm_prof_slot_t);
+}
+
+void *
+fd_vm_prof_new( void * shmem,
+                ulong  slot_max,
+                ulong  sample_lg ) {
+  fd_vm_prof_t * prof = (fd_vm_prof_t *)shmem;
+
+  if( FD_UNLIKELY( !prof ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_vm_prof_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_vm_prof_footprint( slot_max );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad slot_max" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( sample_lg>63UL ) ) {
+    FD_LOG_WARNING(( "bad sample_lg" ));
+    return NULL;
+  }
+
+  memset( prof, 0, footprint );
+
+  prof->slot_max  = slot_max;
+  prof->sample_lg = sample_lg;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( prof->magic ) = FD_VM_PROF_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return prof;
+}
+
+fd_vm_prof_t *
+fd_vm_prof_join( void * _prof ) {
+  fd_vm_prof_t * prof = (fd_vm_prof_t *)_prof;
+
+  if( FD_UNLIKELY( !prof ) ) {
+    FD_LOG_WARNING(( "NULL _prof" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)_prof, fd_vm_prof_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned _prof" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( prof->magic!=FD_VM_PROF_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return prof;
+}
+
+void *
+fd_vm_prof_leave( fd_vm_prof_t * prof ) {
+
+  if( FD_UNLIKELY( !prof ) ) {
+    FD_LOG_WARNING(( "NULL prof" ));
+    return NULL;
+  }
+
+  return (void *)prof;
+}
+
+void *
+fd_vm_prof_delete( void * _prof ) {
+  fd_vm_prof_t * prof = (fd_vm_prof_t *)_prof;
+
+  if( FD_UNLIKELY( !prof ) ) {
+    FD_LOG_WARNING(( "NULL _prof" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)_prof, fd_vm_prof_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned _prof" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( prof->magic!=FD_VM_PROF_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( prof->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return (void *)prof;
+}
+
+static uchar const fd_vm_prof_zero_id[ 32 ] = {0};
+
+/* fd_vm_prof_acquire returns the slot for key (program_id,tag),
+   inserting it if needed, or NULL if the key is not in the table and
+   there is no free slot within FD_VM_PROF_PROBE_MAX probes. */
+
+static fd_vm_prof_slot_t *
+fd_vm_prof_acquire( fd_vm_prof_t * prof,
+                    uchar const *  program_id,
+                    ulong          tag ) {
+  fd_vm_prof_slot_t * slot = fd_vm_prof_slot( prof );
+  ulong               mask = prof->slot_max - 1UL;
+
+  ulong hash = fd_ulong_hash( tag ^ FD_LOAD( ulong, program_id ) ^ FD_LOAD( ulong, program_id+24 ) );
+
+  ulong probe_max = fd_ulong_min( prof->slot_max, FD_VM_PROF_PROBE_MAX );
+  for( ulong probe=0UL; probe<probe_max; probe++ ) {
+    fd_vm_prof_slot_t * s = slot + ((hash+probe) & mask);
+    if( FD_LIKELY( s->cnt ) ) {
+      if( FD_LIKELY( (s->tag==tag) && !memcmp( s->program_id, program_id, 32UL ) ) ) return s;
+      continue;
+    }
+    /* Free slot.  Set the key before marking the slot used (cnt!=0)
+       such that concurrent readers never see a used slot with a stale
+       key. */
+    memcpy( s->program_id, program_id, 32UL );
+    s->tag   = tag;
+    s->ticks = 0UL;
+    s->cu    = 0UL;
+    prof->slot_cnt++;
+    return s;
+  }
+
+  return NULL;
+}
+
+fd_vm_prof_slot_t *
+fd_vm_prof_record( fd_vm_prof_t * prof,
+                   uchar const *  program_id,
+                   int            kind,
+                   ulong          id,
+                   ulong          ticks,
+                   ulong          cu ) {
+  if( !program_id ) program_id = fd_vm_prof_zero_id;
+
+  fd_vm_prof_slot_t * s = fd_vm_prof_acquire( prof, program_id, fd_vm_prof_tag( kind, id ) );
+  if( FD_UNLIKELY( !s ) ) {
+    prof->drop_cnt++;
+    return NULL;
+  }
+
+  s->ticks += ticks;
+  s->cu    += cu;
+  FD_COMPILER_MFENCE();
+  s->cnt++;
+
+  return s;
+}
+
+fd_vm_prof_t *
+fd_vm_prof_merge( fd_vm_prof_t *       dst,
+                  fd_vm_prof_t const * src ) {
+  fd_vm_prof_slot_t const * slot     = fd_vm_prof_slot_const( src );
+  ulong                     slot_max = src->slot_max;
+
+  for( ulong slot_idx=0UL; slot_idx<slot_max; slot_idx++ ) {
+    fd_vm_prof_slot_t const * s = slot + slot_idx;
+    ulong cnt = FD_VOLATILE_CONST( s->cnt );
+    if( !cnt ) continue;
+    fd_vm_prof_slot_t * d = fd_vm_prof_acquire( dst, s->program_id, s->tag );
+    if( FD_UNLIKELY( !d ) ) {
+      dst->drop_cnt += cnt;
+      continue;
+    }
+    d->ticks += s->ticks;
+    d->cu    += s->cu;
+    d->cnt   += cnt;
+  }
+
+  dst->exec_cnt   += src->exec_cnt;
+  dst->sample_cnt += src->sample_cnt;
+  dst->drop_cnt   += src->drop_cnt;
+
+  return dst;
+}
+
+int
+fd_vm_prof_reset( fd_vm_prof_t * prof ) {
+  if( FD_UNLIKELY( !prof ) ) return FD_VM_ERR_INVAL;
+
+  memset( fd_vm_prof_slot( prof ), 0, prof->slot_max*sizeof(fd_vm_prof_slot_t) );
+  prof->exec_cnt   = 0UL;
+  prof->sample_cnt = 0UL;
+  prof->slot_cnt   = 0UL;
+  prof->drop_cnt   = 0UL;
+
+  return FD_VM_SUCCESS;
+}
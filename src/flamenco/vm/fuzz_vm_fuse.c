@@ -0,0 +1,170 @@
+#if !FD_HAS_HOSTED
+#error "This target requires FD_HAS_HOSTED"
+#endif
+
+#include "../../util/sanitize/fd_fuzz.h"
+#include "fd_vm_private.h"
+
+#include <stdlib.h>
+
+/* fuzz_vm_fuse runs a fuzzer generated program once as is and once
+   with the fd_vm_fuse stream installed, and checks that both runs end
+   with the same result, registers, pc, ic, cu and input memory.
+
+   Input layout:
+     data[0]                sbpf version (mod FD_SBPF_V3+1)
+     data[1]                input region size in bytes (input_sz)
+     data[2,2+input_sz)     input region contents
+     data[2+input_sz,size)  program text, one sBPF word per 8 bytes */
+
+#define TEXT_MAX  (1024UL)
+#define ENTRY_CU  (10000UL)
+
+static fd_vm_t _vm[1];
+
+static ulong text    [ TEXT_MAX ];
+static ulong fused   [ TEXT_MAX ];
+static uchar input   [ 2UL ][ 256UL ];
+static uchar calldests_mem[ 4096UL ] __attribute__((aligned(64)));
+static uchar syscalls_mem [ 1UL<<20  ] __attribute__((aligned(64)));
+
+int
+LLVMFuzzerInitialize( int  *   argc,
+                      char *** argv ) {
+  /* Set up shell without signal handlers */
+  putenv( "FD_LOG_BACKTRACE=0" );
+  fd_boot( argc, argv );
+  atexit( fd_halt );
+  fd_log_level_core_set(3); /* crash on warning log */
+
+  FD_TEST( fd_sbpf_calldests_footprint( TEXT_MAX )<=sizeof(calldests_mem) );
+  FD_TEST( fd_sbpf_syscalls_footprint()<=sizeof(syscalls_mem) );
+  FD_TEST( fd_vm_join( fd_vm_new( _vm ) ) );
+  return 0;
+}
+
+struct run_result {
+  int   err;
+  ulong reg[ FD_VM_REG_CNT ];
+  ulong pc;
+  ulong ic;
+  ulong cu;
+};
+
+typedef struct run_result run_result_t;
+
+/* run executes text (with fused_text installed if non-NULL) from a
+   fresh vm over input[ idx ].  Returns 0 if the program does not
+   validate. */
+
+static int
+run( run_result_t * out,
+     ulong          text_cnt,
+     ulong const *  fused_text,
+     ulong          sbpf_version,
+     ulong          input_sz,
+     ulong          idx ) {
+
+  fd_vm_t * vm = _vm;
+
+  fd_vm_input_region_t input_region[1] = {{
+    .vaddr_offset           = 0UL,
+    .haddr                  = (ulong)input[ idx ],
+    .region_sz              = (uint)input_sz,
+    .address_space_reserved = input_sz,
+    .is_writable            = 1U,
+  }};
+
+  fd_sbpf_calldests_t * calldests = NULL;
+  if( !fd_sbpf_enable_stricter_elf_headers_enabled( sbpf_version ) ) {
+    calldests = fd_sbpf_calldests_join( fd_sbpf_calldests_new( calldests_mem, text_cnt ) );
+    FD_TEST( calldests );
+  }
+  fd_sbpf_syscalls_t * syscalls = fd_sbpf_syscalls_join( fd_sbpf_syscalls_new( syscalls_mem ) );
+  FD_TEST( syscalls );
+
+  /* The stack is not cleared by fd_vm_init, so clear it here to keep
+     both runs independent */
+  fd_memset( vm->stack, 0, sizeof(vm->stack) );
+
+  FD_TEST( fd_vm_init(
+      /* vm                                   */ vm,
+      /* instr_ctx                            */ NULL,
+      /* heap_max                             */ 0UL,
+      /* entry_cu                             */ ENTRY_CU,
+      /* rodata                               */ (uchar const *)text,
+      /* rodata_sz                            */ text_cnt * sizeof(ulong),
+      /* text                                 */ text,
+      /* text_cnt                             */ text_cnt,
+      /* text_off                             */ 0UL,
+      /* text_sz                              */ text_cnt * sizeof(ulong),
+      /* entry_pc                             */ 0UL,
+      /* calldests                            */ calldests,
+      /* sbpf_version                         */ sbpf_version,
+      /* syscalls                             */ syscalls,
+      /* trace                                */ NULL,
+      /* sha                                  */ NULL,
+      /* mem_regions                          */ input_region,
+      /* mem_regions_cnt                      */ 1U,
+      /* mem_regions_accs                     */ NULL,
+      /* is_deprecated                        */ 0,
+      /* direct mapping                       */ 0,
+      /* stricter_abi_and_runtime_constraints */ 0,
+      /* dump_syscall_to_pb                   */ 0,
+      /* r2_initial_value                     */ 0UL ) );
+
+  int ok = fd_vm_validate( vm )==FD_VM_SUCCESS;
+  if( ok ) {
+    vm->fused_text = fused_text;
+    out->err = fd_vm_exec_notrace( vm );
+    memcpy( out->reg, vm->reg, sizeof(out->reg) );
+    out->pc  = vm->pc;
+    out->ic  = vm->ic;
+    out->cu  = vm->cu;
+  }
+
+  fd_sbpf_syscalls_delete( fd_sbpf_syscalls_leave( syscalls ) );
+  if( calldests ) fd_sbpf_calldests_delete( fd_sbpf_calldests_leave( calldests ) );
+  return ok;
+}
+
+int
+LLVMFuzzerTestOneInput( uchar const * data,
+                        ulong         size ) {
+
+  if( FD_UNLIKELY( size<2UL ) ) return -1;
+  ulong sbpf_version = (ulong)data[0] % (FD_SBPF_V3+1UL);
+  ulong input_sz     = (ulong)data[1];
+  data += 2UL; size -= 2UL;
+  if( FD_UNLIKELY( size<input_sz ) ) return -1;
+
+  fd_memcpy( input[0], data, input_sz );
+  fd_memcpy( input[1], data, input_sz );
+  data += input_sz; size -= input_sz;
+
+  ulong text_cnt = fd_ulong_min( size/sizeof(ulong), TEXT_MAX );
+  if( FD_UNLIKELY( !text_cnt ) ) return -1;
+  fd_memcpy( text, data, text_cnt*sizeof(ulong) );
+
+  if( !fd_vm_fuse( fused, text, text_cnt, sbpf_version ) ) return 0;
+
+  run_result_t plain[1];
+  if( !run( plain, text_cnt, NULL, sbpf_version, input_sz, 0UL ) ) return -1;
+
+  run_result_t fast[1];
+  FD_TEST( run( fast, text_cnt, fused, sbpf_version, input_sz, 1UL ) );
+
+  if( FD_UNLIKELY( fast->err!=plain->err ) )
+    FD_LOG_CRIT(( "fused err %d (%s) != plain err %d (%s)",
+                  fast->err, fd_vm_strerror( fast->err ), plain->err, fd_vm_strerror( plain->err ) ));
+  if( FD_UNLIKELY( fast->pc!=plain->pc || fast->ic!=plain->ic || fast->cu!=plain->cu ) )
+    FD_LOG_CRIT(( "fused pc %lu ic %lu cu %lu != plain pc %lu ic %lu cu %lu",
+                  fast->pc, fast->ic, fast->cu, plain->pc, plain->ic, plain->cu ));
+  for( ulong i=0UL; i<FD_VM_REG_CNT; i++ ) {
+    if( FD_UNLIKELY( fast->reg[i]!=plain->reg[i] ) )
+      FD_LOG_CRIT(( "fused r%lu %016lx != plain r%lu %016lx", i, fast->reg[i], i, plain->reg[i] ));
+  }
+  FD_TEST( fd_memeq( input[0], input[1], input_sz ) );
+
+  return 0;
+}
@@ -303,6 +303,112 @@ vm_trace_done:
   FD_TEST( !fd_vm_trace_join  ( _trace ) ); /* not a trace */
   FD_TEST( !fd_vm_trace_delete( _trace ) ); /* not a trace */
 
+  FD_LOG_NOTICE(( "Testing fd_vm_prof" ));
+
+  /* Test prof constructors */
+
+  FD_TEST( fd_vm_prof_align()==64UL );
+
+  FD_TEST( !fd_vm_prof_footprint( 0UL          ) ); /* zero slot_max */
+  FD_TEST( !fd_vm_prof_footprint( 3UL          ) ); /* non-pow2 slot_max */
+  FD_TEST( !fd_vm_prof_footprint( 1UL<<33      ) ); /* too large slot_max */
+  FD_TEST(  fd_vm_prof_footprint( 64UL         )==sizeof(fd_vm_prof_t)+64UL*sizeof(fd_vm_prof_slot_t) );
+  FD_TEST( fd_ulong_is_aligned( fd_vm_prof_footprint( 64UL ), 8UL ) );
+
+  static uchar prof_mem[ 2 ][ sizeof(fd_vm_prof_t)+64UL*sizeof(fd_vm_prof_slot_t) ] __attribute__((aligned(64)));
+
+  FD_TEST( !fd_vm_prof_new( NULL,              64UL, 0UL  ) ); /* NULL shmem */
+  FD_TEST( !fd_vm_prof_new( prof_mem[0]+8UL,   64UL, 0UL  ) ); /* misaligned shmem */
+  FD_TEST( !fd_vm_prof_new( prof_mem[0],       63UL, 0UL  ) ); /* bad slot_max */
+  FD_TEST( !fd_vm_prof_new( prof_mem[0],       64UL, 64UL ) ); /* bad sample_lg */
+
+  FD_TEST( !fd_vm_prof_join( NULL        ) ); /* NULL       _prof */
+  FD_TEST( !fd_vm_prof_join( (void *)1UL ) ); /* misaligned _prof */
+  FD_TEST( !fd_vm_prof_join( prof_mem[0] ) ); /* not a prof */
+
+  fd_vm_prof_t * prof0 = fd_vm_prof_join( fd_vm_prof_new( prof_mem[0], 64UL, 2UL ) ); FD_TEST( prof0 );
+  fd_vm_prof_t * prof1 = fd_vm_prof_join( fd_vm_prof_new( prof_mem[1], 64UL, 0UL ) ); FD_TEST( prof1 );
+
+  /* Test sampling */
+
+  for( ulong i=0UL; i<16UL; i++ ) FD_TEST( fd_vm_prof_sample( prof0 )==!(i&3UL) );
+  for( ulong i=0UL; i<16UL; i++ ) FD_TEST( fd_vm_prof_sample( prof1 )==1        );
+  FD_TEST( prof0->exec_cnt==16UL && prof0->sample_cnt== 4UL );
+  FD_TEST( prof1->exec_cnt==16UL && prof1->sample_cnt==16UL );
+
+  /* Test tags */
+
+  FD_TEST( fd_vm_prof_tag_kind( fd_vm_prof_tag( FD_VM_PROF_KIND_SYSCALL, 0x12345678UL ) )==FD_VM_PROF_KIND_SYSCALL );
+  FD_TEST( fd_vm_prof_tag_id  ( fd_vm_prof_tag( FD_VM_PROF_KIND_SYSCALL, 0x12345678UL ) )==0x12345678UL            );
+
+  /* Record a random stream over 16 keys (4 programs x 4 kinds/ids)
+     into both profs and check the totals against a reference */
+
+  uchar prog_id[ 4 ][ 32 ];
+  for( ulong i=0UL; i<4UL; i++ ) for( ulong j=0UL; j<32UL; j++ ) prog_id[ i ][ j ] = fd_rng_uchar( rng );
+  memset( prog_id[3], 0, 32UL ); /* program 3 is recorded with a NULL id */
+
+  ulong ref_cnt[ 16 ]; ulong ref_ticks[ 16 ]; ulong ref_cu[ 16 ];
+  memset( ref_cnt, 0, sizeof(ref_cnt) ); memset( ref_ticks, 0, sizeof(ref_ticks) ); memset( ref_cu, 0, sizeof(ref_cu) );
+
+  for( ulong iter=0UL; iter<1000UL; iter++ ) {
+    ulong key   = fd_rng_ulong_roll( rng, 16UL );
+    ulong prog  = key>>2;
+    int   kind  = (int)(key & 3UL) % 3;
+    ulong id    = key & 3UL;
+    ulong ticks = fd_rng_ulong_roll( rng, 1000UL );
+    ulong cu    = fd_rng_ulong_roll( rng, 100UL  );
+    fd_vm_prof_t * prof = (iter & 1UL) ? prof1 : prof0;
+    fd_vm_prof_slot_t * slot = fd_vm_prof_record( prof, prog==3UL ? NULL : prog_id[ prog ], kind, id, ticks, cu );
+    FD_TEST( slot );
+    FD_TEST( slot->tag==fd_vm_prof_tag( kind, id ) && !memcmp( slot->program_id, prog_id[ prog ], 32UL ) );
+    ref_cnt[ key ]++; ref_ticks[ key ] += ticks; ref_cu[ key ] += cu;
+  }
+
+  FD_TEST( fd_vm_prof_merge( prof0, prof1 )==prof0 );
+  FD_TEST( prof0->exec_cnt==32UL && prof0->sample_cnt==20UL && !prof0->drop_cnt );
+
+  ulong found = 0UL;
+  fd_vm_prof_slot_t const * slot0 = fd_vm_prof_slot_const( prof0 );
+  for( ulong slot_idx=0UL; slot_idx<64UL; slot_idx++ ) {
+    fd_vm_prof_slot_t const * s = slot0 + slot_idx;
+    if( !s->cnt ) continue;
+    ulong prog = 0UL;
+    while( prog<4UL && memcmp( s->program_id, prog_id[ prog ], 32UL ) ) prog++;
+    FD_TEST( prog<4UL );
+    ulong id  = fd_vm_prof_tag_id( s->tag );
+    ulong key = (prog<<2) | id;
+    FD_TEST( fd_vm_prof_tag_kind( s->tag )==(int)id % 3 );
+    FD_TEST( s->cnt==ref_cnt[ key ] && s->ticks==ref_ticks[ key ] && s->cu==ref_cu[ key ] );
+    found++;
+  }
+  ulong ref_found = 0UL; for( ulong key=0UL; key<16UL; key++ ) ref_found += !!ref_cnt[ key ];
+  FD_TEST( found==ref_found && prof0->slot_cnt==ref_found );
+
+  /* Test a full table drops new keys */
+
+  FD_TEST( fd_vm_prof_reset( NULL  )==FD_VM_ERR_INVAL );
+  FD_TEST( fd_vm_prof_reset( prof1 )==FD_VM_SUCCESS );
+  FD_TEST( !prof1->exec_cnt && !prof1->slot_cnt );
+  for( ulong id=0UL; id<64UL; id++ ) FD_TEST( fd_vm_prof_record( prof1, NULL, FD_VM_PROF_KIND_PC, id, 1UL, 1UL ) );
+  FD_TEST( prof1->slot_cnt==64UL && !prof1->drop_cnt );
+  FD_TEST( !fd_vm_prof_record( prof1, NULL, FD_VM_PROF_KIND_PC, 64UL, 1UL, 1UL ) );
+  FD_TEST(  fd_vm_prof_record( prof1, NULL, FD_VM_PROF_KIND_PC, 63UL, 1UL, 1UL ) );
+  FD_TEST( prof1->drop_cnt==1UL );
+
+  /* Test prof destructors */
+
+  FD_TEST( !fd_vm_prof_leave( NULL ) );
+  FD_TEST( fd_vm_prof_leave( prof0 )==prof_mem[0] );
+  FD_TEST( fd_vm_prof_leave( prof1 )==prof_mem[1] );
+
+  FD_TEST( !fd_vm_prof_delete( NULL        ) ); /* NULL       _prof */
+  FD_TEST( !fd_vm_prof_delete( (void *)1UL ) ); /* misaligned _prof */
+  FD_TEST( fd_vm_prof_delete( prof_mem[0] )==prof_mem[0] );
+  FD_TEST( fd_vm_prof_delete( prof_mem[1] )==prof_mem[1] );
+  FD_TEST( !fd_vm_prof_join  ( prof_mem[0] ) ); /* not a prof */
+  FD_TEST( !fd_vm_prof_delete( prof_mem[0] ) ); /* not a prof */
+
   fd_rng_delete( fd_rng_leave( rng ) );
 
   FD_LOG_NOTICE(( "pass" ));
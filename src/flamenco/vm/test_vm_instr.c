@@ -351,6 +351,10 @@ parse_next( test_parser_t *  p,
 
 /* Execution **********************************************************/
 
+/* test_prof is attached to the vm for the profiled run of each fixture */
+
+static fd_vm_prof_t * test_prof;
+
 static void
 run_input2( test_effects_t * out,
             fd_vm_t *        vm,
@@ -364,7 +368,7 @@ run_input2( test_effects_t * out,
     return;
   }
 
-  if( fd_vm_exec_notrace( vm ) != FD_VM_SUCCESS ) {
+  if( fd_vm_exec( vm ) != FD_VM_SUCCESS ) {
     out->status = STATUS_FAULT;
     return;
   }
@@ -379,16 +383,24 @@ run_input2( test_effects_t * out,
   };
 }
 
-static void
+/* run_input runs the fixture input.  If fuse is set, a no-op branch
+   (jeq dst, 0, +0) is placed after the instruction under test and the
+   vm runs the fd_vm_fuse stream instead.  If prof is set, the vm runs
+   with test_prof attached.  Returns the number of fused instruction
+   pairs (0 if fuse is not set). */
+
+static ulong
 run_input( test_input_t const * input,
            test_effects_t *     out,
            fd_vm_t *            vm,
            ulong                sbpf_version,
-           int                  force_exec ) {
+           int                  force_exec,
+           int                  fuse,
+           int                  prof ) {
 
   /* Assemble instructions */
 
-  ulong text[3]  = {0};
+  ulong text[4]  = {0};
   ulong text_cnt = 0UL;
 
   text[ text_cnt++ ] =
@@ -397,9 +409,16 @@ run_input( test_input_t const * input,
     text[ text_cnt++ ] =
       fd_vm_instr( 0, 0, 0, 0, (uint)( input->imm >> 32 ) );
   }
+  if( fuse ) {
+    text[ text_cnt++ ] =
+      fd_vm_instr( FD_SBPF_OP_JEQ_IMM, input->dst, 0, 0, 0 );
+  }
   text[ text_cnt++ ] =
     fd_vm_instr( FD_SBPF_OP_EXIT, 0, 0, 0, 0 );
 
+  ulong fused[4];
+  ulong fuse_cnt = fuse ? fd_vm_fuse( fused, text, text_cnt, sbpf_version ) : 0UL;
+
   /* Set up VM */
 
   uchar * input_copy = malloc( input->input_sz );
@@ -475,6 +494,8 @@ run_input( test_input_t const * input,
   for( uint i=0; i<REG_CNT; i++ ) {
     vm->reg[i] = input->reg[i];
   }
+  if( fuse_cnt ) vm->fused_text = fused;
+  if( prof     ) vm->prof       = test_prof;
 
   run_input2( out, vm, force_exec );
 
@@ -482,6 +503,8 @@ run_input( test_input_t const * input,
   free( fd_sbpf_syscalls_delete ( fd_sbpf_syscalls_leave ( syscalls  ) ) );
   free( fd_sbpf_calldests_delete( fd_sbpf_calldests_leave( calldests ) ) );
   free( input_copy );
+
+  return fuse_cnt;
 }
 
 /* run_fixture runs a test fixture.  Returns 1 if the local execution
@@ -498,7 +521,33 @@ run_fixture( test_fixture_t const * f,
 
   test_effects_t const * expected  = &f->effects;
   test_effects_t         actual[1] = {{0}};
-  run_input( &f->input, actual, vm, sbpf_version, expected->force_exec );
+  run_input( &f->input, actual, vm, sbpf_version, expected->force_exec, 0, 0 );
+
+  /* Loads are also run fused with a following no-op branch, which
+     should not change the outcome */
+
+  test_effects_t fused[1] = {{0}};
+  if( run_input( &f->input, fused, vm, sbpf_version, expected->force_exec, 1, 0 ) ) {
+    if( FD_UNLIKELY( fused->status!=actual->status || memcmp( fused->reg, actual->reg, sizeof(actual->reg) ) ) ) {
+      FD_LOG_WARNING(( "FAIL %s(%lu): Fused execution differs (status %s vs %s)",
+                       src_file, f->line,
+                       test_status_str( fused ->status ),
+                       test_status_str( actual->status ) ));
+      fail = 1;
+    }
+  }
+
+  /* Profiled execution should not change the outcome either */
+
+  test_effects_t profiled[1] = {{0}};
+  run_input( &f->input, profiled, vm, sbpf_version, expected->force_exec, 0, 1 );
+  if( FD_UNLIKELY( profiled->status!=actual->status || memcmp( profiled->reg, actual->reg, sizeof(actual->reg) ) ) ) {
+    FD_LOG_WARNING(( "FAIL %s(%lu): Profiled execution differs (status %s vs %s)",
+                     src_file, f->line,
+                     test_status_str( profiled->status ),
+                     test_status_str( actual  ->status ) ));
+    fail = 1;
+  }
 
   if( expected->status != actual->status ) {
     FD_LOG_WARNING(( "FAIL %s(%lu): Expected status %s, got %s",
@@ -593,6 +642,10 @@ main( int     argc,
   static fd_vm_t _vm[1];
   fd_vm_t * vm = fd_vm_join( fd_vm_new( _vm ) );
 
+  static uchar prof_mem[ sizeof(fd_vm_prof_t)+1024UL*sizeof(fd_vm_prof_slot_t) ] __attribute__((aligned(64)));
+  test_prof = fd_vm_prof_join( fd_vm_prof_new( prof_mem, 1024UL, 0UL ) );
+  FD_TEST( test_prof );
+
   /* Execute all arguments that don't look like flags */
 
   int   fail = 0;
@@ -647,6 +700,29 @@ main( int     argc,
     }
   }
 
+  /* Every profiled run is sampled and attributed to the NULL program
+     id, and runs that executed a branch recorded a segment in pc bucket
+     0 */
+
+  if( test_prof->exec_cnt ) {
+    FD_TEST( test_prof->sample_cnt==test_prof->exec_cnt && !test_prof->drop_cnt );
+    ulong prog_cnt = 0UL;
+    ulong pc_cnt   = 0UL;
+    for( ulong slot_idx=0UL; slot_idx<test_prof->slot_max; slot_idx++ ) {
+      fd_vm_prof_slot_t const * slot = fd_vm_prof_slot_const( test_prof ) + slot_idx;
+      if( !slot->cnt ) continue;
+      FD_TEST( fd_vm_prof_tag_id( slot->tag )==0UL );
+      switch( fd_vm_prof_tag_kind( slot->tag ) ) {
+      case FD_VM_PROF_KIND_PROG: prog_cnt += slot->cnt; break;
+      case FD_VM_PROF_KIND_PC:   pc_cnt   += slot->cnt; FD_TEST( slot->cu>=slot->cnt ); break;
+      default: FD_LOG_ERR(( "unexpected profile kind" ));
+      }
+    }
+    FD_TEST( prog_cnt==test_prof->exec_cnt && pc_cnt );
+    FD_LOG_NOTICE(( "profiled %lu executions (%lu segments)", prog_cnt, pc_cnt ));
+  }
+  fd_vm_prof_delete( fd_vm_prof_leave( test_prof ) );
+
   if( !fail ) FD_LOG_NOTICE(( "pass" ));
   else        FD_LOG_WARNING(( "fail cnt %d", fail ));
 
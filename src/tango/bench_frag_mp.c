@@ -0,0 +1,201 @@
+/* bench_frag_mp measures the throughput of a multi-producer link (see
+   fd_mcache_mp_reserve) as the number of producers grows.  Tile 0 is
+   the consumer and tiles [1,producer_cnt] are the producers.  Each
+   producer reserves sequence numbers one at a time from the shared
+   mcache, writes a small payload into its own part of a shared dcache
+   and publishes.  Flow control is done per producer against the
+   consumer's fseq with a producer's fixed share of the mcache depth as
+   credits.  The consumer validates every frag it receives and reports
+   the frag rate and the number of overruns (expected to be zero).
+
+   Run with at least producer_cnt+1 tiles, e.g.
+
+     --tile-cpus f,f,f,f,f,f,f,f,f
+
+   for up to 8 producers (use dedicated cores for meaningful numbers).
+   Producer counts of 2,4,8,16,32 are benchmarked as tile count
+   permits. */
+
+#include "fd_tango.h"
+
+#if FD_HAS_HOSTED && FD_HAS_ATOMIC
+
+#define DEPTH    (4096UL)
+#define MTU      (64UL)
+#define PROD_MAX (32UL)
+#define DATA_MAX ((DEPTH+2UL*PROD_MAX)*FD_DCACHE_SLOT_FOOTPRINT( MTU ))
+
+static uchar mcache_mem[ FD_MCACHE_FOOTPRINT( DEPTH, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+static uchar dcache_mem[ FD_DCACHE_FOOTPRINT( DATA_MAX, 0UL ) ] __attribute__((aligned(FD_DCACHE_ALIGN)));
+static uchar fseq_mem  [ FD_FSEQ_FOOTPRINT ] __attribute__((aligned(FD_FSEQ_ALIGN)));
+
+static fd_frag_meta_t * mcache;
+static uchar *          dcache;
+static ulong *          fseq;
+static ulong            producer_cnt;
+static ulong            cr_max;
+static ulong            data_sz;
+static volatile int     halt;
+
+static int
+producer_main( int     argc,
+               char ** argv ) {
+  (void)argv;
+  ulong prod_idx = (ulong)argc;
+
+  ulong * sync   = fd_mcache_seq_laddr( mcache );
+  ulong   chunk0 = fd_dcache_compact_part_chunk0( dcache, dcache,      producer_cnt, prod_idx );
+  ulong   wmark  = fd_dcache_compact_part_wmark ( dcache, dcache, MTU, producer_cnt, prod_idx );
+  ulong   chunk  = chunk0;
+
+  /* own is a ring of the sequence numbers this producer reserved that
+     the consumer has not yet acknowledged.  Its capacity is the
+     producer's credit share. */
+
+  ulong own[ DEPTH ];
+  ulong own_head = 0UL;
+  ulong own_tail = 0UL;
+
+  while( !halt ) {
+
+    /* Wait for credits */
+
+    while( (own_head-own_tail)==cr_max ) {
+      ulong cons_seq = fd_fseq_query( fseq );
+      while( own_head!=own_tail && fd_seq_lt( own[ own_tail & (cr_max-1UL) ], cons_seq ) ) own_tail++;
+      if( FD_UNLIKELY( halt ) ) return 0;
+      FD_SPIN_PAUSE();
+    }
+
+    /* Reserve, fill and publish */
+
+    ulong seq = fd_mcache_mp_reserve( sync, 1UL );
+    own[ own_head & (cr_max-1UL) ] = seq;
+    own_head++;
+
+    ulong * p = (ulong *)fd_chunk_to_laddr( dcache, chunk );
+    for( ulong i=0UL; i<MTU/sizeof(ulong); i++ ) p[i] = seq;
+
+    fd_mcache_publish( mcache, DEPTH, seq, prod_idx, chunk, MTU, 0UL, 0U, 0U );
+    chunk = fd_dcache_compact_next( chunk, MTU, chunk0, wmark );
+  }
+
+  return 0;
+}
+
+static void
+bench( ulong _producer_cnt,
+       ulong frag_cnt ) {
+
+  producer_cnt = _producer_cnt;
+  cr_max       = fd_mcache_mp_cr_max( DEPTH, producer_cnt );
+  data_sz      = producer_cnt*fd_dcache_req_data_sz( MTU, cr_max, 1UL, 1 );
+  FD_TEST( cr_max );
+  FD_TEST( data_sz<=DATA_MAX );
+
+  mcache = fd_mcache_join( fd_mcache_new( mcache_mem, DEPTH, 0UL, 0UL ) ); FD_TEST( mcache );
+  dcache = fd_dcache_join( fd_dcache_new( dcache_mem, data_sz, 0UL ) );    FD_TEST( dcache );
+  fseq   = fd_fseq_join  ( fd_fseq_new  ( fseq_mem,   0UL ) );             FD_TEST( fseq   );
+  halt   = 0;
+  FD_COMPILER_MFENCE();
+
+  fd_tile_exec_t * exec[ PROD_MAX ];
+  for( ulong prod_idx=0UL; prod_idx<producer_cnt; prod_idx++ ) {
+    exec[ prod_idx ] = fd_tile_exec_new( prod_idx+1UL, producer_main, (int)prod_idx, NULL );
+    FD_TEST( exec[ prod_idx ] );
+  }
+
+  ulong ovrn_cnt = 0UL;
+  ulong rx_cnt[ PROD_MAX ] = {0};
+  ulong seq    = 0UL;
+
+  long dt = -fd_log_wallclock();
+  while( seq<frag_cnt ) {
+    fd_frag_meta_t const * mline = mcache + fd_mcache_line_idx( seq, DEPTH );
+
+    FD_COMPILER_MFENCE();
+    ulong seq_found = mline->seq;
+    FD_COMPILER_MFENCE();
+    ulong sig       = mline->sig;
+    ulong chunk     = mline->chunk;
+    ulong sz        = mline->sz;
+    FD_COMPILER_MFENCE();
+    ulong seq_test  = mline->seq;
+    FD_COMPILER_MFENCE();
+
+    if( FD_UNLIKELY( fd_seq_ne( seq_found, seq ) | fd_seq_ne( seq_test, seq ) ) ) {
+      if( FD_UNLIKELY( fd_seq_gt( seq_test, seq ) ) ) { ovrn_cnt++; seq = seq_test; } /* overrun */
+      else FD_SPIN_PAUSE();                                                             /* caught up */
+      continue;
+    }
+
+    FD_TEST( sig<producer_cnt );
+    FD_TEST( sz==MTU );
+    FD_TEST( chunk>=fd_dcache_compact_part_chunk0( dcache, dcache,      producer_cnt, sig ) );
+    FD_TEST( chunk<=fd_dcache_compact_part_wmark ( dcache, dcache, MTU, producer_cnt, sig ) );
+    FD_TEST( ((ulong const *)fd_chunk_to_laddr_const( dcache, chunk ))[0]==seq );
+    rx_cnt[ sig ]++;
+
+    seq = fd_seq_inc( seq, 1UL );
+    if( FD_UNLIKELY( !(seq & 63UL) ) ) fd_fseq_update( fseq, seq );
+  }
+  dt += fd_log_wallclock();
+
+  /* Producers publish everything they reserve before waiting for
+     credits, so they can be stopped at any point. */
+
+  halt = 1;
+  FD_COMPILER_MFENCE();
+  for( ulong prod_idx=0UL; prod_idx<producer_cnt; prod_idx++ ) fd_tile_exec_delete( exec[ prod_idx ], NULL );
+
+  ulong rx_min = ULONG_MAX;
+  ulong rx_max = 0UL;
+  for( ulong prod_idx=0UL; prod_idx<producer_cnt; prod_idx++ ) {
+    rx_min = fd_ulong_min( rx_min, rx_cnt[ prod_idx ] );
+    rx_max = fd_ulong_max( rx_max, rx_cnt[ prod_idx ] );
+  }
+
+  FD_LOG_NOTICE(( "producer_cnt %2lu: %7.3f Mfrag/s (cr_max %4lu, ovrn_cnt %lu, per producer frags [%lu,%lu])",
+                  producer_cnt, 1e3*(double)frag_cnt/(double)dt, cr_max, ovrn_cnt, rx_min, rx_max ));
+  FD_TEST( !ovrn_cnt );
+
+  fd_fseq_delete  ( fd_fseq_leave  ( fseq   ) );
+  fd_dcache_delete( fd_dcache_leave( dcache ) );
+  fd_mcache_delete( fd_mcache_leave( mcache ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong frag_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--frag-cnt", NULL, 10000000UL );
+
+  ulong tile_cnt = fd_tile_cnt();
+  if( FD_UNLIKELY( tile_cnt<3UL ) ) {
+    FD_LOG_WARNING(( "skip: benchmark requires at least 3 tiles (e.g. --tile-cpus f,f,f)" ));
+    fd_halt();
+    return 0;
+  }
+
+  FD_LOG_NOTICE(( "Benchmarking multi-producer link (--frag-cnt %lu, depth %lu, mtu %lu)", frag_cnt, DEPTH, MTU ));
+
+  for( ulong p=2UL; p<=fd_ulong_min( tile_cnt-1UL, PROD_MAX ); p<<=1 ) bench( p, frag_cnt );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED and FD_HAS_ATOMIC capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -216,6 +216,41 @@ fd_dcache_compact_wmark( void const * base,
   return fd_dcache_compact_chunk1( base, dcache ) - chunk_mtu;
 }
 
+/* fd_dcache_compact_part_{chunk0,wmark} split the data region of a
+   dcache into part_cnt disjoint equal sized compact rings and return
+   the chunk0 and watermark chunk index of part part_idx, for use with
+   fd_dcache_compact_next below in place of fd_dcache_compact_{chunk0,
+   wmark}.  This is used by multi-producer links, where each producer
+   writes its frags into its own part (see fd_mcache_mp_reserve).  Each
+   part can safely store the frags of a producer that has at most depth
+   frags in flight if the data region is at least
+   part_cnt*fd_dcache_req_data_sz( mtu, depth, burst, 1 ) bytes.  With a
+   part_cnt of 1, these are the same as fd_dcache_compact_{chunk0,
+   wmark}.  Assumes part_idx<part_cnt and the same as
+   fd_dcache_compact_{chunk0,wmark}. */
+
+FD_FN_PURE static inline ulong
+fd_dcache_compact_part_chunk0( void const * base,
+                               void const * dcache,
+                               ulong        part_cnt,
+                               ulong        part_idx ) {
+  ulong chunk0  = fd_dcache_compact_chunk0( base, dcache );
+  ulong part_sz = ((fd_dcache_compact_chunk1( base, dcache ) - chunk0) / part_cnt) & ~1UL; /* In chunk pairs */
+  return chunk0 + part_idx*part_sz;
+}
+
+FD_FN_PURE static inline ulong
+fd_dcache_compact_part_wmark( void const * base,
+                              void const * dcache,
+                              ulong        mtu,
+                              ulong        part_cnt,
+                              ulong        part_idx ) {
+  ulong chunk0    = fd_dcache_compact_chunk0( base, dcache );
+  ulong part_sz   = ((fd_dcache_compact_chunk1( base, dcache ) - chunk0) / part_cnt) & ~1UL; /* In chunk pairs */
+  ulong chunk_mtu = ((mtu + 2UL*FD_CHUNK_SZ-1UL) >> (1+FD_CHUNK_LG_SZ)) << 1;
+  return chunk0 + (part_idx+1UL)*part_sz - chunk_mtu;
+}
+
 /* fd_dcache_compact_chunk_next:
 
    Let a dcache have space for at least chunk_mtu*(depth+2)-1 chunks
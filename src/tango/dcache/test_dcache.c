@@ -203,6 +203,33 @@ main( int     argc,
       ulong fp    = fd_ulong_align_up( sz, 2UL*FD_CHUNK_SZ ) >> FD_CHUNK_LG_SZ;
       FD_TEST( next==fd_ulong_if( (chunk+fp)>wmark, chunk0, chunk+fp ) );
     }
+
+    /* Test partitioning for multi-producer links */
+
+    FD_TEST( fd_dcache_compact_part_chunk0( ref, dcache,      1UL, 0UL )==chunk0 );
+    FD_TEST( fd_dcache_compact_part_wmark ( ref, dcache, mtu, 1UL, 0UL )==wmark  );
+
+    for( ulong part_cnt=2UL; part_cnt<=32UL; part_cnt++ ) {
+      if( data_sz < part_cnt*fd_dcache_req_data_sz( mtu, depth, 1UL /*burst*/, 1 /*compact*/ ) ) break;
+      ulong part_end = chunk0;
+      for( ulong part_idx=0UL; part_idx<part_cnt; part_idx++ ) {
+        ulong part_chunk0 = fd_dcache_compact_part_chunk0( ref, dcache,      part_cnt, part_idx );
+        ulong part_wmark  = fd_dcache_compact_part_wmark ( ref, dcache, mtu, part_cnt, part_idx );
+        FD_TEST( part_chunk0==part_end );
+        FD_TEST( !((part_chunk0-chunk0) & 1UL) );
+        FD_TEST( part_chunk0<=part_wmark );
+        part_end = part_wmark + chunk_mtu;
+        FD_TEST( part_end<=chunk1 );
+
+        /* Frags stay inside their part */
+        for( ulong iter=0UL; iter<1000UL; iter++ ) {
+          ulong chunk = part_chunk0 + fd_rng_ulong_roll( rng, part_wmark-part_chunk0+1UL );
+          ulong sz    = fd_rng_ulong_roll( rng, mtu+1UL );
+          ulong next  = fd_dcache_compact_next( chunk, sz, part_chunk0, part_wmark );
+          FD_TEST( part_chunk0<=next ); FD_TEST( next<=part_wmark );
+        }
+      }
+    }
   }
 
   /* Test mcache destruction */
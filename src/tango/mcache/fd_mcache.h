@@ -749,6 +749,69 @@ fd_mcache_query( fd_frag_meta_t const * mcache,
   return fd_frag_meta_seq_query( mcache + fd_mcache_line_idx( seq_query, depth ) );
 }
 
+/* Multi-producer mcaches *********************************************/
+
+/* A multi-producer mcache is a regular mcache that has more than one
+   concurrent producer.  Consumers poll it exactly as they would poll a
+   single producer mcache, with the same overrun detection semantics.
+
+   Producers share seq[0] (from fd_mcache_seq_laddr) as the next
+   sequence number to hand out.  A producer atomically reserves a range
+   of sequence numbers with fd_mcache_mp_reserve and then publishes each
+   of them with fd_mcache_publish (or one of its variants) as usual.
+   Since producers run independently, publications can complete out of
+   order.  This is invisible to consumers: a consumer waiting on a
+   sequence number that was reserved but not yet published sees the
+   same thing as a consumer that is caught up, and frags that were
+   published after it are picked up as soon as it becomes available.
+   As such, a producer that stalls between reserving and publishing
+   will stall all consumers.  Producers must not call
+   fd_mcache_seq_update on a multi-producer mcache.
+
+   seq[0] is hence not a lower bound of what has been published but an
+   upper bound of what has been reserved.  Consumers that initialize
+   from fd_mcache_seq_query will just wait until the reservations in
+   flight get published.
+
+   Producers still need to honor flow control from reliable consumers.
+   The total number of sequence numbers reserved and not yet consumed
+   across all producers cannot exceed the mcache depth.  The simplest
+   way to do this without any additional coordination between producers
+   is to give each of producer_cnt producers a fixed share of
+   fd_mcache_mp_cr_max( depth, producer_cnt ) credits, where each
+   producer keeps track of the sequence numbers it reserved itself and
+   how many of those are not yet consumed.  fd_stem does this for outs
+   that are multi-producer links in the topology. */
+
+/* fd_mcache_mp_cr_max returns the number of flow control credits each
+   of producer_cnt producers of a depth entry multi-producer mcache can
+   have.  This is the largest power of two not exceeding
+   depth/producer_cnt, or zero if depth<producer_cnt (or producer_cnt
+   is zero). */
+
+FD_FN_CONST static inline ulong
+fd_mcache_mp_cr_max( ulong depth,
+                     ulong producer_cnt ) {
+  ulong cr_max = producer_cnt ? depth/producer_cnt : 0UL;
+  return cr_max ? fd_ulong_pow2_dn( cr_max ) : 0UL;
+}
+
+#if FD_HAS_ATOMIC
+
+/* fd_mcache_mp_reserve atomically reserves the cnt sequence numbers
+   [seq,seq+cnt) cyclic in a multi-producer mcache and returns seq.
+   _seq should be the mcache's seq[0] (from fd_mcache_seq_laddr).  The
+   caller is responsible for publishing all of them (in any order).
+   This acts as a full memory fence. */
+
+static inline ulong
+fd_mcache_mp_reserve( ulong * _seq,
+                      ulong   cnt ) {
+  return FD_ATOMIC_FETCH_AND_ADD( _seq, cnt );
+}
+
+#endif
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_tango_mcache_fd_mcache_h */
@@ -190,6 +190,44 @@ main( int     argc,
     fd_mcache_seq_update( _seq, fd_seq_inc( next, 1UL ) );
   }
 
+  /* Test multi-producer operations */
+
+  FD_TEST( fd_mcache_mp_cr_max( depth,  0UL          )==0UL                                     );
+  FD_TEST( fd_mcache_mp_cr_max( depth,  1UL          )==depth                                   );
+  FD_TEST( fd_mcache_mp_cr_max( depth,  depth+1UL    )==0UL                                     );
+  FD_TEST( fd_mcache_mp_cr_max( 1024UL, 3UL          )==256UL                                   );
+  FD_TEST( fd_mcache_mp_cr_max( depth,  3UL          )==(depth/3UL ? fd_ulong_pow2_dn( depth/3UL ) : 0UL) );
+
+# if FD_HAS_ATOMIC
+  for( ulong iter=0UL; iter<100000UL; iter++ ) {
+
+    /* Two producers reserve interleaved ranges and publish them in an
+       arbitrary order.  Until both publish, consumers waiting on the
+       first reservation see the mcache as caught up. */
+
+    ulong cnt0 = 1UL + fd_rng_ulong_roll( rng, depth/2UL );
+    ulong cnt1 = 1UL + fd_rng_ulong_roll( rng, depth/2UL );
+    ulong seq0 = fd_mcache_mp_reserve( _seq, cnt0 );
+    ulong seq1 = fd_mcache_mp_reserve( _seq, cnt1 );
+    FD_TEST( seq1==fd_seq_inc( seq0, cnt0 ) );
+    FD_TEST( fd_mcache_seq_query( _seq_const )==fd_seq_inc( seq1, cnt1 ) );
+
+    for( ulong i=0UL; i<cnt1; i++ ) {
+      ulong seq = fd_seq_inc( seq1, i );
+      fd_mcache_publish( mcache, depth, seq, 0UL, 1UL, 2UL, 3UL, 4UL, 5UL );
+    }
+    FD_TEST( fd_seq_lt( fd_mcache_query( mcache, depth, seq0 ), seq0 ) ); /* not yet published */
+    FD_TEST( fd_seq_eq( fd_mcache_query( mcache, depth, seq1 ), seq1 ) );
+
+    for( ulong i=0UL; i<cnt0; i++ ) {
+      ulong seq = fd_seq_inc( seq0, cnt0-1UL-i );
+      fd_mcache_publish( mcache, depth, seq, 0UL, 1UL, 2UL, 3UL, 4UL, 5UL );
+    }
+    for( ulong seq=seq0; fd_seq_ne( seq, fd_seq_inc( seq1, cnt1 ) ); seq=fd_seq_inc( seq, 1UL ) )
+      FD_TEST( fd_seq_eq( fd_mcache_query( mcache, depth, seq ), seq ) );
+  }
+# endif
+
   /* Test mcache for corruption */
 
   FD_TEST( fd_mcache_depth          ( mcache )==depth      );
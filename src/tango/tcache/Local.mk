@@ -1,4 +1,9 @@
-$(call add-hdrs,fd_tcache.h)
-$(call add-objs,fd_tcache,fd_tango)
+$(call add-hdrs,fd_tcache.h fd_btcache.h)
+$(call add-objs,fd_tcache fd_btcache,fd_tango)
 $(call make-unit-test,test_tcache,test_tcache,fd_tango fd_util)
 $(call run-unit-test,test_tcache)
+$(call make-unit-test,test_btcache,test_btcache,fd_tango fd_util)
+$(call run-unit-test,test_btcache)
+ifdef FD_HAS_HOSTED
+$(call make-unit-test,bench_btcache,bench_btcache,fd_tango fd_util)
+endif
@@ -0,0 +1,165 @@
+/* bench_btcache compares the insert throughput and memory footprint of
+   the tcache and the bucketized btcache on a dedup-like workload
+   (random 64-bit tags, a fraction of which are recent duplicates) at
+   depths from 1M up to --depth-max.  For the btcache, tags are
+   inserted either one at a time or in bursts of --batch tags with
+   fd_btcache_insert_batch.  Larger depths need a correspondingly large
+   workspace (e.g. --page-sz gigantic --page-cnt 2 for 16M). */
+
+#include "../fd_tango.h"
+
+#if FD_HAS_HOSTED
+
+#define TAG_CNT (1UL<<24)
+
+static ulong
+tag_fill( ulong *    tag,
+          ulong      tag_cnt,
+          float      dup_frac,
+          fd_rng_t * rng ) {
+  ulong dup_thresh = (ulong)((float)(1UL<<32)*dup_frac);
+  for( ulong i=0UL; i<tag_cnt; i++ ) {
+    ulong t;
+    if( i>1024UL && ((ulong)fd_rng_uint( rng ))<dup_thresh ) t = tag[ i - 1UL - fd_rng_ulong_roll( rng, 1024UL ) ];
+    else do t = fd_rng_ulong( rng ); while( !t );
+    tag[ i ] = t;
+  }
+  return tag_cnt;
+}
+
+static double
+bench_tcache( fd_wksp_t *   wksp,
+              ulong         depth,
+              ulong const * tag,
+              ulong         tag_cnt,
+              ulong *       _footprint ) {
+  ulong footprint = fd_tcache_footprint( depth, 0UL ); FD_TEST( footprint );
+  void * mem = fd_wksp_alloc_laddr( wksp, fd_tcache_align(), footprint, 1UL );
+  if( FD_UNLIKELY( !mem ) ) return 0.;
+  fd_tcache_t * tcache = fd_tcache_join( fd_tcache_new( mem, depth, 0UL ) ); FD_TEST( tcache );
+
+  ulong   oldest  = *fd_tcache_oldest_laddr( tcache );
+  ulong * ring    = fd_tcache_ring_laddr( tcache );
+  ulong * map     = fd_tcache_map_laddr ( tcache );
+  ulong   map_cnt = fd_tcache_map_cnt   ( tcache );
+
+  /* Warm up to steady state then time */
+  ulong dup_cnt = 0UL;
+  for( ulong i=0UL; i<depth; i++ ) { int dup; FD_TCACHE_INSERT( dup, oldest, ring, depth, map, map_cnt, tag[ i ] ); dup_cnt += (ulong)dup; }
+  long dt = -fd_log_wallclock();
+  for( ulong i=depth; i<tag_cnt; i++ ) { int dup; FD_TCACHE_INSERT( dup, oldest, ring, depth, map, map_cnt, tag[ i ] ); dup_cnt += (ulong)dup; }
+  dt += fd_log_wallclock();
+  FD_TEST( dup_cnt );
+
+  fd_wksp_free_laddr( fd_tcache_delete( fd_tcache_leave( tcache ) ) );
+  *_footprint = footprint;
+  return 1e3*(double)(tag_cnt-depth)/(double)dt;
+}
+
+static double
+bench_btcache( fd_wksp_t *   wksp,
+               ulong         depth,
+               ulong         batch,
+               ulong const * tag,
+               ulong         tag_cnt,
+               ulong *       _footprint ) {
+  ulong footprint = fd_btcache_footprint( depth, 0UL ); FD_TEST( footprint );
+  void * mem = fd_wksp_alloc_laddr( wksp, fd_btcache_align(), footprint, 1UL );
+  if( FD_UNLIKELY( !mem ) ) return 0.;
+  fd_btcache_t * btcache = fd_btcache_join( fd_btcache_new( mem, depth, 0UL ) ); FD_TEST( btcache );
+
+  ulong *               oldest     = fd_btcache_oldest_laddr( btcache );
+  ulong *               ring       = fd_btcache_ring_laddr  ( btcache );
+  fd_btcache_bucket_t * map        = fd_btcache_map_laddr   ( btcache );
+  ulong                 bucket_cnt = fd_btcache_bucket_cnt  ( btcache );
+
+  ulong dup_cnt = 0UL;
+  for( ulong i=0UL; i<depth; i++ ) dup_cnt += (ulong)fd_btcache_insert( oldest, ring, depth, map, bucket_cnt, tag[ i ] );
+  long dt = -fd_log_wallclock();
+  if( batch<=1UL ) {
+    for( ulong i=depth; i<tag_cnt; i++ ) dup_cnt += (ulong)fd_btcache_insert( oldest, ring, depth, map, bucket_cnt, tag[ i ] );
+  } else {
+    int dup[ FD_BTCACHE_BATCH_MAX ];
+    for( ulong i=depth; i<tag_cnt; i+=batch ) {
+      ulong cnt = fd_ulong_min( batch, tag_cnt-i );
+      fd_btcache_insert_batch( btcache, tag+i, cnt, dup );
+      for( ulong j=0UL; j<cnt; j++ ) dup_cnt += (ulong)dup[ j ];
+    }
+  }
+  dt += fd_log_wallclock();
+  FD_TEST( dup_cnt );
+
+  fd_wksp_free_laddr( fd_btcache_delete( fd_btcache_leave( btcache ) ) );
+  *_footprint = footprint;
+  return 1e3*(double)(tag_cnt-depth)/(double)dt;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong cpu_idx = fd_tile_cpu_id( fd_tile_idx() );
+  if( cpu_idx>fd_shmem_cpu_cnt() ) cpu_idx = 0UL;
+
+  char const * _page_sz  = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",   NULL, "gigantic"                   );
+  ulong        page_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt",  NULL, 2UL                          );
+  ulong        numa_idx  = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx",  NULL, fd_shmem_numa_idx( cpu_idx ) );
+  ulong        depth_min = fd_env_strip_cmdline_ulong( &argc, &argv, "--depth-min", NULL, 1UL<<20                      );
+  ulong        depth_max = fd_env_strip_cmdline_ulong( &argc, &argv, "--depth-max", NULL, 1UL<<24                      );
+  ulong        batch     = fd_env_strip_cmdline_ulong( &argc, &argv, "--batch",     NULL, 16UL                         );
+  float        dup_frac  = fd_env_strip_cmdline_float( &argc, &argv, "--dup-frac",  NULL, 0.25f                        );
+
+  if( FD_UNLIKELY( !depth_min || depth_min>depth_max ) ) FD_LOG_ERR(( "bad --depth-min / --depth-max" ));
+  if( FD_UNLIKELY( !batch || batch>FD_BTCACHE_BATCH_MAX ) ) FD_LOG_ERR(( "--batch should be in [1,%lu]", FD_BTCACHE_BATCH_MAX ));
+
+  FD_LOG_NOTICE(( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)", page_cnt, _page_sz, numa_idx ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  /* Tags are generated up front so the benchmark only measures the
+     cache operations (the tag stream is 2*depth_max tags) */
+
+  ulong   tag_cnt = fd_ulong_max( 2UL*depth_max, TAG_CNT );
+  ulong * tag     = fd_wksp_alloc_laddr( wksp, alignof(ulong), tag_cnt*sizeof(ulong), 1UL );
+  if( FD_UNLIKELY( !tag ) ) FD_LOG_ERR(( "workspace too small for tags, increase --page-cnt" ));
+  tag_fill( tag, tag_cnt, dup_frac, rng );
+
+  FD_LOG_NOTICE(( "Benchmarking (--dup-frac %g --batch %lu)", (double)dup_frac, batch ));
+
+  for( ulong depth=depth_min; depth<=depth_max; depth<<=1 ) {
+    ulong t_fp = 0UL, b_fp = 0UL, bb_fp = 0UL;
+    double t_rate  = bench_tcache ( wksp, depth,        tag, depth+tag_cnt/2UL, &t_fp  );
+    double b_rate  = bench_btcache( wksp, depth,   1UL, tag, depth+tag_cnt/2UL, &b_fp  );
+    double bb_rate = bench_btcache( wksp, depth, batch, tag, depth+tag_cnt/2UL, &bb_fp );
+    if( FD_UNLIKELY( t_rate==0. || b_rate==0. || bb_rate==0. ) ) {
+      FD_LOG_WARNING(( "workspace too small for depth %lu, increase --page-cnt", depth ));
+      break;
+    }
+    FD_LOG_NOTICE(( "depth %9lu: tcache %7.3f Minsert/s (%6.1f B/tag) btcache %7.3f Minsert/s batch %7.3f Minsert/s (%6.1f B/tag)",
+                    depth, t_rate, (double)t_fp/(double)depth, b_rate, bb_rate, (double)b_fp/(double)depth ));
+  }
+
+  fd_wksp_free_laddr( tag );
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -0,0 +1,130 @@
+#include "fd_btcache.h"
+
+ulong
+fd_btcache_align( void ) {
+  return FD_BTCACHE_ALIGN;
+}
+
+ulong
+fd_btcache_footprint( ulong depth,
+                      ulong bucket_cnt ) {
+  if( !bucket_cnt ) bucket_cnt = fd_btcache_bucket_cnt_default( depth ); /* use default */
+
+  if( FD_UNLIKELY( (!depth) | (!bucket_cnt) | (bucket_cnt>(1UL<<32)) ) ) return 0UL; /* Invalid depth / bucket_cnt */
+  if( FD_UNLIKELY( depth>(ULONG_MAX/sizeof(ulong)-4UL) ) ) return 0UL; /* overflow */
+  if( FD_UNLIKELY( bucket_cnt*FD_BTCACHE_BUCKET_TAG_CNT<(depth+2UL) ) ) return 0UL; /* Too few slots (no overflow) */
+
+  ulong ring_sz = fd_ulong_align_up( (4UL+depth)*sizeof(ulong), FD_BTCACHE_BUCKET_ALIGN );
+  if( FD_UNLIKELY( ring_sz<(4UL+depth)*sizeof(ulong) ) ) return 0UL; /* overflow */
+  ulong map_sz  = bucket_cnt*sizeof(fd_btcache_bucket_t); /* no overflow */
+  ulong sz      = ring_sz + map_sz; if( FD_UNLIKELY( sz<map_sz ) ) return 0UL; /* overflow */
+  ulong footprint = fd_ulong_align_up( sz, FD_BTCACHE_ALIGN ); if( FD_UNLIKELY( footprint<sz ) ) return 0UL; /* overflow */
+  return footprint;
+}
+
+void
+fd_btcache_reset( fd_btcache_t * btcache ) {
+  ulong *               ring = fd_btcache_ring_laddr( btcache );
+  fd_btcache_bucket_t * map  = fd_btcache_map_laddr ( btcache );
+  for( ulong ring_idx=0UL; ring_idx<btcache->depth; ring_idx++ ) ring[ ring_idx ] = FD_BTCACHE_TAG_NULL;
+  for( ulong bucket_idx=0UL; bucket_idx<btcache->bucket_cnt; bucket_idx++ ) {
+    for( ulong slot_idx=0UL; slot_idx<FD_BTCACHE_BUCKET_TAG_CNT; slot_idx++ ) map[ bucket_idx ].tag[ slot_idx ] = FD_BTCACHE_TAG_NULL;
+  }
+  btcache->oldest = 0UL;
+}
+
+void *
+fd_btcache_new( void * shmem,
+                ulong  depth,
+                ulong  bucket_cnt ) {
+  if( !bucket_cnt ) bucket_cnt = fd_btcache_bucket_cnt_default( depth ); /* use default */
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_btcache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_btcache_footprint( depth, bucket_cnt );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad depth (%lu) and/or bucket_cnt (%lu)", depth, bucket_cnt ));
+    return NULL;
+  }
+
+  fd_memset( shmem, 0, footprint );
+
+  fd_btcache_t * btcache = (fd_btcache_t *)shmem;
+
+  btcache->depth      = depth;
+  btcache->bucket_cnt = bucket_cnt;
+  fd_btcache_reset( btcache );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( btcache->magic ) = FD_BTCACHE_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_btcache_t *
+fd_btcache_join( void * _btcache ) {
+
+  if( FD_UNLIKELY( !_btcache ) ) {
+    FD_LOG_WARNING(( "NULL _btcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)_btcache, fd_btcache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned _btcache" ));
+    return NULL;
+  }
+
+  fd_btcache_t * btcache = (fd_btcache_t *)_btcache;
+  if( FD_UNLIKELY( btcache->magic!=FD_BTCACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return btcache;
+}
+
+void *
+fd_btcache_leave( fd_btcache_t * btcache ) {
+
+  if( FD_UNLIKELY( !btcache ) ) {
+    FD_LOG_WARNING(( "NULL btcache" ));
+    return NULL;
+  }
+
+  return (void *)btcache;
+}
+
+void *
+fd_btcache_delete( void * _btcache ) {
+
+  if( FD_UNLIKELY( !_btcache ) ) {
+    FD_LOG_WARNING(( "NULL _btcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)_btcache, fd_btcache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned _btcache" ));
+    return NULL;
+  }
+
+  fd_btcache_t * btcache = (fd_btcache_t *)_btcache;
+  if( FD_UNLIKELY( btcache->magic != FD_BTCACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( btcache->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return _btcache;
+}
@@ -0,0 +1,359 @@
+#ifndef HEADER_fd_src_tango_tcache_fd_btcache_h
+#define HEADER_fd_src_tango_tcache_fd_btcache_h
+
+/* A fd_btcache_t is a bucketized variant of fd_tcache_t.  It has the
+   same semantics (a cache of the most recently observed depth unique
+   64-bit tags with FIFO eviction and a null tag that is never
+   inserted) but a different map layout.
+
+   The map is an array of bucket_cnt 64-byte buckets, each holding up
+   to 8 tags.  A tag lives in its home bucket unless that bucket was
+   full at insertion time, in which case it lives in the first bucket
+   after it (cyclic) that had room.  Thus a lookup is usually a single
+   cache line load and, on targets with AVX-512, a single 8-wide
+   compare.  Since probing is per bucket rather than per slot, the map
+   can run at a much higher fill ratio than the tcache map for the same
+   probe cost.  The default is a fill ratio of at most ~50%, which
+   gives ~24 bytes per tag of history (vs ~24-40 bytes per tag for
+   default tcaches).  bucket_cnt does not need to be a power of 2.
+
+   The btcache also provides batched insert / query that prefetch all
+   the buckets touched by a burst of tags before probing them, which
+   hides most of the DRAM latency of the random map accesses when used
+   with large depths (e.g. a dedup tile processing a burst of
+   signatures).
+
+   Like the tcache, tags are assumed to behave like IID random values
+   and it is strongly recommended that the btcache be backed by a
+   single gigantic page backed workspace. */
+
+#include "../fd_tango_base.h"
+
+#if FD_HAS_AVX512
+#include "../../util/simd/fd_avx512.h"
+#endif
+
+/* FD_BTCACHE_{ALIGN,FOOTPRINT} specify the alignment and footprint
+   needed for a btcache with depth history and a map with bucket_cnt
+   buckets.  depth and bucket_cnt are assumed to be valid (i.e. depth is
+   positive, bucket_cnt is in [1,2^32] with at least depth+2 slots in
+   total and the combination will not require a footprint larger than
+   ULONG_MAX).  These are provided to facilitate compile time
+   declarations. */
+
+#define FD_BTCACHE_ALIGN (128UL)
+#define FD_BTCACHE_FOOTPRINT( depth, bucket_cnt )                                   \
+  FD_LAYOUT_FINI( FD_LAYOUT_APPEND( FD_LAYOUT_APPEND( FD_LAYOUT_INIT,               \
+    FD_BTCACHE_ALIGN,        (4UL + (depth))*sizeof(ulong) ),                       \
+    FD_BTCACHE_BUCKET_ALIGN, (bucket_cnt)*sizeof(fd_btcache_bucket_t) ),            \
+    FD_BTCACHE_ALIGN )
+
+/* FD_BTCACHE_TAG_NULL is a tag value that will never be inserted. */
+
+#define FD_BTCACHE_TAG_NULL (0UL)
+
+/* FD_BTCACHE_BUCKET_{TAG_CNT,ALIGN} give the number of tags in a bucket
+   and the bucket alignment (a bucket is exactly one cache line). */
+
+#define FD_BTCACHE_BUCKET_TAG_CNT (8UL)
+#define FD_BTCACHE_BUCKET_ALIGN   (64UL)
+
+/* FD_BTCACHE_BATCH_MAX is the max number of tags that can be given to
+   the batched operations below. */
+
+#define FD_BTCACHE_BATCH_MAX (64UL)
+
+struct __attribute__((aligned(FD_BTCACHE_BUCKET_ALIGN))) fd_btcache_bucket {
+  ulong tag[ FD_BTCACHE_BUCKET_TAG_CNT ]; /* FD_BTCACHE_TAG_NULL indicates a free slot */
+};
+
+typedef struct fd_btcache_bucket fd_btcache_bucket_t;
+
+/* fd_btcache_t is an opaque handle of a btcache object.  Details are
+   exposed here to facilitate usage in performance critical contexts. */
+
+#define FD_BTCACHE_MAGIC (0xf17eda2c3b7ca540UL) /* firedancer btcash ver 0 */
+
+struct __attribute((aligned(FD_BTCACHE_ALIGN))) fd_btcache_private {
+  ulong magic;      /* ==FD_BTCACHE_MAGIC */
+  ulong depth;      /* The btcache will maintain a history of the most recent depth tags */
+  ulong bucket_cnt;
+  ulong oldest;     /* oldest is in [0,depth) */
+
+  /* depth ulong (ring): same as the tcache ring */
+
+  /* Padding to FD_BTCACHE_BUCKET_ALIGN */
+
+  /* bucket_cnt fd_btcache_bucket_t (map) */
+
+  /* Padding to FD_BTCACHE_ALIGN */
+};
+
+typedef struct fd_btcache_private fd_btcache_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_btcache_bucket_cnt_default returns the default bucket_cnt to use
+   for the given depth (a fill ratio of at most ~50%).  Returns 0 if
+   the depth is invalid / too large. */
+
+FD_FN_CONST static inline ulong
+fd_btcache_bucket_cnt_default( ulong depth ) {
+  if( FD_UNLIKELY( (!depth) | (depth>(1UL<<33)) ) ) return 0UL;
+  return (depth+5UL)/4UL; /* 8*bucket_cnt >= 2*(depth+2) */
+}
+
+/* fd_btcache_{align,footprint,new,join,leave,delete} are the same as
+   the tcache equivalents.  A bucket_cnt of 0 indicates to use
+   fd_btcache_bucket_cnt_default. */
+
+FD_FN_CONST ulong
+fd_btcache_align( void );
+
+FD_FN_CONST ulong
+fd_btcache_footprint( ulong depth,
+                      ulong bucket_cnt );
+
+void *
+fd_btcache_new( void * shmem,
+                ulong  depth,
+                ulong  bucket_cnt );
+
+fd_btcache_t *
+fd_btcache_join( void * _btcache );
+
+void *
+fd_btcache_leave( fd_btcache_t * btcache );
+
+void *
+fd_btcache_delete( void * _btcache );
+
+/* fd_btcache_{depth,bucket_cnt,oldest_laddr,ring_laddr,map_laddr}
+   return various properties of the btcache.  These assume btcache is a
+   valid local join. */
+
+FD_FN_PURE  static inline ulong   fd_btcache_depth       ( fd_btcache_t const * btcache ) { return btcache->depth;      }
+FD_FN_PURE  static inline ulong   fd_btcache_bucket_cnt  ( fd_btcache_t const * btcache ) { return btcache->bucket_cnt; }
+
+FD_FN_CONST static inline ulong * fd_btcache_oldest_laddr( fd_btcache_t * btcache ) { return &btcache->oldest; }
+FD_FN_CONST static inline ulong * fd_btcache_ring_laddr  ( fd_btcache_t * btcache ) { return ((ulong *)btcache)+4UL; }
+
+FD_FN_PURE static inline fd_btcache_bucket_t *
+fd_btcache_map_laddr( fd_btcache_t * btcache ) {
+  return (fd_btcache_bucket_t *)fd_ulong_align_up( (ulong)(((ulong *)btcache)+4UL+btcache->depth), FD_BTCACHE_BUCKET_ALIGN );
+}
+
+/* fd_btcache_reset resets a btcache to empty, the same state the
+   btcache was in at creation. */
+
+void
+fd_btcache_reset( fd_btcache_t * btcache );
+
+/* fd_btcache_bucket_start returns the home bucket of tag in a map with
+   bucket_cnt buckets.  Assumes bucket_cnt is in [1,2^32].  Uses the
+   high bits of tag so that it is independent of the tcache start slot
+   (which uses the low bits) if both are used with the same tags.
+
+   fd_btcache_bucket_next returns the next bucket to probe (cyclic). */
+
+FD_FN_CONST static inline ulong
+fd_btcache_bucket_start( ulong tag,
+                         ulong bucket_cnt ) {
+  return ((tag>>32)*bucket_cnt)>>32;
+}
+
+FD_FN_CONST static inline ulong
+fd_btcache_bucket_next( ulong idx,
+                        ulong bucket_cnt ) {
+  idx++;
+  return fd_ulong_if( idx<bucket_cnt, idx, 0UL );
+}
+
+/* fd_btcache_bucket_match returns a bit field with bit i set if
+   bucket slot i holds tag (tag can be FD_BTCACHE_TAG_NULL to find free
+   slots). */
+
+FD_FN_PURE static inline uint
+fd_btcache_bucket_match( fd_btcache_bucket_t const * bucket,
+                         ulong                       tag ) {
+# if FD_HAS_AVX512
+  return (uint)wwv_eq( wwv_ld( bucket->tag ), wwv_bcast( tag ) );
+# else
+  uint match = 0U;
+  for( ulong i=0UL; i<FD_BTCACHE_BUCKET_TAG_CNT; i++ ) match |= ((uint)(bucket->tag[ i ]==tag)) << i;
+  return match;
+# endif
+}
+
+/* fd_btcache_query returns 1 if tag is in the map and 0 otherwise.
+   Assumes tag is not null.  If found, *_bucket_idx and *_slot_idx will
+   hold its location (valid until the next map modification). */
+
+static inline int
+fd_btcache_query( fd_btcache_bucket_t const * map,
+                  ulong                       bucket_cnt,
+                  ulong                       tag,
+                  ulong *                     _bucket_idx,
+                  ulong *                     _slot_idx ) {
+  ulong bucket_idx = fd_btcache_bucket_start( tag, bucket_cnt );
+  for(;;) {
+    fd_btcache_bucket_t const * bucket = map + bucket_idx;
+    uint match = fd_btcache_bucket_match( bucket, tag );
+    if( FD_LIKELY( match ) ) {
+      *_bucket_idx = bucket_idx;
+      *_slot_idx   = (ulong)fd_uint_find_lsb( match );
+      return 1;
+    }
+    /* If the bucket has room, tag would have been put here */
+    if( FD_LIKELY( fd_btcache_bucket_match( bucket, FD_BTCACHE_TAG_NULL ) ) ) return 0;
+    bucket_idx = fd_btcache_bucket_next( bucket_idx, bucket_cnt );
+  }
+}
+
+/* fd_btcache_remove removes tag from the map.  Does nothing if tag is
+   null or not in the map.  Tags displaced from their home bucket are
+   moved back toward it to keep the invariant that every bucket from a
+   tag's home bucket up to (but not including) the bucket holding it is
+   full.  This is the bucket analog of the hole backshift in fd_map. */
+
+FD_FN_UNUSED static void /* Work around -Winline */
+fd_btcache_remove( fd_btcache_bucket_t * map,
+                   ulong                 bucket_cnt,
+                   ulong                 tag ) {
+  if( FD_UNLIKELY( tag==FD_BTCACHE_TAG_NULL ) ) return;
+
+  ulong hole_bucket;
+  ulong hole_slot;
+  if( FD_UNLIKELY( !fd_btcache_query( map, bucket_cnt, tag, &hole_bucket, &hole_slot ) ) ) return;
+
+  for(;;) {
+    int was_full = !fd_btcache_bucket_match( map + hole_bucket, FD_BTCACHE_TAG_NULL );
+    map[ hole_bucket ].tag[ hole_slot ] = FD_BTCACHE_TAG_NULL;
+
+    /* If the bucket had room before, nothing after it could have been
+       displaced past it. */
+    if( FD_LIKELY( !was_full ) ) return;
+
+    /* Find a tag in a following bucket whose home is at or before the
+       hole bucket.  Stop at the first bucket with room. */
+
+    ulong bucket_idx = hole_bucket;
+    ulong move_slot  = ULONG_MAX;
+    for(;;) {
+      bucket_idx = fd_btcache_bucket_next( bucket_idx, bucket_cnt );
+      if( FD_UNLIKELY( bucket_idx==hole_bucket ) ) return; /* wrapped around a nearly full map */
+      fd_btcache_bucket_t * bucket = map + bucket_idx;
+      ulong hole_dist = bucket_idx>=hole_bucket ? bucket_idx-hole_bucket : bucket_idx+bucket_cnt-hole_bucket;
+      for( ulong slot=0UL; slot<FD_BTCACHE_BUCKET_TAG_CNT; slot++ ) {
+        ulong t = bucket->tag[ slot ];
+        if( t==FD_BTCACHE_TAG_NULL ) continue;
+        ulong start = fd_btcache_bucket_start( t, bucket_cnt );
+        ulong dist  = bucket_idx>=start ? bucket_idx-start : bucket_idx+bucket_cnt-start;
+        if( dist>=hole_dist ) { move_slot = slot; break; }
+      }
+      if( move_slot!=ULONG_MAX ) break;
+      if( FD_LIKELY( fd_btcache_bucket_match( bucket, FD_BTCACHE_TAG_NULL ) ) ) return;
+    }
+
+    /* Move it into the hole, which moves the hole to where it was */
+
+    map[ hole_bucket ].tag[ hole_slot ] = map[ bucket_idx ].tag[ move_slot ];
+    hole_bucket = bucket_idx;
+    hole_slot   = move_slot;
+  }
+}
+
+/* fd_btcache_insert inserts tag into the btcache.  Returns 1 if tag is
+   already in the btcache (and the btcache is unchanged) and 0 if tag
+   was inserted (evicting the oldest tag if the btcache was full).
+   Assumes tag is not null.  Same non-LRU semantics as FD_TCACHE_INSERT.
+   ring, map and oldest are the unpacked btcache fields (oldest is
+   updated in place). */
+
+static inline int
+fd_btcache_insert( ulong *               oldest,
+                   ulong *               ring,
+                   ulong                 depth,
+                   fd_btcache_bucket_t * map,
+                   ulong                 bucket_cnt,
+                   ulong                 tag ) {
+  ulong bucket_idx = fd_btcache_bucket_start( tag, bucket_cnt );
+  uint  free_slots;
+  for(;;) {
+    fd_btcache_bucket_t const * bucket = map + bucket_idx;
+    if( FD_UNLIKELY( fd_btcache_bucket_match( bucket, tag ) ) ) return 1; /* application dependent branch probability */
+    free_slots = fd_btcache_bucket_match( bucket, FD_BTCACHE_TAG_NULL );
+    if( FD_LIKELY( free_slots ) ) break;
+    bucket_idx = fd_btcache_bucket_next( bucket_idx, bucket_cnt );
+  }
+
+  /* Insert tag into the map (there is always room as the map has at
+     least depth+2 slots) */
+  map[ bucket_idx ].tag[ fd_uint_find_lsb( free_slots ) ] = tag;
+
+  /* Evict oldest tag / insert tag into ring */
+  ulong _oldest    = *oldest;
+  ulong tag_oldest = ring[ _oldest ];
+  ring[ _oldest ]  = tag;
+  _oldest++;
+  *oldest = fd_ulong_if( _oldest<depth, _oldest, 0UL );
+
+  /* Remove oldest tag from map (null at startup, handled by remove) */
+  fd_btcache_remove( map, bucket_cnt, tag_oldest );
+  return 0;
+}
+
+/* fd_btcache_insert_batch inserts the tag_cnt tags in tag into the
+   btcache in order, as if by calling fd_btcache_insert for each, and
+   stores whether each tag was a duplicate in dup[i].  Duplicates of
+   earlier tags in the same batch are detected.  The buckets of all the
+   tags and of the tags they could evict are prefetched up front.
+   Assumes tag_cnt is in [0,FD_BTCACHE_BATCH_MAX] and no tags are
+   null. */
+
+static inline void
+fd_btcache_insert_batch( fd_btcache_t * btcache,
+                         ulong const *  tag,
+                         ulong          tag_cnt,
+                         int *          dup ) {
+  ulong                 depth      = btcache->depth;
+  ulong                 bucket_cnt = btcache->bucket_cnt;
+  ulong *               ring       = fd_btcache_ring_laddr( btcache );
+  fd_btcache_bucket_t * map        = fd_btcache_map_laddr( btcache );
+  ulong                 oldest     = btcache->oldest;
+
+  for( ulong i=0UL; i<tag_cnt; i++ ) __builtin_prefetch( map + fd_btcache_bucket_start( tag[ i ], bucket_cnt ) );
+  for( ulong i=0UL, j=oldest; i<tag_cnt; i++ ) {
+    __builtin_prefetch( map + fd_btcache_bucket_start( ring[ j ], bucket_cnt ) );
+    j++;
+    j = fd_ulong_if( j<depth, j, 0UL );
+  }
+
+  for( ulong i=0UL; i<tag_cnt; i++ ) dup[ i ] = fd_btcache_insert( &oldest, ring, depth, map, bucket_cnt, tag[ i ] );
+
+  btcache->oldest = oldest;
+}
+
+/* fd_btcache_query_batch stores in found[i] whether tag[i] is in the
+   btcache for i in [0,tag_cnt).  Same assumptions as
+   fd_btcache_insert_batch. */
+
+static inline void
+fd_btcache_query_batch( fd_btcache_t * btcache,
+                        ulong const *  tag,
+                        ulong          tag_cnt,
+                        int *          found ) {
+  ulong                       bucket_cnt = btcache->bucket_cnt;
+  fd_btcache_bucket_t const * map        = fd_btcache_map_laddr( btcache );
+
+  for( ulong i=0UL; i<tag_cnt; i++ ) __builtin_prefetch( map + fd_btcache_bucket_start( tag[ i ], bucket_cnt ) );
+
+  for( ulong i=0UL; i<tag_cnt; i++ ) {
+    ulong bucket_idx, slot_idx;
+    found[ i ] = fd_btcache_query( map, bucket_cnt, tag[ i ], &bucket_idx, &slot_idx );
+  }
+}
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_tango_tcache_fd_btcache_h */
@@ -0,0 +1,187 @@
+#include "../fd_tango.h"
+
+FD_STATIC_ASSERT( FD_BTCACHE_ALIGN==128UL,                unit_test );
+FD_STATIC_ASSERT( FD_BTCACHE_FOOTPRINT(1UL,1UL)==128UL,   unit_test );
+FD_STATIC_ASSERT( FD_BTCACHE_FOOTPRINT(8UL,2UL)==256UL,   unit_test );
+FD_STATIC_ASSERT( FD_BTCACHE_FOOTPRINT(9UL,2UL)==256UL,   unit_test );
+FD_STATIC_ASSERT( FD_BTCACHE_FOOTPRINT(17UL,3UL)==384UL,  unit_test );
+FD_STATIC_ASSERT( FD_BTCACHE_TAG_NULL==0UL,               unit_test );
+FD_STATIC_ASSERT( sizeof(fd_btcache_bucket_t)==64UL,      unit_test );
+
+#define DEPTH_MAX  (1024UL)
+#define BUCKET_MAX (1024UL)
+#define MAP_MAX    (4096UL)
+
+static uchar btcache_mem[ FD_BTCACHE_FOOTPRINT( DEPTH_MAX, BUCKET_MAX ) ] __attribute__((aligned(FD_BTCACHE_ALIGN)));
+static uchar tcache_mem [ FD_TCACHE_FOOTPRINT ( DEPTH_MAX, MAP_MAX    ) ] __attribute__((aligned(FD_TCACHE_ALIGN)));
+
+/* random_tag returns a non-null tag.  If cluster is non-zero, tags are
+   drawn such that their home buckets are concentrated in a few buckets
+   to exercise displacement and removal backshifting.  Tags are drawn
+   from a small pool such that duplicates are common. */
+
+static ulong
+random_tag( fd_rng_t * rng,
+            ulong      pool,
+            int        cluster ) {
+  ulong r = fd_rng_ulong_roll( rng, pool );
+  ulong hi = cluster ? ((r & 3UL) << 62) | ((r & 3UL) << 30) : fd_ulong_hash( r );
+  return (hi & ~0xffffffffUL) | (fd_ulong_hash( r ^ 0x5555UL ) & 0xffffffffUL) | 1UL;
+}
+
+/* check validates the map against the ring: each ring tag is in the
+   map, the map holds nothing else and every displaced tag has only
+   full buckets between its home bucket and its bucket. */
+
+static void
+check( fd_btcache_t * btcache ) {
+  ulong                 depth      = fd_btcache_depth     ( btcache );
+  ulong                 bucket_cnt = fd_btcache_bucket_cnt( btcache );
+  ulong *               ring       = fd_btcache_ring_laddr( btcache );
+  fd_btcache_bucket_t * map        = fd_btcache_map_laddr ( btcache );
+
+  ulong ring_cnt = 0UL;
+  for( ulong i=0UL; i<depth; i++ ) {
+    if( ring[ i ]==FD_BTCACHE_TAG_NULL ) continue;
+    ring_cnt++;
+    ulong bucket_idx, slot_idx;
+    FD_TEST( fd_btcache_query( map, bucket_cnt, ring[ i ], &bucket_idx, &slot_idx ) );
+    FD_TEST( map[ bucket_idx ].tag[ slot_idx ]==ring[ i ] );
+  }
+
+  ulong map_cnt = 0UL;
+  for( ulong bucket_idx=0UL; bucket_idx<bucket_cnt; bucket_idx++ ) {
+    for( ulong slot_idx=0UL; slot_idx<FD_BTCACHE_BUCKET_TAG_CNT; slot_idx++ ) {
+      ulong tag = map[ bucket_idx ].tag[ slot_idx ];
+      if( tag==FD_BTCACHE_TAG_NULL ) continue;
+      map_cnt++;
+      for( ulong b=fd_btcache_bucket_start( tag, bucket_cnt ); b!=bucket_idx; b=fd_btcache_bucket_next( b, bucket_cnt ) )
+        FD_TEST( !fd_btcache_bucket_match( map+b, FD_BTCACHE_TAG_NULL ) );
+    }
+  }
+  FD_TEST( map_cnt==ring_cnt );
+}
+
+static void
+test_vs_tcache( fd_rng_t * rng,
+                ulong      depth,
+                ulong      bucket_cnt,
+                ulong      pool,
+                int        cluster,
+                ulong      iter_cnt ) {
+  fd_btcache_t * btcache = fd_btcache_join( fd_btcache_new( btcache_mem, depth, bucket_cnt ) ); FD_TEST( btcache );
+  fd_tcache_t *  tcache  = fd_tcache_join ( fd_tcache_new ( tcache_mem,  depth, 0UL        ) ); FD_TEST( tcache  );
+
+  ulong *               oldest     = fd_btcache_oldest_laddr( btcache );
+  ulong *               ring       = fd_btcache_ring_laddr  ( btcache );
+  fd_btcache_bucket_t * map        = fd_btcache_map_laddr   ( btcache );
+  bucket_cnt                       = fd_btcache_bucket_cnt  ( btcache );
+
+  ulong   t_oldest  = *fd_tcache_oldest_laddr( tcache );
+  ulong * t_ring    = fd_tcache_ring_laddr( tcache );
+  ulong * t_map     = fd_tcache_map_laddr ( tcache );
+  ulong   t_map_cnt = fd_tcache_map_cnt   ( tcache );
+
+  ulong dup_cnt = 0UL;
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    ulong tag_cnt = 1UL + fd_rng_ulong_roll( rng, FD_BTCACHE_BATCH_MAX );
+    ulong tag[ FD_BTCACHE_BATCH_MAX ];
+    int   dup[ FD_BTCACHE_BATCH_MAX ];
+    int   found[ FD_BTCACHE_BATCH_MAX ];
+    for( ulong i=0UL; i<tag_cnt; i++ ) tag[ i ] = random_tag( rng, pool, cluster );
+
+    /* Query must match the reference before inserting */
+
+    fd_btcache_query_batch( btcache, tag, tag_cnt, found );
+    for( ulong i=0UL; i<tag_cnt; i++ ) {
+      int   t_found;
+      ulong t_map_idx;
+      FD_TCACHE_QUERY( t_found, t_map_idx, t_map, t_map_cnt, tag[ i ] ); (void)t_map_idx;
+      FD_TEST( found[ i ]==t_found );
+    }
+
+    /* Insert either one at a time or as a batch */
+
+    if( fd_rng_uint( rng ) & 1U ) {
+      fd_btcache_insert_batch( btcache, tag, tag_cnt, dup );
+    } else {
+      for( ulong i=0UL; i<tag_cnt; i++ ) dup[ i ] = fd_btcache_insert( oldest, ring, depth, map, bucket_cnt, tag[ i ] );
+    }
+
+    for( ulong i=0UL; i<tag_cnt; i++ ) {
+      int t_dup;
+      FD_TCACHE_INSERT( t_dup, t_oldest, t_ring, depth, t_map, t_map_cnt, tag[ i ] );
+      FD_TEST( dup[ i ]==t_dup );
+      dup_cnt += (ulong)t_dup;
+    }
+    FD_TEST( *oldest==t_oldest );
+
+    if( !(iter & 63UL) ) check( btcache );
+  }
+  check( btcache );
+  FD_TEST( dup_cnt );
+
+  /* Reset empties the btcache */
+
+  fd_btcache_reset( btcache );
+  FD_TEST( !*oldest );
+  for( ulong i=0UL; i<depth; i++ ) FD_TEST( ring[ i ]==FD_BTCACHE_TAG_NULL );
+  for( ulong b=0UL; b<bucket_cnt; b++ ) FD_TEST( fd_btcache_bucket_match( map+b, FD_BTCACHE_TAG_NULL )==0xffU );
+
+  FD_TEST( fd_btcache_delete( fd_btcache_leave( btcache ) )==btcache_mem );
+  FD_TEST( fd_tcache_delete ( fd_tcache_leave ( tcache  ) )==tcache_mem  );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  FD_TEST( fd_btcache_align()==FD_BTCACHE_ALIGN );
+  FD_TEST( !fd_btcache_footprint( 0UL, 1UL ) );
+  FD_TEST( !fd_btcache_footprint( ULONG_MAX, 0UL ) );
+  FD_TEST( !fd_btcache_footprint( 1UL, (1UL<<32)+1UL ) );
+  FD_TEST( !fd_btcache_footprint( 7UL, 1UL ) ); /* needs depth+2 slots */
+  FD_TEST(  fd_btcache_footprint( 6UL, 1UL )==FD_BTCACHE_FOOTPRINT( 6UL, 1UL ) );
+  FD_TEST( fd_btcache_bucket_cnt_default( 0UL )==0UL );
+  FD_TEST( fd_btcache_bucket_cnt_default( 1UL )==1UL );
+  FD_TEST( fd_btcache_bucket_cnt_default( 3UL )==2UL );
+  for( ulong rem=1000000UL; rem; rem-- ) {
+    ulong depth      = fd_rng_ulong_roll( rng, 1024UL );
+    ulong bucket_cnt = fd_rng_ulong_roll( rng, 256UL  );
+    ulong footprint  = fd_btcache_footprint( depth, bucket_cnt );
+    if( !bucket_cnt ) bucket_cnt = fd_btcache_bucket_cnt_default( depth );
+    if( (!depth) || bucket_cnt*FD_BTCACHE_BUCKET_TAG_CNT<depth+2UL ) FD_TEST( !footprint );
+    else FD_TEST( footprint==FD_BTCACHE_FOOTPRINT( depth, bucket_cnt ) );
+  }
+
+  for( ulong i=0UL; i<1000000UL; i++ ) {
+    ulong bucket_cnt = 1UL + fd_rng_ulong_roll( rng, 1000UL );
+    FD_TEST( fd_btcache_bucket_start( fd_rng_ulong( rng ), bucket_cnt )<bucket_cnt );
+  }
+
+  FD_TEST( !fd_btcache_new ( NULL,             16UL, 0UL ) );
+  FD_TEST( !fd_btcache_new ( btcache_mem+1UL,  16UL, 0UL ) );
+  FD_TEST( !fd_btcache_new ( btcache_mem,       0UL, 0UL ) );
+  FD_TEST( !fd_btcache_join( NULL            ) );
+  FD_TEST( !fd_btcache_join( btcache_mem+1UL ) );
+
+  /* Sparse default maps, minimal maps (lots of displacement), and
+     clustered tags (long displacement chains and wrap around) */
+
+  test_vs_tcache( rng,     1UL,   0UL,   4UL, 0, 10000UL );
+  test_vs_tcache( rng,    30UL,   4UL,  64UL, 0, 10000UL );
+  test_vs_tcache( rng,   100UL,   0UL, 256UL, 0, 10000UL );
+  test_vs_tcache( rng,  1000UL, 126UL, 2048UL, 0, 10000UL );
+  test_vs_tcache( rng,  1000UL,   0UL, 2048UL, 1, 10000UL );
+  test_vs_tcache( rng,   254UL,  32UL, 512UL, 1, 10000UL );
+  test_vs_tcache( rng, DEPTH_MAX, 0UL, 4096UL, 0, 10000UL );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
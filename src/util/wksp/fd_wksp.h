@@ -165,6 +165,12 @@
 struct fd_wksp_private;
 typedef struct fd_wksp_private fd_wksp_t;
 
+/* A fd_wksp_delta_t * is an opaque handle of a delta checkpt tracker
+   (see fd_wksp_checkpt_delta_tpool below) */
+
+struct fd_wksp_delta_private;
+typedef struct fd_wksp_delta_private fd_wksp_delta_t;
+
 /* A fd_wksp_usage_t is used to return workspace usage stats. */
 
 struct fd_wksp_usage {
@@ -982,7 +988,10 @@ fd_wksp_pod_unmap( void * obj );
    use FD_WKSP_CHECKPT_STYLE_DEFAULT).  uinfo points to a cstr with
    optional additional user context (NULL will be treated as the empty
    string "" ... if the strlen is longer than 16384 bytes, the info will
-   be truncated to a strlen of 16383).
+   be truncated to a strlen of 16383).  V2 and V3 style checkpts are
+   thread parallel and the checkpt is the same regardless of the number
+   of threads used (the file will be temporarily sparse while the
+   checkpt is in progress).
 
    Returns FD_WKSP_SUCCESS (0) on success or a FD_WKSP_ERR_* on failure
    (logs details).  Reasons for failure include INVAL (NULL wksp, NULL
@@ -1012,6 +1021,96 @@ fd_wksp_checkpt( fd_wksp_t *  wksp,
   return fd_wksp_checkpt_tpool( NULL, 0UL, 1UL, wksp, path, mode, style, uinfo );
 }
 
+/* fd_wksp_checkpt_delta_tpool is the same as fd_wksp_checkpt_tpool but
+   writes a delta checkpt.  A delta checkpt only contains the data of
+   allocations that changed since the previous checkpt tracked by delta
+   (the "parent") and a hash for each unchanged allocation.  It chains
+   onto its parent: restoring the parent and then the delta with
+   fd_wksp_restore_tpool reproduces the wksp state at the delta (e.g.
+   restore the chain's first checkpt and then each delta in order).
+   Unchanged allocations are verified against their hash on restore so
+   restoring a delta onto anything other than its parent will fail.
+
+   delta should be a current local join to a delta tracker created for
+   a part_max at least wksp's part_max.  If delta has no parent (e.g.
+   it was just created, it was reset or the previous checkpt with it
+   failed), this will write a full checkpt (restorable on its own) that
+   starts a new chain.  style should be V2 or V3 (or 0 for the default).
+
+   Changes are detected by hashing every allocation.  This needs no
+   cooperation from the (potentially many) processes writing to wksp
+   but does cost a pass reading the allocated wksp data.  The hash is a
+   64-bit non-cryptographic fd_hash, so a change that collides with the
+   previous hash is silently missed (~2^-64 odds for non-adversarial
+   data).  As with
+   fd_wksp_checkpt_tpool, wksp should not be modified while the checkpt
+   is in progress.
+
+   Returns FD_WKSP_SUCCESS (0) on success or a FD_WKSP_ERR_* on failure
+   (logs details).  Reasons for failure are the same as
+   fd_wksp_checkpt_tpool and INVAL (NULL delta, delta part_max too
+   small, unsupported style).  On failure, delta will have no parent.
+
+   fd_wksp_checkpt_delta is a convenience wrapper for serial delta
+   checkpts. */
+
+int
+fd_wksp_checkpt_delta_tpool( fd_tpool_t *      tpool,
+                             ulong             t0,
+                             ulong             t1,
+                             fd_wksp_t *       wksp,
+                             fd_wksp_delta_t * delta,
+                             char const *      path,
+                             ulong             mode,
+                             int               style,
+                             char const *      uinfo );
+
+static inline int
+fd_wksp_checkpt_delta( fd_wksp_t *       wksp,
+                       fd_wksp_delta_t * delta,
+                       char const *      path,
+                       ulong             mode,
+                       int               style,
+                       char const *      uinfo ) {
+  return fd_wksp_checkpt_delta_tpool( NULL, 0UL, 1UL, wksp, delta, path, mode, style, uinfo );
+}
+
+/* fd_wksp_delta_{align,footprint,new,join,leave,delete} give the usual
+   object lifecycle for a delta checkpt tracker that can track wksps
+   with up to part_max partitions.  The footprint is O(part_max) (~48
+   bytes per partition).  A new tracker has no parent. */
+
+FD_FN_CONST ulong
+fd_wksp_delta_align( void );
+
+FD_FN_CONST ulong
+fd_wksp_delta_footprint( ulong part_max );
+
+void *
+fd_wksp_delta_new( void * shmem,
+                   ulong  part_max );
+
+fd_wksp_delta_t *
+fd_wksp_delta_join( void * shdelta );
+
+void *
+fd_wksp_delta_leave( fd_wksp_delta_t * delta );
+
+void *
+fd_wksp_delta_delete( void * shdelta );
+
+/* fd_wksp_delta_reset makes the next checkpt with delta a full checkpt.
+   Returns delta.  fd_wksp_delta_gen returns the number of checkpts
+   made with delta so far and fd_wksp_delta_has_parent returns 1 if the
+   next checkpt with delta will be a delta checkpt and 0 otherwise.
+   These assume delta is a current local join. */
+
+fd_wksp_delta_t *
+fd_wksp_delta_reset( fd_wksp_delta_t * delta );
+
+FD_FN_PURE ulong fd_wksp_delta_gen       ( fd_wksp_delta_t const * delta );
+FD_FN_PURE int   fd_wksp_delta_has_parent( fd_wksp_delta_t const * delta );
+
 /* fd_wksp_restore_tpool will replace all allocations in the current
    workspace with the allocations from the checkpt at path.  The
    restored workspace will use the given seed.  Tpool threads [t0,t1)
@@ -1038,6 +1137,11 @@ fd_wksp_checkpt( fd_wksp_t *  wksp,
    process began (a best effort to reset wksp to the empty state was
    done before return).
 
+   If path is a delta checkpt (see fd_wksp_checkpt_delta_tpool), wksp
+   should hold the state of the delta's parent checkpt (e.g. the
+   parent was the most recent checkpt restored into wksp).  If not, the
+   restore will fail.
+
    fd_wksp_restore is a convenience wrapper for serial restores. */
 
 int
@@ -10,22 +10,289 @@
 
 #define FD_WKSP_CHECKPT_V2_CGROUP_MAX (1024UL)
 
-int
-fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
-                            ulong        t0,
-                            ulong        t1,
-                            fd_wksp_t *  wksp,
-                            char const * path,
-                            ulong        mode,
-                            char const * uinfo,
-                            int          frame_style_compressed ) {
+/* fd_wksp_private_checkpt_v2_cgroup writes the frame for the cgroup
+   whose partitions are given by the linked list headed by head_cidx
+   to checkpt (which can be in streaming or mmio mode).  On success,
+   returns FD_WKSP_SUCCESS and *_frame_off_{lo,hi} will hold the checkpt
+   offsets of the first byte and one past the last byte of the frame.
+   On failure, returns FD_WKSP_ERR_FAIL (logs details) and checkpt will
+   be failed.  The frame bytes depend only on the cgroup's partitions
+   (not on where the frame is written), which is what lets
+   fd_wksp_private_checkpt_v2_node below write cgroup frames in
+   parallel and still produce the same checkpt as a serial writer.
+
+   If delta is non-NULL, the checkpt is generation delta->gen of a
+   delta chain and delta->parent indicates if generation delta->gen-1
+   is its parent.  The cgroup partitions are hashed, partitions that
+   are unchanged from the parent are written as clean and the tracking
+   for the cgroup partitions is updated. */
+
+static int
+fd_wksp_private_checkpt_v2_cgroup( fd_checkpt_t *    checkpt,
+                                   fd_wksp_t *       wksp,
+                                   fd_wksp_delta_t * delta,
+                                   uint              head_cidx,
+                                   int               frame_style,
+                                   ulong *           _frame_off_lo,
+                                   ulong *           _frame_off_hi ) {
+
+  fd_wksp_private_pinfo_t *      pinfo = fd_wksp_private_pinfo( wksp );
+  fd_wksp_delta_private_part_t * part  = delta ? fd_wksp_delta_private_part( delta ) : NULL;
+
+  int err = fd_checkpt_open_advanced( checkpt, frame_style, _frame_off_lo ); /* logs details */
+  if( FD_UNLIKELY( err ) ) goto fail;
+
+  /* Write cgroup commands */
+
+  fd_wksp_checkpt_v2_cmd_t cmd[1];
+
+  ulong part_idx = fd_wksp_private_pinfo_idx( head_cidx );
+  while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
+
+    /* Command: "meta (tag,gaddr_lo,gaddr_hi)" */
+
+    ulong tag      = pinfo[ part_idx ].tag;      /* Note: non-zero */
+    ulong gaddr_lo = pinfo[ part_idx ].gaddr_lo;
+    ulong gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+
+    cmd->meta.tag      = tag;
+    cmd->meta.gaddr_lo = gaddr_lo;
+    cmd->meta.gaddr_hi = gaddr_hi;
+
+    if( delta ) {
+
+      /* Determine if this partition is unchanged from the parent
+         checkpt and update its tracking */
+
+      fd_wksp_delta_private_part_t * p = part + part_idx;
+
+      ulong gen   = delta->gen;
+      ulong hash  = fd_hash( (ulong)wksp->seed, fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
+      int   clean = delta->parent & (p->gen_seen==gen-1UL) &
+                    (p->gaddr_lo==gaddr_lo) & (p->gaddr_hi==gaddr_hi) & (p->tag==tag) & (p->hash==hash);
+
+      p->gaddr_lo = gaddr_lo;
+      p->gaddr_hi = gaddr_hi;
+      p->tag      = tag;
+      p->hash     = hash;
+      p->gen_seen = gen;
+      p->gen_data = fd_ulong_if( clean, p->gen_data, gen );
+
+      cmd->meta.gaddr_hi |= fd_ulong_if( clean, FD_WKSP_CHECKPT_V2_META_CLEAN, 0UL );
+    }
+
+    err = fd_checkpt_meta( checkpt, cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) ); /* logs details */
+    if( FD_UNLIKELY( err ) ) goto fail;
+
+    part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+  }
+
+  /* Command: "corresponding data follows" */
+
+  cmd->data.tag        = 0UL;
+  cmd->data.cgroup_cnt = ULONG_MAX;
+  cmd->data.frame_off  = ULONG_MAX;
+
+  err = fd_checkpt_meta( checkpt, cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) ); /* logs details */
+  if( FD_UNLIKELY( err ) ) goto fail;
+
+  /* Write cgroup partition data (just the hash for clean partitions) */
+
+  part_idx = fd_wksp_private_pinfo_idx( head_cidx );
+  while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
+    ulong gaddr_lo = pinfo[ part_idx ].gaddr_lo;
+    ulong gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+
+    if( FD_UNLIKELY( delta ) && part[ part_idx ].gen_data!=delta->gen )
+      err = fd_checkpt_data( checkpt, &part[ part_idx ].hash, sizeof(ulong) ); /* logs details */
+    else
+      err = fd_checkpt_data( checkpt, fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo ); /* logs details */
+    if( FD_UNLIKELY( err ) ) goto fail;
+
+    part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+  }
+
+  err = fd_checkpt_close_advanced( checkpt, _frame_off_hi ); /* logs details */
+  if( FD_UNLIKELY( err ) ) goto fail;
+
+  return FD_WKSP_SUCCESS;
+
+fail:
+  FD_LOG_WARNING(( "checkpt cgroup failed (%i-%s)", err, fd_checkpt_strerror( err ) ));
+  return FD_WKSP_ERR_FAIL;
+}
+
+/* fd_wksp_private_checkpt_v2_cgroup_sz_max returns an upper bound on
+   the number of bytes fd_wksp_private_checkpt_v2_cgroup will write for
+   the cgroup whose partitions are given by the linked list headed by
+   head_cidx.  This is exact for raw frames of full checkpts.  For
+   compressed frames, this assumes every chunk given to the compressor
+   is incompressible (see FD_CHECKPT_PRIVATE_CSZ_MAX).  For delta
+   checkpts, this assumes any partition might be written as clean. */
+
+static ulong
+fd_wksp_private_checkpt_v2_cgroup_sz_max( fd_wksp_t * wksp,
+                                          int         delta,
+                                          uint        head_cidx,
+                                          int         frame_style ) {
+
+  fd_wksp_private_pinfo_t * pinfo = fd_wksp_private_pinfo( wksp );
+
+  int   raw        = (frame_style==FD_CHECKPT_FRAME_STYLE_RAW);
+  ulong cmd_sz     = sizeof(fd_wksp_checkpt_v2_cmd_t);
+  ulong cmd_sz_max = fd_ulong_if( raw, cmd_sz, FD_CHECKPT_PRIVATE_CSZ_MAX( cmd_sz ) );
+  ulong chunk_max  = FD_CHECKPT_PRIVATE_CHUNK_USZ_MAX;
+
+  ulong sz_max = cmd_sz_max; /* "corresponding data follows" */
+
+  ulong part_idx = fd_wksp_private_pinfo_idx( head_cidx );
+  while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
+    ulong sz = pinfo[ part_idx ].gaddr_hi - pinfo[ part_idx ].gaddr_lo; /* positive */
+    sz = fd_ulong_if( delta, fd_ulong_max( sz, sizeof(ulong) ), sz );
+
+    ulong chunk_cnt = sz / chunk_max;
+    ulong chunk_rem = sz - chunk_cnt*chunk_max;
+
+    sz_max += cmd_sz_max + fd_ulong_if( raw, sz, chunk_cnt*FD_CHECKPT_PRIVATE_CSZ_MAX( chunk_max )
+                                                 + fd_ulong_if( !!chunk_rem, FD_CHECKPT_PRIVATE_CSZ_MAX( chunk_rem ), 0UL ) );
+
+    part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+  }
+
+  return sz_max;
+}
+
+/* A fd_wksp_private_checkpt_v2_region_t gives the file region reserved
+   for a cgroup frame in a parallel checkpt.  The region for cgroup
+   cgroup_idx is [region[cgroup_idx].off,region[cgroup_idx+1].off) and
+   the size of the frame written into it is region[cgroup_idx].sz. */
+
+struct fd_wksp_private_checkpt_v2_region {
+  ulong off;
+  ulong sz;
+};
+
+typedef struct fd_wksp_private_checkpt_v2_region fd_wksp_private_checkpt_v2_region_t;
+
+/* fd_wksp_private_checkpt_v2_node dispatches cgroup checkpt work to
+   tpool threads [t0,t1).  Each cgroup frame is written with its own
+   mmio checkpt into its cgroup_region of the memory mapped checkpt file
+   whose first byte is at mmio.  If any errors were
+   encountered, returns the first error encountered on the lowest
+   indexed thread in the int location pointed to by _err.  Assumes
+   caller is thread t0 and threads (t0,t1) are available.  Structured
+   the same as fd_wksp_private_restore_v2_node. */
+
+static void
+fd_wksp_private_checkpt_v2_node( void * tpool,
+                                 ulong  tpool_t0,
+                                 ulong  tpool_t1,          /* Assumes t1>t0 */
+                                 void * _wksp,
+                                 void * _delta,
+                                 ulong  _mmio,
+                                 ulong  _cgroup_head_cidx,
+                                 ulong  _cgroup_region,
+                                 ulong  _cgroup_nxt,
+                                 ulong  cgroup_cnt,
+                                 ulong  _err,
+                                 ulong  frame_style ) {
+
+  /* This node is responsible for threads [t0,t1).  If this range has
+     more than one thread, split the range into left and right halves,
+     have the first right half thread handle the right half, use this
+     thread to handle the left half and then reduce the results from
+     the two halves. */
+
+  ulong tpool_cnt = tpool_t1 - tpool_t0;
+  if( tpool_cnt>1UL ) {
+    ulong tpool_ts = tpool_t0 + fd_tpool_private_split( tpool_cnt );
+
+    int err0;
+    int err1;
+
+    fd_tpool_exec( tpool, tpool_ts, fd_wksp_private_checkpt_v2_node,
+                   tpool, tpool_ts, tpool_t1, _wksp, _delta, _mmio, _cgroup_head_cidx, _cgroup_region,
+                   _cgroup_nxt, cgroup_cnt, (ulong)&err1, frame_style );
+    fd_wksp_private_checkpt_v2_node(
+                   tpool, tpool_t0, tpool_ts, _wksp, _delta, _mmio, _cgroup_head_cidx, _cgroup_region,
+                   _cgroup_nxt, cgroup_cnt, (ulong)&err0, frame_style );
+    fd_tpool_wait( tpool, tpool_ts );
+
+    *(int *)_err = fd_int_if( !!err0, err0, err1 ); /* Return first error encountered */
+    return;
+  }
+
+  /* This node is responsible for a single thread.  Unpack the input
+     arguments. */
+
+  fd_wksp_t *                           wksp             = (fd_wksp_t *)                          _wksp;
+  fd_wksp_delta_t *                     delta            = (fd_wksp_delta_t *)                    _delta;
+  uchar *                               mmio             = (uchar *)                              _mmio;
+  uint const *                          cgroup_head_cidx = (uint *)                               _cgroup_head_cidx;
+  fd_wksp_private_checkpt_v2_region_t * cgroup_region    = (fd_wksp_private_checkpt_v2_region_t *)_cgroup_region;
+
+  int err = FD_WKSP_SUCCESS;
+
+  for(;;) {
+
+    /* Get the next cgroup to checkpt (dynamic task queue model, see
+       fd_wksp_private_restore_v2_node for details). */
+
+#   if FD_HAS_ATOMIC
+    FD_COMPILER_MFENCE();
+    ulong cgroup_idx = FD_ATOMIC_FETCH_AND_ADD( (ulong *)_cgroup_nxt, 1UL );
+    FD_COMPILER_MFENCE();
+#   else /* Note: this assumes platforms without HAS_ATOMIC will not be running this multithreaded */
+    ulong cgroup_idx = (*(ulong *)_cgroup_nxt)++;
+#   endif
+
+    if( FD_UNLIKELY( cgroup_idx>=cgroup_cnt ) ) break; /* No more cgroups to process */
+
+    /* Checkpt this cgroup into its reserved region.  Since a checkpt
+       object can't be used concurrently by multiple threads, each
+       cgroup gets its own. */
+
+    ulong reserve_lo = cgroup_region[ cgroup_idx       ].off;
+    ulong reserve_hi = cgroup_region[ cgroup_idx + 1UL ].off;
+
+    fd_checkpt_t   _checkpt[1];
+    fd_checkpt_t * checkpt = fd_checkpt_init_mmio( _checkpt, mmio + reserve_lo, reserve_hi - reserve_lo ); /* logs details */
+    if( FD_UNLIKELY( !checkpt ) ) {
+      err = FD_WKSP_ERR_FAIL;
+      break;
+    }
+
+    ulong frame_off_lo;
+    ulong frame_off_hi;
+    err = fd_wksp_private_checkpt_v2_cgroup( checkpt, wksp, delta, cgroup_head_cidx[ cgroup_idx ], (int)frame_style,
+                                             &frame_off_lo, &frame_off_hi ); /* logs details */
+
+    fd_checkpt_fini( checkpt ); /* Not in a frame at this point so can't fail */
 
-  (void)tpool; (void)t0; (void)t1; /* Thread parallelization not currently implemented */
+    if( FD_UNLIKELY( err ) ) break; /* abort if we encountered an error */
+
+    cgroup_region[ cgroup_idx ].sz = frame_off_hi - frame_off_lo;
+  }
+
+  *(int *)_err = err;
+}
+
+int
+fd_wksp_private_checkpt_v2( fd_tpool_t *      tpool,
+                            ulong             t0,
+                            ulong             t1,
+                            fd_wksp_t *       wksp,
+                            char const *      path,
+                            ulong             mode,
+                            char const *      uinfo,
+                            int               frame_style_compressed,
+                            fd_wksp_delta_t * delta ) {
 
   char const * binfo = fd_log_build_info;
 
   if( FD_UNLIKELY( !fd_checkpt_frame_style_is_supported( frame_style_compressed ) ) ) {
     FD_LOG_WARNING(( "compressed frames are not supported on this target" ));
+    if( delta ) delta->parent = 0; /* Next delta checkpt will be full */
     return FD_WKSP_ERR_INVAL;
   }
 
@@ -34,6 +301,8 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
   int            locked  =  0;
   int            fd      = -1;
   fd_checkpt_t * checkpt = NULL;
+  void *         mmio    = NULL;
+  ulong          mmio_sz = 0UL;
 
   fd_wksp_private_pinfo_t * pinfo = fd_wksp_private_pinfo( wksp );
 
@@ -57,6 +326,16 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
     locked = 1;
   }
 
+  /* Start a new generation of the delta chain.  This is a delta checkpt
+     if the previous generation succeeded (is a valid parent) and a full
+     checkpt otherwise. */
+
+  uint is_delta = 0U;
+  if( delta ) {
+    delta->gen++;
+    is_delta = (uint)delta->parent;
+  }
+
   /* Determine a reasonable number of cgroups (note: in principle we
      could thread parallelize this but it probably isn't worth the extra
      complexity). */
@@ -275,10 +554,10 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
 
   {
     mode_t old_mask = umask( (mode_t)0 );
-    fd = open( path, O_CREAT|O_EXCL|O_WRONLY, (mode_t)mode );
+    fd = open( path, O_CREAT|O_EXCL|O_RDWR, (mode_t)mode ); /* Note: read access needed to memory map the file */
     umask( old_mask );
     if( FD_UNLIKELY( fd==-1 ) ) {
-      FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed opening file with flags_O_CREAT|O_EXCL|O_WRONLY in mode 0%03lo "
+      FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed opening file with flags_O_CREAT|O_EXCL|O_RDWR in mode 0%03lo "
                       "(%i-%s); attempting to continue", name, path, mode, errno, fd_io_strerror( errno ) ));
       err_fail = FD_WKSP_ERR_FAIL;
       goto fail;
@@ -288,7 +567,8 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
   /* Initialize the checkpt */
 
   ulong frame_off[ FD_WKSP_CHECKPT_V2_CGROUP_MAX+6UL ];
-  ulong frame_cnt = 0UL;
+  ulong frame_cnt      = 0UL;
+  ulong frame_off_base = 0UL; /* File offset of checkpt offset 0 (non-zero if checkpt was restarted after parallel cgroups) */
 
   fd_checkpt_t  _checkpt[ 1 ];
   uchar         wbuf[ FD_CHECKPT_WBUF_MIN ];
@@ -308,6 +588,7 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
       err_fail = FD_WKSP_ERR_FAIL;                                                                                     \
       goto fail;                                                                                                       \
     }                                                                                                                  \
+    frame_off[ frame_cnt ] += frame_off_base;                                                                          \
   } while(0)
 
 # define CHECKPT_CLOSE() do {                                                                                       \
@@ -319,6 +600,7 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
       err_fail = FD_WKSP_ERR_FAIL;                                                                                  \
       goto fail;                                                                                                    \
     }                                                                                                               \
+    frame_off[ frame_cnt ] += frame_off_base;                                                                       \
   } while(0)
 
   /* Note: sz must be at most FD_CHECKPT_META_MAX */
@@ -353,7 +635,7 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
     hdr->magic                  = wksp->magic;
     hdr->style                  = FD_WKSP_CHECKPT_STYLE_V2;
     hdr->frame_style_compressed = frame_style_compressed;
-    hdr->reserved               = 0U;
+    hdr->delta                  = is_delta;
     memset( hdr->name, 0,    FD_SHMEM_NAME_MAX ); /* Make sure trailing zeros clear */
     memcpy( hdr->name, name, name_len          );
     hdr->seed                   = wksp->seed;
@@ -413,57 +695,154 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
   /* Checkpt the volume cgroups.  Note: This implementation just
      checkpoints 1 volume with at most CGROUP_MAX cgroup_cnt groups.
 
-     Note: this loop can be parallelized over multiple threads if
-     willing to leave holes in the file (and then maybe do a second pass
-     to compact the holes or maybe do a planning pass and then a real
-     pass or maybe leave the holes and do a second pass of run length
-     and entropy coding or maybe write to separate files and distribute
-     as a multiple files or maybe use non-POSIX filesystem mojo to
-     stitch together the separate files to appear as one file or ...) */
-
-  for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) {
+     If we have multiple threads available, the cgroup frames are
+     written in parallel.  Since the compressed size of a frame isn't
+     known until it is written, we reserve a region in the file for each
+     cgroup frame large enough to hold the frame in the worst case,
+     allocate the disk blocks backing the regions, memory map the file,
+     have the threads write the frames into their regions and then
+     compact the frames down to be contiguous.  Because each frame's bytes are
+     independent of where it was written, the resulting checkpt is
+     identical to the serial one below regardless of the number of
+     threads.  The compaction costs an extra pass over the compressed
+     frames (raw frames exactly fill their regions and don't move).
+
+     The blocks must be allocated up front (a ftruncate alone would
+     leave holes): a store through the mapping into a hole that can't
+     be filled because the disk is full or a quota is exceeded raises
+     SIGBUS in the writer threads instead of returning an error.  If the
+     space can't be allocated or the file can't be memory mapped, we
+     fall back to the serial streaming writer, which reports such
+     errors normally.
+
+     (Alternatives like doing a planning pass to size the frames or
+     writing to separate files and stitching them together with
+     non-POSIX filesystem mojo are possible too.) */
+
+  int parallel = (!!tpool) & (t1-t0>1UL) & (cgroup_cnt>1UL);
+
+  fd_wksp_private_checkpt_v2_region_t cgroup_region[ FD_WKSP_CHECKPT_V2_CGROUP_MAX+1UL ];
+
+  if( parallel ) {
+
+    /* Reserve a worst case region for each cgroup frame after the info
+       frame (the streaming checkpt was flushed when that frame was
+       closed). */
+
+    ulong off = frame_off[ frame_cnt ];
+    for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) {
+      cgroup_region[ cgroup_idx ].off = off;
+      off += fd_wksp_private_checkpt_v2_cgroup_sz_max( wksp, !!delta, cgroup_head_cidx[ cgroup_idx ], frame_style_compressed );
+    }
+    cgroup_region[ cgroup_cnt ].off = off;
+
+    int err = posix_fallocate( fd, (off_t)frame_off[ frame_cnt ], (off_t)(off-frame_off[ frame_cnt ]) );
+    if( FD_UNLIKELY( err ) ) {
+      FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed to allocate %lu bytes (%i-%s); falling back to streaming",
+                       name, path, off-frame_off[ frame_cnt ], err, fd_io_strerror( err ) ));
+    } else {
+      err = fd_io_mmio_init( fd, FD_IO_MMIO_MODE_READ_WRITE, &mmio, &mmio_sz );
+      if( FD_UNLIKELY( err ) ) {
+        FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed to memory map (%i-%s); falling back to streaming",
+                         name, path, err, fd_io_strerror( err ) ));
+        mmio    = NULL;
+        mmio_sz = 0UL;
+      }
+    }
 
-    CHECKPT_OPEN( frame_style_compressed );
+    if( FD_UNLIKELY( err ) ) {
 
-    /* Write cgroup commands */
+      /* Drop whatever part of the reservation was made (a failed
+         posix_fallocate can leave the file partially extended) */
 
-    fd_wksp_checkpt_v2_cmd_t cmd[1];
+      parallel = 0;
+      if( FD_UNLIKELY( ftruncate( fd, (off_t)frame_off[ frame_cnt ] ) ) ) {
+        FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when truncating (%i-%s); attempting to continue",
+                         name, path, errno, fd_io_strerror( errno ) ));
+        err_fail = FD_WKSP_ERR_FAIL;
+        goto fail;
+      }
+    }
+  }
 
-    ulong part_idx = fd_wksp_private_pinfo_idx( cgroup_head_cidx[ cgroup_idx ] );
-    while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
+  if( parallel ) {
 
-      /* Command: "meta (tag,gaddr_lo,gaddr_hi)" */
+    /* Write the cgroup frames in parallel */
 
-      cmd->meta.tag      = pinfo[ part_idx ].tag;      /* Note: non-zero */
-      cmd->meta.gaddr_lo = pinfo[ part_idx ].gaddr_lo;
-      cmd->meta.gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+    ulong cgroup_nxt[1];
 
-      CHECKPT_META( cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) );
+    FD_COMPILER_MFENCE();
+    FD_VOLATILE( cgroup_nxt[0] ) = 0UL;
+    FD_COMPILER_MFENCE();
 
-      part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+    int err;
+    fd_wksp_private_checkpt_v2_node( (void *)tpool, t0, t1, (void *)wksp, (void *)delta, (ulong)mmio, (ulong)cgroup_head_cidx,
+                                     (ulong)cgroup_region, (ulong)cgroup_nxt, cgroup_cnt, (ulong)&err,
+                                     (ulong)frame_style_compressed ); /* logs details */
+    if( FD_UNLIKELY( err ) ) {
+      FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when writing cgroups; attempting to continue", name, path ));
+      err_fail = FD_WKSP_ERR_FAIL;
+      goto fail;
     }
 
-    /* Command: "corresponding data follows" */
+    /* Compact the cgroup frames */
 
-    cmd->data.tag        = 0UL;
-    cmd->data.cgroup_cnt = ULONG_MAX;
-    cmd->data.frame_off  = ULONG_MAX;
+    ulong off = frame_off[ frame_cnt ];
+    for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) {
+      ulong src = cgroup_region[ cgroup_idx ].off;
+      ulong sz  = cgroup_region[ cgroup_idx ].sz;
+      if( src!=off ) memmove( (uchar *)mmio + off, (uchar *)mmio + src, sz );
+      frame_off[ frame_cnt ] = off;
+      frame_cnt++;
+      off += sz;
+    }
+    frame_off[ frame_cnt ] = off;
 
-    CHECKPT_META( cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) );
+    fd_io_mmio_fini( mmio, mmio_sz );
+    mmio    = NULL;
+    mmio_sz = 0UL;
 
-    /* Write cgroup partition data */
+    /* Trim the file to the compacted size and restart the streaming
+       checkpt at the end of the cgroup frames. */
 
-    part_idx = fd_wksp_private_pinfo_idx( cgroup_head_cidx[ cgroup_idx ] );
-    while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
-      ulong gaddr_lo = pinfo[ part_idx ].gaddr_lo;
-      ulong gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+    if( FD_UNLIKELY( ftruncate( fd, (off_t)off ) ) || FD_UNLIKELY( lseek( fd, (off_t)off, SEEK_SET )!=(off_t)off ) ) {
+      FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when compacting (%i-%s); attempting to continue",
+                       name, path, errno, fd_io_strerror( errno ) ));
+      err_fail = FD_WKSP_ERR_FAIL;
+      goto fail;
+    }
 
-      CHECKPT_DATA( fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
+    if( FD_UNLIKELY( !fd_checkpt_fini( checkpt ) ) ) { /* logs details */
+      FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when finalizing; attempting to continue", name, path ));
+      checkpt  = NULL;
+      err_fail = FD_WKSP_ERR_FAIL;
+      goto fail;
+    }
 
-      part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+    checkpt = fd_checkpt_init_stream( _checkpt, fd, wbuf, FD_CHECKPT_WBUF_MIN ); /* logs details */
+    if( FD_UNLIKELY( !checkpt ) ) {
+      FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when initializing; attempting to continue", name, path ));
+      err_fail = FD_WKSP_ERR_FAIL;
+      goto fail;
     }
 
-    CHECKPT_CLOSE();
+    frame_off_base = off;
+
+  } else {
+
+    /* Write the cgroup frames serially */
+
+    for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) {
+      int err = fd_wksp_private_checkpt_v2_cgroup( checkpt, wksp, delta, cgroup_head_cidx[ cgroup_idx ], frame_style_compressed,
+                                                   &frame_off[ frame_cnt ], &frame_off[ frame_cnt+1UL ] ); /* logs details */
+      if( FD_UNLIKELY( err ) ) {
+        FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when writing cgroup %lu; attempting to continue",
+                         name, path, cgroup_idx ));
+        err_fail = FD_WKSP_ERR_FAIL;
+        goto fail;
+      }
+      frame_cnt++;
+    }
 
   }
 
@@ -529,7 +908,7 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
     ftr->seed                        = wksp->seed;
     memset( ftr->name, 0,    FD_SHMEM_NAME_MAX ); /* Make sure trailing zeros clear */
     memcpy( ftr->name, name, name_len          );
-    ftr->reserved                    = 0U;
+    ftr->delta                       = is_delta;
     ftr->frame_style_compressed      = frame_style_compressed;
     ftr->style                       = FD_WKSP_CHECKPT_STYLE_V2;
     ftr->unmagic                     = ~wksp->magic;
@@ -562,6 +941,10 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
     goto fail;
   }
 
+  /* This checkpt is now the parent of the next delta checkpt */
+
+  if( delta ) delta->parent = 1;
+
   /* Unlock the wksp */
 
   fd_wksp_private_unlock( wksp );
@@ -581,9 +964,13 @@ fail:
       FD_LOG_WARNING(( "fd_checkpt_fini failed; attempting to continue" ));
   }
 
+  if( FD_UNLIKELY( mmio ) ) fd_io_mmio_fini( mmio, mmio_sz );
+
   if( FD_LIKELY( fd!=-1 ) && FD_UNLIKELY( close( fd ) ) )
     FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
 
+  if( delta ) delta->parent = 0; /* Next delta checkpt will be full */
+
   if( FD_LIKELY( locked ) ) fd_wksp_private_unlock( wksp );
 
   return err_fail;
@@ -0,0 +1,119 @@
+#include "fd_wksp_private.h"
+
+ulong
+fd_wksp_delta_align( void ) {
+  return alignof(fd_wksp_delta_t);
+}
+
+ulong
+fd_wksp_delta_footprint( ulong part_max ) {
+  if( FD_UNLIKELY( (!part_max) | (part_max>FD_WKSP_PRIVATE_PINFO_IDX_NULL) ) ) return 0UL;
+  return sizeof(fd_wksp_delta_t) + part_max*sizeof(fd_wksp_delta_private_part_t);
+}
+
+void *
+fd_wksp_delta_new( void * shmem,
+                   ulong  part_max ) {
+  fd_wksp_delta_t * delta = (fd_wksp_delta_t *)shmem;
+
+  if( FD_UNLIKELY( !delta ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_wksp_delta_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_wksp_delta_footprint( part_max );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad part_max" ));
+    return NULL;
+  }
+
+  memset( delta, 0, footprint );
+
+  delta->part_max = part_max;
+  delta->gen      = 0UL;
+  delta->parent   = 0;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( delta->magic ) = FD_WKSP_DELTA_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return delta;
+}
+
+fd_wksp_delta_t *
+fd_wksp_delta_join( void * shdelta ) {
+  fd_wksp_delta_t * delta = (fd_wksp_delta_t *)shdelta;
+
+  if( FD_UNLIKELY( !delta ) ) {
+    FD_LOG_WARNING(( "NULL shdelta" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shdelta, fd_wksp_delta_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shdelta" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( delta->magic!=FD_WKSP_DELTA_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return delta;
+}
+
+void *
+fd_wksp_delta_leave( fd_wksp_delta_t * delta ) {
+
+  if( FD_UNLIKELY( !delta ) ) {
+    FD_LOG_WARNING(( "NULL delta" ));
+    return NULL;
+  }
+
+  return (void *)delta;
+}
+
+void *
+fd_wksp_delta_delete( void * shdelta ) {
+  fd_wksp_delta_t * delta = (fd_wksp_delta_t *)shdelta;
+
+  if( FD_UNLIKELY( !delta ) ) {
+    FD_LOG_WARNING(( "NULL shdelta" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shdelta, fd_wksp_delta_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shdelta" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( delta->magic!=FD_WKSP_DELTA_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( delta->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return (void *)delta;
+}
+
+fd_wksp_delta_t *
+fd_wksp_delta_reset( fd_wksp_delta_t * delta ) {
+
+  /* Note that we don't clear the partition tracking here.  The
+     generation keeps increasing over resets so stale partition info can
+     never be mistaken for info about the parent. */
+
+  delta->parent = 0;
+  return delta;
+}
+
+ulong fd_wksp_delta_gen       ( fd_wksp_delta_t const * delta ) { return delta->gen;    }
+int   fd_wksp_delta_has_parent( fd_wksp_delta_t const * delta ) { return delta->parent; }
@@ -62,7 +62,7 @@ fd_wksp_preview( char const *        path,
                  (v2->magic==FD_WKSP_MAGIC                                         ) &     /* with valid magic */
                  (v2->style==FD_WKSP_CHECKPT_STYLE_V2                              ) &     /* with valid style */
                  (fd_checkpt_frame_style_is_supported( v2->frame_style_compressed )) &     /* with supported compression */
-                 (v2->reserved==0U                                                 ) &     /* with expected reserved */
+                 (v2->delta<=1U                                                    ) &     /* with valid delta */
                  (name_len>0UL                                                     ) &     /* with valid name */
                  /* ignore seed (arbitrary) */
                  (fd_wksp_footprint( v2->part_max, v2->data_max )>0UL              ) ) ) { /* with valid part_max / data_max */
@@ -165,9 +165,9 @@ fd_wksp_checkpt_tpool( fd_tpool_t * tpool,
   switch( style ) {
   case FD_WKSP_CHECKPT_STYLE_V1: return fd_wksp_private_checkpt_v1( tpool, t0, t1, wksp, path, mode, uinfo );
   case FD_WKSP_CHECKPT_STYLE_V2: return fd_wksp_private_checkpt_v2( tpool, t0, t1, wksp, path, mode, uinfo,
-                                                                    FD_CHECKPT_FRAME_STYLE_RAW );
+                                                                    FD_CHECKPT_FRAME_STYLE_RAW, NULL );
   case FD_WKSP_CHECKPT_STYLE_V3: return fd_wksp_private_checkpt_v2( tpool, t0, t1, wksp, path, mode, uinfo,
-                                                                    FD_CHECKPT_FRAME_STYLE_LZ4 );
+                                                                    FD_CHECKPT_FRAME_STYLE_LZ4, NULL );
   break;
   }
 
@@ -175,6 +175,67 @@ fd_wksp_checkpt_tpool( fd_tpool_t * tpool,
   return FD_WKSP_ERR_INVAL;
 }
 
+int
+fd_wksp_checkpt_delta_tpool( fd_tpool_t *      tpool,
+                             ulong             t0,
+                             ulong             t1,
+                             fd_wksp_t *       wksp,
+                             fd_wksp_delta_t * delta,
+                             char const *      path,
+                             ulong             mode,
+                             int               style,
+                             char const *      uinfo ) {
+
+  /* Check input args */
+
+  if( FD_UNLIKELY( !delta ) ) {
+    FD_LOG_WARNING(( "NULL delta" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  /* Note: any failure below leaves delta without a parent */
+
+  if( FD_UNLIKELY( !wksp ) ) {
+    FD_LOG_WARNING(( "NULL wksp" ));
+    goto inval;
+  }
+
+  if( FD_UNLIKELY( delta->part_max<wksp->part_max ) ) {
+    FD_LOG_WARNING(( "delta part_max too small for wksp (delta %lu, wksp %lu)", delta->part_max, wksp->part_max ));
+    goto inval;
+  }
+
+  if( FD_UNLIKELY( !path ) ) {
+    FD_LOG_WARNING(( "NULL path" ));
+    goto inval;
+  }
+
+  if( FD_UNLIKELY( mode!=(ulong)(mode_t)mode ) ) {
+    FD_LOG_WARNING(( "bad mode" ));
+    goto inval;
+  }
+
+  style = fd_int_if( !!style, style, FD_HAS_LZ4 ? FD_WKSP_CHECKPT_STYLE_V3 : FD_WKSP_CHECKPT_STYLE_V2 );
+
+  if( FD_UNLIKELY( !uinfo ) ) uinfo = "";
+
+  /* Checkpt with the appropriate style */
+
+  switch( style ) {
+  case FD_WKSP_CHECKPT_STYLE_V2: return fd_wksp_private_checkpt_v2( tpool, t0, t1, wksp, path, mode, uinfo,
+                                                                    FD_CHECKPT_FRAME_STYLE_RAW, delta );
+  case FD_WKSP_CHECKPT_STYLE_V3: return fd_wksp_private_checkpt_v2( tpool, t0, t1, wksp, path, mode, uinfo,
+                                                                    FD_CHECKPT_FRAME_STYLE_LZ4, delta );
+  default: break;
+  }
+
+  FD_LOG_WARNING(( "unsupported style for a delta checkpt" ));
+
+inval:
+  fd_wksp_delta_reset( delta );
+  return FD_WKSP_ERR_INVAL;
+}
+
 int
 fd_wksp_restore_tpool( fd_tpool_t * tpool,
                        ulong        t0,
@@ -505,7 +505,7 @@ struct fd_wksp_checkpt_v2_hdr {
   ulong magic;                     /* Must be first, ==FD_WKSP_MAGIC */
   int   style;                     /* Must be second, wksp checkpt style */
   int   frame_style_compressed;    /* frame style used for compressed frames */
-  uint  reserved;                  /* header padding */
+  uint  delta;                     /* 0 for a full checkpt, 1 for a delta checkpt */
   char  name[ FD_SHMEM_NAME_MAX ]; /* cstr holding the original wksp name (note: FD_SHMEM_NAME_MAX==FD_LOG_NAME_MAX==40) */
   uint  seed;                      /* wksp seed when checkpointed (probably same used to construct) */
   ulong part_max;                  /* part_max used to construct the wksp */
@@ -572,10 +572,19 @@ typedef struct fd_wksp_checkpt_v2_info fd_wksp_checkpt_v2_info_t;
    checkpt and the offset to the last volume's appendix (or 0 if no
    volumes).
 
+   In a delta checkpt, a meta command with the
+   FD_WKSP_CHECKPT_V2_META_CLEAN bit set in gaddr_hi indicates an
+   allocation whose data is unchanged from the delta's parent checkpt.
+   In the cgroup data section, such an allocation is represented by the
+   8 byte fd_hash of its data (seeded with the header's seed) instead of
+   its data.  Restore leaves the data in place and verifies the hash.
+
    A fd_wksp_checkpt_v2_cmd_t supports writing an arbitrarily large
    checkpt single pass with only small upfront bounded allocation while
    supporting both streaming and parallel restore of those frames. */
 
+#define FD_WKSP_CHECKPT_V2_META_CLEAN (1UL<<63)
+
 union fd_wksp_checkpt_v2_cmd {
   struct { ulong tag; /* > 0 */ ulong gaddr_lo;                     ulong gaddr_hi;                    } meta;
   struct { ulong tag; /* ==0 */ ulong cgroup_cnt; /* ==ULONG_MAX */ ulong frame_off; /* ==ULONG_MAX */ } data;
@@ -625,7 +634,7 @@ struct fd_wksp_checkpt_v2_ftr {
   ulong part_max;                  /* " */
   uint  seed;                      /* " */
   char  name[ FD_SHMEM_NAME_MAX ]; /* " */
-  uint  reserved;                  /* " */
+  uint  delta;                     /* " */
   int   frame_style_compressed;    /* " */
   int   style;                     /* " */
   ulong unmagic;                   /* ==~FD_WKSP_MAGIC */
@@ -633,6 +642,54 @@ struct fd_wksp_checkpt_v2_ftr {
 
 typedef struct fd_wksp_checkpt_v2_ftr fd_wksp_checkpt_v2_ftr_t;
 
+/* FD_WKSP_DELTA_MAGIC is an ideally unique number that specifies the
+   precise memory layout of a fd_wksp_delta_t */
+
+#define FD_WKSP_DELTA_MAGIC (0xF17EDA2C3DE17A00UL) /* FIRE DANCER DELTA VERSION 0 */
+
+/* A fd_wksp_delta_private_part_t tracks the partition with the same
+   index in the pinfo array of a wksp checkpointed with a delta
+   tracker.  [gaddr_lo,gaddr_hi), tag and hash give the range, tag and
+   data hash of the partition when it was last checkpointed.  gen_seen
+   is the generation of the last checkpt that included the partition
+   and gen_data is the generation of the last checkpt that wrote its
+   data.  A partition is unchanged (clean) for the next checkpt if it
+   was seen in the parent checkpt and its range, tag and hash all
+   match.
+
+   hash is the 64-bit non-cryptographic fd_hash of the data seeded
+   with the wksp seed.  Change detection (and the verification of clean
+   partitions on restore) thus assumes that a modified partition never
+   hashes the same as before.  For accidental changes this fails with
+   probability ~2^-64 per partition per checkpt, in which case the
+   delta silently omits the change and restore keeps the stale data.
+   Delta checkpts should not be used for data an adversary can pick to
+   collide. */
+
+struct fd_wksp_delta_private_part {
+  ulong gaddr_lo;
+  ulong gaddr_hi;
+  ulong tag;
+  ulong hash;
+  ulong gen_seen;
+  ulong gen_data;
+};
+
+typedef struct fd_wksp_delta_private_part fd_wksp_delta_private_part_t;
+
+struct fd_wksp_delta_private {
+  ulong magic;    /* ==FD_WKSP_DELTA_MAGIC */
+  ulong part_max; /* Max partitions that can be tracked */
+  ulong gen;      /* Generation of the most recent checkpt with this tracker (0 if none) */
+  int   parent;   /* 1 if the most recent checkpt succeeded (and thus is the parent of the next checkpt) */
+  /* part_max fd_wksp_delta_private_part_t here */
+};
+
+FD_FN_PURE static inline fd_wksp_delta_private_part_t *
+fd_wksp_delta_private_part( fd_wksp_delta_t * delta ) {
+  return (fd_wksp_delta_private_part_t *)(delta+1);
+}
+
 /* fd_wksp_private_{checkpt,restore,printf}_v1 provide the v1
    implementations of {checkpt,restore,printf}.  That is, checkpt_v1
    will only write a v1 style checkpt while the {restore,printt}_v1 can
@@ -668,17 +725,20 @@ fd_wksp_private_printf_v1( int          fd,
 
 /* Similarly for v2.  Note that style==FD_WKSP_CHECKPT_STYLE_V3 in the
    fd_wksp_checkpt function becomes a FD_WKSP_CHECKPT_STYLE_V2 with a
-   FD_CHECKPT_FRAME_STYLE_LZ4 cgroup frames in the checkpt itself. */
+   FD_CHECKPT_FRAME_STYLE_LZ4 cgroup frames in the checkpt itself.  If
+   delta is non-NULL, checkpt_v2 will write a delta checkpt tracked by
+   delta (see fd_wksp_checkpt_delta_tpool). */
 
 int
-fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
-                            ulong        t0,
-                            ulong        t1,
-                            fd_wksp_t *  wksp,
-                            char const * path,
-                            ulong        mode,
-                            char const * uinfo,
-                            int          frame_style_compresed );
+fd_wksp_private_checkpt_v2( fd_tpool_t *      tpool,
+                            ulong             t0,
+                            ulong             t1,
+                            fd_wksp_t *       wksp,
+                            char const *      path,
+                            ulong             mode,
+                            char const *      uinfo,
+                            int               frame_style_compresed,
+                            fd_wksp_delta_t * delta );
 
 int
 fd_wksp_private_restore_v2( fd_tpool_t * tpool,
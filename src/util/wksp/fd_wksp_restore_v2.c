@@ -93,7 +93,7 @@ fd_wksp_restore_v2_hdr( fd_restore_t *             restore,
   RESTORE_TEST( hdr->magic==FD_WKSP_MAGIC                                          );
   RESTORE_TEST( hdr->style==FD_WKSP_CHECKPT_STYLE_V2                               );
   RESTORE_TEST( fd_checkpt_frame_style_is_supported( hdr->frame_style_compressed ) );
-  RESTORE_TEST( hdr->reserved==0U                                                  );
+  RESTORE_TEST( hdr->delta<=1U                                                     );
   RESTORE_TEST( name_len>0UL                                                       );
   /* ignore seed (arbitrary) */
   RESTORE_TEST( fd_wksp_footprint( hdr->part_max, hdr->data_max )>0UL              );
@@ -198,7 +198,7 @@ fd_wksp_restore_v2_ftr( fd_restore_t *                   restore,
   RESTORE_TEST( ftr->part_max                        ==hdr->part_max               );
   RESTORE_TEST( ftr->seed                            ==hdr->seed                   );
   RESTORE_TEST( !memcmp( ftr->name, hdr->name, FD_SHMEM_NAME_MAX )                 );
-  RESTORE_TEST( ftr->reserved                        ==hdr->reserved               );
+  RESTORE_TEST( ftr->delta                           ==hdr->delta                  );
   RESTORE_TEST( ftr->frame_style_compressed          ==hdr->frame_style_compressed );
   RESTORE_TEST( ftr->style                           ==hdr->style                  );
   RESTORE_TEST( ftr->unmagic                         ==~hdr->magic                 );
@@ -253,6 +253,7 @@ fd_wksp_private_restore_v2_common( fd_wksp_checkpt_v2_hdr_t * hdr,
                 "\ttid                    %-20lu\n"
                 "\tuser                   %-20lu (%s)\n"
                 "\tframe_style_compressed %-20i\n"       /* (v2 specific) */
+                "\tdelta                  %-20u\n"       /* (v2 specific) */
                 "\tmode                   %03lo",        /* (v2 specific) */
                 hdr->style, hdr->name, hdr->seed, hdr->part_max, hdr->data_max,
                 hdr->magic, info->wallclock, info_wallclock,
@@ -264,6 +265,7 @@ fd_wksp_private_restore_v2_common( fd_wksp_checkpt_v2_hdr_t * hdr,
                 info->tid,
                 info->user_id,   info_cstr[5],
                 hdr->frame_style_compressed,
+                hdr->delta,
                 info->mode ));
 
   /* The below info cstr are potentially long enough to be truncated by
@@ -280,6 +282,37 @@ fail:
   return FD_WKSP_ERR_FAIL;
 }
 
+/* fd_wksp_private_restore_v2_clean_verify verifies the partitions
+   [part_lo,part_hi) that a delta checkpt indicated were unchanged from
+   its parent (i.e. restored with stack_cidx 1 and the partition hash in
+   cycle_tag) already hold the parent's data in the wksp.  Returns
+   FD_WKSP_SUCCESS if so and FD_WKSP_ERR_FAIL (logs details) if not
+   (e.g. the delta is being restored onto the wrong parent). */
+
+static int
+fd_wksp_private_restore_v2_clean_verify( fd_wksp_t *                      wksp,
+                                         fd_wksp_checkpt_v2_hdr_t const * hdr,
+                                         ulong                            part_lo,
+                                         ulong                            part_hi ) {
+  fd_wksp_private_pinfo_t * pinfo = fd_wksp_private_pinfo( wksp );
+
+  for( ulong part_idx=part_lo; part_idx<part_hi; part_idx++ ) {
+    if( FD_LIKELY( !pinfo[ part_idx ].stack_cidx ) ) continue;
+
+    ulong gaddr_lo = pinfo[ part_idx ].gaddr_lo;
+    ulong gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+
+    ulong hash = fd_hash( (ulong)hdr->seed, fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
+    if( FD_UNLIKELY( hash!=pinfo[ part_idx ].cycle_tag ) ) {
+      FD_LOG_WARNING(( "restore failed because wksp partition [0x%016lx,0x%016lx) tag %lu does not match the delta checkpt's "
+                       "parent (restore the parent first)", gaddr_lo, gaddr_hi, pinfo[ part_idx ].tag ));
+      return FD_WKSP_ERR_FAIL;
+    }
+  }
+
+  return FD_WKSP_SUCCESS;
+}
+
 /* fd_wksp_private_restore_v2_cgroup restores a cgroup's allocation into
    wksp.  hdr contains the corresponding restore header info, frame_off
    is where the cgroup frame to restore is located and partitions
@@ -323,6 +356,8 @@ fd_wksp_private_restore_v2_cgroup( fd_wksp_t *                      wksp,
     ulong tag      = cmd->meta.tag;      /* non-zero */
     ulong gaddr_lo = cmd->meta.gaddr_lo;
     ulong gaddr_hi = cmd->meta.gaddr_hi;
+    ulong clean    = hdr->delta ? (gaddr_hi>>63) : 0UL;
+    if( hdr->delta ) gaddr_hi &= ~FD_WKSP_CHECKPT_V2_META_CLEAN;
 
     RESTORE_TEST( (hdr_data_lo<=gaddr_lo) & (gaddr_lo<gaddr_hi) & (gaddr_hi<=hdr_data_hi) );
     /* Note: disjoint [gaddr_lo,gaddr_hi) tested on rebuild */
@@ -335,9 +370,10 @@ fd_wksp_private_restore_v2_cgroup( fd_wksp_t *                      wksp,
     }
 
     dirty = 1;
-    pinfo[ part_idx ].gaddr_lo = gaddr_lo;
-    pinfo[ part_idx ].gaddr_hi = gaddr_hi;
-    pinfo[ part_idx ].tag      = tag;
+    pinfo[ part_idx ].gaddr_lo   = gaddr_lo;
+    pinfo[ part_idx ].gaddr_hi   = gaddr_hi;
+    pinfo[ part_idx ].tag        = tag;
+    pinfo[ part_idx ].stack_cidx = (uint)clean; /* reset on rebuild */
   }
 
   /* Restore the data command */
@@ -354,13 +390,16 @@ fd_wksp_private_restore_v2_cgroup( fd_wksp_t *                      wksp,
     /* Restore the allocation into the wksp data region */
 
     dirty = 1;
-    RESTORE_DATA( fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
+    if( FD_UNLIKELY( pinfo[ part_idx ].stack_cidx ) ) RESTORE_DATA( &pinfo[ part_idx ].cycle_tag, sizeof(ulong) );
+    else                                              RESTORE_DATA( fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
   }
 
   /* Close the frame */
 
   RESTORE_CLOSE();
 
+  if( FD_UNLIKELY( fd_wksp_private_restore_v2_clean_verify( wksp, hdr, part_lo, part_hi ) ) ) goto fail; /* logs details */
+
   RESTORE_TEST( (frame_off_lo<frame_off) & (frame_off<=frame_off_hi) ); /* == hi if compactly stored */
 
   *_dirty = dirty;
@@ -831,6 +870,8 @@ fd_wksp_private_restore_v2_stream( fd_wksp_t *    wksp,
         ulong tag      = cmd->meta.tag;      /* non-zero */
         ulong gaddr_lo = cmd->meta.gaddr_lo;
         ulong gaddr_hi = cmd->meta.gaddr_hi;
+        ulong clean    = hdr->delta ? (gaddr_hi>>63) : 0UL;
+        if( hdr->delta ) gaddr_hi &= ~FD_WKSP_CHECKPT_V2_META_CLEAN;
 
         RESTORE_TEST( (hdr_data_lo<=gaddr_lo) & (gaddr_lo<gaddr_hi) & (gaddr_hi<=hdr_data_hi) );
         /* Note: disjoint [gaddr_lo,gaddr_hi) tested on rebuild */
@@ -850,9 +891,10 @@ fd_wksp_private_restore_v2_stream( fd_wksp_t *    wksp,
         }
 
         dirty = 1;
-        pinfo[ ftr_alloc_cnt ].gaddr_lo = gaddr_lo;
-        pinfo[ ftr_alloc_cnt ].gaddr_hi = gaddr_hi;
-        pinfo[ ftr_alloc_cnt ].tag      = tag;
+        pinfo[ ftr_alloc_cnt ].gaddr_lo   = gaddr_lo;
+        pinfo[ ftr_alloc_cnt ].gaddr_hi   = gaddr_hi;
+        pinfo[ ftr_alloc_cnt ].tag        = tag;
+        pinfo[ ftr_alloc_cnt ].stack_cidx = (uint)clean; /* reset on rebuild */
         ftr_alloc_cnt++;
 
         RESTORE_META( cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) );
@@ -867,13 +909,16 @@ fd_wksp_private_restore_v2_stream( fd_wksp_t *    wksp,
         ulong gaddr_hi = pinfo[ part_idx ].gaddr_hi;
 
         dirty = 1;
-        RESTORE_DATA( fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
+        if( FD_UNLIKELY( pinfo[ part_idx ].stack_cidx ) ) RESTORE_DATA( &pinfo[ part_idx ].cycle_tag, sizeof(ulong) );
+        else                                              RESTORE_DATA( fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
       }
 
       /* Close the cgroup frame */
 
       RESTORE_CLOSE();
 
+      if( FD_UNLIKELY( fd_wksp_private_restore_v2_clean_verify( wksp, hdr, part_lo, ftr_alloc_cnt ) ) ) goto fail; /* logs details */
+
       /* Update verification info */
 
       vol_cgroup_alloc_cnt[ vol_cgroup_cnt ] = ftr_alloc_cnt - part_lo;
@@ -1077,7 +1122,8 @@ fd_wksp_private_printf_v2( int          out,
                    "\tgroup                  %-20lu (%s)\n"
                    "\ttid                    %-20lu\n"
                    "\tuser                   %-20lu (%s)\n"
-                   "\tframe_style_compressed %-20i\n",      /* (v2 specific) */
+                   "\tframe_style_compressed %-20i\n"       /* (v2 specific) */
+                   "\tdelta                  %-20u\n",      /* (v2 specific) */
                    hdr->magic,
                    info->wallclock, info_wallclock,
                    info->app_id,    info_cstr[0],
@@ -1087,7 +1133,8 @@ fd_wksp_private_printf_v2( int          out,
                    info->group_id,  info_cstr[4],
                    info->tid,
                    info->user_id,   info_cstr[5],
-                   hdr->frame_style_compressed ) );
+                   hdr->frame_style_compressed,
+                   hdr->delta ) );
 
     if( verbose>=2 )
       TRAP( dprintf( out, "\tmode                   %03lo\n" /* (v2 specific) */
@@ -1,8 +1,10 @@
 #include "../fd_util.h"
+#include "fd_wksp_private.h"
 /* FIXME: CLEANUP */
 #include <errno.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <stdlib.h>
 #include <sys/stat.h>
 
 static FD_TL fd_rng_t rng_mem[1];
@@ -20,6 +22,7 @@ static FD_FOR_ALL_BEGIN( rng_fini, 1L ) {
 typedef struct {
   ulong gaddr0;
   ulong sz;
+  ulong c;      /* Test pattern byte, in [1,255] */
 } alloc_info_t;
 
 static FD_FOR_ALL_BEGIN( alloc_init, 1L ) {
@@ -29,8 +32,7 @@ static FD_FOR_ALL_BEGIN( alloc_init, 1L ) {
   for( long idx=block_i0; idx<block_i1; idx++ ) {
     ulong gaddr0 = info[ idx ].gaddr0;   /* !=0 */
     ulong sz     = info[ idx ].sz;       /* >0  */
-    ulong tag    = (ulong)(idx+1L);      /* >0, unique */
-    int   c      = 1+(int)(tag % 255UL); /* in [1,255] */
+    int   c      = (int)info[ idx ].c;   /* in [1,255] */
     memset( fd_wksp_laddr_fast( wksp, gaddr0 ), c, sz ); /* Fill allocation region with test pattern */
   }
 
@@ -58,7 +60,7 @@ static FD_FOR_ALL_BEGIN( alloc_test, 1L ) {
     ulong gaddr0 = info[ idx ].gaddr0;   /* !=0 */
     ulong sz     = info[ idx ].sz;       /* >0  */
     ulong tag    = (ulong)(idx+1L);      /* >0, unique  */
-    int   c      = 1+(int)(tag % 255UL); /* in [1,255] */
+    int   c      = (int)info[ idx ].c;   /* in [1,255] */
 
     /* Verify that the first, last and randomly chosen byte of the
        allocation region matches the allocation tag */
@@ -75,6 +77,80 @@ static FD_FOR_ALL_BEGIN( alloc_test, 1L ) {
 
 } FD_FOR_ALL_END
 
+/* checkpt_v2_cgroups maps the v2 checkpt at path and locates its
+   cgroup frames.  On return, *_mmio / *_mmio_sz give the mapping (to be
+   released with fd_io_mmio_fini), [*_lo,*_hi) give the range of the
+   file holding the cgroup frames and frame_off[i] for i in
+   [0,*_cgroup_cnt) give the offsets of the cgroup frames relative to
+   *_lo.  The range (but not necessarily its location) is bit-for-bit
+   deterministic for a given wksp state (unlike the info frame that
+   precedes it, which has things like the wallclock of the checkpt). */
+
+static void
+checkpt_v2_cgroups( char const *    path,
+                    uchar const **  _mmio,
+                    ulong *         _mmio_sz,
+                    ulong *         _lo,
+                    ulong *         _hi,
+                    ulong *         _cgroup_cnt,
+                    ulong *         frame_off ) {
+  int fd = open( path, O_RDONLY, (mode_t)0 );
+  FD_TEST( fd!=-1 );
+
+  void const * mmio;
+  ulong        mmio_sz;
+  FD_TEST( !fd_io_mmio_init( fd, FD_IO_MMIO_MODE_READ_ONLY, &mmio, &mmio_sz ) );
+  FD_TEST( !close( fd ) );
+  FD_TEST( mmio_sz>=sizeof(fd_wksp_checkpt_v2_hdr_t)+sizeof(fd_wksp_checkpt_v2_ftr_t) );
+
+  fd_wksp_checkpt_v2_hdr_t hdr[1]; memcpy( hdr, mmio, sizeof(fd_wksp_checkpt_v2_hdr_t) );
+  fd_wksp_checkpt_v2_ftr_t ftr[1]; memcpy( ftr, (uchar const *)mmio + mmio_sz - sizeof(fd_wksp_checkpt_v2_ftr_t),
+                                           sizeof(fd_wksp_checkpt_v2_ftr_t) );
+  FD_TEST( hdr->style==FD_WKSP_CHECKPT_STYLE_V2 );
+  FD_TEST( ftr->checkpt_sz==mmio_sz );
+
+  int                      frame_style = hdr->frame_style_compressed;
+  fd_wksp_checkpt_v2_cmd_t cmd[1];
+  ulong                    off;
+
+  fd_restore_t   _restore[1];
+  fd_restore_t * restore = fd_restore_init_mmio( _restore, mmio, mmio_sz );
+  FD_TEST( restore );
+
+  /* The volumes frame gives the location of the appendix */
+
+  FD_TEST( !fd_restore_seek          ( restore, ftr->frame_off                             ) );
+  FD_TEST( !fd_restore_open_advanced ( restore, frame_style, &off                          ) );
+  FD_TEST( !fd_restore_meta          ( restore, cmd, sizeof(fd_wksp_checkpt_v2_cmd_t)      ) );
+  FD_TEST( !fd_restore_close_advanced( restore, &off                                       ) );
+
+  ulong appendix_off = cmd->volumes.frame_off;
+
+  /* The appendix gives the location of the cgroup frames */
+
+  static ulong alloc_cnt[ 1024 ];
+
+  FD_TEST( !fd_restore_seek          ( restore, appendix_off                               ) );
+  FD_TEST( !fd_restore_open_advanced ( restore, frame_style, &off                          ) );
+  FD_TEST( !fd_restore_meta          ( restore, cmd, sizeof(fd_wksp_checkpt_v2_cmd_t)      ) );
+  ulong cgroup_cnt = cmd->appendix.cgroup_cnt;
+  FD_TEST( cgroup_cnt<=1024UL );
+  FD_TEST( !fd_restore_data          ( restore, frame_off, cgroup_cnt*sizeof(ulong)        ) );
+  FD_TEST( !fd_restore_data          ( restore, alloc_cnt, cgroup_cnt*sizeof(ulong)        ) );
+  FD_TEST( !fd_restore_close_advanced( restore, &off                                       ) );
+
+  FD_TEST( fd_restore_fini( restore ) );
+
+  ulong lo = cgroup_cnt ? frame_off[0] : appendix_off;
+  for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) frame_off[ cgroup_idx ] -= lo;
+
+  *_mmio       = (uchar const *)mmio;
+  *_mmio_sz    = mmio_sz;
+  *_lo         = lo;
+  *_hi         = appendix_off;
+  *_cgroup_cnt = cgroup_cnt;
+}
+
 int
 main( int     argc,
       char ** argv ) {
@@ -89,10 +165,17 @@ main( int     argc,
   ulong        page_cnt   = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt",   NULL,             1UL );
   ulong        near_cpu   = fd_env_strip_cmdline_ulong( &argc, &argv, "--near-cpu",   NULL, fd_log_cpu_id() );
   ulong        iter_max   = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-max",   NULL,           100UL );
+  ulong        bench_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--bench-cnt",  NULL,             3UL );
 
   char tmp_path[256];
   if( !path ) path = fd_cstr_printf( tmp_path, 256UL, NULL, "/tmp/test_wksp_tpool.%lu.%li", fd_log_group_id(), fd_log_wallclock() );
 
+  char serial_path[ 256+8 ];
+  FD_TEST( fd_cstr_printf_check( serial_path, 256UL+8UL, NULL, "%s.serial", path ) );
+
+  char delta_path[ 256+8 ];
+  FD_TEST( fd_cstr_printf_check( delta_path, 256UL+8UL, NULL, "%s.delta", path ) );
+
   ulong mode = fd_cstr_to_ulong_octal( _mode );
 
   FD_LOG_NOTICE(( "Using --path %s --mode 0%03lo --keep %i", path, mode, keep ));
@@ -123,8 +206,24 @@ main( int     argc,
     wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
   }
 
+  FD_LOG_NOTICE(( "Creating delta checkpt tracker" ));
+
+  void * _delta = aligned_alloc( fd_wksp_delta_align(), fd_wksp_delta_footprint( wksp->part_max ) );
+  FD_TEST( _delta );
+  fd_wksp_delta_t * delta = fd_wksp_delta_join( fd_wksp_delta_new( _delta, wksp->part_max ) );
+  FD_TEST( delta );
+  FD_TEST( !fd_wksp_delta_has_parent( delta ) );
+
+  /* Delta checkpts need a v2 style and failed checkpts leave no parent */
+
+  FD_TEST( fd_wksp_checkpt_delta_tpool( tpool, 0UL, 1UL, wksp, delta, path, mode, FD_WKSP_CHECKPT_STYLE_V1, "" )
+           ==FD_WKSP_ERR_INVAL );
+  FD_TEST( !fd_wksp_delta_has_parent( delta ) );
+
   FD_LOG_NOTICE(( "Testing (--iter-max %lu)", iter_max ));
 
+  ulong data_sz = 0UL; /* Total allocation bytes of the most recent iteration */
+
   for( ulong iter=0UL; iter<iter_max; iter++ ) {
     FD_LOG_NOTICE(( "iter %lu", iter ));
 
@@ -147,8 +246,12 @@ main( int     argc,
       if( FD_UNLIKELY( !gaddr0 ) ) break;                       /* If wksp is full, we are done */
       info[ alloc_cnt ].gaddr0 = gaddr0;                        /* Save alloc details for thread parallel use below */
       info[ alloc_cnt ].sz     = sz;
+      info[ alloc_cnt ].c      = 1UL + (tag % 255UL);
     }
 
+    data_sz = 0UL;
+    for( long idx=0L; idx<alloc_cnt; idx++ ) data_sz += info[ idx ].sz;
+
     /* Fill each allocations with a test pattern */
 
     FD_FOR_ALL( alloc_init, tpool, 0UL, worker_cnt, 0L, alloc_cnt, wksp, info );
@@ -164,6 +267,29 @@ main( int     argc,
 
     FD_TEST( !fd_wksp_checkpt_tpool( tpool, t0, t1, wksp, path, mode, style, "test_wksp_tpool" ) );
 
+    /* For v2 style checkpts, test the thread parallel checkpt has the
+       same cgroup frames as a serial checkpt of the same wksp */
+
+    if( style!=FD_WKSP_CHECKPT_STYLE_V1 ) {
+      unlink( serial_path );
+      FD_TEST( !fd_wksp_checkpt_tpool( tpool, t0, 1UL, wksp, serial_path, mode, style, "test_wksp_tpool" ) );
+
+      static ulong frame_off0[ 1024 ]; static ulong frame_off1[ 1024 ];
+      uchar const * mmio0; ulong mmio_sz0; ulong lo0; ulong hi0; ulong cgroup_cnt0;
+      uchar const * mmio1; ulong mmio_sz1; ulong lo1; ulong hi1; ulong cgroup_cnt1;
+      checkpt_v2_cgroups( path,        &mmio0, &mmio_sz0, &lo0, &hi0, &cgroup_cnt0, frame_off0 );
+      checkpt_v2_cgroups( serial_path, &mmio1, &mmio_sz1, &lo1, &hi1, &cgroup_cnt1, frame_off1 );
+
+      FD_TEST( cgroup_cnt0==cgroup_cnt1 );
+      FD_TEST( hi0-lo0==hi1-lo1 );
+      FD_TEST( !memcmp( frame_off0, frame_off1, cgroup_cnt0*sizeof(ulong) ) );
+      FD_TEST( !memcmp( mmio0+lo0, mmio1+lo1, hi0-lo0 ) );
+
+      fd_io_mmio_fini( mmio0, mmio_sz0 );
+      fd_io_mmio_fini( mmio1, mmio_sz1 );
+      FD_TEST( !unlink( serial_path ) );
+    }
+
     /* Zero out all the allocations */
 
     FD_FOR_ALL( alloc_zero, tpool,0UL,worker_cnt, 0L,alloc_cnt, wksp, info );
@@ -181,10 +307,87 @@ main( int     argc,
     FD_FOR_ALL( alloc_test, tpool,0UL,worker_cnt, 0L,alloc_cnt, wksp, info, _rng );
 
     /* TODO: TEST THERE ARE NO OTHER ALLOCATIONS IN THE WKSP TOO! */
+
+    /* Test delta checkpts: checkpt the wksp as the start of a new
+       chain, change the test pattern of a random subset of the
+       allocations and delta checkpt the result. */
+
+    int dstyle = fd_int_if( style==FD_WKSP_CHECKPT_STYLE_V1, FD_WKSP_CHECKPT_STYLE_V2, style );
+
+    fd_wksp_delta_reset( delta );
+    ulong gen = fd_wksp_delta_gen( delta );
+
+    unlink( path );
+    FD_TEST( !fd_wksp_checkpt_delta_tpool( tpool, t0, t1, wksp, delta, path, mode, dstyle, "test_wksp_tpool" ) );
+    FD_TEST( fd_wksp_delta_gen( delta )==gen+1UL );
+    FD_TEST( fd_wksp_delta_has_parent( delta ) );
+
+    long clean_cnt = 0L;
+    long clean_sz  = 0L;
+    for( long idx=0L; idx<alloc_cnt; idx++ ) {
+      if( !fd_rng_uint_roll( rng, 8U ) ) info[ idx ].c = 1UL + (info[ idx ].c % 255UL);
+      else                               { clean_cnt++; clean_sz += (long)info[ idx ].sz; }
+    }
+
+    FD_FOR_ALL( alloc_init, tpool, 0UL, worker_cnt, 0L, alloc_cnt, wksp, info );
+
+    unlink( delta_path );
+    FD_TEST( !fd_wksp_checkpt_delta_tpool( tpool, t0, t1, wksp, delta, delta_path, mode, dstyle, "test_wksp_tpool" ) );
+    FD_TEST( fd_wksp_delta_gen( delta )==gen+2UL );
+
+    /* For raw frames, each unchanged allocation should have been
+       replaced by its 8 byte hash (note: the checkpt info includes the
+       path and delta_path is strlen(".delta") longer) */
+
+    struct stat stat_full;  FD_TEST( !stat( path,       &stat_full  ) );
+    struct stat stat_delta; FD_TEST( !stat( delta_path, &stat_delta ) );
+    if( dstyle==FD_WKSP_CHECKPT_STYLE_V2 )
+      FD_TEST( (long)stat_full.st_size - (long)stat_delta.st_size + 6L >= clean_sz - 8L*clean_cnt );
+
+    /* Restoring the chain in order should reproduce the wksp */
+
+    FD_FOR_ALL( alloc_zero, tpool,0UL,worker_cnt, 0L,alloc_cnt, wksp, info );
+
+    FD_TEST( !fd_wksp_restore_tpool( tpool, t2, t3, wksp, path,       seed1 ) );
+    FD_TEST( !fd_wksp_restore_tpool( tpool, t2, t3, wksp, delta_path, seed1 ) );
+
+    FD_FOR_ALL( alloc_test, tpool,0UL,worker_cnt, 0L,alloc_cnt, wksp, info, _rng );
+
+    /* Restoring the delta onto something other than its parent should
+       fail */
+
+    if( clean_cnt ) {
+      FD_FOR_ALL( alloc_zero, tpool,0UL,worker_cnt, 0L,alloc_cnt, wksp, info );
+      FD_TEST( fd_wksp_restore_tpool( tpool, t2, t3, wksp, delta_path, seed1 )!=FD_WKSP_SUCCESS );
+    }
+
+    FD_TEST( !unlink( delta_path ) );
+  }
+
+  /* Benchmark checkpt throughput versus thread count for raw and
+     compressed frames using the wksp state from the last iteration
+     (note: the test pattern is highly compressible). */
+
+  FD_LOG_NOTICE(( "Benchmarking (--bench-cnt %lu, %lu data bytes)", bench_cnt, data_sz ));
+
+  if( bench_cnt ) for( int style=FD_WKSP_CHECKPT_STYLE_V2; style<=(FD_HAS_LZ4 ? FD_WKSP_CHECKPT_STYLE_V3 : FD_WKSP_CHECKPT_STYLE_V2); style++ ) {
+    for( ulong t1=1UL; t1<=worker_cnt; t1 = fd_ulong_if( t1<worker_cnt, fd_ulong_min( 2UL*t1, worker_cnt ), t1+1UL ) ) {
+      long dt = LONG_MAX;
+      for( ulong rem=bench_cnt; rem; rem-- ) {
+        unlink( path );
+        long tic = fd_log_wallclock();
+        FD_TEST( !fd_wksp_checkpt_tpool( tpool, 0UL, t1, wksp, path, mode, style, "test_wksp_tpool" ) );
+        dt = fd_long_min( dt, fd_log_wallclock() - tic );
+      }
+      FD_LOG_NOTICE(( "style %i (%s frames), %2lu threads: %7.3f GB/s", style, style==FD_WKSP_CHECKPT_STYLE_V2 ? "raw" : "lz4",
+                      t1, (double)data_sz / (double)dt ));
+    }
   }
 
   FD_LOG_NOTICE(( "Cleaning up" ));
 
+  free( fd_wksp_delta_delete( fd_wksp_delta_leave( delta ) ) );
+
   if( FD_LIKELY( !keep ) && FD_UNLIKELY( unlink( path ) ) )
     FD_LOG_WARNING(( "unlink(%s) failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
 
@@ -176,6 +176,7 @@ fd_http_server_new( void *                     shmem,
   http->max_ws_recv_frame_len = params.max_ws_recv_frame_len;
   http->max_ws_send_frame_cnt = params.max_ws_send_frame_cnt;
   http->compress_websocket    = params.compress_websocket;
+  http->reuse_port            = params.reuse_port;
 
 #if FD_HAS_ZSTD
   http->zstd_ctx = ZSTD_initStaticCCtx( _zstd_ctx, ZSTD_estimateCCtxSize( FD_HTTP_ZSTD_COMPRESSION_LEVEL ) );
@@ -301,6 +302,9 @@ fd_http_server_listen( fd_http_server_t * http,
   if( FD_UNLIKELY( -1==setsockopt( sockfd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof( optval ) ) ) )
     FD_LOG_ERR(( "setsockopt failed (%i-%s)", errno, strerror( errno ) ));
 
+  if( FD_UNLIKELY( http->reuse_port && -1==setsockopt( sockfd, SOL_SOCKET, SO_REUSEPORT, &optval, sizeof( optval ) ) ) )
+    FD_LOG_ERR(( "setsockopt(SOL_SOCKET,SO_REUSEPORT,1) failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+
   struct sockaddr_in addr = {
     .sin_family      = AF_INET,
     .sin_port        = fd_ushort_bswap( port ),
@@ -308,6 +312,14 @@ fd_http_server_listen( fd_http_server_t * http,
   };
 
   if( FD_UNLIKELY( -1==bind( sockfd, fd_type_pun( &addr ), sizeof( addr ) ) ) ) {
+    /* With SO_REUSEPORT the kernel only lets us share the port with
+       sockets that also set it and belong to the same effective uid,
+       so EADDRINUSE here usually means something else owns the port. */
+    if( FD_UNLIKELY( http->reuse_port && errno==EADDRINUSE ) )
+      FD_LOG_ERR(( "bind(%i,AF_INET," FD_IP4_ADDR_FMT ":%u) with SO_REUSEPORT failed (%i-%s), the port is held by a socket "
+                   "that did not set SO_REUSEPORT or belongs to a different user",
+                   sockfd, FD_IP4_ADDR_FMT_ARGS( address ), port,
+                   errno, fd_io_strerror( errno ) ));
     FD_LOG_ERR(( "bind(%i,AF_INET," FD_IP4_ADDR_FMT ":%u) failed (%i-%s)",
                  sockfd, FD_IP4_ADDR_FMT_ARGS( address ), port,
                  errno, fd_io_strerror( errno ) ));
@@ -85,6 +85,7 @@ struct fd_http_server_params {
   ulong max_ws_send_frame_cnt; /* Maximum number of outgoing websocket frames that can be queued before the client is disconnected */
   ulong outgoing_buffer_sz;    /* Size of the outgoing data ring, which is used to stage outgoing HTTP response bodies and WebSocket frames */
   int   compress_websocket;    /* True if large websocket messages are compressed and sent as binary websocket frames */
+  int   reuse_port;            /* True if the listen socket sets SO_REUSEPORT, so several servers (e.g. one per tile) can listen on the same port.  The kernel spreads incoming connections across them.  Leave it off for a single server, as any process of the same user could then bind the port too */
 };
 
 typedef struct fd_http_server_params fd_http_server_params_t;
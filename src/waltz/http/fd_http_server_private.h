@@ -93,6 +93,7 @@ struct fd_http_server_hcache_private {
 struct __attribute__((aligned(FD_HTTP_SERVER_ALIGN))) fd_http_server_private {
 
   int   socket_fd;
+  int   reuse_port;
 
   uchar * oring;
   ulong   oring_sz;